@@ -80,6 +80,14 @@ ts::MessagePriorityQueue<MSG, COMPARE>::enqueuePlacement(const typename SuperCla
         return loc;
     }
 
+    // Fast path: a message with a strictly higher priority than all queued
+    // messages goes directly to the front, in constant time. The comparison
+    // must be strict so that messages with equal priority take the generic
+    // path and keep their enqueueing order.
+    if (!list.empty() && list.front() != nullptr && COMPARE()(*msg, *list.front())) {
+        return list.begin();
+    }
+
     // Loop until the previous element is lower that msg.
     while (loc != list.begin()) {
         const auto cur = loc;
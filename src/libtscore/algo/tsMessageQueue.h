@@ -193,7 +193,7 @@ namespace ts {
 
         // Enqueue/dequeue a safe pointer in the list and signal the corresponding condition.
         // Dequeue returns false if the list is empty. Must be executed under the protection of the lock.
-        void enqueuePtr(const MessagePtr& ptr);
+        void enqueuePtr(MessagePtr ptr);
         bool dequeuePtr(MessagePtr& ptr);
 
         // Wait for free space in the queue using a specific timeout, under the protection of the mutex.
@@ -268,10 +268,16 @@ ts::MessageQueue<MSG>::dequeuePlacement(MessageList& list)
 //----------------------------------------------------------------------------
 
 template <typename MSG>
-void ts::MessageQueue<MSG>::enqueuePtr(const MessagePtr& ptr)
+void ts::MessageQueue<MSG>::enqueuePtr(MessagePtr ptr)
 {
-    _queue.insert(enqueuePlacement(ptr, _queue), ptr);
-    _enqueued.notify_all();
+    // The placement is computed before moving the pointer into the list.
+    const auto it = enqueuePlacement(ptr, _queue);
+    _queue.insert(it, std::move(ptr));
+
+    // Exactly one message was inserted, wake up at most one consumer thread.
+    // All consumers wait on the same predicate, waking up all of them would
+    // only create a thundering herd on the mutex.
+    _enqueued.notify_one();
 }
 
 template <typename MSG>
@@ -284,11 +290,12 @@ bool ts::MessageQueue<MSG>::dequeuePtr(MessagePtr& ptr)
     }
     else {
         // Queue not empty, remove a message
-        ptr = *it;
+        ptr = std::move(*it);
         _queue.erase(it);
 
-        // Signal that a message has been dequeued
-        _dequeued.notify_all();
+        // Signal that a message has been dequeued. Exactly one slot was
+        // freed, wake up at most one producer thread.
+        _dequeued.notify_one();
         return true;
     }
 }
@@ -322,7 +329,7 @@ void ts::MessageQueue<MSG>::enqueue(MessagePtr& msg)
 {
     std::unique_lock<std::mutex> lock(_mutex);
     waitFreeSpace(lock);
-    enqueuePtr(msg);
+    enqueuePtr(std::move(msg));
     msg.reset();
 }
 
@@ -331,7 +338,7 @@ bool ts::MessageQueue<MSG>::enqueue(MessagePtr& msg, cn::milliseconds timeout)
 {
     std::unique_lock<std::mutex> lock(_mutex);
     if (waitFreeSpace(lock, timeout)) {
-        enqueuePtr(msg);
+        enqueuePtr(std::move(msg));
         msg.reset();
         return true;
     }
@@ -373,7 +380,7 @@ template <typename MSG>
 void ts::MessageQueue<MSG>::forceEnqueue(MessagePtr& msg)
 {
     std::lock_guard<std::mutex> lock(_mutex);
-    enqueuePtr(msg);
+    enqueuePtr(std::move(msg));
     msg.reset();
 }
 
@@ -0,0 +1,173 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsTDigest.h"
+#include <cmath>
+
+namespace {
+    // Scale function "k1" from the t-digest paper. It maps a quantile q to a scale
+    // where one unit corresponds to the maximum allowed weight of one centroid.
+    // Its derivative is minimal near q = 0 and q = 1, which keeps the centroids
+    // small in the tails and makes the extreme quantiles accurate.
+    double ScaleK(double q, double compression)
+    {
+        return (compression / (2.0 * M_PI)) * std::asin(2.0 * q - 1.0);
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Constructor.
+//----------------------------------------------------------------------------
+
+ts::TDigest::TDigest(size_t compression) :
+    _compression(std::max<size_t>(10, compression))
+{
+    // The buffer size is a tradeoff: larger buffers amortize the cost of the merges
+    // but retain more unsummarized samples between two merges.
+    _buffer.reserve(8 * _compression);
+}
+
+
+//----------------------------------------------------------------------------
+// Reset the statistics collection.
+//----------------------------------------------------------------------------
+
+void ts::TDigest::reset()
+{
+    _count = 0;
+    _min = 0.0;
+    _max = 0.0;
+    _centroids.clear();
+    _buffer.clear();
+}
+
+
+//----------------------------------------------------------------------------
+// Accumulate one more data sample.
+//----------------------------------------------------------------------------
+
+void ts::TDigest::feed(double value)
+{
+    if (_count == 0) {
+        _min = _max = value;
+    }
+    else {
+        _min = std::min(value, _min);
+        _max = std::max(value, _max);
+    }
+    _count++;
+    _buffer.push_back(value);
+    if (_buffer.size() >= _buffer.capacity()) {
+        flush();
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Merge the buffered samples into the centroid list.
+//----------------------------------------------------------------------------
+
+void ts::TDigest::flush() const
+{
+    if (_buffer.empty()) {
+        return;
+    }
+    std::sort(_buffer.begin(), _buffer.end());
+
+    // Merge the two sorted sequences (existing centroids and buffered samples) into a
+    // new centroid list. Consecutive clusters are combined as long as the combined
+    // weight does not exceed the limit of the scale function at that quantile.
+    _merged.clear();
+    _merged.reserve(_centroids.size() + 1);
+    const double total = double(_count);
+    const double compression = double(_compression);
+
+    size_t ic = 0;  // next existing centroid
+    size_t ib = 0;  // next buffered sample
+    auto next = [&]() -> Centroid {
+        if (ic < _centroids.size() && (ib >= _buffer.size() || _centroids[ic].mean <= _buffer[ib])) {
+            return _centroids[ic++];
+        }
+        else {
+            return Centroid{_buffer[ib++], 1.0};
+        }
+    };
+
+    double so_far = 0.0;   // weight of all completed clusters
+    double k_lo = ScaleK(0.0, compression);
+    Centroid cur = next();
+    while (ic < _centroids.size() || ib < _buffer.size()) {
+        const Centroid c = next();
+        if (ScaleK((so_far + cur.weight + c.weight) / total, compression) - k_lo <= 1.0) {
+            // The combined cluster is still small enough at this quantile, absorb it.
+            cur.mean += (c.weight / (cur.weight + c.weight)) * (c.mean - cur.mean);
+            cur.weight += c.weight;
+        }
+        else {
+            // Close the current cluster and start a new one.
+            _merged.push_back(cur);
+            so_far += cur.weight;
+            k_lo = ScaleK(so_far / total, compression);
+            cur = c;
+        }
+    }
+    _merged.push_back(cur);
+
+    _centroids.swap(_merged);
+    _buffer.clear();
+}
+
+
+//----------------------------------------------------------------------------
+// Estimate a quantile of all accumulated samples.
+//----------------------------------------------------------------------------
+
+double ts::TDigest::quantile(double q) const
+{
+    flush();
+    if (_count == 0) {
+        return 0.0;
+    }
+    if (q <= 0.0 || _count == 1) {
+        return _min;
+    }
+    if (q >= 1.0) {
+        return _max;
+    }
+
+    // Each centroid is assumed to be centered on the middle of its weight range.
+    // Locate the two consecutive centers which bracket the target rank and
+    // interpolate linearly between them. The edges use the exact min and max.
+    const double target = q * double(_count);
+    double prev_center = 0.0;
+    double prev_mean = _min;
+    double so_far = 0.0;
+    for (const auto& c : _centroids) {
+        const double center = so_far + c.weight / 2.0;
+        if (target < center) {
+            const double width = center - prev_center;
+            return width <= 0.0 ? c.mean : prev_mean + (target - prev_center) * (c.mean - prev_mean) / width;
+        }
+        prev_center = center;
+        prev_mean = c.mean;
+        so_far += c.weight;
+    }
+    const double width = double(_count) - prev_center;
+    return width <= 0.0 ? prev_mean : prev_mean + (target - prev_center) * (_max - prev_mean) / width;
+}
+
+
+//----------------------------------------------------------------------------
+// Estimate a quantile of all accumulated samples as a string.
+//----------------------------------------------------------------------------
+
+ts::UString ts::TDigest::quantileString(double q, size_t width, size_t precision) const
+{
+    return UString::Format(u"%*.*f", width, precision, quantile(q));
+}
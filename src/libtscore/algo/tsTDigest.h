@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Streaming estimation of quantiles using the t-digest algorithm.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsUString.h"
+
+namespace ts {
+    //!
+    //! Streaming estimation of quantiles using the t-digest algorithm.
+    //! @ingroup libtscore cpp
+    //!
+    //! Unlike ts::SingleDataStatistics, which only maintains aggregates (mean, variance),
+    //! this class can estimate arbitrary quantiles (median, 99th percentile, etc.) without
+    //! storing the individual samples. The samples are summarized in a bounded list of
+    //! centroids which is finer near the extreme quantiles, making the estimation of the
+    //! tails (p99, p999) very accurate. The memory usage is a few KB, constant, regardless
+    //! of the number of accumulated samples.
+    //!
+    //! @see Ted Dunning, Otmar Ertl, "Computing Extremely Accurate Quantiles Using t-Digests",
+    //! https://arxiv.org/abs/1902.04023
+    //!
+    class TSCOREDLL TDigest
+    {
+    public:
+        //!
+        //! Default compression factor.
+        //!
+        static constexpr size_t DEFAULT_COMPRESSION = 100;
+
+        //!
+        //! Constructor.
+        //! @param [in] compression Compression factor, usually called "delta" in the t-digest
+        //! literature. The number of retained centroids is bounded by twice that value. Higher
+        //! values give more accurate quantiles and use more memory. The default is appropriate
+        //! for accurate p99 and p999 estimations.
+        //!
+        explicit TDigest(size_t compression = DEFAULT_COMPRESSION);
+
+        //!
+        //! Reset the statistics collection.
+        //!
+        void reset();
+
+        //!
+        //! Accumulate one more data sample.
+        //! @param [in] value Data sample.
+        //!
+        void feed(double value);
+
+        //!
+        //! Get the number of accumulated samples.
+        //! @return The number of accumulated samples.
+        //!
+        size_t count() const { return _count; }
+
+        //!
+        //! Get the minimum value of all accumulated samples.
+        //! @return The minimum value.
+        //!
+        double minimum() const { return _count == 0 ? 0.0 : _min; }
+
+        //!
+        //! Get the maximum value of all accumulated samples.
+        //! @return The maximum value.
+        //!
+        double maximum() const { return _count == 0 ? 0.0 : _max; }
+
+        //!
+        //! Estimate a quantile of all accumulated samples.
+        //! @param [in] q The quantile to estimate, in the range 0.0 to 1.0.
+        //! For instance, 0.5 is the median and 0.99 the 99th percentile.
+        //! @return The estimated quantile value. Zero when no sample was accumulated.
+        //!
+        double quantile(double q) const;
+
+        //!
+        //! Estimate a quantile of all accumulated samples as a string.
+        //! @param [in] q The quantile to estimate, in the range 0.0 to 1.0.
+        //! @param [in] width Minimum width of the string, left-padded with spaces.
+        //! @param [in] precision Number of decimal digits.
+        //! @return The estimated quantile value as a string.
+        //!
+        UString quantileString(double q, size_t width = 0, size_t precision = 2) const;
+
+    private:
+        // A centroid summarizes a cluster of samples by their mean and count.
+        class Centroid
+        {
+        public:
+            double mean = 0.0;
+            double weight = 0.0;
+        };
+
+        size_t _compression;
+        size_t _count = 0;
+        double _min = 0.0;
+        double _max = 0.0;
+
+        // Incoming samples are buffered and periodically merged into the sorted centroid
+        // list. The data members are mutable and the merge is lazily triggered from the
+        // const quantile() method when samples are pending.
+        mutable std::vector<Centroid> _centroids {};
+        mutable std::vector<double>   _buffer {};
+        mutable std::vector<Centroid> _merged {};  // work area for flush()
+
+        // Merge the buffered samples into the centroid list.
+        void flush() const;
+    };
+}
@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsTimerService.h"
+
+TS_DEFINE_SINGLETON(ts::TimerService);
+
+
+//----------------------------------------------------------------------------
+// Constructor and destructor.
+//----------------------------------------------------------------------------
+
+ts::TimerService::TimerService()
+{
+}
+
+ts::TimerService::~TimerService()
+{
+    // Terminate the thread and wait for actual thread termination.
+    // Does nothing if the thread has not been started.
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+        _condition.notify_all();
+    }
+    waitForTermination();
+}
+
+
+//----------------------------------------------------------------------------
+// Schedule a one-shot timer.
+//----------------------------------------------------------------------------
+
+ts::TimerService::TimerId ts::TimerService::schedule(cn::milliseconds delay, std::function<void()> callback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Allocate a timer id. The id space is 64-bit wide, it never wraps in practice.
+    const TimerId id = _next_id++;
+    Timer& timer(_timers[id]);
+    timer.due = monotonic_time::clock::now() + delay;
+    timer.callback = std::move(callback);
+
+    if (_started) {
+        // Timer thread already started, signal the new timer.
+        _condition.notify_all();
+    }
+    else {
+        // Lazily start the timer thread on first schedule.
+        _started = true;
+        Thread::start();
+    }
+    return id;
+}
+
+
+//----------------------------------------------------------------------------
+// Cancel a scheduled timer.
+//----------------------------------------------------------------------------
+
+void ts::TimerService::cancel(TimerId id)
+{
+    if (id == NO_TIMER) {
+        // Not a valid timer id. Return immediately: _executing is NO_TIMER
+        // whenever no callback is running and waiting on it would deadlock.
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    if (_timers.erase(id) != 0) {
+        // The timer was still pending, wake up the thread to recompute its wait.
+        _condition.notify_all();
+    }
+    else if (_executing == id && !isCurrentThread()) {
+        // The callback is currently executing in the timer thread, wait for its
+        // completion so that the caller can safely destruct captured resources.
+        // When invoked from the callback itself, return immediately (the caller
+        // obviously knows that the callback is executing).
+        _completed.wait(lock, [this, id]() { return _executing != id; });
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Invoked in the context of the timer thread.
+//----------------------------------------------------------------------------
+
+void ts::TimerService::main()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (!_terminate) {
+
+        // Find the next timer to expire.
+        auto next = _timers.end();
+        for (auto it = _timers.begin(); it != _timers.end(); ++it) {
+            if (next == _timers.end() || it->second.due < next->second.due) {
+                next = it;
+            }
+        }
+
+        if (next == _timers.end()) {
+            // No scheduled timer, wait for one.
+            _condition.wait(lock);
+        }
+        else if (monotonic_time::clock::now() < next->second.due) {
+            // The next timer is in the future, sleep until its expiration or a change.
+            _condition.wait_until(lock, next->second.due);
+        }
+        else {
+            // The next timer has expired, extract it and invoke its callback.
+            const TimerId id = next->first;
+            const std::function<void()> callback(std::move(next->second.callback));
+            _timers.erase(next);
+            _executing = id;
+
+            // Invoke the callback without holding the mutex to avoid deadlocks
+            // when the callback schedules or cancels timers.
+            lock.unlock();
+            if (callback != nullptr) {
+                callback();
+            }
+            lock.lock();
+
+            _executing = NO_TIMER;
+            _completed.notify_all();
+        }
+    }
+}
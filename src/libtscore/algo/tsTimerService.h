@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Shared timer service, one thread for all timers in the process.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsThread.h"
+
+#include "tsBeforeStandardHeaders.h"
+#include <functional>
+#include "tsAfterStandardHeaders.h"
+
+namespace ts {
+    //!
+    //! Shared timer service, one thread for all timers in the process.
+    //! @ingroup libtscore thread
+    //!
+    //! This is a singleton. All timers in the process are multiplexed over one
+    //! single internal thread, instead of having one idle thread per timer.
+    //! The thread is lazily created when the first timer is scheduled.
+    //!
+    //! A timer is one-shot: its callback is invoked once, at expiration, in the
+    //! context of the shared timer thread, and the timer is then forgotten.
+    //! Since all timers share the same thread, callbacks shall be reasonably
+    //! fast; a slow callback delays the expiration of all other timers.
+    //!
+    class TSCOREDLL TimerService : private Thread
+    {
+        TS_SINGLETON(TimerService);
+    public:
+        //!
+        //! Identification of a scheduled timer.
+        //!
+        using TimerId = uint64_t;
+
+        //!
+        //! A reserved value which is never used as an actual timer id.
+        //!
+        static constexpr TimerId NO_TIMER = 0;
+
+        //!
+        //! Schedule a one-shot timer.
+        //! @param [in] delay Delay after which the callback is invoked.
+        //! @param [in] callback The callback to invoke at expiration, in the
+        //! context of the shared timer thread.
+        //! @return The timer id, to be used with cancel().
+        //!
+        TimerId schedule(cn::milliseconds delay, std::function<void()> callback);
+
+        //!
+        //! Cancel a scheduled timer.
+        //! If the callback is currently executing in the timer thread, wait for
+        //! its completion first. Consequently, upon return, it is guaranteed that
+        //! the callback is not and will never be invoked, and all resources it
+        //! captured can be safely destructed. As an exception, when cancel() is
+        //! invoked from the callback itself, it returns immediately.
+        //! @param [in] id The timer id, as returned by schedule().
+        //! Unknown or already expired ids are ignored, as well as NO_TIMER.
+        //!
+        void cancel(TimerId id);
+
+    private:
+        // A scheduled timer.
+        class Timer
+        {
+        public:
+            monotonic_time        due {};       // Expiration time.
+            std::function<void()> callback {};  // To invoke at expiration.
+        };
+
+        std::mutex              _mutex {};             // Mutex to protect the following fields.
+        std::condition_variable _condition {};         // Signaled when the timer set changes.
+        std::condition_variable _completed {};         // Signaled when a callback completes.
+        std::map<TimerId,Timer> _timers {};            // All scheduled timers.
+        TimerId                 _next_id = 1;          // Next timer id to allocate.
+        TimerId                 _executing = NO_TIMER; // Timer which is currently executing its callback.
+        bool                    _started = false;      // The thread is started.
+        bool                    _terminate = false;    // Terminate the thread.
+
+        // Destructor.
+        virtual ~TimerService() override;
+
+        // Implementation of Thread.
+        virtual void main() override;
+    };
+}
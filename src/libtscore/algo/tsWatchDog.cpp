@@ -23,11 +23,10 @@ ts::WatchDog::WatchDog(WatchDogHandlerInterface* handler, cn::milliseconds timeo
 
 ts::WatchDog::~WatchDog()
 {
-    // Terminate the thread and wait for actual thread termination.
-    // Does nothing if the thread has not been started.
-    _terminate = true;
-    _condition.notify_all();
-    waitForTermination();
+    // Cancel any scheduled timer. If the handler is currently executing in the
+    // timer thread, suspend() waits for its completion. Upon return, it is
+    // guaranteed that the timer service no longer references this object.
+    suspend();
 }
 
 
@@ -43,20 +42,13 @@ void ts::WatchDog::setWatchDogHandler(WatchDogHandlerInterface* h)
 
 
 //----------------------------------------------------------------------------
-// Activate the watchdog. Must be called with mutex held.
+// Arm the watchdog in the timer service. Must be called with mutex held.
 //----------------------------------------------------------------------------
 
-void ts::WatchDog::activate()
+void ts::WatchDog::arm()
 {
-    if (_started) {
-        // Watchdog thread already started, signal the condition.
-        _condition.notify_all();
-    }
-    else {
-        // Start the watchdog thread.
-        _started = true;
-        Thread::start();
-    }
+    const uint64_t gen = _generation;
+    _timer = TimerService::Instance().schedule(_timeout, [this, gen]() { timerExpired(gen); });
 }
 
 
@@ -66,12 +58,21 @@ void ts::WatchDog::activate()
 
 void ts::WatchDog::setTimeout(cn::milliseconds timeout, bool auto_start)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _timeout = timeout;
-    _active = auto_start;
-    if (auto_start) {
-        activate();
+    TimerService::TimerId previous = TimerService::NO_TIMER;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _timeout = timeout;
+        _active = auto_start;
+        _generation++;
+        previous = _timer;
+        _timer = TimerService::NO_TIMER;
+        if (auto_start && timeout > cn::milliseconds::zero()) {
+            arm();
+        }
     }
+    // Cancel outside the mutex: cancel() may wait for a pending expiration
+    // which needs the mutex to detect that it is now obsolete.
+    TimerService::Instance().cancel(previous);
 }
 
 
@@ -81,9 +82,18 @@ void ts::WatchDog::setTimeout(cn::milliseconds timeout, bool auto_start)
 
 void ts::WatchDog::restart()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _active = true;
-    activate();
+    TimerService::TimerId previous = TimerService::NO_TIMER;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _active = true;
+        _generation++;
+        previous = _timer;
+        _timer = TimerService::NO_TIMER;
+        if (_timeout > cn::milliseconds::zero()) {
+            arm();
+        }
+    }
+    TimerService::Instance().cancel(previous);
 }
 
 
@@ -93,44 +103,49 @@ void ts::WatchDog::restart()
 
 void ts::WatchDog::suspend()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _active = false;
-    // Signal the condition if the thread is started.
-    // No need to activate the thread if not started.
-    _condition.notify_all();
+    TimerService::TimerId previous = TimerService::NO_TIMER;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _active = false;
+        _generation++;
+        previous = _timer;
+        _timer = TimerService::NO_TIMER;
+    }
+    TimerService::Instance().cancel(previous);
 }
 
 
 //----------------------------------------------------------------------------
-// Invoked in the context of the server thread.
+// Invoked by the timer service at expiration of the timeout.
 //----------------------------------------------------------------------------
 
-void ts::WatchDog::main()
+void ts::WatchDog::timerExpired(uint64_t generation)
 {
-    _log.debug(u"Watchdog thread started, id %d", _watch_dog_id);
-
-    while (!_terminate) {
-        bool expired = false;
-        WatchDogHandlerInterface* h = nullptr;
-
-        // Wait for the condition to be signaled. Get protected data while under mutex protection.
-        {
-            std::unique_lock<std::mutex> lock(_mutex);
-            if (!_active || _timeout <= cn::milliseconds::zero()) {
-                _condition.wait(lock);
-            }
-            else {
-                expired = _condition.wait_for(lock, _timeout) == std::cv_status::timeout;
-            }
-            h = _handler;
+    WatchDogHandlerInterface* h = nullptr;
+
+    // Get protected data while under mutex protection.
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (generation != _generation || !_active) {
+            // The watchdog was restarted or suspended in the meantime.
+            return;
         }
+        h = _handler;
+    }
 
-        // Handle the expiration. No longer under mutex protection to avoid deadlocks in handler.
-        if (!_terminate && expired && h != nullptr) {
-            _log.debug(u"Watchdog expired, id %d", _watch_dog_id);
-            h->handleWatchDogTimeout(*this);
-        }
+    // Handle the expiration. No longer under mutex protection to avoid deadlocks in handler.
+    if (h != nullptr) {
+        _log.debug(u"Watchdog expired, id %d", _watch_dog_id);
+        h->handleWatchDogTimeout(*this);
     }
 
-    _log.debug(u"Watchdog thread completed, id %d", _watch_dog_id);
+    // Rearm the watchdog if it was not restarted or suspended by the handler.
+    // Just like the historical implementation, an active watchdog fires again
+    // after each timeout period until restart() or suspend() is called.
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (generation == _generation && _active && _timeout > cn::milliseconds::zero()) {
+            arm();
+        }
+    }
 }
@@ -13,8 +13,8 @@
 
 #pragma once
 #include "tsWatchDogHandlerInterface.h"
+#include "tsTimerService.h"
 #include "tsNullReport.h"
-#include "tsThread.h"
 #include "tsReport.h"
 
 namespace ts {
@@ -27,10 +27,10 @@ namespace ts {
     //! a "next input". To avoid this, restart() or suspend() must be called before
     //! the timeout expires.
     //!
-    //! A WatchDog instance contains an internal thread which is started in the constructor
-    //! and terminated in the destructor.
+    //! All watchdogs are multiplexed over the shared TimerService thread.
+    //! The handler is invoked in the context of that shared thread.
     //!
-    class TSCOREDLL WatchDog : private Thread
+    class TSCOREDLL WatchDog
     {
         TS_NOCOPY(WatchDog);
     public:
@@ -49,7 +49,7 @@ namespace ts {
         //!
         //! Destructor.
         //!
-        virtual ~WatchDog() override;
+        ~WatchDog();
 
         //!
         //! Set a new timeout value.
@@ -91,18 +91,17 @@ namespace ts {
     private:
         Report&                   _log;                // For debug messages.
         volatile int              _watch_dog_id = 0;   // Application-defined watchdog identifier.
-        volatile bool             _terminate = false;  // Terminate the thread.
         std::mutex                _mutex {};           // Mutex to protect the following fields.
-        std::condition_variable   _condition {};       // Condition to signal when something changed.
         WatchDogHandlerInterface* _handler = nullptr;  // Handler for expiration.
         cn::milliseconds          _timeout {};         // Expiration timeout, 0 means no timeout.
         bool                      _active = false;     // The watchdog is active.
-        bool                      _started = false;    // The thread is started.
+        uint64_t                  _generation = 0;     // Incremented each time the watchdog is rearmed or stopped.
+        TimerService::TimerId     _timer = TimerService::NO_TIMER;  // Currently scheduled timer.
 
-        // Activate the watchdog. Must be called with mutex held.
-        void activate();
+        // Arm the watchdog in the timer service. Must be called with mutex held.
+        void arm();
 
-        // Implementation of Thread.
-        virtual void main() override;
+        // Invoked by the timer service at expiration of the timeout.
+        void timerExpired(uint64_t generation);
     };
 }
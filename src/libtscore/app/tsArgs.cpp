@@ -580,7 +580,7 @@ ts::UString ts::Args::formatHelpOptions(size_t line_width) const
 // Add a new option.
 //----------------------------------------------------------------------------
 
-void ts::Args::addOption(const IOption& opt)
+void ts::Args::addOption(IOption opt)
 {
     // Erase previous version, if any.
     if (_debug_args && _iopts.contains(opt.name)) {
@@ -601,8 +601,10 @@ void ts::Args::addOption(const IOption& opt)
         }
     }
 
-    // Finally add the new option.
-    _iopts.insert(std::make_pair(opt.name, opt));
+    // Finally add the new option. The key is copied before moving the option
+    // since the move steals the name field.
+    const UString name(opt.name);
+    _iopts.insert(std::make_pair(name, std::move(opt)));
 }
 
 
@@ -610,11 +612,13 @@ void ts::Args::addOption(const IOption& opt)
 // Add the help text of an exiting option.
 //----------------------------------------------------------------------------
 
-ts::Args& ts::Args::help(const UChar* name, const UString& syntax, const UString& text)
+ts::Args& ts::Args::help(const UChar* name, UString syntax, UString text)
 {
+    // The strings are passed by value and moved: callers typically build the
+    // help text as a temporary which is never copied again.
     IOption& opt(getIOption(name));
-    opt.syntax = syntax;
-    opt.help = text;
+    opt.syntax = std::move(syntax);
+    opt.help = std::move(text);
     return *this;
 }
 
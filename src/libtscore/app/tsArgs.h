@@ -451,7 +451,7 @@ namespace ts {
         //! @param [in] text Help text. Unformatted, line breaks will be added automatically.
         //! @return A reference to this instance.
         //!
-        Args& help(const UChar* name, const UString& syntax, const UString& text);
+        Args& help(const UChar* name, UString syntax, UString text);
 
         //!
         //! Add the help text of an existing option.
@@ -460,9 +460,9 @@ namespace ts {
         //! @param [in] text Help text. Unformatted, line breaks will be added automatically.
         //! @return A reference to this instance.
         //!
-        Args& help(const UChar* name, const UString& text)
+        Args& help(const UChar* name, UString text)
         {
-            return help(name, UString(), text);
+            return help(name, UString(), std::move(text));
         }
 
         //!
@@ -1358,7 +1358,9 @@ namespace ts {
         static constexpr const UChar* DECIMAL_POINTS = u".";
 
         // Add a new option.
-        void addOption(const IOption& opt);
+        // The parameter is passed by value: option() callers provide a temporary
+        // IOption which is moved, not deep-copied, all the way into the option map.
+        void addOption(IOption opt);
 
         // Adjust predefined options based on flags.
         void adjustPredefinedOptions();
@@ -59,6 +59,8 @@ ts::Names::Names(const Names& other)
     // Since these elements are read-only, this is not an issue.
     _entries = other._entries;
     _short_entries = other._short_entries;
+    _pending_lines = other._pending_lines;
+    _lazy = other._lazy.load();
 }
 
 // Move constructor.
@@ -76,6 +78,8 @@ ts::Names::Names(Names&& other)
     _inherit = std::move(other._inherit);
     _entries = std::move(other._entries);
     _short_entries = std::move(other._short_entries);
+    _pending_lines = std::move(other._pending_lines);
+    _lazy = other._lazy.load();
 }
 
 // Copy assignment.
@@ -98,6 +102,8 @@ ts::Names& ts::Names::operator=(const Names& other)
         // Since these elements are read-only, this is not an issue.
         _entries = other._entries;
         _short_entries = other._short_entries;
+        _pending_lines = other._pending_lines;
+        _lazy = other._lazy.load();
     }
     return *this;
 }
@@ -118,6 +124,8 @@ ts::Names& ts::Names::operator=(Names&& other)
         _inherit = std::move(other._inherit);
         _entries = std::move(other._entries);
         _short_entries = std::move(other._short_entries);
+        _pending_lines = std::move(other._pending_lines);
+        _lazy = other._lazy.load();
     }
     return *this;
 }
@@ -129,6 +137,7 @@ ts::Names& ts::Names::operator=(Names&& other)
 
 bool ts::Names::freeRange(uint_t first, uint_t last) const
 {
+    materialize();
     // Read lock (shared).
     std::shared_lock<std::shared_mutex> lock(_mutex);
     return freeRangeLocked(first, last);
@@ -162,6 +171,8 @@ bool ts::Names::freeRangeLocked(uint_t first, uint_t last) const
 
 void ts::Names::addValueImpl(const NameValue& range)
 {
+    // Decode deferred definitions first, to preserve the order of additions.
+    materialize();
     // Write lock (exclusive).
     std::lock_guard<std::shared_mutex> lock(_mutex);
     addValueImplLocked(range);
@@ -195,12 +206,123 @@ void ts::Names::addValueImplLocked(const UString& name, uint_t first, uint_t las
 }
 
 
+//----------------------------------------------------------------------------
+// Lazy materialization of sections loaded from a ".names" file.
+//----------------------------------------------------------------------------
+
+void ts::Names::materializeNow()
+{
+    // Write lock (exclusive).
+    std::lock_guard<std::shared_mutex> lock(_mutex);
+
+    // Double check under lock, another thread may have materialized the section.
+    if (!_lazy) {
+        return;
+    }
+
+    // Decode all deferred value definitions.
+    for (const auto& it : _pending_lines) {
+        if (!decodeValueLocked(it.first, it.second)) {
+            CERR.error(u"%s: section %s, invalid line: %s", it.first, _section_name, it.second);
+        }
+    }
+    _pending_lines.clear();
+    _lazy = false;
+
+    // Verify the presence of extended values, as declared with "Extended=true".
+    bool extended = false;
+    if (_bits > 0 && _bits < 8 * sizeof(uint_t)) {
+        for (const auto& val : _entries) {
+            // Only check the extension in 'last', it is greater than 'first'.
+            if ((val.second->last & ~_mask) != 0) {
+                extended = true;
+                break;
+            }
+        }
+    }
+    if (extended != _has_extended) {
+        CERR.error(u"section %s, extended is %s, found%s extended values", _section_name, _has_extended, extended ? u"" : u" no");
+    }
+
+    // In the presence of extended values, build the 'short_entries' multimap, indexed by short values.
+    // The section may be materialized again after the merge of an extension file, rebuild from scratch.
+    _short_entries.clear();
+    if (extended) {
+        // If there are more than one value in the range, it is possible that they span multiple short values.
+        const uint_t increment = uint_t(1) << _bits;
+        const uint_t max = std::numeric_limits<uint_t>::max() - increment;
+        for (const auto& val : _entries) {
+            uint_t index = val.second->first;
+            while (index <= val.second->last) {
+                _short_entries.insert(std::make_pair(index & _mask, val.second));
+                if (index > max) {
+                    break; // avoid integer overflow
+                }
+                index += increment;
+            }
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Decode a line as "first[-last] = name" with exclusive lock held.
+//----------------------------------------------------------------------------
+
+bool ts::Names::decodeValueLocked(const UString& file_name, const UString& line)
+{
+    // Check the presence of the '='.
+    const size_t equal = line.find(u'=');
+    if (equal == 0 || equal == NPOS) {
+        return false;
+    }
+
+    // Extract fields.
+    UString range(line, 0, equal);
+    range.trim();
+
+    UString value(line, equal + 1, line.length() - equal - 1);
+    value.trim();
+
+    // Allowed "thousands separators" (ignored characters)
+    const UString ignore(u".,_");
+
+    // Decode "first[-last]"
+    uint_t first = 0;
+    uint_t last = 0;
+    const size_t dash = range.find(u'-');
+    bool valid = false;
+
+    if (dash == NPOS) {
+        valid = range.toInteger(first, ignore, 0, UString());
+        last = first;
+    }
+    else {
+        valid = range.substr(0, dash).toInteger(first, ignore, 0, UString()) && range.substr(dash + 1).toInteger(last, ignore, 0, UString()) && last >= first;
+    }
+
+    // Add the definition.
+    if (valid) {
+        if (freeRangeLocked(first, last)) {
+            // Valid range, add it.
+            addValueImplLocked(value, first, last);
+        }
+        else {
+            CERR.error(u"%s: section %s, range 0x%X-0x%X overlaps with an existing range", file_name, _section_name, first, last);
+            valid = false;
+        }
+    }
+    return valid;
+}
+
+
 //----------------------------------------------------------------------------
 // Add a translation from a given name to a new unique value.
 //----------------------------------------------------------------------------
 
 ts::Names::int_t ts::Names::addNewValue(const UString& name)
 {
+    materialize();
     // Write lock (exclusive).
     std::lock_guard<std::shared_mutex> lock(_mutex);
     if (_entries.empty()) {
@@ -289,6 +411,7 @@ bool ts::Names::getValueImpl(uint_t& e, const UString& name, bool case_sensitive
     for (int levels = MAX_INHERIT; sec != nullptr && levels > 0; --levels) {
 
         // Loop on all values in this section.
+        sec->materialize();
         {
             // Read lock (shared).
             std::shared_lock<std::shared_mutex> lock(sec->_mutex);
@@ -355,6 +478,7 @@ ts::UString ts::Names::error(const UString& name, bool case_sensitive, bool abbr
     const UString lc_name(name.toLower());
     UStringList maybe;
 
+    materialize();
     // Read lock (shared).
     std::shared_lock<std::shared_mutex> lock(_mutex);
 
@@ -394,6 +518,7 @@ bool ts::Names::containsImpl(uint_t value) const
     // Loop on inherited sections.
     for (int levels = MAX_INHERIT; sec != nullptr && levels > 0; --levels) {
         // Search in current section.
+        sec->materialize();
         {
             // Read lock (shared).
             std::shared_lock<std::shared_mutex> lock(sec->_mutex);
@@ -442,6 +567,7 @@ ts::UString ts::Names::getName(uint_t value) const
     // Loop on inherited sections.
     for (int levels = MAX_INHERIT; sec != nullptr && levels > 0; --levels) {
         // Search in current section.
+        sec->materialize();
         {
             // Read lock (shared).
             std::shared_lock<std::shared_mutex> lock(sec->_mutex);
@@ -470,6 +596,7 @@ ts::UString ts::Names::bitMaskNamesImpl(uint_t value, const UString& separator,
     UString list;
     uint_t done = 0; // Bitmask of all values which are already added in the list.
 
+    materialize();
     // Read lock (shared).
     std::shared_lock<std::shared_mutex> lock(_mutex);
 
@@ -539,6 +666,7 @@ ts::UString ts::Names::formattedWithFallback(uint_t value1, uint_t value2, Names
 
 ts::UString ts::Names::nameList(const UString& separator, const UString& in_quote, const UString& out_quote) const
 {
+    materialize();
     // Read lock (shared).
     std::shared_lock<std::shared_mutex> lock(_mutex);
 
@@ -672,6 +800,7 @@ size_t ts::Names::visit(Visitor* visitor) const
     for (int levels = MAX_INHERIT; sec != nullptr && levels > 0; --levels) {
 
         // Loop on all values in this section.
+        sec->materialize();
         {
             // Read lock (shared).
             std::shared_lock<std::shared_mutex> lock(sec->_mutex);
@@ -709,6 +838,7 @@ size_t ts::Names::visit(Visitor* visitor, uint_t value) const
     // Loop on inherited sections.
     for (int levels = MAX_INHERIT; sec != nullptr && levels > 0; --levels) {
 
+        sec->materialize();
         {
             // Read lock (shared).
             std::shared_lock<std::shared_mutex> lock(sec->_mutex);
@@ -966,44 +1096,13 @@ bool ts::Names::AllInstances::loadFileLocked(const UString& file_name)
         else {
             // Mask to extract the basic value, without the potential extension.
             sec._mask = LSBMask<uint_t>(sec._bits);
+        }
 
-            // Verify the presence of extended values in the section.
-            bool extended = false;
-            {
-                // Read lock (shared).
-                std::shared_lock<std::shared_mutex> lock(sec._mutex);
-                for (const auto& val : sec._entries) {
-                    // Only check the extension in 'last', it is greated than 'first'.
-                    if ((val.second->last & ~sec._mask) != 0) {
-                        extended = true;
-                        break;
-                    }
-                }
-                if (extended != sec._has_extended) {
-                    CERR.error(u"%d: section %s, extended is %s, found%s extended values", full_path, sname, sec._has_extended, extended ? u"" : u" no");
-                    error_count++;
-                }
-            }
-
-            // In the presence of extended values, build the 'short_entries' multimap, indexed by short values.
-            if (extended) {
-                assert(sec._bits < 8 * sizeof(uint_t));
-                // Write lock (exclusive).
-                std::lock_guard<std::shared_mutex> lock(sec._mutex);
-                // If there are more than one value in the range, it is possible that they span multiple short values.
-                const uint_t increment = uint_t(1) << sec._bits;
-                const uint_t max = std::numeric_limits<uint_t>::max() - increment;
-                for (const auto& val : sec._entries) {
-                    uint_t index = val.second->first;
-                    while (index <= val.second->last) {
-                        sec._short_entries.insert(std::make_pair(index & sec._mask, val.second));
-                        if (index > max) {
-                            break; // avoid integer overflow
-                        }
-                        index += increment;
-                    }
-                }
-            }
+        // The value definitions of the section are decoded on first use. However, when visitors are
+        // already subscribed to the section (eg. the PSIRepository on table and descriptor ids),
+        // they need to be notified of the merged values now, so materialize the section immediately.
+        if (!sec._visitors.empty()) {
+            sec.materialize();
         }
     }
 
@@ -1066,30 +1165,9 @@ bool ts::Names::AllInstances::decodeDefinition(const UString& file_name, const U
         return value.toBool(section->_has_extended);
     }
 
-    // Decode "first[-last]"
-    uint_t first = 0;
-    uint_t last = 0;
-    const size_t dash = range.find(u'-');
-    bool valid = false;
-
-    if (dash == NPOS) {
-        valid = range.toInteger(first, ignore, 0, UString());
-        last = first;
-    }
-    else {
-        valid = range.substr(0, dash).toInteger(first, ignore, 0, UString()) && range.substr(dash + 1).toInteger(last, ignore, 0, UString()) && last >= first;
-    }
-
-    // Add the definition.
-    if (valid) {
-        if (section->freeRangeLocked(first, last)) {
-            // Valid range, add it.
-            section->addValueImplLocked(value, first, last);
-        }
-        else {
-            CERR.error(u"%s: section %s, range 0x%X-0x%X overlaps with an existing range", file_name, section->_section_name, first, last);
-            valid = false;
-        }
-    }
-    return valid;
+    // This is a value definition. Defer its decoding until the section is first used
+    // (lazy materialization). Syntax errors will be reported at that time.
+    section->_pending_lines.emplace_back(file_name, line);
+    section->_lazy = true;
+    return true;
 }
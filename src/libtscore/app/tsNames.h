@@ -227,13 +227,21 @@ namespace ts {
         //! Check if the list of names is empty.
         //! @return True if the list of names is empty.
         //!
-        bool empty() const { return _entries.empty(); }
+        bool empty() const
+        {
+            materialize();
+            return _entries.empty();
+        }
 
         //!
         //! Check if the list of values contains negative values from a signed integral type.
         //! @return True if the list of values contains negative values from a signed integral type.
         //!
-        bool isSigned() const { return _is_signed; }
+        bool isSigned() const
+        {
+            materialize();
+            return _is_signed;
+        }
 
         //!
         //! Get the number of significant bits in values, when specified using "Bits = nn" in a ".names" file.
@@ -608,6 +616,26 @@ namespace ts {
         // Unused when extended = false.
         std::multimap<uint_t, ValueRangePtr> _short_entries {};
 
+        // Lazy materialization of sections which are loaded from a ".names" file.
+        // The value definitions are stored as raw text lines when the file is loaded
+        // and decoded on first use of the section. Each pending line is associated
+        // with its source file name (for error messages).
+        std::list<std::pair<UString, UString>> _pending_lines {};
+        std::atomic<bool> _lazy = false;
+
+        // Decode all pending value definitions of the section, if any.
+        // The fast path is inline and lock-free, for already materialized sections.
+        void materialize() const
+        {
+            if (_lazy) {
+                const_cast<Names*>(this)->materializeNow();
+            }
+        }
+        void materializeNow();
+
+        // Decode a line as "first[-last] = name" with exclusive lock held. Return true on success.
+        bool decodeValueLocked(const UString& file_name, const UString& line);
+
         // Get the range for a given value, nullptr if not found.
         ValueRangePtr getRangeLocked(uint_t val) const;
 
@@ -746,6 +774,7 @@ template <class CONTAINER>
 void ts::Names::getAllNames(CONTAINER& names) const
 {
     names.clear();
+    materialize();
     // Read lock (shared).
     std::shared_lock<std::shared_mutex> lock(_mutex);
     for (const auto& it : _entries) {
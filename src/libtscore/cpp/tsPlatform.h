@@ -726,8 +726,10 @@ TS_MSC_NOWARNING(5045)  // Compiler will insert Spectre mitigation for memory lo
 #include <deque>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <bitset>
+#include <span>
 #include <optional>
 #include <variant>
 #include <memory>
@@ -22,9 +22,15 @@
     #define TS_ARM_CRC32_INSTRUCTIONS 1
 #endif
 
+// Check if x86 carryless multiplication instructions can be used (PCLMULQDQ, with SSSE3 and SSE4.1).
+#if defined(__PCLMUL__) && defined(__SSSE3__) && defined(__SSE4_1__) && !defined(TS_NO_X86_PCLMUL_INSTRUCTIONS)
+    #define TS_X86_PCLMUL_INSTRUCTIONS 1
+    #include <immintrin.h>
+#endif
+
 // "Hidden" exported bool to inform the SysInfo class that we have compiled accelerated instructions.
 extern const bool tsCRC32IsAccelerated =
-#if defined(TS_ARM_CRC32_INSTRUCTIONS)
+#if defined(TS_ARM_CRC32_INSTRUCTIONS) || defined(TS_X86_PCLMUL_INSTRUCTIONS)
     true;
 #else
     false;
@@ -45,6 +51,9 @@ uint32_t ts::CRC32::valueAccel() const
     uint32_t x;
     asm("rbit %w0, %w1" : "=r" (x) : "r" (_fcs));
     return x;
+#elif defined(TS_X86_PCLMUL_INSTRUCTIONS)
+    // The x86 implementation keeps the CRC register in its natural bit order.
+    return _fcs;
 #else
     // Shall not be called.
     assert(false);
@@ -88,6 +97,57 @@ namespace {
 #endif
 
 
+//----------------------------------------------------------------------------
+// Basic operations for the x86 carryless multiplication instructions.
+//----------------------------------------------------------------------------
+
+#if defined(TS_X86_PCLMUL_INSTRUCTIONS)
+namespace {
+
+    // The x86 implementation uses the classic CRC folding technique with the
+    // PCLMULQDQ carryless multiplication instruction (see Gopal, Ozturk, et al.,
+    // "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction",
+    // Intel white paper). The MPEG-2 CRC32 is not bit-reflected, so the data
+    // bytes are simply reversed in each 16-byte block to get the polynomial in
+    // natural bit order. All constants below are x^n mod P, with the generator
+    // polynomial P = 0x104C11DB7, except CRC32_MU which is floor(x^64 / P).
+
+    constexpr uint64_t CRC32_X576 = 0x8833794C;   // x^576 mod P
+    constexpr uint64_t CRC32_X512 = 0xE6228B11;   // x^512 mod P
+    constexpr uint64_t CRC32_X192 = 0xC5B9CD4C;   // x^192 mod P
+    constexpr uint64_t CRC32_X128 = 0xE8A45605;   // x^128 mod P
+    constexpr uint64_t CRC32_X96  = 0xF200AA66;   // x^96 mod P
+    constexpr uint64_t CRC32_X64  = 0x490D678D;   // x^64 mod P
+    constexpr uint64_t CRC32_MU   = 0x104D101DF;  // floor(x^64 / P)
+    constexpr uint64_t CRC32_POLY = 0x104C11DB7;  // P, including the x^32 term
+
+    // Load a 16-byte block and reverse the bytes to get the polynomial in natural bit order.
+    inline __attribute__((always_inline)) __m128i crcLoad16(const uint8_t* p)
+    {
+        const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), bswap);
+    }
+
+    // Fold the 128-bit accumulator v over some distance and add a new data block.
+    // The constant k holds x^(distance+64) mod P and x^distance mod P in its
+    // high and low 64-bit halves respectively.
+    inline __attribute__((always_inline)) __m128i crcFold16(__m128i v, __m128i k, __m128i data)
+    {
+        return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(v, k, 0x11), _mm_clmulepi64_si128(v, k, 0x00)), data);
+    }
+
+    // Add one byte in the CRC32 computation, for the head and tail of misaligned areas.
+    inline __attribute__((always_inline)) void crcAddByte(uint32_t& fcs, uint8_t x)
+    {
+        fcs ^= uint32_t(x) << 24;
+        for (int bit = 0; bit < 8; ++bit) {
+            fcs = (fcs & 0x80000000) != 0 ? (fcs << 1) ^ uint32_t(CRC32_POLY) : (fcs << 1);
+        }
+    }
+}
+#endif
+
+
 //----------------------------------------------------------------------------
 // Continue the computation of a data area, following a previous CRC32.
 //----------------------------------------------------------------------------
@@ -133,6 +193,65 @@ void ts::CRC32::addAccel(const void* data, size_t size)
     while (size--) {
         crcAdd8(_fcs, *cp8++);
     }
+#elif defined(TS_X86_PCLMUL_INSTRUCTIONS)
+    const uint8_t* cp = reinterpret_cast<const uint8_t*>(data);
+
+    if (size >= 16) {
+        const __m128i k512 = _mm_set_epi64x(int64_t(CRC32_X576), int64_t(CRC32_X512));  // fold by 64 bytes
+        const __m128i k128 = _mm_set_epi64x(int64_t(CRC32_X192), int64_t(CRC32_X128));  // fold by 16 bytes
+
+        // Load the first 16-byte block and add the current CRC value in its 32 most significant bits.
+        __m128i v0 = _mm_xor_si128(crcLoad16(cp), _mm_set_epi32(int32_t(_fcs), 0, 0, 0));
+        cp += 16;
+        size -= 16;
+
+        if (size >= 48) {
+            // 4-way folding, 64 bytes per iteration, to fill the pipeline of the PCLMULQDQ unit.
+            __m128i v1 = crcLoad16(cp);
+            __m128i v2 = crcLoad16(cp + 16);
+            __m128i v3 = crcLoad16(cp + 32);
+            cp += 48;
+            size -= 48;
+            while (size >= 64) {
+                v0 = crcFold16(v0, k512, crcLoad16(cp));
+                v1 = crcFold16(v1, k512, crcLoad16(cp + 16));
+                v2 = crcFold16(v2, k512, crcLoad16(cp + 32));
+                v3 = crcFold16(v3, k512, crcLoad16(cp + 48));
+                cp += 64;
+                size -= 64;
+            }
+            // Fold the four lanes back into one.
+            v0 = crcFold16(v0, k128, v1);
+            v0 = crcFold16(v0, k128, v2);
+            v0 = crcFold16(v0, k128, v3);
+        }
+
+        // Fold the remaining complete 16-byte blocks.
+        while (size >= 16) {
+            v0 = crcFold16(v0, k128, crcLoad16(cp));
+            cp += 16;
+            size -= 16;
+        }
+
+        // Reduce the 128-bit accumulator to a 32-bit CRC.
+        const __m128i k96 = _mm_set_epi64x(0, int64_t(CRC32_X96));
+        const __m128i k64 = _mm_set_epi64x(0, int64_t(CRC32_X64));
+        const __m128i mu_poly = _mm_set_epi64x(int64_t(CRC32_POLY), int64_t(CRC32_MU));
+        const __m128i low64 = _mm_set_epi64x(0, -1);
+
+        // t = high(v0) * x^96 + low(v0) * x^32, degree < 96 (the x^32 factor comes from the CRC definition).
+        const __m128i t = _mm_xor_si128(_mm_clmulepi64_si128(v0, k96, 0x01), _mm_slli_si128(_mm_and_si128(v0, low64), 4));
+        // u = bits 95..64 of t * x^64 + low 64 bits of t, degree < 64.
+        const __m128i u = _mm_xor_si128(_mm_clmulepi64_si128(_mm_srli_si128(t, 8), k64, 0x00), _mm_and_si128(t, low64));
+        // Barrett reduction of the 64-bit value u: q = floor(floor(u / x^32) * mu / x^32), crc = u - q * P.
+        const __m128i q = _mm_srli_epi64(_mm_clmulepi64_si128(_mm_srli_epi64(u, 32), mu_poly, 0x00), 32);
+        _fcs = uint32_t(_mm_cvtsi128_si32(_mm_xor_si128(u, _mm_clmulepi64_si128(q, mu_poly, 0x10))));
+    }
+
+    // Add remaining bytes.
+    while (size--) {
+        crcAddByte(_fcs, *cp++);
+    }
 #else
     // Shall not be called.
     assert(false);
@@ -16,3 +16,4 @@
 // Some global constant private booleans which are defined when the accelerated
 // modules are compiled with accelerated instructions.
 extern const bool tsCRC32IsAccelerated;
+extern const bool tsSHA256IsAccelerated;
@@ -0,0 +1,385 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+// Implementation of the SHA-256 compression function using accelerated
+// instructions, when available. This module is compiled with special options
+// to use optional instructions for the target architecture. It may fail when
+// these instructions are not implemented in the current CPU. Consequently,
+// this module shall not be called when these instructions are not implemented.
+//
+//----------------------------------------------------------------------------
+
+#include "tsSHA256.h"
+#include "tsCryptoAcceleration.h"
+
+// Check if Arm-64 SHA-256 instructions can be used.
+#if defined(__ARM_FEATURE_SHA2) && !defined(TS_NO_ARM_SHA256_INSTRUCTIONS)
+    #define TS_ARM_SHA256_INSTRUCTIONS 1
+    #include <arm_neon.h>
+#endif
+
+// Check if x86 SHA-NI instructions can be used (SHA, with SSSE3 and SSE4.1).
+#if defined(__SHA__) && defined(__SSSE3__) && defined(__SSE4_1__) && !defined(TS_NO_X86_SHA_INSTRUCTIONS)
+    #define TS_X86_SHA_INSTRUCTIONS 1
+    #include <immintrin.h>
+#endif
+
+// "Hidden" exported bool to inform the SysInfo class that we have compiled accelerated instructions.
+extern const bool tsSHA256IsAccelerated =
+#if defined(TS_ARM_SHA256_INSTRUCTIONS) || defined(TS_X86_SHA_INSTRUCTIONS)
+    true;
+#else
+    false;
+#endif
+
+// Don't complain about assert(false) when acceleration is not implemented.
+TS_LLVM_NOWARNING(missing-noreturn)
+
+
+//----------------------------------------------------------------------------
+// Compress a sequence of 64-byte blocks, using accelerated instructions.
+//----------------------------------------------------------------------------
+
+void ts::SHA256::compressAccel(const uint8_t* buf, size_t blocks)
+{
+#if defined(TS_ARM_SHA256_INSTRUCTIONS)
+
+    // Round constants, as defined in FIPS 180-4.
+    static const uint32_t K[64] = {
+        0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+        0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+        0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+        0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+        0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+        0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+        0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+        0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+    };
+
+    uint32x4_t state0 = vld1q_u32(_state);
+    uint32x4_t state1 = vld1q_u32(_state + 4);
+
+    while (blocks-- > 0) {
+
+        // Save current state.
+        const uint32x4_t abcd_save = state0;
+        const uint32x4_t efgh_save = state1;
+
+        // Load the message block and reverse the bytes of each 32-bit word.
+        uint32x4_t msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf)));
+        uint32x4_t msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 16)));
+        uint32x4_t msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 32)));
+        uint32x4_t msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 48)));
+        buf += BLOCK_SIZE;
+
+        uint32x4_t tmp0 = vaddq_u32(msg0, vld1q_u32(K));
+        uint32x4_t tmp1, tmp2;
+
+        // Rounds 0-3
+        msg0 = vsha256su0q_u32(msg0, msg1);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg1, vld1q_u32(K + 4));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg0 = vsha256su1q_u32(msg0, msg2, msg3);
+
+        // Rounds 4-7
+        msg1 = vsha256su0q_u32(msg1, msg2);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg2, vld1q_u32(K + 8));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg1 = vsha256su1q_u32(msg1, msg3, msg0);
+
+        // Rounds 8-11
+        msg2 = vsha256su0q_u32(msg2, msg3);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg3, vld1q_u32(K + 12));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg2 = vsha256su1q_u32(msg2, msg0, msg1);
+
+        // Rounds 12-15
+        msg3 = vsha256su0q_u32(msg3, msg0);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg0, vld1q_u32(K + 16));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg3 = vsha256su1q_u32(msg3, msg1, msg2);
+
+        // Rounds 16-19
+        msg0 = vsha256su0q_u32(msg0, msg1);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg1, vld1q_u32(K + 20));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg0 = vsha256su1q_u32(msg0, msg2, msg3);
+
+        // Rounds 20-23
+        msg1 = vsha256su0q_u32(msg1, msg2);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg2, vld1q_u32(K + 24));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg1 = vsha256su1q_u32(msg1, msg3, msg0);
+
+        // Rounds 24-27
+        msg2 = vsha256su0q_u32(msg2, msg3);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg3, vld1q_u32(K + 28));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg2 = vsha256su1q_u32(msg2, msg0, msg1);
+
+        // Rounds 28-31
+        msg3 = vsha256su0q_u32(msg3, msg0);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg0, vld1q_u32(K + 32));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg3 = vsha256su1q_u32(msg3, msg1, msg2);
+
+        // Rounds 32-35
+        msg0 = vsha256su0q_u32(msg0, msg1);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg1, vld1q_u32(K + 36));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg0 = vsha256su1q_u32(msg0, msg2, msg3);
+
+        // Rounds 36-39
+        msg1 = vsha256su0q_u32(msg1, msg2);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg2, vld1q_u32(K + 40));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg1 = vsha256su1q_u32(msg1, msg3, msg0);
+
+        // Rounds 40-43
+        msg2 = vsha256su0q_u32(msg2, msg3);
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg3, vld1q_u32(K + 44));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+        msg2 = vsha256su1q_u32(msg2, msg0, msg1);
+
+        // Rounds 44-47
+        msg3 = vsha256su0q_u32(msg3, msg0);
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg0, vld1q_u32(K + 48));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+        msg3 = vsha256su1q_u32(msg3, msg1, msg2);
+
+        // Rounds 48-51
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg1, vld1q_u32(K + 52));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+
+        // Rounds 52-55
+        tmp2 = state0;
+        tmp0 = vaddq_u32(msg2, vld1q_u32(K + 56));
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+
+        // Rounds 56-59
+        tmp2 = state0;
+        tmp1 = vaddq_u32(msg3, vld1q_u32(K + 60));
+        state0 = vsha256hq_u32(state0, state1, tmp0);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp0);
+
+        // Rounds 60-63
+        tmp2 = state0;
+        state0 = vsha256hq_u32(state0, state1, tmp1);
+        state1 = vsha256h2q_u32(state1, tmp2, tmp1);
+
+        // Combine with previous state.
+        state0 = vaddq_u32(state0, abcd_save);
+        state1 = vaddq_u32(state1, efgh_save);
+    }
+
+    vst1q_u32(_state, state0);
+    vst1q_u32(_state + 4, state1);
+
+#elif defined(TS_X86_SHA_INSTRUCTIONS)
+
+    // Shuffle mask to reverse the bytes of each 32-bit word of a message block.
+    const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+    // Load the current state and rearrange it in the (ABEF, CDGH) order used by the SHA instructions.
+    __m128i tmp    = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_state)), 0xB1);     // CDAB
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_state + 4)), 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);                                                        // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                                                             // CDGH
+
+    while (blocks-- > 0) {
+
+        // Save current state.
+        const __m128i abef_save = state0;
+        const __m128i cdgh_save = state1;
+        __m128i msg, msg0, msg1, msg2, msg3;
+
+        // Rounds 0-3
+        msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf)), mask);
+        msg = _mm_add_epi32(msg0, _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+        // Rounds 4-7
+        msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 16)), mask);
+        msg = _mm_add_epi32(msg1, _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+        // Rounds 8-11
+        msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 32)), mask);
+        msg = _mm_add_epi32(msg2, _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+        // Rounds 12-15
+        msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 48)), mask);
+        msg = _mm_add_epi32(msg3, _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg0 = _mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4));
+        msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+        // Rounds 16-19
+        msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+        msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+        // Rounds 20-23
+        msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg2 = _mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4));
+        msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+        // Rounds 24-27
+        msg = _mm_add_epi32(msg2, _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg3 = _mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4));
+        msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+        // Rounds 28-31
+        msg = _mm_add_epi32(msg3, _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg0 = _mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4));
+        msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+        // Rounds 32-35
+        msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+        msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+        // Rounds 36-39
+        msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg2 = _mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4));
+        msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+        // Rounds 40-43
+        msg = _mm_add_epi32(msg2, _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg3 = _mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4));
+        msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+        // Rounds 44-47
+        msg = _mm_add_epi32(msg3, _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg0 = _mm_add_epi32(msg0, _mm_alignr_epi8(msg3, msg2, 4));
+        msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+        // Rounds 48-51
+        msg = _mm_add_epi32(msg0, _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+        msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+        // Rounds 52-55
+        msg = _mm_add_epi32(msg1, _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg2 = _mm_add_epi32(msg2, _mm_alignr_epi8(msg1, msg0, 4));
+        msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+        // Rounds 56-59
+        msg = _mm_add_epi32(msg2, _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg3 = _mm_add_epi32(msg3, _mm_alignr_epi8(msg2, msg1, 4));
+        msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+        // Rounds 60-63
+        msg = _mm_add_epi32(msg3, _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        msg = _mm_shuffle_epi32(msg, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+        // Combine with previous state.
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+        buf += BLOCK_SIZE;
+    }
+
+    // Rearrange the state back in the natural (ABCD, EFGH) order.
+    tmp = _mm_shuffle_epi32(state0, 0x1B);        // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);     // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);  // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);     // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_state), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(_state + 4), state1);
+
+#else
+
+    // Shall not be called.
+    assert(false);
+
+#endif
+}
@@ -135,7 +135,16 @@ bool ts::BlockCipher::setKey(const void* key, size_t key_length, const void* iv,
     }
 
     _key_encrypt_count = _key_decrypt_count = 0;
-    _current_key.copy(key, key_length);
+
+    // If the same key is set again, the previous key schedule remains valid and
+    // is reused. This is typically the case with alternating scrambling parities:
+    // each parity uses a long-lived control word in its own cipher instance and
+    // setting the control word again on a parity change only needs to refresh
+    // the IV, not to re-run the key expansion.
+    const bool same_key = _key_set && _current_key.size() == key_length && MemEqual(_current_key.data(), key, key_length);
+    if (!same_key) {
+        _current_key.copy(key, key_length);
+    }
 
     if (valid_iv || !_current_iv.empty()) {
         // Schedule the key now, the IV is either valid or unused or previously set.
@@ -145,11 +154,15 @@ bool ts::BlockCipher::setKey(const void* key, size_t key_length, const void* iv,
             _work_iv.resize(iv_length);
 #endif
         }
-        _key_set = setKeyImpl();
+        if (!same_key) {
+            _key_set = setKeyImpl();
+        }
         return _key_set;
     }
     else {
-        // Schedule the key later, when an IV is set
+        // Schedule the key later, when an IV is set.
+        // Invalidate any previous schedule so that the new key cannot be mistaken for it.
+        _key_set = false;
         return true;
     }
 }
@@ -320,6 +320,14 @@ namespace ts {
         //!
         void canProcessInPlace(bool can_do) { _can_process_in_place = can_do; }
 
+        //!
+        //! Invalidate the current key schedule.
+        //! The key will be rescheduled on the next setKey(), even when the same key value is set again.
+        //! Must be called by a subclass when it modifies an out-of-band parameter which
+        //! affects the key schedule (the entropy reduction mode of DVB-CSA2 for instance).
+        //!
+        void invalidateKeySchedule() { _key_set = false; }
+
 #if defined(TS_WINDOWS) || defined(DOXYGEN)
         //!
         //! Get the algorithm handle and subobject size, when the subclass uses Microsoft BCrypt library.
@@ -64,11 +64,16 @@ namespace ts {
         //! @endcond
 
     private:
-        size_t _counter_bits = 0; // size in bits of the counter part.
+        // Number of counter blocks which are encrypted in one single call to the
+        // underlying block cipher. System cryptographic libraries pipeline several
+        // blocks in hardware (AES-NI for instance) when they are submitted at once.
+        static constexpr size_t BATCH_BLOCKS = 64;
 
-        // We need two work blocks.
-        // The first one contains the "input block" or counter.
-        // The second one contains the "output block", the encrypted counter.
+        size_t _counter_bits = 0;  // Size in bits of the counter part.
+        ByteBlock _counters {};    // Batch of consecutive counter values.
+        ByteBlock _keystream {};   // Encrypted counter batch, the key stream.
+
+        // We need one work block, containing the running counter or "input block".
         // This private method increments the counter block.
         void incrementCounter();
     };
@@ -85,7 +90,7 @@ template<class CIPHER> requires std::derived_from<CIPHER, ts::BlockCipher>
 const ts::BlockCipherProperties& ts::CTR<CIPHER>::Properties()
 {
     // Thread-safe init-safe static data pattern:
-    static const BlockCipherProperties props(CIPHER::Properties(), u"CTR", true, 0, 2, CIPHER::BLOCK_SIZE);
+    static const BlockCipherProperties props(CIPHER::Properties(), u"CTR", true, 0, 1, CIPHER::BLOCK_SIZE);
     return props;
 }
 
@@ -147,7 +152,6 @@ bool ts::CTR<CIPHER>::encryptImpl(const void* plain, size_t plain_length, void*
 {
     const size_t bsize = this->properties.block_size;
     uint8_t* work1 = this->work.data();
-    uint8_t* work2 = this->work.data() + bsize;
 
     if (this->currentIV().size() != bsize || cipher_maxsize < plain_length) {
         return false;
@@ -156,25 +160,35 @@ bool ts::CTR<CIPHER>::encryptImpl(const void* plain, size_t plain_length, void*
         *cipher_length = plain_length;
     }
 
+    // Make sure the batch buffers are allocated.
+    _counters.resize(BATCH_BLOCKS * bsize);
+    _keystream.resize(BATCH_BLOCKS * bsize);
+
     // work1 = iv
     MemCopy(work1, this->currentIV().data(), bsize);
 
-    // Loop on all blocks, including last truncated one.
+    // Loop on batches of blocks, including last truncated one. The counter
+    // blocks of a batch are encrypted in one single call to the underlying
+    // block cipher, which pipelines them when the hardware supports it.
     const uint8_t* pt = reinterpret_cast<const uint8_t*>(plain);
     uint8_t* ct = reinterpret_cast<uint8_t*>(cipher);
 
     while (plain_length > 0) {
-        // work2 = encrypt(work1)
-        if (!CIPHER::encryptImpl(work1, bsize, work2, bsize, nullptr)) {
+        // Generate the consecutive counter values of this batch.
+        const size_t nblocks = std::min((plain_length + bsize - 1) / bsize, BATCH_BLOCKS);
+        for (size_t b = 0; b < nblocks; ++b) {
+            MemCopy(&_counters[b * bsize], work1, bsize);
+            incrementCounter();
+        }
+        // keystream = encrypt(counters)
+        if (!CIPHER::encryptImpl(_counters.data(), nblocks * bsize, _keystream.data(), nblocks * bsize, nullptr)) {
             return false;
         }
-        // This block size:
-        const size_t size = std::min(plain_length, bsize);
-        // cipher-text = plain-text XOR work2
-        MemXor(ct, work2, pt, size);
-        // work1 += 1
-        incrementCounter();
-        // advance one block
+        // This batch size:
+        const size_t size = std::min(plain_length, nblocks * bsize);
+        // cipher-text = plain-text XOR keystream
+        MemXor(ct, _keystream.data(), pt, size);
+        // advance one batch
         ct += size;
         pt += size;
         plain_length -= size;
@@ -9,6 +9,26 @@
 #include "tsKeyTable.h"
 #include "tsxmlModelDocument.h"
 #include "tsxmlElement.h"
+#include "tsMemory.h"
+
+// Magic value at the beginning of a binary key file.
+namespace {
+    const uint8_t FILE_MAGIC[4] = {'T', 'S', 'K', 'T'};
+}
+
+
+//----------------------------------------------------------------------------
+// Hash function on key ids (FNV-1a on the id bytes).
+//----------------------------------------------------------------------------
+
+size_t ts::KeyTable::IdHash::operator()(const ByteBlock& id) const
+{
+    uint64_t hash = 0xCBF29CE484222325;
+    for (uint8_t byte : id) {
+        hash = (hash ^ byte) * 0x00000100000001B3;
+    }
+    return size_t(hash);
+}
 
 
 //----------------------------------------------------------------------------
@@ -110,6 +130,77 @@ bool ts::KeyTable::loadFile(Report& report, const UString& filename, bool replac
 }
 
 
+//----------------------------------------------------------------------------
+// Load all keys from a binary file and add them in the key table.
+//----------------------------------------------------------------------------
+
+bool ts::KeyTable::loadBinaryFile(Report& report, const UString& filename, bool replace, size_t id_size, size_t value_size)
+{
+    // Load the complete file in one single read operation.
+    ByteBlock data;
+    report.debug(u"loading %s", filename);
+    if (!data.loadFromFile(filename, std::numeric_limits<size_t>::max(), &report)) {
+        return false;
+    }
+    if (data.size() < sizeof(FILE_MAGIC) || !MemEqual(data.data(), FILE_MAGIC, sizeof(FILE_MAGIC))) {
+        report.error(u"%s is not a valid binary key file", filename);
+        return false;
+    }
+
+    // Analyze all key records.
+    size_t index = sizeof(FILE_MAGIC);
+    size_t count = 0;
+    while (index < data.size()) {
+        if (data.size() - index < 4) {
+            report.error(u"truncated binary key file %s", filename);
+            return false;
+        }
+        const size_t isize = GetUInt16(data.data() + index);
+        const size_t vsize = GetUInt16(data.data() + index + 2);
+        index += 4;
+        if (data.size() - index < isize + vsize) {
+            report.error(u"truncated binary key file %s", filename);
+            return false;
+        }
+        if ((id_size != 0 && isize != id_size) || (value_size != 0 && vsize != value_size)) {
+            report.error(u"invalid key id or value size in %s", filename);
+            return false;
+        }
+        ByteBlock id(data.data() + index, isize);
+        index += isize;
+        if (replace || !hasKey(id)) {
+            _keys[std::move(id)] = ByteBlock(data.data() + index, vsize);
+        }
+        index += vsize;
+        ++count;
+    }
+    report.debug(u"loaded %d key records", count);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Save all keys from the key table in a binary file.
+//----------------------------------------------------------------------------
+
+bool ts::KeyTable::saveBinaryFile(Report& report, const UString& filename) const
+{
+    ByteBlock data;
+    data.append(FILE_MAGIC, sizeof(FILE_MAGIC));
+    for (const auto& it : _keys) {
+        if (it.first.size() > 0xFFFF || it.second.size() > 0xFFFF) {
+            report.error(u"key id or value too large for a binary key file");
+            return false;
+        }
+        data.appendUInt16(uint16_t(it.first.size()));
+        data.appendUInt16(uint16_t(it.second.size()));
+        data.append(it.first);
+        data.append(it.second);
+    }
+    return data.saveToFile(filename, &report);
+}
+
+
 //----------------------------------------------------------------------------
 // Common code for loadFile() and loadXML().
 //----------------------------------------------------------------------------
@@ -35,6 +35,13 @@ namespace ts {
     //! </tsduck>
     //! @endcode
     //!
+    //! Alternatively, a key table can be saved in and loaded from a binary file.
+    //! Loading a binary file is much faster than parsing an XML file and is
+    //! recommended for tables with a very large number of keys. A binary key
+    //! file starts with the 4-byte magic value 'TSKT', followed by one record
+    //! per key: a 2-byte id size, a 2-byte value size (both in big endian),
+    //! the id bytes and the value bytes.
+    //!
     class TSCOREDLL KeyTable
     {
     public:
@@ -146,8 +153,38 @@ namespace ts {
         //!
         bool loadXML(Report& report, const UString& text, bool replace, size_t id_size, size_t value_size);
 
+        //!
+        //! Load all keys from a binary file and add them in the key table.
+        //! The complete file is loaded in one single read operation, this is
+        //! much faster than an XML file for tables with many keys.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] filename The name of the file to load.
+        //! @param [in] replace If true, allow the replacement of existing keys.
+        //! @param [in] id_size If not zero, all key ids must have this size in bytes.
+        //! @param [in] value_size If not zero, all key values must have this size in bytes.
+        //! @return True on success, false otherwise.
+        //!
+        bool loadBinaryFile(Report& report, const UString& filename, bool replace, size_t id_size, size_t value_size);
+
+        //!
+        //! Save all keys from the key table in a binary file.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] filename The name of the file to create.
+        //! @return True on success, false otherwise.
+        //!
+        bool saveBinaryFile(Report& report, const UString& filename) const;
+
     private:
-        std::map<ByteBlock,ByteBlock> _keys {};  // key table, indexed by id
+        // Hash function on key ids (FNV-1a on the id bytes).
+        class IdHash
+        {
+        public:
+            size_t operator()(const ByteBlock& id) const;
+        };
+
+        // Key table, indexed by id. A hash map keeps the lookup time constant
+        // with tables containing a very large number of keys.
+        std::unordered_map<ByteBlock, ByteBlock, IdHash> _keys {};
 
         // Common code for loadFile() and loadXML().
         bool parseXML(xml::Document& doc, bool replace, size_t id_size, size_t value_size);
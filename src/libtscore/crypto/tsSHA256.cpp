@@ -8,11 +8,142 @@
 
 #include "tsSHA256.h"
 #include "tsFetchAlgorithm.h"
+#include "tsSysInfo.h"
+#include "tsMemory.h"
+
+// Runtime check once if accelerated SHA-256 instructions are supported on this CPU.
+volatile bool ts::SHA256::_accel_checked = false;
+volatile bool ts::SHA256::_accel_supported = false;
+
+
+//----------------------------------------------------------------------------
+// Constructors and destructors.
+//----------------------------------------------------------------------------
+
+ts::SHA256::SHA256() : Hash(u"SHA-256", HASH_SIZE)
+{
+    // Check once if SHA-256 acceleration is supported at runtime.
+    // This logic does not require explicit synchronization.
+    if (!_accel_checked) {
+        _accel_supported = SysInfo::Instance().sha256Instructions();
+        _accel_checked = true;
+    }
+}
 
 ts::SHA256::~SHA256()
 {
 }
 
+
+//----------------------------------------------------------------------------
+// Implementation of Hash interface, using accelerated instructions when
+// supported, the system-specific cryptographic library otherwise.
+//----------------------------------------------------------------------------
+
+bool ts::SHA256::init()
+{
+    if (!_accel_supported) {
+        return Hash::init();
+    }
+
+    // Initial hash value, as defined in FIPS 180-4.
+    _state[0] = 0x6A09E667;
+    _state[1] = 0xBB67AE85;
+    _state[2] = 0x3C6EF372;
+    _state[3] = 0xA54FF53A;
+    _state[4] = 0x510E527F;
+    _state[5] = 0x9B05688C;
+    _state[6] = 0x1F83D9AB;
+    _state[7] = 0x5BE0CD19;
+    _length = 0;
+    _curlen = 0;
+    return true;
+}
+
+bool ts::SHA256::add(const void* data, size_t size)
+{
+    if (!_accel_supported) {
+        return Hash::add(data, size);
+    }
+    if (data == nullptr || size == 0) {
+        return true;
+    }
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(data);
+
+    // Complete the pending partial block first, if any.
+    if (_curlen > 0) {
+        const size_t fill = std::min(size, BLOCK_SIZE - _curlen);
+        MemCopy(_buf + _curlen, in, fill);
+        _curlen += fill;
+        in += fill;
+        size -= fill;
+        if (_curlen == BLOCK_SIZE) {
+            compressAccel(_buf, 1);
+            _length += 8 * BLOCK_SIZE;
+            _curlen = 0;
+        }
+    }
+
+    // Compress all complete blocks directly from the user's buffer.
+    const size_t blocks = size / BLOCK_SIZE;
+    if (blocks > 0) {
+        compressAccel(in, blocks);
+        _length += 8 * blocks * BLOCK_SIZE;
+        in += blocks * BLOCK_SIZE;
+        size -= blocks * BLOCK_SIZE;
+    }
+
+    // Save the remaining partial block.
+    if (size > 0) {
+        MemCopy(_buf, in, size);
+        _curlen = size;
+    }
+    return true;
+}
+
+bool ts::SHA256::getHash(void* hash, size_t bufsize, size_t* retsize)
+{
+    if (!_accel_supported) {
+        return Hash::getHash(hash, bufsize, retsize);
+    }
+    if (retsize != nullptr) {
+        *retsize = HASH_SIZE;
+    }
+    if (hash == nullptr || bufsize < HASH_SIZE) {
+        return false;
+    }
+
+    // Total message size in bits, including the pending partial block.
+    _length += 8 * _curlen;
+
+    // Append the '1' bit after the message.
+    _buf[_curlen++] = 0x80;
+
+    // If there is no room left for the 64-bit message length, compress an extra block.
+    if (_curlen > BLOCK_SIZE - 8) {
+        MemZero(_buf + _curlen, BLOCK_SIZE - _curlen);
+        compressAccel(_buf, 1);
+        _curlen = 0;
+    }
+
+    // Pad with zeroes and store the message length in bits in the last 8 bytes.
+    MemZero(_buf + _curlen, BLOCK_SIZE - 8 - _curlen);
+    PutUInt64(_buf + BLOCK_SIZE - 8, _length);
+    compressAccel(_buf, 1);
+
+    // Copy the hash value, in big endian order.
+    uint8_t* out = reinterpret_cast<uint8_t*>(hash);
+    for (size_t i = 0; i < HASH_SIZE / 4; ++i) {
+        PutUInt32(out + 4 * i, _state[i]);
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Get parameters for system-specific crypto library.
+//----------------------------------------------------------------------------
+
 #if defined(TS_WINDOWS)
 
 void ts::SHA256::getAlgorithm(::BCRYPT_ALG_HANDLE& algo, size_t& length) const
@@ -23,19 +23,46 @@ namespace ts {
     {
         TS_NOCOPY(SHA256);
     public:
-        SHA256() : Hash(u"SHA-256", HASH_SIZE) {}  //!< Constructor.
-        virtual ~SHA256() override;                //!< Destructor.
+        SHA256();                    //!< Constructor.
+        virtual ~SHA256() override;  //!< Destructor.
 
         //!
         //! SHA-256 hash size in bytes (256 bits).
         //!
         static constexpr size_t HASH_SIZE = 256/8;
 
+        //!
+        //! SHA-256 block size in bytes (512 bits).
+        //!
+        static constexpr size_t BLOCK_SIZE = 512/8;
+
+        // Implementation of Hash interface. When the CPU supports accelerated SHA-256
+        // instructions, a local implementation is used instead of the system-specific
+        // cryptographic library. This is much faster on small messages such as ECM's.
+        virtual bool init() override;
+        virtual bool add(const void* data, size_t size) override;
+        virtual bool getHash(void* hash, size_t bufsize, size_t* retsize = nullptr) override;
+
     protected:
 #if defined(TS_WINDOWS)
         virtual void getAlgorithm(::BCRYPT_ALG_HANDLE& algo, size_t& length) const override;
 #elif !defined(TS_NO_OPENSSL)
         virtual const EVP_MD_CTX* referenceContext() const override;
 #endif
+
+    private:
+        uint64_t _length = 0;                      // Size in bits of the already compressed part of the message.
+        size_t   _curlen = 0;                      // Used bytes in _buf.
+        uint32_t _state[HASH_SIZE / 4] {};         // Current hash value.
+        uint8_t  _buf[BLOCK_SIZE] {};              // Pending partial block.
+
+        // Compress a sequence of 64-byte blocks into the hash state, using accelerated
+        // instructions. Implemented in tsSHA256.accel.cpp, shall not be called when the
+        // accelerated instructions are not supported.
+        void compressAccel(const uint8_t* buf, size_t blocks);
+
+        // Runtime check once if accelerated SHA-256 instructions are supported on this CPU.
+        static volatile bool _accel_checked;
+        static volatile bool _accel_supported;
     };
 }
@@ -99,17 +99,41 @@ bool ts::Xoshiro256ss::read(void* buffer, size_t size)
         return false;
     }
 
-    // Read full 64-bit chunks.
-    uint64_t* out64 = reinterpret_cast<uint64_t*>(buffer);
-    while (size >= sizeof(uint64_t)) {
-        PutUInt64LE(out64++, read64());
-        size -= sizeof(uint64_t);
+    // Bulk generation: keep the state in local variables for the whole buffer,
+    // avoiding one round trip through memory per generated value. The generated
+    // sequence is exactly the same as repeated calls to read64(). The state
+    // values are interpreted in little endian order, as in read64().
+    uint64_t s0 = GetUInt64LE(_state);
+    uint64_t s1 = GetUInt64LE(_state + 1);
+    uint64_t s2 = GetUInt64LE(_state + 2);
+    uint64_t s3 = GetUInt64LE(_state + 3);
+
+    uint8_t* out = reinterpret_cast<uint8_t*>(buffer);
+    while (size > 0) {
+        const uint64_t result = std::rotl(s1 * 5, 7) * 9;
+        const uint64_t t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = std::rotl(s3, 45);
+        if (size >= sizeof(uint64_t)) {
+            PutUInt64LE(out, result);
+            out += sizeof(uint64_t);
+            size -= sizeof(uint64_t);
+        }
+        else {
+            // Remaining bytes, less than a full 64-bit value.
+            const uint64_t last = CondByteSwap64LE(result);
+            MemCopy(out, &last, size);
+            size = 0;
+        }
     }
 
-    // Remaining bytes.
-    if (size > 0) {
-        const uint64_t last = CondByteSwap64LE(read64());
-        MemCopy(out64, &last, size);
-    }
+    PutUInt64LE(_state, s0);
+    PutUInt64LE(_state + 1, s1);
+    PutUInt64LE(_state + 2, s2);
+    PutUInt64LE(_state + 3, s3);
     return true;
 }
@@ -7,6 +7,9 @@
 //----------------------------------------------------------------------------
 
 #include "tsInfluxRequest.h"
+#include "tsZlib.h"
+
+#define GZIP_LEVEL 6  // gzip compression level of request bodies
 
 
 //----------------------------------------------------------------------------
@@ -27,7 +30,7 @@ ts::InfluxRequest::~InfluxRequest()
 // Send a write request to the InfluxDB server.
 //----------------------------------------------------------------------------
 
-bool ts::InfluxRequest::write(const InfluxArgs& args, const UString& data, const UString& precision)
+bool ts::InfluxRequest::write(const InfluxArgs& args, const UString& data, const UString& precision, bool gzip)
 {
     // Build the URL.
     UString url(args.host_url);
@@ -69,7 +72,19 @@ bool ts::InfluxRequest::write(const InfluxArgs& args, const UString& data, const
     clearRequestHeaders();
     setRequestHeader(u"Authorization", u"Token " + args.token);
     setRequestHeader(u"Accept", u"application/json");
-    setPostData(data, u"text/plain; charset=utf-8");
+    if (gzip) {
+        const std::string utf8(data.toUTF8());
+        ByteBlock body;
+        if (!Zlib::GzipCompress(body, utf8.data(), utf8.size(), GZIP_LEVEL, report())) {
+            return false;
+        }
+        setRequestHeader(u"Content-Type", u"text/plain; charset=utf-8");
+        setRequestHeader(u"Content-Encoding", u"gzip");
+        setPostData(body);
+    }
+    else {
+        setPostData(data, u"text/plain; charset=utf-8");
+    }
 
     // Send the request.
     UString response;
@@ -41,11 +41,13 @@ namespace ts {
         //! @param [in] args The connection information to the InfluxDB server.
         //! @param [in] data The data to send, in "line protocol" format.
         //! @param [in] precision Precision of timestamps. Must be one of "s", "ms", "us", "ns".
+        //! @param [in] gzip If true, the request body is sent in gzip format. The InfluxDB
+        //! server natively accepts gzip-encoded bodies.
         //! @return True on success, false on error.
         //! @see https://docs.influxdata.com/influxdb/v2/reference/syntax/line-protocol/
         //! @see https://docs.influxdata.com/influxdb/v2/api/v2/#operation/PostWrite
         //!
-        bool write(const InfluxArgs& args, const UString& data, const UString& precision);
+        bool write(const InfluxArgs& args, const UString& data, const UString& precision, bool gzip = false);
 
         //!
         //! Escape characters in a string to be used as measurement.
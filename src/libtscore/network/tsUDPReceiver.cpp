@@ -49,13 +49,20 @@ bool ts::UDPReceiver::open(IP gen, Report& report)
     _first_source.clear();
     _sources.clear();
 
+    // Reset drop accounting and buffer autotuning state.
+    _cur_bufsize = _args.receive_bufsize;
+    _drop_reported = 0;
+    _next_drop_report = Time::Epoch;
+
     // The local socket address to bind is the optional local IP address and the destination port.
     // Except on Linux, macOS and probably most UNIX, when listening to a multicast group.
     // In that case, we bind to the multicast group, not the local interface.
     // Note that if _args.destination has an address, it must be a multicast one.
     IPSocketAddress local_addr;
 #if defined(TS_UNIX)
-    local_addr.setAddress(_args.destination.hasAddress() ? IPAddress(_args.destination) : _args.local_address);
+    // When additional multicast groups are joined on the same socket, bind to the local
+    // interface address, otherwise the traffic for the other groups would not be delivered.
+    local_addr.setAddress(_args.destination.hasAddress() && _args.additional_groups.empty() ? IPAddress(_args.destination) : _args.local_address);
 #else
     local_addr.setAddress(_args.local_address);
 #endif
@@ -78,11 +85,15 @@ bool ts::UDPReceiver::open(IP gen, Report& report)
         UDPSocket::open(gen, report) &&
         reusePort(_args.reuse_port, report) &&
         setReceiveTimestamps(_args.receive_timestamps, report) &&
+        setReceiveDropMonitoring(true, report) &&
         setMulticastLoop(_args.mc_loopback, report) &&
         (_args.receive_bufsize <= 0 || setReceiveBufferSize(_args.receive_bufsize, report)) &&
         (_args.receive_timeout < cn::milliseconds::zero() || setReceiveTimeout(_args.receive_timeout, report)) &&
         bind(local_addr, report);
 
+    // Optional batch reception mode (no error possible, ignored when unsupported).
+    setReceiveBatchSize(_args.receive_batch);
+
     // Optional SSM source address.
     IPAddress ssm_source;
     if (_args.use_ssm) {
@@ -103,6 +114,19 @@ bool ts::UDPReceiver::open(IP gen, Report& report)
         }
     }
 
+    // Join additional multicast groups on the same socket.
+    for (auto it = _args.additional_groups.begin(); ok && it != _args.additional_groups.end(); ++it) {
+        if (_args.default_interface) {
+            ok = addMembershipDefault(*it, ssm_source, report);
+        }
+        else if (_args.local_address.hasAddress()) {
+            ok = addMembership(*it, _args.local_address, ssm_source, report);
+        }
+        else {
+            ok = addMembershipAll(*it, ssm_source, !_args.no_link_local, report);
+        }
+    }
+
     if (!ok) {
         close(report);
     }
@@ -137,6 +161,27 @@ bool ts::UDPReceiver::receive(void* data,
             report.log(2, u"received UDP packet, source: %s, destination: %s, timestamp: %'d", sender, destination, timestamp != nullptr ? timestamp->count() : -1);
         }
 
+        // Check the dropped datagram counter. Datagrams are dropped by the kernel
+        // when the socket receive buffer is full, silently corrupting the stream.
+        // Report the losses and optionally enlarge the buffer (see --auto-buffer-size).
+        const uint64_t drops = receiveDropCount();
+        if (drops > _drop_reported) {
+            // Avoid flooding the log during a sustained overflow, report at most once per second.
+            const Time now(Time::CurrentUTC());
+            if (now >= _next_drop_report) {
+                report.warning(u"%'d UDP datagrams dropped by the kernel, socket receive buffer too small for the bitrate", drops - _drop_reported);
+                _drop_reported = drops;
+                _next_drop_report = now + cn::seconds(1);
+            }
+            if (_args.max_receive_bufsize > 0 && _cur_bufsize < _args.max_receive_bufsize) {
+                // Double the buffer size, within bounds. When no initial size was
+                // specified, restart the progression from a reasonable floor.
+                _cur_bufsize = std::min(std::max<size_t>(2 * _cur_bufsize, 512 * 1024), _args.max_receive_bufsize);
+                report.verbose(u"enlarging socket receive buffer to %'d bytes", _cur_bufsize);
+                setReceiveBufferSize(_cur_bufsize, report);
+            }
+        }
+
         // Check the destination address to exclude packets from other streams.
         // When several multicast streams use the same destination port and several
         // applications on the same system listen to these distinct streams,
@@ -148,11 +193,14 @@ bool ts::UDPReceiver::receive(void* data,
         // We accept a packet in any of:
         // 1) Actual packet destination is unknown. Probably, the system cannot
         //    report the destination address.
-        // 2) We listen to a multicast address and the actual destination is the same.
+        // 2) We listen to a multicast address and the actual destination is the same
+        //    or one of the additional multicast groups which are joined on this socket.
         // 3) If we listen to unicast traffic and the actual destination is unicast.
         //    In that case, unicast is by definition sent to us.
 
-        if (destination.hasAddress() && ((_args.destination.hasAddress() && destination != _args.destination) || (!_args.destination.hasAddress() && destination.isMulticast()))) {
+        if (destination.hasAddress() &&
+            ((_args.destination.hasAddress() && destination != _args.destination && _args.additional_groups.count(IPAddress(destination)) == 0) ||
+             (!_args.destination.hasAddress() && destination.isMulticast()))) {
             // This is a spurious packet.
             if (report.maxSeverity() >= Severity::Debug) {
                 // Prior report level checking to avoid evaluating parameters when not necessary.
@@ -14,6 +14,7 @@
 #pragma once
 #include "tsUDPSocket.h"
 #include "tsUDPReceiverArgs.h"
+#include "tsTime.h"
 
 namespace ts {
     //!
@@ -68,8 +69,11 @@ namespace ts {
                              cn::microseconds* timestamp = nullptr) override;
 
     private:
-        UDPReceiverArgs    _args {};          // Reception parameters (typically from the command line).
-        IPSocketAddress    _first_source {};  // Socket address of first received packet.
-        IPSocketAddressSet _sources {};       // Set of all detected packet sources.
+        UDPReceiverArgs    _args {};             // Reception parameters (typically from the command line).
+        IPSocketAddress    _first_source {};     // Socket address of first received packet.
+        IPSocketAddressSet _sources {};          // Set of all detected packet sources.
+        size_t             _cur_bufsize = 0;     // Last requested socket receive buffer size.
+        uint64_t           _drop_reported = 0;   // Number of already reported dropped datagrams.
+        Time               _next_drop_report {}; // Do not report dropped datagrams before that time.
     };
 }
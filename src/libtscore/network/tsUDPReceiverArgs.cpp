@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsUDPReceiverArgs.h"
+#include "tsUDPSocket.h"
 #include "tsArgs.h"
 
 
@@ -59,6 +60,15 @@ void ts::UDPReceiverArgs::DefineArgs(Args& args, bool with_short_options, bool d
     args.option(dest_name, dest_short, Args::STRING, dest_min, max_count);
     args.help(dest_name, u"[[source@]address:]port", help);
 
+    args.option(u"auto-buffer-size", 0, Args::INTEGER, 0, 1, 0, Args::UNLIMITED_VALUE, true);
+    args.help(u"auto-buffer-size", u"bytes",
+              u"Automatically enlarge the UDP socket receive buffer when the kernel reports dropped datagrams, "
+              u"on systems where drop accounting is supported (Linux only). "
+              u"The buffer size is doubled each time new losses are detected, up to the specified maximum size in bytes. "
+              u"The default maximum is " + UString::Decimal(UDPReceiverArgs::DEFAULT_AUTO_BUFSIZE) +
+              u" bytes when the option is present without value. "
+              u"By default, the socket receive buffer keeps its initial size (see --buffer-size).");
+
     args.option(u"buffer-size", with_short_options ? 'b' : 0, Args::UNSIGNED);
     args.help(u"buffer-size", u"Specify the UDP socket receive buffer size in bytes (socket option).");
 
@@ -110,6 +120,15 @@ void ts::UDPReceiverArgs::DefineArgs(Args& args, bool with_short_options, bool d
               u"Set the reuse port socket option. This is now enabled by default, the option "
               u"is present for legacy only.");
 
+    args.option(u"receive-batch", 0, Args::INTEGER, 0, 1, 1, Args::UNLIMITED_VALUE, true);
+    args.help(u"receive-batch", u"count",
+              u"Receive UDP datagrams by batches of the specified maximum size, using one single "
+              u"system call per batch, on systems which support it (Linux only). "
+              u"This reduces the reception overhead and the risk of dropped packets at high bitrates. "
+              u"The default batch size is " + UString::Decimal(UDPSocket::DEFAULT_RECEIVE_BATCH) +
+              u" datagrams when the option is present without value. "
+              u"By default, datagrams are received one by one.");
+
     args.option<cn::milliseconds>(u"receive-timeout");
     args.help(u"receive-timeout",
               u"Specify the UDP reception timeout in milliseconds. "
@@ -158,6 +177,8 @@ bool ts::UDPReceiverArgs::loadArgs(Args& args,
     mc_loopback = !args.present(u"disable-multicast-loop");
     use_ssm = args.present(u"ssm");
     args.getIntValue(receive_bufsize, u"buffer-size", 0);
+    max_receive_bufsize = args.present(u"auto-buffer-size") ? args.intValue<size_t>(u"auto-buffer-size", DEFAULT_AUTO_BUFSIZE) : 0;
+    receive_batch = args.present(u"receive-batch") ? args.intValue<size_t>(u"receive-batch", UDPSocket::DEFAULT_RECEIVE_BATCH) : 0;
     args.getChronoValue(receive_timeout, u"receive-timeout", receive_timeout);
 
     local_address.clear();
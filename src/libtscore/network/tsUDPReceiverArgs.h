@@ -30,6 +30,11 @@ namespace ts {
         //!
         UDPReceiverArgs() = default;
 
+        //!
+        //! Default maximum socket receive buffer size with -\-auto-buffer-size.
+        //!
+        static constexpr size_t DEFAULT_AUTO_BUFSIZE = 16 * 1024 * 1024;
+
         bool             reuse_port = true;          //!< Reuse port socket option (-\-no-reuse-port not present).
         bool             default_interface = false;  //!< Use default local interface only for multicast (-\-default-interface).
         bool             no_link_local = false;      //!< Ignore link-local addresses (-\-no-link-local).
@@ -38,6 +43,8 @@ namespace ts {
         bool             use_ssm = false;            //!< Use source-specific multicast (-\-ssm or SSM syntax used in destination).
         bool             receive_timestamps = true;  //!< Get receive timestamps, currently hardcoded, is there a reason to disable it?
         size_t           receive_bufsize = 0;        //!< Socket receive buffer size in bytes (-\-buffer-size).
+        size_t           max_receive_bufsize = 0;    //!< Max socket receive buffer size in bytes when autotuning, 0 for no autotuning (-\-auto-buffer-size).
+        size_t           receive_batch = 0;          //!< Max number of datagrams per batch reception, 0 or 1 for none (-\-receive-batch).
         cn::milliseconds receive_timeout = cn::milliseconds(-1);  //!< Receive timeout (-\-receive-timeout).
         IPAddress        local_address {};           //!< Optional local addresses on which to listen (-\-local-address).
 
@@ -56,6 +63,14 @@ namespace ts {
         //!
         IPSocketAddress source {};
 
+        //!
+        //! Optional additional multicast groups to join on the same socket.
+        //! All groups are received on the UDP port of @a destination, on the same local interfaces.
+        //! There is no command line option for this field in UDPReceiverArgs, it is set by
+        //! applications which demultiplex several multicast streams from one single socket.
+        //!
+        IPAddressSet additional_groups {};
+
         //!
         //! Set application-specified parameters to receive unicast traffic.
         //! This method is used when command line parameters are not used.
@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsUDPSocket.h"
+#include "tsIPProtocols.h"
 #include "tsNetworkInterface.h"
 #include "tsNullReport.h"
 #include "tsSysUtils.h"
@@ -56,6 +57,12 @@ bool ts::UDPSocket::open(IP gen, Report& report)
         return false;
     }
 
+#if defined(TS_LINUX)
+    // Reset drop accounting, the kernel counter restarts from zero on a new socket.
+    _drop_last = 0;
+    _drop_count = 0;
+#endif
+
     // Set option to get the destination address of all UDP packets arriving on this socket.
     if (generation() == IP::v4) {
         // On IPv4 socket, use IP_PKTINFO (IP_RECVDSTADDR on FreeBSD).
@@ -100,8 +107,12 @@ bool ts::UDPSocket::open(IP gen, Report& report)
 
 bool ts::UDPSocket::close(Report& report)
 {
-    // Leave all multicast groups.
     if (isOpen()) {
+#if defined(TS_LINUX)
+        // Best effort transmission of datagrams which are still queued by batch transmission.
+        flushSendBatch(report);
+#endif
+        // Leave all multicast groups.
         dropMembership(report);
     }
 
@@ -316,6 +327,125 @@ bool ts::UDPSocket::setReceiveTimestamps(bool on, Report& report)
 }
 
 
+//----------------------------------------------------------------------------
+// Enable or disable the accounting of dropped datagrams.
+//----------------------------------------------------------------------------
+
+bool ts::UDPSocket::setReceiveDropMonitoring(bool on, Report& report)
+{
+    // The option exists only on Linux and is silently ignored on other systems.
+#if defined(TS_LINUX) && defined(SO_RXQ_OVFL)
+    // Set SO_RXQ_OVFL option which attaches the kernel drop counter to each received datagram.
+    int enable = int(on);
+    report.debug(u"setting socket SO_RXQ_OVFL to %d", enable);
+    if (::setsockopt(getSocket(), SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) != 0) {
+        report.error(u"socket option SO_RXQ_OVFL: %s", SysErrorCodeMessage());
+        return false;
+    }
+#endif
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Get the number of datagrams which were dropped by the kernel.
+//----------------------------------------------------------------------------
+
+uint64_t ts::UDPSocket::receiveDropCount() const
+{
+#if defined(TS_LINUX)
+    return _drop_count;
+#else
+    return 0;
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Set the maximum number of datagrams which are received in one batch.
+//----------------------------------------------------------------------------
+
+void ts::UDPSocket::setReceiveBatchSize(size_t count)
+{
+    // Batch reception exists only on Linux and is silently ignored on other systems.
+#if defined(TS_LINUX)
+    _batch_size = std::max<size_t>(1, count);
+    // The buffers are allocated at first batch reception, see receiveBatch().
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Set the maximum number of datagrams which are sent in one batch.
+//----------------------------------------------------------------------------
+
+void ts::UDPSocket::setSendBatchSize(size_t count)
+{
+    // Batch transmission exists only on Linux and is silently ignored on other systems.
+#if defined(TS_LINUX)
+    // Do not lose datagrams which are already queued when the batch size changes.
+    if (_send_count > 0) {
+        flushSendBatch(NULLREP);
+    }
+    _send_batch_size = std::max<size_t>(1, count);
+    // The buffers are allocated at first batch transmission, see send().
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Send all datagrams which are currently queued by batch transmission.
+//----------------------------------------------------------------------------
+
+bool ts::UDPSocket::flushSendBatch(Report& report)
+{
+#if defined(TS_LINUX)
+    if (_send_count > 0) {
+
+        // All datagrams of a batch are sent to the default destination.
+        IPSocketAddress dest(_default_destination);
+        if (!convert(dest, report)) {
+            _send_count = 0;
+            return false;
+        }
+        ::sockaddr_storage addr;
+        const size_t addr_size = dest.get(addr);
+
+        // Rebuild the message headers, all pointing to the same destination address.
+        for (size_t i = 0; i < _send_count; ++i) {
+            ::iovec& vec(_send_vecs[i]);
+            vec.iov_base = _send_data[i].data();
+            vec.iov_len = _send_data[i].size();
+            ::msghdr& hdr(_send_hdrs[i].msg_hdr);
+            TS_ZERO(hdr);
+            hdr.msg_name = &addr;
+            hdr.msg_namelen = socklen_t(addr_size);
+            hdr.msg_iov = &vec;
+            hdr.msg_iovlen = 1;
+        }
+
+        // The system call may send less datagrams than requested, loop until all are gone.
+        size_t sent = 0;
+        while (sent < _send_count) {
+            const int count = ::sendmmsg(getSocket(), &_send_hdrs[sent], unsigned(_send_count - sent), 0);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    // Got a signal, not an error, retry the system call.
+                    continue;
+                }
+                report.error(u"error sending UDP message: %s", SysErrorCodeMessage());
+                _send_count = 0;
+                return false;
+            }
+            sent += size_t(count);
+        }
+        _send_count = 0;
+    }
+#endif
+    return true;
+}
+
+
 //----------------------------------------------------------------------------
 // Enable or disable the broadcast option.
 //----------------------------------------------------------------------------
@@ -548,11 +678,33 @@ bool ts::UDPSocket::dropMembership(Report& report)
 
 bool ts::UDPSocket::send(const void* data, size_t size, Report& report)
 {
+#if defined(TS_LINUX)
+    // With batch transmission, queue the datagram and send the batch when full.
+    if (_send_batch_size > 1) {
+        // Allocate the batch structures on first use or when the batch size changed.
+        if (_send_data.size() != _send_batch_size) {
+            _send_count = 0;
+            _send_data.resize(_send_batch_size);
+            _send_hdrs.resize(_send_batch_size);
+            _send_vecs.resize(_send_batch_size);
+        }
+        // Copy the datagram at the end of the queue. The individual buffers keep their
+        // allocated capacity between batches, the copy is the only per-datagram cost.
+        _send_data[_send_count++].copy(data, size);
+        return _send_count < _send_batch_size || flushSendBatch(report);
+    }
+#endif
     return send(data, size, _default_destination, report);
 }
 
 bool ts::UDPSocket::send(const void* data, size_t size, const IPSocketAddress& dest_in, Report& report)
 {
+#if defined(TS_LINUX)
+    // Preserve the datagram order: flush the batched datagrams first.
+    if (!flushSendBatch(report)) {
+        return false;
+    }
+#endif
     IPSocketAddress dest(dest_in);
     if (!convert(dest, report)) {
         return false;
@@ -587,6 +739,46 @@ bool ts::UDPSocket::receive(void* data,
         *timestamp = cn::microseconds(-1);
     }
 
+#if defined(TS_LINUX)
+    // In batch mode, return messages from the current batch, receive a new batch when empty.
+    if (_batch_size > 1) {
+        for (;;) {
+            // Return the next message of the current batch, if there is one.
+            while (_batch_next < _batch_count) {
+                const BatchMessage& msg(_batch[_batch_next++]);
+                // Ignore "successful" empty messages coming from nowhere, like receiveOne().
+                if (msg.size > 0 || msg.sender.hasAddress()) {
+                    ret_size = std::min(max_size, msg.size);
+                    MemCopy(data, msg.data.data(), ret_size);
+                    sender = msg.sender;
+                    destination = msg.destination;
+                    if (timestamp != nullptr) {
+                        *timestamp = msg.timestamp;
+                    }
+                    return true;
+                }
+            }
+            // The batch is exhausted, receive a new one.
+            const int err = receiveBatch(report);
+            if (abort != nullptr && abort->aborting()) {
+                // Aborting, no error message.
+                return false;
+            }
+            else if (err == EINTR) {
+                // Got a signal, not a user interrupt, will ignore it.
+                report.debug(u"signal, not user interrupt");
+            }
+            else if (err != 0) {
+                // Abort on non-interrupt errors.
+                if (isOpen()) {
+                    report.error(u"error receiving from UDP socket: %s", SysErrorCodeMessage(err));
+                }
+                return false;
+            }
+        }
+    }
+#endif
+
     // Loop on unsollicited interrupts
     for (;;) {
 
@@ -744,13 +936,32 @@ int ts::UDPSocket::receiveOne(void* data,
         return LastSysErrorCode();
     }
 
+    // Browse returned ancillary data.
+    processAncillaryData(hdr, destination, timestamp);
+
+#endif // Windows vs. UNIX
+
+    // Successfully received a message
+    ret_size = size_t(insize);
+    sender = IPSocketAddress(sender_sock);
+
+    return 0; // success
+}
+
+
+//----------------------------------------------------------------------------
+// Process the ancillary data of one received message.
+//----------------------------------------------------------------------------
+
+#if defined(TS_UNIX)
+void ts::UDPSocket::processAncillaryData(::msghdr& hdr, IPSocketAddress& destination, cn::microseconds* timestamp)
+{
     TS_PUSH_WARNING()
     TS_GCC_NOWARNING(zero-as-null-pointer-constant) // invalid definition of CMSG_NXTHDR in musl libc (Alpine Linux)
 #if defined(TS_OPENBSD)
     TS_LLVM_NOWARNING(cast-align) // invalid definition of CMSG_NXTHDR on OpenBSD
 #endif
 
-    // Browse returned ancillary data.
     for (::cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
 
         // Look for destination IP address.
@@ -774,6 +985,17 @@ int ts::UDPSocket::receiveOne(void* data,
         }
 #endif
 
+        // On Linux, look for the dropped datagram counter.
+        // The kernel reports a cumulative wrapping 32-bit counter, convert it to a 64-bit total.
+#if defined(TS_LINUX) && defined(SO_RXQ_OVFL)
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL && cmsg->cmsg_len >= sizeof(uint32_t)) {
+            uint32_t value = 0;
+            MemCopy(&value, CMSG_DATA(cmsg), sizeof(value));
+            _drop_count += uint32_t(value - _drop_last);
+            _drop_last = value;
+        }
+#endif
+
         // On Linux, look for receive timestamp.
 #if defined(TS_LINUX)
         if (timestamp != nullptr && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPNS && cmsg->cmsg_len >= sizeof(::timespec)) {
@@ -789,12 +1011,65 @@ int ts::UDPSocket::receiveOne(void* data,
     }
 
     TS_POP_WARNING()
+}
+#endif // TS_UNIX
 
-#endif // Windows vs. UNIX
 
-    // Successfully received a message
-    ret_size = size_t(insize);
-    sender = IPSocketAddress(sender_sock);
+//----------------------------------------------------------------------------
+// Receive one batch of datagrams. Linux only, see setReceiveBatchSize().
+//----------------------------------------------------------------------------
+
+#if defined(TS_LINUX)
+int ts::UDPSocket::receiveBatch(Report& report)
+{
+    // Size of the ancillary data buffer of each message.
+    constexpr size_t ANCIL_SIZE = 1024;
+
+    _batch_count = _batch_next = 0;
+
+    // Allocate the message buffers and system structures at first use.
+    if (_batch.size() != _batch_size) {
+        _batch.resize(_batch_size);
+        _batch_hdrs.resize(_batch_size);
+        _batch_vecs.resize(_batch_size);
+        _batch_senders.resize(_batch_size);
+        _batch_ancil.resize(_batch_size * ANCIL_SIZE);
+        for (auto& msg : _batch) {
+            msg.data.resize(IP_MAX_PACKET_SIZE);
+        }
+    }
 
+    // Rebuild the message headers. The kernel overwrites the name and control
+    // lengths with the actual sizes, they must be reset before each batch.
+    for (size_t i = 0; i < _batch_size; ++i) {
+        _batch_vecs[i].iov_base = _batch[i].data.data();
+        _batch_vecs[i].iov_len = _batch[i].data.size();
+        TS_ZERO(_batch_hdrs[i]);
+        ::msghdr& hdr(_batch_hdrs[i].msg_hdr);
+        hdr.msg_name = &_batch_senders[i];
+        hdr.msg_namelen = sizeof(::sockaddr_storage);
+        hdr.msg_iov = &_batch_vecs[i];
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = &_batch_ancil[i * ANCIL_SIZE];
+        hdr.msg_controllen = ANCIL_SIZE;
+    }
+
+    // Wait for the first datagram, get all immediately available ones, without waiting.
+    const int count = ::recvmmsg(getSocket(), _batch_hdrs.data(), unsigned(_batch_size), MSG_WAITFORONE, nullptr);
+    if (count < 0) {
+        return LastSysErrorCode();
+    }
+
+    // Decode the received messages.
+    for (size_t i = 0; i < size_t(count); ++i) {
+        BatchMessage& msg(_batch[i]);
+        msg.size = std::min<size_t>(_batch_hdrs[i].msg_len, msg.data.size());
+        msg.sender = IPSocketAddress(_batch_senders[i]);
+        msg.destination.clear();
+        msg.timestamp = cn::microseconds(-1);
+        processAncillaryData(_batch_hdrs[i].msg_hdr, msg.destination, &msg.timestamp);
+    }
+    _batch_count = size_t(count);
     return 0; // success
 }
+#endif
@@ -18,6 +18,7 @@
 #include "tsAbortInterface.h"
 #include "tsReport.h"
 #include "tsMemory.h"
+#include "tsByteBlock.h"
 
 #if defined(DOXYGEN) || defined(TS_OPENBSD) || defined(TS_NETBSD) || defined(TS_DRAGONFLYBSD)
     //!
@@ -208,6 +209,89 @@ namespace ts {
         //!
         bool setReceiveTimestamps(bool on, Report& report = CERR);
 
+        //!
+        //! Enable or disable the accounting of dropped datagrams.
+        //!
+        //! When enabled, the kernel reports the number of datagrams which were dropped
+        //! on this socket because the receive buffer was full. The counter is attached
+        //! to each received datagram and is collected by receive(). The cumulative
+        //! number of dropped datagrams is returned by receiveDropCount().
+        //!
+        //! Currently, this option is supported on Linux only. It is ignored on other systems.
+        //!
+        //! @param [in] on If true, drop accounting is activated on the socket. Otherwise, it is disabled.
+        //! @param [in,out] report Where to report error.
+        //! @return True on success, false on error.
+        //!
+        bool setReceiveDropMonitoring(bool on, Report& report = CERR);
+
+        //!
+        //! Get the number of datagrams which were dropped by the kernel on this socket.
+        //!
+        //! Dropped datagrams are counted only when drop accounting was enabled using
+        //! setReceiveDropMonitoring(). The counter is updated on each receive() and
+        //! consequently lags behind the kernel value when no datagram is received.
+        //!
+        //! @return Cumulative number of dropped datagrams since the socket was opened.
+        //! Always zero on systems without drop accounting (anything but Linux).
+        //!
+        uint64_t receiveDropCount() const;
+
+        //!
+        //! Default number of datagrams per batch with setReceiveBatchSize().
+        //!
+        static constexpr size_t DEFAULT_RECEIVE_BATCH = 32;
+
+        //!
+        //! Set the maximum number of datagrams which are received in one batch.
+        //!
+        //! When larger than one, on systems with a batch reception interface (recvmmsg()
+        //! on Linux), several datagrams are received with one single system call and are
+        //! then returned one by one by receive(). The reception thread performs fewer
+        //! system calls and more easily catches up with the incoming traffic after a
+        //! scheduling glitch, reducing the risk of dropped datagrams at high bitrates.
+        //! A batch is complete as soon as no more datagram is immediately available,
+        //! the reception of the first datagram of a batch is never delayed.
+        //!
+        //! Currently, this option is supported on Linux only. It is ignored on other systems.
+        //!
+        //! @param [in] count Maximum number of datagrams per batch. Use 1 to disable batch reception.
+        //!
+        void setReceiveBatchSize(size_t count);
+
+        //!
+        //! Default number of datagrams per batch with setSendBatchSize().
+        //!
+        static constexpr size_t DEFAULT_SEND_BATCH = 32;
+
+        //!
+        //! Set the maximum number of datagrams which are sent in one batch.
+        //!
+        //! When larger than one, on systems with a batch transmission interface (sendmmsg()
+        //! on Linux), datagrams which are sent to the default destination are queued in the
+        //! socket object and transmitted with one single system call when the batch is full.
+        //! This reduces the system call overhead of high bitrate outputs. Since the last
+        //! datagrams may remain queued, the application shall call flushSendBatch() before
+        //! closing the socket or when the stream pauses.
+        //!
+        //! Only datagrams which are sent to the default destination are batched. Sending
+        //! a datagram to an explicit destination first flushes the pending batch, in order
+        //! to preserve the datagram order.
+        //!
+        //! Currently, this option is supported on Linux only. It is ignored on other systems.
+        //!
+        //! @param [in] count Maximum number of datagrams per batch. Use 1 to disable batch transmission.
+        //!
+        void setSendBatchSize(size_t count);
+
+        //!
+        //! Send all datagrams which are currently queued by batch transmission.
+        //! Do nothing when batch transmission is not active (see setSendBatchSize()).
+        //! @param [in,out] report Where to report error.
+        //! @return True on success, false on error.
+        //!
+        bool flushSendBatch(Report& report = CERR);
+
         //!
         //! Enable or disable the broadcast option.
         //!
@@ -442,6 +526,51 @@ namespace ts {
         // Perform one receive operation. Hide the system mud. Return a system socket error code.
         int receiveOne(void* data, size_t max_size, size_t& ret_size, IPSocketAddress& sender, IPSocketAddress& destination, Report& report, cn::microseconds* timestamp);
 
+#if defined(TS_UNIX)
+        // Process the ancillary data of one received message (destination address, receive timestamp).
+        void processAncillaryData(::msghdr& hdr, IPSocketAddress& destination, cn::microseconds* timestamp);
+#endif
+
+#if defined(TS_LINUX)
+        // Batch reception: one decoded datagram from a previous recvmmsg().
+        class BatchMessage
+        {
+        public:
+            BatchMessage() = default;
+            ByteBlock        data {};
+            size_t           size = 0;
+            IPSocketAddress  sender {};
+            IPSocketAddress  destination {};
+            cn::microseconds timestamp = cn::microseconds(-1);
+        };
+
+        // Batch reception state. The buffers and system structures are allocated at first use
+        // and reused for all subsequent batches. See setReceiveBatchSize().
+        size_t _batch_size = 1;                             // Maximum number of datagrams per batch.
+        size_t _batch_count = 0;                            // Number of valid messages in _batch.
+        size_t _batch_next = 0;                             // Next message of _batch to return.
+        std::vector<BatchMessage> _batch {};                // Decoded messages of the current batch.
+        std::vector<::mmsghdr> _batch_hdrs {};              // recvmmsg() message headers.
+        std::vector<::iovec> _batch_vecs {};                // One iovec per message.
+        std::vector<::sockaddr_storage> _batch_senders {};  // One sender address per message.
+        ByteBlock _batch_ancil {};                          // Ancillary data buffers, one chunk per message.
+
+        // Receive one batch of datagrams in _batch. Return a system socket error code.
+        int receiveBatch(Report& report);
+
+        // Drop accounting state, see setReceiveDropMonitoring().
+        uint32_t _drop_last = 0;   // Last value of the kernel drop counter (32-bit, wrapping).
+        uint64_t _drop_count = 0;  // Cumulative number of dropped datagrams.
+
+        // Batch transmission state. The buffers and system structures are allocated at
+        // first use and reused for all subsequent batches. See setSendBatchSize().
+        size_t _send_batch_size = 1;           // Maximum number of datagrams per batch.
+        size_t _send_count = 0;                // Number of datagrams currently queued.
+        std::vector<ByteBlock> _send_data {};  // Copies of the queued datagrams.
+        std::vector<::mmsghdr> _send_hdrs {};  // sendmmsg() message headers.
+        std::vector<::iovec> _send_vecs {};    // One iovec per message.
+#endif
+
         // Add multicast membership common code, local interface by index or by address.
         bool addMembershipImpl(const IPAddress& multicast, const IPAddress& local, int interface_index, const IPAddress& source, Report& report);
 
@@ -198,6 +198,18 @@ namespace ts {
         //!
         void setAutoRedirect(bool on) { _auto_redirect = on; }
 
+        //!
+        //! Enable or disable the reuse of connections between transfers.
+        //! When enabled, the underlying connections are kept alive after close()
+        //! and reused by subsequent transfers of this instance to the same host,
+        //! avoiding repeated TCP and TLS connection setups (typical use cases:
+        //! periodic polling of the same URL, downloading successive media segments).
+        //! This option is active by default. All connections are closed when the
+        //! instance is destructed.
+        //! @param [in] on If true, keep connections alive between transfers.
+        //!
+        void setConnectionReuse(bool on = true) { _reuse_connections = on; }
+
         //!
         //! Set various arguments from command line.
         //! @param [in] args Command line arguments.
@@ -424,6 +436,7 @@ namespace ts {
         UString          _proxy_password {};
         bool             _use_cookies = false;
         bool             _auto_redirect = true;
+        bool             _reuse_connections = true;
         bool             _use_compression = false;
         bool             _insecure = false;
         bool             _delete_cookies_file = false; // delete the cookies file on close
@@ -70,6 +70,7 @@ public:
     TLSConnection* conn;
     SSL_CTX*       ssl_ctx = nullptr;
     SSL*           ssl = nullptr;
+    SSL_SESSION*   session = nullptr;
     size_t         shutdown_count = 2;
 
     // Process a SSL returned status. Return the SSL_get_error() code.
@@ -114,6 +115,10 @@ void ts::TLSConnection::SystemGuts::terminate()
         SSL_CTX_free(ssl_ctx);
         ssl_ctx = nullptr;
     }
+    if (session != nullptr) {
+        SSL_SESSION_free(session);
+        session = nullptr;
+    }
     shutdown_count = 2;
 }
 
@@ -152,18 +157,35 @@ bool ts::TLSConnection::SystemGuts::abort(Report& report, const UString& message
 
 bool ts::TLSConnection::connect(const IPSocketAddress& addr, Report& report)
 {
+    // Keep the session of a previous connection on this object, if there is one,
+    // to attempt an abbreviated handshake (session resumption) with the server.
+    SSL_SESSION* const previous_session = _guts->session;
+    _guts->session = nullptr;
     _guts->terminate();
 
     // Create SSL client context.
     if ((_guts->ssl_ctx = OpenSSL::CreateContext(false, _verify_peer, report)) == nullptr) {
+        if (previous_session != nullptr) {
+            ::SSL_SESSION_free(previous_session);
+        }
         return false;
     }
 
     // Create an SSL session for that connection.
     if ((_guts->ssl = ::SSL_new(_guts->ssl_ctx)) == nullptr) {
+        if (previous_session != nullptr) {
+            ::SSL_SESSION_free(previous_session);
+        }
         return _guts->abort(report, u"error creating TLS client connection context");
     }
 
+    // Propose the previous session to the server. The server may decline, in
+    // which case a full handshake is transparently performed.
+    if (previous_session != nullptr) {
+        ::SSL_set_session(_guts->ssl, previous_session);
+        ::SSL_SESSION_free(previous_session);
+    }
+
     // Set host name for SNI.
     if (!_server_name.empty() && !::SSL_set_tlsext_host_name(_guts->ssl, _server_name.toUTF8().c_str())) {
         return _guts->abort(report, u"error setting TLS SNI server name (SSL_set_tlsext_host_name)");
@@ -198,7 +220,8 @@ bool ts::TLSConnection::connect(const IPSocketAddress& addr, Report& report)
         return _guts->abort(report, u"error in TLS handshake with server");
     }
 
-    report.debug(u"TLS connection established with %s, protocol: %s", addr, ::SSL_get_cipher_version(_guts->ssl));
+    report.debug(u"TLS connection established with %s, protocol: %s%s", addr, ::SSL_get_cipher_version(_guts->ssl),
+                 ::SSL_session_reused(_guts->ssl) ? u", session resumed" : u"");
     return true;
 }
 
@@ -252,6 +275,19 @@ bool ts::TLSConnection::closeWriter(Report& report)
 
 bool ts::TLSConnection::disconnect(Report& report)
 {
+    // Save the negotiated session for a possible resumption on a later connect().
+    // With TLS 1.3, session tickets are received during application data reads,
+    // so the session becomes resumable only some time after the handshake.
+    if (_guts->ssl != nullptr) {
+        SSL_SESSION* const sess = ::SSL_get1_session(_guts->ssl);
+        if (sess != nullptr) {
+            if (_guts->session != nullptr) {
+                ::SSL_SESSION_free(_guts->session);
+            }
+            _guts->session = sess;
+        }
+    }
+
     bool success = true;
     while (_guts->shutdown_count > 0) {
         const int ret = SSL_shutdown(_guts->ssl);
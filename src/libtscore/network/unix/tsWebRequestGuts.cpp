@@ -196,8 +196,9 @@ public:
     // Start the transfer using WebRequest parameters.
     bool startTransfer(CertState certState);
 
-    // Close and cleanup everything.
-    void clear();
+    // Close and cleanup the transfer. When full is true, also cleanup the
+    // "curl_multi" handler and its cache of keep-alive connections.
+    void clear(bool full = false);
 
     // Wait for data to be present in the reception buffer.
     // If maxSize is zero, wait until something is present in data buffer
@@ -227,7 +228,7 @@ private:
     char          _error[CURL_ERROR_SIZE] {0}; // Error message buffer for libcurl.
 
     // Close and cleanup everything with _mutex already held.
-    void clearUnderLock();
+    void clearUnderLock(bool full);
 
     // Handle an error while receiving data. Always return false.
     bool downloadError(const UString& message, bool* certError);
@@ -251,7 +252,7 @@ ts::WebRequest::SystemGuts::SystemGuts(WebRequest& request) :
 
 ts::WebRequest::SystemGuts::~SystemGuts()
 {
-    clear();
+    clear(true);
 }
 
 void ts::WebRequest::allocateGuts()
@@ -386,14 +387,15 @@ bool ts::WebRequest::SystemGuts::startTransfer(CertState certState)
 #if defined(TS_CURL_WAKEUP)
             std::lock_guard<std::mutex> lock(_mutex);
 #endif
-            // Initialize curl_multi and curl_easy
-            if ((_curlm = ::curl_multi_init()) == nullptr) {
+            // Initialize curl_multi and curl_easy. When connection reuse is enabled,
+            // the curl_multi handler may be retained from a previous transfer.
+            if (_curlm == nullptr && (_curlm = ::curl_multi_init()) == nullptr) {
                 _request._report.error(u"libcurl 'curl_multi' initialization error");
                 return false;
             }
             if ((_curl = ::curl_easy_init()) == nullptr) {
                 _request._report.error(u"libcurl 'curl_easy' initialization error");
-                clearUnderLock();
+                clearUnderLock(true);
                 return false;
             }
 
@@ -401,7 +403,7 @@ bool ts::WebRequest::SystemGuts::startTransfer(CertState certState)
             ::CURLMcode mstatus = ::curl_multi_add_handle(_curlm, _curl);
             if (mstatus != ::CURLM_OK) {
                 _request._report.error(multiMessage(u"curl_multi_add_handle error", mstatus));
-                clearUnderLock();
+                clearUnderLock(true);
                 return false;
             }
         }
@@ -708,16 +710,16 @@ void ts::WebRequest::SystemGuts::abort()
 // Close and cleanup everything.
 //----------------------------------------------------------------------------
 
-void ts::WebRequest::SystemGuts::clear()
+void ts::WebRequest::SystemGuts::clear(bool full)
 {
 #if defined(TS_CURL_WAKEUP)
     // Make sure we don't call curl_multi_wakeup() while deallocating.
     std::lock_guard<std::mutex> lock(_mutex);
 #endif
-    clearUnderLock();
+    clearUnderLock(full);
 }
 
-void ts::WebRequest::SystemGuts::clearUnderLock()
+void ts::WebRequest::SystemGuts::clearUnderLock(bool full)
 {
     // Deallocate list of headers.
     if (_headers != nullptr) {
@@ -736,8 +738,11 @@ void ts::WebRequest::SystemGuts::clearUnderLock()
         _curl = nullptr;
     }
 
-    // Make sure the curl_multi is clean.
-    if (_curlm != nullptr) {
+    // Make sure the curl_multi is clean. When connection reuse is enabled, the
+    // curl_multi handler is kept between transfers, with its cache of keep-alive
+    // connections, so that subsequent transfers to the same host do not pay the
+    // TCP and TLS connection setup again.
+    if (_curlm != nullptr && (full || !_request._reuse_connections)) {
         ::curl_multi_cleanup(_curlm);
         _curlm = nullptr;
     }
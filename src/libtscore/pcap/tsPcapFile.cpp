@@ -54,6 +54,11 @@ bool ts::PcapFile::open(const fs::path& filename, Report& report)
         _name = u"standard input";
     }
     else {
+        // Install a large stream buffer before opening the file (required by
+        // pubsetbuf), so that the many small reads of block headers and packet
+        // data are served from memory.
+        _io_buffer.resize(FILE_BUFFER_SIZE);
+        _file.rdbuf()->pubsetbuf(_io_buffer.data(), std::streamsize(_io_buffer.size()));
         _file.open(filename, std::ios::in | std::ios::binary);
         if (!_file) {
             report.error(u"error opening %s", filename);
@@ -105,14 +110,10 @@ bool ts::PcapFile::readall(uint8_t* data, size_t size, Report& report)
             return error();
         }
 
-        // Get file size so far.
-        const std::ios::pos_type fpos = _in->tellg();
-        if (fpos != std::ios::pos_type(-1)) {
-            _file_size = uint64_t(fpos);
-        }
-
-        // Actual number of bytes.
+        // Actual number of bytes. Maintain the file size arithmetically,
+        // a tellg() here would cost one seek system call per read.
         const size_t insize = std::min(size_t(_in->gcount()), size);
+        _file_size += insize;
         size -= insize;
         data += insize;
     }
@@ -284,6 +285,188 @@ bool ts::PcapFile::readNgBlockBody(uint32_t block_type, ByteBlock& body, Report&
 }
 
 
+//----------------------------------------------------------------------------
+// Convert a raw pcap-ng packet timestamp into microseconds.
+//----------------------------------------------------------------------------
+
+cn::microseconds ts::PcapFile::ngTimestamp(size_t if_index, uint32_t high, uint32_t low) const
+{
+    cn::microseconds timestamp(-1);
+    if (if_index < _if.size() && _if[if_index].time_units != 0) {
+        const std::intmax_t units = _if[if_index].time_units;
+        const std::intmax_t tstamp = std::intmax_t(uint64_t(high) << 32) + low;
+        // Take care to overflow in tstamp. Sometimes, the timestamp is a full time since 1970
+        // with time unit being 1,000,000,000. The value is close to the 64-bit max.
+        if (units == std::micro::den) {
+            timestamp = cn::microseconds(tstamp);
+        }
+        else if (units > std::micro::den && units % std::micro::den == 0) {
+            timestamp = cn::microseconds(tstamp / (units / std::micro::den));
+        }
+        else if (units < std::micro::den && std::micro::den % units == 0) {
+            timestamp = cn::microseconds(tstamp * (std::micro::den / units));
+        }
+        else if (mul_overflow(tstamp, std::micro::den, tstamp * std::micro::den)) {
+            timestamp = cn::microseconds(cn::microseconds::rep((double(tstamp) * double(std::micro::den)) / double(units)));
+        }
+        else {
+            timestamp = cn::microseconds((tstamp * std::micro::den) / units);
+        }
+    }
+    return timestamp;
+}
+
+
+//----------------------------------------------------------------------------
+// Skip forward to the first packet with a timestamp at or after a given time.
+//----------------------------------------------------------------------------
+
+bool ts::PcapFile::seekTime(cn::microseconds timestamp, Report& report)
+{
+    // Check that the file is open.
+    if (_in == nullptr) {
+        report.error(u"no pcap file open");
+        return false;
+    }
+    if (_error) {
+        return false;
+    }
+
+    // Seeking is possible on regular files only. On the standard input or on a pipe,
+    // do nothing: the caller shall read and discard the unwanted packets sequentially.
+    if (!_file.is_open() || _in->tellg() == std::ios::pos_type(-1)) {
+        report.debug(u"%s is not seekable, cannot skip to timestamp", _name);
+        return true;
+    }
+
+    // Loop on data blocks, reading fixed-size headers only, seeking over packet data.
+    for (;;) {
+
+        // Remember the start position of the current block.
+        const std::ios::pos_type start = _in->tellg();
+        if (start == std::ios::pos_type(-1)) {
+            return error(report, u"error getting read position in %s", _name);
+        }
+
+        // The timestamp of the current packet, if there is one, and the number of
+        // captured bytes it contains, as maintained by readIP() on skipped packets.
+        cn::microseconds tstamp = cn::microseconds(-1);
+        size_t cap_size = 0;
+
+        if (_ng) {
+            // Pcap-ng file, read block type value.
+            uint8_t field[20];
+            if (!readall(field, 4, report)) {
+                // End of file: there is simply no packet in the time range.
+                return _in->eof();
+            }
+            const uint32_t type = get32(field);
+            if (type == PCAPNG_SECTION_HEADER) {
+                // Restart a new section, reinitialize all characteristics.
+                if (!readHeader(type, report)) {
+                    return false;
+                }
+                continue; // loop to next block
+            }
+            // Read the "Block Total Length" field.
+            if (!readall(field, 4, report)) {
+                return false;
+            }
+            const size_t block_size = get32(field);
+            if (block_size % 4 != 0 || block_size < 12) {
+                return error(report, u"invalid pcap-ng block length %d in %s", block_size, _name);
+            }
+            if (type == PCAPNG_INTERFACE_DESC) {
+                // Interface descriptions must be fully processed, they define the time units.
+                // Read the block body and the trailing length field in one chunk.
+                ByteBlock body(block_size - 8);
+                if (!readall(body.data(), body.size(), report) || !analyzeNgInterface(body.data(), body.size() - 4, report)) {
+                    return false;
+                }
+                continue; // loop to next block
+            }
+            else if ((type == PCAPNG_ENHANCED_PACKET || type == PCAPNG_OBSOLETE_PACKET) && block_size >= 12 + 20) {
+                // Read the fixed part of the block body: interface, timestamp, packet sizes.
+                if (!readall(field, 20, report)) {
+                    return false;
+                }
+                const size_t if_index = type == PCAPNG_OBSOLETE_PACKET ? get16(field) : get32(field);
+                tstamp = ngTimestamp(if_index, get32(field + 4), get32(field + 8));
+                if (tstamp >= cn::microseconds::zero()) {
+                    tstamp += _if[if_index].time_offset;
+                }
+                cap_size = std::min<size_t>(get32(field + 12), block_size - 12 - 20);
+            }
+            else if (type == PCAPNG_SIMPLE_PACKET && block_size >= 12 + 4) {
+                // Simple packets have no timestamp, they cannot match the time range.
+                if (!readall(field, 4, report)) {
+                    return false;
+                }
+                cap_size = std::min<size_t>(get32(field), block_size - 12 - 4);
+            }
+            else {
+                // This data block does not contain a captured packet, skip it.
+                if (!_in->seekg(start + std::ios::off_type(block_size))) {
+                    return error(report, u"error seeking %s", _name);
+                }
+                continue; // loop to next block
+            }
+
+            // Skip the rest of the block.
+            if (tstamp < timestamp && !_in->seekg(start + std::ios::off_type(block_size))) {
+                return error(report, u"error seeking %s", _name);
+            }
+        }
+        else {
+            // Pcap file, read the 16-byte packet record header.
+            uint8_t header[16];
+            if (!readall(header, sizeof(header), report)) {
+                // End of file: there is simply no packet in the time range.
+                return _in->eof();
+            }
+            cap_size = get32(header + 8);
+            if (_if[0].time_units > 0) {
+                tstamp = cn::microseconds((cn::microseconds::rep(get32(header)) * std::micro::den) + (cn::microseconds::rep(get32(header + 4)) * std::micro::den) / _if[0].time_units);
+                tstamp += _if[0].time_offset;
+            }
+
+            // Skip the packet data.
+            if (tstamp < timestamp && !_in->seekg(std::streamoff(cap_size), std::ios::cur)) {
+                return error(report, u"error seeking %s", _name);
+            }
+        }
+
+        // A captured packet was reached, the timestamp of the first one is now known.
+        if (tstamp >= cn::microseconds::zero() && _first_timestamp < cn::microseconds::zero()) {
+            _first_timestamp = tstamp;
+        }
+
+        // If the packet reaches the target timestamp, rewind to the beginning of
+        // its block and let the next readIP() consume it.
+        if (tstamp >= timestamp) {
+            if (!_in->seekg(start)) {
+                return error(report, u"error seeking %s", _name);
+            }
+            _file_size = uint64_t(start);
+            return true;
+        }
+
+        // Count the skipped packet as readIP() would have done.
+        _packet_count++;
+        _packets_size += cap_size;
+        if (tstamp >= cn::microseconds::zero()) {
+            _last_timestamp = tstamp;
+        }
+
+        // Track the file size, as readall() does after each read.
+        const std::ios::pos_type fpos = _in->tellg();
+        if (fpos != std::ios::pos_type(-1)) {
+            _file_size = uint64_t(fpos);
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Read the next IPv4 packet (headers included).
 //----------------------------------------------------------------------------
@@ -351,27 +534,7 @@ bool ts::PcapFile::readIP(IPPacket& packet, VLANIdStack& vlans, cn::microseconds
                 cap_size = std::min<size_t>(get32(buffer.data() + 12), buffer.size() - 20);
                 orig_size = get32(buffer.data() + 16);
                 if_index = type == PCAPNG_OBSOLETE_PACKET ? get16(buffer.data()) : get32(buffer.data());
-                if (if_index < _if.size() && _if[if_index].time_units != 0) {
-                    const std::intmax_t units = _if[if_index].time_units;
-                    const std::intmax_t tstamp = std::intmax_t(uint64_t(get32(buffer.data() + 4)) << 32) + get32(buffer.data() + 8);
-                    // Take care to overflow in tstamp. Sometimes, the timestamp is a full time since 1970
-                    // with time unit being 1,000,000,000. The value is close to the 64-bit max.
-                    if (units == std::micro::den) {
-                        timestamp = cn::microseconds(tstamp);
-                    }
-                    else if (units > std::micro::den && units % std::micro::den == 0) {
-                        timestamp = cn::microseconds(tstamp / (units / std::micro::den));
-                    }
-                    else if (units < std::micro::den && std::micro::den % units == 0) {
-                        timestamp = cn::microseconds(tstamp * (std::micro::den / units));
-                    }
-                    else if (mul_overflow(tstamp, std::micro::den, tstamp * std::micro::den)) {
-                        timestamp = cn::microseconds(cn::microseconds::rep((double(tstamp) * double(std::micro::den)) / double(units)));
-                    }
-                    else {
-                        timestamp = cn::microseconds((tstamp * std::micro::den) / units);
-                    }
-                }
+                timestamp = ngTimestamp(if_index, get32(buffer.data() + 4), get32(buffer.data() + 8));
             }
             else if (type == PCAPNG_SIMPLE_PACKET && buffer.size() >= 4) {
                 _packet_count++;
@@ -151,6 +151,31 @@ namespace ts {
             return timestamp < cn::microseconds::zero() ? Time::Epoch : Time::UnixEpoch + timestamp;
         }
 
+        //!
+        //! Skip forward to the first captured packet with a timestamp at or after a given time.
+        //!
+        //! Only the fixed-size record and block headers are read, the packet data are skipped
+        //! using seek operations on the file. On large capture files, this is much faster than
+        //! reading and discarding the skipped packets. Extracting a time window from a huge
+        //! capture file then depends on the size of the window, not on the size of the file.
+        //!
+        //! This is possible on regular files only. When the input is the standard input or a
+        //! non-seekable file such as a pipe, this method does nothing and returns true; the
+        //! caller shall then read and discard the unwanted packets sequentially.
+        //!
+        //! The skipped packets are counted in packetCount() and totalPacketsSize() but, since
+        //! their content is never read, not in ipPacketCount() and totalIPPacketsSize().
+        //!
+        //! @param [in] timestamp Target capture timestamp in microseconds since Unix epoch.
+        //! The file is left positioned on the first packet with a timestamp greater than or
+        //! equal to this value. With a zero value, simply locate the first timestamped packet,
+        //! making firstTimestamp() valid without reading any packet.
+        //! @param [in,out] report Where to report error.
+        //! @return True on success, false on error. Reaching the end of file is not an error:
+        //! there is simply no packet in the time range and the next readIP() returns false.
+        //!
+        virtual bool seekTime(cn::microseconds timestamp, Report& report);
+
         //!
         //! Close the file.
         //! Do not reset counters, file names, etc. The last values before close() are still accessible.
@@ -170,9 +195,15 @@ namespace ts {
             cn::microseconds time_offset {0};  // Offset to add to all time stamps.
         };
 
+        // Size of the I/O buffer for named files. Capture files are read
+        // sequentially in many small chunks (block headers, packet data),
+        // the underlying stream fetches large blocks from the filesystem.
+        static constexpr size_t FILE_BUFFER_SIZE = 1024 * 1024;
+
         bool             _error = false;          // Error was set, may be logical error, not a file error.
         std::istream*    _in = nullptr;           // Point to actual input stream.
         std::ifstream    _file {};                // Input file (when it is a named file).
+        std::vector<char> _io_buffer {};          // Stream buffer for _file.
         UString          _name {};                // Saved file name for messages.
         bool             _be = false;             // The file use a big-endian representation.
         bool             _ng = false;             // Pcapng format (not pcap).
@@ -214,6 +245,11 @@ namespace ts {
         // Return only the block body.
         bool readNgBlockBody(uint32_t block_type, ByteBlock& body, Report& report);
 
+        // Convert a raw pcap-ng packet timestamp into microseconds, based on the interface
+        // time units. Return -1 if the interface is unknown. The interface time offset is
+        // not added, this is the responsibility of the caller.
+        cn::microseconds ngTimestamp(size_t if_index, uint32_t high, uint32_t low) const;
+
         // Read 32 or 16 bits using the endianness.
         uint16_t get16(const void* addr) const { return _be ? GetUInt16BE(addr) : GetUInt16LE(addr); }
         uint32_t get32(const void* addr) const { return _be ? GetUInt32BE(addr) : GetUInt32LE(addr); }
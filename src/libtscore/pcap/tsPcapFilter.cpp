@@ -16,6 +16,14 @@
 
 void ts::PcapFilter::defineArgs(Args& args)
 {
+    args.option(u"fast-seek");
+    args.help(u"fast-seek",
+         u"With --first-timestamp or --first-date, directly seek to the first packet in the time range "
+         u"instead of reading and discarding all previous packets. "
+         u"Extracting a short time window from a very large capture file is much faster this way. "
+         u"This is possible on regular files only, not on the standard input. "
+         u"The skipped packets are not counted in the IP packets statistics.");
+
     args.option(u"first-packet", 0, Args::POSITIVE);
     args.help(u"first-packet",
          u"Filter packets starting at the specified number. "
@@ -91,6 +99,7 @@ bool ts::PcapFilter::loadArgs(Args& args)
     args.getChronoValue(_opt_last_time_offset, u"last-timestamp", cn::microseconds::max());
     _opt_first_time = getDate(args, u"first-date", cn::microseconds::zero());
     _opt_last_time = getDate(args, u"last-date", cn::microseconds::max());
+    _opt_fast_seek = args.present(u"fast-seek");
 
     std::vector<uint32_t> ids;
     args.getIntValues(ids, u"vlan-id");
@@ -202,6 +211,7 @@ bool ts::PcapFilter::open(const fs::path& filename, Report& report)
         _last_time_offset = _opt_last_time_offset;
         _first_time = _opt_first_time;
         _last_time = _opt_last_time;
+        _fast_seek = _opt_fast_seek;
     }
     return ok;
 }
@@ -213,6 +223,26 @@ bool ts::PcapFilter::open(const fs::path& filename, Report& report)
 
 bool ts::PcapFilter::readIP(IPPacket& packet, VLANIdStack& vlans, cn::microseconds& timestamp, Report& report)
 {
+    // On the first read, optionally seek to the beginning of the filtered time range,
+    // skipping all previous packets without reading their data.
+    if (_fast_seek) {
+        _fast_seek = false; // at most once per open
+        cn::microseconds target = _first_time;
+        if (_first_time_offset > cn::microseconds::zero()) {
+            // The time offset filter is relative to the first packet of the file.
+            // Locate the first packet to get its timestamp, without reading it.
+            if (!PcapFile::seekTime(cn::microseconds::zero(), report)) {
+                return false;
+            }
+            if (firstTimestamp() >= cn::microseconds::zero()) {
+                target = std::max(target, firstTimestamp() + _first_time_offset);
+            }
+        }
+        if (target > cn::microseconds::zero() && !PcapFile::seekTime(target, report)) {
+            return false;
+        }
+    }
+
     // Read packets until one which matches all filters.
     for (;;) {
         // Invoke superclass to read next packet.
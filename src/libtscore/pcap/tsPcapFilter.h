@@ -22,7 +22,8 @@ namespace ts {
     //! Read a pcap or pcapng file with packet filtering.
     //!
     //! This class also sets filtering options from the command line:
-    //! @c -\-first-packet, @c -\-first-timestamp, @c -\-first-date, @c -\-last-packet, @c -\-last-timestamp, @c -\-last-date.
+    //! @c -\-first-packet, @c -\-first-timestamp, @c -\-first-date, @c -\-last-packet,
+    //! @c -\-last-timestamp, @c -\-last-date, @c -\-fast-seek.
     //!
     //! @ingroup libtscore net
     //!
@@ -79,6 +80,17 @@ namespace ts {
         //!
         void setLastTimestamp(cn::microseconds time) { _last_time = time; }
 
+        //!
+        //! Start reading with a fast seek to the beginning of the filtered time range.
+        //! When a first timestamp or time offset filter is set, directly seek to the first
+        //! packet in the time range instead of reading and discarding all previous packets.
+        //! This is possible on seekable files only and the skipped packets are not counted
+        //! in the IP packets statistics.
+        //! @param [in] on If true, seek to the first packet in the time range.
+        //! @see PcapFile::seekTime()
+        //!
+        void setFastSeek(bool on) { _fast_seek = on; }
+
         //!
         //! Filter TCP packets only.
         //!
@@ -224,6 +236,7 @@ namespace ts {
         IPSocketAddress   _destination {};
         bool              _bidirectional_filter = false;
         bool              _wildcard_filter = true;
+        bool              _fast_seek = false;
         int               _display_addresses_severity = Severity::Debug;
         size_t            _first_packet = 0;
         size_t            _last_packet = std::numeric_limits<size_t>::max();
@@ -237,6 +250,7 @@ namespace ts {
         cn::microseconds  _opt_last_time_offset = cn::microseconds::max();
         cn::microseconds  _opt_first_time = cn::microseconds::zero();
         cn::microseconds  _opt_last_time = cn::microseconds::max();
+        bool              _opt_fast_seek = false;
         VLANIdStack       _opt_vlans {};
 
         // Get a date option and return it as micro-seconds since Unix epoch.
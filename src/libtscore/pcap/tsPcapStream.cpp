@@ -116,7 +116,17 @@ void ts::PcapStream::Stream::store(const IPPacket& pkt, cn::microseconds tstamp)
     }
 
     // Find the right location in the queue.
+    // Fast path first: packets arriving in sequence order are appended at the end of
+    // the queue. Checking the last queued block avoids a linear scan of the queue,
+    // which made the reassembly quadratic on long captures when one direction of the
+    // session is stored much faster than it is read.
     auto it = packets.begin();
+    if (!packets.empty()) {
+        const DataBlock& last(*packets.back());
+        if (!last.data.empty() && ptr->sequence >= last.sequence + last.data.size()) {
+            it = packets.end();
+        }
+    }
     while (it != packets.end()) {
         DataBlock& db(**it);
         if (ptr->sequence == db.sequence) {
@@ -254,17 +264,13 @@ bool ts::PcapStream::readStreams(size_t& source, Report& report)
 
 
 //----------------------------------------------------------------------------
-// Read data from the TCP session, any direction.
+// Select the stream to read from, waiting for data if necessary.
 //----------------------------------------------------------------------------
 
-bool ts::PcapStream::readTCP(IPSocketAddress& source, ByteBlock& data, size_t& size, cn::microseconds& timestamp, Report& report)
+bool ts::PcapStream::selectStream(IPSocketAddress& source, size_t& peer_number, Report& report)
 {
-    size_t remain = size;
-    size = 0;
-    timestamp = cn::microseconds(-1);
-
     // Check the direction of the requested stream.
-    size_t peer_number = NPOS;
+    peer_number = NPOS;
     if (!indexOf(source, true, peer_number, report)) {
         return false;
     }
@@ -298,6 +304,25 @@ bool ts::PcapStream::readTCP(IPSocketAddress& source, ByteBlock& data, size_t& s
     // Update source with full address, if was not or partially specified.
     assert(peer_number == ISRC || peer_number == IDST);
     source = peer_number == ISRC ? sourceFilter() : destinationFilter();
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Read data from the TCP session, any direction.
+//----------------------------------------------------------------------------
+
+bool ts::PcapStream::readTCP(IPSocketAddress& source, ByteBlock& data, size_t& size, cn::microseconds& timestamp, Report& report)
+{
+    size_t remain = size;
+    size = 0;
+    timestamp = cn::microseconds(-1);
+
+    // Select the stream to read from.
+    size_t peer_number = NPOS;
+    if (!selectStream(source, peer_number, report)) {
+        return false;
+    }
 
     // Read data from the selected stream.
     Stream& stream(_streams[peer_number]);
@@ -340,6 +365,53 @@ bool ts::PcapStream::readTCP(IPSocketAddress& source, ByteBlock& data, size_t& s
 }
 
 
+//----------------------------------------------------------------------------
+// Read the next contiguous chunk of data from the TCP session.
+//----------------------------------------------------------------------------
+
+bool ts::PcapStream::readTCPSegment(IPSocketAddress& source, ByteBlock& data, size_t& size, cn::microseconds& timestamp, Report& report)
+{
+    size = 0;
+    timestamp = cn::microseconds(-1);
+
+    // Select the stream to read from.
+    size_t peer_number = NPOS;
+    if (!selectStream(source, peer_number, report)) {
+        return false;
+    }
+
+    // Wait until data are available in the selected stream.
+    Stream& stream(_streams[peer_number]);
+    while (!stream.dataAvailable()) {
+        if (stream.packets.size() > TCP_MAX_FUTURE) {
+            report.error(u"missing TCP segment, too many future out-of-sequence segments");
+            return false;
+        }
+        if (!readStreams(peer_number, report)) {
+            return false;
+        }
+    }
+    assert(!stream.packets.empty());
+
+    // Return all remaining data from the current segment in one chunk.
+    auto first = stream.packets.front();
+    size = first->data.size() - first->index;
+    data.append(&first->data[first->index], size);
+    first->index = first->data.size();
+    timestamp = first->timestamp;
+
+    // Drop the first packet if adjacent to the second.
+    if (!first->end) {
+        auto second = stream.packets.begin();
+        ++second;
+        if (second != stream.packets.end() && (*second)->sequence == first->sequence + first->data.size()) {
+            stream.packets.pop_front();
+        }
+    }
+    return true;
+}
+
+
 //----------------------------------------------------------------------------
 // Skip the end of the current TCP session and prepare for next session.
 //----------------------------------------------------------------------------
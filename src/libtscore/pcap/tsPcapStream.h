@@ -89,6 +89,27 @@ namespace ts {
         //!
         bool readTCP(IPSocketAddress& source, ByteBlock& data, size_t& size, cn::microseconds& timestamp, Report& report);
 
+        //!
+        //! Read the next contiguous chunk of data from the TCP session, either in one specific direction or any direction.
+        //!
+        //! This is a bulk variant of readTCP(). Instead of reading an exact number of bytes, it returns
+        //! all remaining data from the TCP segment at the current read position, in one single operation,
+        //! without mixing data from the two directions. Since direction alternation can only occur on
+        //! segment boundaries, reading segment by segment preserves the alternation of the directions
+        //! in the session, without the overhead of reading byte by byte.
+        //!
+        //! @param [in,out] source Source address of the TCP stream to extract data from. If, on input,
+        //! the value is unset (no address, no port), then data from any direction are read. On output,
+        //! @a source contains the address of the peer from which data were read.
+        //! @param [in,out] data Byte block into which data is read. The byte block is not
+        //! reinitialized, input data are appended to it.
+        //! @param [out] size Actual number of read bytes.
+        //! @param [out] timestamp Capture timestamp in microseconds since Unix epoch or -1 if none is available.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error or end of file.
+        //!
+        bool readTCPSegment(IPSocketAddress& source, ByteBlock& data, size_t& size, cn::microseconds& timestamp, Report& report);
+
         //!
         //! Check if the next data to read is at start of TCP session.
         //! @param [in,out] report Where to report errors.
@@ -190,6 +211,10 @@ namespace ts {
         // Index must be either ISRC, IDST or NPOS (any direction). Updated with actual index.
         bool readStreams(size_t& index, Report& report);
 
+        // Select the stream to read from, waiting for data if the direction is unspecified.
+        // On output, peer_number is either ISRC or IDST and source is the full peer address.
+        bool selectStream(IPSocketAddress& source, size_t& peer_number, Report& report);
+
         // Get index for source address. Report an error and return false if incorrect.
         bool indexOf(const IPSocketAddress& source, bool allow_unspecified, size_t& index, Report& report) const;
 
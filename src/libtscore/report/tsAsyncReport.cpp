@@ -75,9 +75,23 @@ void ts::AsyncReport::writeLog(int severity, const UString &msg)
             // Synchronous mode, wait infinitely until the message is queued.
             _log_queue.enqueue(p);
         }
-        else {
+        else if (!_log_queue.enqueue(p, cn::milliseconds::zero())) {
             // Enqueue the message immediately (timeout = 0), drop message on overflow.
-            _log_queue.enqueue(p, cn::milliseconds::zero());
+            // Do not block the reporting thread, count the dropped message instead.
+            _dropped_pending.fetch_add(1, std::memory_order_relaxed);
+            _dropped_total.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            // The message was enqueued. If some messages were previously dropped,
+            // now is a good time to report them since there is room in the queue again.
+            const size_t dropped = _dropped_pending.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0) {
+                LogMessage* d = new LogMessage {false, Severity::Warning, UString::Format(u"%'d log messages dropped (queue overflow)", dropped)};
+                if (!_log_queue.enqueue(d, cn::milliseconds::zero())) {
+                    // Still no room for the warning, keep the count for later.
+                    _dropped_pending.fetch_add(dropped, std::memory_order_relaxed);
+                }
+            }
         }
     }
 }
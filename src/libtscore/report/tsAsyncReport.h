@@ -78,6 +78,15 @@ namespace ts {
         //!
         bool getSynchronous() const { return _synchronous; }
 
+        //!
+        //! Get the number of dropped messages.
+        //! In asynchronous mode, when the message queue is full, new messages are
+        //! dropped instead of blocking the reporting thread. A warning is logged
+        //! when space becomes available again and this cumulative counter is updated.
+        //! @return The total number of dropped messages since the creation of this object.
+        //!
+        size_t droppedMessageCount() const { return _dropped_total.load(std::memory_order_relaxed); }
+
         //!
         //! Synchronously terminate the report thread.
         //! Automatically performed in destructor.
@@ -127,5 +136,7 @@ namespace ts {
         volatile bool   _time_stamp = false;
         volatile bool   _synchronous = false;
         volatile bool   _terminated = false;
+        std::atomic<size_t> _dropped_pending {0};  // Dropped messages, not yet reported in the log.
+        std::atomic<size_t> _dropped_total {0};    // Total dropped messages since creation.
     };
 }
@@ -0,0 +1,213 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsMetricsServer.h"
+#include "tsRestServer.h"
+#include "tsReportBuffer.h"
+#include "tsNullReport.h"
+
+
+//----------------------------------------------------------------------------
+// Interface destructor.
+//----------------------------------------------------------------------------
+
+ts::MetricsProviderInterface::~MetricsProviderInterface()
+{
+}
+
+
+//----------------------------------------------------------------------------
+// Constructor and destructor.
+//----------------------------------------------------------------------------
+
+ts::MetricsServer::MetricsServer(const RestArgs& args, MetricsProviderInterface& provider, Report& report) :
+    _report(report),
+    _args(args),
+    _provider(provider)
+{
+}
+
+ts::MetricsServer::~MetricsServer()
+{
+    // Terminate the thread and wait for actual thread termination.
+    close();
+    waitForTermination();
+}
+
+
+//----------------------------------------------------------------------------
+// Open the server and start the server thread.
+//----------------------------------------------------------------------------
+
+bool ts::MetricsServer::open()
+{
+    if (!_args.server_addr.hasPort()) {
+        // No metrics server, do nothing.
+        return true;
+    }
+    else if (_is_open) {
+        _report.error(u"metrics server already started");
+        return false;
+    }
+
+    // Open either a TLS or a plain TCP server.
+    // The server accepts and processes one client at a time, be generous with the backlog.
+    TCPServer& server(_args.use_tls ? static_cast<TCPServer&>(_tls_server) : _tcp_server);
+    if (!server.open(_args.server_addr.generation(), _report) ||
+        !server.reusePort(_args.reuse_port, _report) ||
+        !server.bind(_args.server_addr, _report) ||
+        !server.listen(16, _report))
+    {
+        server.close(NULLREP);
+        return false;
+    }
+    if (_args.use_tls) {
+        // Do not request client certificate (this is the default anyway).
+        _tls_client.setVerifyPeer(false);
+    }
+
+    // Start the thread.
+    _is_open = true;
+    return start();
+}
+
+
+//----------------------------------------------------------------------------
+// Stop and close the server.
+//----------------------------------------------------------------------------
+
+void ts::MetricsServer::close()
+{
+    if (_is_open) {
+        // Close the server. This will force the server thread to terminate.
+        _terminate = true;
+        if (_args.use_tls) {
+            _tls_client.close(NULLREP);
+            _tls_server.close(NULLREP);
+        }
+        else {
+            _tcp_server.close(NULLREP);
+        }
+        // Wait for the termination of the thread.
+        waitForTermination();
+        _is_open = false;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Invoked in the context of the server thread.
+//----------------------------------------------------------------------------
+
+void ts::MetricsServer::main()
+{
+    _report.debug(u"metrics server thread started");
+
+    // Get accept errors in a buffer since some errors are normal at termination.
+    ReportBuffer<ThreadSafety::None> error(_report.maxSeverity());
+
+    // Loop on incoming clients, serve one request at a time.
+    while (!_terminate) {
+        IPSocketAddress client_addr;
+        if (_args.use_tls) {
+            // Do not terminate on accept() failure, this may be a client which fails the TLS handshake.
+            if (_tls_server.accept(_tls_client, client_addr, error)) {
+                if (_args.isAllowed(client_addr)) {
+                    serveOne(_tls_client);
+                }
+                _tls_client.close(NULLREP);
+            }
+        }
+        else {
+            TCPConnection client;
+            if (!_tcp_server.accept(client, client_addr, error)) {
+                break;
+            }
+            if (_args.isAllowed(client_addr)) {
+                serveOne(client);
+            }
+            client.close(NULLREP);
+        }
+    }
+
+    // If termination was requested, accept error is not an error.
+    if (!_terminate && !error.empty()) {
+        _report.info(error.messages());
+    }
+    _report.debug(u"metrics server thread completed");
+}
+
+
+//----------------------------------------------------------------------------
+// Serve one client request on a connected client.
+//----------------------------------------------------------------------------
+
+void ts::MetricsServer::serveOne(TCPConnection& conn)
+{
+    // Receive the request. In case of error, getRequest() closes the connection.
+    RestServer rest(_args, _report);
+    if (rest.getRequest(conn)) {
+        if (rest.method() != u"GET" || (rest.path() != u"/" && rest.path() != u"/metrics")) {
+            rest.setResponse(u"Not found\n");
+            rest.sendResponse(conn, 404, true);
+        }
+        else {
+            // Build a snapshot of the application metrics.
+            json::Object root;
+            _provider.provideMetrics(root);
+            if (rest.parameter(u"format", u"json") == u"prometheus") {
+                UString text;
+                ToPrometheus(root, UString(), text);
+                rest.setResponse(text, u"text/plain; version=0.0.4; charset=utf-8");
+            }
+            else {
+                rest.setResponse(root);
+            }
+            rest.sendResponse(conn, 200, true);
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Flatten a JSON value into Prometheus text exposition format.
+//----------------------------------------------------------------------------
+
+void ts::MetricsServer::ToPrometheus(const json::Value& value, const UString& prefix, UString& text)
+{
+    if (value.isObject()) {
+        UStringList names;
+        value.getNames(names);
+        for (const auto& name : names) {
+            // Sanitize the field name into a Prometheus metric name component.
+            UString component(name);
+            for (auto& c : component) {
+                if (!((c >= u'a' && c <= u'z') || (c >= u'A' && c <= u'Z') || (c >= u'0' && c <= u'9'))) {
+                    c = u'_';
+                }
+            }
+            ToPrometheus(value.value(name), prefix.empty() ? component : prefix + u"_" + component, text);
+        }
+    }
+    else if (value.isArray()) {
+        for (size_t i = 0; i < value.size(); ++i) {
+            ToPrometheus(value.at(i), UString::Format(u"%s_%d", prefix, i), text);
+        }
+    }
+    else if (value.isInteger()) {
+        text.format(u"%s %d\n", prefix, value.toInteger());
+    }
+    else if (value.isNumber()) {
+        text.format(u"%s %f\n", prefix, value.toFloat());
+    }
+    else if (value.isTrue() || value.isFalse()) {
+        // Booleans are exposed as 0 / 1.
+        text.format(u"%s %d\n", prefix, value.isTrue() ? 1 : 0);
+    }
+    // Strings are not representable as Prometheus values and are skipped.
+}
@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  HTTP server exposing application metrics to monitoring systems.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsRestArgs.h"
+#include "tsTCPServer.h"
+#include "tsTLSServer.h"
+#include "tsTLSConnection.h"
+#include "tsThread.h"
+#include "tsjsonObject.h"
+
+namespace ts {
+    //!
+    //! Interface which is implemented by applications exposing internal metrics.
+    //! @ingroup libtscore app
+    //!
+    class TSCOREDLL MetricsProviderInterface
+    {
+        TS_INTERFACE(MetricsProviderInterface);
+    public:
+        //!
+        //! Build a snapshot of the application metrics.
+        //! This method is invoked in the context of the metrics server thread,
+        //! for each received request. It must only read data which can be safely
+        //! accessed from another thread without disturbing the application.
+        //! @param [in,out] root JSON object to fill with metrics values.
+        //!
+        virtual void provideMetrics(json::Object& root) = 0;
+    };
+
+    //!
+    //! HTTP server exposing application metrics to monitoring systems.
+    //!
+    //! The server responds to GET requests on path "/" or "/metrics".
+    //! By default, the metrics snapshot is returned as a JSON object.
+    //! With the query parameter "format=prometheus", the snapshot is flattened
+    //! into the Prometheus text exposition format: the path of each numeric
+    //! field in the JSON structure becomes the metric name.
+    //!
+    //! The server serves one client at a time in its own thread and never
+    //! interacts with the application threads, except through the metrics
+    //! provider interface.
+    //!
+    //! @ingroup libtscore app
+    //!
+    class TSCOREDLL MetricsServer: private Thread
+    {
+        TS_NOBUILD_NOCOPY(MetricsServer);
+    public:
+        //!
+        //! Constructor.
+        //! @param [in] args Server address and options. This instance will keep a copy of it.
+        //! @param [in,out] provider Application metrics provider.
+        //! @param [in,out] report Where to report errors. This instance will keep a reference to it.
+        //!
+        MetricsServer(const RestArgs& args, MetricsProviderInterface& provider, Report& report);
+
+        //!
+        //! Destructor.
+        //!
+        virtual ~MetricsServer() override;
+
+        //!
+        //! Open the server and start the server thread.
+        //! Do nothing and return true when no server address was specified in the arguments.
+        //! @return True on success, false on error.
+        //!
+        bool open();
+
+        //!
+        //! Stop and close the server.
+        //!
+        void close();
+
+    private:
+        Report&       _report;
+        const RestArgs _args;
+        MetricsProviderInterface& _provider;
+        volatile bool _terminate = false;
+        bool          _is_open = false;
+        TLSServer     _tls_server {_args};
+        TLSConnection _tls_client {_args};
+        TCPServer     _tcp_server {};
+
+        // Implementation of Thread.
+        virtual void main() override;
+
+        // Serve one client request on a connected client.
+        void serveOne(TCPConnection& conn);
+
+        // Flatten a JSON value into Prometheus text exposition format.
+        static void ToPrometheus(const json::Value& value, const UString& prefix, UString& text);
+    };
+}
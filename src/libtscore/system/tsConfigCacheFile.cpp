@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsConfigCacheFile.h"
+#include "tsFileUtils.h"
+#include "tsMemory.h"
+
+
+//----------------------------------------------------------------------------
+// Constructor.
+//----------------------------------------------------------------------------
+
+ts::ConfigCacheFile::ConfigCacheFile(const UString& magic, uint32_t version)
+{
+    _header.appendUTF8(magic);
+    _header.appendUInt32(version);
+}
+
+
+//----------------------------------------------------------------------------
+// Load the cached binary data for a source file.
+//----------------------------------------------------------------------------
+
+bool ts::ConfigCacheFile::load(ByteBlock& data, const UString& source_file, Report& report)
+{
+    data.clear();
+    const UString cache_file(CacheName(source_file));
+
+    // The cache must exist and be at least as recent as the source file.
+    // Accept identical times because of the one-second granularity of file
+    // modification times on some file systems.
+    const Time source_time(GetFileModificationTimeUTC(source_file));
+    const Time cache_time(GetFileModificationTimeUTC(cache_file));
+    if (source_time == Time::Epoch || cache_time == Time::Epoch || cache_time < source_time) {
+        return false;
+    }
+
+    // Load the complete cache file. Errors are not reported, the cache is simply ignored.
+    ByteBlock raw;
+    if (!raw.loadFromFile(cache_file)) {
+        return false;
+    }
+
+    // Check the magic string and format version.
+    if (raw.size() < _header.size() || !MemEqual(raw.data(), _header.data(), _header.size())) {
+        report.debug(u"obsolete or invalid binary cache %s, ignoring it", cache_file);
+        return false;
+    }
+
+    report.debug(u"loading binary cache %s", cache_file);
+    data.copy(raw.data() + _header.size(), raw.size() - _header.size());
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Save binary data in the cache for a source file.
+//----------------------------------------------------------------------------
+
+void ts::ConfigCacheFile::save(const ByteBlock& data, const UString& source_file, Report& report)
+{
+    const UString cache_file(CacheName(source_file));
+    ByteBlock raw(_header);
+    raw.append(data);
+    if (raw.saveToFile(cache_file)) {
+        report.debug(u"saved binary cache %s", cache_file);
+    }
+    else {
+        // Typically a read-only directory, the cache is simply not maintained.
+        report.debug(u"cannot write binary cache %s", cache_file);
+    }
+}
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Binary cache of a parsed configuration file.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsByteBlock.h"
+#include "tsReport.h"
+
+namespace ts {
+    //!
+    //! Binary cache of a parsed configuration file.
+    //! @ingroup libtscore system
+    //!
+    //! Some configuration files, such as XML channel databases, can be large and
+    //! parsing them at startup of every command is slow. A ConfigCacheFile maintains
+    //! a binary serialized version of the parsed content, next to the source file,
+    //! with a @c .bin suffix. The cache is used only when it is at least as recent as
+    //! the source file and starts with the expected magic string and format version.
+    //!
+    //! A missing, obsolete or invalid cache is never an error, the source file is
+    //! simply reparsed. Similarly, failing to write the cache, typically when the
+    //! source file is in a system directory, is not an error, the cache is simply
+    //! not maintained.
+    //!
+    class TSCOREDLL ConfigCacheFile
+    {
+    public:
+        //!
+        //! Constructor.
+        //! @param [in] magic A short string identifying the type of cached data.
+        //! @param [in] version Version of the serialization format. Must be incremented
+        //! each time the format changes, making all previous caches obsolete.
+        //!
+        ConfigCacheFile(const UString& magic, uint32_t version);
+
+        //!
+        //! Get the name of the cache file for a given source file.
+        //! @param [in] source_file Name of the source configuration file.
+        //! @return The name of the corresponding cache file.
+        //!
+        static UString CacheName(const UString& source_file) { return source_file + u".bin"; }
+
+        //!
+        //! Load the cached binary data for a source file.
+        //! @param [out] data Returned serialized data, without the cache header.
+        //! @param [in] source_file Name of the source configuration file.
+        //! @param [in,out] report Where to report debug messages.
+        //! @return True if an up-to-date cache was loaded. False otherwise, in which
+        //! case the caller shall parse the source file. This is not an error.
+        //!
+        bool load(ByteBlock& data, const UString& source_file, Report& report);
+
+        //!
+        //! Save binary data in the cache for a source file.
+        //! Failing to write the cache file is not an error, only a debug message.
+        //! @param [in] data Serialized data to save, without the cache header.
+        //! @param [in] source_file Name of the source configuration file.
+        //! @param [in,out] report Where to report debug messages.
+        //!
+        void save(const ByteBlock& data, const UString& source_file, Report& report);
+
+    private:
+        ByteBlock _header {};  // Magic string and format version, as stored at the beginning of the cache file.
+    };
+}
@@ -76,6 +76,7 @@ bool ts::ForkPipe::open(const UString& command, WaitMode wait_mode, size_t buffe
     }
 
     // Characterize the use of the pipe.
+    _exit_code = -1;
     _in_pipe = in_mode == STDIN_PIPE;
     _out_pipe = out_mode == STDOUT_PIPE || out_mode == STDOUTERR_PIPE;
     _use_pipe = _in_pipe || _out_pipe;
@@ -278,6 +279,16 @@ bool ts::ForkPipe::open(const UString& command, WaitMode wait_mode, size_t buffe
         return false;
     }
 
+#if defined(TS_LINUX) && defined(F_SETPIPE_SZ)
+    // On Linux, enlarge the pipe buffer when requested. This is best effort: the kernel
+    // rounds the size up to a power of two and unprivileged processes are bounded by
+    // /proc/sys/fs/pipe-max-size. A larger buffer smooths the data flow when one side
+    // of the pipe works in bursts.
+    if (_use_pipe && buffer_size > 0 && ::fcntl(filedes[PIPE_WRITEFD], F_SETPIPE_SZ, int(buffer_size)) < 0) {
+        report.debug(u"cannot set pipe buffer size to %d bytes: %s", buffer_size, SysErrorCodeMessage());
+    }
+#endif
+
     // Create the forked process
     if (_wait_mode == EXIT_PROCESS) {
         // Don't fork, the parent process will directly call exec().
@@ -478,9 +489,17 @@ bool ts::ForkPipe::close(Report& report)
     }
 
     // Wait for termination of child process
-    if (_wait_mode == SYNCHRONOUS && ::WaitForSingleObject(_process, INFINITE) != WAIT_OBJECT_0) {
-        report.error(u"error waiting for process termination: %s", SysErrorCodeMessage());
-        result = false;
+    if (_wait_mode == SYNCHRONOUS) {
+        if (::WaitForSingleObject(_process, INFINITE) != WAIT_OBJECT_0) {
+            report.error(u"error waiting for process termination: %s", SysErrorCodeMessage());
+            result = false;
+        }
+        else {
+            ::DWORD code = 0;
+            if (::GetExitCodeProcess(_process, &code)) {
+                _exit_code = int(code);
+            }
+        }
     }
 
     if (_process != INVALID_HANDLE_VALUE) {
@@ -498,10 +517,14 @@ bool ts::ForkPipe::close(Report& report)
     // Wait for termination of forked process
     if (_wait_mode == SYNCHRONOUS) {
         assert(_fpid != 0);
-        if (::waitpid(_fpid, nullptr, 0) < 0) {
+        int status = 0;
+        if (::waitpid(_fpid, &status, 0) < 0) {
             report.error(u"error waiting for process termination: %s", SysErrorCodeMessage());
             result = false;
         }
+        else if (WIFEXITED(status)) {
+            _exit_code = WEXITSTATUS(status);
+        }
     }
 
 #endif
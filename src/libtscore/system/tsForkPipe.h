@@ -80,7 +80,7 @@ namespace ts {
         //! Create the process, open the optional pipe.
         //! @param [in] command The command to execute.
         //! @param [in] wait_mode How to wait for process termination in close().
-        //! @param [in] buffer_size The pipe buffer size in bytes. Used on Windows only. Zero means default.
+        //! @param [in] buffer_size The pipe buffer size in bytes. Used on Windows and Linux only. Zero means default.
         //! @param [in,out] report Where to report errors.
         //! @param [in] out_mode How to handle stdout and stderr.
         //! @param [in] in_mode How to handle stdin. Use the pipe by default.
@@ -107,6 +107,17 @@ namespace ts {
             return _is_open;
         }
 
+        //!
+        //! Get the exit code of the created process.
+        //! @return The exit code of the created process, after a close() in SYNCHRONOUS
+        //! wait mode. Return -1 when the exit code is unknown, for instance when the
+        //! process is not yet terminated or was terminated by a signal.
+        //!
+        int exitCode() const
+        {
+            return _exit_code;
+        }
+
         //!
         //! Check if the pipe was broken.
         //! @return True if was broken (unexpected process termination for instance).
@@ -190,6 +201,7 @@ namespace ts {
         bool          _out_pipe = false;         // The process uses an output pipe.
         bool          _use_pipe = false;         // The process uses a pipe, somehow.
         bool          _ignore_abort = false;     // Ignore early termination of child process.
+        int           _exit_code = -1;           // Exit code of the child process, -1 when unknown.
         volatile bool _broken_pipe = false;      // Pipe is broken, do not attempt to write.
         volatile bool _eof = false;              // Got end of file on input pipe.
 #if defined(TS_WINDOWS)
@@ -291,12 +291,25 @@ ts::SysInfo::SysInfo() :
     //
     if (GetEnvironment(u"TS_NO_HARDWARE_ACCELERATION").empty()) {
         if (GetEnvironment(u"TS_NO_CRC32_INSTRUCTIONS").empty()) {
-            #if defined(TS_LINUX) && defined(HWCAP_CRC32)
+            #if (defined(TS_X86_64) || defined(TS_I386)) && (defined(TS_GCC) || defined(TS_LLVM))
+                // On x86, the CRC32 acceleration uses the carryless multiplication instructions.
+                _crcInstructions = tsCRC32IsAccelerated && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+            #elif defined(TS_LINUX) && defined(HWCAP_CRC32)
                 _crcInstructions = tsCRC32IsAccelerated && (::getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
             #elif defined(TS_MAC)
                 _crcInstructions = tsCRC32IsAccelerated && SysCtrlBool("hw.optional.armv8_crc32");
             #endif
         }
+        if (GetEnvironment(u"TS_NO_SHA256_INSTRUCTIONS").empty()) {
+            #if (defined(TS_X86_64) || defined(TS_I386)) && (defined(TS_GCC) || defined(TS_LLVM))
+                // On x86, the SHA-256 acceleration uses the SHA-NI instructions.
+                _sha256Instructions = tsSHA256IsAccelerated && __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+            #elif defined(TS_LINUX) && defined(HWCAP_SHA2)
+                _sha256Instructions = tsSHA256IsAccelerated && (::getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+            #elif defined(TS_MAC)
+                _sha256Instructions = tsSHA256IsAccelerated && SysCtrlBool("hw.optional.arm.FEAT_SHA256");
+            #endif
+        }
     }
 }
 
@@ -337,7 +350,7 @@ TS_REGISTER_FEATURE(u"acceleration", u"Acceleration", ts::Features::ALWAYS, ts::
 
 ts::UString ts::SysInfo::GetAccelerations()
 {
-    return UString::Format(u"CRC32: %s", UString::YesNo(Instance().crcInstructions()));
+    return UString::Format(u"CRC32: %s, SHA-256: %s", UString::YesNo(Instance().crcInstructions()), UString::YesNo(Instance().sha256Instructions()));
 }
 
 
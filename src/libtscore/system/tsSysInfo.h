@@ -90,6 +90,11 @@ namespace ts {
         //!
         bool crcInstructions() const { return _crcInstructions; }
         //!
+        //! Check if the CPU supports accelerated instructions for SHA-256 computation.
+        //! @return True if the CPU supports SHA-256 instructions.
+        //!
+        bool sha256Instructions() const { return _sha256Instructions; }
+        //!
         //! Get the operating system version.
         //! @return The operating system version.
         //!
@@ -145,6 +150,7 @@ namespace ts {
         SysOS     _osFamily;
         SysFlavor _osFlavor = UNKNOWN;
         bool      _crcInstructions = false;
+        bool      _sha256Instructions = false;
         int       _systemMajorVersion = -1;
         UString   _systemVersion {};
         UString   _systemName {};
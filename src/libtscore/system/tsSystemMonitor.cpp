@@ -13,9 +13,18 @@
 #include "tsSysUtils.h"
 #include "tsTime.h"
 
+#if defined(TS_LINUX)
+    #include "tsBeforeStandardHeaders.h"
+    #include <dirent.h>
+    #include "tsAfterStandardHeaders.h"
+#endif
+
 // Stack size for the monitor thread
 #define MONITOR_STACK_SIZE (64 * 1024)
 
+// Maximum number of busiest threads in a monitoring message
+#define MONITOR_MAX_THREADS 3
+
 
 //----------------------------------------------------------------------------
 // Constructors and destructors.
@@ -35,6 +44,21 @@ ts::SystemMonitor::~SystemMonitor()
 }
 
 
+//----------------------------------------------------------------------------
+// Optional reporting features, must be set before start().
+//----------------------------------------------------------------------------
+
+void ts::SystemMonitor::declareMemoryRegion(const UString& name, size_t size)
+{
+    _regions.push_back(std::make_pair(name, size));
+}
+
+void ts::SystemMonitor::setJsonFile(const fs::path& filename)
+{
+    _json_file = filename;
+}
+
+
 //----------------------------------------------------------------------------
 // Prefix strings for all monitor messages (for filtering purpose)
 //----------------------------------------------------------------------------
@@ -87,6 +111,14 @@ void ts::SystemMonitor::main()
     const cn::milliseconds start_cpu_time = GetProcessCpuTime();
     const size_t start_vmem_size = GetProcessVirtualSize();
 
+#if defined(TS_LINUX)
+    // Prime the per-thread CPU accounting so that the first interval reports deltas.
+    {
+        std::vector<ThreadSample> ignored;
+        scanThreads(cn::milliseconds::zero(), ignored);
+    }
+#endif
+
     // Time and metrics at the last interval.
     Time last_time(start_time);
     cn::milliseconds last_cpu_time = start_cpu_time;
@@ -139,6 +171,18 @@ void ts::SystemMonitor::main()
 
         // Format virtual memory size status.
         message.format(u"VM: %s", UString::HumanSize(vmem_size));
+
+        // Attribute declared memory regions (e.g. the application packet buffer).
+        if (!_regions.empty()) {
+            size_t declared = 0;
+            UString detail;
+            for (const auto& reg : _regions) {
+                detail.format(u"%s: %s, ", reg.first, UString::HumanSize(reg.second));
+                declared += reg.second;
+            }
+            message.format(u" (%sother: %s)", detail, UString::HumanSize(vmem_size > declared ? vmem_size - declared : 0));
+        }
+
         if (vmem_size != last_vmem_size) {
             // Virtual memory has changed
             message.format(u" (%s)", UString::HumanSize(ptrdiff_t(vmem_size) - ptrdiff_t(last_vmem_size), u"B", true));
@@ -156,6 +200,19 @@ void ts::SystemMonitor::main()
         message += UString::Percentage(cpu_time - start_cpu_time, current_time - start_time);
         message += u")";
 
+        // Per-thread CPU usage (Linux only). Report the busiest threads to
+        // locate which part of the pipeline is saturating.
+        std::vector<ThreadSample> threads;
+#if defined(TS_LINUX)
+        scanThreads(cn::duration_cast<cn::milliseconds>(current_time - last_time), threads);
+        std::sort(threads.begin(), threads.end(), [](const ThreadSample& t1, const ThreadSample& t2) { return t1.cpu_percent > t2.cpu_percent; });
+        UString thread_msg;
+        for (size_t i = 0; i < threads.size() && i < MONITOR_MAX_THREADS && threads[i].cpu_percent > 0; ++i) {
+            thread_msg.format(u"%s%s: %d%%", thread_msg.empty() ? u", threads: " : u", ", threads[i].name, threads[i].cpu_percent);
+        }
+        message += thread_msg;
+#endif
+
         // Display monitoring message if allowed in this period or if vmem has increased.
         if (period->log_messages || vmem_size > vsize_max) {
             _report.info(message);
@@ -186,6 +243,35 @@ void ts::SystemMonitor::main()
             }
         }
 
+        // Update the last snapshot, for provideMetrics() and JSON emission.
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _snap_time = current_time;
+            _snap_vmem = vmem_size;
+            _snap_cpu = cpu;
+            _snap_cpu_average = current_time <= start_time ? 0 : int((100 * (cpu_time - start_cpu_time).count()) / (current_time - start_time).count());
+            _snap_threads.swap(threads);
+        }
+
+        // Append one JSON snapshot per interval when requested.
+        if (!_json_file.empty()) {
+            if (!_json_stream.is_open()) {
+                _json_stream.open(_json_file, std::ios::out | std::ios::app);
+                if (!_json_stream) {
+                    _report.error(u"error creating %s", _json_file);
+                    _json_file.clear();
+                }
+            }
+            if (_json_stream.is_open()) {
+                json::Object root;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    buildSnapshot(root);
+                }
+                _json_stream << root.oneLiner(_report) << std::endl;
+            }
+        }
+
         // Remember points when virtual memory increases.
         if (vmem_size > vsize_max) {
             vsize_max = vmem_size;
@@ -199,6 +285,136 @@ void ts::SystemMonitor::main()
     }
 
     _report.info(u"%sresource monitoring terminated", MonPrefix(Time::CurrentLocalTime()));
+
+#if defined(TS_LINUX)
+    // Close the cached per-thread handles.
+    for (auto& th : _threads) {
+        if (th.second.fd >= 0) {
+            ::close(th.second.fd);
+        }
+    }
+    _threads.clear();
+#endif
+
+    if (_json_stream.is_open()) {
+        _json_stream.close();
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Update per-thread CPU times from /proc/self/task (Linux only).
+//----------------------------------------------------------------------------
+
+#if defined(TS_LINUX)
+void ts::SystemMonitor::scanThreads(cn::milliseconds interval, std::vector<ThreadSample>& samples)
+{
+    // Number of clock ticks per second, the unit of utime and stime in /proc stat files.
+    static const long ticks_per_sec = ::sysconf(_SC_CLK_TCK);
+
+    // Mark and sweep: find which threads are still alive.
+    for (auto& th : _threads) {
+        th.second.seen = false;
+    }
+
+    // Scan all current threads of the process.
+    ::DIR* dir = ::opendir("/proc/self/task");
+    if (dir != nullptr) {
+        ::dirent* ent = nullptr;
+        while ((ent = ::readdir(dir)) != nullptr) {
+            const int tid = ::atoi(ent->d_name);
+            if (tid > 0) {
+                ThreadState& th(_threads[tid]);
+                if (th.fd < 0) {
+                    // New thread, cache a handle on its stat file.
+                    th.fd = ::open(UString::Format(u"/proc/self/task/%d/stat", tid).toUTF8().c_str(), O_RDONLY);
+                }
+                // Re-read the stat file from its cached handle. The thread name is the
+                // second field, between parentheses, utime and stime are fields 14 and 15.
+                char buf[512];
+                const ssize_t len = th.fd < 0 ? -1 : ::pread(th.fd, buf, sizeof(buf) - 1, 0);
+                if (len > 0) {
+                    buf[len] = '\0';
+                    const char* lp = ::strchr(buf, '(');
+                    const char* rp = ::strrchr(buf, ')');
+                    unsigned long utime = 0, stime = 0;
+                    if (lp != nullptr && rp != nullptr && rp > lp && ticks_per_sec > 0 &&
+                        ::sscanf(rp + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) == 2)
+                    {
+                        th.name.assignFromUTF8(lp + 1, size_t(rp - lp - 1));
+                        th.cpu = cn::milliseconds(cn::milliseconds::rep(((utime + stime) * 1000) / (unsigned long)(ticks_per_sec)));
+                        th.seen = true;
+                    }
+                }
+            }
+        }
+        ::closedir(dir);
+    }
+
+    // Build the samples for the ending interval and cleanup vanished threads.
+    for (auto it = _threads.begin(); it != _threads.end(); ) {
+        ThreadState& th(it->second);
+        if (!th.seen) {
+            // The thread has disappeared, close its cached handle.
+            if (th.fd >= 0) {
+                ::close(th.fd);
+            }
+            it = _threads.erase(it);
+        }
+        else {
+            ThreadSample sample;
+            sample.tid = it->first;
+            sample.name = th.name;
+            sample.cpu_time = th.cpu;
+            if (interval > cn::milliseconds::zero() && th.cpu > th.last_cpu) {
+                sample.cpu_percent = int((100 * (th.cpu - th.last_cpu).count()) / interval.count());
+            }
+            th.last_cpu = th.cpu;
+            samples.push_back(sample);
+            ++it;
+        }
+    }
+}
+#endif
+
+
+//----------------------------------------------------------------------------
+// Build a JSON object from the last snapshot.
+//----------------------------------------------------------------------------
+
+void ts::SystemMonitor::buildSnapshot(json::Object& root)
+{
+    root.add(u"time", _snap_time.format(Time::DATETIME));
+    root.add(u"vmem-size", int64_t(_snap_vmem));
+    root.add(u"cpu-percent", int64_t(_snap_cpu));
+    root.add(u"cpu-average-percent", int64_t(_snap_cpu_average));
+    if (!_regions.empty()) {
+        size_t declared = 0;
+        json::Value& jm(root.query(u"memory", true));
+        for (const auto& reg : _regions) {
+            jm.add(reg.first, int64_t(reg.second));
+            declared += reg.second;
+        }
+        jm.add(u"other", int64_t(_snap_vmem > declared ? _snap_vmem - declared : 0));
+    }
+    for (const auto& th : _snap_threads) {
+        json::Value& jt(root.query(u"threads[]", true));
+        jt.add(u"tid", int64_t(th.tid));
+        jt.add(u"name", th.name);
+        jt.add(u"cpu-percent", int64_t(th.cpu_percent));
+        jt.add(u"cpu-time-ms", th.cpu_time.count());
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Build a snapshot of the metrics (called by the metrics server thread).
+//----------------------------------------------------------------------------
+
+void ts::SystemMonitor::provideMetrics(json::Object& root)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    buildSnapshot(root);
 }
 
 
@@ -15,6 +15,7 @@
 #include "tsThread.h"
 #include "tsTime.h"
 #include "tsReport.h"
+#include "tsMetricsServer.h"
 #include "tsxml.h"
 
 namespace ts {
@@ -28,6 +29,14 @@ namespace ts {
     //! values, it also displays an analysis of the virtual memory usage
     //! (such as stable or leaking).
     //!
+    //! On Linux, the CPU load is also reported per thread, using cached
+    //! handles on /proc/self/task, so that the busiest threads can be
+    //! identified without external tooling. The application may declare
+    //! large static buffers using declareMemoryRegion() to distinguish
+    //! them from heap usage in memory reports. Monitoring snapshots can
+    //! also be periodically appended to a JSON file (see setJsonFile())
+    //! or served through a MetricsServer (this class is a metrics provider).
+    //!
     //! The reporting interval is changing over time, very fast at the
     //! start of the application, then slower and slower:
     //!
@@ -41,7 +50,7 @@ namespace ts {
     //! inherited. The destructor stops the thread and synchronously waits for its termination.
     //! The method stop() can be used to stop the thread.
     //!
-    class TSCOREDLL SystemMonitor: public Thread
+    class TSCOREDLL SystemMonitor: public Thread, public MetricsProviderInterface
     {
         TS_NOBUILD_NOCOPY(SystemMonitor);
     public:
@@ -65,6 +74,28 @@ namespace ts {
         //!
         void stop();
 
+        //!
+        //! Declare an application memory region for memory attribution.
+        //! Declared regions, typically large static buffers such as the tsp
+        //! global packet buffer, are reported separately from the rest of the
+        //! virtual memory ("other", mostly heap) in monitoring messages and
+        //! snapshots. Must be called before start().
+        //! @param [in] name Display name of the memory region.
+        //! @param [in] size Size in bytes of the memory region.
+        //!
+        void declareMemoryRegion(const UString& name, size_t size);
+
+        //!
+        //! Periodically append monitoring snapshots to a file in JSON format.
+        //! At each monitoring interval, one JSON object is appended to the file,
+        //! on one single line (JSON Lines format). Must be called before start().
+        //! @param [in] filename Name of the JSON file to append to.
+        //!
+        void setJsonFile(const fs::path& filename);
+
+        // Implementation of MetricsProviderInterface.
+        virtual void provideMetrics(json::Object& root) override;
+
     private:
         // Description of a monitoring configuration, during one period.
         class Config
@@ -87,13 +118,49 @@ namespace ts {
         };
         using PeriodList = std::list<Period>;
 
+        // Activity of one thread during the last monitoring interval.
+        class ThreadSample
+        {
+        public:
+            ThreadSample() = default;
+            int     tid = 0;               // System thread id.
+            UString name {};               // Thread name.
+            int     cpu_percent = 0;       // CPU load during the last interval.
+            cn::milliseconds cpu_time {};  // Total CPU time of the thread.
+        };
+
+#if defined(TS_LINUX)
+        // Per-thread CPU accounting state, with a cached handle on /proc/self/task/<tid>/stat.
+        class ThreadState
+        {
+        public:
+            ThreadState() = default;
+            int     fd = -1;               // Cached handle on the stat file.
+            UString name {};               // Thread name.
+            cn::milliseconds cpu {};       // Total CPU time of the thread.
+            cn::milliseconds last_cpu {};  // CPU time at previous interval.
+            bool    seen = false;          // Thread was found during the last scan.
+        };
+#endif
+
         // Private members
-        Report&    _report;
-        UString    _config_file {};          // XML configuration file name.
-        PeriodList _periods {};              // List of monitoring periods.
-        std::mutex _mutex {};                // Protect subsequent fields.
+        Report&       _report;
+        UString       _config_file {};       // XML configuration file name.
+        PeriodList    _periods {};           // List of monitoring periods.
+        std::list<std::pair<UString, size_t>> _regions {};  // Declared memory regions (set before start).
+        fs::path      _json_file {};         // Append JSON snapshots to this file (set before start).
+        std::ofstream _json_stream {};       // Cached handle on _json_file.
+        std::mutex    _mutex {};             // Protect subsequent fields.
         std::condition_variable _wake_up {}; // Accessed under mutex.
-        bool       _terminate = false;       // Accessed under mutex.
+        bool          _terminate = false;    // Accessed under mutex.
+        Time          _snap_time {};         // Time of last snapshot, accessed under mutex.
+        size_t        _snap_vmem = 0;        // Virtual memory size at last snapshot, accessed under mutex.
+        int           _snap_cpu = 0;         // CPU load at last snapshot, accessed under mutex.
+        int           _snap_cpu_average = 0; // Average CPU load at last snapshot, accessed under mutex.
+        std::vector<ThreadSample> _snap_threads {};  // Per-thread activity at last snapshot, accessed under mutex.
+#if defined(TS_LINUX)
+        std::map<int, ThreadState> _threads {};  // Per-thread accounting state, indexed by thread id, monitor thread only.
+#endif
 
         // Inherited from Thread
         virtual void main() override;
@@ -104,5 +171,13 @@ namespace ts {
         // Laad the monitoring configuration file.
         bool loadConfigurationFile(const UString& config);
         bool loadConfig(Config&, const xml::Element*, const Config*);
+
+#if defined(TS_LINUX)
+        // Update per-thread CPU times from /proc/self/task and fill the samples for the ending interval.
+        void scanThreads(cn::milliseconds interval, std::vector<ThreadSample>& samples);
+#endif
+
+        // Build a JSON object from the last snapshot. Must be called with _mutex held.
+        void buildSnapshot(json::Object& root);
     };
 }
@@ -15,6 +15,7 @@
 #if defined(TS_LINUX)
     #include "tsBeforeStandardHeaders.h"
     #include <sys/prctl.h>
+    #include <sched.h>
     #include "tsAfterStandardHeaders.h"
 #endif
 
@@ -377,6 +378,32 @@ void ts::Thread::mainWrapper()
             name.substitute(u"::", u".");
         }
     }
+    // Apply the CPU affinity, if one was specified. Silently ignored on
+    // systems without CPU affinity support (macOS, various BSD flavors).
+    const std::vector<size_t> affinity(_attributes.getAffinity());
+    if (!affinity.empty()) {
+#if defined(TS_LINUX)
+        ::cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (size_t cpu : affinity) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(int(cpu), &cpuset);
+            }
+        }
+        ::sched_setaffinity(0, sizeof(cpuset), &cpuset);
+#elif defined(TS_WINDOWS)
+        ::DWORD_PTR mask = 0;
+        for (size_t cpu : affinity) {
+            if (cpu < 8 * sizeof(mask)) {
+                mask |= ::DWORD_PTR(1) << cpu;
+            }
+        }
+        if (mask != 0) {
+            ::SetThreadAffinityMask(::GetCurrentThread(), mask);
+        }
+#endif
+    }
+
     if (!name.empty()) {
 #if defined(TS_LINUX)
         ::prctl(PR_SET_NAME, name.toUTF8().c_str());
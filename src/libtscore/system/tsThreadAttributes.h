@@ -215,6 +215,37 @@ namespace ts {
             return _priority;
         }
 
+        //!
+        //! Set the CPU affinity of the thread.
+        //!
+        //! When a non-empty set of CPU indexes is specified, the thread is restricted
+        //! to run on these CPU's only. On NUMA systems, pinning the threads of an
+        //! application on the CPU's of one node keeps its memory accesses local to
+        //! that node. The CPU affinity is applied when the thread starts. It is
+        //! silently ignored on systems without CPU affinity support.
+        //!
+        //! @param [in] cpus Set of allowed CPU indexes for the thread, from 0 to the
+        //! number of CPU's minus one. An empty set means no restriction (the default).
+        //! @return A reference to this object.
+        //!
+        ThreadAttributes& setAffinity(const std::vector<size_t>& cpus)
+        {
+            _affinity = cpus;
+            return *this;
+        }
+
+        //!
+        //! Get the CPU affinity of the thread.
+        //!
+        //! @return The set of allowed CPU indexes for the thread.
+        //! An empty set means no restriction.
+        //! @see setAffinity()
+        //!
+        std::vector<size_t> getAffinity() const
+        {
+            return _affinity;
+        }
+
         //!
         //! Get the minimum priority for a thread in this context of the operating system.
         //! @return The minimum priority for a thread.
@@ -274,6 +305,7 @@ namespace ts {
         bool    _exitOnException = false;
         int     _priority = 0;
         UString _name {};
+        std::vector<size_t> _affinity {};
 
         //
         // These fields describe the operating system priority range.
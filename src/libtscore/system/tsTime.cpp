@@ -153,6 +153,24 @@ ts::UString ts::Time::toString() const
 // Basic string representation
 //----------------------------------------------------------------------------
 
+namespace {
+    // Append a zero-padded decimal value. Timestamps are formatted on each
+    // log line, avoid the overhead of the general formatting engine here.
+    void AppendPadded(ts::UString& s, int value, size_t width)
+    {
+        ts::UChar buf[12];
+        size_t i = sizeof(buf) / sizeof(buf[0]);
+        do {
+            buf[--i] = ts::UChar(u'0' + value % 10);
+            value /= 10;
+        } while (value != 0 && i > 0);
+        while (sizeof(buf) / sizeof(buf[0]) - i < width && i > 0) {
+            buf[--i] = u'0';
+        }
+        s.append(buf + i, sizeof(buf) / sizeof(buf[0]) - i);
+    }
+}
+
 ts::UString ts::Time::format(int fields) const
 {
     UString s;
@@ -160,43 +178,43 @@ ts::UString ts::Time::format(int fields) const
     Fields f(*this);
 
     if ((fields & YEAR) != 0) {
-        s.append(UString::Format(u"%4d", f.year));
+        AppendPadded(s, f.year, 4);
     }
     if ((fields & MONTH) != 0) {
         if ((fields & YEAR) != 0) {
             s.push_back(u'/');
         }
-        s.append(UString::Format(u"%02d", f.month));
+        AppendPadded(s, f.month, 2);
     }
     if ((fields & DAY) != 0) {
         if ((fields & (YEAR | MONTH)) != 0) {
             s.push_back(u'/');
         }
-        s.append(UString::Format(u"%02d", f.day));
+        AppendPadded(s, f.day, 2);
     }
     if ((fields & (YEAR | MONTH | DAY)) != 0 && (fields & (HOUR | MINUTE | SECOND | MILLISECOND)) != 0) {
         s.push_back(u' ');
     }
     if ((fields & HOUR) != 0) {
-        s.append(UString::Format(u"%02d", f.hour));
+        AppendPadded(s, f.hour, 2);
     }
     if ((fields & MINUTE) != 0) {
         if ((fields & HOUR) != 0) {
             s.push_back(u':');
         }
-        s.append(UString::Format(u"%02d", f.minute));
+        AppendPadded(s, f.minute, 2);
     }
     if ((fields & SECOND) != 0) {
         if ((fields & (HOUR | MINUTE)) != 0) {
             s.push_back(u':');
         }
-        s.append(UString::Format(u"%02d", f.second));
+        AppendPadded(s, f.second, 2);
     }
     if ((fields & MILLISECOND) != 0) {
         if ((fields & (HOUR | MINUTE | SECOND)) != 0) {
             s.push_back(u'.');
         }
-        s.append(UString::Format(u"%03d", f.millisecond));
+        AppendPadded(s, f.millisecond, 3);
     }
     return s;
 }
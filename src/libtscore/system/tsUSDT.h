@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  @ingroup libtscore system
+//!  User-level statically defined tracing (USDT) probe points.
+//!
+//!  On Linux, when the SystemTap development headers are installed, the
+//!  TS_PROBE macros expand to USDT probe points under the provider name
+//!  "tsduck". Such probes compile to a single NOP instruction and have no
+//!  measurable cost until a tracer (bpftrace, perf, systemtap) attaches to
+//!  them. On other platforms, or when TS_NO_USDT is defined, they expand
+//!  to nothing.
+//!
+//!  Probe arguments are evaluated even when no tracer is attached. Always
+//!  pass readily available values (counters, indexes) and never compute
+//!  expensive expressions, such as fresh timestamps, for the sole purpose
+//!  of a probe. Tracers record their own timestamps on probe hits.
+//!
+//!  Example with bpftrace, on a running tsp process:
+//!  @code
+//!  bpftrace -e 'usdt:/usr/bin/tsp:tsduck:input_commit { printf("%d\n", arg1); }'
+//!  @endcode
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsPlatform.h"
+
+#if defined(TS_LINUX) && !defined(TS_NO_USDT) && defined(__has_include)
+    #if __has_include(<sys/sdt.h>)
+        //!
+        //! Defined when USDT probe points are compiled in.
+        //!
+        #define TS_USDT 1
+        #include "tsBeforeStandardHeaders.h"
+        #include <sys/sdt.h>
+        #include "tsAfterStandardHeaders.h"
+    #endif
+#endif
+
+#if defined(TS_USDT) && !defined(DOXYGEN)
+    #define TS_PROBE(name)                 DTRACE_PROBE(tsduck, name)
+    #define TS_PROBE1(name, a1)            DTRACE_PROBE1(tsduck, name, a1)
+    #define TS_PROBE2(name, a1, a2)        DTRACE_PROBE2(tsduck, name, a1, a2)
+    #define TS_PROBE3(name, a1, a2, a3)    DTRACE_PROBE3(tsduck, name, a1, a2, a3)
+    #define TS_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(tsduck, name, a1, a2, a3, a4)
+#else
+    //!
+    //! USDT probe point without argument.
+    //! @param name Probe name, an identifier, not a string.
+    //!
+    #define TS_PROBE(name)                  do {} while (false)
+    //!
+    //! USDT probe point with one argument.
+    //! @param name Probe name, an identifier, not a string.
+    //! @param a1 First probe argument, an integral value.
+    //!
+    #define TS_PROBE1(name, a1)             do {} while (false)
+    //!
+    //! USDT probe point with two arguments.
+    //! @param name Probe name, an identifier, not a string.
+    //! @param a1 First probe argument, an integral value.
+    //! @param a2 Second probe argument, an integral value.
+    //!
+    #define TS_PROBE2(name, a1, a2)         do {} while (false)
+    //!
+    //! USDT probe point with three arguments.
+    //! @param name Probe name, an identifier, not a string.
+    //! @param a1 First probe argument, an integral value.
+    //! @param a2 Second probe argument, an integral value.
+    //! @param a3 Third probe argument, an integral value.
+    //!
+    #define TS_PROBE3(name, a1, a2, a3)     do {} while (false)
+    //!
+    //! USDT probe point with four arguments.
+    //! @param name Probe name, an identifier, not a string.
+    //! @param a1 First probe argument, an integral value.
+    //! @param a2 Second probe argument, an integral value.
+    //! @param a3 Third probe argument, an integral value.
+    //! @param a4 Fourth probe argument, an integral value.
+    //!
+    #define TS_PROBE4(name, a1, a2, a3, a4) do {} while (false)
+#endif
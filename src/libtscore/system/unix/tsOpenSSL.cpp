@@ -128,6 +128,14 @@ SSL_CTX* ts::OpenSSL::CreateContext(bool server, bool verify_peer, Report& repor
     // Accept only TLS 1.2 and 1.3, others are obsolete.
     ::SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION);
 
+#if defined(TS_LINUX) && defined(SSL_OP_ENABLE_KTLS)
+    // On Linux, enable kernel TLS offload. After the handshake, when the kernel
+    // supports the negotiated cipher, the record encryption is done in the kernel
+    // and SSL_read() / SSL_write() become plain system calls. OpenSSL silently
+    // falls back to user-space records when the kernel does not support kTLS.
+    ::SSL_CTX_set_options(ssl_ctx, SSL_OP_ENABLE_KTLS);
+#endif
+
     // Check if the peer shall be verified.
     ::SSL_CTX_set_verify(ssl_ctx, verify_peer ? SSL_VERIFY_PEER : SSL_VERIFY_NONE, nullptr);
 
@@ -15,7 +15,7 @@
 //----------------------------------------------------------------------------
 
 ts::TextFormatter::TextFormatter(Report& report) :
-    AbstractOutputStream(),
+    AbstractOutputStream(OUTPUT_BUFFER_SIZE),
     _report(report),
     _out(&_outFile)  // _out is never null, points by default to a closed file (discard output)
 {
@@ -165,25 +165,36 @@ ts::TextFormatter& ts::TextFormatter::setMarginSize(size_t margin)
 
 bool ts::TextFormatter::writeStreamBuffer(const void* addr, size_t size)
 {
-    const char* const last = static_cast<const char*>(addr) + size;
-    for (const char* p = static_cast<const char*>(addr); p < last; ++p) {
+    const char* p = static_cast<const char*>(addr);
+    const char* const last = p + size;
+    while (p < last) {
         if (*p == '\t') {
             // Tabulations are expanded as spaces.
             // Without formatting, a tabulation is just one space.
             do {
                 *_out << ' ';
             } while (++_column % _tabSize != 0 && _formatting);
+            ++p;
         }
         else if (*p == '\r' || *p == '\n') {
             // CR and LF indifferently move back to begining of current/next line.
-            *_out << *p;
+            _out->put(*p);
             _column = 0;
             _afterSpace = false;
+            ++p;
         }
         else {
-            *_out << *p;
-            ++_column;
-            _afterSpace = _afterSpace || *p != ' ';
+            // Run of plain characters: write it in one single operation instead
+            // of going through one formatted insertion per character.
+            const char* const run = p;
+            bool non_space = false;
+            while (p < last && *p != '\t' && *p != '\r' && *p != '\n') {
+                non_space = non_space || *p != ' ';
+                ++p;
+            }
+            _out->write(run, p - run);
+            _column += size_t(p - run);
+            _afterSpace = _afterSpace || non_space;
         }
     }
     return !_out->fail();
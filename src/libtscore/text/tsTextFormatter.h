@@ -29,6 +29,13 @@ namespace ts {
     {
         TS_NOCOPY(TextFormatter);
     public:
+        //!
+        //! Size in bytes of the output buffer.
+        //! High-volume text output (verbose table logging for instance) accumulates
+        //! in this buffer and reaches the output stream by large blocks.
+        //!
+        static constexpr size_t OUTPUT_BUFFER_SIZE = 16 * 1024;
+
         //!
         //! Constructor.
         //! @param [in,out] report Where to report errors.
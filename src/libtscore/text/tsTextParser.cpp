@@ -156,6 +156,15 @@ void ts::TextParser::rewind()
     _pos = Position(_lines);
 }
 
+void ts::TextParser::trimConsumedLines()
+{
+    // Only applicable when the parser owns its document.
+    // When the parser references an external list of lines, do not modify it.
+    if (_pos._lines == &_lines) {
+        _pos._curLine = _lines.erase(_lines.begin(), _pos._curLine);
+    }
+}
+
 
 //----------------------------------------------------------------------------
 // Skip all whitespaces.
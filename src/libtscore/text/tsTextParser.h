@@ -114,6 +114,15 @@ namespace ts {
         //!
         void rewind();
 
+        //!
+        //! Delete all lines of the document before the current position.
+        //! This keeps the memory usage flat when a very large document is parsed in one pass.
+        //! This is possible only when the parser owns its document, after loadDocument(),
+        //! loadFile() or loadStream(). When the parser references an external list of lines,
+        //! this method does nothing. All previously saved positions become invalid.
+        //!
+        void trimConsumedLines();
+
         //!
         //! A class which describes a position in the document.
         //!
@@ -120,6 +120,32 @@ namespace ts::tlv {
         //!
         void setMaxInvalidMessages(size_t n) {_max_invalid_msg = n;}
 
+        //!
+        //! Set the number of outgoing messages to coalesce into one TCP send.
+        //!
+        //! When @a count is greater than one, sendMessage() queues the serialized
+        //! messages and sends them with one single system call when @a count
+        //! messages are queued. This avoids tiny TCP segments and system call
+        //! storms when sending bursts of small messages. The application shall
+        //! call flushSendMessages() at the end of each burst, and before
+        //! disconnecting, since the peer does not receive queued messages.
+        //! Do not use batching on strict request-response exchanges where the
+        //! peer waits for each individual response.
+        //!
+        //! @param [in] count Maximum number of queued messages. When lower than
+        //! or equal to one (the default), each message is sent immediately.
+        //!
+        void setSendBatchSize(size_t count);
+
+        //!
+        //! Immediately send all queued outgoing messages.
+        //! Do nothing when message batching is not in use or no message is queued.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //! @see setSendBatchSize()
+        //!
+        bool flushSendMessages(Report& report);
+
     protected:
         // Inherited from TCPConnection
         virtual void handleConnected(Report&) override;
@@ -131,6 +157,12 @@ namespace ts::tlv {
         size_t          _invalid_msg_count = 0;
         MutexType       _send_mutex {};
         MutexType       _receive_mutex {};
+        size_t          _send_batch_size = 1;  // Maximum number of queued outgoing messages.
+        size_t          _send_queue_count = 0; // Number of queued outgoing messages.
+        ByteBlockPtr    _send_queue {};        // Serialized queued outgoing messages.
+
+        // Send all queued messages. The send mutex must be held.
+        bool flushSendQueue(Report& report);
     };
 }
 
@@ -176,12 +208,51 @@ bool ts::tlv::Connection<SAFETY>::sendMessage(const Message& msg, Logger& logger
 {
     logger.log(msg, u"sending message to " + peerName());
 
+    std::lock_guard<MutexType> lock(_send_mutex);
+
+    // With message batching, serialize directly at the end of the send queue.
+    if (_send_batch_size > 1) {
+        if (_send_queue == nullptr) {
+            _send_queue = std::make_shared<ByteBlock>();
+        }
+        Serializer serial(_send_queue);
+        msg.serialize(serial);
+        return ++_send_queue_count < _send_batch_size || flushSendQueue(logger.report());
+    }
+
     ByteBlockPtr bbp(new ByteBlock);
     Serializer serial(bbp);
     msg.serialize(serial);
+    return SuperClass::send(bbp->data(), bbp->size(), logger.report());
+}
 
+// Set the number of outgoing messages to coalesce into one TCP send.
+template <ts::ThreadSafety SAFETY>
+void ts::tlv::Connection<SAFETY>::setSendBatchSize(size_t count)
+{
     std::lock_guard<MutexType> lock(_send_mutex);
-    return SuperClass::send(bbp->data(), bbp->size(), logger.report());
+    _send_batch_size = std::max<size_t>(1, count);
+}
+
+// Immediately send all queued outgoing messages.
+template <ts::ThreadSafety SAFETY>
+bool ts::tlv::Connection<SAFETY>::flushSendMessages(Report& report)
+{
+    std::lock_guard<MutexType> lock(_send_mutex);
+    return flushSendQueue(report);
+}
+
+// Send all queued messages. The send mutex must be held.
+template <ts::ThreadSafety SAFETY>
+bool ts::tlv::Connection<SAFETY>::flushSendQueue(Report& report)
+{
+    if (_send_queue == nullptr || _send_queue->empty()) {
+        return true;
+    }
+    const bool ok = SuperClass::send(_send_queue->data(), _send_queue->size(), report);
+    _send_queue->clear();
+    _send_queue_count = 0;
+    return ok;
 }
 
 // Receive a TLV message (wait for the message, deserialize it and validate it)
@@ -0,0 +1,211 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  @ingroup libtscore cpp
+//!  Opt-in lightweight allocation profiling.
+//!
+//!  When the macro TS_ALLOC_PROFILE is defined at compilation time (for
+//!  instance using "make CPPFLAGS_EXTRA=-DTS_ALLOC_PROFILE=1"), the macro
+//!  TS_ALLOC_TRACE counts allocations per call site, using thread-local
+//!  tallies which are periodically flushed into shared per-site counters.
+//!  A report, sorted by decreasing allocated bytes, is printed on the
+//!  standard error at process exit. Without TS_ALLOC_PROFILE, the macro
+//!  expands to nothing and has zero cost.
+//!
+//!  Unlike external heap profilers (LD_PRELOAD interposers, valgrind),
+//!  this layer does not intercept every malloc and does not distort the
+//!  timing of the profiled application. It only counts what is explicitly
+//!  instrumented, in selected hot classes such as ByteBlock, Section and
+//!  UString, and attributes the counts to the instrumented call sites.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsPlatform.h"
+
+#if defined(TS_ALLOC_PROFILE) || defined(DOXYGEN)
+
+namespace ts {
+    //!
+    //! One instrumented allocation site.
+    //! @ingroup libtscore cpp
+    //!
+    //! One instance is implicitly created per expansion of TS_ALLOC_TRACE,
+    //! as a function-local static object. Each site registers itself in a
+    //! global list which is dumped at process exit. The shared counters are
+    //! only updated when a thread-local tally is flushed (see AllocTally).
+    //!
+    //! This class is header-only so that the profiling layer can be enabled
+    //! in application code even when the TSDuck libraries were built without
+    //! TS_ALLOC_PROFILE (and vice versa).
+    //!
+    class AllocSite
+    {
+        TS_NOCOPY(AllocSite);
+    public:
+        //!
+        //! Constructor, register the site in the global site list.
+        //! @param [in] name Static display name of the allocation site.
+        //!
+        AllocSite(const char* name);
+
+        const char* const     name;        //!< Display name of the site.
+        std::atomic<uint64_t> count {0};   //!< Total number of allocations.
+        std::atomic<uint64_t> bytes {0};   //!< Total number of allocated bytes.
+
+        //!
+        //! Dump all allocation sites, sorted by decreasing allocated bytes.
+        //! Implicitly called at process exit, on the standard error.
+        //! @param [in,out] out Output stream.
+        //!
+        static void DumpAllocations(std::ostream& out);
+
+    private:
+        AllocSite* _next = nullptr;  // Next site in the global list.
+
+        // The global site list and its mutex, as function-local statics
+        // to keep this header self-contained.
+        static AllocSite*& ListHead();
+        static std::mutex& ListMutex();
+    };
+
+    //!
+    //! Thread-local allocation tally for one site.
+    //! @ingroup libtscore cpp
+    //!
+    //! One instance is implicitly created per thread and per expansion of
+    //! TS_ALLOC_TRACE. Increments are plain additions, without any atomic
+    //! operation or lock. The tally is flushed into the shared counters of
+    //! the site every FLUSH_COUNT records and on thread termination.
+    //!
+    class AllocTally
+    {
+        TS_NOCOPY(AllocTally);
+    public:
+        //!
+        //! Constructor.
+        //! @param [in,out] site The allocation site to tally for.
+        //!
+        AllocTally(AllocSite& site) : _site(site) {}
+
+        //!
+        //! Destructor, flush the tally into the site.
+        //!
+        ~AllocTally() { flush(); }
+
+        //!
+        //! Record one allocation.
+        //! @param [in] size Allocation size in bytes.
+        //!
+        void record(size_t size)
+        {
+            _count++;
+            _bytes += size;
+            if (_count >= FLUSH_COUNT) {
+                flush();
+            }
+        }
+
+        //!
+        //! Flush the tally into the shared counters of the site.
+        //!
+        void flush()
+        {
+            if (_count > 0) {
+                _site.count.fetch_add(_count, std::memory_order_relaxed);
+                _site.bytes.fetch_add(_bytes, std::memory_order_relaxed);
+                _count = 0;
+                _bytes = 0;
+            }
+        }
+
+    private:
+        static constexpr uint64_t FLUSH_COUNT = 1024;  // Flush period, in number of records.
+
+        AllocSite& _site;
+        uint64_t   _count = 0;
+        uint64_t   _bytes = 0;
+    };
+}
+
+
+//----------------------------------------------------------------------------
+// Inline implementation of AllocSite (header-only).
+//----------------------------------------------------------------------------
+
+//! @cond nodoxygen
+inline ts::AllocSite*& ts::AllocSite::ListHead()
+{
+    static AllocSite* head = nullptr;
+    return head;
+}
+
+inline std::mutex& ts::AllocSite::ListMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline ts::AllocSite::AllocSite(const char* name_) :
+    name(name_)
+{
+    std::lock_guard<std::mutex> lock(ListMutex());
+    _next = ListHead();
+    ListHead() = this;
+    if (_next == nullptr) {
+        // First registered site: dump the report at process exit. The
+        // thread-local tallies of the main thread are flushed before the
+        // exit handlers run.
+        std::atexit([]() { DumpAllocations(std::cerr); });
+    }
+}
+
+inline void ts::AllocSite::DumpAllocations(std::ostream& out)
+{
+    // Collect and sort the sites by decreasing allocated bytes.
+    std::vector<AllocSite*> sites;
+    {
+        std::lock_guard<std::mutex> lock(ListMutex());
+        for (AllocSite* site = ListHead(); site != nullptr; site = site->_next) {
+            sites.push_back(site);
+        }
+    }
+    std::sort(sites.begin(), sites.end(), [](const AllocSite* s1, const AllocSite* s2) { return s1->bytes > s2->bytes; });
+
+    // One line per site, plain iostream formatting to avoid any allocation here.
+    out << "[ALLOC] allocation profile (" << sites.size() << " sites):" << std::endl;
+    for (const AllocSite* site : sites) {
+        out << "[ALLOC] " << site->name
+            << ": " << site->count.load(std::memory_order_relaxed) << " allocations"
+            << ", " << site->bytes.load(std::memory_order_relaxed) << " bytes"
+            << std::endl;
+    }
+}
+//! @endcond
+
+#endif // TS_ALLOC_PROFILE
+
+#if defined(TS_ALLOC_PROFILE) && !defined(DOXYGEN)
+    #define TS_ALLOC_TRACE(tag, size)                                            \
+        do {                                                                     \
+            static ts::AllocSite ts_alloc_site_(tag);                            \
+            static thread_local ts::AllocTally ts_alloc_tally_(ts_alloc_site_);  \
+            ts_alloc_tally_.record(size);                                        \
+        } while (false)
+#else
+    //!
+    //! Record one allocation at an instrumented call site.
+    //! Expand to nothing unless TS_ALLOC_PROFILE is defined.
+    //! @param tag Static display name of the allocation site, a C string.
+    //! @param size Allocation size in bytes. Never evaluated at run time when profiling
+    //! is disabled, but never compute an expensive expression for the sole purpose of
+    //! this macro.
+    //!
+    #define TS_ALLOC_TRACE(tag, size) do { (void)sizeof(size); } while (false)
+#endif
@@ -17,6 +17,32 @@
 
 namespace ts {
 
+    //! @cond nodoxygen
+    // Precomputed tables for one-byte BCD validation, pack and unpack.
+    // One table lookup each, without division or branch.
+    inline constexpr auto BCDValidTable = []() {
+        std::array<bool, 256> table {};
+        for (size_t b = 0; b < table.size(); ++b) {
+            table[b] = (b & 0xF0) < 0xA0 && (b & 0x0F) < 0x0A;
+        }
+        return table;
+    }();
+    inline constexpr auto BCDDecodeTable = []() {
+        std::array<uint8_t, 256> table {};
+        for (size_t b = 0; b < table.size(); ++b) {
+            table[b] = uint8_t(10 * (b >> 4) + (b & 0x0F));
+        }
+        return table;
+    }();
+    inline constexpr auto BCDEncodeTable = []() {
+        std::array<uint8_t, 100> table {};
+        for (size_t i = 0; i < table.size(); ++i) {
+            table[i] = uint8_t(((i / 10) << 4) | (i % 10));
+        }
+        return table;
+    }();
+    //! @endcond
+
     //!
     //! Check if a byte is a valid Binary Coded Decimal (BCD) value.
     //! @ingroup cpp
@@ -25,7 +51,7 @@ namespace ts {
     //!
     TSCOREDLL inline bool IsValidBCD(uint8_t b)
     {
-        return (b & 0xF0) < 0xA0 && (b & 0x0F) < 0x0A;
+        return BCDValidTable[b];
     }
 
     //!
@@ -36,7 +62,7 @@ namespace ts {
     //!
     TSCOREDLL inline int DecodeBCD(uint8_t b)
     {
-        return 10 * (b >> 4) + (b & 0x0F);
+        return BCDDecodeTable[b];
     }
 
     //!
@@ -47,7 +73,7 @@ namespace ts {
     //!
     TSCOREDLL inline uint8_t EncodeBCD(int i)
     {
-        return uint8_t(((i / 10) % 10) << 4) | uint8_t(i % 10);
+        return BCDEncodeTable[size_t(i) % 100];
     }
 
     //!
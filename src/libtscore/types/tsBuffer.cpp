@@ -1013,6 +1013,19 @@ size_t ts::Buffer::getBytesAppend(ByteBlock& bb, size_t bytes)
     return bytes;
 }
 
+std::span<const uint8_t> ts::Buffer::getBytesView(size_t bytes)
+{
+    if (_state.rbit != 0) {
+        // A view cannot start in the middle of a byte.
+        _read_error = true;
+        return {};
+    }
+    bytes = requestReadBytes(bytes);
+    const uint8_t* const addr = _buffer + _state.rbyte;
+    _state.rbyte += bytes;
+    return {addr, bytes};
+}
+
 
 //----------------------------------------------------------------------------
 // Put bulk bytes in the buffer.
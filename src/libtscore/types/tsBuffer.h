@@ -830,6 +830,19 @@ namespace ts {
         //!
         size_t getBytesAppend(ByteBlock& bb, size_t bytes = NPOS);
 
+        //!
+        //! Get a read-only view over bulk bytes in the buffer, without copying them.
+        //! The current read pointer must be byte-aligned and the view starts at the read pointer.
+        //! On success, the read pointer is advanced past the viewed bytes.
+        //! The returned view remains valid only as long as the buffer data are neither
+        //! modified nor reallocated. Use it for transient read-only inspection only.
+        //! @param [in] bytes Number of bytes to view. If specified as NPOS, view all remaining bytes.
+        //! @return A view over the read data. If the read pointer is not byte-aligned, return an
+        //! empty view and set the read error. If the requested number of bytes is not available,
+        //! return a view over as much as possible and set the read error.
+        //!
+        std::span<const uint8_t> getBytesView(size_t bytes = NPOS);
+
         //!
         //! Put bytes in the buffer.
         //! @param [in] buffer Address of the data to write.
@@ -1513,53 +1526,46 @@ INT ts::Buffer::getBits(size_t bits)
             return 0;
         }
 
+        // The amount of available bits was checked above: extract groups of
+        // bits directly from the buffer, without the per-bit error checks and
+        // state updates of getBit(). Unaligned small fields are the common
+        // case in descriptor deserialization.
         INT val = 0;
+        size_t rbyte = _state.rbyte;
+        size_t rbit = _state.rbit;
 
         if (_big_endian) {
-            // Read leading bits up to byte boundary
-            while (bits > 0 && _state.rbit != 0) {
-                val = INT(val << 1) | INT(getBit());
-                --bits;
-            }
-
-            // Read complete bytes
-            while (bits > 7) {
-                val = INT(val << 8) | INT(_buffer[_state.rbyte++]);
-                bits -= 8;
-            }
-
-            // Read trailing bits
+            // Big endian decoding, most significant bit first in each byte.
             while (bits > 0) {
-                val = INT(val << 1) | INT(getBit());
-                --bits;
+                const size_t avail = 8 - rbit;
+                const size_t take = std::min(bits, avail);
+                val = INT(val << take) | INT((_buffer[rbyte] >> (avail - take)) & ((1u << take) - 1));
+                bits -= take;
+                rbit += take;
+                if (rbit == 8) {
+                    rbit = 0;
+                    ++rbyte;
+                }
             }
         }
         else {
-            // Little endian decoding
-            int shift = 0;
-
-            // Read leading bits up to byte boundary
-            while (bits > 0 && _state.rbit != 0) {
-                val |= INT(getBit()) << shift;
-                --bits;
-                shift++;
-            }
-
-            // Read complete bytes
-            while (bits > 7) {
-                val |= INT(_buffer[_state.rbyte++]) << shift;
-                bits -= 8;
-                shift += 8;
-            }
-
-            // Read trailing bits
+            // Little endian decoding, least significant bit first in each byte.
+            size_t shift = 0;
             while (bits > 0) {
-                val |= INT(getBit()) << shift;
-                --bits;
-                shift++;
+                const size_t take = std::min(bits, 8 - rbit);
+                val |= INT(INT((_buffer[rbyte] >> rbit) & ((1u << take) - 1)) << shift);
+                bits -= take;
+                shift += take;
+                rbit += take;
+                if (rbit == 8) {
+                    rbit = 0;
+                    ++rbyte;
+                }
             }
         }
 
+        _state.rbyte = rbyte;
+        _state.rbit = rbit;
         return val;
     }
     else {
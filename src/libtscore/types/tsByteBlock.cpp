@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsByteBlock.h"
+#include "tsAllocProfile.h"
 #include "tsUString.h"
 #include "tsReport.h"
 #include "tsBCD.h"
@@ -19,6 +20,7 @@
 ts::ByteBlock::ByteBlock(size_type size) :
     ByteVector(size)
 {
+    TS_ALLOC_TRACE("ByteBlock::ByteBlock(size)", size);
 }
 
 //----------------------------------------------------------------------------
@@ -28,6 +30,7 @@ ts::ByteBlock::ByteBlock(size_type size) :
 ts::ByteBlock::ByteBlock(size_type size, uint8_t value) :
     ByteVector(size, value)
 {
+    TS_ALLOC_TRACE("ByteBlock::ByteBlock(size,value)", size);
 }
 
 //----------------------------------------------------------------------------
@@ -37,6 +40,7 @@ ts::ByteBlock::ByteBlock(size_type size, uint8_t value) :
 ts::ByteBlock::ByteBlock(const void* data, size_type size) :
     ByteVector(size)
 {
+    TS_ALLOC_TRACE("ByteBlock::ByteBlock(data,size)", size);
     if (size > 0 && data != nullptr) {
         MemCopy(&(*this)[0], data, size);
     }
@@ -49,6 +53,7 @@ ts::ByteBlock::ByteBlock(const void* data, size_type size) :
 ts::ByteBlock::ByteBlock(const char* str) :
     ByteVector(str == nullptr ? 0 : std::strlen(str))
 {
+    TS_ALLOC_TRACE("ByteBlock::ByteBlock(str)", size());
     if (size() > 0) {
         MemCopy(data(), str, size());
     }
@@ -61,6 +66,7 @@ ts::ByteBlock::ByteBlock(const char* str) :
 ts::ByteBlock::ByteBlock(std::initializer_list<uint8_t> init) :
     ByteVector(init)
 {
+    TS_ALLOC_TRACE("ByteBlock::ByteBlock(init)", size());
 }
 
 //----------------------------------------------------------------------------
@@ -83,6 +89,7 @@ ts::ByteBlock::size_type ts::ByteBlock::find(uint8_t value, size_type start)
 
 void ts::ByteBlock::copy(const void* data_, size_type size_)
 {
+    TS_ALLOC_TRACE("ByteBlock::copy", size_);
     resize(data_ == nullptr ? 0 : size_);
     if (size() > 0) {
         MemCopy(data(), data_, size());
@@ -95,6 +102,7 @@ void ts::ByteBlock::copy(const void* data_, size_type size_)
 
 uint8_t* ts::ByteBlock::enlarge(size_type n)
 {
+    TS_ALLOC_TRACE("ByteBlock::enlarge", n);
     const size_type oldsize = this->size();
     resize(oldsize + n);
     return data() + oldsize;
@@ -204,8 +212,9 @@ std::istream& ts::ByteBlock::append(std::istream& strm, size_t maxSize)
         const std::streamsize gc = strm.gcount();
         readSize = gc < 0 ? 0 : std::min(size_t(gc), readSize);
 
-        // Adjust buffer size.
+        // Adjust buffer size and remaining quota.
         resize(previousSize + readSize);
+        maxSize -= readSize;
     }
 
     return strm;
@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsHexDump.h"
+
+namespace {
+    // Precomputed two-character hexadecimal image of each byte value.
+    // Formatting a byte is one table lookup and one two-byte copy, without
+    // per-nibble arithmetic, which the compiler can freely vectorize.
+    constexpr std::array<std::array<char, 2>, 256> BuildHexaTable()
+    {
+        std::array<std::array<char, 2>, 256> table {};
+        constexpr char digits[] = "0123456789ABCDEF";
+        for (size_t i = 0; i < table.size(); ++i) {
+            table[i][0] = digits[i >> 4];
+            table[i][1] = digits[i & 0x0F];
+        }
+        return table;
+    }
+    constexpr auto hexa_table = BuildHexaTable();
+}
+
+
+//----------------------------------------------------------------------------
+// Dump a memory area in hexadecimal and/or ASCII on a standard output stream.
+//----------------------------------------------------------------------------
+
+void ts::HexDump(std::ostream& strm, const void* data, size_t size, uint32_t flags, size_t indent, size_t line_width, size_t init_offset)
+{
+    // Do nothing in case of invalid or empty data.
+    if (data == nullptr || size == 0) {
+        return;
+    }
+    const uint8_t* const raw = static_cast<const uint8_t*>(data);
+
+    // Single line dumps: a plain sequence of hexa bytes, optionally compacted.
+    if ((flags & (UString::SINGLE_LINE | UString::COMPACT)) != 0 && (flags & UString::C_STYLE) == 0) {
+        std::string line;
+        line.reserve(3 * size);
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0 && (flags & UString::COMPACT) == 0) {
+                line.push_back(' ');
+            }
+            line.append(hexa_table[raw[i]].data(), 2);
+        }
+        strm.write(line.data(), std::streamsize(line.size()));
+        return;
+    }
+
+    // Fall back to the generic Unicode formatter for the less common options.
+    if ((flags & ~(UString::HEXA | UString::ASCII | UString::OFFSET | UString::WIDE_OFFSET | UString::BPL)) != 0 || (flags & UString::HEXA) == 0) {
+        strm << UString::Dump(raw, size, flags, indent, line_width, init_offset);
+        return;
+    }
+
+    // Width of the offset field, same rules as UString::Dump().
+    size_t offset_width = 0;
+    if ((flags & UString::OFFSET) != 0) {
+        offset_width = ((flags & UString::WIDE_OFFSET) != 0 || init_offset + size > 0x10000) ? 8 : 4;
+    }
+
+    // Maximum number of dumped bytes per line, same rules as UString::Dump().
+    size_t bytes_per_line = 0;
+    if ((flags & UString::BPL) != 0) {
+        bytes_per_line = line_width;
+    }
+    else {
+        size_t add_width = indent;
+        if (offset_width != 0) {
+            add_width += offset_width + 3;
+        }
+        if ((flags & UString::ASCII) != 0) {
+            add_width += 2;
+        }
+        if (add_width >= line_width) {
+            bytes_per_line = 8;  // arbitrary, if indent is too long
+        }
+        else {
+            bytes_per_line = (line_width - add_width) / (3 + ((flags & UString::ASCII) != 0 ? 1 : 0));
+            if (bytes_per_line > 1) {
+                bytes_per_line = bytes_per_line & ~size_t(1);  // force even value
+            }
+        }
+    }
+    if (bytes_per_line == 0) {
+        bytes_per_line = 8;  // arbitrary, if ended up with none
+    }
+
+    // Format the complete dump in one single 8-bit string, one write at the end.
+    constexpr char digits[] = "0123456789ABCDEF";
+    std::string out;
+    const size_t line_count = (size + bytes_per_line - 1) / bytes_per_line;
+    out.reserve(line_count * (indent + offset_width + 3 + 4 * bytes_per_line + 3));
+
+    for (size_t line = 0; line < size; line += bytes_per_line) {
+
+        // Number of bytes on this line (last line may be shorter).
+        const size_t line_size = std::min(bytes_per_line, size - line);
+
+        // Beginning of line.
+        out.append(indent, ' ');
+        if (offset_width != 0) {
+            const uint64_t off = uint64_t(init_offset + line);
+            for (size_t i = 0; i < offset_width; ++i) {
+                out.push_back(digits[(off >> (4 * (offset_width - 1 - i))) & 0x0F]);
+            }
+            out.append(":  ", 3);
+        }
+
+        // Hexa dump.
+        for (size_t byte = 0; byte < line_size; ++byte) {
+            out.append(hexa_table[raw[line + byte]].data(), 2);
+            if (byte < bytes_per_line - 1) {
+                out.push_back(' ');
+            }
+        }
+
+        // ASCII dump.
+        if ((flags & UString::ASCII) != 0) {
+            if (line_size < bytes_per_line) {
+                out.append(3 * (bytes_per_line - line_size) - 1, ' ');
+            }
+            out.append(2, ' ');
+            for (size_t byte = 0; byte < line_size; ++byte) {
+                const char c = char(raw[line + byte]);
+                out.push_back(c >= 0x20 && c <= 0x7E ? c : '.');
+            }
+        }
+
+        // Insert a new-line, cleanup spurious spaces.
+        while (!out.empty() && out.back() == ' ') {
+            out.pop_back();
+        }
+        out.push_back('\n');
+    }
+    strm.write(out.data(), std::streamsize(out.size()));
+}
@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Fast hexadecimal dump of memory areas on standard streams.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsUString.h"
+
+namespace ts {
+    //!
+    //! Dump a memory area in hexadecimal and/or ASCII on a standard output stream.
+    //! @ingroup libtscore cpp
+    //!
+    //! The output format and the parameters are identical to UString::Dump().
+    //! The difference is performance: the common flag combinations are formatted
+    //! in bulk, using a precomputed byte-to-hexa table and 8-bit characters which
+    //! are directly written to the stream, without building intermediate UTF-16
+    //! strings. Dump-intensive tools such as tsdump are formatter-bound and
+    //! benefit from this path. The less common flag combinations transparently
+    //! fall back to UString::Dump(), with identical output.
+    //!
+    //! @param [in,out] strm Output stream.
+    //! @param [in] data Starting address of the memory area to dump.
+    //! @param [in] size Size in bytes of the memory area to dump.
+    //! @param [in] flags A combination of option flags indicating how to format the data.
+    //! This is typically the result of or'ed values from the enum type UString::HexaFlags.
+    //! @param [in] indent Each line is indented by this number of characters.
+    //! @param [in] line_width Maximum number of characters per line.
+    //! If the flag UString::BPL is specified, @a line_width is interpreted as the number of displayed byte values per line.
+    //! @param [in] init_offset If the flag UString::OFFSET is specified, an offset in the memory area is displayed
+    //! at the beginning of each line. In this case, @a init_offset specifies the offset value for the first byte.
+    //! @see UString::Dump()
+    //!
+    TSCOREDLL void HexDump(std::ostream& strm,
+                           const void* data,
+                           size_t size,
+                           uint32_t flags = UString::HEXA,
+                           size_t indent = 0,
+                           size_t line_width = UString::DEFAULT_HEXA_LINE_WIDTH,
+                           size_t init_offset = 0);
+}
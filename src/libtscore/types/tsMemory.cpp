@@ -41,7 +41,16 @@ const uint8_t* ts::LocatePattern(const void* area, size_t area_size, const void*
         const size_t last = pattern_size - 1;
         const size_t sublen = pattern_size - 2;
         while (area_size >= pattern_size) {
-            if (*a == *p && a[last] == p[last] && MemEqual(a + 1, p1, sublen)) {
+            // Use memchr() to locate candidates on the first byte. The libc
+            // implementation is typically vectorized and skips the bulk of
+            // non-matching bytes much faster than a byte-per-byte loop.
+            const uint8_t* const next = reinterpret_cast<const uint8_t*>(std::memchr(a, *p, area_size - pattern_size + 1));
+            if (next == nullptr) {
+                return nullptr; // first byte not found
+            }
+            area_size -= next - a;
+            a = next;
+            if (a[last] == p[last] && MemEqual(a + 1, p1, sublen)) {
                 return a;
             }
             ++a;
@@ -79,6 +88,29 @@ const uint8_t* ts::LocateZeroZero(const void* area, size_t area_size, uint8_t th
     return nullptr;
 }
 
+const uint8_t* ts::LocateZeroZero(const void* area, size_t area_size, uint8_t third1, uint8_t third2)
+{
+    const uint8_t* a = reinterpret_cast<const uint8_t*>(area);
+    while (area_size >= 3) {
+        const uint8_t* next = reinterpret_cast<const uint8_t*>(std::memchr(a, 0x00, area_size - 2));
+        if (next == nullptr) {
+            return nullptr;
+        }
+        else if (next[1] != 0x00) {
+            area_size -= (next - a) + 2;
+            a = next + 2;
+        }
+        else if (next[2] == third1 || next[2] == third2) {
+            return next;
+        }
+        else {
+            area_size -= (next - a) + 1;
+            a = next + 1;
+        }
+    }
+    return nullptr;
+}
+
 
 //----------------------------------------------------------------------------
 // Check if a memory area contains all identical byte values.
@@ -143,6 +143,18 @@ namespace ts {
     //!
     TSCOREDLL const uint8_t* LocateZeroZero(const void* area, size_t area_size, uint8_t third);
 
+    //!
+    //! Locate a 3-byte pattern 00 00 XY or 00 00 XZ into a memory area.
+    //! Same as LocateZeroZero() with one single scan for two alternative third bytes.
+    //! @ingroup cpp
+    //! @param [in] area Address of a memory area to check.
+    //! @param [in] area_size Size in bytes of the memory area.
+    //! @param [in] third1 First allowed value for the third byte of the pattern, after 00 00.
+    //! @param [in] third2 Second allowed value for the third byte of the pattern, after 00 00.
+    //! @return Address of the first occurence of a 3-byte pattern in @a area or the null pointer if not found.
+    //!
+    TSCOREDLL const uint8_t* LocateZeroZero(const void* area, size_t area_size, uint8_t third1, uint8_t third2);
+
     //!
     //! Check if a memory area contains all identical byte values.
     //! @ingroup cpp
@@ -13,6 +13,7 @@
 #define TS_ALLOW_IMPLICIT_UTF8_CONVERSION 1
 
 #include "tsUString.h"
+#include "tsAllocProfile.h"
 #include "tsByteBlock.h"
 #include "tsEnvironment.h"
 #include "tsIntegerUtils.h"
@@ -86,6 +87,28 @@ void ts::UString::ConvertUTF16ToUTF8(const UChar*& in_start, const UChar* in_end
 
     while (in_start < in_end && out_start < out_end) {
 
+        // Bulk processing of ASCII characters, the overwhelming case in practice.
+        // Check the input 4 characters at a time: if all 4 are below 0x80, they
+        // are simply truncated into the output. OR-ing the values instead of
+        // loading a 64-bit word keeps the check endian-neutral and the inner
+        // loops are trivially vectorized by the compilers.
+        while (in_start + 4 <= in_end && out_start + 4 <= out_end) {
+            if ((in_start[0] | in_start[1] | in_start[2] | in_start[3]) >= 0x80) {
+                // At least one non-ASCII character, revert to the general loop.
+                break;
+            }
+            for (size_t i = 0; i < 4; ++i) {
+                out_start[i] = char(in_start[i]);
+            }
+            in_start += 4;
+            out_start += 4;
+        }
+        if (in_start >= in_end || out_start >= out_end) {
+            // The bulk loop may have exhausted the input or filled the output.
+            // The scalar code below is only safe when there is room for one more output unit.
+            break;
+        }
+
         // Get current code point as 16-bit value.
         code = *in_start++;
 
@@ -197,6 +220,29 @@ void ts::UString::ConvertUTF8ToUTF16(const char*& in_start, const char* in_end,
 
     while (in_start < in_end && out_start < out_end) {
 
+        // Bulk processing of ASCII characters, the overwhelming case in practice.
+        // Check the input 8 bytes at a time: if no byte has its most significant
+        // bit set, all 8 are ASCII and are simply zero-extended into the output.
+        // The inner loops are trivially vectorized by the compilers.
+        while (in_start + 8 <= in_end && out_start + 8 <= out_end) {
+            uint64_t word = 0;
+            std::memcpy(&word, in_start, 8);
+            if ((word & 0x8080808080808080) != 0) {
+                // At least one non-ASCII byte, revert to the general loop.
+                break;
+            }
+            for (size_t i = 0; i < 8; ++i) {
+                out_start[i] = uint16_t(uint8_t(in_start[i]));
+            }
+            in_start += 8;
+            out_start += 8;
+        }
+        if (in_start >= in_end || out_start >= out_end) {
+            // The bulk loop may have exhausted the input or filled the output.
+            // The scalar code below is only safe when there is room for one more output unit.
+            break;
+        }
+
         // Get current code point at 8-bit value.
         code = *in_start++ & 0xFF;
 
@@ -304,6 +350,13 @@ ts::UString ts::UString::FromUTF8(const char* utf8, size_type count)
     return str;
 }
 
+ts::UString ts::UString::FromUTF8(const std::string_view& utf8)
+{
+    UString str;
+    str.assignFromUTF8(utf8);
+    return str;
+}
+
 
 //----------------------------------------------------------------------------
 // Convert an UTF-8 string into this object.
@@ -322,6 +375,7 @@ ts::UString& ts::UString::assignFromUTF8(const char* utf8, size_type count)
     else {
         // Resize the string over the maximum size.
         // The number of UTF-16 codes is always less than or equal to the number of UTF-8 bytes.
+        TS_ALLOC_TRACE("UString::assignFromUTF8", count * sizeof(UChar));
         resize(count);
 
         // Convert from UTF-8 directly into this object.
@@ -355,6 +409,7 @@ void ts::UString::toUTF8(ByteBlock& utf8) const
 void ts::UString::appendUTF8(ByteBlock& utf8) const
 {
     // The maximum number of UTF-8 bytes is 3 times the number of UTF-16 codes.
+    TS_ALLOC_TRACE("UString::appendUTF8(ByteBlock)", 3 * size());
     const size_t previous_size = utf8.size();
     utf8.resize(previous_size + 3 * size());
 
@@ -375,6 +430,7 @@ void ts::UString::toUTF8(std::string& utf8) const
 void ts::UString::appendUTF8(std::string& utf8) const
 {
     // The maximum number of UTF-8 bytes is 3 times the number of UTF-16 codes.
+    TS_ALLOC_TRACE("UString::appendUTF8(string)", 3 * size());
     const size_t previous_size = utf8.size();
     utf8.resize(previous_size + 3 * size());
 
@@ -1284,7 +1340,23 @@ ts::UString ts::UString::fromJSON() const
 
 void ts::UString::convertToJSON()
 {
-    for (size_type i = 0; i < length(); ) {
+    // First pass: locate the first character which needs to be escaped.
+    // In the most common case, there is none and the string is left untouched,
+    // without reallocation. This is called once per string in JSON output.
+    size_type first = 0;
+    while (first < length() && at(first) >= 0x0020 && at(first) <= 0x007E && at(first) != QUOTATION_MARK && at(first) != REVERSE_SOLIDUS) {
+        ++first;
+    }
+    if (first >= length()) {
+        return;
+    }
+
+    // Second pass: rebuild the escaped string in one single buffer,
+    // instead of repeatedly inserting escape sequences in place.
+    UString result;
+    result.reserve(length() + 16);
+    result.append(*this, 0, first);
+    for (size_type i = first; i < length(); ++i) {
         const UChar c = at(i);
 
         // Known backslash sequences.
@@ -1302,21 +1374,20 @@ void ts::UString::convertToJSON()
 
         if (quoted != CHAR_NULL) {
             // Single character backslash sequence
-            at(i) = REVERSE_SOLIDUS;
-            insert(i + 1, 1, quoted);
-            i += 2;
+            result.push_back(REVERSE_SOLIDUS);
+            result.push_back(quoted);
         }
         else if (c >= 0x0020 && c <= 0x007E) {
             // Unmodified character
-            i++;
+            result.push_back(c);
         }
         else {
             // Other Unicode character, use hex code.
-            at(i) = REVERSE_SOLIDUS;
-            insert(i + 1, Format(u"u%04X", uint16_t(c)));
-            i += 6;
+            result.push_back(REVERSE_SOLIDUS);
+            result.append(Format(u"u%04X", uint16_t(c)));
         }
     }
+    swap(result);
 }
 
 void ts::UString::convertFromJSON()
@@ -2050,10 +2121,14 @@ void ts::UString::appendDump(const void *data,
 void ts::UString::formatHelper(const UChar* fmt, std::initializer_list<ArgMixIn> args)
 {
     // Pre-reserve some space. We don't really know how much. Just address the most common cases.
+    const size_type previous_size = length();
     reserve(256);
 
     // Process the string.
     ArgMixInContext ctx(*this, fmt, args);
+
+    // The formatted characters were appended to this string.
+    TS_ALLOC_TRACE("UString::format", (length() - previous_size) * sizeof(UChar));
 }
 
 
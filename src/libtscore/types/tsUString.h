@@ -457,6 +457,13 @@ namespace ts {
         //!
         static UString FromUTF8(const char* utf8, size_type count);
 
+        //!
+        //! Convert an UTF-8 string into UTF-16.
+        //! @param [in] utf8 A view over a string in UTF-8 representation.
+        //! @return The equivalent UTF-16 string.
+        //!
+        static UString FromUTF8(const std::string_view& utf8);
+
         //!
         //! Convert an UTF-8 string into this object.
         //! @param [in] utf8 A string in UTF-8 representation.
@@ -467,6 +474,16 @@ namespace ts {
             return assignFromUTF8(utf8.data(), utf8.size());
         }
 
+        //!
+        //! Convert an UTF-8 string into this object.
+        //! @param [in] utf8 A view over a string in UTF-8 representation.
+        //! @return A reference to this object.
+        //!
+        UString& assignFromUTF8(const std::string_view& utf8)
+        {
+            return assignFromUTF8(utf8.data(), utf8.size());
+        }
+
         //!
         //! Convert an UTF-8 string into this object.
         //! @param [in] utf8 Address of a nul-terminated string in UTF-8 representation.
@@ -2272,6 +2289,93 @@ namespace ts {
             return result;
         }
 
+        //!
+        //! Check the validity of a format string for format(), at compile time when possible.
+        //!
+        //! The validation is purely syntactic and mirrors what format() accepts: each '\%'
+        //! sequence must be either "%%" or a valid combination of options and command letter.
+        //! When @a arg_count is specified, the number of arguments which the format consumes
+        //! (including "%*" size specifiers, excluding "%<" reused arguments) must match.
+        //!
+        //! Since this function is constexpr, a literal format string can be checked at compile
+        //! time using static_assert, without relying on the environment variable
+        //! TSDUCK_FORMAT_DEBUG at run time. The run time behaviour of format() is unchanged:
+        //! invalid sequences are still silently ignored.
+        //!
+        //! @param [in] fmt Format string with embedded '\%' sequences.
+        //! @param [in] arg_count Expected number of arguments. NPOS means do not check the argument count.
+        //! @return True if @a fmt is syntactically valid and consumes exactly @a arg_count arguments.
+        //!
+        static constexpr bool ValidFormat(const UChar* fmt, size_t arg_count = NPOS)
+        {
+            size_t used = 0;
+            while (*fmt != u'\0') {
+                if (*fmt++ != u'%') {
+                    // Literal character.
+                    continue;
+                }
+                if (*fmt == u'%') {
+                    // Literal '%'.
+                    ++fmt;
+                    continue;
+                }
+                // Optional flags, in the order which is accepted by format().
+                bool reuse_previous = false;
+                if (*fmt == u'<') {
+                    reuse_previous = true;
+                    ++fmt;
+                }
+                if (*fmt == u'-') {
+                    ++fmt;
+                }
+                if (*fmt == u'+') {
+                    ++fmt;
+                }
+                if (*fmt == u'0') {
+                    ++fmt;
+                }
+                // Minimum field width, either a literal or taken from the argument list.
+                if (*fmt == u'*') {
+                    ++used;
+                    ++fmt;
+                }
+                else {
+                    while (*fmt >= u'0' && *fmt <= u'9') {
+                        ++fmt;
+                    }
+                }
+                // Maximum field width or precision.
+                if (*fmt == u'.') {
+                    ++fmt;
+                    if (*fmt == u'*') {
+                        ++used;
+                        ++fmt;
+                    }
+                    else {
+                        while (*fmt >= u'0' && *fmt <= u'9') {
+                            ++fmt;
+                        }
+                    }
+                }
+                if (*fmt == u'\'') {
+                    ++fmt;
+                }
+                if (*fmt == u'!') {
+                    ++fmt;
+                }
+                // Command letter.
+                const UChar cmd = *fmt;
+                if (cmd != u's' && cmd != u'c' && cmd != u'd' && cmd != u'x' && cmd != u'X' && cmd != u'n' && cmd != u'f') {
+                    return false;
+                }
+                ++fmt;
+                if (!reuse_previous) {
+                    ++used;
+                }
+            }
+            return arg_count == NPOS || used == arg_count;
+        }
+
         //!
         //! Scan this string for integer or character values using a template and arguments.
         //!
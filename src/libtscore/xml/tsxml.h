@@ -48,6 +48,8 @@ namespace ts {
         class Document;
         class ModelDocument;
         class PatchDocument;
+        class StreamingDocument;
+        class StreamingDocumentHandler;
 
         //!
         //! Vector of constant elements.
@@ -886,9 +886,37 @@ void ts::xml::Element::printClose(TextFormatter& output, size_t levels) const
 //----------------------------------------------------------------------------
 
 bool ts::xml::Element::parseNode(TextParser& parser, const Node* parent)
+{
+    // Parse the tag name and attributes.
+    bool standalone = false;
+    if (!parseTag(parser, standalone)) {
+        return false;
+    }
+
+    // A standalone tag has no children and no closing tag.
+    if (standalone) {
+        return true;
+    }
+
+    // End of tag, swallow all children.
+    if (!parseChildren(parser)) {
+        return false;
+    }
+
+    // We now must be at "</tag>".
+    return parseClosingTag(parser);
+}
+
+
+//----------------------------------------------------------------------------
+// Parse the tag name and attributes, after the leading "<" was read.
+//----------------------------------------------------------------------------
+
+bool ts::xml::Element::parseTag(TextParser& parser, bool& standalone)
 {
     // We just read the "<". Skip spaces and read the tag name.
     UString nodeName;
+    standalone = false;
     parser.skipWhiteSpace();
     if (!parser.parseXMLName(nodeName)) {
         report().error(u"line %d: parsing error, tag name expected", parser.lineNumber());
@@ -913,6 +941,7 @@ bool ts::xml::Element::parseNode(TextParser& parser, const Node* parent)
         }
         else if (parser.match(u"/>", true)) {
             // Found end of standalone tag, without children.
+            standalone = true;
             return true;
         }
         else if (parser.parseXMLName(attrName)) {
@@ -967,16 +996,18 @@ bool ts::xml::Element::parseNode(TextParser& parser, const Node* parent)
     if (!ok) {
         UString ignored;
         parser.parseText(ignored, u">", true, false);
-        return false;
     }
+    return ok;
+}
 
-    // End of tag, swallow all children.
-    if (!parseChildren(parser)) {
-        return false;
-    }
 
-    // We now must be at "</tag>".
-    ok = parser.match(u"</", true);
+//----------------------------------------------------------------------------
+// Parse the closing tag "</name>" of this element.
+//----------------------------------------------------------------------------
+
+bool ts::xml::Element::parseClosingTag(TextParser& parser)
+{
+    bool ok = parser.match(u"</", true);
     if (ok) {
         UString endTag;
         ok = parser.skipWhiteSpace() && parser.parseXMLName(endTag) && parser.skipWhiteSpace() && endTag.similar(value());
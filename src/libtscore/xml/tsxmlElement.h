@@ -915,6 +915,16 @@ namespace ts::xml {
         // Inherited from xml::Node.
         virtual bool parseNode(TextParser& parser, const Node* parent) override;
 
+        // Parse the tag name and attributes, after the leading "<" was read.
+        // Set standalone to true when the tag ends with "/>" (no children, no closing tag).
+        bool parseTag(TextParser& parser, bool& standalone);
+
+        // Parse the closing tag "</name>" of this element.
+        bool parseClosingTag(TextParser& parser);
+
+        // The streaming document parses elements by steps, using the two methods above.
+        friend class StreamingDocument;
+
     private:
         CaseSensitivity _attribute_case = CASE_INSENSITIVE; // For attribute names.
         AttributeMap _attributes {};
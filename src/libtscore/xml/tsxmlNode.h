@@ -364,6 +364,9 @@ namespace ts::xml {
         //!
         void setPreserveSpace(bool on) { _preserveSpace = on; }
 
+        // The streaming document drives the parsing of nodes one by one.
+        friend class StreamingDocument;
+
     private:
         Report& _report;                // Where to report errors.
         UString _value {};              // Value of the node, depend on the node type.
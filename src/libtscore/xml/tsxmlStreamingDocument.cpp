@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsxmlStreamingDocument.h"
+#include "tsxmlElement.h"
+#include "tsxmlComment.h"
+#include "tsFileUtils.h"
+
+
+//----------------------------------------------------------------------------
+// Constructor.
+//----------------------------------------------------------------------------
+
+ts::xml::StreamingDocument::StreamingDocument(StreamingDocumentHandler* handler, Report& report) :
+    Document(report),
+    _handler(handler)
+{
+}
+
+
+//----------------------------------------------------------------------------
+// Parse an XML file on the fly.
+//----------------------------------------------------------------------------
+
+bool ts::xml::StreamingDocument::scanFile(const UString& fileName, bool search)
+{
+    // Specific case of inline XML content, when the string is not the name of a file but directly an XML content.
+    if (IsInlineXML(fileName)) {
+        TextParser parser(report());
+        parser.loadDocument(fileName);
+        return scan(parser);
+    }
+
+    // Specific case of the standard input.
+    if (fileName.empty() || fileName == u"-") {
+        return scanStream(std::cin);
+    }
+
+    // Actual file name to load after optional search in directories.
+    const UString actualFileName(search ? SearchConfigurationFile(fileName) : fileName);
+
+    // Eliminate non-existent files.
+    if (actualFileName.empty()) {
+        report().error(u"file not found: %s", fileName);
+        return false;
+    }
+
+    // Parse the document from the file.
+    TextParser parser(report());
+    report().debug(u"loading XML file %s", actualFileName);
+    return parser.loadFile(actualFileName) && scan(parser);
+}
+
+
+//----------------------------------------------------------------------------
+// Parse an XML stream on the fly.
+//----------------------------------------------------------------------------
+
+bool ts::xml::StreamingDocument::scanStream(std::istream& strm)
+{
+    TextParser parser(report());
+    return parser.loadStream(strm) && scan(parser);
+}
+
+
+//----------------------------------------------------------------------------
+// Common code for scanFile() and scanStream(), parse the full document.
+//----------------------------------------------------------------------------
+
+bool ts::xml::StreamingDocument::scan(TextParser& parser)
+{
+    // Filter incorrect usage.
+    if (_handler == nullptr) {
+        report().error(u"internal error, no handler in streaming XML document");
+        return false;
+    }
+
+    // Cleanup all previous content of the document.
+    clear();
+
+    // Parse the declarations and comments before the root element, keep them in the document.
+    Node* node = nullptr;
+    Element* root = nullptr;
+    while (root == nullptr && (node = identifyNextNode(parser)) != nullptr) {
+        root = dynamic_cast<Element*>(node);
+        if (root == nullptr) {
+            if (node->parseNode(parser, this)) {
+                node->reparent(this);
+            }
+            else {
+                // Error, the node parser has displayed the error message.
+                delete node;
+                return false;
+            }
+        }
+    }
+
+    // Check presence of the root element.
+    if (root == nullptr) {
+        report().error(u"invalid XML document, no root element found");
+        return false;
+    }
+
+    // Parse the root tag with its attributes and keep it in the document, without children.
+    bool standalone = false;
+    if (!root->parseTag(parser, standalone)) {
+        delete root;
+        return false;
+    }
+    root->reparent(this);
+    if (!_handler->handleRootElement(*root)) {
+        // The handler requested to abort the parsing.
+        return false;
+    }
+
+    // Parse the top-level nodes, one by one. Each complete element is passed to the
+    // handler and immediately deleted, the node tree never grows. The text lines which
+    // were already parsed are deleted as well, the memory usage constantly shrinks.
+    while (!standalone && (node = root->identifyNextNode(parser)) != nullptr) {
+        if (!node->parseNode(parser, root)) {
+            delete node;
+            return false;
+        }
+        const Element* elem = dynamic_cast<const Element*>(node);
+        const bool more = elem == nullptr || _handler->handleChildElement(*elem);
+        delete node;
+        if (!more) {
+            // The handler requested to abort the parsing.
+            return false;
+        }
+        parser.trimConsumedLines();
+    }
+
+    // We now must be at the closing tag of the root element.
+    if (!standalone && !root->parseClosingTag(parser)) {
+        return false;
+    }
+
+    // Skip all comments after the root element.
+    while ((node = identifyNextNode(parser)) != nullptr) {
+        if (!node->parseNode(parser, this)) {
+            delete node;
+            return false;
+        }
+        if (dynamic_cast<Comment*>(node) == nullptr) {
+            report().error(u"line %d: trailing %s, invalid XML document, need one single root element", node->lineNumber(), node->typeName());
+            delete node;
+            return false;
+        }
+        node->reparent(this);
+    }
+
+    // We must have reached the end of document.
+    if (!parser.eof()) {
+        report().error(u"line %d: trailing character sequence, invalid XML document", parser.lineNumber());
+        return false;
+    }
+    return true;
+}
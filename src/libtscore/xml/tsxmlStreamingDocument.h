@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Representation of a "streaming" XML document which is parsed on the fly.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsxmlDocument.h"
+#include "tsxmlStreamingDocumentHandler.h"
+
+namespace ts::xml {
+    //!
+    //! Representation of a "streaming" XML document which is parsed on the fly.
+    //! @ingroup libtscore xml
+    //!
+    //! This is the parsing counterpart of RunningDocument. The document is parsed
+    //! element by element. Each top-level element inside the document root is passed
+    //! to a handler and then destroyed. The complete node tree is never built. The
+    //! document text is loaded in one single buffer which shrinks while the parsing
+    //! progresses. Consequently, the memory usage is bounded by the document text
+    //! size, not by the expanded node tree, and decreases during the parsing. This
+    //! is typically used to load very large XML files such as EPG databases.
+    //!
+    //! After a successful scan, this document contains the leading declarations and
+    //! the root element, without children.
+    //!
+    class TSCOREDLL StreamingDocument: public Document
+    {
+        TS_NOCOPY(StreamingDocument);
+    public:
+        //!
+        //! Constructor.
+        //! @param [in] handler Handler which receives the top-level elements of the document.
+        //! The referenced object must remain valid as long as this object.
+        //! @param [in,out] report Where to report errors.
+        //!
+        explicit StreamingDocument(StreamingDocumentHandler* handler, Report& report = NULLREP);
+
+        //!
+        //! Parse an XML file on the fly, invoking the handler for each top-level element.
+        //! @param [in] fileName Name of the XML file to load.
+        //! If @a fileName is empty or "-", read the standard input.
+        //! If @a fileName starts with "<?xml", this is considered as "inline XML content".
+        //! The document is parsed from this string instead of reading a file.
+        //! @param [in] search If true, search the XML file in the TSDuck configuration directories
+        //! if @a fileName is not found and does not contain any directory part.
+        //! @return True on success, false on error or when the handler aborted the parsing.
+        //! @see SearchConfigurationFile()
+        //!
+        bool scanFile(const UString& fileName, bool search = true);
+
+        //!
+        //! Parse an XML stream on the fly, invoking the handler for each top-level element.
+        //! @param [in,out] strm A standard text stream in input mode.
+        //! @return True on success, false on error or when the handler aborted the parsing.
+        //!
+        bool scanStream(std::istream& strm);
+
+    private:
+        StreamingDocumentHandler* const _handler;
+
+        // Common code for scanFile() and scanStream(), parse the full document.
+        bool scan(TextParser& parser);
+    };
+}
@@ -0,0 +1,20 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsxmlStreamingDocumentHandler.h"
+
+// Default implementation of optional handlers.
+bool ts::xml::StreamingDocumentHandler::handleRootElement(const Element& root)
+{
+    return true;
+}
+
+// Virtual destructor.
+ts::xml::StreamingDocumentHandler::~StreamingDocumentHandler()
+{
+}
@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Interface for classes which receive the elements of a streaming XML document.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsxml.h"
+
+namespace ts::xml {
+    //!
+    //! Interface for classes which receive the elements of a streaming XML document.
+    //! @ingroup libtscore xml
+    //! @see StreamingDocument
+    //!
+    class TSCOREDLL StreamingDocumentHandler
+    {
+    public:
+        //!
+        //! Invoked when the root element of the document has been parsed.
+        //! At this stage, the root element contains its attributes but no children.
+        //! This is an optional feature, the default implementation does nothing.
+        //! @param [in] root The root element of the document, without children.
+        //! @return True to continue the parsing, false to abort it.
+        //!
+        virtual bool handleRootElement(const Element& root);
+
+        //!
+        //! Invoked for each complete top-level element inside the document root.
+        //! The element and all its children are valid during the execution of this
+        //! handler only. They are deleted when the handler returns.
+        //! @param [in] element One top-level element inside the root of the document.
+        //! @return True to continue the parsing, false to abort it.
+        //!
+        virtual bool handleChildElement(const Element& element) = 0;
+
+        //!
+        //! Virtual destructor.
+        //!
+        virtual ~StreamingDocumentHandler();
+    };
+}
@@ -226,6 +226,123 @@ bool ts::Zlib::CompressAppend(ByteBlock& out, const void* in, size_t in_size, in
 }
 
 
+//----------------------------------------------------------------------------
+// Compute the IEEE CRC-32 of a data area, as used in the gzip trailer.
+//----------------------------------------------------------------------------
+
+uint32_t ts::Zlib::GzipCRC32(const void* data, size_t size)
+{
+    // Reflected polynomial 0xEDB88320. This is not the same CRC-32 as in MPEG
+    // sections (see ts::CRC32). Bitwise implementation, without lookup table:
+    // this is used on small metrics bodies only, when zlib is not available.
+    uint32_t crc = 0xFFFFFFFF;
+    const uint8_t* cur = reinterpret_cast<const uint8_t*>(data);
+    while (size-- > 0) {
+        crc ^= *cur++;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) != 0 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+
+//----------------------------------------------------------------------------
+// Compress data in gzip format (RFC 1952).
+//----------------------------------------------------------------------------
+
+bool ts::Zlib::GzipCompressAppend(ByteBlock& out, const void* in, size_t in_size, int level, Report& report, bool use_sdefl)
+{
+    [[maybe_unused]] const size_t initial_out_size = out.size();
+
+    // Level shall be in range 0-9.
+    level = std::max(0, std::min(9, level));
+
+#if !defined(TS_NO_ZLIB)
+    if (!use_sdefl) {
+
+        // Compress using zlib. Same processing as CompressAppend() but the stream is
+        // initialized with deflateInit2() and a windowBits value which requests a gzip
+        // wrapper instead of a zlib one.
+        out.resize(initial_out_size + 256 + in_size);
+
+        ::z_stream strm;
+        TS_ZERO(strm);
+        int status = ::deflateInit2(&strm, level, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+        if (!checkZlibStatus(&strm, status, u"deflateInit2", report)) {
+            return false;
+        }
+
+        strm.next_in = reinterpret_cast<decltype(strm.next_in)>(in);
+        strm.avail_in = static_cast<decltype(strm.avail_in)>(in_size);
+        strm.next_out = reinterpret_cast<decltype(strm.next_out)>(out.data() + initial_out_size);
+        strm.avail_out = static_cast<decltype(strm.avail_out)>(out.size() - initial_out_size);
+
+        do {
+            status = ::deflate(&strm, Z_FINISH);
+            if (!checkZlibStatus(&strm, status, u"deflate", report)) {
+                return false;
+            }
+            if (status != Z_STREAM_END && strm.avail_out == 0) {
+                // No enough space in output buffer, resize it.
+                size_t previous = strm.total_out;
+                out.resize(initial_out_size + previous + 10'000);
+                strm.next_out = reinterpret_cast<decltype(strm.next_out)>(out.data() + initial_out_size + previous);
+                strm.avail_out = static_cast<decltype(strm.avail_out)>(out.size() - initial_out_size - previous);
+            }
+        } while (status != Z_STREAM_END);
+
+        // Final size is now known.
+        out.resize(initial_out_size + size_t(strm.total_out));
+
+        status = ::deflateEnd(&strm);
+        return checkZlibStatus(&strm, status, u"deflateEnd", report);
+    }
+#endif
+
+#if !defined(TS_NO_SDEFL)
+    // Fallback to sdefl library: build the gzip wrapper manually around a raw deflate stream.
+    // Gzip header: magic bytes, deflate method, no flag, no time, no extra flag, unknown OS.
+    static const uint8_t header[10] = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF};
+    out.append(header, sizeof(header));
+
+    // Maximum possible size of compressed data.
+    const size_t data_start = out.size();
+    const size_t max_out = size_t(::sdefl_bound(int(in_size)));
+
+    // Resize the output buffer to this size. Since the API of sdefl does not get a maximum output buffer size,
+    // we can only hope that no buffer overflow will occur. And since we are paranoid, we write a canary at the
+    // end of buffer and we will check it later.
+    out.resize(data_start + max_out + 4);
+    constexpr uint32_t canary = 0xDEADBEEF;
+    PutUInt32(out.data() + data_start + max_out, canary);
+
+    // Compress in one call, as a raw deflate stream, without zlib wrapper.
+    ::sdefl data;
+    TS_ZERO(data);
+    const int len = ::sdeflate(&data, out.data() + data_start, in, int(in_size), level);
+    if (len < 0) {
+        report.error(u"sdefl error %d from sdeflate", len);
+        return false;
+    }
+    else if (GetUInt32(out.data() + data_start + max_out) != canary) {
+        report.fatal(u"buffer overflow in sdeflate(), probable memory corruption, expect a crash or worse");
+        return false;
+    }
+    else {
+        // Final size of deflate stream, then gzip trailer: CRC-32 and size of input data, in little endian order.
+        out.resize(data_start + size_t(len));
+        out.appendUInt32LE(GzipCRC32(in, in_size));
+        out.appendUInt32LE(uint32_t(in_size));
+        return true;
+    }
+#else
+    report.error(NO_DEFLATE_SUPPORT);
+    return false;
+#endif
+}
+
+
 //----------------------------------------------------------------------------
 // Decompress data according to the DEFLATE algorithm.
 //----------------------------------------------------------------------------
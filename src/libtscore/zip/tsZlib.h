@@ -108,6 +108,67 @@ namespace ts {
             return CompressAppend(out, in.data(), in.size(), level, report, use_sdefl);
         }
 
+        //!
+        //! Compress data in gzip format (RFC 1952).
+        //! Unlike Compress(), the output data are wrapped in a gzip header and trailer instead of
+        //! a zlib wrapper. This is the format which is expected in HTTP requests and responses
+        //! with "Content-Encoding: gzip".
+        //! @param [out] out Output compressed data.
+        //! @param [in] in Address of input data.
+        //! @param [in] in_size Size in bytes of input data.
+        //! @param [in] level Requested compression level, from 0 to 9.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] use_sdefl If true, force the usage of "sdefl" library. By default, use "zlib" on UNIX systems and "sdefl" on Windows.
+        //! @return True on success, false on error.
+        //! @see RFC 1952 GZIP file format specification version 4.3
+        //!
+        static bool GzipCompress(ByteBlock& out, const void* in, size_t in_size, int level, Report& report = NULLREP, bool use_sdefl = false)
+        {
+            out.clear();
+            return GzipCompressAppend(out, in, in_size, level, report, use_sdefl);
+        }
+
+        //!
+        //! Compress data in gzip format (RFC 1952).
+        //! @param [out] out Output compressed data.
+        //! @param [in] in Input data.
+        //! @param [in] level Requested compression level, from 0 to 9.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] use_sdefl If true, force the usage of "sdefl" library. By default, use "zlib" on UNIX systems and "sdefl" on Windows.
+        //! @return True on success, false on error.
+        //!
+        static bool GzipCompress(ByteBlock& out, const ByteBlock& in, int level, Report& report = NULLREP, bool use_sdefl = false)
+        {
+            out.clear();
+            return GzipCompressAppend(out, in.data(), in.size(), level, report, use_sdefl);
+        }
+
+        //!
+        //! Compress data in gzip format (RFC 1952).
+        //! @param [in,out] out Output compressed data are appended at the end of the existing content.
+        //! @param [in] in Address of input data.
+        //! @param [in] in_size Size in bytes of input data.
+        //! @param [in] level Requested compression level, from 0 to 9.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] use_sdefl If true, force the usage of "sdefl" library. By default, use "zlib" on UNIX systems and "sdefl" on Windows.
+        //! @return True on success, false on error.
+        //!
+        static bool GzipCompressAppend(ByteBlock& out, const void* in, size_t in_size, int level, Report& report = NULLREP, bool use_sdefl = false);
+
+        //!
+        //! Compress data in gzip format (RFC 1952).
+        //! @param [in,out] out Output compressed data are appended at the end of the existing content.
+        //! @param [in] in Input data.
+        //! @param [in] level Requested compression level, from 0 to 9.
+        //! @param [in,out] report Where to report errors.
+        //! @param [in] use_sdefl If true, force the usage of "sdefl" library. By default, use "zlib" on UNIX systems and "sdefl" on Windows.
+        //! @return True on success, false on error.
+        //!
+        static bool GzipCompressAppend(ByteBlock& out, const ByteBlock& in, int level, Report& report = NULLREP, bool use_sdefl = false)
+        {
+            return GzipCompressAppend(out, in.data(), in.size(), level, report, use_sdefl);
+        }
+
         //!
         //! Decompress data according to the DEFLATE algorithm.
         //! @param [out] out Output decompressed data.
@@ -164,5 +225,8 @@ namespace ts {
     private:
         // Check a zlib status, return true on success, false on error.
         static bool checkZlibStatus(void* stream, int status, const UChar* func, Report& report);
+
+        // Compute the IEEE CRC-32 of a data area, as used in the gzip trailer.
+        static uint32_t GzipCRC32(const void* data, size_t size);
     };
 }
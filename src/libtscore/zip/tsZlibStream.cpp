@@ -0,0 +1,270 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsZlibStream.h"
+#include "tsMemory.h"
+
+// Streaming compression requires the real zlib library. The "sdefl" fallback
+// (Windows by default and when TS_NO_ZLIB is defined) only processes complete
+// memory buffers and cannot be used here.
+#if defined(TS_WINDOWS) && !defined(TS_NO_ZLIB)
+    #define TS_NO_ZLIB 1
+#endif
+
+// Include zlib.
+#if !defined(TS_NO_ZLIB)
+    #if !defined(ZLIB_CONST)
+        #define ZLIB_CONST 1
+    #endif
+    #include <zlib.h>
+#endif
+
+#define NO_STREAMING_SUPPORT u"This version of TSDuck was compiled without zlib support, streaming compression is not available"
+
+
+//----------------------------------------------------------------------------
+// Check if streaming compression is supported.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::Supported()
+{
+#if defined(TS_NO_ZLIB)
+    return false;
+#else
+    return true;
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Destructor.
+//----------------------------------------------------------------------------
+
+ts::ZlibStream::~ZlibStream()
+{
+    close(NULLREP);
+}
+
+
+#if !defined(TS_NO_ZLIB)
+//----------------------------------------------------------------------------
+// Check a zlib status, return true on success, false on error.
+//----------------------------------------------------------------------------
+
+namespace {
+    bool CheckZlibStatus(::z_stream* strm, int status, const ts::UChar* func, ts::Report& report)
+    {
+        if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+            ts::UString msg;
+            msg.format(u"zlib error %d from %s", status, func);
+            if (strm != nullptr && strm->msg != nullptr) {
+                msg.format(u", %s", strm->msg);
+            }
+            report.error(msg);
+            return false;
+        }
+        return true;
+    }
+}
+#endif
+
+
+//----------------------------------------------------------------------------
+// Open the stream in decompression mode.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::openInflate(Report& report)
+{
+#if defined(TS_NO_ZLIB)
+    report.error(NO_STREAMING_SUPPORT);
+    return false;
+#else
+    if (_mode != Mode::CLOSED) {
+        report.error(u"compression stream already open");
+        return false;
+    }
+    ::z_stream* strm = new ::z_stream;
+    TS_ZERO(*strm);
+    // 32 + MAX_WBITS: automatic detection of the gzip or zlib wrapper.
+    const int status = ::inflateInit2(strm, 32 + MAX_WBITS);
+    if (!CheckZlibStatus(strm, status, u"inflateInit2", report)) {
+        delete strm;
+        return false;
+    }
+    _zstream = strm;
+    _mode = Mode::INFLATE;
+    _eos = false;
+    return true;
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Open the stream in compression mode.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::openDeflate(int level, Report& report)
+{
+#if defined(TS_NO_ZLIB)
+    report.error(NO_STREAMING_SUPPORT);
+    return false;
+#else
+    if (_mode != Mode::CLOSED) {
+        report.error(u"compression stream already open");
+        return false;
+    }
+    level = std::max(0, std::min(9, level));
+    ::z_stream* strm = new ::z_stream;
+    TS_ZERO(*strm);
+    // 16 + MAX_WBITS: produce a gzip wrapper instead of a zlib one.
+    const int status = ::deflateInit2(strm, level, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (!CheckZlibStatus(strm, status, u"deflateInit2", report)) {
+        delete strm;
+        return false;
+    }
+    _zstream = strm;
+    _mode = Mode::DEFLATE;
+    _eos = false;
+    return true;
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Close the stream and release the compression state.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::close(Report& report)
+{
+    bool success = true;
+#if !defined(TS_NO_ZLIB)
+    ::z_stream* strm = reinterpret_cast<::z_stream*>(_zstream);
+    if (strm != nullptr) {
+        if (_mode == Mode::INFLATE) {
+            success = CheckZlibStatus(strm, ::inflateEnd(strm), u"inflateEnd", report);
+        }
+        else if (_mode == Mode::DEFLATE) {
+            // Z_DATA_ERROR simply means that the stream was not properly finished, ignore it.
+            const int status = ::deflateEnd(strm);
+            success = status == Z_DATA_ERROR || CheckZlibStatus(strm, status, u"deflateEnd", report);
+        }
+        delete strm;
+    }
+#endif
+    _zstream = nullptr;
+    _mode = Mode::CLOSED;
+    _eos = false;
+    return success;
+}
+
+
+//----------------------------------------------------------------------------
+// Decompress a chunk of data.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::inflate(void* out, size_t out_max, size_t& out_size, const void* in, size_t in_size, size_t& in_used, Report& report)
+{
+    out_size = 0;
+    in_used = 0;
+#if defined(TS_NO_ZLIB)
+    report.error(NO_STREAMING_SUPPORT);
+    return false;
+#else
+    if (_mode != Mode::INFLATE) {
+        report.error(u"decompression stream not open");
+        return false;
+    }
+    if (_eos) {
+        // End of compressed stream already reached, leave the remaining input untouched.
+        return true;
+    }
+
+    ::z_stream* strm = reinterpret_cast<::z_stream*>(_zstream);
+    strm->next_in = reinterpret_cast<decltype(strm->next_in)>(in);
+    strm->avail_in = static_cast<decltype(strm->avail_in)>(in_size);
+    strm->next_out = reinterpret_cast<decltype(strm->next_out)>(out);
+    strm->avail_out = static_cast<decltype(strm->avail_out)>(out_max);
+
+    const int status = ::inflate(strm, Z_NO_FLUSH);
+    if (!CheckZlibStatus(strm, status, u"inflate", report)) {
+        return false;
+    }
+
+    in_used = in_size - size_t(strm->avail_in);
+    out_size = out_max - size_t(strm->avail_out);
+    _eos = status == Z_STREAM_END;
+    return true;
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Compress a chunk of data.
+//----------------------------------------------------------------------------
+
+#if !defined(TS_NO_ZLIB)
+bool ts::ZlibStream::deflateStep(ByteBlock& out, const void* in, size_t in_size, int flush, Report& report)
+{
+    ::z_stream* strm = reinterpret_cast<::z_stream*>(_zstream);
+    strm->next_in = reinterpret_cast<decltype(strm->next_in)>(in);
+    strm->avail_in = static_cast<decltype(strm->avail_in)>(in_size);
+
+    // Loop on deflate() as long as it can produce output.
+    uint8_t chunk[65536];
+    for (;;) {
+        strm->next_out = reinterpret_cast<decltype(strm->next_out)>(chunk);
+        strm->avail_out = static_cast<decltype(strm->avail_out)>(sizeof(chunk));
+        const int status = ::deflate(strm, flush);
+        if (!CheckZlibStatus(strm, status, u"deflate", report)) {
+            return false;
+        }
+        out.append(chunk, sizeof(chunk) - size_t(strm->avail_out));
+        if (status == Z_STREAM_END) {
+            _eos = true;
+            return true;
+        }
+        if (strm->avail_in == 0 && (flush == Z_NO_FLUSH || status == Z_BUF_ERROR)) {
+            // All input consumed (and, with Z_FINISH, no more output pending).
+            return true;
+        }
+    }
+}
+#endif
+
+bool ts::ZlibStream::deflate(ByteBlock& out, const void* in, size_t in_size, Report& report)
+{
+#if defined(TS_NO_ZLIB)
+    report.error(NO_STREAMING_SUPPORT);
+    return false;
+#else
+    if (_mode != Mode::DEFLATE || _eos) {
+        report.error(u"compression stream not open");
+        return false;
+    }
+    return deflateStep(out, in, in_size, Z_NO_FLUSH, report);
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+// Terminate the compressed stream.
+//----------------------------------------------------------------------------
+
+bool ts::ZlibStream::finishDeflate(ByteBlock& out, Report& report)
+{
+#if defined(TS_NO_ZLIB)
+    report.error(NO_STREAMING_SUPPORT);
+    return false;
+#else
+    if (_mode != Mode::DEFLATE || _eos) {
+        report.error(u"compression stream not open");
+        return false;
+    }
+    return deflateStep(out, nullptr, 0, Z_FINISH, report);
+#endif
+}
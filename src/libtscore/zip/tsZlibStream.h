@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Streaming interface to zlib and gzip compressed data.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsByteBlock.h"
+#include "tsNullReport.h"
+
+namespace ts {
+    //!
+    //! Streaming interface to zlib and gzip compressed data.
+    //! @ingroup libtscore system
+    //!
+    //! Unlike the class Zlib, which processes complete memory buffers, this class
+    //! maintains the state of a compressed stream and processes data chunk by chunk,
+    //! with a bounded memory footprint. It is typically used to read or write large
+    //! gzip-compressed files without loading them in memory.
+    //!
+    //! This implementation requires the zlib library. On platforms where the "Small
+    //! Deflate" fallback is used instead (Windows by default, or when the macro
+    //! TS_NO_ZLIB is defined), streaming is not supported and the open methods fail
+    //! with an error message.
+    //!
+    class TSCOREDLL ZlibStream
+    {
+        TS_NOCOPY(ZlibStream);
+    public:
+        //!
+        //! Default constructor.
+        //!
+        ZlibStream() = default;
+
+        //!
+        //! Destructor.
+        //!
+        ~ZlibStream();
+
+        //!
+        //! Check if streaming compression is supported.
+        //! @return True if the zlib library is available, false when only "Small Deflate" is compiled in.
+        //!
+        static bool Supported();
+
+        //!
+        //! Open the stream in decompression mode.
+        //! The compressed input can use a gzip or zlib wrapper, the format is automatically detected.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool openInflate(Report& report = NULLREP);
+
+        //!
+        //! Open the stream in compression mode, producing data in gzip format (RFC 1952).
+        //! @param [in] level Requested compression level, from 0 to 9.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool openDeflate(int level, Report& report = NULLREP);
+
+        //!
+        //! Check if the stream is open.
+        //! @return True if the stream is open.
+        //!
+        bool isOpen() const { return _mode != Mode::CLOSED; }
+
+        //!
+        //! Close the stream and release the compression state.
+        //! In compression mode, finishDeflate() shall have been called first,
+        //! otherwise the compressed output is truncated.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool close(Report& report = NULLREP);
+
+        //!
+        //! Decompress a chunk of data (decompression mode).
+        //! Consume some input data and produce as much output data as possible.
+        //! The call returns as soon as some output is produced or more input is needed.
+        //! @param [out] out Address of the output buffer for decompressed data.
+        //! @param [in] out_max Size in bytes of the output buffer.
+        //! @param [out] out_size Number of decompressed bytes which were produced.
+        //! @param [in] in Address of the next compressed input data.
+        //! @param [in] in_size Size in bytes of the compressed input data.
+        //! @param [out] in_used Number of input bytes which were consumed.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool inflate(void* out, size_t out_max, size_t& out_size, const void* in, size_t in_size, size_t& in_used, Report& report = NULLREP);
+
+        //!
+        //! Check if the end of the compressed stream was reached (decompression mode).
+        //! With concatenated gzip files, this is the end of one gzip member only.
+        //! Close and reopen the stream to decompress the next member.
+        //! @return True if the end of the compressed stream was reached.
+        //!
+        bool endOfStream() const { return _eos; }
+
+        //!
+        //! Compress a chunk of data (compression mode).
+        //! @param [in,out] out The compressed data are appended at the end of the existing content.
+        //! @param [in] in Address of input data.
+        //! @param [in] in_size Size in bytes of input data.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool deflate(ByteBlock& out, const void* in, size_t in_size, Report& report = NULLREP);
+
+        //!
+        //! Terminate the compressed stream (compression mode).
+        //! Flush all pending compressed data and append the stream trailer.
+        //! The stream shall then be closed, no more data can be compressed.
+        //! @param [in,out] out The compressed data are appended at the end of the existing content.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool finishDeflate(ByteBlock& out, Report& report = NULLREP);
+
+    private:
+        // Direction of an open stream.
+        enum class Mode {CLOSED, INFLATE, DEFLATE};
+
+        Mode  _mode = Mode::CLOSED;
+        bool  _eos = false;
+        void* _zstream = nullptr;  // opaque ::z_stream, zlib types are not exposed in this header
+
+        // Run one deflate step with the given flush mode, append the output.
+        bool deflateStep(ByteBlock& out, const void* in, size_t in_size, int flush, Report& report);
+    };
+}
@@ -1789,14 +1789,20 @@ bool ts::DektecOutputPlugin::send(const TSPacket* buffer, const TSPacketMetadata
 
             if ((fifo_load + cursize) > _guts->fifo_size) {
                 // Wait for the FIFO to be partially cleared to make room for
-                // new packets.  Sleep for a short amount of time to minimize the chance
-                // that packets are written slightly later than they ought to be written
-                // to the output.  This approach mirrors that used in Dektec's DtPlay sample.
-                // If packets are written too quickly, without checking the size of the FIFO,
-                // it can result in overflows, per information in the DTAPI documentation.
-                // Also, this approach fulfills the promise of a "real-time" plug-in, and the
-                // Dektec output plug-in indicates that it is a real-time plug-in.
-                std::this_thread::sleep_for(cn::milliseconds(1));
+                // new packets.  If packets are written too quickly, without checking
+                // the size of the FIFO, it can result in overflows, per information
+                // in the DTAPI documentation.  Dektec's DtPlay sample polls the load
+                // every millisecond.  When the bitrate is known, we compute instead
+                // how long the hardware needs to drain the excess and sleep just that
+                // long, so that the whole chunk is then written in a single DMA
+                // transfer, without repeated load polling.  The wait is capped to
+                // remain responsive when the bitrate is reduced in the meantime.
+                cn::milliseconds wait = cn::milliseconds(1);
+                if (_guts->cur_bitrate > 0) {
+                    const int excess = (fifo_load + cursize) - _guts->fifo_size;
+                    wait = std::clamp(ByteInterval<cn::milliseconds>(_guts->cur_bitrate, excess), cn::milliseconds(1), cn::milliseconds(20));
+                }
+                std::this_thread::sleep_for(wait);
                 continue;
             }
 
@@ -1809,27 +1815,29 @@ bool ts::DektecOutputPlugin::send(const TSPacket* buffer, const TSPacketMetadata
             return false;
         }
 
-        if (!_guts->starting) {
-            int statusFlags, latched;
-            status = _guts->chan.GetFlags(statusFlags, latched);
-            if (status == DTAPI_OK) {
-                if (latched) {
-                    if ((latched & DTAPI_TX_CPU_UFL) != 0) {
-                        tsp->verbose(u"Got CPU underflow.");
-                    }
-                    if ((latched & DTAPI_TX_DMA_UFL) != 0) {
-                        tsp->verbose(u"Got DMA underflow.");
-                    }
-                    if ((latched & DTAPI_TX_FIFO_UFL) != 0) {
-                        tsp->verbose(u"Got FIFO underflow.");
-                    }
-                    _guts->chan.ClearFlags(latched);
+        data += cursize;
+        remain -= cursize;
+    }
+
+    // Check the latched underflow flags once per send() operation. The flags are
+    // cumulative in the hardware, checking them per chunk only added ioctl's.
+    if (!_guts->starting) {
+        int statusFlags, latched;
+        status = _guts->chan.GetFlags(statusFlags, latched);
+        if (status == DTAPI_OK) {
+            if (latched) {
+                if ((latched & DTAPI_TX_CPU_UFL) != 0) {
+                    tsp->verbose(u"Got CPU underflow.");
+                }
+                if ((latched & DTAPI_TX_DMA_UFL) != 0) {
+                    tsp->verbose(u"Got DMA underflow.");
+                }
+                if ((latched & DTAPI_TX_FIFO_UFL) != 0) {
+                    tsp->verbose(u"Got FIFO underflow.");
                 }
+                _guts->chan.ClearFlags(latched);
             }
         }
-
-        data += cursize;
-        remain -= cursize;
     }
 
     return true;
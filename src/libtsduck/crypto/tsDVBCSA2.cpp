@@ -90,49 +90,49 @@ namespace {
     // reg q,           1 bit
     // reg r,           1 bit
 
-    const int sbox1[32] = {
+    const uint8_t sbox1[32] = {
         2,0,1,1,2,3,3,0,
         3,2,2,0,1,1,0,3,
         0,3,3,0,2,2,1,1,
         2,2,0,3,1,1,3,0
     };
 
-    const int sbox2[32] = {
+    const uint8_t sbox2[32] = {
         3,1,0,2,2,3,3,0,
         1,3,2,1,0,0,1,2,
         3,1,0,3,3,2,0,2,
         0,0,1,2,2,1,3,1
     };
 
-    const int sbox3[32] = {
+    const uint8_t sbox3[32] = {
         2,0,1,2,2,3,3,1,
         1,1,0,3,3,0,2,0,
         1,3,0,1,3,0,2,2,
         2,0,1,2,0,3,3,1
     };
 
-    const int sbox4[32] = {
+    const uint8_t sbox4[32] = {
         3,1,2,3,0,2,1,2,
         1,2,0,1,3,0,0,3,
         1,0,3,1,2,3,0,3,
         0,3,2,0,1,2,2,1
     };
 
-    const int sbox5[32] = {
+    const uint8_t sbox5[32] = {
         2,0,0,1,3,2,3,2,
         0,1,3,3,1,0,2,1,
         2,3,2,0,0,3,1,1,
         1,0,3,2,3,1,0,2
     };
 
-    const int sbox6[32] = {
+    const uint8_t sbox6[32] = {
         0,1,2,3,1,2,2,0,
         0,1,3,0,2,3,1,3,
         2,3,0,2,3,0,1,1,
         2,1,1,2,0,3,3,0
     };
 
-    const int sbox7[32] = {
+    const uint8_t sbox7[32] = {
         0,3,2,2,3,0,0,1,
         3,0,1,3,1,2,2,1,
         1,0,3,3,0,1,1,2,
@@ -395,7 +395,7 @@ namespace {
 
     // Permutations
 
-    const int block_perm[256] = {
+    const uint8_t block_perm[256] = {
         0x00, 0x02, 0x80, 0x82, 0x20, 0x22, 0xA0, 0xA2,
         0x10, 0x12, 0x90, 0x92, 0x30, 0x32, 0xB0, 0xB2,
         0x04, 0x06, 0x84, 0x86, 0x24, 0x26, 0xA4, 0xA6,
@@ -430,6 +430,23 @@ namespace {
         0x4D, 0x4F, 0xCD, 0xCF, 0x6D, 0x6F, 0xED, 0xEF,
         0x5D, 0x5F, 0xDD, 0xDF, 0x7D, 0x7F, 0xFD, 0xFF
     };
+
+    // Combined S-box and permutation, indexed by S-box input.
+    // Low byte: S-box output. High byte: permutation of the S-box output.
+    // Each round needs both values; one lookup in this table replaces a
+    // pair of dependent lookups in block_sbox and block_perm.
+    const uint16_t* BlockSboxPerm()
+    {
+        // Thread-safe init-safe static data pattern:
+        static const std::array<uint16_t, 256> table = []() {
+            std::array<uint16_t, 256> t;
+            for (size_t i = 0; i < 256; ++i) {
+                t[i] = uint16_t((block_perm[block_sbox[i]] << 8) | block_sbox[i]);
+            }
+            return t;
+        }();
+        return table.data();
+    }
 }
 
 
@@ -482,11 +499,12 @@ void ts::DVBCSA2::DVBBlockCipher::init(const uint8_t *key)
 void ts::DVBCSA2::DVBBlockCipher::decipher(const uint8_t *ib, uint8_t *bd)
 {
     int i;
-    int sbox_in;
+    int sbox_perm;
     int sbox_out;
     int perm_out;
     int R[9];
     int next_R8;
+    const uint16_t* sp_table = BlockSboxPerm();
 
     R[1] = ib[0];
     R[2] = ib[1];
@@ -499,9 +517,9 @@ void ts::DVBCSA2::DVBBlockCipher::decipher(const uint8_t *ib, uint8_t *bd)
 
     // loop over kk[56]..kk[1]
     for (i = 56; i > 0; i--) {
-        sbox_in  = _kk[i] ^ R[7];
-        sbox_out = block_sbox[sbox_in];
-        perm_out = block_perm[sbox_out];
+        sbox_perm = sp_table[_kk[i] ^ R[7]];
+        sbox_out = sbox_perm & 0xFF;
+        perm_out = sbox_perm >> 8;
         next_R8 = R[7];
         R[7] = R[6] ^ perm_out;
         R[6] = R[5];
@@ -527,11 +545,12 @@ void ts::DVBCSA2::DVBBlockCipher::decipher(const uint8_t *ib, uint8_t *bd)
 void ts::DVBCSA2::DVBBlockCipher::encipher(const uint8_t *bd, uint8_t *ib)
 {
     int i;
-    int sbox_in;
+    int sbox_perm;
     int sbox_out;
     int perm_out;
     int R[9];
     int next_R1;
+    const uint16_t* sp_table = BlockSboxPerm();
 
     R[1] = bd[0];
     R[2] = bd[1];
@@ -544,9 +563,9 @@ void ts::DVBCSA2::DVBBlockCipher::encipher(const uint8_t *bd, uint8_t *ib)
 
     // loop over kk[1]..kk[56]
     for (i = 1; i <= 56; i++) {
-        sbox_in  = _kk[i] ^ R[8];
-        sbox_out = block_sbox[sbox_in];
-        perm_out = block_perm[sbox_out];
+        sbox_perm = sp_table[_kk[i] ^ R[8]];
+        sbox_out = sbox_perm & 0xFF;
+        perm_out = sbox_perm >> 8;
         next_R1 = R[2];
         R[2] = R[3] ^ R[1];
         R[3] = R[4] ^ R[1];
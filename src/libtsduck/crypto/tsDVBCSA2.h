@@ -46,7 +46,14 @@ namespace ts {
         //! Set the entropy mode, used in setKey().
         //! @param [in] mode Entropy reduction mode.
         //!
-        void setEntropyMode(EntropyMode mode) { _mode = mode; }
+        void setEntropyMode(EntropyMode mode)
+        {
+            if (mode != _mode) {
+                _mode = mode;
+                // The entropy mode is part of the key schedule.
+                invalidateKeySchedule();
+            }
+        }
 
         //!
         //! Get the entropy mode, used in setKey().
@@ -10,6 +10,61 @@
 #include "tsjsonObject.h"
 #include "tsNullReport.h"
 
+// Layout of the packed per-PID state words.
+namespace {
+    constexpr uint32_t STATE_CC_OUT   = 0x0000000F;  // Last output CC value in the PID.
+    constexpr uint32_t STATE_FIRST_CC = 0x000000F0;  // First CC value in the PID.
+    constexpr uint32_t STATE_VALID    = 0x00000100;  // The PID was seen, the state word is valid.
+    constexpr uint32_t STATE_CC_IN    = 0x0000F000;  // Last input CC value in the PID (before any fix).
+    constexpr uint32_t STATE_DUP      = 0xFFFF0000;  // Consecutive duplicate count (saturated).
+    constexpr size_t   FIRST_CC_SHIFT = 4;
+    constexpr size_t   CC_IN_SHIFT    = 12;
+    constexpr size_t   DUP_SHIFT      = 16;
+}
+
+//----------------------------------------------------------------------------
+// 64-bit content hash of a packet, used to detect duplicate packets.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // Multiply-xor over 64-bit words, not cryptographic.
+    constexpr uint64_t HASH_PRIME1 = 0x9E3779B185EBCA87;
+    constexpr uint64_t HASH_PRIME2 = 0xC2B2AE3D27D4EB4F;
+
+    uint64_t HashBytes(uint64_t h, const uint8_t* data, size_t size)
+    {
+        while (size >= 8) {
+            h = (h ^ (ts::GetUInt64LE(data) * HASH_PRIME2)) * HASH_PRIME1;
+            data += 8;
+            size -= 8;
+        }
+        uint64_t w = 0;
+        for (size_t i = 0; i < size; ++i) {
+            w = (w << 8) | data[i];
+        }
+        return (h ^ (w * HASH_PRIME2)) * HASH_PRIME1;
+    }
+
+    // Hash the invariant bytes of a packet: the same byte ranges which are
+    // compared by TSPacket::isDuplicate(). Duplicate packets may carry
+    // different PCR values, the PCR field is excluded when present. Two
+    // packets with equal hashes are considered identical; a false positive
+    // is theoretical (2^-64 per pair of packets with equal input CC).
+    uint64_t PacketHash(const ts::TSPacket& pkt)
+    {
+        const size_t offset = pkt.hasPCR() ? 12 : 6;
+        uint64_t h = HashBytes(offset, pkt.b, 6);
+        h = HashBytes(h, pkt.b + offset, ts::PKT_SIZE - offset);
+        // Final avalanche (from splitmix64).
+        h ^= h >> 31;
+        h *= 0x7FB5D329728EA185;
+        h ^= h >> 27;
+        h *= 0x81DADEF4BC2DD44D;
+        return h ^ (h >> 33);
+    }
+}
+
 
 //----------------------------------------------------------------------------
 // Constructors and destructors
@@ -42,7 +97,8 @@ void ts::ContinuityAnalyzer::reset()
     _processed_packets = 0;
     _fix_count = 0;
     _error_count = 0;
-    _pid_states.clear();
+    _pid_states.fill(0);
+    _last_hashes.clear();
 }
 
 
@@ -62,7 +118,7 @@ void ts::ContinuityAnalyzer::setPIDFilter(const PIDSet& pids)
     if (removed_pids.any()) {
         for (PID pid = 0; pid < PID_MAX; ++pid) {
             if (removed_pids[pid]) {
-                _pid_states.erase(pid);
+                _pid_states[pid] = 0;
             }
         }
     }
@@ -84,7 +140,7 @@ void ts::ContinuityAnalyzer::removePID(PID pid)
 {
     if (pid < _pid_filter.size() && _pid_filter[pid]) {
         _pid_filter.reset(pid);
-        _pid_states.erase(pid);
+        _pid_states[pid] = 0;
     }
 }
 
@@ -100,33 +156,20 @@ bool ts::ContinuityAnalyzer::hasPID(PID pid) const
 
 uint8_t ts::ContinuityAnalyzer::firstCC(PID pid) const
 {
-    auto it = _pid_states.find(pid);
-    return it == _pid_states.end() ? INVALID_CC : it->second.first_cc;
+    const uint32_t state = pid < PID_MAX ? _pid_states[pid] : 0;
+    return (state & STATE_VALID) == 0 ? INVALID_CC : uint8_t((state & STATE_FIRST_CC) >> FIRST_CC_SHIFT);
 }
 
 uint8_t ts::ContinuityAnalyzer::lastCC(PID pid) const
 {
-    auto it = _pid_states.find(pid);
-    return it == _pid_states.end() ? INVALID_CC : it->second.last_cc_out;
+    const uint32_t state = pid < PID_MAX ? _pid_states[pid] : 0;
+    return (state & STATE_VALID) == 0 ? INVALID_CC : uint8_t(state & STATE_CC_OUT);
 }
 
 size_t ts::ContinuityAnalyzer::dupCount(PID pid) const
 {
-    auto it = _pid_states.find(pid);
-    return it == _pid_states.end() ? NPOS : it->second.dup_count;
-}
-
-void ts::ContinuityAnalyzer::getLastPacket(PID pid, TSPacket& packet) const
-{
-    auto it = _pid_states.find(pid);
-    packet = it == _pid_states.end() ? NullPacket : it->second.last_pkt_in;
-}
-
-ts::TSPacket ts::ContinuityAnalyzer::lastPacket(PID pid) const
-{
-    TSPacket pkt;
-    getLastPacket(pid, pkt);
-    return pkt;
+    const uint32_t state = pid < PID_MAX ? _pid_states[pid] : 0;
+    return (state & STATE_VALID) == 0 ? NPOS : size_t(state >> DUP_SHIFT);
 }
 
 
@@ -182,56 +225,87 @@ bool ts::ContinuityAnalyzer::feedPacketInternal(TSPacket* pkt, bool update)
     // The null PID is never eligible for CC processing.
     if (pid != PID_NULL && _pid_filter.test(pid)) {
 
-        // Get or create PID context.
-        PIDState& state(_pid_states[pid]);
-        const bool new_pid = state.first_cc == INVALID_CC;
+        // Direct access to the packed state word for this PID, no map lookup.
+        uint32_t& state(_pid_states[pid]);
+        const bool new_pid = (state & STATE_VALID) == 0;
+
+        // Lazily allocate the per-PID hashes of last input packets.
+        if (_last_hashes.empty()) {
+            _last_hashes.resize(PID_MAX, 0);
+        }
+        uint64_t& last_hash(_last_hashes[pid]);
 
         // Remember initial characteristics of the input packet.
-        const uint8_t last_cc_in = new_pid ? INVALID_CC : state.last_pkt_in.getCC();
+        const uint8_t last_cc_in = new_pid ? INVALID_CC : uint8_t((state & STATE_CC_IN) >> CC_IN_SHIFT);
+        const uint8_t last_cc_out = uint8_t(state & STATE_CC_OUT);
         const uint8_t cc = pkt->getCC();
         const bool has_payload = pkt->hasPayload();
         const bool has_discontinuity = pkt->getDiscontinuityIndicator();
-        const bool duplicated = !new_pid && !has_discontinuity && pkt->isDuplicate(state.last_pkt_in);
 
-        // Save input packet as originally received.
-        state.last_pkt_in = *pkt;
+        // Content hash of the input packet, replaces the stored copy of the
+        // last packet for duplicate detection.
+        const uint64_t hash = PacketHash(*pkt);
+
+        // Fast path, by far the most common case: detection-only mode and an input
+        // packet with the expected incremented CC. Such a packet cannot be a duplicate,
+        // there is no need to compare the packet contents. Just update the state word
+        // (new input and output CC, duplicate count reset) and save the hash.
+        if (!new_pid && !_generator && !(update && _fix_errors) && has_payload && !has_discontinuity && cc == ((last_cc_in + 1) & CC_MASK)) {
+            state = (state & ~(STATE_CC_OUT | STATE_CC_IN | STATE_DUP)) | cc | (uint32_t(cc) << CC_IN_SHIFT);
+            last_hash = hash;
+            _processed_packets++;
+            _total_packets++;
+            return true;
+        }
+
+        // A packet can be duplicated only when its CC did not move. The content
+        // comparison with the previous packet is an 8-byte hash comparison, the
+        // previous packet itself is no longer stored.
+        const bool duplicated = !new_pid && !has_discontinuity && has_payload && cc == last_cc_in && hash == last_hash;
+
+        // Save hash of input packet as originally received.
+        last_hash = hash;
+
+        // Consecutive duplicate count, saturated in the state word.
+        uint32_t dup_count = state >> DUP_SHIFT;
 
         if (new_pid) {
             // First packet on this PID
-            state.first_cc = cc;
+            state = STATE_VALID | (uint32_t(cc) << FIRST_CC_SHIFT);
         }
         else if (_generator) {
             // Generator mode, ignore input CC, generate a smooth stream.
             if (update) {
                 pkt->clearDiscontinuityIndicator();
-                pkt->setCC(has_payload ? ((state.last_cc_out + 1) & CC_MASK) : state.last_cc_out);
+                pkt->setCC(has_payload ? ((last_cc_out + 1) & CC_MASK) : last_cc_out);
                 _fix_count++;
                 result = false;
             }
         }
         else if (has_discontinuity) {
             // Discontinuity indicator is set, ignore any discontinuity.
-            state.dup_count = 0;
+            dup_count = 0;
         }
         else if (duplicated) {
             // Duplicate packet.
-            if (++state.dup_count >= 2) {
+            if (++dup_count >= 2) {
                 // The standard allows at most 2 duplicate packets.
                 if (_display_errors) {
                     if (_json) {
-                        logJSON(pid, u"duplicate", state.dup_count + 1);
+                        logJSON(pid, u"duplicate", dup_count + 1);
                     }
                     else {
-                        _report->log(_severity, u"%s, %d duplicate packets", linePrefix(pid), state.dup_count + 1);
+                        _report->log(_severity, u"%s, %d duplicate packets", linePrefix(pid), dup_count + 1);
                     }
                 }
                 // There is nothing we can do to fix this.
                 _error_count++;
                 result = false;
             }
+            dup_count = std::min<uint32_t>(dup_count, STATE_DUP >> DUP_SHIFT);
             if (update &&_fix_errors) {
                 // Check if we need to replicate a duplicate packet (same CC) or increment the CC.
-                const uint8_t cc_out = _replicate_dup || !has_payload ? state.last_cc_out : ((state.last_cc_out + 1) & CC_MASK);
+                const uint8_t cc_out = _replicate_dup || !has_payload ? last_cc_out : ((last_cc_out + 1) & CC_MASK);
                 if (cc != cc_out) {
                     pkt->setCC(cc_out);
                     result = false;
@@ -242,7 +316,7 @@ bool ts::ContinuityAnalyzer::feedPacketInternal(TSPacket* pkt, bool update)
         else {
             // Compute expected CC for this packet.
             const uint8_t good_cc_in = has_payload ? ((last_cc_in + 1) & CC_MASK) : last_cc_in;
-            const uint8_t good_cc_out = has_payload ? ((state.last_cc_out + 1) & CC_MASK) : state.last_cc_out;
+            const uint8_t good_cc_out = has_payload ? ((last_cc_out + 1) & CC_MASK) : last_cc_out;
 
             if (cc != good_cc_in) {
                 if (_display_errors) {
@@ -272,11 +346,11 @@ bool ts::ContinuityAnalyzer::feedPacketInternal(TSPacket* pkt, bool update)
                 result = false;
                 _fix_count++;
             }
-            state.dup_count = 0;
+            dup_count = 0;
         }
 
-        // Save actual CC for next time.
-        state.last_cc_out = pkt->getCC();
+        // Save actual CC, original input CC and duplicate count for next time.
+        state = (state & STATE_FIRST_CC) | STATE_VALID | uint32_t(pkt->getCC() & STATE_CC_OUT) | (uint32_t(cc) << CC_IN_SHIFT) | (dup_count << DUP_SHIFT);
         _processed_packets++;
     }
 
@@ -216,20 +216,6 @@ namespace ts {
         //!
         size_t dupCount(PID pid) const;
 
-        //!
-        //! Get the last transport stream packet that was passed to feedPacket() for a PID.
-        //! @param [in] pid The PID to check.
-        //! @return The last packet for the PID or ts::NullPacket when the PID is not filtered.
-        //!
-        TSPacket lastPacket(PID pid) const;
-
-        //!
-        //! Get the last transport stream packet that was passed to feedPacket() for a PID.
-        //! @param [in] pid The PID to check.
-        //! @param [out] packet The last packet for the PID or ts::NullPacket when the PID is not filtered.
-        //!
-        void getLastPacket(PID pid, TSPacket& packet) const;
-
         //!
         //! Compute the number of missing packets between two continuity counters.
         //! @param [in] cc1 First continuity counter.
@@ -239,19 +225,13 @@ namespace ts {
         static size_t MissingPackets(int cc1, int cc2);
 
     private:
-        // PID analysis state
-        class PIDState
-        {
-        public:
-            PIDState() = default;              // Constructor
-            uint8_t  first_cc = INVALID_CC;    // First CC value in a PID.
-            uint8_t  last_cc_out = INVALID_CC; // Last output CC value in a PID.
-            size_t   dup_count = 0;            // Consecutive duplicate count.
-            TSPacket last_pkt_in {};           // Last input packet (before modification, if any).
-        };
-
-        // A map of PID state, indexed by PID.
-        using PIDStateMap = std::map<PID,PIDState>;
+        // The analysis state of each PID is packed in one 32-bit word, in a flat array
+        // which is directly indexed by PID, so that the per-packet processing performs
+        // no map lookup. See the layout masks in the implementation file. Duplicated
+        // packets are detected with a 64-bit content hash of the last input packet of
+        // each PID, kept in a flat array too, lazily allocated on the first processed
+        // packet. Comparing hashes replaces both the stored 188-byte copy of the last
+        // packet and its byte-level comparison.
 
         // Private members.
         Report*       _report;                    // Where to report errors, never null.
@@ -267,7 +247,8 @@ namespace ts {
         PacketCounter _fix_count = 0;             // Number of fixed (modified) packets.
         PacketCounter _error_count = 0;           // Number of discontinuity errors.
         PIDSet        _pid_filter {};             // Current set of filtered PID's.
-        PIDStateMap   _pid_states {};             // State of all PID's.
+        std::array<uint32_t, PID_MAX> _pid_states {};  // Packed per-PID state words.
+        std::vector<uint64_t> _last_hashes {};    // Content hash of last input packet per PID (before modification, if any).
 
         // Internal version of feedPacket.
         // The packet is modified only if update is true.
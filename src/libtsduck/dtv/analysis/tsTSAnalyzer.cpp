@@ -97,11 +97,14 @@ void ts::TSAnalyzer::reset()
     _scrambled_services_cnt = 0;
     _tid_present.reset();
     _pids.clear();
+    _last_pid = PID_NULL;
+    _last_pid_ctx.reset();
     _services.clear();
     _ts_bitrate_sum = 0;
     _ts_bitrate_cnt = 0;
     _preceding_errors = 0;
     _preceding_suspects = 0;
+    _next_compaction = 0;
     _pes_demux.reset();
     _t2mi_demux.reset();
     _lcn.clear();
@@ -267,18 +270,20 @@ ts::TSAnalyzer::XTIDContextPtr ts::TSAnalyzer::getXTID(const Section& section)
 
 ts::TSAnalyzer::PIDContextPtr ts::TSAnalyzer::getPID(PID pid, const UString& description)
 {
-    const PIDContextPtr p(_pids[pid]);
+    // TS packets come in bursts on the same PID, cache the last accessed
+    // context to avoid one map lookup per packet in most cases.
+    PIDContextPtr p(pid == _last_pid && _last_pid_ctx != nullptr ? _last_pid_ctx : _pids[pid]);
     if (p == nullptr) {
         // The PID was not yet used, map entry just created.
-        return _pids[pid] = std::make_shared<PIDContext>(pid, description);
+        p = _pids[pid] = std::make_shared<PIDContext>(pid, description);
     }
-    else {
+    else if (p->description == UNREFERENCED && description != UNREFERENCED) {
         // If the PID was marked as unreferenced, now use actual description.
-        if (p->description == UNREFERENCED && description != UNREFERENCED) {
-            p->description = description;
-        }
-        return p;
+        p->description = description;
     }
+    _last_pid = pid;
+    _last_pid_ctx = p;
+    return p;
 }
 
 
@@ -1509,6 +1514,7 @@ void ts::TSAnalyzer::feedPacket(const TSPacket& pkt, const TSPacketMetadata& mda
     // Get PID context
     PIDContextPtr ps(getPID(pkt.getPID()));
     ps->ts_pkt_cnt++;
+    ps->last_seen_pkt = packet_index;
 
     // Accumulate stat from packet
     if (pkt.hasAF()) {
@@ -1705,6 +1711,84 @@ void ts::TSAnalyzer::feedPacket(const TSPacket& pkt, const TSPacketMetadata& mda
         // Some other PID's have been seen on multiple layers.
         ps->isdb_layers[info.layer_indicator]++;
     }
+
+    // In rolling-window mode, periodically evict contexts which vanished from the stream.
+    if (_window_packets != 0 && _ts_pkt_cnt >= _next_compaction) {
+        if (_next_compaction != 0) {
+            compactWindow();
+        }
+        _next_compaction = _ts_pkt_cnt + _window_packets;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// In rolling-window mode, evict the contexts of PID's, services and
+// tables which remained inactive during a complete window.
+//----------------------------------------------------------------------------
+
+void ts::TSAnalyzer::compactWindow()
+{
+    // Packet index before which a context is considered as vanished.
+    const uint64_t horizon = _ts_pkt_cnt < _window_packets ? 0 : _ts_pkt_cnt - _window_packets;
+
+    // Evict PID's without any packet during a complete window. In surviving PID's,
+    // evict the tables which were not repeated during a complete window and compact
+    // the history of attribute changes.
+    for (auto pci = _pids.begin(); pci != _pids.end(); ) {
+        PIDContext& pc(*pci->second);
+        if (pc.ts_pkt_cnt != 0 && pc.last_seen_pkt < horizon) {
+            // Maintain the few global counters which are updated packet by packet
+            // and never recomputed in recomputeStatistics().
+            if (pc.scrambled) {
+                _scrambled_pid_cnt--;
+            }
+            if (pc.pcr_cnt != 0) {
+                _pcr_pid_cnt--;
+            }
+            // Drop partially demuxed data on this PID.
+            _demux.resetPID(pc.pid);
+            _pes_demux.resetPID(pc.pid);
+            _t2mi_demux.resetPID(pc.pid);
+            if (_last_pid == pc.pid) {
+                _last_pid = PID_NULL;
+                _last_pid_ctx.reset();
+            }
+            pci = _pids.erase(pci);
+        }
+        else {
+            for (auto xci = pc.sections.begin(); xci != pc.sections.end(); ) {
+                if (xci->second->last_pkt < horizon) {
+                    xci = pc.sections.erase(xci);
+                }
+                else {
+                    ++xci;
+                }
+            }
+            // Keep the last attributes only, the history can grow forever when attributes keep changing.
+            if (pc.attributes.size() > 1) {
+                pc.attributes.erase(pc.attributes.begin(), pc.attributes.end() - 1);
+            }
+            ++pci;
+        }
+    }
+
+    // Evict services which are no longer referenced by any remaining PID.
+    ServiceIdSet referenced;
+    for (const auto& pci : _pids) {
+        referenced.insert(pci.second->services.begin(), pci.second->services.end());
+    }
+    for (auto sci = _services.begin(); sci != _services.end(); ) {
+        if (referenced.contains(sci->first)) {
+            ++sci;
+        }
+        else {
+            sci = _services.erase(sci);
+        }
+    }
+
+    // Global statistics shall be recomputed from the remaining contexts.
+    _modified = true;
 }
 
 
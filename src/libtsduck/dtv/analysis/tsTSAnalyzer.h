@@ -108,6 +108,20 @@ namespace ts {
             _max_consecutive_suspects = count;
         }
 
+        //!
+        //! Set the size of the rolling analysis window.
+        //! When set to a non-zero number of packets, the contexts of PID's, services
+        //! and tables which remained inactive during a complete window are periodically
+        //! evicted, so that a long-running analyzer on a dynamic multiplex holds a
+        //! bounded amount of memory.
+        //! @param [in] packets Size of the rolling window in TS packets.
+        //! If set to zero, the analysis accumulates forever (the default).
+        //!
+        void setRollingWindowPackets(uint64_t packets)
+        {
+            _window_packets = packets;
+        }
+
         //!
         //! Get the list of service ids.
         //! @param [out] list The returned list of service ids.
@@ -353,6 +367,7 @@ namespace ts {
 
             // Public members - Analysis data:
             uint8_t       cur_continuity = 0;   //!< Current continuity count.
+            uint64_t      last_seen_pkt = 0;    //!< Packet index of last packet in this PID (for rolling-window eviction).
             MPEG2AudioAttributes audio2 {};     //!< Last MPEG-2 audio attributes.
 
             // Public members - Analysis data: Crypto-period evaluation:
@@ -516,6 +531,10 @@ namespace ts {
         // Reset the section demux.
         void resetSectionDemux();
 
+        // In rolling-window mode, evict the contexts of PID's, services and
+        // tables which remained inactive during a complete window.
+        void compactWindow();
+
         // Analyze the various PSI tables
         void analyzePAT(const PAT&);
         void analyzeCAT(const CAT&);
@@ -571,6 +590,10 @@ namespace ts {
         uint64_t     _preceding_suspects = 0;        // Number of contiguous suspects packets before current packet
         uint64_t     _min_error_before_suspect = 1;  // Required number of invalid packets before starting suspect
         uint64_t     _max_consecutive_suspects = 1;  // Max number of consecutive suspect packets before clearing suspect
+        uint64_t     _window_packets = 0;            // Size of the rolling analysis window in packets (0: unbounded)
+        uint64_t     _next_compaction = 0;           // Packet index of next rolling-window compaction
+        PID          _last_pid = PID_NULL;           // PID of the cached context in _last_pid_ctx
+        PIDContextPtr _last_pid_ctx {};              // Context of last accessed PID (packets come in bursts per PID)
         SectionDemux _demux {_duck, this, this};     // PSI tables analysis
         PESDemux     _pes_demux {_duck, this};       // Audio/video analysis
         T2MIDemux    _t2mi_demux {_duck, this};      // T2-MI analysis
@@ -94,6 +94,15 @@ void ts::TSAnalyzerOptions::defineArgs(Args& args)
     args.option(u"title", 0, Args::STRING);
     args.help(u"title", u"Display the specified string as title header.");
 
+    args.option(u"rolling-window", 0, Args::UNSIGNED);
+    args.help(u"rolling-window",
+              u"Maintain the analysis over a rolling window of the specified number of TS packets. "
+              u"The contexts of PID's, services and tables which remained inactive during a "
+              u"complete window are periodically evicted from the analysis. This bounds the "
+              u"memory usage of long-running monitors on dynamic multiplexes, at the expense "
+              u"of forgetting PID's and services which vanished from the stream. By default, "
+              u"the analysis accumulates over the complete stream and nothing is ever evicted.");
+
     args.option(u"suspect-min-error-count", 0, Args::UNSIGNED);
     args.help(u"suspect-min-error-count",
               u"Specifies the minimum number of consecutive packets with errors before "
@@ -146,6 +155,7 @@ bool ts::TSAnalyzerOptions::loadArgs(DuckContext& duck, Args& args)
     args.getValue(title, u"title");
     args.getIntValue(suspect_min_error_count, u"suspect-min-error-count", 1);
     args.getIntValue(suspect_max_consecutive, u"suspect-max-consecutive", 1);
+    args.getIntValue(window_packets, u"rolling-window", 0);
 
     bool ok = json.loadArgs(args);
 
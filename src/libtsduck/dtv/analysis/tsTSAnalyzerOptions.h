@@ -65,6 +65,9 @@ namespace ts {
         uint64_t suspect_min_error_count = 1;  //!< Option -\-suspect-min-error-count
         uint64_t suspect_max_consecutive = 1;  //!< Option -\-suspect-max-consecutive
 
+        // Bounded-memory analysis for long-running monitors
+        uint64_t window_packets = 0;           //!< Option -\-rolling-window (0 means unbounded analysis)
+
         //!
         //! Add command line option definitions in an Args.
         //! @param [in,out] args Command line arguments to update.
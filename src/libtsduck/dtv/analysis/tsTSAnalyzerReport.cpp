@@ -59,6 +59,7 @@ void ts::TSAnalyzerReport::setAnalysisOptions(const TSAnalyzerOptions& opt)
 {
     setMinErrorCountBeforeSuspect(opt.suspect_min_error_count);
     setMaxConsecutiveSuspectCount(opt.suspect_max_consecutive);
+    setRollingWindowPackets(opt.window_packets);
 }
 
 
@@ -1218,9 +1219,10 @@ void ts::TSAnalyzerReport::reportJSON(TSAnalyzerOptions& opt, std::ostream& stm,
             jv.add(u"lcn", *sv.lcn);
         }
         jv.add(u"is-scrambled", json::Bool(sv.scrambled_pid_cnt > 0));
-        jv.query(u"components", true).add(u"total", sv.pid_cnt);
-        jv.query(u"components", true).add(u"clear", sv.pid_cnt - sv.scrambled_pid_cnt);
-        jv.query(u"components", true).add(u"scrambled", sv.scrambled_pid_cnt);
+        json::Value& jcomp(jv.query(u"components", true));
+        jcomp.add(u"total", sv.pid_cnt);
+        jcomp.add(u"clear", sv.pid_cnt - sv.scrambled_pid_cnt);
+        jcomp.add(u"scrambled", sv.scrambled_pid_cnt);
         jv.add(u"packets", sv.ts_pkt_cnt);
         jv.add(u"bitrate", sv.bitrate.toInt());
         jv.add(u"bitrate-204", ToBitrate204(sv.bitrate).toInt());
@@ -1294,19 +1296,20 @@ void ts::TSAnalyzerReport::reportJSON(TSAnalyzerOptions& opt, std::ostream& stm,
         pc.t2mi_plp_ts.addKeys(jv, u"plp", true);
         jv.add(u"bitrate", pc.bitrate.toInt());
         jv.add(u"bitrate-204", ToBitrate204(pc.bitrate).toInt());
-        jv.query(u"packets", true).add(u"total", pc.ts_pkt_cnt);
-        jv.query(u"packets", true).add(u"clear", pc.ts_pkt_cnt - pc.ts_sc_cnt - pc.inv_ts_sc_cnt);
-        jv.query(u"packets", true).add(u"scrambled", pc.ts_sc_cnt);
-        jv.query(u"packets", true).add(u"invalid-scrambling", pc.inv_ts_sc_cnt);
-        jv.query(u"packets", true).add(u"af", pc.ts_af_cnt);
-        jv.query(u"packets", true).add(u"pcr", pc.pcr_cnt);
-        jv.query(u"packets", true).add(u"pts", pc.pts_cnt);
-        jv.query(u"packets", true).add(u"dts", pc.dts_cnt);
-        jv.query(u"packets", true).add(u"pcr-leap", pc.pcr_leap_cnt);
-        jv.query(u"packets", true).add(u"pts-leap", pc.pts_leap_cnt);
-        jv.query(u"packets", true).add(u"dts-leap", pc.dts_leap_cnt);
-        jv.query(u"packets", true).add(u"discontinuities", pc.unexp_discont);
-        jv.query(u"packets", true).add(u"duplicated", pc.duplicated);
+        json::Value& jpkt(jv.query(u"packets", true));
+        jpkt.add(u"total", pc.ts_pkt_cnt);
+        jpkt.add(u"clear", pc.ts_pkt_cnt - pc.ts_sc_cnt - pc.inv_ts_sc_cnt);
+        jpkt.add(u"scrambled", pc.ts_sc_cnt);
+        jpkt.add(u"invalid-scrambling", pc.inv_ts_sc_cnt);
+        jpkt.add(u"af", pc.ts_af_cnt);
+        jpkt.add(u"pcr", pc.pcr_cnt);
+        jpkt.add(u"pts", pc.pts_cnt);
+        jpkt.add(u"dts", pc.dts_cnt);
+        jpkt.add(u"pcr-leap", pc.pcr_leap_cnt);
+        jpkt.add(u"pts-leap", pc.pts_leap_cnt);
+        jpkt.add(u"dts-leap", pc.dts_leap_cnt);
+        jpkt.add(u"discontinuities", pc.unexp_discont);
+        jpkt.add(u"duplicated", pc.duplicated);
         if (pc.carry_pes) {
             jv.add(u"pes", pc.pl_start_cnt);
             jv.add(u"invalid-pes-prefix", pc.inv_pes_start);
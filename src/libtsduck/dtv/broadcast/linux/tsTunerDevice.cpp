@@ -16,11 +16,14 @@
 #include "tsTime.h"
 #include "tsSysUtils.h"
 #include "tsFileUtils.h"
-#include "tsSignalAllocator.h"
 #include "tsTS.h"
 #include "tsMemory.h"
 #include "tsTunerDeviceInfo.h"
 
+#include "tsBeforeStandardHeaders.h"
+#include <poll.h>
+#include "tsAfterStandardHeaders.h"
+
 // We used to report "bit error rate", "signal/noise ratio", "signal strength",
 // "uncorrected blocks". But the corresponding ioctl commands (FE_READ_BER, FE_READ_SNR,
 // FE_READ_SIGNAL_STRENGTH, FE_READ_UNCORRECTED_BLOCKS) are marked as deprecated with
@@ -36,6 +39,8 @@
 
 #define MAX_OVERFLOW  8   // Maximum consecutive overflow
 
+#define DVR_POLL_INTERVAL cn::milliseconds(100)  // Poll granularity when waiting for DVR data
+
 #define FE_ZERO (::fe_status_t(0))
 
 
@@ -50,8 +55,6 @@ ts::TunerDevice::TunerDevice(DuckContext& duck) :
 
 ts::TunerDevice::~TunerDevice()
 {
-    // Cleanup receive timer resources
-    setReceiveTimeout(cn::milliseconds::zero());
 }
 
 
@@ -387,7 +390,10 @@ bool ts::TunerDevice::open(const UString& device_name, bool info_only)
         _dvr_fd = _demux_fd = -1;
     }
     else {
-        if ((_dvr_fd = ::open(_dvr_name.toUTF8().c_str(), O_RDONLY)) < 0) {
+        // The DVR is open in non-blocking mode. In receive(), each read() drains
+        // in bulk what is present in the DVR ring buffer and poll() is used to
+        // wait for data when the ring buffer is empty.
+        if ((_dvr_fd = ::open(_dvr_name.toUTF8().c_str(), O_RDONLY | O_NONBLOCK)) < 0) {
             _duck.report().error(u"error opening %s: %s", _dvr_name, SysErrorCodeMessage());
             close();
             return false;
@@ -467,10 +473,11 @@ bool ts::TunerDevice::close(bool silent)
 void ts::TunerDevice::abort(bool silent)
 {
     // Hard close of all file descriptors, hoping that pending I/O's will be canceled.
-    // In the case of a current read operation on the dvr, it has been noticed that
-    // closing the file descriptor make the read operation hang forever. We try to
-    // mitigate this risk with a volatile boolean which is set around read() but
-    // there is still a small risk of race condition (in which case we hang).
+    // Closing a file descriptor while another thread uses it in read() or poll()
+    // has unpredictable results. We avoid this with a volatile boolean which is
+    // set around read() and poll(). When an I/O is in progress, we simply set
+    // _aborted: the DVR is non-blocking and poll() waits are bounded, so the
+    // receive loop notices the abort within DVR_POLL_INTERVAL.
     _aborted = true;
     if (!_reading_dvr) {
         hardClose(silent ? nullptr : &_duck.report());
@@ -1519,6 +1526,18 @@ bool ts::TunerDevice::start()
         return false;
     }
 
+    // Also set the buffer size of the DVR device. This is the ring buffer from
+    // which TS packets are read and its default size cannot sustain high bitrate
+    // streams when the application is briefly descheduled.
+
+    if (::ioctl(_dvr_fd, ioctl_request_t(DMX_SET_BUFFER_SIZE), _demux_bufsize) < 0) {
+        _duck.report().error(u"error setting buffer size on %s: %s", _dvr_name, SysErrorCodeMessage());
+        return false;
+    }
+
+    // Reset overflow accounting for this capture session.
+    _overflow_count = 0;
+
     // Apply a filter to the demux.
 
     // The Linux DVB API defines two types of filters: sections and PES.
@@ -1599,18 +1618,13 @@ bool ts::TunerDevice::stop(bool silent)
         return false;
     }
 
-    return true;
-}
-
-
-//-----------------------------------------------------------------------------
-// Empty signal handler, simply interrupt system calls and report EINTR.
-//-----------------------------------------------------------------------------
-
-namespace {
-    void empty_signal_handler(int)
-    {
+    // Report the overflow events of the capture session. Each of them means
+    // lost packets. The fix is a larger buffer (see --demux-buffer-size).
+    if (_overflow_count > 0 && !silent) {
+        _duck.report().verbose(u"%'d input overflows on %s during capture", _overflow_count, _dvr_name);
     }
+
+    return true;
 }
 
 
@@ -1622,83 +1636,10 @@ namespace {
 
 bool ts::TunerDevice::setReceiveTimeout(cn::milliseconds timeout)
 {
-    if (timeout > cn::milliseconds::zero()) {
-        // Set an actual receive timer.
-        if (_rt_signal < 0) {
-            // Allocate one real-time signal.
-            if ((_rt_signal = SignalAllocator::Instance().allocate()) < 0) {
-                _duck.report().error(u"cannot set tuner receive timer, no more signal available");
-                return false;
-            }
-
-            // Handle the allocated signal
-            struct ::sigaction sac;
-            TS_ZERO(sac);
-            ::sigemptyset(&sac.sa_mask);
-            TS_PUSH_WARNING()
-            TS_LLVM_NOWARNING(disabled-macro-expansion)
-            sac.sa_handler = empty_signal_handler;
-            TS_POP_WARNING()
-            if (::sigaction(_rt_signal, &sac, nullptr) < 0) {
-                _duck.report().error(u"error setting tuner receive timer signal: %s", SysErrorCodeMessage());
-                SignalAllocator::Instance().release(_rt_signal);
-                _rt_signal = -1;
-                return false;
-            }
-        }
-
-        // Create a timer which triggers the signal
-        if (!_rt_timer_valid) {
-            ::sigevent sev;
-            TS_ZERO(sev);
-            sev.sigev_notify = SIGEV_SIGNAL;
-            sev.sigev_signo = _rt_signal;
-            if (::timer_create(CLOCK_REALTIME, &sev, &_rt_timer) < 0) {
-                _duck.report().error(u"error creating tuner receive timer: %s", SysErrorCodeMessage());
-                return false;
-            }
-            _rt_timer_valid = true;
-        }
-
-        // Now ready to process receive timeout
-        _receive_timeout = timeout;
-        return true;
-    }
-    else {
-        // Cancel receive timer
-        _receive_timeout = cn::milliseconds::zero();
-        bool ok = true;
-
-        // Disable and release signal
-        if (_rt_signal >= 0) {
-            // Ignore further signal delivery
-            struct ::sigaction sac;
-            TS_ZERO(sac);
-            ::sigemptyset(&sac.sa_mask);
-            TS_PUSH_WARNING()
-            TS_LLVM_NOWARNING(disabled-macro-expansion)
-            sac.sa_handler = SIG_IGN;
-            TS_POP_WARNING()
-            if (::sigaction(_rt_signal, &sac, nullptr) < 0) {
-                _duck.report().error(u"error ignoring tuner receive timer signal: %s", SysErrorCodeMessage());
-                ok = false;
-            }
-            // Release signal
-            SignalAllocator::Instance().release(_rt_signal);
-            _rt_signal = -1;
-        }
-
-        // Disarm and delete timer
-        if (_rt_timer_valid) {
-            _rt_timer_valid = false;
-            if (::timer_delete(_rt_timer) < 0) {
-                _duck.report().error(u"error deleting tuner receive timer: %s", SysErrorCodeMessage());
-                ok = false;
-            }
-        }
-
-        return ok;
-    }
+    // The receive timeout is implemented in receive() using poll() on the DVR
+    // device, there is no resource to setup.
+    _receive_timeout = std::max(timeout, cn::milliseconds::zero());
+    return true;
 }
 
 
@@ -1728,23 +1669,13 @@ size_t ts::TunerDevice::receive(TSPacket* buffer, size_t max_packets, const Abor
     // Set deadline if receive timeout in effect
     Time time_limit;
     if (_receive_timeout > cn::milliseconds::zero()) {
-        assert(_rt_timer_valid);
-        // Arm the receive timer.
-        // Note that _receive_timeout is in milliseconds and ::itimerspec is in nanoseconds.
-        ::itimerspec timeout;
-        timeout.it_value.tv_sec = long(_receive_timeout.count() / 1000);
-        timeout.it_value.tv_nsec = long(1000000 * (_receive_timeout.count() % 1000));
-        timeout.it_interval.tv_sec = 0;
-        timeout.it_interval.tv_nsec = 0;
-        if (::timer_settime(_rt_timer, 0, &timeout, nullptr) < 0) {
-            _duck.report().error(u"error arming tuner receive timer: %s", SysErrorCodeMessage());
-            return 0;
-        }
-        // Deadline time
         time_limit = Time::CurrentLocalTime() + _receive_timeout;
     }
 
-    // Loop on read until we get enough
+    // Loop on read until we get at least one packet. The DVR device is open in
+    // non-blocking mode: each read() drains in bulk what is currently present
+    // in the DVR ring buffer, directly into the caller's buffer, and poll() is
+    // used to wait for data when the ring buffer is empty.
     while (got_size < req_size && !_aborted) {
 
         // Read some data
@@ -1762,6 +1693,29 @@ size_t ts::TunerDevice::receive(TSPacket* buffer, size_t max_packets, const Abor
             // End of file. Truncate potential partial packet at eof.
             got_size -= got_size % PKT_SIZE;
         }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            // The DVR ring buffer is empty. If at least one full packet was
+            // already read, return it now instead of waiting for more data.
+            if (got_size >= PKT_SIZE) {
+                break;
+            }
+            // Wait for data. The wait is bounded so that abort requests and
+            // the receive timeout are checked at a reasonable granularity.
+            ::pollfd pfd;
+            TS_ZERO(pfd);
+            pfd.fd = _dvr_fd;
+            pfd.events = POLLIN;
+            _reading_dvr = true;
+            const int count = ::poll(&pfd, 1, int(DVR_POLL_INTERVAL.count()));
+            _reading_dvr = false;
+            if (count < 0 && errno != EINTR) {
+                _duck.report().error(u"poll error on %s: %s", _dvr_name, SysErrorCodeMessage());
+                break;
+            }
+            if (_aborted || (abort != nullptr && abort->aborting())) {
+                break;
+            }
+        }
         else if (errno == EINTR) {
             // Input was interrupted by a signal.
             // If the application should be interrupted, stop now.
@@ -1771,6 +1725,7 @@ size_t ts::TunerDevice::receive(TSPacket* buffer, size_t max_packets, const Abor
         }
         else if (errno == EOVERFLOW) {
             got_overflow = true;
+            _overflow_count++;
         }
         else {
             _duck.report().error(u"receive error on %s: %s", _dvr_name, SysErrorCodeMessage());
@@ -1788,11 +1743,8 @@ size_t ts::TunerDevice::receive(TSPacket* buffer, size_t max_packets, const Abor
             break;
         }
 
-        // If the receive timeout is exceeded, stop now.
-        // FIXME: There is a race condition here. If the receiver timer is
-        // triggered between this test and the start of the next read, the
-        // next read will not be interrupted and the receive timer will not
-        // apply to this read.
+        // If the receive timeout is exceeded, stop now. The timeout is checked
+        // after each read or poll slice, the maximum overshoot is DVR_POLL_INTERVAL.
         if (_receive_timeout > cn::milliseconds::zero() && Time::CurrentLocalTime() >= time_limit) {
             if (got_size == 0) {
                 _duck.report().error(u"receive timeout on %s", _device_name);
@@ -1801,18 +1753,6 @@ size_t ts::TunerDevice::receive(TSPacket* buffer, size_t max_packets, const Abor
         }
     }
 
-    // Disarm the receive timer.
-    if (_receive_timeout > cn::milliseconds::zero()) {
-        ::itimerspec timeout;
-        timeout.it_value.tv_sec = 0;
-        timeout.it_value.tv_nsec = 0;
-        timeout.it_interval.tv_sec = 0;
-        timeout.it_interval.tv_nsec = 0;
-        if (::timer_settime(_rt_timer, 0, &timeout, nullptr) < 0) {
-            _duck.report().error(u"error disarming tuner receive timer: %s", SysErrorCodeMessage());
-        }
-    }
-
     // Look for unsynchronized packets in reception buffer.
     // Similar code was initially introduced in the Windows version because
     // such loss of synchronization was actually observed. In response to
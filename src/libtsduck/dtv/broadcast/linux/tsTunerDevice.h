@@ -87,9 +87,7 @@ namespace ts {
         unsigned long       _demux_bufsize = DEFAULT_DEMUX_BUFFER_SIZE;
         ::dvb_frontend_info _fe_info {};              // Front-end characteristics
         cn::milliseconds    _signal_poll = DEFAULT_SIGNAL_POLL;
-        int                 _rt_signal = -1;          // Receive timeout signal number
-        ::timer_t           _rt_timer = nullptr;      // Receive timeout timer
-        bool                _rt_timer_valid = false;  // Receive timeout timer was created
+        uint64_t            _overflow_count = 0;      // DVR overflow events since last start()
         bool                _voltage_on = false;      // Satellite tuner voltage was turned on
 
         // Clear tuner, return true on success, false on error
@@ -13,8 +13,17 @@
 #include "tsxmlElement.h"
 #include "tsFileUtils.h"
 #include "tsErrCodeReport.h"
+#include "tsConfigCacheFile.h"
+#include "tsBuffer.h"
 #include "tsFatal.h"
 
+// Magic string and format version of the binary cache of channel files.
+// The version shall be incremented each time the serialization format changes.
+namespace {
+    const ts::UString CHANNELS_CACHE_MAGIC(u"tsduck.channels");
+    constexpr uint32_t CHANNELS_CACHE_VERSION = 1;
+}
+
 
 //----------------------------------------------------------------------------
 // Transport stream accessors.
@@ -305,9 +314,30 @@ bool ts::ChannelFile::load(const UString& fileName, Report& report)
 {
     clear();
     _fileName = fileName.empty() ? DefaultFileName() : fileName;
+
+    // Try the binary cache first. When the cache is up-to-date, this avoids
+    // parsing the XML file and its model on each command startup.
+    ConfigCacheFile cache(CHANNELS_CACHE_MAGIC, CHANNELS_CACHE_VERSION);
+    ByteBlock data;
+    if (cache.load(data, _fileName, report)) {
+        if (deserializeBinary(data)) {
+            return true;
+        }
+        // Invalid cache content, reparse the source file.
+        report.debug(u"invalid content in binary cache of %s, ignoring it", _fileName);
+        clear();
+    }
+
+    // Parse the XML file and rebuild the cache (best effort).
     xml::Document doc(report);
     doc.setTweaks(_xmlTweaks);
-    return doc.load(_fileName, false) && parseDocument(doc);
+    if (!doc.load(_fileName, false) || !parseDocument(doc)) {
+        return false;
+    }
+    data.clear();
+    serializeBinary(data);
+    cache.save(data, _fileName, report);
+    return true;
 }
 
 bool ts::ChannelFile::load(std::istream& strm, Report& report)
@@ -738,3 +768,229 @@ ts::xml::Element* ts::ChannelFile::toXML(const ModulationArgs& mod, xml::Element
         }
     }
 }
+
+
+//----------------------------------------------------------------------------
+// Serialization of modulation parameters for the binary cache.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // Presence bits of the optional modulation parameters in the binary cache.
+    // Only the parameters which can be stored in XML channel files are serialized.
+    enum : uint32_t {
+        HAS_DELIVERY     = 0x00000001,
+        HAS_FREQUENCY    = 0x00000002,
+        HAS_POLARITY     = 0x00000004,
+        HAS_INVERSION    = 0x00000008,
+        HAS_SYMBOL_RATE  = 0x00000010,
+        HAS_INNER_FEC    = 0x00000020,
+        HAS_SATELLITE    = 0x00000040,
+        HAS_MODULATION   = 0x00000080,
+        HAS_BANDWIDTH    = 0x00000100,
+        HAS_FEC_HP       = 0x00000200,
+        HAS_FEC_LP       = 0x00000400,
+        HAS_TRANSMISSION = 0x00000800,
+        HAS_GUARD        = 0x00001000,
+        HAS_HIERARCHY    = 0x00002000,
+        HAS_PILOTS       = 0x00004000,
+        HAS_ROLL_OFF     = 0x00008000,
+        HAS_PLP          = 0x00010000,
+        HAS_ISI          = 0x00020000,
+        HAS_PLS_CODE     = 0x00040000,
+        HAS_PLS_MODE     = 0x00080000,
+        HAS_STREAM_ID    = 0x00100000,
+    };
+
+    // Serialize modulation parameters: a presence bitmap, then the values in a fixed order.
+    void PutModulation(ts::Buffer& buf, const ts::ModulationArgs& mod)
+    {
+        uint32_t bitmap = 0;
+        if (mod.delivery_system.has_value())    { bitmap |= HAS_DELIVERY; }
+        if (mod.frequency.has_value())          { bitmap |= HAS_FREQUENCY; }
+        if (mod.polarity.has_value())           { bitmap |= HAS_POLARITY; }
+        if (mod.inversion.has_value())          { bitmap |= HAS_INVERSION; }
+        if (mod.symbol_rate.has_value())        { bitmap |= HAS_SYMBOL_RATE; }
+        if (mod.inner_fec.has_value())          { bitmap |= HAS_INNER_FEC; }
+        if (mod.satellite_number.has_value())   { bitmap |= HAS_SATELLITE; }
+        if (mod.modulation.has_value())         { bitmap |= HAS_MODULATION; }
+        if (mod.bandwidth.has_value())          { bitmap |= HAS_BANDWIDTH; }
+        if (mod.fec_hp.has_value())             { bitmap |= HAS_FEC_HP; }
+        if (mod.fec_lp.has_value())             { bitmap |= HAS_FEC_LP; }
+        if (mod.transmission_mode.has_value())  { bitmap |= HAS_TRANSMISSION; }
+        if (mod.guard_interval.has_value())     { bitmap |= HAS_GUARD; }
+        if (mod.hierarchy.has_value())          { bitmap |= HAS_HIERARCHY; }
+        if (mod.pilots.has_value())             { bitmap |= HAS_PILOTS; }
+        if (mod.roll_off.has_value())           { bitmap |= HAS_ROLL_OFF; }
+        if (mod.plp.has_value())                { bitmap |= HAS_PLP; }
+        if (mod.isi.has_value())                { bitmap |= HAS_ISI; }
+        if (mod.pls_code.has_value())           { bitmap |= HAS_PLS_CODE; }
+        if (mod.pls_mode.has_value())           { bitmap |= HAS_PLS_MODE; }
+        if (mod.stream_id.has_value())          { bitmap |= HAS_STREAM_ID; }
+
+        buf.putUInt32(bitmap);
+        if (mod.delivery_system.has_value())    { buf.putInt32(int32_t(*mod.delivery_system)); }
+        if (mod.frequency.has_value())          { buf.putUInt64(*mod.frequency); }
+        if (mod.polarity.has_value())           { buf.putInt32(int32_t(*mod.polarity)); }
+        if (mod.inversion.has_value())          { buf.putInt32(int32_t(*mod.inversion)); }
+        if (mod.symbol_rate.has_value())        { buf.putUInt32(*mod.symbol_rate); }
+        if (mod.inner_fec.has_value())          { buf.putInt32(int32_t(*mod.inner_fec)); }
+        if (mod.satellite_number.has_value())   { buf.putUInt8(uint8_t(*mod.satellite_number)); }
+        if (mod.modulation.has_value())         { buf.putInt32(int32_t(*mod.modulation)); }
+        if (mod.bandwidth.has_value())          { buf.putUInt32(*mod.bandwidth); }
+        if (mod.fec_hp.has_value())             { buf.putInt32(int32_t(*mod.fec_hp)); }
+        if (mod.fec_lp.has_value())             { buf.putInt32(int32_t(*mod.fec_lp)); }
+        if (mod.transmission_mode.has_value())  { buf.putInt32(int32_t(*mod.transmission_mode)); }
+        if (mod.guard_interval.has_value())     { buf.putInt32(int32_t(*mod.guard_interval)); }
+        if (mod.hierarchy.has_value())          { buf.putInt32(int32_t(*mod.hierarchy)); }
+        if (mod.pilots.has_value())             { buf.putInt32(int32_t(*mod.pilots)); }
+        if (mod.roll_off.has_value())           { buf.putInt32(int32_t(*mod.roll_off)); }
+        if (mod.plp.has_value())                { buf.putUInt32(*mod.plp); }
+        if (mod.isi.has_value())                { buf.putUInt32(*mod.isi); }
+        if (mod.pls_code.has_value())           { buf.putUInt32(*mod.pls_code); }
+        if (mod.pls_mode.has_value())           { buf.putInt32(int32_t(*mod.pls_mode)); }
+        if (mod.stream_id.has_value())          { buf.putUInt32(*mod.stream_id); }
+    }
+
+    // Deserialize modulation parameters. Rely on the read error state of the buffer.
+    void GetModulation(ts::Buffer& buf, ts::ModulationArgs& mod)
+    {
+        using namespace ts;
+        const uint32_t bitmap = buf.getUInt32();
+        if (bitmap & HAS_DELIVERY)     { mod.delivery_system = DeliverySystem(buf.getInt32()); }
+        if (bitmap & HAS_FREQUENCY)    { mod.frequency = buf.getUInt64(); }
+        if (bitmap & HAS_POLARITY)     { mod.polarity = Polarization(buf.getInt32()); }
+        if (bitmap & HAS_INVERSION)    { mod.inversion = SpectralInversion(buf.getInt32()); }
+        if (bitmap & HAS_SYMBOL_RATE)  { mod.symbol_rate = buf.getUInt32(); }
+        if (bitmap & HAS_INNER_FEC)    { mod.inner_fec = InnerFEC(buf.getInt32()); }
+        if (bitmap & HAS_SATELLITE)    { mod.satellite_number = buf.getUInt8(); }
+        if (bitmap & HAS_MODULATION)   { mod.modulation = Modulation(buf.getInt32()); }
+        if (bitmap & HAS_BANDWIDTH)    { mod.bandwidth = buf.getUInt32(); }
+        if (bitmap & HAS_FEC_HP)       { mod.fec_hp = InnerFEC(buf.getInt32()); }
+        if (bitmap & HAS_FEC_LP)       { mod.fec_lp = InnerFEC(buf.getInt32()); }
+        if (bitmap & HAS_TRANSMISSION) { mod.transmission_mode = TransmissionMode(buf.getInt32()); }
+        if (bitmap & HAS_GUARD)        { mod.guard_interval = GuardInterval(buf.getInt32()); }
+        if (bitmap & HAS_HIERARCHY)    { mod.hierarchy = Hierarchy(buf.getInt32()); }
+        if (bitmap & HAS_PILOTS)       { mod.pilots = Pilot(buf.getInt32()); }
+        if (bitmap & HAS_ROLL_OFF)     { mod.roll_off = RollOff(buf.getInt32()); }
+        if (bitmap & HAS_PLP)          { mod.plp = buf.getUInt32(); }
+        if (bitmap & HAS_ISI)          { mod.isi = buf.getUInt32(); }
+        if (bitmap & HAS_PLS_CODE)     { mod.pls_code = buf.getUInt32(); }
+        if (bitmap & HAS_PLS_MODE)     { mod.pls_mode = PLSMode(buf.getInt32()); }
+        if (bitmap & HAS_STREAM_ID)    { mod.stream_id = buf.getUInt32(); }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Serialize the content of this object for the binary cache.
+//----------------------------------------------------------------------------
+
+void ts::ChannelFile::serializeBinary(ByteBlock& data) const
+{
+    // Estimate the serialized size to allocate the buffer: counts and fixed-size
+    // records, plus a worst-case UTF-8 expansion of the service and provider names.
+    size_t max_size = 16;
+    for (const auto& net : _networks) {
+        max_size += 16;
+        for (size_t its = 0; its < net->tsCount(); ++its) {
+            const TransportStreamPtr ts(net->tsByIndex(its));
+            max_size += 256;
+            for (size_t isrv = 0; isrv < ts->serviceCount(); ++isrv) {
+                const ServicePtr srv(ts->serviceByIndex(isrv));
+                max_size += 32 + 3 * (srv->name.length() + srv->provider.length());
+            }
+        }
+    }
+
+    Buffer buf(max_size);
+    buf.putUInt32(uint32_t(_networks.size()));
+    for (const auto& net : _networks) {
+        buf.putUInt16(net->id);
+        buf.putInt32(int32_t(net->type));
+        buf.putUInt32(uint32_t(net->tsCount()));
+        for (size_t its = 0; its < net->tsCount(); ++its) {
+            const TransportStreamPtr ts(net->tsByIndex(its));
+            buf.putUInt16(ts->id);
+            buf.putUInt16(ts->onid);
+            PutModulation(buf, ts->tune);
+            buf.putUInt32(uint32_t(ts->serviceCount()));
+            for (size_t isrv = 0; isrv < ts->serviceCount(); ++isrv) {
+                const ServicePtr srv(ts->serviceByIndex(isrv));
+                buf.putUInt16(srv->id);
+                buf.putUTF8WithLength(srv->name, 0, NPOS, 16);
+                buf.putUTF8WithLength(srv->provider, 0, NPOS, 16);
+                uint8_t flags = 0;
+                if (srv->lcn.has_value())         { flags |= 0x01; }
+                if (srv->pmtPID.has_value())      { flags |= 0x02; }
+                if (srv->type.has_value())        { flags |= 0x04; }
+                if (srv->cas.has_value())         { flags |= 0x08; }
+                if (srv->atscType.has_value())    { flags |= 0x10; }
+                if (srv->atscMajorId.has_value()) { flags |= 0x20; }
+                if (srv->atscMinorId.has_value()) { flags |= 0x40; }
+                buf.putUInt8(flags);
+                if (srv->lcn.has_value())         { buf.putUInt16(*srv->lcn); }
+                if (srv->pmtPID.has_value())      { buf.putUInt16(*srv->pmtPID); }
+                if (srv->type.has_value())        { buf.putUInt8(*srv->type); }
+                if (srv->cas.has_value())         { buf.putUInt8(*srv->cas ? 1 : 0); }
+                if (srv->atscType.has_value())    { buf.putUInt8(*srv->atscType); }
+                if (srv->atscMajorId.has_value()) { buf.putUInt16(*srv->atscMajorId); }
+                if (srv->atscMinorId.has_value()) { buf.putUInt16(*srv->atscMinorId); }
+            }
+        }
+    }
+
+    // In the unlikely case of a buffer overflow, return no data, the cache will be ignored.
+    if (buf.error()) {
+        data.clear();
+    }
+    else {
+        data.copy(buf.data(), buf.currentWriteByteOffset());
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Deserialize the content of the binary cache into this object.
+//----------------------------------------------------------------------------
+
+bool ts::ChannelFile::deserializeBinary(const ByteBlock& data)
+{
+    Buffer buf(data.data(), data.size());
+
+    const uint32_t net_count = buf.getUInt32();
+    for (uint32_t inet = 0; !buf.error() && inet < net_count; ++inet) {
+        const NetworkPtr net(new Network);
+        CheckNonNull(net.get());
+        _networks.push_back(net);
+        net->id = buf.getUInt16();
+        net->type = TunerType(buf.getInt32());
+        const uint32_t ts_count = buf.getUInt32();
+        for (uint32_t its = 0; !buf.error() && its < ts_count; ++its) {
+            const TransportStreamPtr ts(net->tsGetOrCreate(buf.getUInt16()));
+            assert(ts != nullptr);
+            ts->onid = buf.getUInt16();
+            GetModulation(buf, ts->tune);
+            const uint32_t srv_count = buf.getUInt32();
+            for (uint32_t isrv = 0; !buf.error() && isrv < srv_count; ++isrv) {
+                const ServicePtr srv(new Service);
+                CheckNonNull(srv.get());
+                srv->id = buf.getUInt16();
+                buf.getUTF8WithLength(srv->name, 16);
+                buf.getUTF8WithLength(srv->provider, 16);
+                const uint8_t flags = buf.getUInt8();
+                if (flags & 0x01) { srv->lcn = buf.getUInt16(); }
+                if (flags & 0x02) { srv->pmtPID = buf.getUInt16(); }
+                if (flags & 0x04) { srv->type = buf.getUInt8(); }
+                if (flags & 0x08) { srv->cas = buf.getUInt8() != 0; }
+                if (flags & 0x10) { srv->atscType = buf.getUInt8(); }
+                if (flags & 0x20) { srv->atscMajorId = buf.getUInt16(); }
+                if (flags & 0x40) { srv->atscMinorId = buf.getUInt16(); }
+                ts->addService(srv, ShareMode::SHARE, true);
+            }
+        }
+    }
+
+    // The complete buffer shall be consumed without error.
+    return !buf.error() && buf.endOfRead();
+}
@@ -387,5 +387,9 @@ namespace ts {
         // Convert modulation parameters to and from XML.
         bool fromXML(ModulationArgs& mod, const xml::Element* element, TunerType tunerType, uint16_t ts_id);
         xml::Element* toXML(const ModulationArgs& mod, xml::Element* parent) const;
+
+        // Serialize and deserialize the content of this object for the binary cache.
+        void serializeBinary(ByteBlock& data) const;
+        bool deserializeBinary(const ByteBlock& data);
     };
 }
@@ -10,6 +10,16 @@
 #include "tsDuckConfigFile.h"
 #include "tsxmlModelDocument.h"
 #include "tsxmlElement.h"
+#include "tsConfigCacheFile.h"
+#include "tsFileUtils.h"
+#include "tsBuffer.h"
+
+// Magic string and format version of the binary cache of the HF bands repository.
+// The version shall be incremented each time the serialization format changes.
+namespace {
+    const ts::UString HFBANDS_CACHE_MAGIC(u"tsduck.hfbands");
+    constexpr uint32_t HFBANDS_CACHE_VERSION = 1;
+}
 
 
 //----------------------------------------------------------------------------
@@ -474,51 +484,73 @@ bool ts::HFBand::HFBandRepository::load(Report& report)
     // A set of region names (to build a list of unique names).
     std::set<UString> regionSet;
 
-    // Load the repository XML file. Search it in TSDuck directory.
-    xml::Document doc(report);
-    if (!doc.load(u"tsduck.hfbands.xml", true)) {
-        return false;
-    }
+    // Locate the repository XML file in the TSDuck configuration directories.
+    const UString xml_path(SearchConfigurationFile(u"tsduck.hfbands.xml"));
 
-    // Load the XML model. Search it in TSDuck directory.
-    xml::ModelDocument model(report);
-    if (!model.load(u"tsduck.hfbands.model.xml", true)) {
-        report.error(u"Model for TSDuck HF Band XML files not found");
-        return false;
-    }
+    // Try the binary cache first. When the cache is up-to-date, this avoids
+    // parsing the XML file and its model on each command startup.
+    ConfigCacheFile cache(HFBANDS_CACHE_MAGIC, HFBANDS_CACHE_VERSION);
+    ByteBlock data;
+    bool success = !xml_path.empty() && cache.load(data, xml_path, report) && loadFromCache(data, regionSet);
 
-    // Validate the input document according to the model.
-    if (!model.validate(doc)) {
-        return false;
-    }
+    if (!success) {
+        // No usable cache, parse the XML file. Drop partial results from an invalid cache.
+        _objects.clear();
+        regionSet.clear();
+
+        // Load the repository XML file. Search it in TSDuck directory.
+        xml::Document doc(report);
+        if (!doc.load(u"tsduck.hfbands.xml", true)) {
+            return false;
+        }
 
-    // Get the root in the document. Should be ok since we validated the document.
-    const xml::Element* root = doc.rootElement();
+        // Load the XML model. Search it in TSDuck directory.
+        xml::ModelDocument model(report);
+        if (!model.load(u"tsduck.hfbands.model.xml", true)) {
+            report.error(u"Model for TSDuck HF Band XML files not found");
+            return false;
+        }
 
-    // Analyze all <hfband> in the document.
-    bool success = true;
-    for (const xml::Element* node = root == nullptr ? nullptr : root->firstChildElement(); node != nullptr; node = node->nextSiblingElement()) {
-        // Since the document was validated, we assume that all elements in root are <hfband>.
-        HFBandPtr hf(FromXML(node));
-        if (hf == nullptr) {
-            success = false;
+        // Validate the input document according to the model.
+        if (!model.validate(doc)) {
+            return false;
         }
-        else {
-            // Add the object in the repository.
-            for (auto it = hf->_regions.begin(); it != hf->_regions.end(); ++it) {
-                // Get band type + region name.
-                const HFBandIndex index(hf->_band_name, *it);
-                // Build a set of unique entries for region names.
-                regionSet.insert(*it);
-                if (_objects.contains(index)) {
-                    report.error(u"duplicate definition for %s, line %d", index, node->lineNumber());
-                    success = false;
-                }
-                else {
-                    _objects[index] = hf;
+
+        // Get the root in the document. Should be ok since we validated the document.
+        const xml::Element* root = doc.rootElement();
+
+        // Analyze all <hfband> in the document.
+        success = true;
+        for (const xml::Element* node = root == nullptr ? nullptr : root->firstChildElement(); node != nullptr; node = node->nextSiblingElement()) {
+            // Since the document was validated, we assume that all elements in root are <hfband>.
+            HFBandPtr hf(FromXML(node));
+            if (hf == nullptr) {
+                success = false;
+            }
+            else {
+                // Add the object in the repository.
+                for (auto it = hf->_regions.begin(); it != hf->_regions.end(); ++it) {
+                    // Get band type + region name.
+                    const HFBandIndex index(hf->_band_name, *it);
+                    // Build a set of unique entries for region names.
+                    regionSet.insert(*it);
+                    if (_objects.contains(index)) {
+                        report.error(u"duplicate definition for %s, line %d", index, node->lineNumber());
+                        success = false;
+                    }
+                    else {
+                        _objects[index] = hf;
+                    }
                 }
             }
         }
+
+        // Rebuild the cache (best effort).
+        if (success && !xml_path.empty()) {
+            data.clear();
+            saveToCache(data);
+            cache.save(data, xml_path, report);
+        }
     }
 
     // Build a sorted list of region names.
@@ -530,6 +562,111 @@ bool ts::HFBand::HFBandRepository::load(Report& report)
 }
 
 
+//----------------------------------------------------------------------------
+// Serialize the content of the repository for the binary cache.
+//----------------------------------------------------------------------------
+
+void ts::HFBand::HFBandRepository::saveToCache(ByteBlock& data) const
+{
+    // Collect unique band definitions (one object can be indexed under several regions).
+    std::vector<const HFBand*> bands;
+    for (const auto& it : _objects) {
+        if (std::find(bands.begin(), bands.end(), it.second.get()) == bands.end()) {
+            bands.push_back(it.second.get());
+        }
+    }
+
+    // Estimate the serialized size to allocate the buffer: counts and fixed-size
+    // records, plus a worst-case UTF-8 expansion of the band and region names.
+    size_t max_size = 16;
+    for (const HFBand* hf : bands) {
+        max_size += 16 + 3 * hf->_band_name.length() + 64 * hf->_channels.size();
+        for (const auto& reg : hf->_regions) {
+            max_size += 8 + 3 * reg.length();
+        }
+    }
+
+    Buffer buf(max_size);
+    buf.putUInt32(uint32_t(bands.size()));
+    for (const HFBand* hf : bands) {
+        buf.putUTF8WithLength(hf->_band_name, 0, NPOS, 16);
+        buf.putUInt32(uint32_t(hf->_regions.size()));
+        for (const auto& reg : hf->_regions) {
+            buf.putUTF8WithLength(reg, 0, NPOS, 16);
+        }
+        buf.putUInt32(uint32_t(hf->_channels.size()));
+        for (const auto& chan : hf->_channels) {
+            buf.putUInt32(chan.first_channel);
+            buf.putUInt32(chan.last_channel);
+            buf.putUInt64(chan.base_frequency);
+            buf.putUInt64(chan.channel_width);
+            buf.putInt32(chan.first_offset);
+            buf.putInt32(chan.last_offset);
+            buf.putUInt64(chan.offset_width);
+            buf.putInt32(int32_t(chan.even_polarity));
+            buf.putInt32(int32_t(chan.odd_polarity));
+        }
+    }
+
+    // In the unlikely case of a buffer overflow, return no data, the cache will be ignored.
+    if (buf.error()) {
+        data.clear();
+    }
+    else {
+        data.copy(buf.data(), buf.currentWriteByteOffset());
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Deserialize the content of the binary cache into the repository.
+//----------------------------------------------------------------------------
+
+bool ts::HFBand::HFBandRepository::loadFromCache(const ByteBlock& data, std::set<UString>& regionSet)
+{
+    Buffer buf(data.data(), data.size());
+
+    const uint32_t band_count = buf.getUInt32();
+    for (uint32_t ib = 0; !buf.error() && ib < band_count; ++ib) {
+        UString band_name;
+        buf.getUTF8WithLength(band_name, 16);
+        HFBandPtr hf(new HFBand(band_name));
+        const uint32_t region_count = buf.getUInt32();
+        for (uint32_t ir = 0; !buf.error() && ir < region_count; ++ir) {
+            UString reg;
+            buf.getUTF8WithLength(reg, 16);
+            hf->_regions.push_back(reg);
+        }
+        const uint32_t range_count = buf.getUInt32();
+        for (uint32_t ic = 0; !buf.error() && ic < range_count; ++ic) {
+            // The channel ranges were serialized in order of channel numbers.
+            ChannelsRange chan;
+            chan.first_channel = buf.getUInt32();
+            chan.last_channel = buf.getUInt32();
+            chan.base_frequency = buf.getUInt64();
+            chan.channel_width = buf.getUInt64();
+            chan.first_offset = buf.getInt32();
+            chan.last_offset = buf.getInt32();
+            chan.offset_width = buf.getUInt64();
+            chan.even_polarity = Polarization(buf.getInt32());
+            chan.odd_polarity = Polarization(buf.getInt32());
+            hf->_channels.push_back(chan);
+            hf->_channel_count += chan.last_channel + 1 - chan.first_channel;
+        }
+        if (!buf.error()) {
+            // Index the band under all its regions, exactly like the XML loader.
+            for (const auto& reg : hf->_regions) {
+                regionSet.insert(reg);
+                _objects[HFBandIndex(hf->_band_name, reg)] = hf;
+            }
+        }
+    }
+
+    // The complete buffer shall be consumed without error.
+    return !buf.error() && buf.endOfRead();
+}
+
+
 //----------------------------------------------------------------------------
 // Get/set the default region.
 //----------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 
 #pragma once
 #include "tsModulation.h"
+#include "tsByteBlock.h"
 #include "tsCerrReport.h"
 #include "tsxml.h"
 
@@ -344,6 +345,10 @@ namespace ts {
             HFBandMap   _objects {};
             UStringList _allRegions {};
             HFBandPtr   _voidBand {};
+
+            // Serialize and deserialize the content of the repository for the binary cache.
+            void saveToCache(ByteBlock& data) const;
+            bool loadFromCache(const ByteBlock& data, std::set<UString>& regionSet);
         };
     };
 }
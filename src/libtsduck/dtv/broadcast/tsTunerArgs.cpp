@@ -206,8 +206,9 @@ void ts::TunerArgs::defineArgs(Args& args, bool allow_short_options)
 
         args.option(u"demux-buffer-size", 0, Args::UNSIGNED);
         args.help(u"demux-buffer-size",
-                  u"Default buffer size, in bytes, of the demux device. "
-                  u"The default is 1 MB.");
+                  u"Default buffer size, in bytes, of the demux and DVR devices. "
+                  u"The default is 1 MB. Increase this value if input overflows "
+                  u"are reported on high bitrate streams.");
 
 #elif defined(TS_WINDOWS)
 
@@ -153,6 +153,11 @@ bool ts::TunerEmulator::open(const UString& device_name, bool info_only)
     _duck.report().debug(u"loaded %d emulated channels", _channels.size());
 
     if (success) {
+        // Index the channels by center frequency for fast lookup in tune().
+        for (size_t i = 0; i < _channels.size(); ++i) {
+            _freq_index.insert(std::make_pair(_channels[i].frequency, i));
+            _max_half_band = std::max(_max_half_band, std::max<uint64_t>(1, _channels[i].bandwidth / 2));
+        }
         _xml_file_path = device_name;
         _info_only = info_only;
         _state = State::OPEN;
@@ -176,14 +181,22 @@ bool ts::TunerEmulator::close(bool silent)
     // Stop reception (close resources).
     stop(silent);
 
+    // Close the cached TS file, if any (stop() keeps it open).
+    if (_file.isOpen()) {
+        _file.close(silent ? NULLREP : _duck.report());
+    }
+
     // Cleanup internal state.
     _channels.clear();
+    _freq_index.clear();
+    _max_half_band = 0;
     _delivery_systems.clear();
     _xml_file_path.clear();
     _info_only = false;
     _tune_index = 0;
     _tune_frequency = 0;
     _strength = -1;
+    _file_index = NPOS;
     _state = State::CLOSED;
     return true;
 }
@@ -262,10 +275,16 @@ bool ts::TunerEmulator::tune(ModulationArgs& params)
         return false;
     }
 
-    // Look for the first channel into which the frequency falls.
-    size_t index = 0;
-    while (index < _channels.size() && !_channels[index].inBand(freq)) {
-        index++;
+    // Look for the first channel (in XML order) into which the frequency falls.
+    // The index is sorted by center frequency: only the channels within the
+    // largest possible half bandwidth around the target need to be checked.
+    size_t index = _channels.size();
+    const auto low = _freq_index.lower_bound(freq <= _max_half_band ? 0 : freq - _max_half_band);
+    const auto high = _freq_index.upper_bound(freq + _max_half_band);
+    for (auto it = low; it != high; ++it) {
+        if (it->second < index && _channels[it->second].inBand(freq)) {
+            index = it->second;
+        }
     }
     if (index >= _channels.size()) {
         _duck.report().error(u"no signal at %'d Hz", freq);
@@ -319,17 +338,32 @@ bool ts::TunerEmulator::start()
         return false;
     }
 
-    assert(!_file.isOpen());
     assert(!_pipe.isOpen());
     assert(_tune_index < _channels.size());
 
     const Channel& chan(_channels[_tune_index]);
     if (!chan.file.empty()) {
-        if (!_file.openRead(chan.file, 0, 0, _duck.report())) {
-            return false;
+        // The TS file of the previous reception is kept open by stop(). When
+        // re-tuning to the same channel, continue reading from the current
+        // position, as with a real mux. Repeated start/stop sequences on the
+        // same frequencies (eg. offset scanning) then run at I/O speed,
+        // without reopening the file each time.
+        if (_file.isOpen() && _file_index != _tune_index) {
+            _file.close(_duck.report());
+        }
+        if (!_file.isOpen()) {
+            if (!_file.openRead(chan.file, 0, 0, _duck.report())) {
+                return false;
+            }
+            _file_index = _tune_index;
         }
     }
     else if (!chan.pipe.empty()) {
+        // Close the cached TS file of a previous channel, if any.
+        if (_file.isOpen()) {
+            _file.close(_duck.report());
+            _file_index = NPOS;
+        }
         if (!_pipe.open(chan.pipe, ForkPipe::SYNCHRONOUS, 0, _duck.report(), ForkPipe::STDOUT_PIPE, ForkPipe::STDIN_NONE)) {
             return false;
         }
@@ -346,10 +380,9 @@ bool ts::TunerEmulator::start()
 
 bool ts::TunerEmulator::stop(bool silent)
 {
-    // Close resources, regardless of state.
-    if (_file.isOpen()) {
-        _file.close(silent ? NULLREP : _duck.report());
-    }
+    // Close resources, regardless of state. The TS file is kept open: it is
+    // reused when the same channel is started again, or closed by the next
+    // start() on another channel, or by close().
     if (_pipe.isOpen()) {
         _pipe.close(silent ? NULLREP : _duck.report());
     }
@@ -129,5 +129,8 @@ namespace ts {
         size_t               _tune_index = 0;        // Currently tuned channel.
         uint64_t             _tune_frequency = 0;    // Requested frequency.
         int                  _strength = -1;         // Signal strength in percent.
+        size_t               _file_index = NPOS;     // Channel of the currently open TS file.
+        uint64_t             _max_half_band = 0;     // Half of the largest channel bandwidth.
+        std::multimap<uint64_t, size_t> _freq_index {};  // Channel indexes, sorted by center frequency.
     };
 }
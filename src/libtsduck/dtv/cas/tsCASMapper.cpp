@@ -37,6 +37,9 @@ void ts::CASMapper::reset()
 {
     _demux.reset();
     _pids.clear();
+    _cas_ids.fill(0);
+    _ecm_pids.reset();
+    _emm_pids.reset();
 }
 
 
@@ -96,8 +99,15 @@ void ts::CASMapper::analyzeCADescriptors(const DescriptorList& descs, bool is_ec
             const CADescriptorPtr cadesc(new CADescriptor(_duck, desc));
             if (cadesc != nullptr && cadesc->isValid()) {
                 const std::string cas_name(CASIdName(_duck, cadesc->cas_id).toUTF8());
-                _pids[cadesc->ca_pid] = PIDDescription(cadesc->cas_id, is_ecm, cadesc);
-                _duck.report().debug(u"Found %s PID %n for CAS id 0x%X (%s)", is_ecm ? u"ECM" : u"EMM", cadesc->ca_pid, cadesc->cas_id, cas_name);
+                const PID ca_pid = cadesc->ca_pid;
+                _pids[ca_pid] = PIDDescription(cadesc->cas_id, is_ecm, cadesc);
+                // Keep the flat mirror in sync (a PID may switch between ECM and EMM).
+                if (ca_pid < PID_MAX) {
+                    _cas_ids[ca_pid] = cadesc->cas_id;
+                    _ecm_pids.set(ca_pid, is_ecm);
+                    _emm_pids.set(ca_pid, !is_ecm);
+                }
+                _duck.report().debug(u"Found %s PID %n for CAS id 0x%X (%s)", is_ecm ? u"ECM" : u"EMM", ca_pid, cadesc->cas_id, cas_name);
             }
         }
     }
@@ -111,20 +121,17 @@ void ts::CASMapper::analyzeCADescriptors(const DescriptorList& descs, bool is_ec
 ts::CASID ts::CASMapper::casId(PID pid) const
 {
     // Get CAS id for this PID or get default CAS from context.
-    const auto it = _pids.find(pid);
-    return it == _pids.end() ? _duck.casId() : it->second.cas_id;
+    return knownPID(pid) ? _cas_ids[pid] : _duck.casId();
 }
 
 bool ts::CASMapper::isECM(PID pid) const
 {
-    const auto it = _pids.find(pid);
-    return it != _pids.end() && it->second.is_ecm;
+    return pid < PID_MAX && _ecm_pids.test(pid);
 }
 
 bool ts::CASMapper::isEMM(PID pid) const
 {
-    const auto it = _pids.find(pid);
-    return it != _pids.end() && !it->second.is_ecm;
+    return pid < PID_MAX && _emm_pids.test(pid);
 }
 
 bool ts::CASMapper::getCADescriptor(PID pid, CADescriptorPtr& desc) const
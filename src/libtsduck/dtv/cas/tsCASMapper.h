@@ -66,7 +66,18 @@ namespace ts {
         //! @param [in] pid A PID to check.
         //! @return True if @ pid is a known ECM or EMM PID.
         //!
-        bool knownPID(PID pid) const { return _pids.contains(pid); }
+        bool knownPID(PID pid) const { return pid < PID_MAX && (_ecm_pids.test(pid) || _emm_pids.test(pid)); }
+
+        //!
+        //! Get the sets of all known ECM and EMM PID's in one bulk query.
+        //! @param [out] ecm_pids Set of all known ECM PID's.
+        //! @param [out] emm_pids Set of all known EMM PID's.
+        //!
+        void getCAPIDs(PIDSet& ecm_pids, PIDSet& emm_pids) const
+        {
+            ecm_pids = _ecm_pids;
+            emm_pids = _emm_pids;
+        }
 
         //!
         //! Get the CAS id of a CA PID (ECM or EMM).
@@ -125,6 +136,13 @@ namespace ts {
         SectionDemux      _demux;
         PIDDescriptionMap _pids {};
 
+        // Flat per-PID mirror of _pids. The CA descriptors stay in the map,
+        // the packet classification queries are simple array and bitset loads.
+        // The entries are overwritten when a new version of a table redefines a PID.
+        std::array<CASID, PID_MAX> _cas_ids {};  // CAS id per CA PID, valid when the PID is in one of the two sets below.
+        PIDSet _ecm_pids {};                     // Known ECM PID's.
+        PIDSet _emm_pids {};                     // Known EMM PID's.
+
         // Implementation of TableHandlerInterface
         virtual void handleTable(SectionDemux&, const BinaryTable&) override;
     };
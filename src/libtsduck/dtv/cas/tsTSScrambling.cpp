@@ -530,3 +530,17 @@ bool ts::TSScrambling::decrypt(TSPacket& pkt)
     }
     return ok;
 }
+
+
+//----------------------------------------------------------------------------
+// Decrypt a batch of TS packets.
+//----------------------------------------------------------------------------
+
+bool ts::TSScrambling::decrypt(TSPacket* const* pkts, size_t count)
+{
+    bool ok = true;
+    for (size_t i = 0; i < count; ++i) {
+        ok = decrypt(*pkts[i]) && ok;
+    }
+    return ok;
+}
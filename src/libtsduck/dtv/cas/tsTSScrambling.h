@@ -191,6 +191,17 @@ namespace ts {
         //!
         bool decrypt(TSPacket& pkt);
 
+        //!
+        //! Decrypt a batch of TS packets, each with the CW corresponding to the parity in the packet.
+        //! The packets are decrypted in sequence. With fixed control words, the behaviour is
+        //! identical to calling decrypt() on each packet: the next CW from the list is used
+        //! each time the parity changes from one packet to the next.
+        //! @param [in] pkts Address of an array of pointers to the packets to decrypt.
+        //! @param [in] count Number of packets in @a pkts.
+        //! @return True on success, false if at least one packet could not be decrypted.
+        //!
+        bool decrypt(TSPacket* const* pkts, size_t count);
+
     private:
         // List of control words
         using CWList = std::list<ByteBlock>;
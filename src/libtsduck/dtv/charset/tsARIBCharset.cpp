@@ -173,51 +173,91 @@ void ts::ARIBCharset::Decoder::decodeAll(const uint8_t* data, size_t size)
     _data = data;
     _size = size;
 
+    // Classification of input bytes. The flattened table below maps each byte
+    // value to one action, replacing a chain of comparisons per input byte.
+    enum : uint8_t {ACT_SP_GL, ACT_SP_GR, ACT_GL, ACT_GR, ACT_LS0, ACT_LS1, ACT_SS2, ACT_SS3, ACT_ESC, ACT_CTRL};
+    static constexpr std::array<uint8_t, 256> ACTIONS = []() {
+        std::array<uint8_t, 256> table {};
+        for (size_t b = 0; b < table.size(); ++b) {
+            switch (b) {
+                case SP: table[b] = ACT_SP_GL; break;
+                case SP + 0x80: table[b] = ACT_SP_GR; break;
+                case LS0: table[b] = ACT_LS0; break;
+                case LS1: table[b] = ACT_LS1; break;
+                case SS2: table[b] = ACT_SS2; break;
+                case SS3: table[b] = ACT_SS3; break;
+                case ESC: table[b] = ACT_ESC; break;
+                default: {
+                    if (b >= GL_FIRST && b <= GL_LAST) {
+                        table[b] = ACT_GL;
+                    }
+                    else if (b >= GR_FIRST && b <= GR_LAST) {
+                        table[b] = ACT_GR;
+                    }
+                    else {
+                        table[b] = ACT_CTRL;
+                    }
+                    break;
+                }
+            }
+        }
+        return table;
+    }();
+
     // Loop in input byte sequences.
     while (_size > 0) {
-        if (match(0x20)) {
-            // Always a space in all character sets.
-            // Use a "Japanese space" when GL set is not alphanumeric.
-            _str.push_back(_G[_GL] == &ALPHANUMERIC_MAP ? SPACE : IDEOGRAPHIC_SPACE);
-        }
-        else if (match(0xA0)) {
-            // Always a space in all character sets.
-            // Use a "Japanese space" when GR set is not alphanumeric.
-            _str.push_back(_G[_GR] == &ALPHANUMERIC_MAP ? SPACE : IDEOGRAPHIC_SPACE);
-        }
-        else if (*_data >= GL_FIRST && *_data <= GL_LAST) {
-            // A left-side code.
-            _success = decodeOneChar(_G[_GL]) && _success;
-            // Restore locked shift if a single shift was used.
-            _GL = _lockedGL;
-        }
-        else if (*_data >= GR_FIRST && *_data <= GR_LAST) {
-            // A right-side code.
-            _success = decodeOneChar(_G[_GR]) && _success;
-        }
-        else if (match(LS0)) {
-            // Locking shift G0.
-            _GL = _lockedGL = 0;
-        }
-        else if (match(LS1)) {
-            // Locking shift G1.
-            _GL = _lockedGL = 1;
-        }
-        else if (match(SS2)) {
-            // Single shift G2.
-            _GL = 2;
-        }
-        else if (match(SS3)) {
-            // Single shift G3.
-            _GL = 3;
-        }
-        else if (match(ESC)) {
-            // Escape sequence.
-            _success = escape() && _success;
-        }
-        else {
-            // Character in C0 or C1 area.
-            _success = processControl() && _success;
+        switch (ACTIONS[*_data]) {
+            case ACT_SP_GL:
+                // Always a space in all character sets.
+                // Use a "Japanese space" when GL set is not alphanumeric.
+                _data++; _size--;
+                _str.push_back(_G[_GL] == &ALPHANUMERIC_MAP ? SPACE : IDEOGRAPHIC_SPACE);
+                break;
+            case ACT_SP_GR:
+                // Always a space in all character sets.
+                // Use a "Japanese space" when GR set is not alphanumeric.
+                _data++; _size--;
+                _str.push_back(_G[_GR] == &ALPHANUMERIC_MAP ? SPACE : IDEOGRAPHIC_SPACE);
+                break;
+            case ACT_GL:
+                // A left-side code.
+                _success = decodeOneChar(_G[_GL]) && _success;
+                // Restore locked shift if a single shift was used.
+                _GL = _lockedGL;
+                break;
+            case ACT_GR:
+                // A right-side code.
+                _success = decodeOneChar(_G[_GR]) && _success;
+                break;
+            case ACT_LS0:
+                // Locking shift G0.
+                _data++; _size--;
+                _GL = _lockedGL = 0;
+                break;
+            case ACT_LS1:
+                // Locking shift G1.
+                _data++; _size--;
+                _GL = _lockedGL = 1;
+                break;
+            case ACT_SS2:
+                // Single shift G2.
+                _data++; _size--;
+                _GL = 2;
+                break;
+            case ACT_SS3:
+                // Single shift G3.
+                _data++; _size--;
+                _GL = 3;
+                break;
+            case ACT_ESC:
+                // Escape sequence.
+                _data++; _size--;
+                _success = escape() && _success;
+                break;
+            default:
+                // Character in C0 or C1 area.
+                _success = processControl() && _success;
+                break;
         }
     }
 
@@ -43,31 +43,45 @@ ts::DVBCharTable::~DVBCharTable()
 
 TS_DEFINE_SINGLETON(ts::DVBCharTable::TableCodeRepository);
 
-ts::DVBCharTable::TableCodeRepository::TableCodeRepository() :
-    _map()
+ts::DVBCharTable::TableCodeRepository::TableCodeRepository()
 {
 }
 
 const ts::DVBCharTable* ts::DVBCharTable::TableCodeRepository::get(uint32_t code) const
 {
-    const auto it = _map.find(code);
-    return it == _map.end() ? nullptr : it->second;
+    if (code < _oneByte.size()) {
+        // One-byte table code, direct access.
+        return _oneByte[code];
+    }
+    else {
+        const auto it = _map.find(code);
+        return it == _map.end() ? nullptr : it->second;
+    }
 }
 
 void ts::DVBCharTable::TableCodeRepository::add(uint32_t code, const DVBCharTable* charset)
 {
-    const auto it = _map.find(code);
-    if (it == _map.end()) {
-        // Charset not yet registered.
-        _map.insert(std::make_pair(code, charset));
+    if (code < _oneByte.size()) {
+        if (_oneByte[code] != nullptr) {
+            throw DuplicateCharset(charset->name());
+        }
+        _oneByte[code] = charset;
     }
-    else {
+    else if (_map.contains(code)) {
         throw DuplicateCharset(charset->name());
     }
+    else {
+        _map.insert(std::make_pair(code, charset));
+    }
 }
 
 void ts::DVBCharTable::TableCodeRepository::remove(const DVBCharTable* charset)
 {
+    for (auto& entry : _oneByte) {
+        if (entry == charset) {
+            entry = nullptr;
+        }
+    }
     auto it = _map.begin();
     while (it != _map.end()) {
         if (it->second == charset) {
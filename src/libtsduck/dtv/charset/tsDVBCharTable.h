@@ -143,7 +143,11 @@ namespace ts {
             void add(uint32_t code, const DVBCharTable* charset);
             void remove(const DVBCharTable* charset);
         private:
-            std::map<uint32_t, const DVBCharTable*> _map;
+            // Direct access table for one-byte table codes, the most common case in practice
+            // (DecodeTableCode() also folds the three-byte forms of the ISO 8859 sets into
+            // their one-byte equivalent).
+            std::array<const DVBCharTable*, 0x20> _oneByte {};
+            std::map<uint32_t, const DVBCharTable*> _map {};
         };
     };
 }
@@ -45,6 +45,22 @@ ts::DVBCharTableSingleByte::DVBCharTableSingleByte(const UChar* name, uint32_t t
             _reversedDiacritical.set(it - 0xA0);
         }
     }
+
+    // Direct byte to code point translation table. Unassigned bytes remain zero.
+    for (size_t i = 0x20; i <= 0x7E; i++) {
+        _codePoints[i] = UChar(i); // ASCII range = identity
+    }
+    _codePoints[DVB_SINGLE_BYTE_CRLF] = LINE_FEED;
+    for (size_t i = 0; i < _upperCodePoints.size(); i++) {
+        _codePoints[0xA0 + i] = UChar(_upperCodePoints[i]);
+    }
+
+    // Bytes which cannot be bulk-translated and need individual processing when decoding.
+    for (size_t i = 0; i < _codePoints.size(); i++) {
+        if (_codePoints[i] == 0 || IsCombiningDiacritical(_codePoints[i]) || (i >= 0xA0 && _reversedDiacritical.test(i - 0xA0))) {
+            _specialBytes.set(i);
+        }
+    }
 }
 
 
@@ -60,21 +76,28 @@ bool ts::DVBCharTableSingleByte::decode(UString& str, const uint8_t* dvb, size_t
     bool reverseNext = false;  // after decoding next character, it shall be swapped with previous one.
     bool hasDiacritical = false;
 
-    for (; dvb != nullptr && dvbSize > 0; --dvbSize) {
-        // Get next byte
-        const uint8_t b = *dvb++;
-        // Convert it to a code point
-        uint16_t cp = 0;
-        if (b >= 0x20 && b <= 0x7E) {
-            cp = b; // ASCII range = identity
-        }
-        else if (b >= 0xA0) {
-            cp = _upperCodePoints[b - 0xA0];
-        }
-        else if (b == DVB_SINGLE_BYTE_CRLF) {
-            cp = LINE_FEED;
+    while (dvb != nullptr && dvbSize > 0) {
+        // Bulk-translate a run of plain characters, one unconditional table lookup per byte.
+        // Stop on the first byte which needs individual processing: untranslatable byte,
+        // diacritical mark or letter to reorder after a reversed diacritical mark.
+        if (!reverseNext) {
+            size_t run = 0;
+            while (run < dvbSize && !_specialBytes.test(dvb[run])) {
+                run++;
+            }
+            for (size_t i = 0; i < run; i++) {
+                str.push_back(_codePoints[dvb[i]]);
+            }
+            dvb += run;
+            dvbSize -= run;
+            if (dvbSize == 0) {
+                break;
+            }
         }
-        // Add in result if no error.
+        // Individual processing of one special byte.
+        const uint8_t b = *dvb++;
+        dvbSize--;
+        const UChar cp = _codePoints[b];
         if (cp == 0) {
             // Untranslatable character.
             status = false;
@@ -83,14 +106,14 @@ bool ts::DVBCharTableSingleByte::decode(UString& str, const uint8_t* dvb, size_t
             // Insert decoded character before the previous one.
             // This is typically a letter coming after a reversable diacritical mark.
             // In Unicode, the letter must preceed the diacritical mark.
-            str.insert(str.length() - 1, 1, UChar(cp));
+            str.insert(str.length() - 1, 1, cp);
         }
         else {
             // Simply add the decoded character.
-            str.push_back(UChar(cp));
+            str.push_back(cp);
         }
         // Try the presence of diacritical, reversable or not.
-        hasDiacritical = hasDiacritical || IsCombiningDiacritical(UChar(cp));
+        hasDiacritical = hasDiacritical || IsCombiningDiacritical(cp);
         // Shall we perform mark/letter swap next time?
         reverseNext = b >= 0xA0 && _reversedDiacritical.test(b - 0xA0);
     }
@@ -86,6 +86,14 @@ namespace ts {
         // List of code points for byte values 0xA0-0xFF. Always contain 96 values.
         const std::vector<uint16_t> _upperCodePoints {};
 
+        // Direct translation table for all byte values, zero means untranslatable.
+        std::array<UChar, 256> _codePoints {};
+
+        // Bitmap of byte values which need individual processing when decoding a string:
+        // untranslatable bytes, diacritical marks, reversed diacritical marks.
+        // All other bytes can be bulk-translated through _codePoints.
+        std::bitset<256> _specialBytes {};
+
         // Reverse mapping for complete character set (key = code point, value = byte rep).
         std::map<UChar, uint8_t> _bytesMap {};
 
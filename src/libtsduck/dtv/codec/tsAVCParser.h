@@ -259,17 +259,36 @@ bool ts::AVCParser::expColomb(INT& val)
 
     // See ISO/IEC 14496-10 section 9.1
     val = 0;
-    int leading_zero_bits = -1;
-    for (uint8_t b = 0; b == 0; b = readNextBit()) {
+    size_t leading_zero_bits = 0;
+    for (;;) {
         if (_byte >= _end) {
             return false;
         }
-        leading_zero_bits++;
+        // Remaining bits of the current byte, left-aligned in an 8-bit value.
+        const uint8_t rest = uint8_t(*_byte << _bit);
+        if (rest == 0) {
+            // All remaining bits of the current byte are zero, count them at once
+            // instead of bit by bit. Move to the next byte (_bit can be temporarily
+            // 8 before calling skipToNextByte(), see readNextBit()).
+            leading_zero_bits += 8 - _bit;
+            _bit = 8;
+            skipToNextByte();
+        }
+        else {
+            // The first 1-bit ending the leading zeroes is in the current byte.
+            const size_t zeroes = size_t(std::countl_zero(rest));
+            leading_zero_bits += zeroes;
+            _bit += zeroes + 1;
+            if (_bit > 7) {
+                skipToNextByte();
+            }
+            break;
+        }
     }
     if (!readBits(val, leading_zero_bits)) {
         return false;
     }
-    if (leading_zero_bits < int(8 * sizeof(INT))) {
+    if (leading_zero_bits < 8 * sizeof(INT)) {
         val += (INT(1) << leading_zero_bits) - 1;
     }
     return true;
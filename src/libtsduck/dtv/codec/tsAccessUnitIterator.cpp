@@ -128,20 +128,14 @@ bool ts::AccessUnitIterator::next()
     _nalunit = p1 + StartCodePrefixSize;
 
     // Locate end of access unit: ends with 00 00 00, 00 00 01 or end of data.
-    const uint8_t* const p2 = LocateZeroZero(_nalunit, remain, StartCodePrefixThird);
-    const uint8_t* const p3 = LocateZeroZero(_nalunit, remain, 0x00);
-    if (p2 == nullptr && p3 == nullptr) {
+    // Use one single scan for both terminators instead of two passes over the NALunit.
+    const uint8_t* const p2 = LocateZeroZero(_nalunit, remain, 0x00, StartCodePrefixThird);
+    if (p2 == nullptr) {
         // No 00 00 01, no 00 00 00, the NALunit extends up to the end of data.
         _nalunit_size = remain;
     }
-    else if (p2 == nullptr || (p3 != nullptr && p3 < p2)) {
-        // NALunit ends at 00 00 00.
-        assert(p3 != nullptr);
-        _nalunit_size = p3 - _nalunit;
-    }
     else {
-        // NALunit ends at 00 00 01.
-        assert(p2 != nullptr);
+        // NALunit ends at 00 00 00 or 00 00 01.
         _nalunit_size = p2 - _nalunit;
     }
 
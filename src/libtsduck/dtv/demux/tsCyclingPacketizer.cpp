@@ -149,6 +149,9 @@ void ts::CyclingPacketizer::addSection(const SectionPtr& sect, cn::milliseconds
 
         _section_count++;
         _remain_in_cycle++;
+
+        // The cached cycle no longer reflects the section list.
+        invalidateCache();
     }
 }
 
@@ -159,20 +162,32 @@ void ts::CyclingPacketizer::addSection(const SectionPtr& sect, cn::milliseconds
 
 void ts::CyclingPacketizer::removeSections(TID tid)
 {
+    const size_t initial_count = _section_count;
     removeSections(_sched_sections, tid, 0, 0, false, false, true);
     removeSections(_other_sections, tid, 0, 0, false, false, false);
+    if (_section_count != initial_count) {
+        invalidateCache();
+    }
 }
 
 void ts::CyclingPacketizer::removeSections(TID tid, uint16_t tid_ext)
 {
+    const size_t initial_count = _section_count;
     removeSections(_sched_sections, tid, tid_ext, 0, true, false, true);
     removeSections(_other_sections, tid, tid_ext, 0, true, false, false);
+    if (_section_count != initial_count) {
+        invalidateCache();
+    }
 }
 
 void ts::CyclingPacketizer::removeSections(TID tid, uint16_t tid_ext, uint8_t sec_number)
 {
+    const size_t initial_count = _section_count;
     removeSections(_sched_sections, tid, tid_ext, sec_number, true, true, true);
     removeSections(_other_sections, tid, tid_ext, sec_number, true, true, false);
+    if (_section_count != initial_count) {
+        invalidateCache();
+    }
 }
 
 
@@ -217,6 +232,32 @@ void ts::CyclingPacketizer::removeAll()
     _sched_packets = 0;
     _sched_sections.clear();
     _other_sections.clear();
+    invalidateCache();
+}
+
+
+//----------------------------------------------------------------------------
+// Invalidate the cached cycle after a modification of the section list.
+//----------------------------------------------------------------------------
+
+void ts::CyclingPacketizer::invalidateCache()
+{
+    if ((_cache_state == CacheState::REPLAY && !_replay_boundary) || _cache_state == CacheState::DRAINING) {
+        // A section of the replayed cycle is in progress. As documented, the rest of
+        // this section will be packetized: keep replaying until a section boundary.
+        _cache_state = CacheState::DRAINING;
+    }
+    else {
+        if (_cache_state == CacheState::REPLAY && _cache_index != 0) {
+            // The replay is dropped in the middle of a cycle, _cycle_end still
+            // describes the end of the recorded cycle and is no longer relevant.
+            _cycle_end = UNDEFINED;
+        }
+        _cache.clear();
+        _cache_state = CacheState::IDLE;
+        _cache_index = 0;
+    }
+    _cache_oversize = false;
 }
 
 
@@ -229,6 +270,12 @@ void ts::CyclingPacketizer::removeAll()
 void ts::CyclingPacketizer::reset()
 {
     removeAll();
+    // Unlike removeAll(), a reset drops the section in progress: empty the cache now.
+    _cache.clear();
+    _cache_state = CacheState::IDLE;
+    _cache_index = 0;
+    _replay_boundary = true;
+    _cache_oversize = false;
     Packetizer::reset();
 }
 
@@ -289,6 +336,9 @@ void ts::CyclingPacketizer::setBitRate(const BitRate& new_bitrate)
 
     // Remember new bitrate
     _bitrate = new_bitrate;
+
+    // The scheduling of sections may have changed.
+    invalidateCache();
 }
 
 
@@ -376,12 +426,99 @@ bool ts::CyclingPacketizer::doStuffing()
 }
 
 
+//----------------------------------------------------------------------------
+// Build the next MPEG packet for the list of sections.
+//----------------------------------------------------------------------------
+
+bool ts::CyclingPacketizer::getNextPacket(TSPacket& pkt)
+{
+    // When a cached cycle is being replayed, check that the packetization options
+    // are still those of the recorded cycle.
+    if (_cache_state == CacheState::REPLAY && (_stuffing != _cache_stuffing || headerSplitAllowed() != _cache_split)) {
+        invalidateCache();
+    }
+
+    // Exit the draining state at a section boundary: the section which was in
+    // progress when the cache was invalidated is now complete.
+    if (_cache_state == CacheState::DRAINING && _replay_boundary) {
+        _cache.clear();
+        _cache_state = CacheState::IDLE;
+        _cache_index = 0;
+    }
+
+    // Replay the pre-serialized packets of the cached cycle.
+    if (_cache_state == CacheState::REPLAY || _cache_state == CacheState::DRAINING) {
+        assert(_cache_index < _cache.size());
+        const CachedPacket& cp(_cache[_cache_index++]);
+        pkt = cp.packet;
+        // Rewrite PID and continuity counter, count the packet.
+        configurePacket(pkt, false);
+        _replay_boundary = cp.section_boundary;
+        if (_cache_index >= _cache.size()) {
+            // End of the replayed cycle.
+            _cache_index = 0;
+            _current_cycle++;
+        }
+        return true;
+    }
+
+    // Live packetization. Check if the next packet starts a cycle which can be
+    // recorded. Only static carousels are cacheable: without scheduled section,
+    // the emission order repeats identically on each cycle, and the stuffing at
+    // end of cycle guarantees that the cycle ends on a packet boundary.
+    if (_cache_state == CacheState::IDLE &&
+        !_cache_oversize &&
+        _section_count > 0 &&
+        _sched_sections.empty() &&
+        _stuffing != StuffingPolicy::NEVER &&
+        Packetizer::atSectionBoundary() &&
+        _remain_in_cycle == _section_count)
+    {
+        _cache_state = CacheState::RECORDING;
+        _cache_stuffing = _stuffing;
+        _cache_split = headerSplitAllowed();
+        _cache.clear();
+    }
+
+    const bool ok = Packetizer::getNextPacket(pkt);
+
+    // Record the generated packet when a cycle is being recorded.
+    if (_cache_state == CacheState::RECORDING) {
+        if (!ok || _stuffing != _cache_stuffing || headerSplitAllowed() != _cache_split) {
+            // Null packet or changed packetization options, this cycle cannot be replayed.
+            _cache.clear();
+            _cache_state = CacheState::IDLE;
+        }
+        else {
+            _cache.push_back({pkt, Packetizer::atSectionBoundary()});
+            if (atCycleBoundary()) {
+                // A complete cycle was recorded, replay it from now on.
+                _cache_state = CacheState::REPLAY;
+                _cache_index = 0;
+                _replay_boundary = true;
+            }
+            else if (_cache.size() >= MAX_CACHED_PACKETS) {
+                // The cycle is too large to cache. Do not retry on each cycle.
+                _cache.clear();
+                _cache_state = CacheState::IDLE;
+                _cache_oversize = true;
+            }
+        }
+    }
+    return ok;
+}
+
+
 //----------------------------------------------------------------------------
 // Return true when the last generated packet was the last packet in the cycle.
 //----------------------------------------------------------------------------
 
 bool ts::CyclingPacketizer::atCycleBoundary() const
 {
+    if (_cache_state == CacheState::REPLAY || _cache_state == CacheState::DRAINING) {
+        // Replaying the cached cycle: the boundary is the wrap point of the cache.
+        return _cache_index == 0;
+    }
     // Coverity false positive:  _cycle_end + 1 overflows only if _cycle_end == UNDEFINED, which is excluded just before.
     // coverity[INTEGER_OVERFLOW]
     return atSectionBoundary() && _cycle_end != UNDEFINED && _cycle_end + 1 == sectionCount();
@@ -416,7 +553,8 @@ std::ostream& ts::CyclingPacketizer::display(std::ostream& strm) const
         << "  Section cycle end: " << (_cycle_end == UNDEFINED ? u"undefined" : UString::Decimal(_cycle_end)) << std::endl
         << "  Stored sections: " << _section_count << std::endl
         << "  Scheduled sections: " << _sched_sections.size() << std::endl
-        << "  Scheduled packets max: " << _sched_packets << std::endl;
+        << "  Scheduled packets max: " << _sched_packets << std::endl
+        << "  Cached cycle packets: " << _cache.size() << std::endl;
     for (auto& it : _sched_sections) {
         it->display(duck(), strm);
     }
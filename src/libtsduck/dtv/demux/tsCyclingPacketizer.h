@@ -16,6 +16,7 @@
 #include "tsSectionProviderInterface.h"
 #include "tsBinaryTable.h"
 #include "tsAbstractTable.h"
+#include "tsTSPacket.h"
 
 namespace ts {
     //!
@@ -53,6 +54,13 @@ namespace ts {
     //! A bitrate is specified in bits/second. Zero means undefined.
     //! A repetition rate is specified in milliseconds. Zero means undefined.
     //!
+    //! When the packetizer runs a static carousel (no scheduled section), the
+    //! TS packets of one complete cycle are internally cached and replayed,
+    //! with updated continuity counters, as long as the section list does not
+    //! change. The steady-state generation of packets is then a simple packet
+    //! copy instead of a re-serialization of the sections. The cache is
+    //! automatically invalidated when sections are added or removed.
+    //!
     class TSDUCKDLL CyclingPacketizer: public Packetizer, private SectionProviderInterface
     {
         TS_NOBUILD_NOCOPY(CyclingPacketizer);
@@ -189,6 +197,7 @@ namespace ts {
 
         // Inherited from Packetizer.
         virtual void reset() override;
+        virtual bool getNextPacket(TSPacket& packet) override;
         virtual std::ostream& display(std::ostream& strm) const override;
 
     private:
@@ -230,6 +239,40 @@ namespace ts {
 
         static constexpr SectionCounter UNDEFINED = std::numeric_limits<SectionCounter>::max();
 
+        // State of the cache of pre-serialized TS packets. When the packetizer runs a
+        // static carousel (no scheduled section), the packets of one complete cycle are
+        // recorded and then replayed as long as the section list does not change.
+        enum class CacheState {
+            IDLE,       // No cached cycle, waiting for the start of a recordable cycle.
+            RECORDING,  // Recording the TS packets of the current cycle.
+            REPLAY,     // Replaying the recorded cycle.
+            DRAINING    // Cache invalidated, finish the section in progress before resuming.
+        };
+
+        // One pre-serialized TS packet of the cached cycle.
+        class CachedPacket
+        {
+        public:
+            TSPacket packet {};             // Packet image. PID and continuity are rewritten on replay.
+            bool section_boundary = false;  // No unfinished section at end of this packet.
+        };
+
+        // Cycles larger than this are not cached (at most ~3 MB of cached packets).
+        static constexpr size_t MAX_CACHED_PACKETS = 16384;
+
+        // Packet image cache:
+        std::vector<CachedPacket> _cache {};
+        CacheState _cache_state = CacheState::IDLE;
+        size_t     _cache_index = 0;                           // Next cached packet to replay.
+        bool       _cache_oversize = false;                    // Current cycle is too large to cache.
+        bool       _replay_boundary = true;                    // Last replayed packet ended at a section boundary.
+        StuffingPolicy _cache_stuffing = StuffingPolicy::NEVER; // Stuffing policy when recording started.
+        bool       _cache_split = false;                       // Header split option when recording started.
+
+        // Invalidate the cached cycle after a modification of the section list.
+        // If a section of the replayed cycle is in progress, it will be completed first.
+        void invalidateCache();
+
         // Insert a scheduled section in the list, sorted by due_packet.
         void addScheduledSection(const SectionDescPtr&);
 
@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsSectionDemux.h"
+#include "tsSectionBufferPool.h"
 #include "tsPSIRepository.h"
 #include "tsDuckContext.h"
 #include "tsBinaryTable.h"
@@ -191,13 +192,15 @@ ts::SectionDemux::SectionDemux(DuckContext& duck, TableHandlerInterface* table_h
 void ts::SectionDemux::immediateReset()
 {
     SuperClass::immediateReset();
-    _pids.clear();
+    for (auto& pc : _pids) {
+        pc.reset();
+    }
 }
 
 void ts::SectionDemux::immediateResetPID(PID pid)
 {
     SuperClass::immediateResetPID(pid);
-    _pids.erase(pid);
+    _pids[pid].reset();
 }
 
 
@@ -224,7 +227,10 @@ void ts::SectionDemux::processPacket(const TSPacket& pkt)
     // Get PID and reference to the PID context.
     // The PID context is created if did not exist.
     const PID pid = pkt.getPID();
-    PIDContext& pc(_pids[pid]);
+    if (_pids[pid] == nullptr) {
+        _pids[pid] = std::make_unique<PIDContext>();
+    }
+    PIDContext& pc(*_pids[pid]);
 
     // If TS packet is scrambled, we cannot decode it and we loose synchronization
     // on this PID (usually, PID's carrying sections are not scrambled).
@@ -494,7 +500,9 @@ void ts::SectionDemux::processPacket(const TSPacket& pkt)
             SectionPtr sect_ptr;
 
             if (section_ok && (_section_handler != nullptr || (tc != nullptr && tc->sects[section_number] == nullptr))) {
-                sect_ptr = std::make_shared<Section>(ts_start, section_length, pid, CRC32::CHECK);
+                // The section content is copied into a recycled buffer from the pool
+                // to reduce the allocator pressure on section-heavy streams.
+                sect_ptr = std::make_shared<Section>(SectionBufferPool::Instance().get(ts_start, section_length), pid, CRC32::CHECK);
                 sect_ptr->setFirstTSPacketIndex(pusi_pkt_index);
                 sect_ptr->setLastTSPacketIndex(_packet_count);
                 if (!sect_ptr->isValid()) {
@@ -563,10 +571,13 @@ void ts::SectionDemux::processPacket(const TSPacket& pkt)
 
 void ts::SectionDemux::fixAndFlush(bool pack, bool fill_eit)
 {
-    // Loop on all PID's.
-    for (auto& it1 : _pids) {
-        const PID pid = it1.first;
-        PIDContext& pc(it1.second);
+    // Loop on all PID's with a context.
+    for (size_t index = 0; index < _pids.size(); ++index) {
+        if (_pids[index] == nullptr) {
+            continue;
+        }
+        const PID pid = PID(index);
+        PIDContext& pc(*_pids[index]);
 
         // Mark that we are in the context of a table or section handler.
         // This is used to prevent the destruction of PID contexts during
@@ -594,9 +605,9 @@ void ts::SectionDemux::fixAndFlush(bool pack, bool fill_eit)
 
 bool ts::SectionDemux::notifyInvalid(PID pid, Section::Status status, const uint8_t* ts_start, size_t ts_size)
 {
-    if (_invalid_handler != nullptr) {
+    if (_invalid_handler != nullptr && _pids[pid] != nullptr) {
         // Build a demuxed data from the TS payload buffer.
-        PIDContext& pc(_pids[pid]);
+        PIDContext& pc(*_pids[pid]);
         if (ts_start >= pc.ts.data() && ts_start < pc.ts.dataEnd()) {
             DemuxedData data(ts_start, std::min<size_t>(ts_size, pc.ts.dataEnd() - ts_start), pid);
             data.setFirstTSPacketIndex(pc.pusi_pkt_index);
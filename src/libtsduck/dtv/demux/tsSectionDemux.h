@@ -282,7 +282,10 @@ namespace ts {
         TableHandlerInterface*          _table_handler = nullptr;
         SectionHandlerInterface*        _section_handler = nullptr;
         InvalidSectionHandlerInterface* _invalid_handler = nullptr;
-        std::map<PID,PIDContext>        _pids {};
+        // The PID contexts are in a flat array, directly indexed by PID, so that the
+        // per-packet lookup touches one predictable cache line, even when all 8192
+        // PID's are filtered. Entries are allocated on first use.
+        std::array<std::unique_ptr<PIDContext>, PID_MAX> _pids {};
         Status _status {};
         bool   _get_current = true;
         bool   _get_next = false;
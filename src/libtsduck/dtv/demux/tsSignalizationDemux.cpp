@@ -79,6 +79,91 @@ void ts::SignalizationDemux::reset()
 }
 
 
+//----------------------------------------------------------------------------
+// Save / restore the signalization state in a binary blob.
+//----------------------------------------------------------------------------
+
+// Layout of the blob: one format version byte, then a sequence of entries,
+// each made of a 2-byte PID followed by one complete section. Sections are
+// self-delimited by the length field in their header.
+namespace {
+    constexpr uint8_t SIGNALIZATION_STATE_VERSION = 1;
+}
+
+void ts::SignalizationDemux::saveState(ByteBlock& blob) const
+{
+    blob.clear();
+    blob.appendUInt8(SIGNALIZATION_STATE_VERSION);
+
+    // Serialize one table in the blob.
+    auto saveTable = [this, &blob](const AbstractLongTable& table, PID pid) {
+        BinaryTable bin;
+        table.serialize(_duck, bin);
+        for (size_t i = 0; i < bin.sectionCount(); ++i) {
+            const auto& sec(bin.sectionAt(i));
+            if (sec != nullptr && sec->isValid()) {
+                blob.appendUInt16(pid);
+                blob.append(sec->content(), sec->size());
+            }
+        }
+    };
+
+    if (_last_pat.isValid()) {
+        saveTable(_last_pat, PID_PAT);
+    }
+    if (_last_nit.isValid()) {
+        saveTable(_last_nit, nitPID());
+    }
+    for (const auto& it : _services) {
+        const ServiceContext& srv(*it.second);
+        if (srv.pmt.isValid() && srv.service.hasPMTPID()) {
+            saveTable(srv.pmt, srv.service.getPMTPID());
+        }
+    }
+}
+
+bool ts::SignalizationDemux::restoreState(const ByteBlock& blob)
+{
+    // Check the format version.
+    if (blob.size() < 1 || blob[0] != SIGNALIZATION_STATE_VERSION) {
+        return false;
+    }
+
+    BinaryTable table;
+    size_t index = 1;
+    while (index < blob.size()) {
+        // Get the PID and one section.
+        if (index + 2 > blob.size()) {
+            return false;
+        }
+        const PID pid = GetUInt16(blob.data() + index) & 0x1FFF;
+        index += 2;
+        const size_t sec_size = Section::SectionSize(blob.data() + index, blob.size() - index);
+        if (sec_size == 0 || index + sec_size > blob.size()) {
+            return false;
+        }
+        const auto sec = std::make_shared<Section>(blob.data() + index, sec_size, pid, CRC32::CHECK);
+        index += sec_size;
+        if (!sec->isValid()) {
+            // Ignore invalid sections, the blob structure itself is valid.
+            continue;
+        }
+        // Accumulate sections of the same table, process the table when complete.
+        if (!table.addSection(sec)) {
+            // Incompatible with the table being built, start a new one.
+            table.clear();
+            table.addSection(sec);
+        }
+        if (table.isValid()) {
+            // The table is complete, process it as if it was demuxed from the stream.
+            handleTable(_demux, table);
+            table.clear();
+        }
+    }
+    return true;
+}
+
+
 //----------------------------------------------------------------------------
 // This method feeds the demux with a TS packet.
 //----------------------------------------------------------------------------
@@ -88,6 +88,36 @@ namespace ts {
         //!
         void reset();
 
+        //!
+        //! Save the current signalization state in a compact binary blob.
+        //!
+        //! The blob contains the last version of the signalization tables which are
+        //! retained by this demux (PAT, NIT, PMT's). It can be used to prime another
+        //! instance of SignalizationDemux using restoreState(), typically in another
+        //! process working on the same stream, so that service-aware processing can
+        //! start on the first packet, without waiting for a full signalization cycle.
+        //!
+        //! @param [out] blob Returned binary state.
+        //! @see restoreState()
+        //!
+        void saveState(ByteBlock& blob) const;
+
+        //!
+        //! Prime the demux from a previously saved signalization state.
+        //!
+        //! The tables in the blob are processed as if they were demuxed from the
+        //! stream: the internal map of services and PID's is rebuilt and the
+        //! application handler is notified. When the same tables are later received
+        //! from the stream, they are processed again, as usual.
+        //!
+        //! @param [in] blob A binary state which was returned by saveState(),
+        //! possibly in another instance of SignalizationDemux.
+        //! @return True on success, false if the blob format is invalid. Invalid
+        //! tables in a valid blob are ignored.
+        //! @see saveState()
+        //!
+        bool restoreState(const ByteBlock& blob);
+
         //--------------------------------------------------------------------
         // Filtering by table id.
         //--------------------------------------------------------------------
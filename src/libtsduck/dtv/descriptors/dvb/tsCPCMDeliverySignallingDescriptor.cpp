@@ -270,7 +270,8 @@ void ts::CPCMDeliverySignallingDescriptor::DisplayDescriptor(TablesDisplay& disp
                     uint8_t CandRmask = buf.getUInt8();
                     disp << margin << UString::Format(u"cps[%03d] - C and R regime mask: ", i) << UString::Format(BYTE_TO_BINARY_PATTERN, BYTE_TO_BINARY(CandRmask)) << std::endl;
                     uint16_t cps_vector_length = buf.getUInt16();
-                    disp << margin << margin << UString::Dump(buf.getBytes(cps_vector_length), UString::SINGLE_LINE) << std::endl;
+                    const auto cps(buf.getBytesView(cps_vector_length));
+                    disp << margin << margin << UString::Dump(cps.data(), cps.size(), UString::SINGLE_LINE) << std::endl;
                 }
             }
         }
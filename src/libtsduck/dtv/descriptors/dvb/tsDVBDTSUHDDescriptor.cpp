@@ -89,7 +89,8 @@ void ts::DVBDTSUHDDescriptor::DisplayDescriptor(TablesDisplay& disp, const ts::D
         disp << ", max payload: " << DataName(MY_XML_NAME, u"MaxPayloadCode", buf.getBits<uint8_t>(3), NamesFlags::NAME_VALUE | NamesFlags::DECIMAL);
         buf.skipReservedBits(2, 0);
         disp << ", stream index: " << buf.getBits<uint16_t>(3) << std::endl;
-        disp << margin << "Codec Selector: " << UString::Dump(buf.getBytes(), UString::SINGLE_LINE) << std::endl;
+        const auto selector(buf.getBytesView());
+        disp << margin << "Codec Selector: " << UString::Dump(selector.data(), selector.size(), UString::SINGLE_LINE) << std::endl;
     }
 }
 
@@ -159,7 +159,8 @@ void ts::HEVCOperationPointDescriptor::DisplayDescriptor(TablesDisplay& disp, co
         uint8_t num_ptl;
         buf.getBits(num_ptl, 6);
         for (uint8_t i = 0; i < num_ptl; i++) {
-            disp << margin << "profile_tier_level_info[" << int(i) << "] " << UString::Dump(buf.getBytes(PROFILE_TIER_LEVEL_INFO_SIZE), UString::SINGLE_LINE) << std::endl;
+            const auto ptl(buf.getBytesView(PROFILE_TIER_LEVEL_INFO_SIZE));
+            disp << margin << "profile_tier_level_info[" << int(i) << "] " << UString::Dump(ptl.data(), ptl.size(), UString::SINGLE_LINE) << std::endl;
         }
         uint8_t operation_points_count = buf.getUInt8();
         for (uint8_t i = 0; i < operation_points_count; i++) {
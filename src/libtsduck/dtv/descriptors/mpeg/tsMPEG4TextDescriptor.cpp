@@ -194,7 +194,8 @@ void ts::MPEG4TextDescriptor::DisplayDescriptor(TablesDisplay& disp, const ts::D
                         disp << margin << line;
                     }
                     else {
-                        disp << margin << UString::Dump(buf.getBytes(textConfigLength), UString::SINGLE_LINE);
+                        const auto config(buf.getBytesView(textConfigLength));
+                        disp << margin << UString::Dump(config.data(), config.size(), UString::SINGLE_LINE);
                     }
                     disp << std::endl;
                 }
@@ -105,9 +105,10 @@ bool ts::EncodeMJD(const Time& time, uint8_t* mjd, MJDFormat mjd_fmt)
     // Now we can encode.
     PutUInt16(mjd, uint16_t(days));
     if (mjd_fmt == MJD_FULL) {
-        mjd[2] = EncodeBCD(int((secs / 3600) % 24)); // hours
-        mjd[3] = EncodeBCD(int((secs / 60) % 60));   // minutes
-        mjd[4] = EncodeBCD(int(secs % 60));          // seconds
+        const int secs_in_day = int(secs % (24 * 3600));
+        mjd[2] = EncodeBCD(secs_in_day / 3600);      // hours
+        mjd[3] = EncodeBCD((secs_in_day / 60) % 60); // minutes
+        mjd[4] = EncodeBCD(secs_in_day % 60);        // seconds
     }
     return true;
 }
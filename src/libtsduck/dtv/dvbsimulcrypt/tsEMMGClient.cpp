@@ -7,7 +7,6 @@
 //----------------------------------------------------------------------------
 
 #include "tsEMMGClient.h"
-#include "tsOneShotPacketizer.h"
 #include "tstlvSerializer.h"
 #include "tsTSPacket.h"
 #include "tsNullReport.h"
@@ -391,11 +390,15 @@ bool ts::EMMGClient::dataProvision(const std::vector<ByteBlockPtr>& data)
             return false;
         }
         // Manually serialize the data_provision message.
-        ByteBlockPtr bbp(new ByteBlock);
-        tlv::Serializer serial(bbp);
+        // The serialization buffer is reused from one message to the next.
+        if (_udp_buffer == nullptr) {
+            _udp_buffer = std::make_shared<ByteBlock>();
+        }
+        _udp_buffer->clear();
+        tlv::Serializer serial(_udp_buffer);
         request.serialize(serial);
         _logger.log(request, u"sending UDP message to " + _udp_address.toString());
-        return _udp_socket.send(bbp->data(), bbp->size(), _udp_address, _logger.report());
+        return _udp_socket.send(_udp_buffer->data(), _udp_buffer->size(), _udp_address, _logger.report());
     }
     else {
         // Send data_provision messages using TCP.
@@ -413,17 +416,17 @@ bool ts::EMMGClient::dataProvision(const SectionPtrVector& sections)
 {
     if (_channel_status.section_TSpkt_flag) {
         // Send data in TS packet format, packetize the sections.
-        ts::OneShotPacketizer zer(_duck);
-        zer.addSections(sections);
-
-        ts::TSPacketVector packets;
-        zer.getPackets(packets);
+        // The packetizer and the packet buffer are reused from one message to the next.
+        _packetizer.removeAll();
+        _packetizer.addSections(sections);
+        _packetizer.getPackets(_packets);
 
-        return dataProvision(packets.data(), packets.size() * PKT_SIZE);
+        return dataProvision(_packets.data(), _packets.size() * PKT_SIZE);
     }
     else {
         // Send data in section format.
         std::vector<ByteBlockPtr> chunks;
+        chunks.reserve(sections.size());
         for (size_t i = 0; i < sections.size(); ++i) {
             if (sections[i] != nullptr) {
                 chunks.push_back(std::make_shared<ByteBlock>(sections[i]->content(), sections[i]->size()));
@@ -20,6 +20,7 @@
 #include "tsUDPSocket.h"
 #include "tsTablesPtr.h"
 #include "tsThread.h"
+#include "tsOneShotPacketizer.h"
 
 namespace ts {
 
@@ -200,6 +201,12 @@ namespace ts {
         std::vector<uint16_t>        _error_status {};     // last error status
         std::vector<uint16_t>        _error_info {};       // last error information
 
+        // Preallocated buffers for dataProvision(). They are reused from one data_provision
+        // message to the next one to avoid reallocating buffers on each message.
+        OneShotPacketizer            _packetizer {_duck};  // packetize sections in TS packet format
+        TSPacketVector               _packets {};          // packetized sections
+        ByteBlockPtr                 _udp_buffer {};       // serialized data_provision message for UDP
+
         // Receiver thread main code
         virtual void main() override;
 
@@ -245,11 +245,14 @@ bool ts::PacketDecapsulation::processPacket(ts::TSPacket& pkt)
 
     if (_next_index == PKT_SIZE) {
         // Next packet is full, return it.
-        const TSPacket tmp(pkt);
+        // Save the unread tail of the input packet before overwriting it,
+        // instead of copying the full packet.
+        uint8_t tail[PKT_SIZE];
+        size = PKT_SIZE - pkt_index;
+        MemCopy(tail, pkt.b + pkt_index, size);
         pkt = _next_packet;
         // Copy start of next packet.
-        size = PKT_SIZE - pkt_index;
-        MemCopy(_next_packet.b + 1, tmp.b + pkt_index, size);
+        MemCopy(_next_packet.b + 1, tail, size);
         _next_index = 1 + size;
     }
     else {
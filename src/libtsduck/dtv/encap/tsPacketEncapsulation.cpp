@@ -246,7 +246,7 @@ bool ts::PacketEncapsulation::processPacket(TSPacket& pkt, TSPacketMetadata& mda
                     _late_index = 1;
                 }
                 // Enqueue the packet.
-                _late_packets.push_back(std::make_shared<TSPacket>(pkt));
+                _late_packets.push_back(pkt);
                 // If this is the first packet in the queue, point to the first byte after 0x47.
                 if (_late_packets.size() == 1) {
                     _late_index = 1;
@@ -260,7 +260,7 @@ bool ts::PacketEncapsulation::processPacket(TSPacket& pkt, TSPacketMetadata& mda
         }
         else {
             // Enqueue the packet.
-            _late_packets.push_back(std::make_shared<TSPacket>(pkt));
+            _late_packets.push_back(pkt);
             // If this is the first packet in the queue, point to the first byte after 0x47.
             if (_late_packets.size() == 1) {
                 _late_index = 1;
@@ -530,13 +530,12 @@ bool ts::PacketEncapsulation::processPacket(TSPacket& pkt, TSPacketMetadata& mda
 void ts::PacketEncapsulation::fillPacket(ts::TSPacket& pkt, size_t& pkt_index)
 {
     assert(!_late_packets.empty());
-    assert(_late_packets.front() != nullptr);
     assert(_late_index < PKT_SIZE);
     assert(pkt_index < PKT_SIZE);
 
     // Copy part of output payload from the first queued packet.
     const size_t size = std::min(PKT_SIZE - pkt_index, PKT_SIZE - _late_index);
-    MemCopy(pkt.b + pkt_index, _late_packets.front()->b + _late_index, size);
+    MemCopy(pkt.b + pkt_index, _late_packets.front().b + _late_index, size);
     pkt_index += size;
     _late_index += size;
 
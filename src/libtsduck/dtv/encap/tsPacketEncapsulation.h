@@ -322,7 +322,9 @@ namespace ts {
 
     private:
         using PIDCCMap = std::map<PID,uint8_t>;  // map of continuity counters, indexed by PID
-        using TSPacketPtrQueue = std::deque<TSPacketPtr>;
+        // Late packets are queued by value: the deque allocates them by chunks,
+        // avoiding one heap allocation per encapsulated packet.
+        using TSPacketQueue = std::deque<TSPacket>;
 
         [[maybe_unused]] Report& _report;
         bool             _packing = false;          // Packing mode.
@@ -348,7 +350,7 @@ namespace ts {
         size_t           _late_distance = 0;        // Distance from the last packet in output PID.
         size_t           _late_max_packets = DEFAULT_MAX_BUFFERED_PACKETS;  // Maximum number of packets in _latePackets.
         size_t           _late_index = 0;           // Next index to read in first late packet.
-        TSPacketPtrQueue _late_packets {};          // Packets to insert later.
+        TSPacketQueue    _late_packets {};          // Packets to insert later.
         size_t           _delayed_initial = 0;      // Number of initial delayed packets before computing PTS (synchronous PES mode).
 
         // Reset PCR information, lost synchronization.
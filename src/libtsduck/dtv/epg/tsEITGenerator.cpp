@@ -11,6 +11,7 @@
 #include "tsEIT.h"
 #include "tsMJD.h"
 #include "tsBCD.h"
+#include "tsSectionBufferPool.h"
 #include "tsFatal.h"
 
 
@@ -53,9 +54,11 @@ void ts::EITGenerator::reset(PID pid)
     _ts_bitrate = 0;
     _ref_time.clear();
     _ref_time_pkt = 0;
+    _last_update.clear();
     _eit_inter_pkt = 0;
     _last_eit_pkt = 0;
     _services.clear();
+    _regen_services.clear();
     for (size_t i = 0; i < _injects.size(); ++i) {
         _injects[i].clear();
     }
@@ -111,8 +114,9 @@ ts::EITGenerator::Event::Event(const uint8_t*& data, size_t& size, cn::seconds o
 
 ts::EITGenerator::ESection::ESection(EITGenerator* gen, const ServiceIdTriplet& srv, TID tid, uint8_t section_number, uint8_t last_section_number)
 {
-    // Build section data.
-    ByteBlockPtr section_data(new ByteBlock(LONG_SECTION_HEADER_SIZE + EIT::EIT_PAYLOAD_FIXED_SIZE + SECTION_CRC32_SIZE));
+    // Build section data. The buffer is recycled through the section buffer
+    // pool since EIT generation creates sections at a sustained rate.
+    ByteBlockPtr section_data(SectionBufferPool::Instance().get(LONG_SECTION_HEADER_SIZE + EIT::EIT_PAYLOAD_FIXED_SIZE + SECTION_CRC32_SIZE));
     CheckNonNull(section_data.get());
     uint8_t* data = section_data->data();
 
@@ -222,14 +226,17 @@ bool ts::EITGenerator::deleteEvent(const ServiceIdTriplet& service, uint16_t eve
 
     // Locate the service.
     const auto isrv = _services.find(service);
-    if (isrv != _services.end() && isrv->second.event_ids.contains(event_id)) {
-        // The event is known in the service.
+    if (isrv != _services.end()) {
         auto& srv(isrv->second);
 
-        // Look for the event in this service.
-        for (auto iseg = srv.segments.begin(); !success && iseg != srv.segments.end(); ++iseg) {
-            auto& events((*iseg)->events);
-            for (auto iev = events.begin(); !success && iev != events.end(); ++iev) {
+        // Directly locate the segment (time bucket) which contains the event.
+        const auto idx = srv.events_by_id.find(event_id);
+        if (idx != srv.events_by_id.end()) {
+            ESegment& seg(*idx->second);
+
+            // Look for the event in this segment.
+            auto& events(seg.events);
+            for (auto iev = events.begin(); iev != events.end(); ++iev) {
                 if ((*iev)->event_id == event_id) {
                     // Found the event with same id.
                     success = true;
@@ -237,10 +244,11 @@ bool ts::EITGenerator::deleteEvent(const ServiceIdTriplet& service, uint16_t eve
 
                     // Remove event from segment and service.
                     events.erase(iev);
-                    srv.event_ids.erase(event_id);
+                    srv.events_by_id.erase(idx);
 
                     // Mark all EIT schedule in this segment as to be regenerated.
-                    _regenerate = srv.regenerate = (*iseg)->regenerate = true;
+                    _regenerate = srv.regenerate = seg.regenerate = true;
+                    _regen_services.insert(service);
 
                     // Check if that event is in the EIT p/f for the sevice.
                     for (const auto& sec : srv.pf) {
@@ -254,6 +262,7 @@ bool ts::EITGenerator::deleteEvent(const ServiceIdTriplet& service, uint16_t eve
                             break;
                         }
                     }
+                    break;
                 }
             }
         }
@@ -328,28 +337,27 @@ bool ts::EITGenerator::loadEventsImpl(const ServiceIdTriplet& service_id, const
         }
 
         // Check if the same event id already existed in the service.
-        if (srv->event_ids.contains(ev->event_id)) {
-            // Look for existing event in this service with same id. Remove it if not an exact duplicate.
-            bool found = false;
+        const auto idx = srv->events_by_id.find(ev->event_id);
+        if (idx != srv->events_by_id.end()) {
+            // The segment (time bucket) which contains the previous version of the event.
+            ESegment& old_seg(*idx->second);
+            // Look for existing event in this segment with same id. Remove it if not an exact duplicate.
             bool duplicate = false;
-            for (auto iseg = srv->segments.begin(); !found && iseg != srv->segments.end(); ++iseg) {
-                auto& events((*iseg)->events);
-                for (auto iev = events.begin(); !found && iev != events.end(); ++iev) {
-                    if ((*iev)->event_id == ev->event_id) {
-                        // Found the event with same id.
-                        found = true;
-                        duplicate = (*iev)->event_data == ev->event_data;
-                        // Remove event if not a duplicate.
-                        if (!duplicate) {
-                            _duck.report().log(2, u"discard modified event id %n, %s, previously starting %s", (*iev)->event_id, service_id, (*iev)->start_time);
-                            // Remove event from segment and service.
-                            events.erase(iev);
-                            srv->event_ids.erase(ev->event_id);
-                            // Mark all EIT schedule in this segment as to be regenerated.
-                            _regenerate = srv->regenerate = (*iseg)->regenerate = true;
-                            break;
-                        }
+            for (auto iev = old_seg.events.begin(); iev != old_seg.events.end(); ++iev) {
+                if ((*iev)->event_id == ev->event_id) {
+                    // Found the event with same id.
+                    duplicate = (*iev)->event_data == ev->event_data;
+                    // Remove event if not a duplicate.
+                    if (!duplicate) {
+                        _duck.report().log(2, u"discard modified event id %n, %s, previously starting %s", (*iev)->event_id, service_id, (*iev)->start_time);
+                        // Remove event from segment and service.
+                        old_seg.events.erase(iev);
+                        srv->events_by_id.erase(idx);
+                        // Mark all EIT schedule in this segment as to be regenerated.
+                        _regenerate = srv->regenerate = old_seg.regenerate = true;
+                        _regen_services.insert(service_id);
                     }
+                    break;
                 }
             }
             // If the event is an exact duplicate, no need to do anything with that event.
@@ -382,11 +390,12 @@ bool ts::EITGenerator::loadEventsImpl(const ServiceIdTriplet& service_id, const
         }
         _duck.report().log(2, u"load event id %n, %s, starting %s", ev->event_id, service_id, ev->start_time);
         seg.events.insert(ev_iter, ev);
-        srv->event_ids.insert(ev->event_id);
+        srv->events_by_id[ev->event_id] = *seg_iter;
         ev_count++;
 
         // Mark all EIT schedule in this segment as to be regenerated.
         _regenerate = srv->regenerate = seg.regenerate = true;
+        _regen_services.insert(service_id);
     }
 
     // If some events were added, it may be necessary to regenerate the EIT p/f in this service.
@@ -588,6 +597,7 @@ void ts::EITGenerator::setTransportStreamId(uint16_t new_ts_id)
                 else if (need_eit) {
                     // The EIT schedule for that service were not there, we need them now, regenerate later.
                     _regenerate = srv.regenerate = true;
+                    _regen_services.insert(srv_iter.first);
                     for (const auto& seg_iter : srv.segments) {
                         seg_iter->regenerate = true;
                     }
@@ -681,6 +691,7 @@ void ts::EITGenerator::setOptions(EITOptions options)
                 else {
                     // The EIT schedule for that service were not there, we need them now, regenerate later.
                     _regenerate = srv.regenerate = true;
+                    _regen_services.insert(service_id);
                     for (const auto& seg_iter : srv.segments) {
                         seg_iter->regenerate = true;
                     }
@@ -954,12 +965,14 @@ void ts::EITGenerator::regenerateSchedule(const Time& now)
     // Check if all sections of a sub-table must have the same version number.
     const bool sync_versions = bool(_options & EITOptions::SYNC_VERSIONS);
 
-    // Loop on all services, regenerating those which are marked for regeneration.
-    for (auto& srv_iter : _services) {
-        if (srv_iter.second.regenerate) {
+    // Loop on the services which are marked for regeneration. Thanks to this index,
+    // services with unmodified events are not even inspected.
+    for (const auto& regen_srv : _regen_services) {
+        const auto srv_iter = _services.find(regen_srv);
+        if (srv_iter != _services.end() && srv_iter->second.regenerate) {
 
-            const ServiceIdTriplet& service_id(srv_iter.first);
-            EService& srv(srv_iter.second);
+            const ServiceIdTriplet& service_id(srv_iter->first);
+            EService& srv(srv_iter->second);
             const bool actual = service_id.transport_stream_id == _actual_ts_id;
             const auto GEN_SCHED = actual ? EITOptions::GEN_ACTUAL_SCHED : EITOptions::GEN_OTHER_SCHED;
             _duck.report().debug(u"regenerating events for service %n", service_id);
@@ -972,6 +985,10 @@ void ts::EITGenerator::regenerateSchedule(const Time& now)
 
             // Remove initial segments before last midnight.
             while (!srv.segments.empty() && srv.segments.front()->start_time < last_midnight) {
+                // Remove all event ids of this segment from the service.
+                for (const auto& ev : srv.segments.front()->events) {
+                    srv.events_by_id.erase(ev->event_id);
+                }
                 markObsoleteSegment(*srv.segments.front());
                 srv.segments.pop_front();
             }
@@ -980,7 +997,7 @@ void ts::EITGenerator::regenerateSchedule(const Time& now)
             while (!srv.segments.empty() && srv.segments.back()->events.empty() && srv.segments.back()->start_time > last_midnight) {
                 // Remove all event ids of this segment from the service.
                 for (const auto& ev : srv.segments.back()->events) {
-                    srv.event_ids.erase(ev->event_id);
+                    srv.events_by_id.erase(ev->event_id);
                 }
                 // Remove segment from service
                 markObsoleteSegment(*srv.segments.back());
@@ -1208,7 +1225,8 @@ void ts::EITGenerator::regenerateSchedule(const Time& now)
         }
     }
 
-    // Clear global regeneration flag.
+    // Clear the index of services to regenerate and the global regeneration flag.
+    _regen_services.clear();
     _regenerate = false;
 }
 
@@ -1224,6 +1242,14 @@ void ts::EITGenerator::updateForNewTime(const Time& now)
         return;
     }
 
+    // This method is called very frequently, typically each time a section may be injected.
+    // Since events and the reference time from TDT/TOT have a one-second resolution, there
+    // is no need to inspect all services more than once per second of stream time.
+    if (now >= _last_update && now < _last_update + cn::seconds(1)) {
+        return;
+    }
+    _last_update = now;
+
     // Reference time for EIT schedule.
     const Time last_midnight(now.thisDay());
 
@@ -1237,6 +1263,7 @@ void ts::EITGenerator::updateForNewTime(const Time& now)
         // If we changed day, mark the service as being regenerated (will remove obsolete segments or create missing ones).
         if (last_midnight != srv.segments.front()->start_time) {
             _regenerate = srv.regenerate = true;
+            _regen_services.insert(service_id);
         }
 
         // Segments between last midnight and current time shall be regenerated as well.
@@ -1245,12 +1272,13 @@ void ts::EITGenerator::updateForNewTime(const Time& now)
             ESegment& seg(**seg_iter);
             while (!seg.events.empty() && seg.events.front()->end_time <= now) {
                 // Remove event id from service.
-                srv.event_ids.erase(seg.events.front()->event_id);
+                srv.events_by_id.erase(seg.events.front()->event_id);
                 // Remove event from segment.
                 seg.events.pop_front();
                 // Regenerate the segment, unless this is the current segment and we use the lazy update mode.
                 if (seg.start_time < now || !(_options & EITOptions::LAZY_SCHED_UPDATE)) {
                     _regenerate = srv.regenerate = seg.regenerate = true;
+                    _regen_services.insert(service_id);
                 }
             }
         }
@@ -1259,7 +1287,7 @@ void ts::EITGenerator::updateForNewTime(const Time& now)
         while (!srv.segments.empty() && srv.segments.back()->start_time >= last_midnight + EIT::TOTAL_DAYS) {
             // Remove all event ids of this segment from the service.
             for (const auto& ev : srv.segments.back()->events) {
-                srv.event_ids.erase(ev->event_id);
+                srv.events_by_id.erase(ev->event_id);
             }
             // Remove segment from service
             srv.segments.pop_back();
@@ -143,9 +143,11 @@ namespace ts {
     //!   again and again (input EIT sections). We use the following method:
     //!   - Existing events with same content are silently ignored.
     //!   - When a new event is loaded, the "regenerate" flag is set 1) globally, 2) on the service
-    //!     and 3) on the 3-hour segment.
+    //!     and 3) on the 3-hour segment. The service is also registered in a set of services to
+    //!     regenerate.
     //!   - When an EIT section needs to be injected, we check the global "regenerate" flag. When
-    //!     set, all services and segments are inspected and regenerated when necessary. All "regenerate"
+    //!     set, only the registered services and their flagged segments are inspected and regenerated
+    //!     when necessary. Services with unmodified events are not even inspected. All "regenerate"
     //!     flags are then cleared.
     //!
     //! @see ETSI EN 300 468, 5.2.4
@@ -471,6 +473,7 @@ namespace ts {
 
         using ESegmentPtr = std::shared_ptr<ESegment>;
         using ESegmentList = std::list<ESegmentPtr>;
+        using ESegmentByEventId = std::map<uint16_t, ESegmentPtr>;  // index of segments by event id
 
         // ------------------------
         // Description of a service
@@ -480,10 +483,10 @@ namespace ts {
         {
             TS_NOCOPY(EService);
         public:
-            bool               regenerate = false;  // Some segments must be regenerated in the service.
-            ESectionPair       pf {};               // EIT p/f sections (0: present, 1: following).
-            ESegmentList       segments {};         // List of 3-hour segments (EPG events and EIT schedule sections).
-            std::set<uint16_t> event_ids {};        // Existing event ids in that service, used as fast lookup of event presence.
+            bool              regenerate = false;  // Some segments must be regenerated in the service.
+            ESectionPair      pf {};               // EIT p/f sections (0: present, 1: following).
+            ESegmentList      segments {};         // List of 3-hour segments (EPG events and EIT schedule sections).
+            ESegmentByEventId events_by_id {};     // Segment (time bucket) containing each existing event in that service, indexed by event id.
 
             // Constructor.
             EService() = default;
@@ -522,6 +525,7 @@ namespace ts {
         BitRate              _ts_bitrate = 0;            // Declared TS bitrate.
         Time                 _ref_time {};               // Last reference time.
         PacketCounter        _ref_time_pkt = 0;          // Packet index at last reference time.
+        Time                 _last_update {};            // Last time the event database was inspected in updateForNewTime().
         PacketCounter        _eit_inter_pkt = 0;         // Inter-packet distance in the EIT PID (zero if unbound).
         PacketCounter        _last_eit_pkt = 0;          // Packet index at last EIT insertion.
         EITOptions           _options = EITOptions::GEN_ALL; // EIT generation options flags.
@@ -531,6 +535,7 @@ namespace ts {
         SectionDemux         _demux;                     // Section demux for input stream, get PAT, TDT, TOT, EIT.
         Packetizer           _packetizer;                // Packetizer for generated EIT's.
         EServiceMap          _services {};               // Map of services -> segments -> events and sections.
+        std::set<ServiceIdTriplet> _regen_services {};   // Services with the "regenerate" flag set (subset of _services).
         ESectionListArray    _injects {};                // Arrays of sections for injection.
         cn::milliseconds     _section_gap = cn::milliseconds(30);  // Minimum gap between sections of the same tid/tidext, DVB specifies at least 25 ms.
         TID                  _last_tid = TID_NULL;       // TID of last injected section, or 0.
@@ -33,6 +33,7 @@ void ts::EITProcessor::reset()
 {
     _start_time_offset = cn::milliseconds::zero();
     _date_only = false;
+    _repacketize = false;
     _demux.reset();
     _packetizer.reset();
     _sections.clear();
@@ -71,6 +72,7 @@ void ts::EITProcessor::setOutputPID(ts::PID pid)
         _packetizer.reset();
         _packetizer.setPID(pid);
         _output_pid = pid;
+        updateSinglePID();
     }
 }
 
@@ -79,6 +81,7 @@ void ts::EITProcessor::clearInputPIDs()
 {
     _demux.reset();
     _input_pids.reset();
+    updateSinglePID();
 }
 
 // Add an input PID without altering the output PID.
@@ -86,6 +89,13 @@ void ts::EITProcessor::addInputPID(ts::PID pid)
 {
     _demux.addPID(pid);
     _input_pids.set(pid);
+    updateSinglePID();
+}
+
+// Recompute _single_pid after changing the input or output PID's.
+void ts::EITProcessor::updateSinglePID()
+{
+    _single_pid = _input_pids.count() == 1 && _input_pids.test(_output_pid);
 }
 
 
@@ -106,6 +116,17 @@ void ts::EITProcessor::setMaxBufferedSections(size_t count)
 void ts::EITProcessor::processPacket(TSPacket& pkt)
 {
     if (_input_pids.test(pkt.getPID())) {
+        // Fast path: when no transformation is defined, let the packets pass through,
+        // without engaging the demux / packetizer machinery. This is possible only when
+        // there is no PID remapping and no packet was already replaced (the continuity
+        // counters of replaced packets diverge from the input ones).
+        if (_single_pid && !_repacketize &&
+            _start_time_offset == cn::milliseconds::zero() &&
+            _removed_tids.empty() && _removed.empty() && _kept.empty() && _renamed.empty())
+        {
+            return;
+        }
+        _repacketize = true;
         _demux.feedPacket(pkt);
         _packetizer.getNextPacket(pkt);
     }
@@ -333,12 +354,22 @@ void ts::EITProcessor::handleSection(SectionDemux& demux, const Section& section
     }
 
     // At this point, we need to keep the section.
-    // Build a copy of it for insertion in the queue.
-    const SectionPtr sp(new Section(section, ShareMode::COPY));
+    // Check if the section content may be modified. Most sections pass through
+    // unmodified, their content is shared instead of copied.
+    bool may_modify = false;
+    if (is_eit) {
+        may_modify = _start_time_offset != cn::milliseconds::zero();
+        for (auto it = _renamed.begin(); !may_modify && it != _renamed.end(); ++it) {
+            may_modify = Match(it->first, srv_id, ts_id, net_id);
+        }
+    }
+
+    // Build a copy of the section for insertion in the queue (a reference when unmodified).
+    const SectionPtr sp(new Section(section, may_modify ? ShareMode::COPY : ShareMode::SHARE));
     CheckNonNull(sp.get());
 
     // Update the section if this is an EIT.
-    if (is_eit) {
+    if (may_modify) {
         // Recompute CRC at end only.
         bool modified = false;
 
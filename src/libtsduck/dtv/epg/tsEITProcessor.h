@@ -35,6 +35,10 @@ namespace ts {
     //! By default, there is only one input PID which is also used as
     //! output PID. This is PID 0x12, the standard DVB PID for EIT's.
     //!
+    //! As long as no transformation is defined and there is one single
+    //! input PID which is also the output PID, the packets pass through
+    //! unmodified and the demux / packetizer machinery is not engaged.
+    //!
     class TSDUCKDLL EITProcessor :
         private SectionHandlerInterface,
         private SectionProviderInterface
@@ -242,6 +246,8 @@ namespace ts {
         DuckContext&          _duck;
         PIDSet                _input_pids {};
         PID                   _output_pid = PID_NULL;
+        bool                  _single_pid = true;   // There is one single input PID which is also the output PID.
+        bool                  _repacketize = false; // At least one packet was already replaced, cannot revert to pass-through.
         cn::milliseconds      _start_time_offset {};
         bool                  _date_only = false;
         size_t                _max_buffered_sections {DEFAULT_BUFFERED_SECTIONS};
@@ -257,6 +263,9 @@ namespace ts {
         // The service must have at least a service id or transport id.
         static bool Match(const Service& srv, uint16_t srv_id, uint16_t ts_id, uint16_t net_id);
 
+        // Recompute _single_pid after changing the input or output PID's.
+        void updateSinglePID();
+
         // Implementation of SectionHandlerInterface.
         virtual void handleSection(SectionDemux& demux, const Section& section) override;
 
@@ -104,16 +104,17 @@ void ts::MPEDemux::handleSection(SectionDemux& demux, const Section& section)
     // So, we need to carefully filter the sections. This must be a
     // DSM-CC Private Data section and it must come from a PID we filter.
 
-    if (section.tableId() == TID_DSMCC_PD && _pid_filter.test(section.sourcePID())) {
+    if (_handler != nullptr && section.tableId() == TID_DSMCC_PD && _pid_filter.test(section.sourcePID())) {
 
-        // Build the corresponding MPE packet.
-        MPEPacket mpe(section);
-        if (mpe.isValid() && _handler != nullptr) {
+        // Build the corresponding MPE packet. Reuse the same packet object
+        // for all sections, so that the datagram buffer is reused as well.
+        _mpe.copy(section);
+        if (_mpe.isValid()) {
 
             // Send the MPE packet to the application.
             beforeCallingHandler(section.sourcePID());
             try {
-                _handler->handleMPEPacket(*this, mpe);
+                _handler->handleMPEPacket(*this, _mpe);
             }
             catch (...) {
                 afterCallingHandler(false);
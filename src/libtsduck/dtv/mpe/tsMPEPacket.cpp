@@ -188,8 +188,14 @@ ts::MPEPacket& ts::MPEPacket::copy(const MPEPacket& other)
 
 ts::MPEPacket& ts::MPEPacket::copy(const Section& section)
 {
-    // Clear previous content.
-    clear();
+    // Clear previous content but keep the datagram buffer when we are its
+    // only owner, so that repetitive copies reuse the same allocation.
+    _is_valid = false;
+    _source_pid = PID_NULL;
+    _dest_mac.clear();
+    if (_datagram != nullptr && _datagram.use_count() > 1) {
+        _datagram.reset();
+    }
 
     // Locate the section content, including header.
     const uint8_t* data = section.content();
@@ -214,7 +220,12 @@ ts::MPEPacket& ts::MPEPacket::copy(const Section& section)
 
     // Get the datagram from the rest of the section.
     // Do not include trailing 4 bytes (checksum or CRC32).
-    _datagram = std::make_shared<ByteBlock>(data + 12, size - 16);
+    if (_datagram != nullptr) {
+        _datagram->copy(data + 12, size - 16);
+    }
+    else {
+        _datagram = std::make_shared<ByteBlock>(data + 12, size - 16);
+    }
 
     // Check that the datagram contains a UDP/IP packet.
     _is_valid = true;
@@ -241,9 +252,11 @@ void ts::MPEPacket::createSection(Section& section) const
 
     // Create a buffer for the section content.
     // The allocated area will be directly used by the section object.
-    // The initial size is the fixed part of the section, before the datagram.
-    ByteBlockPtr bbp(new ByteBlock(12));
+    // Reserve the final size in one shot: 12-byte fixed part, datagram, 4-byte CRC32.
+    ByteBlockPtr bbp(new ByteBlock());
     ByteBlock& data(*bbp);
+    data.reserve(12 + _datagram->size() + 4);
+    data.resize(12);
 
     // Section is a DSM-CC Private Data.
     data[0] = TID_DSMCC_PD;
@@ -210,6 +210,15 @@ void ts::PESDemux::processPacket(const TSPacket& pkt)
             pc.continuity = pkt.getCC();
             pc.sync = true;
             pc.ts->copy(pl, pl_size);
+            // If the PES packet is bounded (non-zero PES packet length), its exact
+            // final size is known upfront. Reserve it at once so that the assembly
+            // buffer never reallocates and recopies the data during the growth.
+            if (pl_size >= 6) {
+                const size_t len = GetUInt16(pc.ts->data() + 4);
+                if (len != 0) {
+                    pc.ts->reserve(6 + len);
+                }
+            }
             pc.first_pkt = _packet_count;
             pc.last_pkt = _packet_count;
             pc.pcr = pkt.getPCR(); // can be invalid
@@ -249,10 +258,18 @@ void ts::PESDemux::processPacket(const TSPacket& pkt)
     if (pc.ts->size() + pl_size > capacity) {
         // Internal reallocation needed in ts buffer.
         // Do not allow implicit reallocation, do it manually for better performance.
+        // If the PES packet is bounded (non-zero PES packet length), its exact final
+        // size is known, reserve it at once. This path is only taken when the first
+        // TS packet of the PES packet had a short payload (less than 6 bytes).
+        const size_t len = pc.ts->size() >= 6 ? GetUInt16(pc.ts->data() + 4) : 0;
+        if (len != 0) {
+            pc.ts->reserve(6 + len);
+        }
+        // For unbounded PES packets, the final size is unknown until the next PUSI.
         // Use two predefined thresholds: 64 kB and 512 kB. Above that, double the size.
         // Note that 64 kB is OK for audio PIDs. Video PIDs are usually unbounded. The
         // maximum observed PES rate is 2 PES/s, meaning 512 kB / PES at 8 Mb/s.
-        if (capacity < 64 * 1024) {
+        else if (capacity < 64 * 1024) {
             pc.ts->reserve(64 * 1024);
         }
         else if (capacity < 512 * 1024) {
@@ -30,10 +30,11 @@ ts::Descriptor::Descriptor(DID tag, const void* data, size_t size)
 ts::Descriptor::Descriptor(DID tag, const ByteBlock& data)
 {
     if (data.size() < 256) {
-        ByteBlockPtr ptr(std::make_shared<ByteBlock>(2));
+        // Allocate the final size in one shot, avoid a reallocation on append.
+        ByteBlockPtr ptr(std::make_shared<ByteBlock>(data.size() + 2));
         (*ptr)[0] = tag;
         (*ptr)[1] = uint8_t(data.size());
-        ptr->append(data);
+        MemCopy(ptr->data() + 2, data.data(), data.size());
         SuperClass::reload(ptr); // reuse the pointer
     }
 }
@@ -215,10 +216,10 @@ bool ts::Descriptor::fromXML(DuckContext& duck, EDID& edid, const xml::Element*
         ByteBlock payload;
         if (node->getIntAttribute<DID>(tag, u"tag", true, 0xFF, 0x00, 0xFF) && node->getHexaText(payload, 0, 255)) {
             // Build descriptor.
-            ByteBlockPtr ptr(std::make_shared<ByteBlock>(2));
+            ByteBlockPtr ptr(std::make_shared<ByteBlock>(payload.size() + 2));
             (*ptr)[0] = tag;
             (*ptr)[1] = uint8_t(payload.size());
-            ptr->append(payload);
+            MemCopy(ptr->data() + 2, payload.data(), payload.size());
             reload(ptr);
             return isValid();
         }
@@ -127,6 +127,19 @@ bool ts::DescriptorList::add(const void* data, size_t size)
     size_t length = 0;
     bool success = true;
 
+    // Pre-scan the memory area to count descriptors and grow the vector in
+    // one chunk. Tables typically contain many small descriptors and repeated
+    // reallocations of the vector would dominate the parsing cost.
+    size_t dcount = 0;
+    const uint8_t* scan = desc;
+    size_t remain = size;
+    while (remain >= 2 && (length = size_t(scan[1]) + 2) <= remain) {
+        dcount++;
+        scan += length;
+        remain -= length;
+    }
+    _list.reserve(_list.size() + dcount);
+
     while (size >= 2 && (length = size_t(desc[1]) + 2) <= size) {
         success = add(std::make_shared<Descriptor>(desc, length)) && success;
         desc += length;
@@ -129,10 +129,37 @@ void ts::PSIMerger::reset(Options options)
     _merge_nit.invalidate();
     _main_bats.clear();
     _merge_bats.clear();
+    _pat_bin.clear();
+    _cat_bin.clear();
+    _sdt_bin.clear();
+    _nit_bin.clear();
+    _bat_bins.clear();
     _eits.clear();
 }
 
 
+//----------------------------------------------------------------------------
+// Serialize a merged table and detect actual changes.
+//----------------------------------------------------------------------------
+
+bool ts::PSIMerger::updateMergedTable(AbstractLongTable& table, BinaryTable& cache)
+{
+    // At this point, the table has the same version as the last merged one. If the
+    // serialized forms are identical, nothing changed in the merged content (e.g. an
+    // input version was bumped without modification) and the packetizer keeps cycling
+    // the cached sections.
+    BinaryTable bin;
+    if (!table.serialize(_duck, bin) || bin == cache) {
+        return false;
+    }
+
+    // The merged content changed, give the table a new version and cache its sections.
+    table.incrementVersion();
+    table.serialize(_duck, cache);
+    return true;
+}
+
+
 //----------------------------------------------------------------------------
 // Get main and merged complete TS id. Return false if not yet known.
 //----------------------------------------------------------------------------
@@ -550,9 +577,8 @@ void ts::PSIMerger::mergePAT()
 
     _duck.report().debug(u"merging PAT");
 
-    // Build a new PAT based on last main PAT with incremented version number.
+    // Build a new PAT based on last main PAT, with the same version as the last merged PAT.
     PAT pat(_main_pat);
-    pat.incrementVersion();
 
     // Add all services from merged stream into main PAT.
     for (const auto& merge : _merge_pat.pmts) {
@@ -566,11 +592,16 @@ void ts::PSIMerger::mergePAT()
         }
     }
 
+    // Detect actual changes, keep the current output when the content is unchanged.
+    if (!updateMergedTable(pat, _pat_bin)) {
+        return;
+    }
+
     // Replace the PAT in the packetizer.
     _pat_pzer.removeSections(TID_PAT);
-    _pat_pzer.addTable(_duck, pat);
+    _pat_pzer.addTable(_pat_bin);
 
-    // Save PAT version number for later increment.
+    // Save PAT version number, it is the reference version for the next merge.
     _main_pat.setVersion(pat.version());
 }
 
@@ -588,9 +619,8 @@ void ts::PSIMerger::mergeCAT()
 
     _duck.report().debug(u"merging CAT");
 
-    // Build a new CAT based on last main CAT with incremented version number.
+    // Build a new CAT based on last main CAT, with the same version as the last merged CAT.
     CAT cat(_main_cat);
-    cat.incrementVersion();
 
     // Add all CA descriptors from merged stream into main CAT.
     for (size_t index = _merge_cat.descs.search(DID_MPEG_CA); index < _merge_cat.descs.count(); index = _merge_cat.descs.search(DID_MPEG_CA, index + 1)) {
@@ -605,11 +635,16 @@ void ts::PSIMerger::mergeCAT()
         }
     }
 
+    // Detect actual changes, keep the current output when the content is unchanged.
+    if (!updateMergedTable(cat, _cat_bin)) {
+        return;
+    }
+
     // Replace the CAT in the packetizer.
     _cat_pzer.removeSections(TID_CAT);
-    _cat_pzer.addTable(_duck, cat);
+    _cat_pzer.addTable(_cat_bin);
 
-    // Save CAT version number for later increment.
+    // Save CAT version number, it is the reference version for the next merge.
     _main_cat.setVersion(cat.version());
 }
 
@@ -627,9 +662,8 @@ void ts::PSIMerger::mergeSDT()
 
     _duck.report().debug(u"merging SDT");
 
-    // Build a new SDT based on last main SDT with incremented version number.
+    // Build a new SDT based on last main SDT, with the same version as the last merged SDT.
     SDT sdt(_main_sdt);
-    sdt.incrementVersion();
 
     // Add all services from merged stream into main SDT.
     for (const auto& merge : _merge_sdt.services) {
@@ -643,11 +677,16 @@ void ts::PSIMerger::mergeSDT()
         }
     }
 
+    // Detect actual changes, keep the current output when the content is unchanged.
+    if (!updateMergedTable(sdt, _sdt_bin)) {
+        return;
+    }
+
     // Replace the SDT in the packetizer.
     _sdt_bat_pzer.removeSections(TID_SDT_ACT, sdt.ts_id);
-    _sdt_bat_pzer.addTable(_duck, sdt);
+    _sdt_bat_pzer.addTable(_sdt_bin);
 
-    // Save SDT version number for later increment.
+    // Save SDT version number, it is the reference version for the next merge.
     _main_sdt.setVersion(sdt.version());
 }
 
@@ -668,9 +707,8 @@ void ts::PSIMerger::mergeNIT()
 
     _duck.report().debug(u"merging NIT");
 
-    // Build a new NIT based on last main NIT with incremented version number.
+    // Build a new NIT based on last main NIT, with the same version as the last merged NIT.
     NIT nit(_main_nit);
-    nit.incrementVersion();
 
     // If the two TS are from the same network and have distinct TS ids, remove the
     // description of the merged TS since it is now merged.
@@ -690,11 +728,16 @@ void ts::PSIMerger::mergeNIT()
         nit.transports[main_tsid].descs.add(merge_ts->second.descs);
     }
 
+    // Detect actual changes, keep the current output when the content is unchanged.
+    if (!updateMergedTable(nit, _nit_bin)) {
+        return;
+    }
+
     // Replace the NIT in the packetizer.
     _nit_pzer.removeSections(TID_NIT_ACT, nit.network_id);
-    _nit_pzer.addTable(_duck, nit);
+    _nit_pzer.addTable(_nit_bin);
 
-    // Save NIT version number for later increment.
+    // Save NIT version number, it is the reference version for the next merge.
     _main_nit.setVersion(nit.version());
 }
 
@@ -719,9 +762,8 @@ void ts::PSIMerger::mergeBAT(uint16_t bouquet_id)
 
     _duck.report().debug(u"merging BAT for bouquet id %n", bouquet_id);
 
-    // Build a new BAT based on last main BAT with incremented version number.
+    // Build a new BAT based on last main BAT, with the same version as the last merged BAT.
     BAT bat(main->second);
-    bat.incrementVersion();
 
     // If the two TS have distinct TS ids, remove the description of the merged TS since it is now merged.
     if (main_tsid != merge_tsid) {
@@ -740,10 +782,15 @@ void ts::PSIMerger::mergeBAT(uint16_t bouquet_id)
         bat.transports[main_tsid].descs.add(merge_ts->second.descs);
     }
 
+    // Detect actual changes, keep the current output when the content is unchanged.
+    if (!updateMergedTable(bat, _bat_bins[bouquet_id])) {
+        return;
+    }
+
     // Replace the BAT in the packetizer.
     _sdt_bat_pzer.removeSections(TID_BAT, bouquet_id);
-    _sdt_bat_pzer.addTable(_duck, bat);
+    _sdt_bat_pzer.addTable(_bat_bins[bouquet_id]);
 
-    // Save NIT version number for later increment.
+    // Save BAT version number, it is the reference version for the next merge.
     main->second.setVersion(bat.version());
 }
@@ -131,6 +131,11 @@ namespace ts {
         NIT                     _merge_nit {};     // Last input NIT Actual from merged TS.
         std::map<uint16_t, BAT> _main_bats {};     // Map of last input BAT/bouquet_it from main TS (version# is current output version).
         std::map<uint16_t, BAT> _merge_bats {};    // Map of last input BAT/bouquet_it from merged TS.
+        BinaryTable             _pat_bin {};       // Last merged PAT, as serialized in the packetizer.
+        BinaryTable             _cat_bin {};       // Last merged CAT, as serialized in the packetizer.
+        BinaryTable             _sdt_bin {};       // Last merged SDT Actual, as serialized in the packetizer.
+        BinaryTable             _nit_bin {};       // Last merged NIT Actual, as serialized in the packetizer.
+        std::map<uint16_t, BinaryTable> _bat_bins {};  // Last merged BAT per bouquet id, as serialized in the packetizer.
         std::list<SectionPtr>   _eits {};          // List of EIT sections to insert.
         size_t                  _max_eits = 128;   // Maximum number of buffered EIT sections (hard-coded for now).
 
@@ -166,6 +171,11 @@ namespace ts {
         void mergeNIT();
         void mergeBAT(uint16_t bouquet_id);
 
+        // Serialize a merged table and detect actual changes, using a cache of the last
+        // serialized form. Return true if the table content changed, with an incremented
+        // version and an updated cache. Return false when the output must be left untouched.
+        bool updateMergedTable(AbstractLongTable& table, BinaryTable& cache);
+
         // Copy a table into another, preserving the previous version number if the table is valid.
         template<class TABLE>
             requires std::derived_from<TABLE, AbstractLongTable>
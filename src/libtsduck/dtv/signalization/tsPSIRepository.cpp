@@ -64,9 +64,7 @@ bool ts::PSIRepository::handleNameValue(const Names& section, Names::uint_t valu
 
         // Update existing entries.
         bool existed = false;
-        const auto bounds(_tables_by_tid.equal_range(tid));
-        for (auto it = bounds.first; it != bounds.second; ++it) {
-            const auto& tc(it->second);
+        for (const auto& tc : _tables_by_tid[tid]) {
             if ((std == tc->standards || bool(std & tc->standards)) && min_cas >= tc->min_cas && max_cas <= tc->max_cas) {
                 // Found a compatible entry.
                 existed = true;
@@ -81,7 +79,7 @@ bool ts::PSIRepository::handleNameValue(const Names& section, Names::uint_t valu
             tc->min_cas = min_cas;
             tc->max_cas = max_cas;
             tc->display_name = name;
-            _tables_by_tid.insert(std::make_pair(tid, tc));
+            _tables_by_tid[tid].push_back(tc);
         }
     }
     else if (section.sectionName().similar(u"DescriptorId")) {
@@ -90,12 +88,12 @@ bool ts::PSIRepository::handleNameValue(const Names& section, Names::uint_t valu
 
         // Update existing entries.
         bool existed = false;
-        const auto bounds(_descriptors_by_xdid.equal_range(edid.xdid()));
+        const auto bounds(descriptorRange(edid.xdid()));
         for (auto it = bounds.first; it != bounds.second; ++it) {
-            if (it->second->edid == edid) {
+            if ((*it)->edid == edid) {
                 // Found a compatible entry.
                 existed = true;
-                it->second->display_name = name;
+                (*it)->display_name = name;
             }
         }
 
@@ -104,7 +102,7 @@ bool ts::PSIRepository::handleNameValue(const Names& section, Names::uint_t valu
             DescriptorClassPtr dc = std::make_shared<DescriptorClass>();
             dc->edid = edid;
             dc->display_name = name;
-            _descriptors_by_xdid.insert(std::make_pair(edid.xdid(), dc));
+            addDescriptorClass(dc);
         }
     }
 
@@ -137,19 +135,18 @@ ts::PSIRepository::RegisterTable::RegisterTable(TableFactory factory,
         TableClassPtr tc;
 
         // Search an existing entry.
-        const auto bounds(repo._tables_by_tid.equal_range(tid));
-        for (auto it = bounds.first; tc == nullptr && it != bounds.second; ++it) {
-            const auto& tc1(it->second);
+        for (const auto& tc1 : repo._tables_by_tid[tid]) {
             if ((standards == tc1->standards || bool(standards & tc1->standards)) && min_cas >= tc1->min_cas && max_cas <= tc1->max_cas) {
                 // Found a compatible entry.
                 tc = tc1;
+                break;
             }
         }
 
         // Build a new entry if none found.
         if (tc == nullptr) {
             tc = std::make_shared<TableClass>();
-            repo._tables_by_tid.insert(std::make_pair(tid, tc));
+            repo._tables_by_tid[tid].push_back(tc);
         }
 
         // Fill the entry with new data.
@@ -200,18 +197,19 @@ ts::PSIRepository::RegisterDescriptor::RegisterDescriptor(DescriptorFactory fact
     DescriptorClassPtr dc;
 
     // Search an existing entry.
-    const auto bounds(repo._descriptors_by_xdid.equal_range(edid.xdid()));
+    const auto bounds(repo.descriptorRange(edid.xdid()));
     for (auto it = bounds.first; it != bounds.second; ++it) {
-        if (it->second->edid == edid) {
+        if ((*it)->edid == edid) {
             // Found a compatible entry.
-            dc = it->second;
+            dc = *it;
         }
     }
 
     // Build a new entry if none found.
     if (dc == nullptr) {
         dc = std::make_shared<DescriptorClass>();
-        repo._descriptors_by_xdid.insert(std::make_pair(edid.xdid(), dc));
+        dc->edid = edid;
+        repo.addDescriptorClass(dc);
     }
 
     // Build a description for this descriptor.
@@ -254,6 +252,32 @@ ts::PSIRepository::RegisterDescriptor::RegisterDescriptor(DisplayCADescriptorFun
 }
 
 
+//----------------------------------------------------------------------------
+// Management of the descriptor classes in the flat array of DID buckets.
+//----------------------------------------------------------------------------
+
+void ts::PSIRepository::addDescriptorClass(const DescriptorClassPtr& dc)
+{
+    // Keep the bucket sorted by XDID. Inserting at the upper bound preserves
+    // the registration order of the classes sharing the same XDID.
+    DescriptorClassVector& bucket(_descriptors_by_did[dc->edid.xdid().did()]);
+    const auto it = std::upper_bound(bucket.begin(), bucket.end(), dc->edid.xdid(),
+                                     [](XDID x, const DescriptorClassPtr& e) { return x < e->edid.xdid(); });
+    bucket.insert(it, dc);
+}
+
+ts::PSIRepository::DescriptorClassRange ts::PSIRepository::descriptorRange(XDID xdid) const
+{
+    // Two-way comparator for the binary search inside a sorted bucket.
+    struct Comp {
+        bool operator()(const DescriptorClassPtr& e, XDID x) const { return e->edid.xdid() < x; }
+        bool operator()(XDID x, const DescriptorClassPtr& e) const { return x < e->edid.xdid(); }
+    };
+    const DescriptorClassVector& bucket(_descriptors_by_did[xdid.did()]);
+    return std::equal_range(bucket.begin(), bucket.end(), xdid, Comp());
+}
+
+
 //----------------------------------------------------------------------------
 // Signalization classes.
 //----------------------------------------------------------------------------
@@ -311,12 +335,8 @@ const ts::PSIRepository::TableClass& ts::PSIRepository::getTable(TID tid, const
     const CASID cas = context.getCAS();
     const Standards standards = context.getStandards();
 
-    // Range of iterators for all table classes matching the table id.
-    const auto bounds(_tables_by_tid.equal_range(tid));
-
-    // Look for an exact match.
-    for (auto it = bounds.first; it != bounds.second; ++it) {
-        const auto& tc(it->second);
+    // Look for an exact match in all table classes matching the table id.
+    for (const auto& tc : _tables_by_tid[tid]) {
 
         // Standard match: at least one standard of the table is current, or standard-agnostic table (Standards::NONE).
         const bool std_match = bool(standards & tc->standards) || tc->standards == Standards::NONE;
@@ -364,7 +384,7 @@ const ts::PSIRepository::DescriptorClass& ts::PSIRepository::getDescriptor(EDID
     static const DescriptorClass null_descriptor_class;
 
     // Get the range of XDID entries for this family of descriptors.
-    const auto bounds(_descriptors_by_xdid.equal_range(edid.xdid()));
+    const auto bounds(descriptorRange(edid.xdid()));
 
     // If the bounds are equal, no element matches, unknown descritor.
     if (bounds.first == bounds.second) {
@@ -374,13 +394,13 @@ const ts::PSIRepository::DescriptorClass& ts::PSIRepository::getDescriptor(EDID
     // If there is only one descriptor, use it without further analysis.
     auto next = bounds.first;
     if (++next == bounds.second) {
-        return *bounds.first->second;
+        return **bounds.first;
     }
 
     // If there are several descriptors, search for an exact EDID match.
     for (next = bounds.first; next != bounds.second; ++next) {
-        if (next->second->edid == edid) {
-            return *next->second;
+        if ((*next)->edid == edid) {
+            return **next;
         }
     }
 
@@ -399,7 +419,7 @@ const ts::PSIRepository::DescriptorClass& ts::PSIRepository::getDescriptor(XDID
     static const DescriptorClass null_descriptor_class;
 
     // Get the range of XDID entries for this family of descriptors.
-    const auto bounds(_descriptors_by_xdid.equal_range(xdid));
+    const auto bounds(descriptorRange(xdid));
 
     // If the bounds are equal, no element matches, unknown descritor.
     if (bounds.first == bounds.second) {
@@ -430,7 +450,7 @@ const ts::PSIRepository::DescriptorClass& ts::PSIRepository::getDescriptor(XDID
     size_t match_count = 0;
     auto next = bounds.first;
     for ( ; next != bounds.second; ++next) {
-        const auto& dc(next->second);
+        const auto& dc(*next);
         if ((dc->edid.isExtension() && dc->edid.xdid() == xdid) || dc->edid.matchTableSpecific(tid, standards)) {
             // Extension descriptor or table-specific descriptor for the table we use, we have a match.
             return *dc;
@@ -550,9 +570,8 @@ ts::Standards ts::PSIRepository::getTableStandards(TID tid, PID pid, Standards c
     // Accumulate the common subset of all standards for this table id with incompatible standards.
     std::optional<Standards> standards_bad_std;
 
-    const auto bounds(_tables_by_tid.equal_range(tid));
-    for (auto it = bounds.first; it != bounds.second; ++it) {
-        const auto& tc(*it->second);
+    for (const auto& ptc : _tables_by_tid[tid]) {
+        const auto& tc(*ptc);
         if (tc.pids.contains(pid)) {
             // We are in a standard PID for this table id, return the corresponding standards only.
             return tc.standards;
@@ -638,12 +657,9 @@ ts::UString ts::PSIRepository::descriptorTables(const DuckContext& duck, const U
 void ts::PSIRepository::getRegisteredTableIds(std::vector<TID>& ids) const
 {
     ids.clear();
-    TID previous = TID_NULL;
-    for (const auto& it : _tables_by_tid) {
-        // This is a multimap, the same key can be reused, use it once only.
-        if (it.first != previous) {
-            ids.push_back(it.first);
-            previous = it.first;
+    for (size_t tid = 0; tid < _tables_by_tid.size(); ++tid) {
+        if (!_tables_by_tid[tid].empty()) {
+            ids.push_back(TID(tid));
         }
     }
 }
@@ -651,8 +667,10 @@ void ts::PSIRepository::getRegisteredTableIds(std::vector<TID>& ids) const
 void ts::PSIRepository::getRegisteredDescriptorIds(std::vector<EDID>& ids) const
 {
     ids.clear();
-    for (const auto& it : _descriptors_by_xdid) {
-        ids.push_back(it.second->edid);
+    for (const auto& bucket : _descriptors_by_did) {
+        for (const auto& dc : bucket) {
+            ids.push_back(dc->edid);
+        }
     }
 }
 
@@ -685,15 +703,17 @@ void ts::PSIRepository::listTables(std::ostream& out) const
     table.addColumn(4, u"Name");
 
     // Loop on all known tables.
-    for (const auto& it : _tables_by_tid) {
-        const auto& tc(*it.second);
-        if (!tc.xml_name.empty() && tc.index != NullIndex()) {
-            // This table is supported by TSDuck.
-            table.newLine();
-            table.setCell(1, UString::Format(u"%X", it.first));
-            table.setCell(2, u"<" + tc.xml_name + u">");
-            table.setCell(3, StandardsNames(tc.standards));
-            table.setCell(4, tc.display_name);
+    for (size_t tid = 0; tid < _tables_by_tid.size(); ++tid) {
+        for (const auto& ptc : _tables_by_tid[tid]) {
+            const auto& tc(*ptc);
+            if (!tc.xml_name.empty() && tc.index != NullIndex()) {
+                // This table is supported by TSDuck.
+                table.newLine();
+                table.setCell(1, UString::Format(u"%X", TID(tid)));
+                table.setCell(2, u"<" + tc.xml_name + u">");
+                table.setCell(3, StandardsNames(tc.standards));
+                table.setCell(4, tc.display_name);
+            }
         }
     }
     table.output(out, TextTable::Headers::UNDERLINED, false, UString(), u"  ");
@@ -713,36 +733,38 @@ void ts::PSIRepository::listDescriptors(std::ostream& out) const
     table.addColumn(4, u"Name, context");
 
     // Loop on all known descriptors.
-    for (const auto& it : _descriptors_by_xdid) {
-        const auto& dc(*it.second);
-        if (!dc.xml_name.empty() && dc.index != NullIndex()) {
-            // This descriptor is supported by TSDuck.
-            table.newLine();
-            table.setCell(1, it.first.toString());
-            table.setCell(2, u"<" + dc.xml_name + u">");
-            table.setCell(3, StandardsNames(dc.edid.standards()));
-            UString name(dc.display_name);
-            if (dc.edid.isPrivateDual()) {
-                name += u", MPEG and DVB private (" + REGIDName(dc.edid.privateId()) + u")";
-            }
-            else if (dc.edid.isPrivateMPEG()) {
-                name += u", MPEG private (" + REGIDName(dc.edid.regid()) + u")";
-            }
-            else if (dc.edid.isPrivateDVB()) {
-                name += u", DVB private (" + PDSName(dc.edid.pds()) + u")";
-            }
-            else if (dc.edid.isTableSpecific()) {
-                const std::set<TID> tids(dc.edid.tableIds());
-                DuckContext duck;
-                duck.addStandards(dc.edid.standards());
-                const UChar* prefix = u", only in ";
-                for (TID tid : tids) {
-                    name += prefix;
-                    name += TIDName(duck, tid);
-                    prefix = u", ";
+    for (const auto& bucket : _descriptors_by_did) {
+        for (const auto& pdc : bucket) {
+            const auto& dc(*pdc);
+            if (!dc.xml_name.empty() && dc.index != NullIndex()) {
+                // This descriptor is supported by TSDuck.
+                table.newLine();
+                table.setCell(1, dc.edid.xdid().toString());
+                table.setCell(2, u"<" + dc.xml_name + u">");
+                table.setCell(3, StandardsNames(dc.edid.standards()));
+                UString name(dc.display_name);
+                if (dc.edid.isPrivateDual()) {
+                    name += u", MPEG and DVB private (" + REGIDName(dc.edid.privateId()) + u")";
+                }
+                else if (dc.edid.isPrivateMPEG()) {
+                    name += u", MPEG private (" + REGIDName(dc.edid.regid()) + u")";
+                }
+                else if (dc.edid.isPrivateDVB()) {
+                    name += u", DVB private (" + PDSName(dc.edid.pds()) + u")";
                 }
+                else if (dc.edid.isTableSpecific()) {
+                    const std::set<TID> tids(dc.edid.tableIds());
+                    DuckContext duck;
+                    duck.addStandards(dc.edid.standards());
+                    const UChar* prefix = u", only in ";
+                    for (TID tid : tids) {
+                        name += prefix;
+                        name += TIDName(duck, tid);
+                        prefix = u", ";
+                    }
+                }
+                table.setCell(4, name);
             }
-            table.setCell(4, name);
         }
     }
     table.output(out, TextTable::Headers::UNDERLINED, false, UString(), u"  ");
@@ -755,10 +777,19 @@ void ts::PSIRepository::listDescriptors(std::ostream& out) const
 
 void ts::PSIRepository::dumpInternalState(std::ostream& out) const
 {
+    size_t table_count = 0;
+    for (const auto& bucket : _tables_by_tid) {
+        table_count += bucket.size();
+    }
+    size_t descriptor_count = 0;
+    for (const auto& bucket : _descriptors_by_did) {
+        descriptor_count += bucket.size();
+    }
+
     out << "TSDuck PSI Repository" << std::endl
         << "=====================" << std::endl
         << std::endl
-        << "==== TID to table class: " << _tables_by_tid.size() << std::endl << std::endl;
+        << "==== TID to table class: " << table_count << std::endl << std::endl;
 
     TextTable table;
     table.addColumn(1, u"TID");
@@ -769,16 +800,18 @@ void ts::PSIRepository::dumpInternalState(std::ostream& out) const
     table.addColumn(6, u"PID");
     table.addColumn(7, u"CAS");
 
-    for (const auto& it : _tables_by_tid) {
-        const auto& tc(*it.second);
-        table.newLine();
-        table.setCell(1, UString::Format(u"%X", it.first));
-        table.setCell(2, NameToString(u"'", tc.display_name, u"'"));
-        table.setCell(3, NameToString(u"<", tc.xml_name, u">"));
-        table.setCell(4, StandardsToString(tc.standards));
-        table.setCell(5, TypeIndexToString(tc.index));
-        table.setCell(6, PIDsToString(tc.pids));
-        table.setCell(7, CASToString(tc.min_cas, tc.max_cas));
+    for (size_t tid = 0; tid < _tables_by_tid.size(); ++tid) {
+        for (const auto& ptc : _tables_by_tid[tid]) {
+            const auto& tc(*ptc);
+            table.newLine();
+            table.setCell(1, UString::Format(u"%X", TID(tid)));
+            table.setCell(2, NameToString(u"'", tc.display_name, u"'"));
+            table.setCell(3, NameToString(u"<", tc.xml_name, u">"));
+            table.setCell(4, StandardsToString(tc.standards));
+            table.setCell(5, TypeIndexToString(tc.index));
+            table.setCell(6, PIDsToString(tc.pids));
+            table.setCell(7, CASToString(tc.min_cas, tc.max_cas));
+        }
     }
     table.output(out, TextTable::Headers::UNDERLINED);
 
@@ -794,7 +827,7 @@ void ts::PSIRepository::dumpInternalState(std::ostream& out) const
     }
     table.output(out, TextTable::Headers::UNDERLINED);
 
-    out << std::endl << "==== XDID to descriptor class: " << _descriptors_by_xdid.size() << std::endl << std::endl;
+    out << std::endl << "==== XDID to descriptor class: " << descriptor_count << std::endl << std::endl;
     table.clear();
     table.addColumn(1, u"XDID");
     table.addColumn(2, u"Name");
@@ -802,14 +835,16 @@ void ts::PSIRepository::dumpInternalState(std::ostream& out) const
     table.addColumn(4, u"EDID");
     table.addColumn(5, u"Class");
 
-    for (const auto& it : _descriptors_by_xdid) {
-        const auto& dc(*it.second);
-        table.newLine();
-        table.setCell(1, it.first.toString());
-        table.setCell(2, NameToString(u"'", dc.display_name, u"'"));
-        table.setCell(3, NameToString(u"<", dc.xml_name, u">"));
-        table.setCell(4, dc.edid.toString());
-        table.setCell(5, TypeIndexToString(dc.index));
+    for (const auto& bucket : _descriptors_by_did) {
+        for (const auto& pdc : bucket) {
+            const auto& dc(*pdc);
+            table.newLine();
+            table.setCell(1, dc.edid.xdid().toString());
+            table.setCell(2, NameToString(u"'", dc.display_name, u"'"));
+            table.setCell(3, NameToString(u"<", dc.xml_name, u">"));
+            table.setCell(4, dc.edid.toString());
+            table.setCell(5, TypeIndexToString(dc.index));
+        }
     }
     table.output(out, TextTable::Headers::UNDERLINED);
 
@@ -378,15 +378,27 @@ namespace ts {
         using DescriptorClassPtr = std::shared_ptr<DescriptorClass>;
 
         // Several table classes can be used for the same table id, for instance for distinct DTV standards or
-        // distinct CA systems. There is only one class per XML name.
-        std::multimap<TID, TableClassPtr> _tables_by_tid {};
-        std::map<UString, TableClassPtr>  _tables_by_xml_name {};
-
-        // Several descriptor classes can be used for the same descriptor id (private, extended, table-specific descriptors).
-        std::multimap<XDID, DescriptorClassPtr>            _descriptors_by_xdid {};        // Description of all descriptors, by XDID (multiple entries per XDID).
-        std::map<UString, DescriptorClassPtr>              _descriptors_by_xml_name {};    // Description of all descriptors, by XML name (including legacy names).
-        std::multimap<std::type_index, DescriptorClassPtr> _descriptors_by_type_index {};  // Description of all descriptors, by RTTI type index (multiple entries if multiple EDID).
-        std::multimap<UString, TID>                        _descriptor_tids {};            // XML descriptor name to table id for table-specific descriptors
+        // distinct CA systems. There is only one class per XML name. The table classes are stored in a flat
+        // array, directly indexed by table id: resolving a table id is O(1), without tree search, plus a
+        // linear scan of the (usually very few) classes sharing that table id.
+        std::array<std::vector<TableClassPtr>, TID_MAX> _tables_by_tid {};
+        std::map<UString, TableClassPtr>                _tables_by_xml_name {};
+
+        // Several descriptor classes can be used for the same descriptor id (private, extended, table-specific
+        // descriptors). The descriptor classes are stored in a flat array, directly indexed by DID. Each entry
+        // is a vector of classes, sorted by XDID, where the classes for one XDID are located by binary search.
+        std::array<std::vector<DescriptorClassPtr>, DID_MAX> _descriptors_by_did {};        // Description of all descriptors, by DID, sorted by XDID inside a DID.
+        std::map<UString, DescriptorClassPtr>                _descriptors_by_xml_name {};   // Description of all descriptors, by XML name (including legacy names).
+        std::multimap<std::type_index, DescriptorClassPtr>   _descriptors_by_type_index {}; // Description of all descriptors, by RTTI type index (multiple entries if multiple EDID).
+        std::multimap<UString, TID>                          _descriptor_tids {};           // XML descriptor name to table id for table-specific descriptors
+
+        // Insert a descriptor class in its DID bucket, keeping the bucket sorted by XDID.
+        void addDescriptorClass(const DescriptorClassPtr& dc);
+
+        // Get the range of descriptor classes for one XDID, using a binary search in the DID bucket.
+        using DescriptorClassVector = std::vector<DescriptorClassPtr>;
+        using DescriptorClassRange = std::pair<DescriptorClassVector::const_iterator, DescriptorClassVector::const_iterator>;
+        DescriptorClassRange descriptorRange(XDID xdid) const;
 
         // Display functions for CA_descriptor by CA_system_id.
         std::map<uint16_t, DisplayCADescriptorFunction> _casid_descriptor_displays {};
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsSectionBufferPool.h"
+#include "tsAllocProfile.h"
+#include "tsMemory.h"
+#include "tsFatal.h"
+
+TS_DEFINE_SINGLETON(ts::SectionBufferPool);
+
+
+//----------------------------------------------------------------------------
+// Constructor.
+//----------------------------------------------------------------------------
+
+ts::SectionBufferPool::SectionBufferPool()
+{
+    _free.reserve(MAX_BUFFERS);
+}
+
+
+//----------------------------------------------------------------------------
+// Get a buffer from the pool, or allocate a new one when the pool is empty.
+//----------------------------------------------------------------------------
+
+ts::ByteBlockPtr ts::SectionBufferPool::get(size_t size)
+{
+    ByteBlock* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_free.empty()) {
+            buffer = _free.back().release();
+            _free.pop_back();
+        }
+    }
+    if (buffer == nullptr) {
+        TS_ALLOC_TRACE("SectionBufferPool::get(miss)", size);
+        buffer = new ByteBlock(size);
+        CheckNonNull(buffer);
+    }
+    else {
+        // A recycled buffer keeps its previous storage capacity, the resize
+        // reallocates only when the new section is larger than all previous
+        // users of this buffer.
+        buffer->resize(size);
+    }
+    // The deleter returns the buffer to the pool instead of freeing it.
+    return ByteBlockPtr(buffer, [](ByteBlock* p) { SectionBufferPool::Instance().release(p); });
+}
+
+
+//----------------------------------------------------------------------------
+// Get a buffer from the pool and fill it with user data.
+//----------------------------------------------------------------------------
+
+ts::ByteBlockPtr ts::SectionBufferPool::get(const void* data, size_t size)
+{
+    ByteBlockPtr buffer(get(size));
+    MemCopy(buffer->data(), data, size);
+    return buffer;
+}
+
+
+//----------------------------------------------------------------------------
+// Return a buffer to the pool. Used as deleter of the returned safe pointers.
+//----------------------------------------------------------------------------
+
+void ts::SectionBufferPool::release(ByteBlock* buffer)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_free.size() < MAX_BUFFERS) {
+        _free.emplace_back(buffer);
+    }
+    else {
+        // The pool is full, deallocate the buffer as usual.
+        delete buffer;
+    }
+}
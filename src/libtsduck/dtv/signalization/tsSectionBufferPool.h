@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Recycling pool of buffers for PSI/SI section payloads.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsByteBlock.h"
+
+namespace ts {
+    //!
+    //! Recycling pool of buffers for PSI/SI section payloads.
+    //! @ingroup libtsduck mpeg
+    //!
+    //! Demuxing and packetizing PSI/SI creates and destroys one Section object
+    //! per individual section. On EIT-heavy streams, this means tens of thousands
+    //! of heap allocations per second, most of them for buffers of similar sizes.
+    //! This pool recycles the section buffers: when the last reference to a pooled
+    //! buffer is dropped, the buffer returns to the pool instead of being freed
+    //! and its storage is reused for a subsequent section.
+    //!
+    //! The pool is thread-safe. It is transparent for the users of the buffers:
+    //! a pooled buffer is a standard ByteBlockPtr and returns to the pool through
+    //! its deleter, wherever the last reference is dropped (section demux, binary
+    //! table, packetizer or application code).
+    //!
+    //! This class is a singleton. Use static Instance() method to access the single instance.
+    //!
+    class TSDUCKDLL SectionBufferPool
+    {
+        TS_SINGLETON(SectionBufferPool);
+    public:
+        //!
+        //! Maximum number of buffers which are retained in the pool.
+        //! When the pool is full, additional released buffers are simply deallocated.
+        //! Since a section is at most 4 kB, the pool retains a few MB at most.
+        //!
+        static constexpr size_t MAX_BUFFERS = 512;
+
+        //!
+        //! Get a buffer from the pool, or allocate a new one when the pool is empty.
+        //! @param [in] size Requested size in bytes of the buffer.
+        //! @return A safe pointer to a buffer of @a size bytes, with unspecified content.
+        //! When the last reference to the buffer is dropped, the buffer automatically
+        //! returns to the pool.
+        //!
+        ByteBlockPtr get(size_t size);
+
+        //!
+        //! Get a buffer from the pool and fill it with user data.
+        //! @param [in] data Address of the data to copy into the buffer.
+        //! @param [in] size Size in bytes of the data.
+        //! @return A safe pointer to a buffer containing a copy of @a data.
+        //! When the last reference to the buffer is dropped, the buffer automatically
+        //! returns to the pool.
+        //!
+        ByteBlockPtr get(const void* data, size_t size);
+
+    private:
+        // Return a buffer to the pool. Used as deleter of the returned safe pointers.
+        void release(ByteBlock* buffer);
+
+        // The free buffers keep their storage capacity and are resized on reuse.
+        std::mutex _mutex {};
+        std::vector<std::unique_ptr<ByteBlock>> _free {};
+    };
+}
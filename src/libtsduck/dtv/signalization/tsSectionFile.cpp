@@ -18,6 +18,83 @@
 #include "tsFatal.h"
 
 
+//----------------------------------------------------------------------------
+// Process-wide cache of the merged XML model for tables and descriptors.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // Building the model requires locating, loading and parsing the main model
+    // file, plus all registered extension files which are merged into the main
+    // tree. This is done at most once per process. The resulting model is cached
+    // as XML text and reparsed by each user, so that each instance keeps its own
+    // report and parsing tweaks.
+    class TablesModelCache
+    {
+        TS_SINGLETON(TablesModelCache);
+    public:
+        // Get the model text, building it on first reference.
+        // Return false when the main model cannot be loaded (not cached, retried later).
+        bool text(bool load_extensions, ts::UString& model_text, ts::Report& report);
+    private:
+        std::mutex  _mutex {};
+        ts::UString _main {};    // Main model only.
+        ts::UString _merged {};  // Main model with all extension models merged.
+    };
+
+    TS_DEFINE_SINGLETON(TablesModelCache);
+
+    TablesModelCache::TablesModelCache()
+    {
+    }
+
+    bool TablesModelCache::text(bool load_extensions, ts::UString& model_text, ts::Report& report)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ts::UString& cached(load_extensions ? _merged : _main);
+
+        if (cached.empty()) {
+            // Load the main model. Use searching rules.
+            ts::xml::Document doc(report);
+            if (!doc.load(ts::SectionFile::XML_TABLES_MODEL, true)) {
+                report.error(u"Main model for TSDuck XML files not found: %s", ts::SectionFile::XML_TABLES_MODEL);
+                return false;
+            }
+
+            // Get the root element in the model.
+            ts::xml::Element* root = doc.rootElement();
+            if (root == nullptr) {
+                report.error(u"Main model for TSDuck XML files is empty: %s", ts::SectionFile::XML_TABLES_MODEL);
+                return false;
+            }
+
+            if (load_extensions) {
+                // Get the list of all registered extension files.
+                ts::UStringList extfiles;
+                ts::PSIRepository::Instance().getRegisteredTablesModels(extfiles);
+
+                // Load all extension files. Only report an error in case of failure.
+                for (const auto& name : extfiles) {
+                    // Load the extension file. Use searching rules.
+                    ts::xml::Document extdoc(report);
+                    if (!extdoc.load(name, true)) {
+                        extdoc.report().error(u"Extension XML model file not found: %s", name);
+                    }
+                    else {
+                        root->merge(extdoc.rootElement());
+                    }
+                }
+            }
+
+            cached = doc.toString();
+        }
+
+        model_text = cached;
+        return true;
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Constructors and destructors.
 //----------------------------------------------------------------------------
@@ -490,40 +567,10 @@ bool ts::SectionFile::loadThisModel()
 
 bool ts::SectionFile::LoadModel(xml::Document& doc, bool load_extensions)
 {
-    // Load the main model. Use searching rules.
-    if (!doc.load(XML_TABLES_MODEL, true)) {
-        doc.report().error(u"Main model for TSDuck XML files not found: %s", XML_TABLES_MODEL);
-        return false;
-    }
-
-    // If no extension to be loaded, nothing more to do.
-    if (!load_extensions) {
-        return true;
-    }
-
-    // Get the root element in the model.
-    xml::Element* root = doc.rootElement();
-    if (root == nullptr) {
-        doc.report().error(u"Main model for TSDuck XML files is empty: %s", XML_TABLES_MODEL);
-        return false;
-    }
-
-    // Get the list of all registered extension files.
-    UStringList extfiles;
-    PSIRepository::Instance().getRegisteredTablesModels(extfiles);
-
-    // Load all extension files. Only report a warning in case of failure.
-    for (const auto& name : extfiles) {
-        // Load the extension file. Use searching rules.
-        xml::Document extdoc(doc.report());
-        if (!extdoc.load(name, true)) {
-            extdoc.report().error(u"Extension XML model file not found: %s", name);
-        }
-        else {
-            root->merge(extdoc.rootElement());
-        }
-    }
-    return true;
+    // Get the model text from the process-wide cache (built on first reference)
+    // and parse it in the target document, with its own report and tweaks.
+    UString text;
+    return TablesModelCache::Instance().text(load_extensions, text, doc.report()) && doc.parse(text);
 }
 
 
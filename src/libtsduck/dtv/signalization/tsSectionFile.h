@@ -419,7 +419,8 @@ namespace ts {
 
         //!
         //! This static method loads the XML model for tables and descriptors.
-        //! It loads the main model and merges all extensions.
+        //! It loads the main model and merges all extensions. The model is built
+        //! at most once per process and then served from an internal cache.
         //! @param [out] doc XML document which receives the model.
         //! @param [out] load_extensions If true (the default), load model additions from all declared TSDuck extensions.
         //! @return True on success, false on error.
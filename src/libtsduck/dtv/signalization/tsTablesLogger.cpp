@@ -251,6 +251,14 @@ void ts::TablesLogger::defineArgs(Args& args)
               u"The default is binary. "
               u"With --all-sections or --all-once, the only allowed format is binary.");
 
+    args.option(u"udp-pack", 0, Args::POSITIVE, 0, 1, 0, 0, true);
+    args.help(u"udp-pack",
+              u"With --ip-udp and --no-encapsulation, pack several sections in each UDP "
+              u"datagram instead of sending one datagram per section. A datagram is sent "
+              u"when the next section would overflow the maximum payload size and pending "
+              u"sections are flushed on close. The optional value is the maximum payload "
+              u"size in bytes. The default is 1400 bytes.");
+
     args.option(u"xml-output", 0, Args::FILENAME);
     args.help(u"xml-output",
               u"Save the tables in XML format in the specified file. "
@@ -325,6 +333,8 @@ bool ts::TablesLogger::loadArgs(DuckContext& duck, Args& args)
     _no_duplicate = args.present(u"no-duplicate");
     _no_deep_duplicate = args.present(u"no-deep-duplicate");
     _udp_raw = args.present(u"no-encapsulation");
+    _udp_pack = args.present(u"udp-pack");
+    args.getIntValue(_udp_payload, u"udp-pack", DEFAULT_UDP_PAYLOAD_SIZE);
     _use_current = !args.present(u"exclude-current");
     _use_next = args.present(u"include-next");
 
@@ -337,6 +347,10 @@ bool ts::TablesLogger::loadArgs(DuckContext& duck, Args& args)
         args.error(u"filtering sections (--all-sections or --all-once) is incompatible with XML or JSON output");
         return false;
     }
+    if (_udp_pack && (!_udp_raw || _udp_format != SectionFormat::BINARY)) {
+        args.error(u"--udp-pack requires --no-encapsulation and binary UDP format");
+        return false;
+    }
 
     // Load options from all section filters.
     _initial_pids.reset();
@@ -376,6 +390,7 @@ bool ts::TablesLogger::open()
     _deep_hashes.clear();
     _sections_once.clear();
     _x2j_conv.clear();
+    _udp_batch.clear();
 
     if (_bin_file.is_open()) {
         _bin_file.close();
@@ -494,6 +509,7 @@ void ts::TablesLogger::close()
             _bin_file.close();
         }
         if (_sock.isOpen()) {
+            flushUDP();
             _sock.close(_report);
         }
 
@@ -919,6 +935,12 @@ void ts::TablesLogger::sendUDP(const ts::BinaryTable& table)
             _sock.send(utf8.data(), utf8.size(), _report);
         }
     }
+    else if (_udp_raw && _udp_pack) {
+        // Accumulate the sections of the table with the pending ones.
+        for (size_t i = 0; i < table.sectionCount(); ++i) {
+            sendUDP(*table.sectionAt(i));
+        }
+    }
     else if (_udp_raw) {
         // Send a binary table in raw format.
         ByteBlock bin;
@@ -954,7 +976,19 @@ void ts::TablesLogger::sendUDP(const ts::Section& section)
 {
     // Individual sections can only be sent in binary format.
     if (_udp_format == SectionFormat::BINARY) {
-        if (_udp_raw) {
+        if (_udp_raw && _udp_pack) {
+            // Pack several raw sections per datagram. Flush the pending sections
+            // first when this one does not fit after them. A receiver using
+            // AnalyzeUDPMessage() already loops on all sections in a datagram.
+            if (!_udp_batch.empty() && _udp_batch.size() + section.size() > _udp_payload) {
+                flushUDP();
+            }
+            _udp_batch.append(section.content(), section.size());
+            if (_udp_batch.size() >= _udp_payload) {
+                flushUDP();
+            }
+        }
+        else if (_udp_raw) {
             // Send raw content of section as one single UDP message
             _sock.send(section.content(), section.size(), _report);
         }
@@ -977,6 +1011,19 @@ void ts::TablesLogger::sendUDP(const ts::Section& section)
 }
 
 
+//----------------------------------------------------------------------------
+// Send the pending sections in one UDP datagram (with --udp-pack).
+//----------------------------------------------------------------------------
+
+void ts::TablesLogger::flushUDP()
+{
+    if (!_udp_batch.empty()) {
+        _sock.send(_udp_batch.data(), _udp_batch.size(), _report);
+        _udp_batch.clear();
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Static routine to analyze UDP messages as sent with option --ip-udp.
 //----------------------------------------------------------------------------
@@ -57,6 +57,12 @@ namespace ts {
         //!
         static constexpr size_t DEFAULT_LOG_SIZE = 8;
 
+        //!
+        //! Default maximum UDP payload size in bytes, with option -\-udp-pack.
+        //! Several sections are packed in each UDP datagram, up to this size.
+        //!
+        static constexpr size_t DEFAULT_UDP_PAYLOAD_SIZE = 1400;
+
         //!
         //! Add command line option definitions in an Args.
         //! @param [in,out] args Command line arguments to update.
@@ -180,6 +186,8 @@ namespace ts {
         SectionFormat            _udp_format = SectionFormat::BINARY; // Format of sections in UDP messages.
         int                      _udp_ttl = 0;               // Time-to-live socket option.
         bool                     _udp_raw = false;           // UDP messages contain raw sections, not structured messages.
+        bool                     _udp_pack = false;          // Pack several raw sections per UDP datagram.
+        size_t                   _udp_payload = DEFAULT_UDP_PAYLOAD_SIZE;  // Max UDP payload size with --udp-pack.
         bool                     _all_sections = false;      // Collect all sections, as they appear.
         bool                     _all_once = false;          // Collect all sections but only once per PID/TID/TDIext/secnum/version.
         bool                     _invalid_sections = false;  // Display invalid sections.
@@ -225,6 +233,7 @@ namespace ts {
         std::set<uint64_t>       _sections_once {};          // Tracking sets of PID/TID/TDIext/secnum/version with --all-once.
         TablesLoggerFilterVector _section_filters {};        // All registered section filters.
         duck::Protocol           _duck_protocol {};          // To generate UDP messages.
+        ByteBlock                _udp_batch {};              // Pending sections for the next UDP datagram (with --udp-pack).
 
         // Create a binary file. On error, set _abort and return false.
         bool createBinaryFile(const fs::path& name);
@@ -244,9 +253,10 @@ namespace ts {
         // Log XML and/or JSON one-liners.
         void logXMLJSON(const BinaryTable& table);
 
-        // Send UDP table and section.
+        // Send UDP table and section. Flush sections pending in the UDP batch.
         void sendUDP(const BinaryTable& table);
         void sendUDP(const Section& section);
+        void flushUDP();
 
         // Pre/post-display of a table or section
         void preDisplay(PacketCounter first, PacketCounter last);
@@ -17,6 +17,86 @@
 #include "tsArgs.h"
 
 
+//----------------------------------------------------------------------------
+// Process-wide defaults from the TSDuck configuration file.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // Decode a time reference name: "UTC", "JST", "UTC+hh[:mm]", "UTC-hh[:mm]".
+    // Set the offset and return true on success, leave it unmodified on error.
+    bool DecodeTimeReference(const ts::UString& name, cn::milliseconds& offset)
+    {
+        // Convert to uppercase without space.
+        ts::UString str(name);
+        str.convertToUpper();
+        str.remove(ts::SPACE);
+
+        if (str.similar(u"UTC")) {
+            offset = cn::milliseconds::zero();
+            return true;
+        }
+        else if (str.similar(u"JST")) {
+            offset = ts::Time::JSTOffset;
+            return true;
+        }
+
+        size_t count = 0;
+        size_t last = 0;
+        ts::UChar sign = ts::CHAR_NULL;
+        cn::hours::rep hours = 0;
+        cn::minutes::rep minutes = 0;
+
+        str.scan(count, last, u"UTC%c%d:%d", &sign, &hours, &minutes);
+        if ((count == 2 || count == 3) &&
+            last == str.size() &&
+            (sign == u'+' || sign == u'-') &&
+            hours >= 0 && hours <= 12 &&
+            minutes >= 0 && minutes <= 59)
+        {
+            offset = (sign == u'+' ? +1 : -1) * (cn::hours(hours) + cn::minutes(minutes));
+            return true;
+        }
+        else {
+            // Incorrect name.
+            return false;
+        }
+    }
+
+    // The defaults from the TSDuck configuration file are read and decoded only
+    // once per process. All DuckContext instances start from these shared values
+    // and diverge on their own copies when options or setters are applied.
+    class ConfigDefaults
+    {
+        TS_SINGLETON(ConfigDefaults);
+    public:
+        ts::UString      time_ref_config {};       // Raw default.time value.
+        cn::milliseconds time_reference {};        // Decoded default.time offset.
+        bool             use_leap_seconds = true;  // leap.seconds value.
+    };
+
+    TS_DEFINE_SINGLETON(ConfigDefaults);
+
+    ConfigDefaults::ConfigDefaults()
+    {
+        const auto& config(ts::DuckConfigFile::Instance());
+
+        // Initialize time reference from configuration file. Ignore errors.
+        time_ref_config = config.value(u"default.time");
+        if (!time_ref_config.empty() && !DecodeTimeReference(time_ref_config, time_reference)) {
+            CERR.verbose(u"invalid default.time '%s' in %s", time_ref_config, config.fileName());
+        }
+
+        // Get leap.seconds initial value from configuration file. Default value is true.
+        const ts::UString ls(config.value(u"leap.seconds"));
+        if (!ls.empty() && !ls.toBool(use_leap_seconds)) {
+            use_leap_seconds = true;
+            CERR.verbose(u"invalid leap.seconds '%s' in %s", ls, config.fileName());
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Constructor and destructors.
 //----------------------------------------------------------------------------
@@ -27,7 +107,7 @@ ts::DuckContext::DuckContext(Report* report, std::ostream* output) :
     _out(_initial_out),
     _charset_in(&DVBCharset::DVB),  // default DVB charset
     _charset_out(&DVBCharset::DVB),
-    _time_ref_config(DuckConfigFile::Instance().value(u"default.time")),
+    _time_ref_config(ConfigDefaults::Instance().time_ref_config),
     _predefined_cas{{CASID_CONAX_MIN,      u"conax"},
                     {CASID_IRDETO_MIN,     u"irdeto"},
                     {CASID_MEDIAGUARD_MIN, u"mediaguard"},
@@ -37,17 +117,10 @@ ts::DuckContext::DuckContext(Report* report, std::ostream* output) :
                     {CASID_VIACCESS_MIN,   u"viaccess"},
                     {CASID_WIDEVINE_MIN,   u"widevine"}}
 {
-    // Initialize time reference from configuration file. Ignore errors.
-    if (!_time_ref_config.empty() && !setTimeReference(_time_ref_config)) {
-        CERR.verbose(u"invalid default.time '%s' in %s", _time_ref_config, DuckConfigFile::Instance().fileName());
-    }
-
-    // Get leap.seconds initial value from configuration file. Default value is true.
-    const UString ls(DuckConfigFile::Instance().value(u"leap.seconds"));
-    if (!ls.empty() && !ls.toBool(_use_leap_seconds)) {
-        _use_leap_seconds = true;
-        CERR.verbose(u"invalid leap.seconds '%s' in %s", ls, DuckConfigFile::Instance().fileName());
-    }
+    // All defaults from the configuration file are decoded once per process
+    // and shared by all contexts.
+    _time_reference = ConfigDefaults::Instance().time_reference;
+    _use_leap_seconds = ConfigDefaults::Instance().use_leap_seconds;
 }
 
 
@@ -178,40 +251,7 @@ const ts::HFBand* ts::DuckContext::uhfBand() const
 
 bool ts::DuckContext::setTimeReference(const UString& name)
 {
-    // Convert to uppercase without space.
-    UString str(name);
-    str.convertToUpper();
-    str.remove(SPACE);
-
-    if (str.similar(u"UTC")) {
-        _time_reference = cn::milliseconds::zero();
-        return true;
-    }
-    else if (str.similar(u"JST")) {
-        _time_reference = Time::JSTOffset;
-        return true;
-    }
-
-    size_t count = 0;
-    size_t last = 0;
-    UChar sign = CHAR_NULL;
-    cn::hours::rep hours = 0;
-    cn::minutes::rep minutes = 0;
-
-    str.scan(count, last, u"UTC%c%d:%d", &sign, &hours, &minutes);
-    if ((count == 2 || count == 3) &&
-        last == str.size() &&
-        (sign == u'+' || sign == u'-') &&
-        hours >= 0 && hours <= 12 &&
-        minutes >= 0 && minutes <= 59)
-    {
-        _time_reference = (sign == u'+' ? +1 : -1) * (cn::hours(hours) + cn::minutes(minutes));
-        return true;
-    }
-    else {
-        // Incorrect name.
-        return false;
-    }
+    return DecodeTimeReference(name, _time_reference);
 }
 
 
@@ -308,18 +308,16 @@ void ts::T2MIDemux::demuxTS(PID pid, PIDContext& pc, const T2MIPacket& pkt)
         }
     }
 
-    // Now process each complete TS packet.
-    while (plpp->ts_next + PKT_SIZE <= plpp->ts.size()) {
-
-        // Build the TS packet.
-        TSPacket tsPkt;
-        MemCopy(tsPkt.b, &plpp->ts[plpp->ts_next], PKT_SIZE);
-        plpp->ts_next += PKT_SIZE;
-
+    // Now process all complete TS packets in one single batch. They are stored
+    // back to back in the reassembly buffer and TSPacket has the physical layout
+    // of a TS packet, so the buffer can be directly viewed as an array of packets.
+    const size_t ts_count = (plpp->ts.size() - plpp->ts_next) / PKT_SIZE;
+    if (ts_count > 0) {
         // Notify the application. Note that we are already in a protected section.
         if (_handler != nullptr) {
-            _handler->handleTSPacket(*this, pkt, tsPkt);
+            _handler->handleTSPackets(*this, pkt, reinterpret_cast<const TSPacket*>(plpp->ts.data() + plpp->ts_next), ts_count);
         }
+        plpp->ts_next += ts_count * PKT_SIZE;
     }
 
     // Compress or cleanup the TS buffer.
@@ -11,3 +11,11 @@
 ts::T2MIHandlerInterface::~T2MIHandlerInterface()
 {
 }
+
+void ts::T2MIHandlerInterface::handleTSPackets(T2MIDemux& demux, const T2MIPacket& t2mi, const TSPacket* ts, size_t ts_count)
+{
+    // Default implementation: notify each packet individually.
+    for (size_t i = 0; i < ts_count; ++i) {
+        handleTSPacket(demux, t2mi, ts[i]);
+    }
+}
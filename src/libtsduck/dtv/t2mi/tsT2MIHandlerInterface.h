@@ -55,5 +55,17 @@ namespace ts {
         //! @param [in] ts The extracted TS packet.
         //!
         virtual void handleTSPacket(T2MIDemux& demux, const T2MIPacket& t2mi, const TSPacket& ts) = 0;
+
+        //!
+        //! This hook is invoked when several TS packets are extracted from one T2-MI packet.
+        //! The default implementation invokes handleTSPacket() on each packet. Subclasses
+        //! which process extracted packets in bulk may override it to get one single
+        //! notification per T2-MI packet.
+        //! @param [in,out] demux A reference to the T2-MI demux.
+        //! @param [in] t2mi The T2-MI packet from which the TS packets were extracted.
+        //! @param [in] ts Address of the first extracted TS packet.
+        //! @param [in] ts_count Number of contiguous extracted TS packets.
+        //!
+        virtual void handleTSPackets(T2MIDemux& demux, const T2MIPacket& t2mi, const TSPacket* ts, size_t ts_count);
     };
 }
@@ -551,3 +551,30 @@ bool ts::SpliceInformationTable::ExtractSpliceInsert(SpliceInsert& command, cons
     command.adjustPTS(pts_adjustment);
     return true;
 }
+
+
+//----------------------------------------------------------------------------
+// A static method to patch the pts_adjustment of a section in place.
+//----------------------------------------------------------------------------
+
+bool ts::SpliceInformationTable::PatchPTSAdjustment(Section& section, uint64_t pts_adjustment)
+{
+    // Payload layout: fixed part (11 bytes), variable part, CRC2 (4 bytes).
+    const uint8_t* data = section.payload();
+
+    if (!section.isValid() || section.tableId() != MY_TID || section.payloadSize() < 15 || (data[1] & 0x80) != 0) {
+        // Not a valid section or encrypted commands, cannot patch it.
+        return false;
+    }
+
+    // The pts_adjustment field is at a fixed offset in the payload:
+    // 33 bits, the last bit of data[1], followed by data[2] to data[5].
+    section.setUInt8(1, uint8_t((data[1] & 0xFE) | uint8_t((pts_adjustment >> 32) & 0x01)), false);
+    section.setUInt32(2, uint32_t(pts_adjustment & 0xFFFFFFFF), false);
+
+    // A splice_information_table is a short section with a trailing CRC32.
+    // Section::recomputeCRC() only processes long sections, so recompute the
+    // CRC32 explicitly over the section content, excluding the CRC32 itself.
+    section.setUInt32(section.payloadSize() - 4, CRC32(section.content(), section.size() - 4).value(), false);
+    return true;
+}
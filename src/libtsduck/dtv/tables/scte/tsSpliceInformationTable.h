@@ -76,6 +76,18 @@ namespace ts {
         //!
         static bool ExtractSpliceInsert(SpliceInsert& command, const Section& section);
 
+        //!
+        //! A static method to patch the pts_adjustment field of a splice information section in place.
+        //! The pts_adjustment field is located at a fixed offset in the binary section. It is directly
+        //! overwritten, without table deserialization, and the CRC32 of the section is recomputed.
+        //! The rest of the section is preserved byte for byte.
+        //! @param [in,out] section The section to patch.
+        //! @param [in] pts_adjustment New value of the pts_adjustment field (33 bits).
+        //! @return True on success, false if @a section is not a valid splice information
+        //! section or carries encrypted commands.
+        //!
+        static bool PatchPTSAdjustment(Section& section, uint64_t pts_adjustment);
+
     protected:
         // Inherited methods
         virtual size_t maxPayloadSize() const override;
@@ -59,6 +59,18 @@ bool ts::SubRipGenerator::setStream(std::ostream* stream)
 }
 
 
+//----------------------------------------------------------------------------
+// Flush the pending frames to the output file or stream.
+//----------------------------------------------------------------------------
+
+void ts::SubRipGenerator::flush()
+{
+    if (_stream != nullptr) {
+        _stream->flush();
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Close the generator.
 //----------------------------------------------------------------------------
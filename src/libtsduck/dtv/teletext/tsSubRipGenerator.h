@@ -60,6 +60,13 @@ namespace ts {
         //!
         bool setStream(std::ostream* stream);
 
+        //!
+        //! Flush the pending frames to the output file or stream.
+        //! Frames are buffered in the output stream and written by large blocks.
+        //! The stream is automatically flushed on close.
+        //!
+        void flush();
+
         //!
         //! Close the generator.
         //!
@@ -122,6 +129,7 @@ namespace ts {
         std::ofstream _outputStream {};   // Text stream for output file.
         std::ostream* _stream = nullptr;  // Output text stream.
         int           _frameCount = 0;    // Number of output frames.
+        UString       _lineBuffer {};     // Reusable buffer to assemble one frame.
     };
 }
 
@@ -160,20 +168,27 @@ void ts::SubRipGenerator::addFrame(const cn::duration<Rep1,Period1>& showTimesta
 
     // Generate the frame only when it is possible to do so.
     if (notEmpty && _stream != nullptr) {
+        // Assemble the complete frame in a reusable buffer and write it in one
+        // single operation, without flushing the stream. The frames accumulate
+        // in the stream buffer and are written by large blocks, instead of one
+        // write system call per line. Use flush() to force pending output.
+
         // First line: Frame count, starting at 1.
         // Second line: Start and end timestamps.
-        *_stream << ++_frameCount << std::endl
-                 << FormatDuration(showTimestamp, hideTimestamp) << std::endl;
+        _lineBuffer.clear();
+        _lineBuffer.format(u"%d\n%s\n", ++_frameCount, FormatDuration(showTimestamp, hideTimestamp));
 
         // Subsequent lines: Subtitle text.
         for (const auto& it : lines) {
             // Empty lines are illegal in SRT, skip them.
             if (!it.empty()) {
-                *_stream << it << std::endl;
+                _lineBuffer.append(it);
+                _lineBuffer.append(u'\n');
             }
         }
         // Trailing empty line to mark the end of frame.
-        *_stream << std::endl;
+        _lineBuffer.append(u'\n');
+        *_stream << _lineBuffer;
     }
 }
 
@@ -75,6 +75,28 @@ namespace {
         0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
     };
 
+    // Precomputed syndrome tables to remove 24/18 Hamming code, one table per
+    // byte of the 24-bit word. Each entry is the XOR of the contributions of
+    // the bits which are set in this byte (tests A-F of ETSI EN 300 706, 8.3).
+    constexpr std::array<std::array<uint8_t, 256>, 3> UNHAM_24_18_TEST = []() {
+        std::array<std::array<uint8_t, 256>, 3> tables {};
+        for (size_t byte = 0; byte < 3; ++byte) {
+            for (size_t value = 0; value < 256; ++value) {
+                uint8_t test = 0;
+                for (size_t bit = 0; bit < 8; ++bit) {
+                    if ((value >> bit) & 0x01) {
+                        const size_t i = 8 * byte + bit;
+                        // Tests A-F correspond to bits 0-6 respectively in 'test'.
+                        // Only parity bit is tested for bit 24.
+                        test ^= uint8_t(i < 23 ? i + 33 : 32);
+                    }
+                }
+                tables[byte][value] = test;
+            }
+        }
+        return tables;
+    }();
+
     // Text foreground color codes.
     const ts::UChar* const TELETEXT_COLORS[8] = {
         // 0=black, 1=red,      2=green,    3=yellow,   4=blue,     5=magenta,  6=cyan,     7=white
@@ -95,15 +117,8 @@ uint8_t ts::TeletextDemux::unham_8_4(uint8_t a)
 
 uint32_t ts::TeletextDemux::unham_24_18(uint32_t a)
 {
-    uint8_t test = 0;
-
-    // Tests A-F correspond to bits 0-6 respectively in 'test'.
-    for (uint8_t i = 0; i < 23; i++) {
-        test ^= ((a >> i) & 0x01) * (i + 33);
-    }
-
-    // Only parity bit is tested for bit 24
-    test ^= ((a >> 23) & 0x01) * 32;
+    // Compute tests A-F at once using the precomputed per-byte syndrome tables.
+    const uint8_t test = UNHAM_24_18_TEST[0][a & 0xFF] ^ UNHAM_24_18_TEST[1][(a >> 8) & 0xFF] ^ UNHAM_24_18_TEST[2][(a >> 16) & 0xFF];
 
     if ((test & 0x1F) != 0x1F) {
         // Not all tests A-E correct
@@ -0,0 +1,35 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsBitRateReciprocal.h"
+
+
+//----------------------------------------------------------------------------
+// Set a new bitrate and recompute the cached reciprocal factors.
+//----------------------------------------------------------------------------
+
+void ts::BitRateReciprocal::setBitRate(const BitRate& bitrate)
+{
+    if (bitrate != _bitrate) {
+        _bitrate = bitrate;
+        if (bitrate == 0) {
+            // All conversions shall return zero, like the generic functions.
+            _ns_per_bit = _bits_per_ns = _pcr_per_packet = 0.0;
+        }
+        else {
+            // The only divisions by the bitrate, until it changes again.
+            // The factors are computed and cached as double values: with integer
+            // or fixed-point bitrates, BitRate divisions would truncate the
+            // reciprocals (bits per nanosecond is zero below 1 Gb/s).
+            const double br = bitrate.toDouble();
+            _ns_per_bit = double(std::nano::den) / br;
+            _bits_per_ns = br / double(std::nano::den);
+            _pcr_per_packet = double(PKT_SIZE_BITS * SYSTEM_CLOCK_FREQ) / br;
+        }
+    }
+}
@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Precomputed reciprocal factors of a bitrate for pacing computations.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsTS.h"
+
+namespace ts {
+    //!
+    //! Precomputed reciprocal factors of a bitrate for repeated pacing computations.
+    //! @ingroup libtsduck mpeg
+    //!
+    //! Pacing loops (bitrate regulation, datagram timestamping) repeatedly convert
+    //! packet counts into durations and durations into bit counts at a bitrate which
+    //! rarely changes. The generic functions PacketInterval() or BitDistance() perform
+    //! one division by the bitrate on each call. This class performs the divisions
+    //! once, when the bitrate changes, and each conversion is then one multiplication.
+    //!
+    //! The cached factors are stored as double floating-point values, regardless of
+    //! the compile-time representation of BitRate. With integer or fixed-point
+    //! bitrates, a reciprocal such as "bits per nanosecond" would truncate to zero
+    //! below 1 Gb/s if it were stored as a BitRate value.
+    //!
+    //! The results may differ from the generic functions by a few units because of
+    //! the rounding of the cached factors. This is invisible to pacing loops, which
+    //! absorb rounding over their measurement periods, but this class should not be
+    //! used where exact arithmetic matters.
+    //!
+    class TSDUCKDLL BitRateReciprocal
+    {
+    public:
+        //!
+        //! Default constructor, with a zero bitrate (all conversions return zero).
+        //!
+        BitRateReciprocal() = default;
+
+        //!
+        //! Constructor.
+        //! @param [in] bitrate TS bitrate in bits/second, based on 188-byte packets.
+        //!
+        explicit BitRateReciprocal(const BitRate& bitrate) { setBitRate(bitrate); }
+
+        //!
+        //! Set a new bitrate and recompute the cached reciprocal factors.
+        //! Do nothing when the bitrate is unchanged, so this method can be
+        //! called on each pacing cycle at no cost.
+        //! @param [in] bitrate TS bitrate in bits/second, based on 188-byte packets.
+        //!
+        void setBitRate(const BitRate& bitrate);
+
+        //!
+        //! Get the current bitrate.
+        //! @return A constant reference to the current bitrate.
+        //!
+        const BitRate& bitrate() const { return _bitrate; }
+
+        //!
+        //! Compute the interval between two packets, a batch of packets at a time.
+        //! @param [in] count Number of packets.
+        //! @return Transmission duration of @a count packets, zero when the bitrate is zero.
+        //!
+        cn::nanoseconds packetInterval(PacketCounter count) const
+        {
+            return cn::nanoseconds(cn::nanoseconds::rep(std::round(_ns_per_bit * double(count * PKT_SIZE_BITS))));
+        }
+
+        //!
+        //! Compute the transmission duration of a number of bytes.
+        //! @param [in] bytes Number of bytes.
+        //! @return Transmission duration of @a bytes bytes, zero when the bitrate is zero.
+        //!
+        cn::nanoseconds byteInterval(uint64_t bytes) const
+        {
+            return cn::nanoseconds(cn::nanoseconds::rep(std::round(_ns_per_bit * double(bytes * 8))));
+        }
+
+        //!
+        //! Compute the transmission duration of a number of packets in PCR units.
+        //! @param [in] count Number of packets.
+        //! @return Transmission duration of @a count packets in PCR units (27 MHz),
+        //! zero when the bitrate is zero.
+        //!
+        uint64_t packetPCRInterval(PacketCounter count) const
+        {
+            return uint64_t(std::round(_pcr_per_packet * double(count)));
+        }
+
+        //!
+        //! Compute the number of bits which are transmitted during a given duration.
+        //! @param [in] duration A duration in nanoseconds (its absolute value is used).
+        //! @return Number of bits during @a duration, zero when the bitrate is zero.
+        //!
+        int64_t bitsDuring(cn::nanoseconds duration) const
+        {
+            return int64_t(std::round(_bits_per_ns * double(duration.count() >= 0 ? duration.count() : -duration.count())));
+        }
+
+    private:
+        BitRate _bitrate = 0;          // Reference bitrate.
+        double _ns_per_bit = 0.0;      // Nanoseconds per transmitted bit.
+        double _bits_per_ns = 0.0;     // Transmitted bits per nanosecond.
+        double _pcr_per_packet = 0.0;  // PCR units (27 MHz) per transmitted packet.
+    };
+}
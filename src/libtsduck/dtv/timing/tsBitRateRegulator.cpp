@@ -68,6 +68,9 @@ void ts::BitRateRegulator::handleNewBitrate()
 {
     assert(_cur_bitrate > 0);
 
+    // Recompute the reciprocal factors which are used on each packet.
+    _reciprocal.setBitRate(_cur_bitrate);
+
     // Compute the number of packets per burst. Use the packets/burst from the command line or 1 by default.
     PacketCounter burst_pkt_max = _opt_burst == 0 ? 1 : _opt_burst;
 
@@ -91,6 +94,30 @@ void ts::BitRateRegulator::handleNewBitrate()
 }
 
 
+//----------------------------------------------------------------------------
+// Wait until the scheduled end of the current burst.
+//----------------------------------------------------------------------------
+
+void ts::BitRateRegulator::waitBurstEnd()
+{
+    if (_opt_precise) {
+        // High-precision pacing: sleep slightly short of the target, then spin
+        // on yield for the remainder. The sleep absorbs most of the wait time
+        // without consuming CPU, the spin tail removes the timer jitter.
+        constexpr cn::nanoseconds spin_tail = cn::microseconds(500);
+        if (_burst_duration > spin_tail) {
+            std::this_thread::sleep_until(_burst_end - spin_tail);
+        }
+        while (monotonic_time::clock::now() < _burst_end) {
+            std::this_thread::yield();
+        }
+    }
+    else {
+        std::this_thread::sleep_until(_burst_end);
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Process one packet in a regulated burst. Wait at end of burst.
 //----------------------------------------------------------------------------
@@ -102,12 +129,13 @@ void ts::BitRateRegulator::regulatePacket(bool& flush)
     cn::nanoseconds duration = cn::duration_cast<cn::nanoseconds>(now - otherPeriod().start);
 
     // Allowed bits in the total measurement period.
-    int64_t max_bits = BitDistance(1, _cur_bitrate, duration);
+    // Use the cached reciprocal of the bitrate to avoid one division per packet.
+    int64_t max_bits = _reciprocal.bitsDuring(duration);
 
     // While not enough bit credit for one packet, wait until end of current burst.
     while (otherPeriod().bits + currentPeriod().bits + int64_t(PKT_SIZE_BITS) > max_bits) {
         // Wait until scheduled end of burst.
-        std::this_thread::sleep_until(_burst_end);
+        waitBurstEnd();
         // Restart a new burst, use monotonic time.
         _burst_end += _burst_duration;
         // Flush current burst
@@ -115,7 +143,7 @@ void ts::BitRateRegulator::regulatePacket(bool& flush)
         // Update measurement period and bit credit.
         now = monotonic_time::clock::now();
         duration = cn::duration_cast<cn::nanoseconds>(now - otherPeriod().start);
-        max_bits = BitDistance(1, _cur_bitrate, duration);
+        max_bits = _reciprocal.bitsDuring(duration);
     }
 
     // Switch measurement period when necessary.
@@ -123,7 +151,7 @@ void ts::BitRateRegulator::regulatePacket(bool& flush)
         // The "other" period will disappear.
         // Credit unused bits from the other period to the current period.
         cn::nanoseconds cur_duration = cn::duration_cast<cn::nanoseconds>(currentPeriod().start - otherPeriod().start);
-        currentPeriod().bits -= BitDistance(1, _cur_bitrate, cur_duration) - otherPeriod().bits;
+        currentPeriod().bits -= _reciprocal.bitsDuring(cur_duration) - otherPeriod().bits;
         // Current period becomes the other period.
         _cur_period ^= 1;
         // Reset the new current period.
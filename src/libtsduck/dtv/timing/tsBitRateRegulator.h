@@ -12,7 +12,7 @@
 //----------------------------------------------------------------------------
 
 #pragma once
-#include "tsTS.h"
+#include "tsBitRateReciprocal.h"
 #include "tsReport.h"
 
 namespace ts {
@@ -51,6 +51,16 @@ namespace ts {
         //!
         void setFixedBitRate(const BitRate& bitrate) { _opt_bitrate = bitrate; }
 
+        //!
+        //! Enable or disable the high-precision pacing mode.
+        //! In this mode, the wait between two bursts combines a coarse system
+        //! sleep and a short busy-wait tail. This reduces the burst jitter from
+        //! the system timer precision (typically a few milliseconds) down to a
+        //! few microseconds, at the expense of a slightly higher CPU usage.
+        //! @param [in] precise True to enable the high-precision pacing mode.
+        //!
+        void setPrecise(bool precise) { _opt_precise = precise; }
+
         //!
         //! Start regulation, initialize all timers.
         //!
@@ -92,7 +102,9 @@ namespace ts {
         bool            _regulated = false;   // Currently regulated at known bitrate
         PacketCounter   _opt_burst = 0;       // Number of packets to burst at a time
         BitRate         _opt_bitrate = 0;     // Bitrate option, zero means use input
+        bool            _opt_precise = false; // High-precision pacing with a busy-wait tail
         BitRate         _cur_bitrate = 0;     // Current bitrate
+        BitRateReciprocal _reciprocal {};     // Cached reciprocal factors of the current bitrate
         cn::nanoseconds _burst_min {0};       // Minimum delay between two bursts
         cn::nanoseconds _burst_duration {0};  // Delay between two bursts
         monotonic_time  _burst_end {};        // End of current burst
@@ -110,5 +122,8 @@ namespace ts {
 
         // Process one packet in a regulated burst. Wait at end of burst.
         void regulatePacket(bool& flush);
+
+        // Wait until the scheduled end of the current burst.
+        void waitBurstEnd();
     };
 }
@@ -245,11 +245,11 @@ bool ts::PCRAnalyzer::feedPacket(const TSPacket& pkt)
         }
     }
 
-    // Process PCR (or DTS)
-    if ((_use_dts && pkt.hasDTS()) || (!_use_dts && pkt.hasPCR())) {
-
-        // Get PCR value (or DTS)
-        const uint64_t pcr_dts = _use_dts ? pkt.getDTS() : pkt.getPCR();
+    // Process PCR (or DTS). Get the value once: the accessors return an
+    // invalid value marker when the field is absent, re-checking with
+    // has*() would parse the packet headers a second time.
+    const uint64_t pcr_dts = _use_dts ? pkt.getDTS() : pkt.getPCR();
+    if (pcr_dts != (_use_dts ? INVALID_DTS : INVALID_PCR)) {
 
         // Get increment since last value, in PCR units.
         const uint64_t pcr_increment = ps.last_pcr_dts_value == INVALID_PCR ? 0 : (_use_dts ?
@@ -65,7 +65,10 @@ void ts::PCRRegulator::reset()
 bool ts::PCRRegulator::regulate(const TSPacket& pkt)
 {
     const PID pid = pkt.getPID();
-    const bool has_pcr = pkt.hasPCR();
+    // Get the PCR once, INVALID_PCR means none. Calling hasPCR() and then
+    // getPCR() would parse the adaptation field twice.
+    const uint64_t pcr = pkt.getPCR();
+    const bool has_pcr = pcr != INVALID_PCR;
     bool flush = false;
 
     // Select first PID with PCR's when unspecified by user.
@@ -77,9 +80,7 @@ bool ts::PCRRegulator::regulate(const TSPacket& pkt)
     // Do something only on PCR's from the reference PID.
     if (has_pcr && pid == _pid) {
 
-        // PCR value, this is the reference system clock.
-        const uint64_t pcr = pkt.getPCR();
-
+        // The PCR value is the reference system clock.
         // Check if the PCR sequence seems valid.
         // We check that the difference between two PCR's is less than 2 seconds.
         // Normally, adjacent PCR's are way much closer, but let's be tolerant.
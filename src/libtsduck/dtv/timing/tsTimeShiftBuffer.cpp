@@ -102,6 +102,12 @@ bool ts::TimeShiftBuffer::open(Report& report)
             return false;
         }
 
+        // Reserve the final size of the ring file upfront, when the filesystem
+        // supports it. The file is cyclically rewritten in place and never grows
+        // beyond the buffer size. Allocating its extents at once keeps the file
+        // contiguous and avoids allocation stalls at each wrap-around.
+        _file.preallocate(_total_packets, report);
+
         // The read and write buffers use half of memory quota each.
         // Since the size of the file is larger than the sum of the two,
         // the read and write caches never overlap when the buffer is full.
@@ -178,11 +184,21 @@ bool ts::TimeShiftBuffer::shift(TSPacket& packet, TSPacketMetadata& mdata, Repor
     else {
         // The buffer uses a backup file.
         if (!was_full) {
-            // While the buffer is not full, simply write the packet in the file.
-            if (!_file.writePackets(&packet, &mdata, 1, report)) {
-                return false;
-            }
+            // While the buffer is not full, accumulate the packets in the write
+            // cache and flush it in large batches, avoiding one system call per
+            // packet during the whole filling phase.
+            _wcache[_wcache_next] = packet;
+            _wmdata[_wcache_next++] = mdata;
             _cur_packets++;
+            // Flush the write cache when full or when the buffer just becomes
+            // full (the steady-state logic expects a fully written file).
+            if (_wcache_next >= _wcache.size() || full()) {
+                const size_t file_index = _next_write + 1 - _wcache_next;
+                if (!writeFile(file_index, &_wcache[0], &_wmdata[0], _wcache_next, report)) {
+                    return false;
+                }
+                _wcache_next = 0;
+            }
         }
         else {
             // The buffer is full, now read and write in caches.
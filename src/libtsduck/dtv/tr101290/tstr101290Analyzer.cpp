@@ -59,8 +59,9 @@ void ts::tr101290::Analyzer::reset()
     _demux.reset();
     _demux.setPIDFilter(AllPIDs());
     _continuity.reset();
-    _pids.clear();
+    _pids.assign(PID_MAX, PIDContext());
     _xtids.clear();
+    publishCounters();
 }
 
 
@@ -70,7 +71,11 @@ void ts::tr101290::Analyzer::reset()
 
 void ts::tr101290::Analyzer::logError(const UString& reference, ErrorCounter error, PID context)
 {
-    logError(reference, error, UString::Format(u"PID %n", context));
+    // Format the context string only when something will use it.
+    // Raising an error shall not allocate anything in the packet processing path.
+    if (_error_handler != nullptr || _duck.report().debug()) {
+        logError(reference, error, UString::Format(u"PID %n", context));
+    }
 }
 
 void ts::tr101290::Analyzer::logError(const UString& reference, ErrorCounter error, const UString& context)
@@ -83,7 +88,11 @@ void ts::tr101290::Analyzer::logError(const UString& reference, ErrorCounter err
 
 void ts::tr101290::Analyzer::setError(const UString& reference, ErrorCounter error, PID context)
 {
-    setError(reference, error, UString::Format(u"PID %n", context));
+    assert(int(error) >= 0);
+    assert(error < COUNTER_COUNT);
+
+    _counters_flags[error] = true;
+    logError(reference, error, context);
 }
 
 void ts::tr101290::Analyzer::setError(const UString& reference, ErrorCounter error, const UString& context)
@@ -97,7 +106,11 @@ void ts::tr101290::Analyzer::setError(const UString& reference, ErrorCounter err
 
 void ts::tr101290::Analyzer::addError(const UString& reference, ErrorCounter error, PID context, Counters& counters)
 {
-    addError(reference, error, UString::Format(u"PID %n", context), counters);
+    assert(int(error) >= 0);
+    assert(error < COUNTER_COUNT);
+
+    counters[error]++;
+    logError(reference, error, context);
 }
 
 void ts::tr101290::Analyzer::addError(const UString& reference, ErrorCounter error, const UString& context, Counters& counters)
@@ -230,12 +243,56 @@ void ts::tr101290::Analyzer::feedPacket(const PCR& timestamp, const TSPacket& pk
     _counters.increment(_counters_flags);
     _counters[packet_count]++;
 
+    // Republish the counters for lock-free readers.
+    publishCounters();
+
     // Must be set last.
     pidctx.last_timestamp = timestamp;
     _last_timestamp = timestamp;
 }
 
 
+//----------------------------------------------------------------------------
+// Publish the live counters into the lock-free snapshot.
+//----------------------------------------------------------------------------
+
+void ts::tr101290::Analyzer::publishCounters()
+{
+    // Standard seqlock write sequence. The two increments are sequentially consistent
+    // read-modify-write operations: the stores into the snapshot cannot be reordered
+    // before the first one (acquire part) or after the second one (release part).
+    _snapshot_seq.fetch_add(1);
+    for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+        _snapshot[i].store(_counters[i], std::memory_order_relaxed);
+    }
+    _snapshot_seq.fetch_add(1);
+}
+
+
+//----------------------------------------------------------------------------
+// Get a lock-free snapshot of the error counters.
+//----------------------------------------------------------------------------
+
+void ts::tr101290::Analyzer::getCountersSnapshot(Counters& counters) const
+{
+    // Standard seqlock read sequence: retry as long as an update was in progress
+    // (odd sequence number) or occurred during the copy (changed sequence number).
+    for (;;) {
+        const uint32_t seq = _snapshot_seq.load(std::memory_order_acquire);
+        if ((seq & 1) == 0) {
+            for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+                counters[i] = _snapshot[i].load(std::memory_order_relaxed);
+            }
+            // Make sure the snapshot was read before rechecking the sequence number.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_snapshot_seq.load(std::memory_order_relaxed) == seq) {
+                return;
+            }
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Invoked by the SectionDemux when a complete table is available.
 //----------------------------------------------------------------------------
@@ -308,13 +365,13 @@ void ts::tr101290::Analyzer::handlePAT(const PAT& pat, PID pid)
     }
 
     // Remove all references to undefined services in all PID's.
-    for (auto& it1 : _pids) {
-        for (auto it2 = it1.second.services.begin(); it2 != it1.second.services.end(); ) {
-            if (services.contains(*it2)) {
-                it2++;
+    for (auto& ctx : _pids) {
+        for (auto it = ctx.services.begin(); it != ctx.services.end(); ) {
+            if (services.contains(*it)) {
+                it++;
             }
             else {
-                it2 = it1.second.services.erase(it2);
+                it = ctx.services.erase(it);
             }
         }
     }
@@ -716,6 +773,7 @@ void ts::tr101290::Analyzer::getCountersRestart(Counters& counters)
 {
     getCounters(counters);
     _counters.clear();
+    publishCounters();
 }
 
 void ts::tr101290::Analyzer::getCounters(Counters& counters)
@@ -727,20 +785,19 @@ void ts::tr101290::Analyzer::getCounters(Counters& counters)
         // Unreferenced PID's are detected here. The error can be persistent over cycles
         // of getCountersRestart() and should not be reset.
         counters[Unreferenced_PID] = 0;
-        for (const auto& it : _pids) {
+        for (PID pid = PID_DVB_LAST + 1; pid < PID_NULL; ++pid) {
+            const PIDContext& ctx(_pids[pid]);
             // Check if PID is unreferenced and present for more than the max time.
-            if (it.first > PID_DVB_LAST &&
-                it.first < PID_NULL &&
-                it.second.type != PIDClass::EMM &&
-                it.second.services.empty() &&
-                it.second.first_timestamp >= PCR::zero() &&
-                (_last_timestamp - it.second.first_timestamp) > _max_pid_reference_interval)
+            if (ctx.type != PIDClass::EMM &&
+                ctx.services.empty() &&
+                ctx.first_timestamp >= PCR::zero() &&
+                (_last_timestamp - ctx.first_timestamp) > _max_pid_reference_interval)
             {
                 // [[3.4]] Unreferenced_PID: PID (other than PAT, CAT, CAT_PIDs, PMT_PIDs, NIT_PID, SDT_PID, TDT_PID, EIT_PID, RST_PID, reserved_for_future_use PIDs, or PIDs user defined as private data streams) not referred to by a PMT within 0,5 s.
-                addError(u"3.4", Unreferenced_PID, it.first, counters);
+                addError(u"3.4", Unreferenced_PID, pid, counters);
                 // [[3.4.a]] Unreferenced_PID: PID (other than PMT_PIDs, PIDs with numbers between 0x00 and 0x1F or PIDs user defined as private data streams) not referred to by a PMT or a CAT within 0,5 s.
                 // Note: 3.4.a is a superset of 3.4 but they both refer to the same error Unreferenced_PID, so don't increment again.
-                logError(u"3.4.a", Unreferenced_PID, it.first);
+                logError(u"3.4.a", Unreferenced_PID, pid);
             }
         }
 
@@ -755,10 +812,11 @@ void ts::tr101290::Analyzer::getCounters(Counters& counters)
         }
 
         // Check user PID's (audio, video, etc.) repetition.
-        for (const auto& it : _pids) {
-            if (it.second.user_pid && it.second.last_timestamp >= PCR::zero() && (_last_timestamp - it.second.last_timestamp) > _max_pid_interval) {
+        for (PID pid = 0; pid < PID_MAX; ++pid) {
+            const PIDContext& ctx(_pids[pid]);
+            if (ctx.user_pid && ctx.last_timestamp >= PCR::zero() && (_last_timestamp - ctx.last_timestamp) > _max_pid_interval) {
                 // [[1.6]] PID_error: Referred PID does not occur for a user specified period.
-                addError(u"1.6", PID_error, it.first, counters);
+                addError(u"1.6", PID_error, pid, counters);
             }
         }
 
@@ -95,6 +95,18 @@ namespace ts::tr101290 {
         //!
         void getCountersRestart(Counters& counters);
 
+        //!
+        //! Get a lock-free snapshot of the error counters since start or the last getCountersRestart().
+        //! Unlike getCounters(), this method can be safely called from another thread than the one
+        //! which feeds the analyzer, typically a thread which periodically exports the counters to
+        //! a monitoring system. The returned counters are consistent as a whole and reflect the
+        //! state after the last processed packet. However, the time-based checks which getCounters()
+        //! performs at the time of the call (repetition timeouts, unreferenced PID's) are not
+        //! evaluated here because they need an access to the complete analyzer state.
+        //! @param [out] counters Returned error counters.
+        //!
+        void getCountersSnapshot(Counters& counters) const;
+
         //!
         //! Set the maximum packet interval in "user PID's" before declaring PID_error.
         //! This value currently applies to video and audio PID's only.
@@ -159,8 +171,14 @@ namespace ts::tr101290 {
         CounterFlags           _counters_flags {};
         SectionDemux           _demux {_duck, this, this};
         ContinuityAnalyzer     _continuity {AllPIDs()};
-        std::map<PID,PIDContext>   _pids {};
-        std::map<XTID,XTIDContext> _xtids {};
+        std::vector<PIDContext>    _pids {};   // Directly indexed by PID, no lookup in the packet path.
+        std::map<XTID,XTIDContext> _xtids {};  // Only accessed at section rate, not at packet rate.
+
+        // The live counters are republished after each packet into this snapshot, using a seqlock:
+        // the sequence number is incremented before and after each update and is therefore odd while
+        // an update is in progress. See getCountersSnapshot() and publishCounters().
+        std::atomic<uint32_t> _snapshot_seq {0};
+        std::array<std::atomic<size_t>, COUNTER_COUNT> _snapshot {};
 
         // These min / max intervals can be made configurable if necessary.
         PCR _max_pat_interval           = cn::duration_cast<PCR>(MAX_PAT_INTERVAL);
@@ -199,6 +217,9 @@ namespace ts::tr101290 {
         // Declare ECM PID's in a descriptor list as part of a service.
         void searchECMPIDs(const DescriptorList& descs, uint16_t service_id);
 
+        // Publish the live counters into the lock-free snapshot.
+        void publishCounters();
+
         // Processing of detected errors.
         void logError(const UString& reference, ErrorCounter error, const UString& context);
         void setError(const UString& reference, ErrorCounter error, const UString& context);
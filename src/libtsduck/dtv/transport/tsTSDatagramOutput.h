@@ -13,6 +13,7 @@
 
 #pragma once
 #include "tsTSDatagramOutputHandlerInterface.h"
+#include "tsBitRateReciprocal.h"
 #include "tsTSPacket.h"
 #include "tsTSPacketMetadata.h"
 #include "tsUDPSocket.h"
@@ -144,6 +145,7 @@ namespace ts {
         bool            _mc_loopback = true;         // Multicast loopback option
         bool            _force_mc_local = false;     // Force multicast outgoing local interface
         size_t          _send_bufsize = 0;           // Socket send buffer size.
+        size_t          _send_batch = 0;             // Datagrams per sendmmsg() batch, 0 or 1 for none.
 
         // Working data.
         bool            _is_open = false;            // Currently in progress
@@ -153,6 +155,7 @@ namespace ts {
         uint64_t        _last_pcr = INVALID_PCR;     // Last PCR value in PCR PID
         uint64_t        _last_rtp_pcr = INVALID_PCR; // Last RTP timestamp in PCR units (in last datagram)
         PacketCounter   _last_rtp_pcr_pkt = 0;       // Packet index of last datagram
+        BitRateReciprocal _rtp_pacing {};            // Cached reciprocal of the bitrate for RTP timestamp extrapolation
         uint64_t        _rtp_pcr_offset = 0;         // Value to substract from PCR to get RTP timestamp
         PacketCounter   _pkt_count = 0;              // Total packet counter for output packets
         size_t          _out_count = 0;              // Number of packets in _out_buffer
@@ -10,6 +10,8 @@
 #include "tsTSPacketMetadata.h"
 #include "tsNullReport.h"
 #include "tsSysUtils.h"
+#include "tsByteBlock.h"
+#include "tsMemory.h"
 
 #if defined(TS_WINDOWS)
     #include "tsBeforeStandardHeaders.h"
@@ -19,11 +21,484 @@
     #include "tsBeforeStandardHeaders.h"
     #include <sys/types.h>
     #include <sys/stat.h>
+    #include <sys/mman.h>
     #include <unistd.h>
+    #include <fcntl.h>
+    #if defined(TS_LINUX)
+        #include <sys/syscall.h>
+        #if defined(__NR_io_uring_setup)
+            #include <linux/io_uring.h>
+            #define TS_TSFILE_IO_URING 1
+        #endif
+    #endif
     #include "tsAfterStandardHeaders.h"
 #endif
 
 
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine, based on io_uring on Linux.
+//----------------------------------------------------------------------------
+
+// The engine maintains a fixed pool of large blocks and keeps several of
+// them "in flight" in the kernel submission queue. In read mode, the file
+// is read ahead of the application. In write mode, the data are copied in
+// a free block and the write is posted, the application does not wait for
+// the actual disk write. The blocks always complete in submission order
+// from the application's point of view because we dequeue them in order.
+// The engine is used on regular files only, where a given range of the
+// file can be addressed by offset, so that the strict sequential semantics
+// of TSFile are preserved even though the kernel may reorder operations.
+
+class ts::TSFileAsyncEngine
+{
+    TS_NOCOPY(TSFileAsyncEngine);
+public:
+    // Constructor and destructor.
+    TSFileAsyncEngine() = default;
+    ~TSFileAsyncEngine();
+
+    // Initialize the engine on an open file descriptor, at the given initial byte offset.
+    // Return false when asynchronous I/O are not available (not an error, use synchronous I/O).
+    bool init(int fd, bool write_mode, uint64_t offset, Report& report);
+
+    // Read some data, at most max_size bytes. Return true on success (ret_size is zero at end of file).
+    bool read(void* addr, size_t max_size, size_t& ret_size, int severity, const UString& display_name, Report& report);
+
+    // Post the write of a buffer. The data are copied, the caller's buffer can be immediately reused.
+    bool write(const void* addr, size_t size, int severity, const UString& display_name, Report& report);
+
+    // Wait for the completion of all outstanding operations. Report write errors.
+    bool flush(int severity, const UString& display_name, Report& report);
+
+    // Restart reading at the given absolute byte offset. Wait for outstanding operations first.
+    bool reposition(uint64_t offset, Report& report);
+
+private:
+#if defined(TS_TSFILE_IO_URING)
+    // Number of outstanding blocks and size of each block.
+    static constexpr unsigned int IO_BLOCK_COUNT = 8;
+    static constexpr size_t IO_BLOCK_SIZE = 256 * 1024;
+
+    // One I/O block. The result is the signed return value of the operation, meaningful when done.
+    class Block
+    {
+    public:
+        Block() = default;
+        ByteBlock data {};
+        uint64_t  offset = 0;
+        size_t    size = 0;
+        size_t    rd = 0;       // read pointer inside the block, in read mode
+        ssize_t   result = 0;
+        bool      done = false;
+    };
+
+    int       _ring_fd = -1;
+    int       _fd = -1;
+    bool      _write = false;
+    uint64_t  _next_offset = 0;      // file offset of the next block to submit
+    unsigned  _to_submit = 0;        // number of submitted but not yet flushed SQE's
+    bool      _write_error = false;  // a posted write failed
+    int       _write_errno = 0;      // errno of the first failed write
+
+    // Shared rings, mapped in the process (IORING_FEAT_SINGLE_MMAP).
+    uint8_t*  _ring = nullptr;
+    size_t    _ring_size = 0;
+    ::io_uring_sqe* _sqes = nullptr;
+    size_t    _sqes_size = 0;
+    unsigned* _sq_tail = nullptr;
+    unsigned  _sq_mask = 0;
+    unsigned* _sq_array = nullptr;
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned  _cq_mask = 0;
+    ::io_uring_cqe* _cqes = nullptr;
+
+    // Block pool. The deque contains the indexes of in-flight blocks, in submission order.
+    std::array<Block, IO_BLOCK_COUNT> _blocks {};
+    std::vector<size_t> _free {};
+    std::deque<size_t> _order {};
+
+    // Post the operation of one block (read at _next_offset in read mode, as preset in write mode).
+    void submitBlock(size_t index);
+
+    // Flush submissions to the kernel and optionally wait for at least one completion.
+    bool enter(unsigned int wait_count, Report& report);
+
+    // Collect all available completions, without waiting.
+    void reapCompletions();
+
+    // Wait until a given block completes.
+    bool waitBlock(size_t index, Report& report);
+
+    // Release the engine resources.
+    void shutdown();
+#endif
+};
+
+
+#if defined(TS_TSFILE_IO_URING)
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: Linux io_uring implementation.
+//----------------------------------------------------------------------------
+
+ts::TSFileAsyncEngine::~TSFileAsyncEngine()
+{
+    shutdown();
+}
+
+bool ts::TSFileAsyncEngine::init(int fd, bool write_mode, uint64_t offset, Report& report)
+{
+    // Create the ring. An old kernel without io_uring returns ENOSYS.
+    ::io_uring_params params;
+    TS_ZERO(params);
+    _ring_fd = int(::syscall(__NR_io_uring_setup, IO_BLOCK_COUNT, &params));
+    if (_ring_fd < 0) {
+        report.debug(u"io_uring not available: %s", SysErrorCodeMessage());
+        return false;
+    }
+
+    // We only support the single mmap layout (kernel 5.4 and above).
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0) {
+        report.debug(u"io_uring single mmap layout not supported, using synchronous I/O");
+        ::close(_ring_fd);
+        _ring_fd = -1;
+        return false;
+    }
+
+    // Map the submission and completion rings (one single area) and the SQE array.
+    const size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    const size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+    _ring_size = std::max(sq_size, cq_size);
+    _sqes_size = params.sq_entries * sizeof(::io_uring_sqe);
+    void* ring = ::mmap(nullptr, _ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQ_RING);
+    void* sqes = ring == MAP_FAILED ? MAP_FAILED : ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQES);
+    if (ring == MAP_FAILED || sqes == MAP_FAILED) {
+        report.debug(u"io_uring mmap error: %s", SysErrorCodeMessage());
+        if (ring != MAP_FAILED) {
+            ::munmap(ring, _ring_size);
+        }
+        ::close(_ring_fd);
+        _ring_fd = -1;
+        return false;
+    }
+    _ring = reinterpret_cast<uint8_t*>(ring);
+    _sqes = reinterpret_cast<::io_uring_sqe*>(sqes);
+    _sq_tail = reinterpret_cast<unsigned int*>(_ring + params.sq_off.tail);
+    _sq_mask = *reinterpret_cast<unsigned int*>(_ring + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned int*>(_ring + params.sq_off.array);
+    _cq_head = reinterpret_cast<unsigned int*>(_ring + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned int*>(_ring + params.cq_off.tail);
+    _cq_mask = *reinterpret_cast<unsigned int*>(_ring + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<::io_uring_cqe*>(_ring + params.cq_off.cqes);
+
+    // Allocate the block pool, all blocks are initially free.
+    _fd = fd;
+    _write = write_mode;
+    _next_offset = offset;
+    _free.clear();
+    _order.clear();
+    for (size_t i = 0; i < IO_BLOCK_COUNT; ++i) {
+        _blocks[i].data.resize(IO_BLOCK_SIZE);
+        _free.push_back(i);
+    }
+    return true;
+}
+
+void ts::TSFileAsyncEngine::shutdown()
+{
+    if (_ring_fd >= 0) {
+        // Wait for in-flight operations, their buffers must remain valid until completion.
+        while (!_order.empty()) {
+            if (!waitBlock(_order.front(), NULLREP)) {
+                break; // cannot wait, give up (the process is likely terminating)
+            }
+            _order.pop_front();
+        }
+        ::munmap(_sqes, _sqes_size);
+        ::munmap(_ring, _ring_size);
+        ::close(_ring_fd);
+        _ring_fd = -1;
+        _ring = nullptr;
+        _sqes = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: ring management.
+//----------------------------------------------------------------------------
+
+void ts::TSFileAsyncEngine::submitBlock(size_t index)
+{
+    Block& blk(_blocks[index]);
+    blk.done = false;
+    blk.result = 0;
+    blk.rd = 0;
+
+    // There is always a free SQE slot since we never have more than IO_BLOCK_COUNT in flight.
+    const unsigned int tail = *_sq_tail;
+    const unsigned int slot = tail & _sq_mask;
+    ::io_uring_sqe& sqe(_sqes[slot]);
+    TS_ZERO(sqe);
+    sqe.opcode = _write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe.fd = _fd;
+    sqe.addr = uint64_t(reinterpret_cast<uintptr_t>(blk.data.data()));
+    sqe.len = uint32_t(blk.size);
+    sqe.off = blk.offset;
+    sqe.user_data = uint64_t(index);
+    _sq_array[slot] = slot;
+
+    // Publish the new tail to the kernel.
+    __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    _to_submit++;
+    _order.push_back(index);
+}
+
+bool ts::TSFileAsyncEngine::enter(unsigned int wait_count, Report& report)
+{
+    for (;;) {
+        const int ret = int(::syscall(__NR_io_uring_enter, _ring_fd, _to_submit, wait_count, wait_count > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+        if (ret >= 0) {
+            _to_submit -= std::min(unsigned(ret), _to_submit);
+            return true;
+        }
+        else if (errno != EINTR) {
+            report.debug(u"io_uring_enter error: %s", SysErrorCodeMessage());
+            return false;
+        }
+    }
+}
+
+void ts::TSFileAsyncEngine::reapCompletions()
+{
+    unsigned int head = *_cq_head;
+    const unsigned int tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+        const ::io_uring_cqe& cqe(_cqes[head & _cq_mask]);
+        const size_t index = size_t(cqe.user_data);
+        if (index < IO_BLOCK_COUNT) {
+            _blocks[index].result = ssize_t(cqe.res);
+            _blocks[index].done = true;
+        }
+        head++;
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+}
+
+bool ts::TSFileAsyncEngine::waitBlock(size_t index, Report& report)
+{
+    reapCompletions();
+    while (!_blocks[index].done) {
+        if (!enter(1, report)) {
+            return false;
+        }
+        reapCompletions();
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: read some data.
+//----------------------------------------------------------------------------
+
+bool ts::TSFileAsyncEngine::read(void* addr, size_t max_size, size_t& ret_size, int severity, const UString& display_name, Report& report)
+{
+    ret_size = 0;
+
+    // Keep the read-ahead pipeline full and flush the submissions.
+    while (!_free.empty()) {
+        const size_t index = _free.back();
+        _free.pop_back();
+        _blocks[index].offset = _next_offset;
+        _blocks[index].size = IO_BLOCK_SIZE;
+        _next_offset += IO_BLOCK_SIZE;
+        submitBlock(index);
+    }
+    if (_to_submit > 0 && !enter(0, report)) {
+        return false;
+    }
+
+    // Wait for the oldest block.
+    assert(!_order.empty());
+    const size_t index = _order.front();
+    if (!waitBlock(index, report)) {
+        return false;
+    }
+    Block& blk(_blocks[index]);
+
+    if (blk.result < 0) {
+        report.log(severity, u"error reading %s: %s", display_name, SysErrorCodeMessage(int(-blk.result)));
+        return false;
+    }
+    if (blk.result == 0) {
+        // End of file. Recycle the block, the caller will stop or reposition.
+        _order.pop_front();
+        _free.push_back(index);
+        return true;
+    }
+
+    // Deliver data from the block.
+    const size_t avail = size_t(blk.result) - blk.rd;
+    ret_size = std::min(max_size, avail);
+    MemCopy(addr, blk.data.data() + blk.rd, ret_size);
+    blk.rd += ret_size;
+
+    // When the block is exhausted, recycle it. After a short read (end of file or
+    // growing file), the blocks which were posted beyond the short read would skip
+    // the missing bytes, restart the read-ahead right after the last byte we got.
+    if (blk.rd >= size_t(blk.result)) {
+        const bool short_read = size_t(blk.result) < blk.size;
+        const uint64_t next = blk.offset + uint64_t(blk.result);
+        _order.pop_front();
+        _free.push_back(index);
+        if (short_read && !reposition(next, report)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: post the write of a buffer.
+//----------------------------------------------------------------------------
+
+bool ts::TSFileAsyncEngine::write(const void* addr, size_t size, int severity, const UString& display_name, Report& report)
+{
+    const char* data = reinterpret_cast<const char*>(addr);
+
+    while (size > 0 && !_write_error) {
+
+        // Recycle completed blocks, check their results.
+        reapCompletions();
+        while (!_order.empty() && _blocks[_order.front()].done) {
+            const Block& blk(_blocks[_order.front()]);
+            if (blk.result < 0 || size_t(blk.result) != blk.size) {
+                _write_error = true;
+                _write_errno = blk.result < 0 ? int(-blk.result) : ENOSPC;
+            }
+            _free.push_back(_order.front());
+            _order.pop_front();
+        }
+
+        // When all blocks are in flight, wait for the oldest one.
+        if (_free.empty()) {
+            if (!waitBlock(_order.front(), report)) {
+                return false;
+            }
+            continue;
+        }
+
+        // Copy a chunk of data in a free block and post its write.
+        const size_t index = _free.back();
+        _free.pop_back();
+        Block& blk(_blocks[index]);
+        const size_t chunk = std::min(size, IO_BLOCK_SIZE);
+        MemCopy(blk.data.data(), data, chunk);
+        blk.offset = _next_offset;
+        blk.size = chunk;
+        _next_offset += chunk;
+        submitBlock(index);
+        data += chunk;
+        size -= chunk;
+    }
+
+    // Flush the submissions, do not wait for completions.
+    if (_to_submit > 0 && !enter(0, report)) {
+        return false;
+    }
+    if (_write_error) {
+        if (_write_errno != EPIPE) {
+            report.log(severity, u"error writing %s: %s", display_name, SysErrorCodeMessage(_write_errno));
+        }
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: wait for all outstanding operations.
+//----------------------------------------------------------------------------
+
+bool ts::TSFileAsyncEngine::flush(int severity, const UString& display_name, Report& report)
+{
+    while (!_order.empty()) {
+        const size_t index = _order.front();
+        if (!waitBlock(index, report)) {
+            return false;
+        }
+        const Block& blk(_blocks[index]);
+        if (_write && !_write_error && (blk.result < 0 || size_t(blk.result) != blk.size)) {
+            _write_error = true;
+            _write_errno = blk.result < 0 ? int(-blk.result) : ENOSPC;
+        }
+        _free.push_back(index);
+        _order.pop_front();
+    }
+    if (_write && _write_error) {
+        if (_write_errno != EPIPE) {
+            report.log(severity, u"error writing %s: %s", display_name, SysErrorCodeMessage(_write_errno));
+        }
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: restart reading at an absolute byte offset.
+//----------------------------------------------------------------------------
+
+bool ts::TSFileAsyncEngine::reposition(uint64_t offset, Report& report)
+{
+    // Wait for in-flight operations and discard their content.
+    while (!_order.empty()) {
+        if (!waitBlock(_order.front(), report)) {
+            return false;
+        }
+        _free.push_back(_order.front());
+        _order.pop_front();
+    }
+    _next_offset = offset;
+    return true;
+}
+
+#else
+
+//----------------------------------------------------------------------------
+// Asynchronous I/O engine: stub on platforms without a supported interface.
+//----------------------------------------------------------------------------
+
+ts::TSFileAsyncEngine::~TSFileAsyncEngine()
+{
+}
+
+bool ts::TSFileAsyncEngine::init(int, bool, uint64_t, Report&)
+{
+    return false;
+}
+
+bool ts::TSFileAsyncEngine::read(void*, size_t, size_t&, int, const UString&, Report&)
+{
+    return false;
+}
+
+bool ts::TSFileAsyncEngine::write(const void*, size_t, int, const UString&, Report&)
+{
+    return false;
+}
+
+bool ts::TSFileAsyncEngine::flush(int, const UString&, Report&)
+{
+    return false;
+}
+
+bool ts::TSFileAsyncEngine::reposition(uint64_t, Report&)
+{
+    return false;
+}
+
+#endif
+
+
 //----------------------------------------------------------------------------
 // Constructors and destructors.
 //----------------------------------------------------------------------------
@@ -51,10 +526,25 @@ ts::TSFile::TSFile(TSFile&& other) noexcept :
     _rewindable(other._rewindable),
     _regular(other._regular),
     _std_inout(other._std_inout),
+    _async_req(other._async_req),
+    _mmap_req(other._mmap_req),
+    _compress_level(other._compress_level),
+    _zchecked(other._zchecked),
+    _zin_eof(other._zin_eof),
+    _zin_next(other._zin_next),
+    _zin_size(other._zin_size),
+    _zin(std::move(other._zin)),
+    _zout(std::move(other._zout)),
+    _zlib(std::move(other._zlib)),
+    _async(std::move(other._async)),
 #if defined(TS_WINDOWS)
     _handle(other._handle)
 #else
-    _fd(other._fd)
+    _fd(other._fd),
+    _mmap_base(other._mmap_base),
+    _mmap_size(other._mmap_size),
+    _mmap_pos(other._mmap_pos),
+    _mmap_advised(other._mmap_advised)
 #endif
 {
     // Mark other object as closed, just in case.
@@ -63,6 +553,8 @@ ts::TSFile::TSFile(TSFile&& other) noexcept :
     other._handle = INVALID_HANDLE_VALUE;
 #else
     other._fd = -1;
+    other._mmap_base = nullptr;
+    other._mmap_size = 0;
 #endif
 }
 
@@ -306,8 +798,11 @@ bool ts::TSFile::openInternal(bool reopen, Report& report)
     int uflags = O_LARGEFILE;
     const mode_t mode = 0666; // -rw-rw-rw (minus umask)
 
-    // Close first if this is a reopen.
+    // Close first if this is a reopen. Stop the asynchronous engine first,
+    // it waits for in-flight operations which reference the file descriptor.
     if (reopen) {
+        _async.reset();
+        unmapFile();
         ::close(_fd);
         _fd = -1;
     }
@@ -379,6 +874,34 @@ bool ts::TSFile::openInternal(bool reopen, Report& report)
         return false;
     }
 
+    // Create the asynchronous I/O engine when requested and usable: regular files only,
+    // in read-only or write-only mode (the engine addresses the file by absolute offsets,
+    // in one single direction). On failure, silently keep the synchronous implementation.
+    if (_async_req && _regular && !_std_inout && (read_only || !read_access)) {
+        const off_t current = ::lseek(_fd, 0, SEEK_CUR);
+        auto engine = std::make_unique<TSFileAsyncEngine>();
+        if (current != off_t(-1) && engine->init(_fd, !read_access, uint64_t(current), report)) {
+            _async = std::move(engine);
+        }
+    }
+
+    // Map the file in memory when requested and usable: regular files only, read-only
+    // mode, not already handled by the asynchronous engine. On failure, silently keep
+    // the standard read() implementation.
+    if (_mmap_req && _async == nullptr && _regular && !_std_inout && read_only && st.st_size > 0) {
+        void* const base = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, _fd, 0);
+        if (base == MAP_FAILED) {
+            report.debug(u"mmap failed on %s, using standard input: %s", getDisplayFileName(), SysErrorCodeMessage());
+        }
+        else {
+            _mmap_base = reinterpret_cast<uint8_t*>(base);
+            _mmap_size = size_t(st.st_size);
+            _mmap_pos = _mmap_advised = _start_offset;
+            // Declare the global sequential pattern, the kernel enlarges its readahead.
+            ::madvise(base, _mmap_size, MADV_SEQUENTIAL);
+        }
+    }
+
 #endif
 
     // Reset counters only if not a reopen.
@@ -386,11 +909,23 @@ bool ts::TSFile::openInternal(bool reopen, Report& report)
         _total_read = _total_write = 0;
     }
 
-    // Clean initial state.
+    // Clean initial state. In read mode, the compression detection is redone on the first read.
+    resetCompression();
     _aborted = false;
     _at_eof = false;
     _is_open = true;
 
+    // In write mode, create the compression stream when requested.
+    if (write_access && _compress_level >= 0) {
+        _zlib = std::make_unique<ZlibStream>();
+        if (!_zlib->openDeflate(_compress_level, report)) {
+            _zlib.reset();
+            close(report);
+            return false;
+        }
+        _zchecked = true;
+    }
+
     // In write mode, write initial null packets.
     if (write_access && !reopen && _open_null > 0 && !writeStuffing(_open_null, report)) {
         close(report);
@@ -432,6 +967,13 @@ bool ts::TSFile::seekCheck(Report& report)
 
 bool ts::TSFile::seekInternal(uint64_t index, Report& report)
 {
+    // A compressed file cannot be seeked at an arbitrary position.
+    // Rewinding to the start of the file restarts the decompression (below).
+    if (_zlib != nullptr && (_flags & READ) != 0 && index != 0) {
+        report.log(_severity, u"file %s is compressed, cannot seek at an arbitrary position", getDisplayFileName());
+        return false;
+    }
+
     // If seeking at the beginning and REOPEN is set, close and reopen the file.
     if (index == 0 && (_flags & REOPEN) != 0) {
         return openInternal(true, report);
@@ -451,6 +993,25 @@ bool ts::TSFile::seekInternal(uint64_t index, Report& report)
         return false;
     }
     else {
+        if (_async != nullptr && !_async->reposition(_start_offset + index, report)) {
+            return false;
+        }
+#if !defined(TS_WINDOWS)
+        if (_mmap_base != nullptr) {
+            // Move the read position in the mapping and restart the advised window.
+            _mmap_pos = _mmap_advised = _start_offset + index;
+        }
+#endif
+        if (index == 0) {
+            // Rewind: restart the compression detection and decompression from the start.
+            resetCompression();
+        }
+        else {
+            // Discard data which were buffered ahead of the previous position.
+            // Never detect a compressed file from the middle of it.
+            _zin_next = _zin_size = 0;
+            _zchecked = true;
+        }
         _at_eof = false;
         return true;
     }
@@ -477,6 +1038,79 @@ bool ts::TSFile::seek(PacketCounter packet_index, Report& report)
 }
 
 
+//----------------------------------------------------------------------------
+// Preallocate disk space for a file which is open in write mode.
+//----------------------------------------------------------------------------
+
+bool ts::TSFile::preallocate(PacketCounter packet_count, Report& report)
+{
+    if (!_is_open) {
+        report.log(_severity, u"not open");
+        return false;
+    }
+    else if ((_flags & WRITE) == 0 || !_regular || _zlib != nullptr) {
+        // Preallocation is meaningful on uncompressed regular files in write mode only.
+        return false;
+    }
+
+    const uint64_t size = _start_offset + packet_count * (packetHeaderSize() + PKT_SIZE);
+
+#if defined(TS_WINDOWS)
+
+    // Windows has no explicit preallocation in user mode. Extending the end
+    // of file upfront at least lets the filesystem reserve the final size.
+    ::LARGE_INTEGER pos, saved;
+    pos.QuadPart = 0;
+    if (::SetFilePointerEx(_handle, pos, &saved, FILE_CURRENT) == 0) {
+        report.debug(u"error getting position in %s: %s", getDisplayFileName(), SysErrorCodeMessage());
+        return false;
+    }
+    pos.QuadPart = ::LONGLONG(size);
+    const bool ok = ::SetFilePointerEx(_handle, pos, nullptr, FILE_BEGIN) != 0 && ::SetEndOfFile(_handle) != 0;
+    if (!ok) {
+        report.debug(u"error preallocating %s: %s", getDisplayFileName(), SysErrorCodeMessage());
+    }
+    ::SetFilePointerEx(_handle, saved, nullptr, FILE_BEGIN);
+    return ok;
+
+#elif defined(TS_LINUX)
+
+    if (::fallocate(_fd, 0, 0, ::off_t(size)) != 0) {
+        report.debug(u"error preallocating %s: %s", getDisplayFileName(), SysErrorCodeMessage());
+        return false;
+    }
+    return true;
+
+#elif defined(TS_MAC)
+
+    // Try contiguous allocation first, fall back to non-contiguous.
+    ::fstore_t store {F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, ::off_t(size), 0};
+    if (::fcntl(_fd, F_PREALLOCATE, &store) == -1) {
+        store.fst_flags = F_ALLOCATEALL;
+        if (::fcntl(_fd, F_PREALLOCATE, &store) == -1) {
+            report.debug(u"error preallocating %s: %s", getDisplayFileName(), SysErrorCodeMessage());
+            return false;
+        }
+    }
+    if (::ftruncate(_fd, ::off_t(size)) != 0) {
+        report.debug(u"error extending %s: %s", getDisplayFileName(), SysErrorCodeMessage());
+        return false;
+    }
+    return true;
+
+#else
+
+    const int err = ::posix_fallocate(_fd, 0, ::off_t(size));
+    if (err != 0) {
+        report.debug(u"error preallocating %s: %s", getDisplayFileName(), SysErrorCodeMessage(err));
+        return false;
+    }
+    return true;
+
+#endif
+}
+
+
 //----------------------------------------------------------------------------
 // Close file.
 //----------------------------------------------------------------------------
@@ -493,14 +1127,30 @@ bool ts::TSFile::close(Report& report)
         writeStuffing(_close_null, report);
     }
 
+    // In write mode with compression, terminate the compressed stream and write the trailer.
+    bool status = true;
+    if ((_flags & WRITE) != 0 && _zlib != nullptr && !_aborted) {
+        size_t written = 0;
+        _zout.clear();
+        status = _zlib->finishDeflate(_zout, report) && (_zout.empty() || writeStreamDirect(_zout.data(), _zout.size(), written, report));
+    }
+
+    // Wait for outstanding asynchronous operations, report posted write errors.
+    if (_async != nullptr) {
+        status = _async->flush(_severity, getDisplayFileName(), report) && status;
+        _async.reset();
+    }
+
     if (!_std_inout) {
 #if defined(TS_WINDOWS)
         ::CloseHandle(_handle);
 #else
+        unmapFile();
         ::close(_fd);
 #endif
     }
 
+    resetCompression();
     _is_open = false;
     _at_eof = false;
     _aborted = false;
@@ -508,10 +1158,40 @@ bool ts::TSFile::close(Report& report)
     _filename.clear();
     _std_inout = false;
 
-    return true;
+    return status;
+}
+
+
+//----------------------------------------------------------------------------
+// Reset the transparent compression state (on open, reopen, rewind).
+//----------------------------------------------------------------------------
+
+void ts::TSFile::resetCompression()
+{
+    _zchecked = false;
+    _zin_eof = false;
+    _zin_next = _zin_size = 0;
+    _zlib.reset();
 }
 
 
+//----------------------------------------------------------------------------
+// Unmap the file mapping, when active (UNIX only).
+//----------------------------------------------------------------------------
+
+#if !defined(TS_WINDOWS)
+void ts::TSFile::unmapFile()
+{
+    if (_mmap_base != nullptr) {
+        ::munmap(_mmap_base, _mmap_size);
+        _mmap_base = nullptr;
+        _mmap_size = 0;
+        _mmap_pos = _mmap_advised = 0;
+    }
+}
+#endif
+
+
 //----------------------------------------------------------------------------
 // Implementation of AbstractReadStreamInterface
 //----------------------------------------------------------------------------
@@ -523,6 +1203,9 @@ bool ts::TSFile::endOfStream()
 
 bool ts::TSFile::readStreamPartial(void* buffer, size_t request_size, size_t& read_size, Report& report)
 {
+    // Size of a chunk of raw data, when reading a compressed file.
+    static constexpr size_t CHUNK_SIZE = 256 * 1024;
+
     read_size = 0;
 
     if (!_is_open) {
@@ -538,6 +1221,103 @@ bool ts::TSFile::readStreamPartial(void* buffer, size_t request_size, size_t& re
         return true;
     }
 
+    // On first read of a read-only file, detect a compressed file from its magic number.
+    if (!_zchecked) {
+        _zchecked = true;
+        if ((_flags & (READ | WRITE)) == READ) {
+            _zin.resize(CHUNK_SIZE);
+            size_t got = 0;
+            if (readStreamDirect(_zin.data(), _zin.size(), got, report)) {
+                _zin_next = 0;
+                _zin_size = got;
+                // Gzip magic number: 0x1F 0x8B. No possible clash with a TS file (a TS packet starts with 0x47).
+                if (got >= 2 && _zin[0] == 0x1F && _zin[1] == 0x8B) {
+                    _zlib = std::make_unique<ZlibStream>();
+                    if (!_zlib->openInflate(report)) {
+                        _zlib.reset();
+                        return false;
+                    }
+                    report.debug(u"%s is gzip-compressed, decompressing on the fly", getDisplayFileName());
+                }
+            }
+            else if (!_at_eof) {
+                // Actual read error (an empty file is simply at end of file).
+                return false;
+            }
+        }
+    }
+
+    // Uncompressed file: drain the detection buffer first, then read the file directly.
+    if (_zlib == nullptr) {
+        if (_zin_next < _zin_size) {
+            read_size = std::min(request_size, _zin_size - _zin_next);
+            MemCopy(buffer, _zin.data() + _zin_next, read_size);
+            _zin_next += read_size;
+            return true;
+        }
+        return !_at_eof && readStreamDirect(buffer, request_size, read_size, report);
+    }
+
+    // Compressed file: refill the compressed data buffer and decompress into the caller's buffer.
+    for (;;) {
+        // Refill the compressed data buffer when empty.
+        if (_zin_next >= _zin_size && !_zin_eof) {
+            size_t got = 0;
+            if (readStreamDirect(_zin.data(), _zin.size(), got, report)) {
+                _zin_next = 0;
+                _zin_size = got;
+            }
+            else if (_at_eof) {
+                // End of the raw compressed file, not yet the end of the TS data.
+                _zin_eof = true;
+                _at_eof = false;
+            }
+            else {
+                return false;
+            }
+        }
+        const size_t avail = _zin_size - _zin_next;
+        if (_zlib->endOfStream()) {
+            if (avail == 0) {
+                // Real end of the compressed data.
+                _at_eof = true;
+                return false;
+            }
+            // More data after the end of a compressed stream: concatenated gzip
+            // files (eg. "cat f1.gz f2.gz"), restart on the next stream.
+            if (!_zlib->close(report) || !_zlib->openInflate(report)) {
+                return false;
+            }
+        }
+        size_t used = 0;
+        if (!_zlib->inflate(buffer, request_size, read_size, _zin.data() + _zin_next, avail, used, report)) {
+            return false;
+        }
+        _zin_next += used;
+        if (read_size > 0) {
+            return true;
+        }
+        if (!_zlib->endOfStream() && avail == 0 && _zin_eof) {
+            report.log(_severity, u"truncated compressed data in %s", getDisplayFileName());
+            return false;
+        }
+        if (!_zlib->endOfStream() && avail > 0 && used == 0) {
+            // No progress on non-empty input, should not happen.
+            report.log(_severity, u"invalid compressed data in %s", getDisplayFileName());
+            return false;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Platform-specific read of the underlying file, without decompression.
+//----------------------------------------------------------------------------
+
+bool ts::TSFile::readStreamDirect(void* buffer, size_t request_size, size_t& read_size, Report& report)
+{
+    read_size = 0;
+
 #if defined(TS_WINDOWS)
 
     // Windows implementation
@@ -563,6 +1343,39 @@ bool ts::TSFile::readStreamPartial(void* buffer, size_t request_size, size_t& re
 #else
 
     // UNIX implementation
+    // With the asynchronous engine, get data from the read-ahead blocks.
+    if (_async != nullptr) {
+        if (!_async->read(buffer, request_size, read_size, _severity, getDisplayFileName(), report)) {
+            return false;
+        }
+        _at_eof = read_size == 0;
+        return !_at_eof;
+    }
+
+    // With memory-mapped input, copy the data from the mapping, no system call.
+    if (_mmap_base != nullptr) {
+        if (_mmap_pos >= _mmap_size) {
+            // End of file (as of the time the file was mapped).
+            _at_eof = true;
+            return false;
+        }
+        // Advise the kernel about the window ahead of the read position, so that the
+        // pages are faulted in asynchronously before the application touches them.
+        // The advised address must be aligned on a page boundary.
+        static constexpr uint64_t ADVISE_WINDOW = 16 * 1024 * 1024;
+        if (_mmap_advised < std::min<uint64_t>(_mmap_size, _mmap_pos + ADVISE_WINDOW)) {
+            static const uint64_t page_mask = uint64_t(::sysconf(_SC_PAGESIZE)) - 1;
+            const uint64_t start = _mmap_advised & ~page_mask;
+            const size_t chunk = size_t(std::min<uint64_t>(ADVISE_WINDOW, _mmap_size - start));
+            ::madvise(_mmap_base + start, chunk, MADV_WILLNEED);
+            _mmap_advised = start + chunk;
+        }
+        read_size = size_t(std::min<uint64_t>(request_size, _mmap_size - _mmap_pos));
+        MemCopy(buffer, _mmap_base + _mmap_pos, read_size);
+        _mmap_pos += read_size;
+        return true;
+    }
+
     for (;;) {
         const ssize_t insize = ::read(_fd, buffer, request_size);
         if (insize == 0) {
@@ -653,6 +1466,33 @@ size_t ts::TSFile::readPackets(TSPacket* buffer, TSPacketMetadata* metadata, siz
 //----------------------------------------------------------------------------
 
 bool ts::TSFile::writeStream(const void* buffer, size_t data_size, size_t& written_size, Report& report)
+{
+    written_size = 0;
+
+    // With compression, compress the data and write the compressed chunk.
+    if (_zlib != nullptr && (_flags & WRITE) != 0) {
+        _zout.clear();
+        if (!_zlib->deflate(_zout, buffer, data_size, report)) {
+            return false;
+        }
+        size_t written = 0;
+        if (!_zout.empty() && !writeStreamDirect(_zout.data(), _zout.size(), written, report)) {
+            return false;
+        }
+        // Report the uncompressed size, the caller checks it against the packet size.
+        written_size = data_size;
+        return true;
+    }
+
+    return writeStreamDirect(buffer, data_size, written_size, report);
+}
+
+
+//----------------------------------------------------------------------------
+// Platform-specific write of the underlying file, without compression.
+//----------------------------------------------------------------------------
+
+bool ts::TSFile::writeStreamDirect(const void* buffer, size_t data_size, size_t& written_size, Report& report)
 {
     written_size = 0;
 
@@ -691,6 +1531,15 @@ bool ts::TSFile::writeStream(const void* buffer, size_t data_size, size_t& writt
 #else
 
     // UNIX implementation
+    // With the asynchronous engine, post the write and return immediately.
+    if (_async != nullptr) {
+        if (!_async->write(buffer, data_size, _severity, getDisplayFileName(), report)) {
+            return false;
+        }
+        written_size = data_size;
+        return true;
+    }
+
     const char* data = reinterpret_cast<const char*>(buffer);
     size_t remain = data_size;
     ssize_t outsize = 0;
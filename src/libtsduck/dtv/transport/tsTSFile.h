@@ -15,16 +15,26 @@
 #include "tsTSPacketStream.h"
 #include "tsAbstractReadStreamInterface.h"
 #include "tsAbstractWriteStreamInterface.h"
+#include "tsZlibStream.h"
 #include "tsEnumUtils.h"
 
 namespace ts {
 
     class TSPacketMetadata;
+    class TSFileAsyncEngine;
 
     //!
     //! Transport stream file, input and/or output.
     //! @ingroup libtsduck mpeg
     //!
+    //! When a file is open in read-only mode, a gzip compression is automatically
+    //! detected from the magic number at the beginning of the file
+    //! and packets are transparently decompressed on the fly. Seeking inside a
+    //! compressed file is not possible but rewinding to the start of the file is.
+    //! Transparent decompression requires the zlib library and is not available
+    //! on platforms where TSDuck is built with the "Small Deflate" fallback
+    //! (Windows by default).
+    //!
     class TSDUCKDLL TSFile :
         public TSPacketStream,
         private AbstractReadStreamInterface,
@@ -151,6 +161,50 @@ namespace ts {
         //!
         void setStuffing(size_t initial, size_t final);
 
+        //!
+        //! Request the use of an asynchronous I/O engine when available.
+        //! This method shall be called before opening the file.
+        //! When enabled, on platforms with a kernel asynchronous I/O interface (io_uring on Linux),
+        //! data are transferred using a queue of large outstanding read or write requests, keeping
+        //! the device busy while the application processes packets. This is transparent for the
+        //! application and significantly increases the throughput on fast storage.
+        //! The request is ignored, and the standard synchronous I/O are used, on other platforms,
+        //! on non-regular files (pipes, devices) and when the kernel interface is not available.
+        //! @param [in] on When true, use asynchronous I/O if possible.
+        //!
+        void setAsyncIO(bool on) { _async_req = on; }
+
+        //!
+        //! Request the use of memory-mapped input when available.
+        //! This method shall be called before opening the file.
+        //! When enabled, on UNIX systems (Linux, macOS, BSD), a file which is open in
+        //! read-only mode is mapped in virtual memory and packets are served from the
+        //! mapping, with madvise() windows issued ahead of the read position. There is
+        //! no read system call any more: on a file which is already in the page cache,
+        //! for instance on repeated analysis passes over the same capture, packets are
+        //! delivered at memory bandwidth.
+        //! The request is ignored, and the standard I/O are used, on Windows, on
+        //! non-regular files (pipes, devices), in write mode and when the asynchronous
+        //! I/O engine is active. The file size is frozen when the file is open, a file
+        //! which grows while being read is truncated at its initial size.
+        //! @param [in] on When true, use memory-mapped input if possible.
+        //!
+        void setMemoryMap(bool on) { _mmap_req = on; }
+
+        //!
+        //! Request gzip compression of an output file.
+        //! This method shall be called before opening the file.
+        //! When enabled, all data which are written into the file are compressed
+        //! on the fly in gzip format (RFC 1952). The resulting file can be read
+        //! back by TSDuck without explicit decompression (see the note below) or
+        //! decompressed with standard tools such as `gunzip`.
+        //! Compression requires the zlib library. On platforms where TSDuck is
+        //! built with the "Small Deflate" fallback instead (Windows by default),
+        //! opening the file fails.
+        //! @param [in] level Compression level, from 0 to 9, or -1 to disable compression.
+        //!
+        void setWriteCompression(int level) { _compress_level = level; }
+
         //!
         //! Abort any currenly read/write operation in progress.
         //! The file is left in a broken state and can be only closed.
@@ -177,6 +231,24 @@ namespace ts {
         //!
         bool seek(PacketCounter packet_index, Report& report);
 
+        //!
+        //! Preallocate disk space for a file which is open in write mode.
+        //! Reserving the final size of the file upfront lets the filesystem
+        //! allocate its extents at once, instead of growing the file write
+        //! after write. This is useful for fixed-size files which are
+        //! cyclically rewritten in place, such as time-shift ring buffers.
+        //! This is a best-effort operation. It does nothing on non-regular
+        //! files, on compressed output and on platforms or filesystems
+        //! without preallocation support. Failures are reported at debug
+        //! level only.
+        //! @param [in] packet_count Number of packets to preallocate,
+        //! from the beginning of the file.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false when preallocation failed or is
+        //! not supported.
+        //!
+        bool preallocate(PacketCounter packet_count, Report& report);
+
         // Override TSPacketStream implementation
         virtual size_t readPackets(TSPacket* buffer, TSPacketMetadata* metadata, size_t max_packets, Report& report) override;
 
@@ -197,10 +269,28 @@ namespace ts {
         bool          _rewindable = false;   //!< Opened in rewindable mode
         bool          _regular = false;      //!< Is a regular file (ie. not a pipe or special device)
         bool          _std_inout = false;    //!< File is standard input or output.
+        bool          _async_req = false;    //!< Asynchronous I/O engine requested.
+        bool          _mmap_req = false;     //!< Memory-mapped input requested.
+        int           _compress_level = -1;  //!< Write-side gzip compression level, -1 when disabled.
+        bool          _zchecked = false;     //!< Compression detection was performed on input.
+        bool          _zin_eof = false;      //!< End of the raw compressed input file.
+        size_t        _zin_next = 0;         //!< Next unconsumed byte in _zin.
+        size_t        _zin_size = 0;         //!< Number of valid bytes in _zin.
+        ByteBlock     _zin {};               //!< Compressed input buffer, also detection buffer.
+        ByteBlock     _zout {};              //!< Compressed output staging buffer.
+        std::unique_ptr<ZlibStream> _zlib {};          //!< Stream compression state, when active.
+        std::unique_ptr<TSFileAsyncEngine> _async {};  //!< Asynchronous I/O engine, when open and supported.
 #if defined(TS_WINDOWS)
         ::HANDLE      _handle = INVALID_HANDLE_VALUE;
 #else
         int           _fd = -1;
+        uint8_t*      _mmap_base = nullptr;  //!< Base address of the file mapping, when active.
+        size_t        _mmap_size = 0;        //!< Size in bytes of the file mapping.
+        uint64_t      _mmap_pos = 0;         //!< Current read position in the mapping.
+        uint64_t      _mmap_advised = 0;     //!< End of the zone which was advised with MADV_WILLNEED.
+
+        // Unmap the file mapping, when active.
+        void unmapFile();
 #endif
 
         // Implementation of AbstractReadStreamInterface
@@ -219,6 +309,13 @@ namespace ts {
         bool seekCheck(Report& report);
         bool seekInternal(uint64_t index, Report& report);
 
+        // Platform-specific read/write of the underlying file, without transparent compression.
+        bool readStreamDirect(void* addr, size_t max_size, size_t& ret_size, Report& report);
+        bool writeStreamDirect(const void* addr, size_t size, size_t& written_size, Report& report);
+
+        // Reset the transparent compression state (on open, reopen, rewind).
+        void resetCompression();
+
         // Inaccessible operations. Same as TS_NOCOPY() except that we keep the move constructor (required for vectors).
         TSFile(const TSFile&) = delete;
         TSFile& operator=(const TSFile&) = delete;
@@ -38,6 +38,14 @@ void ts::TSFileInputArgs::defineArgs(Args& args)
               u"If several input files are specified, several options --add-stop-stuffing are allowed. "
               u"If there are less options than input files, the last value is used for subsequent files.");
 
+    args.option(u"async-io");
+    args.help(u"async-io",
+              u"Use an asynchronous I/O engine to read the files, when the operating system "
+              u"provides one (io_uring on Linux). The files are read ahead of the processing "
+              u"using a queue of large outstanding read requests, which increases the throughput "
+              u"on fast storage. This option is ignored on non-regular files (pipes, devices) "
+              u"and on platforms or kernels without a supported interface.");
+
     args.option(u"byte-offset", 'b', Args::UNSIGNED);
     args.help(u"byte-offset",
               u"Start reading each file at the specified byte offset (default: 0). "
@@ -70,6 +78,16 @@ void ts::TSFileInputArgs::defineArgs(Args& args)
               u"For a given file, if the computed label is above the maximum (" +
               UString::Decimal(TSPacketLabelSet::MAX) + u"), its packets are not labelled.");
 
+    args.option(u"mmap");
+    args.help(u"mmap",
+              u"Use memory-mapped input to read the files, on UNIX systems (Linux, macOS, BSD). "
+              u"The files are mapped in virtual memory and packets are served from the mapping, "
+              u"without read system calls, with advised readahead windows ahead of the read "
+              u"position. Files which are already in the page cache, for instance on repeated "
+              u"analysis passes over the same capture, are read at memory bandwidth. "
+              u"This option is ignored on non-regular files (pipes, devices), on Windows "
+              u"and when --async-io is specified.");
+
     args.option(u"packet-offset", 'p', Args::UNSIGNED);
     args.help(u"packet-offset",
               u"Start reading each file at the specified TS packet (default: 0). "
@@ -79,6 +97,17 @@ void ts::TSFileInputArgs::defineArgs(Args& args)
     args.help(u"repeat",
               u"Repeat the playout of each file the specified number of times (default: only once). "
               u"This option is allowed only if all input files are regular files.");
+
+    args.option(u"timing-replay", 0, Args::FILENAME);
+    args.help(u"timing-replay", u"filename",
+              u"Replay the input timing from the specified capture file, which was recorded "
+              u"using the tsp option --timing-capture. The packets are delivered by groups, "
+              u"following the captured receive windows, and each window is delivered at the "
+              u"same time offset from the start of the replay as during the capture. The "
+              u"original input time stamps are restored in the packet metadata. The input "
+              u"file should be a saved copy of the originally captured stream. After the "
+              u"end of the capture file, the remaining packets are read without pacing. "
+              u"This option is incompatible with --interleave.");
 }
 
 
@@ -92,11 +121,14 @@ bool ts::TSFileInputArgs::loadArgs(DuckContext& duck, Args& args)
     _repeat_count = args.present(u"infinite") ? 0 : args.intValue<size_t>(u"repeat", 1);
     _start_offset = args.intValue<uint64_t>(u"byte-offset", args.intValue<uint64_t>(u"packet-offset", 0) * PKT_SIZE);
     _interleave = args.present(u"interleave");
+    _async_io = args.present(u"async-io");
+    _mmap_io = args.present(u"mmap");
     _first_terminate = args.present(u"first-terminate");
     args.getIntValue(_interleave_chunk, u"interleave", 1);
     args.getIntValue(_base_label, u"label-base", NPOS);
     args.getIntValues(_start_stuffing, u"add-start-stuffing");
     args.getIntValues(_stop_stuffing, u"add-stop-stuffing");
+    args.getPathValue(_replay_filename, u"timing-replay");
     _file_format = LoadTSPacketFormatInputOption(args);
 
     // If there is no file, then this is the standard input, an empty file name.
@@ -116,6 +148,10 @@ bool ts::TSFileInputArgs::loadArgs(DuckContext& duck, Args& args)
         args.error(u"specifying --infinite is meaningless with more than one file");
         return false;
     }
+    if (_interleave && !_replay_filename.empty()) {
+        args.error(u"--timing-replay and --interleave are mutually exclusive");
+        return false;
+    }
 
     // Make sure start and stop stuffing vectors have the same size as the file vector.
     // If the vectors must be enlarged, repeat the last value in the array.
@@ -142,8 +178,10 @@ bool ts::TSFileInputArgs::openFile(size_t name_index, size_t file_index, Report&
         report.verbose(u"reading file %s", name.empty() ? u"'stdin'" : name);
     }
 
-    // Preset artificial stuffing.
+    // Preset artificial stuffing, asynchronous I/O and memory mapping.
     _files[file_index].setStuffing(_start_stuffing[name_index], _stop_stuffing[name_index]);
+    _files[file_index].setAsyncIO(_async_io);
+    _files[file_index].setMemoryMap(_mmap_io);
 
     // Actually open the file.
     return _files[file_index].openRead(name, _repeat_count, _start_offset, report, _file_format);
@@ -187,6 +225,14 @@ bool ts::TSFileInputArgs::open(Report& report)
         ok = openFile(n, n, report);
     }
 
+    // Open the timing capture file and set the time origin of the replay.
+    if (ok && !_replay_filename.empty()) {
+        ok = _replay_file.openRead(_replay_filename, report);
+        _replay_start = monotonic_time::clock::now();
+        _replay_mdata.clear();
+        _replay_next = 0;
+    }
+
     // If one open failed, close all files which were already open.
     if (!ok) {
         closeAllFiles(report);
@@ -208,6 +254,9 @@ bool ts::TSFileInputArgs::open(Report& report)
 
 bool ts::TSFileInputArgs::close(Report& report)
 {
+    if (_replay_file.isOpen()) {
+        _replay_file.close(report);
+    }
     return closeAllFiles(report);
 }
 
@@ -228,6 +277,38 @@ void ts::TSFileInputArgs::abort()
 }
 
 
+//----------------------------------------------------------------------------
+// With --timing-replay, wait until the due time of the next capture window.
+//----------------------------------------------------------------------------
+
+size_t ts::TSFileInputArgs::waitReplayWindow(Report& report)
+{
+    // Load the next window when the current one is exhausted. Empty windows
+    // cannot be produced by the capture but are skipped, just in case.
+    while (_replay_file.isOpen() && _replay_next >= _replay_mdata.size()) {
+        cn::nanoseconds due {};
+        size_t occupancy = 0;
+        if (!_replay_file.readWindow(due, occupancy, _replay_mdata, report)) {
+            // End of the capture file (or invalid file, the error is already
+            // reported): continue reading without pacing.
+            _replay_file.close(report);
+            return NPOS;
+        }
+        _replay_next = 0;
+
+        // Wait until the same time offset from the start of the replay as
+        // during the capture, in slices so that abort() remains responsive.
+        const monotonic_time due_time = _replay_start + cn::duration_cast<monotonic_time::duration>(due);
+        monotonic_time now = monotonic_time::clock::now();
+        while (!_aborted && now < due_time) {
+            std::this_thread::sleep_for(std::min<cn::nanoseconds>(due_time - now, cn::milliseconds(100)));
+            now = monotonic_time::clock::now();
+        }
+    }
+    return _replay_file.isOpen() ? _replay_mdata.size() - _replay_next : NPOS;
+}
+
+
 //----------------------------------------------------------------------------
 // Read packets.
 //----------------------------------------------------------------------------
@@ -236,6 +317,12 @@ size_t ts::TSFileInputArgs::read(TSPacket* buffer, TSPacketMetadata* pkt_data, s
 {
     size_t read_count = 0;
 
+    // With --timing-replay, pace the read operations on the captured receive
+    // windows and do not read more packets than the current window.
+    if (_replay_file.isOpen()) {
+        max_packets = std::min(max_packets, waitReplayWindow(report));
+    }
+
     // Loop until got max number of packets or all files have reached end-of-file.
     while (!_aborted && read_count < max_packets && _eof.size() < _filenames.size()) {
 
@@ -303,5 +390,13 @@ size_t ts::TSFileInputArgs::read(TSPacket* buffer, TSPacketMetadata* pkt_data, s
         }
     }
 
+    // With --timing-replay, restore the captured input time stamps.
+    for (size_t n = 0; n < read_count && _replay_next < _replay_mdata.size(); ++n, ++_replay_next) {
+        const TSPacketMetadata& md(_replay_mdata[_replay_next]);
+        if (pkt_data != nullptr && md.hasInputTimeStamp()) {
+            pkt_data[n].setInputTimeStamp(md.getInputTimeStamp(), md.getInputTimeSource());
+        }
+    }
+
     return read_count;
 }
@@ -15,6 +15,7 @@
 #include "tsTSFile.h"
 #include "tsTSPacket.h"
 #include "tsTSPacketMetadata.h"
+#include "tsTSTimingFile.h"
 #include "tsDuckContext.h"
 #include "tsArgs.h"
 
@@ -83,6 +84,8 @@ namespace ts {
     private:
         volatile bool       _aborted = true;          // Set when abortInput() is set.
         bool                _interleave = false;      // Read all files simultaneously with interleaving.
+        bool                _async_io = false;        // Use an asynchronous I/O engine when available.
+        bool                _mmap_io = false;         // Use memory-mapped input when available.
         bool                _first_terminate = false; // With _interleave, terminate when the first file terminates.
         size_t              _interleave_chunk = 0;    // Number of packets per chunk when _interleave.
         size_t              _interleave_remain = 0;   // Remaining packets to read in current chunk of current file.
@@ -97,11 +100,21 @@ namespace ts {
         std::vector<size_t> _stop_stuffing {};
         std::set<size_t>    _eof {};                  // Set of file indexes having reached end of file.
         std::vector<TSFile> _files {};                // Array of open files, only one without interleave.
+        fs::path            _replay_filename {};      // Timing capture file to replay (--timing-replay).
+        TSTimingFile        _replay_file {};          // Timing capture file.
+        monotonic_time      _replay_start {};         // Time origin of the replay.
+        std::vector<TSPacketMetadata> _replay_mdata {};  // Metadata of the current replay window.
+        size_t              _replay_next = 0;         // Next unused entry in _replay_mdata.
 
         // Open one input file.
         bool openFile(size_t name_index, size_t file_index, Report& report);
 
         // Close all files which are currently open.
         bool closeAllFiles(Report& report);
+
+        // With --timing-replay, wait until the due time of the next capture window.
+        // Return the number of packets which remain to be read in the current window,
+        // NPOS when the capture file is completed or not used.
+        size_t waitReplayWindow(Report& report);
     };
 }
@@ -158,6 +158,43 @@ bool ts::TSFileInputBuffered::seekForward(size_t packet_count, Report& report)
 }
 
 
+//----------------------------------------------------------------------------
+// Fill the buffer ahead of the current position, without consuming packets.
+//----------------------------------------------------------------------------
+
+size_t ts::TSFileInputBuffered::readAhead(size_t packet_count, Report& report)
+{
+    if (!isOpen()) {
+        report.error(u"file not open");
+        return 0;
+    }
+
+    const size_t buffer_size = _buffer.size();
+
+    assert(_first_index < buffer_size);
+    assert(_current_offset <= _total_count);
+    assert(_total_count <= buffer_size);
+
+    // Read from the file directly into the free space of the circular buffer,
+    // in at most two contiguous chunks.
+    size_t result = 0;
+    packet_count = std::min(packet_count, buffer_size - _total_count);
+    while (packet_count > 0) {
+        const size_t index = (_first_index + _total_count) % buffer_size;
+        const size_t count = std::min(packet_count, buffer_size - index);
+        const size_t in_count = TSFile::readPackets(&_buffer[index], &_metadata[index], count, report);
+        result += in_count;
+        _total_count += in_count;
+        packet_count -= in_count;
+        if (in_count < count) {
+            // Error or end of file repetition, stop here.
+            break;
+        }
+    }
+    return result;
+}
+
+
 //----------------------------------------------------------------------------
 // Read TS packets. Override TSFile::read().
 //----------------------------------------------------------------------------
@@ -102,6 +102,18 @@ namespace ts {
         //!
         size_t read(TSPacket* buffer, size_t max_packets, Report& report, TSPacketMetadata* metadata = nullptr);
 
+        //!
+        //! Fill the buffer ahead of the current position, without consuming packets.
+        //! Interactive applications can invoke this method during idle time so that
+        //! subsequent calls to read() and seekForward() are served from the buffer,
+        //! without blocking on disk I/O.
+        //! @param [in] packet_count Maximum number of packets to read ahead from the
+        //! file. Limited by the free space in the buffer.
+        //! @param [in,out] report Where to report errors.
+        //! @return The number of packets which were read ahead.
+        //!
+        size_t readAhead(size_t packet_count, Report& report);
+
         //!
         //! Get the backward seekable distance inside the buffer.
         //! This is the minimum guaranteed seekable distance.
@@ -13,7 +13,7 @@
 
 
 //----------------------------------------------------------------------------
-// Default constructor.
+// Constructors and destructors.
 //----------------------------------------------------------------------------
 
 ts::TSFileOutputArgs::TSFileOutputArgs(bool allow_stdout) :
@@ -21,6 +21,11 @@ ts::TSFileOutputArgs::TSFileOutputArgs(bool allow_stdout) :
 {
 }
 
+ts::TSFileOutputArgs::~TSFileOutputArgs()
+{
+    stopThread();
+}
+
 
 //----------------------------------------------------------------------------
 // Add command line option definitions in an Args.
@@ -45,9 +50,33 @@ void ts::TSFileOutputArgs::defineArgs(Args& args)
               u"Specify that <count> null TS packets must be automatically appended "
               u"at the end of the output file, after what comes from the previous plugins.");
 
+    args.option(u"async-io");
+    args.help(u"async-io",
+              u"Use an asynchronous I/O engine to write the file, when the operating system "
+              u"provides one (io_uring on Linux). The packets are written using a queue of "
+              u"large outstanding write requests, without waiting for their completion, which "
+              u"increases the throughput on fast storage. This option is ignored on non-regular "
+              u"files (pipes, devices) and on platforms or kernels without a supported interface.");
+
     args.option(u"append", 'a');
     args.help(u"append", u"If the file already exists, append to the end of the file. By default, existing files are overwritten.");
 
+    args.option(u"compress", 0, Args::INTEGER, 0, 1, 0, 9, true);
+    args.help(u"compress", u"level",
+              u"Compress the output file on the fly, in gzip format. "
+              u"The file can be read back by TSDuck without explicit decompression "
+              u"or decompressed with standard tools such as gunzip. "
+              u"The optional value is the compression level, from 0 to 9 "
+              u"(default: " + UString::Decimal(DEFAULT_COMPRESSION_LEVEL) + u"). "
+              u"This option is not available on platforms where TSDuck is built without zlib.");
+
+    args.option(u"drop-on-overflow");
+    args.help(u"drop-on-overflow",
+              u"With --write-queue, when the queue is full because the storage does not keep up, "
+              u"drop the incoming packets instead of waiting for free space in the queue. "
+              u"The total number of dropped packets is reported when the file is closed. "
+              u"By default, wait for free space, which creates back-pressure on the previous plugins.");
+
     args.option(u"keep", 'k');
     args.help(u"keep", u"Keep existing file (abort if the specified file already exists). By default, existing files are overwritten.");
 
@@ -92,6 +121,16 @@ void ts::TSFileOutputArgs::defineArgs(Args& args)
               u"Then, the integer part is incremented. "
               u"Example: if the specified file name is foo-027.ts, the various files are named foo-027.ts, foo-028.ts, etc.\n\n"
               u"The options --max-duration and --max-size are mutually exclusive.");
+
+    args.option(u"write-queue", 0, Args::POSITIVE, 0, 1, 1, Args::UNLIMITED_VALUE, true);
+    args.help(u"write-queue",
+              u"Write the file from a dedicated low-priority thread, using a queue of buffered packets. "
+              u"The packets are copied into the queue and the previous plugins are not delayed by the "
+              u"file I/O, so that transient stalls of the storage (typically a few seconds on spinning "
+              u"disks) are absorbed by the queue instead of back-pressuring a live input. "
+              u"The optional value is the maximum number of TS packets in the queue "
+              u"(default: " + UString::Decimal(DEFAULT_WRITE_QUEUE_PACKETS) + u" packets). "
+              u"See also option --drop-on-overflow.");
 }
 
 
@@ -103,6 +142,8 @@ bool ts::TSFileOutputArgs::loadArgs(DuckContext& duck, Args& args)
 {
     args.getPathValue(_name);
     _reopen = args.present(u"reopen-on-error");
+    _async_io = args.present(u"async-io");
+    _compress_level = args.present(u"compress") ? args.intValue<int>(u"compress", DEFAULT_COMPRESSION_LEVEL) : -1;
     args.getIntValue(_retry_max, u"max-retry", 0);
     args.getChronoValue(_retry_interval, u"retry-interval", DEFAULT_RETRY_INTERVAL);
     args.getIntValue(_start_stuffing, u"add-start-stuffing", 0);
@@ -112,6 +153,8 @@ bool ts::TSFileOutputArgs::loadArgs(DuckContext& duck, Args& args)
     args.getChronoValue(_max_duration, u"max-duration", 0);
     _file_format = LoadTSPacketFormatOutputOption(args);
     _multiple_files = _max_size > 0 || _max_duration > cn::seconds::zero();
+    _queue_packets = args.present(u"write-queue") ? args.intValue<size_t>(u"write-queue", DEFAULT_WRITE_QUEUE_PACKETS) : 0;
+    _drop_overflow = args.present(u"drop-on-overflow");
 
     _flags = TSFile::WRITE | TSFile::SHARED;
     if (args.present(u"append")) {
@@ -129,6 +172,14 @@ bool ts::TSFileOutputArgs::loadArgs(DuckContext& duck, Args& args)
         args.error(u"--max-duration and --max-size cannot be used on standard output");
         return false;
     }
+    if (_drop_overflow && _queue_packets == 0) {
+        args.error(u"--drop-on-overflow requires --write-queue");
+        return false;
+    }
+    if (_compress_level >= 0 && !ZlibStream::Supported()) {
+        args.error(u"--compress is not available, this version of TSDuck was compiled without zlib");
+        return false;
+    }
 
     return true;
 }
@@ -152,8 +203,45 @@ bool ts::TSFileOutputArgs::open(Report& report, AbortInterface* abort)
     _next_open_time = Time::CurrentUTC();
     _current_files.clear();
     _file.setStuffing(_start_stuffing, _stop_stuffing);
+    _file.setAsyncIO(_async_io);
+    _file.setWriteCompression(_compress_level);
     size_t retry_allowed = _retry_max == 0 ? std::numeric_limits<size_t>::max() : _retry_max;
-    return openAndRetry(false, retry_allowed, report, abort);
+    if (!openAndRetry(false, retry_allowed, report, abort)) {
+        return false;
+    }
+
+    // Start the write-behind thread when requested.
+    if (_queue_packets > 0) {
+        _report = &report;
+        _abort = abort;
+        _write_error = false;
+        _dropping = false;
+        _dropped_packets = 0;
+        _queue.clear();
+        _queue.setMaxMessages(std::max<size_t>(1, _queue_packets / WRITE_CHUNK_PACKETS));
+        _thread_started = start();
+        if (!_thread_started) {
+            report.error(u"error starting output thread");
+            _file.close(NULLREP);
+            return false;
+        }
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Terminate the write-behind thread, if started.
+//----------------------------------------------------------------------------
+
+void ts::TSFileOutputArgs::stopThread()
+{
+    if (_thread_started) {
+        // Enqueue an empty chunk as termination request, after all pending packets.
+        _queue.forceEnqueue(new WriteBuffer);
+        waitForTermination();
+        _thread_started = false;
+    }
 }
 
 
@@ -163,7 +251,13 @@ bool ts::TSFileOutputArgs::open(Report& report, AbortInterface* abort)
 
 bool ts::TSFileOutputArgs::close(Report& report)
 {
-    return closeAndCleanup(report);
+    // Wait for completion of all pending writes before closing the file.
+    stopThread();
+    if (_dropped_packets > 0) {
+        report.warning(u"dropped %'d packets on output queue overflow", _dropped_packets);
+        _dropped_packets = 0;
+    }
+    return closeAndCleanup(report) && !_write_error;
 }
 
 
@@ -263,6 +357,76 @@ bool ts::TSFileOutputArgs::closeAndCleanup(Report& report)
 //----------------------------------------------------------------------------
 
 bool ts::TSFileOutputArgs::write(const TSPacket* buffer, const TSPacketMetadata* pkt_data, size_t packet_count, Report& report, AbortInterface* abort)
+{
+    // Without write-behind thread, write synchronously in the caller thread.
+    if (!_thread_started) {
+        return writeDirect(buffer, pkt_data, packet_count, report, abort);
+    }
+
+    // A write error was reported by the write-behind thread.
+    if (_write_error) {
+        return false;
+    }
+
+    // Copy the packets into the queue, in chunks of at most WRITE_CHUNK_PACKETS.
+    while (packet_count > 0) {
+        const size_t count = std::min(packet_count, WRITE_CHUNK_PACKETS);
+        WriteQueue::MessagePtr msg(new WriteBuffer);
+        msg->packets.assign(buffer, buffer + count);
+        if (pkt_data != nullptr) {
+            msg->metadata.assign(pkt_data, pkt_data + count);
+            pkt_data += count;
+        }
+        if (!_drop_overflow) {
+            // Blocking policy: wait for free space in the queue.
+            _queue.enqueue(msg);
+        }
+        else if (_queue.enqueue(msg, cn::milliseconds::zero())) {
+            // End of a dropping period, if any.
+            _dropping = false;
+        }
+        else {
+            // Queue full, drop this chunk. Report the start of a dropping period only.
+            if (!_dropping) {
+                report.warning(u"output queue full, dropping packets");
+                _dropping = true;
+            }
+            _dropped_packets += count;
+        }
+        buffer += count;
+        packet_count -= count;
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// The write-behind thread.
+//----------------------------------------------------------------------------
+
+void ts::TSFileOutputArgs::main()
+{
+    for (;;) {
+        // Wait for a chunk of packets. An empty chunk is a termination request.
+        WriteQueue::MessagePtr msg;
+        _queue.dequeue(msg);
+        if (msg == nullptr || msg->packets.empty()) {
+            break;
+        }
+        // After a write error, keep draining the queue without writing.
+        const TSPacketMetadata* mdata = msg->metadata.empty() ? nullptr : msg->metadata.data();
+        if (!_write_error && !writeDirect(msg->packets.data(), mdata, msg->packets.size(), *_report, _abort)) {
+            _write_error = true;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Synchronously write packets, including retries and file rotation.
+//----------------------------------------------------------------------------
+
+bool ts::TSFileOutputArgs::writeDirect(const TSPacket* buffer, const TSPacketMetadata* pkt_data, size_t packet_count, Report& report, AbortInterface* abort)
 {
     // Total number of retries.
     size_t retry_allowed = _retry_max == 0 ? std::numeric_limits<size_t>::max() : _retry_max;
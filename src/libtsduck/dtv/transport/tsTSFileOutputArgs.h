@@ -18,6 +18,8 @@
 #include "tsFileNameGenerator.h"
 #include "tsDuckContext.h"
 #include "tsAbortInterface.h"
+#include "tsMessageQueue.h"
+#include "tsThread.h"
 #include "tsArgs.h"
 
 namespace ts {
@@ -25,7 +27,7 @@ namespace ts {
     //! Transport stream file output with command-line arguments.
     //! @ingroup libtsduck mpeg
     //!
-    class TSDUCKDLL TSFileOutputArgs
+    class TSDUCKDLL TSFileOutputArgs : private Thread
     {
         TS_NOBUILD_NOCOPY(TSFileOutputArgs);
     public:
@@ -35,6 +37,11 @@ namespace ts {
         //!
         TSFileOutputArgs(bool allow_stdout);
 
+        //!
+        //! Destructor.
+        //!
+        virtual ~TSFileOutputArgs() override;
+
         //!
         //! Add command line option definitions in an Args.
         //! @param [in,out] args Command line arguments to update.
@@ -83,13 +90,36 @@ namespace ts {
         //!
         static constexpr cn::milliseconds DEFAULT_RETRY_INTERVAL = cn::milliseconds(2000);
 
+        //!
+        //! Default size in packets of the write-behind queue.
+        //!
+        static constexpr size_t DEFAULT_WRITE_QUEUE_PACKETS = 65536;
+
     private:
+        // Maximum number of packets in one message of the write-behind queue.
+        static constexpr size_t WRITE_CHUNK_PACKETS = 512;
+
+        // Default gzip compression level with --compress.
+        static constexpr int DEFAULT_COMPRESSION_LEVEL = 6;
+
+        // Description of a chunk of packets, queued to the write-behind thread.
+        // An empty chunk is a request to terminate the thread.
+        class WriteBuffer
+        {
+        public:
+            TSPacketVector         packets {};
+            TSPacketMetadataVector metadata {};
+        };
+        using WriteQueue = MessageQueue<WriteBuffer>;
+
         // Command line options:
         const bool        _allow_stdout;
         fs::path          _name {};
         TSFile::OpenFlags _flags = TSFile::NONE;
         TSPacketFormat    _file_format = TSPacketFormat::TS;
         bool              _reopen = false;
+        bool              _async_io = false;
+        int               _compress_level = -1;
         cn::milliseconds  _retry_interval = DEFAULT_RETRY_INTERVAL;
         size_t            _retry_max = 0;
         size_t            _start_stuffing = 0;
@@ -98,6 +128,8 @@ namespace ts {
         cn::seconds       _max_duration {0};
         size_t            _max_files = 0;
         bool              _multiple_files = false;
+        size_t            _queue_packets = 0;
+        bool              _drop_overflow = false;
 
         // Working data:
         TSFile            _file {};
@@ -105,6 +137,13 @@ namespace ts {
         uint64_t          _current_size = 0;
         Time              _next_open_time {};
         UStringList       _current_files {};
+        WriteQueue        _queue {};
+        Report*           _report = nullptr;          // Report to use in the write-behind thread.
+        AbortInterface*   _abort = nullptr;           // Abort interface to use in the write-behind thread.
+        bool              _thread_started = false;    // The write-behind thread is active.
+        volatile bool     _write_error = false;       // Write error in the write-behind thread.
+        bool              _dropping = false;          // Currently dropping packets on queue overflow.
+        size_t            _dropped_packets = 0;       // Total number of dropped packets.
 
         // Open the file, retry on error if necessary.
         // Use max number of retries. Updated with remaining number of retries.
@@ -112,5 +151,14 @@ namespace ts {
 
         // Close the current file, cleanup oldest files when necessary.
         bool closeAndCleanup(Report& report);
+
+        // Synchronously write packets in the current file, including retries and file rotation.
+        bool writeDirect(const TSPacket* buffer, const TSPacketMetadata* pkt_data, size_t packet_count, Report& report, AbortInterface* abort);
+
+        // Terminate the write-behind thread, if started.
+        void stopThread();
+
+        // Implementation of Thread: the write-behind thread.
+        virtual void main() override;
     };
 }
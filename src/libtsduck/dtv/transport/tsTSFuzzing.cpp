@@ -10,6 +10,7 @@
 #include "tsReport.h"
 #include "tsDuckContext.h"
 #include "tsSystemRandomGenerator.h"
+#include "tsMemory.h"
 
 
 //----------------------------------------------------------------------------
@@ -42,10 +43,29 @@ bool ts::TSFuzzing::start(const TSFuzzingArgs& options)
         }
     }
 
+    // Drop any random data which were generated with a previous seed.
+    _rand_index = RAND_BLOCK_SIZE;
+
     return true;
 }
 
 
+//----------------------------------------------------------------------------
+// Get the next 64-bit random value.
+//----------------------------------------------------------------------------
+
+uint64_t ts::TSFuzzing::rand64()
+{
+    if (_rand_index >= RAND_BLOCK_SIZE) {
+        // Refill the random block in one bulk operation.
+        _prng.read(_rand_block.data(), sizeof(_rand_block));
+        _rand_index = 0;
+    }
+    // The PRNG fills the buffer with 64-bit values in little endian order.
+    return GetUInt64LE(&_rand_block[_rand_index++]);
+}
+
+
 //----------------------------------------------------------------------------
 // Process one packet from the stream.
 //----------------------------------------------------------------------------
@@ -59,8 +79,8 @@ bool ts::TSFuzzing::processPacket(TSPacket& pkt)
         for (size_t i = _opt.sync_byte ? 0 : 1; i < PKT_SIZE; ++i) {
 
             // Check if random value is less than probability
-            if ((_prng.read64() % _opt.probability.denominator()) < _opt.probability.numerator()) {
-                pkt.b[i] = uint8_t(_prng.read64());
+            if ((rand64() % _opt.probability.denominator()) < _opt.probability.numerator()) {
+                pkt.b[i] = uint8_t(rand64());
             }
         }
     }
@@ -47,8 +47,17 @@ namespace ts {
         bool processPacket(TSPacket& pkt);
 
     private:
+        // Number of 64-bit words in the pre-generated random block.
+        static constexpr size_t RAND_BLOCK_SIZE = 512;
+
         DuckContext&  _duck;
         TSFuzzingArgs _opt {};
         Xoshiro256ss  _prng {};
+        size_t        _rand_index = RAND_BLOCK_SIZE;  // next word to consume in _rand_block
+        std::array<uint64_t, RAND_BLOCK_SIZE> _rand_block {};
+
+        // Get the next 64-bit random value. The random data are generated in bulk
+        // in _rand_block, which is much faster than one PRNG call per value.
+        uint64_t rand64();
     };
 }
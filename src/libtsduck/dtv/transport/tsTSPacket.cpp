@@ -10,6 +10,7 @@
 #include "tsPES.h"
 #include "tsByteBlock.h"
 #include "tsBuffer.h"
+#include "tsHexDump.h"
 #include "tsNames.h"
 
 
@@ -1152,7 +1153,8 @@ std::ostream& ts::TSPacket::display(std::ostream& strm, uint32_t flags, size_t i
         if (flags & DUMP_TS_HEADER) {
             strm << UString::Format(u"PID: 0x%X, PUSI: %d, ", getPID(), getPUSI());
         }
-        strm << UString::Dump(display_data, display_size, flags & 0x0000FFFF) << std::endl;
+        HexDump(strm, display_data, display_size, flags & 0x0000FFFF);
+        strm << std::endl;
         return strm;
     }
 
@@ -1321,7 +1323,7 @@ std::ostream& ts::TSPacket::display(std::ostream& strm, uint32_t flags, size_t i
             strm << margin << "---- TS Packet Payload (" << payload_size << " bytes) ----" << std::endl;
         }
         // The 16 LSB contains flags for Hexa.
-        strm << UString::Dump(display_data, display_size, flags & 0x0000FFFF, indent);
+        HexDump(strm, display_data, display_size, flags & 0x0000FFFF, indent);
     }
 
     return strm;
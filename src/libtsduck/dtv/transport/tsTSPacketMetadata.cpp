@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsTSPacketMetadata.h"
+#include "tsZlib.h"
 
 
 //----------------------------------------------------------------------------
@@ -164,6 +165,200 @@ bool ts::TSPacketMetadata::deserialize(const void* bin, size_t size)
 }
 
 
+//----------------------------------------------------------------------------
+// Batch serialization.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // Batch format version and header size (magic, version, flags, 32-bit count).
+    constexpr uint8_t BATCH_VERSION = 1;
+    constexpr uint8_t BATCH_FLAG_DEFLATE = 0x01;
+    constexpr size_t BATCH_HEADER_SIZE = 7;
+
+    // Append an unsigned integer in variable-length encoding (7 bits per byte,
+    // least significant first, most significant bit means continuation).
+    void PutVarInt(ts::ByteBlock& bb, uint64_t value)
+    {
+        do {
+            uint8_t byte = value & 0x7F;
+            value >>= 7;
+            if (value != 0) {
+                byte |= 0x80;
+            }
+            bb.appendUInt8(byte);
+        } while (value != 0);
+    }
+
+    // Extract a variable-length unsigned integer. Return false on truncated data.
+    bool GetVarInt(const uint8_t*& data, const uint8_t* end, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; data < end && shift < 64; shift += 7) {
+            const uint8_t byte = *data++;
+            value |= uint64_t(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Zigzag encoding: move the sign bit of a difference into the least
+    // significant bit, so that small deltas of either sign stay small.
+    uint64_t ZigZag(uint64_t diff)
+    {
+        return (diff << 1) ^ uint64_t(int64_t(diff) >> 63);
+    }
+
+    uint64_t UnZigZag(uint64_t value)
+    {
+        return (value >> 1) ^ (~(value & 1) + 1);
+    }
+}
+
+void ts::TSPacketMetadata::SerializeBatch(ByteBlock& bin, const TSPacketMetadata* mdata, size_t count, int compression_level)
+{
+    assert(mdata != nullptr || count == 0);
+
+    // Batch header.
+    bin.clear();
+    bin.appendUInt8(BATCH_SERIALIZATION_MAGIC);
+    bin.appendUInt8(BATCH_VERSION);
+    bin.appendUInt8(compression_level >= 0 ? BATCH_FLAG_DEFLATE : 0);
+    bin.appendUInt32(uint32_t(count));
+
+    // Build the columns, either directly in the output or in a transient
+    // buffer to be compressed.
+    ByteBlock cols;
+    ByteBlock& payload(compression_level >= 0 ? cols : bin);
+
+    // Input time stamps, delta-encoded. Consecutive time stamps are close to
+    // each other, their deltas use a couple of bytes instead of eight.
+    uint64_t previous = INVALID_PCR;
+    for (size_t i = 0; i < count; ++i) {
+        PutVarInt(payload, ZigZag(mdata[i]._input_time - previous));
+        previous = mdata[i]._input_time;
+    }
+
+    // Time sources and boolean flags, packed in one byte per packet as in
+    // serialize(), then run-length encoded (they rarely change in a stream).
+    for (size_t i = 0; i < count; ) {
+        const uint8_t byte = uint8_t((mdata[i]._input_stuffing ? 0x80 : 0x00) |
+                                     (mdata[i]._nullified ? 0x40 : 0x00) |
+                                     (static_cast<uint8_t>(mdata[i]._time_source) & 0x0F));
+        size_t run = 1;
+        while (i + run < count &&
+               mdata[i + run]._input_stuffing == mdata[i]._input_stuffing &&
+               mdata[i + run]._nullified == mdata[i]._nullified &&
+               mdata[i + run]._time_source == mdata[i]._time_source)
+        {
+            run++;
+        }
+        payload.appendUInt8(byte);
+        PutVarInt(payload, run);
+        i += run;
+    }
+
+    // Labels, run-length encoded for the same reason.
+    for (size_t i = 0; i < count; ) {
+        size_t run = 1;
+        while (i + run < count && mdata[i + run]._labels == mdata[i]._labels) {
+            run++;
+        }
+        payload.appendUInt32(mdata[i]._labels.toInt());
+        PutVarInt(payload, run);
+        i += run;
+    }
+
+    // Optionally compress the columns. On compression error, fall back to
+    // storing them uncompressed.
+    if (compression_level >= 0 && !Zlib::CompressAppend(bin, cols, compression_level)) {
+        bin[2] = 0;
+        bin.append(cols);
+    }
+}
+
+bool ts::TSPacketMetadata::DeserializeBatch(std::vector<TSPacketMetadata>& mdata, const ByteBlock& bin)
+{
+    mdata.clear();
+
+    // Validate the batch header.
+    if (bin.size() < BATCH_HEADER_SIZE || bin[0] != BATCH_SERIALIZATION_MAGIC || bin[1] != BATCH_VERSION) {
+        return false;
+    }
+    const size_t count = GetUInt32(bin.data() + 3);
+
+    // Get the columns, decompressing them if necessary.
+    ByteBlock plain;
+    const uint8_t* data = bin.data() + BATCH_HEADER_SIZE;
+    const uint8_t* end = bin.data() + bin.size();
+    if ((bin[2] & BATCH_FLAG_DEFLATE) != 0) {
+        if (!Zlib::Decompress(plain, data, end - data)) {
+            return false;
+        }
+        data = plain.data();
+        end = data + plain.size();
+    }
+
+    // The packet count comes from the untrusted input. Each packet consumes at
+    // least one byte of serialized time stamp, so a count larger than the
+    // payload is invalid. This bounds the allocation below before resizing.
+    if (count > size_t(end - data)) {
+        return false;
+    }
+    mdata.resize(count);
+
+    // Input time stamps, delta-encoded.
+    uint64_t previous = INVALID_PCR;
+    uint64_t value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!GetVarInt(data, end, value)) {
+            mdata.clear();
+            return false;
+        }
+        previous += UnZigZag(value);
+        mdata[i]._input_time = previous;
+    }
+
+    // Time sources and boolean flags, run-length encoded.
+    for (size_t i = 0; i < count; ) {
+        if (data >= end) {
+            mdata.clear();
+            return false;
+        }
+        const uint8_t byte = *data++;
+        if (!GetVarInt(data, end, value) || value == 0 || value > count - i) {
+            mdata.clear();
+            return false;
+        }
+        for (size_t run = 0; run < value; ++run, ++i) {
+            mdata[i]._input_stuffing = (byte & 0x80) != 0;
+            mdata[i]._nullified = (byte & 0x40) != 0;
+            mdata[i]._time_source = static_cast<TimeSource>(byte & 0x0F);
+        }
+    }
+
+    // Labels, run-length encoded.
+    for (size_t i = 0; i < count; ) {
+        if (end - data < 4) {
+            mdata.clear();
+            return false;
+        }
+        const TSPacketLabelSet labels(GetUInt32(data));
+        data += 4;
+        if (!GetVarInt(data, end, value) || value == 0 || value > count - i) {
+            mdata.clear();
+            return false;
+        }
+        for (size_t run = 0; run < value; ++run, ++i) {
+            mdata[i]._labels = labels;
+        }
+    }
+    return true;
+}
+
+
 //----------------------------------------------------------------------------
 // Static method to copy or reset contiguous TS packet metadata.
 //----------------------------------------------------------------------------
@@ -351,6 +351,39 @@ namespace ts {
         //!
         bool deserialize(const void* data, size_t size);
 
+        //!
+        //! First "magic" byte of a serialized batch of TSPacketMetadata.
+        //! @see SerializeBatch()
+        //!
+        static constexpr uint8_t BATCH_SERIALIZATION_MAGIC = SERIALIZATION_MAGIC + 1;
+
+        //!
+        //! Serialize a contiguous batch of TS packet metadata into a byteblock.
+        //!
+        //! Unlike serialize(), which writes a fixed size record per packet, the batch format
+        //! stores each field in a separate column: input time stamps are delta-encoded as
+        //! variable-length integers, time sources, flags and labels are run-length encoded.
+        //! On typical streams, this is several times smaller than one serialize() record per
+        //! packet. The columns can additionally be compressed with DEFLATE. The auxiliary
+        //! data are not included.
+        //!
+        //! @param [out] bin Returned binary data.
+        //! @param [in] mdata Address of the first metadata to serialize.
+        //! @param [in] count Number of metadata to serialize.
+        //! @param [in] compression_level Optional DEFLATE compression level, from 0 to 9.
+        //! When negative (the default), the columns are stored uncompressed.
+        //!
+        static void SerializeBatch(ByteBlock& bin, const TSPacketMetadata* mdata, size_t count, int compression_level = -1);
+
+        //!
+        //! Deserialize a batch of TS packet metadata from a byteblock.
+        //! @param [out] mdata Returned metadata, one per packet in the serialized batch.
+        //! @param [in] bin Binary data containing a batch which was serialized by SerializeBatch().
+        //! @return True on success, false if @a bin does not contain a valid batch.
+        //! In the latter case, @a mdata is returned empty.
+        //!
+        static bool DeserializeBatch(std::vector<TSPacketMetadata>& mdata, const ByteBlock& bin);
+
         //!
         //! Display the structure layout of the data structure (for debug only).
         //! @param [in,out] out Output stream, where to display.
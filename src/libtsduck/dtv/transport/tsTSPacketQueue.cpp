@@ -5,8 +5,20 @@
 // BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
 //
 //----------------------------------------------------------------------------
+//
+// The queue has one single writer thread and one single reader thread. The
+// write index is owned by the writer thread, the read index by the reader
+// thread. The two threads synchronize on the atomic packet count: it is
+// incremented by the writer after the packets are written and decremented
+// by the reader after the packets are copied out. All atomic operations use
+// the default sequential consistency, so that a thread which is about to
+// block always sees the waiting flag of the other one, and vice versa.
+// The mutex and condition variables are only used around the blocking waits.
+//
+//----------------------------------------------------------------------------
 
 #include "tsTSPacketQueue.h"
+#include "tsUSDT.h"
 
 
 //----------------------------------------------------------------------------
@@ -26,7 +38,8 @@ ts::TSPacketQueue::TSPacketQueue(size_t size) :
 
 void ts::TSPacketQueue::reset(size_t size)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    // Resetting the queue while one of the threads is active is illegal,
+    // see the header file. No synchronization is attempted here.
 
     // Resize the buffer if requested.
     if (size != NPOS) {
@@ -40,6 +53,7 @@ void ts::TSPacketQueue::reset(size_t size)
     _readIndex = 0;
     _writeIndex = 0;
     _bitrate = 0;
+    _cur_bitrate = 0;
 }
 
 
@@ -49,13 +63,12 @@ void ts::TSPacketQueue::reset(size_t size)
 
 size_t ts::TSPacketQueue::bufferSize() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    // The buffer is never resized while the threads are active.
     return _pkt_buffer.size();
 }
 
 size_t ts::TSPacketQueue::currentSize() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
     return _inCount;
 }
 
@@ -66,22 +79,33 @@ size_t ts::TSPacketQueue::currentSize() const
 
 bool ts::TSPacketQueue::lockWriteBuffer(TSPacket*& buffer, TSPacketMetadata*& mdata, size_t& buffer_size, size_t min_size)
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Maximum size we can allocate to the write window.
-    assert(_readIndex < _pkt_buffer.size());
-    assert(_writeIndex < _pkt_buffer.size());
-    const size_t max_size = _pkt_buffer.size() - _writeIndex;
+    const size_t buf_size = _pkt_buffer.size();
+    assert(_writeIndex < buf_size);
+    const size_t max_size = buf_size - _writeIndex;
 
     // We cannot ask for more than the distance to the end of the buffer.
     // But we also need to wait for at least one packet.
     min_size = std::max<size_t>(1, std::min(min_size, max_size));
 
-    // Wait until we get enough free space.
-    while (!_stopped && _pkt_buffer.size() - _inCount < min_size) {
-        _dequeued.wait(lock);
+    // Wait until we get enough free space. The queue is full: the writer
+    // thread is about to block until the reader catches up.
+    if (!_stopped && buf_size - _inCount < min_size) {
+        TS_PROBE3(queue_overflow, _inCount.load(), buf_size, min_size);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _writer_waiting = true;
+        while (!_stopped && buf_size - _inCount < min_size) {
+            _dequeued.wait(lock);
+        }
+        _writer_waiting = false;
     }
 
+    // Snapshot of the read index. Only the reader thread moves it and always
+    // in the direction which makes the write window larger, a stale value is
+    // conservative.
+    const size_t read_index = _readIndex;
+    assert(read_index < buf_size);
+
     // Return the write window.
     buffer = &_pkt_buffer[_writeIndex];
     mdata = &_md_buffer[_writeIndex];
@@ -89,9 +113,9 @@ bool ts::TSPacketQueue::lockWriteBuffer(TSPacket*& buffer, TSPacketMetadata*& md
         // The reader thread has reported a stop condition, we can no longer write into the buffer.
         buffer_size = 0;
     }
-    else if (_readIndex > _writeIndex) {
+    else if (read_index > _writeIndex) {
         // The write window extends up to the read index (where packets were not yet consumed).
-        buffer_size = _readIndex - _writeIndex;
+        buffer_size = read_index - _writeIndex;
     }
     else {
         // The write window wraps up at the end of the buffer.
@@ -110,12 +134,12 @@ bool ts::TSPacketQueue::lockWriteBuffer(TSPacket*& buffer, TSPacketMetadata*& md
 
 void ts::TSPacketQueue::releaseWriteBuffer(size_t count)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-
     // Verify that the specified size is compatible with the current write window.
-    assert(_readIndex < _pkt_buffer.size());
-    assert(_writeIndex < _pkt_buffer.size());
-    const size_t max_count = (_readIndex > _writeIndex ? _readIndex : _pkt_buffer.size()) - _writeIndex;
+    const size_t buf_size = _pkt_buffer.size();
+    const size_t read_index = _readIndex;
+    assert(read_index < buf_size);
+    assert(_writeIndex < buf_size);
+    const size_t max_count = (read_index > _writeIndex ? read_index : buf_size) - _writeIndex;
 
     // This is a bug in the application to specify more than the max size.
     assert(count <= max_count);
@@ -130,14 +154,19 @@ void ts::TSPacketQueue::releaseWriteBuffer(size_t count)
         for (size_t i = 0; i < count; ++i) {
             _pcr.feedPacket(_pkt_buffer[_writeIndex + i]);
         }
+        publishBitrate();
     }
 
-    // Mark written packets as part of the buffer.
+    // Mark written packets as part of the buffer. The index publication is
+    // batched: one single atomic increment for the whole write window.
+    _writeIndex = (_writeIndex + count) % buf_size;
     _inCount += count;
-    _writeIndex = (_writeIndex + count) % _pkt_buffer.size();
 
-    // Signal that packets have been enqueued
-    _enqueued.notify_all();
+    // Wake up the reader thread, only when it waits for packets.
+    if (_reader_waiting) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enqueued.notify_all();
+    }
 }
 
 
@@ -147,8 +176,6 @@ void ts::TSPacketQueue::releaseWriteBuffer(size_t count)
 
 void ts::TSPacketQueue::setBitrate(const BitRate& bitrate)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-
     // Remember the bitrate value.
     _bitrate = bitrate;
 
@@ -156,6 +183,7 @@ void ts::TSPacketQueue::setBitrate(const BitRate& bitrate)
     if (bitrate > 0) {
         _pcr.reset();
     }
+    publishBitrate();
 }
 
 
@@ -165,7 +193,6 @@ void ts::TSPacketQueue::setBitrate(const BitRate& bitrate)
 
 bool ts::TSPacketQueue::eof() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
     return _eof && _inCount == 0;
 }
 
@@ -176,29 +203,39 @@ bool ts::TSPacketQueue::eof() const
 
 void ts::TSPacketQueue::setEOF()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
     _eof = true;
 
     // We did not really enqueue packets but if a reader thread is waiting we need to wake it up.
+    std::lock_guard<std::mutex> lock(_mutex);
     _enqueued.notify_all();
 }
 
 
 //----------------------------------------------------------------------------
-// Get bitrate, must be called with mutex held.
+// Compute and publish the current bitrate, called by the writer thread.
 //----------------------------------------------------------------------------
 
-ts::BitRate ts::TSPacketQueue::getBitrate() const
+void ts::TSPacketQueue::publishBitrate()
 {
-    if (_bitrate != 0) {
-        return _bitrate;
-    }
-    else if (_pcr.bitrateIsValid()) {
-        return _pcr.bitrate188();
-    }
-    else {
-        return 0;
+    // The PCR analyzer and the input bitrate belong to the writer thread.
+    // Only the resulting value is shared with the reader thread.
+    BitRate bitrate = _bitrate;
+    if (bitrate == 0 && _pcr.bitrateIsValid()) {
+        bitrate = _pcr.bitrate188();
     }
+    std::lock_guard<std::mutex> lock(_bitrate_mutex);
+    _cur_bitrate = bitrate;
+}
+
+
+//----------------------------------------------------------------------------
+// Get the published bitrate, called by the reader thread.
+//----------------------------------------------------------------------------
+
+ts::BitRate ts::TSPacketQueue::getBitrate() const
+{
+    std::lock_guard<std::mutex> lock(_bitrate_mutex);
+    return _cur_bitrate;
 }
 
 
@@ -208,8 +245,6 @@ ts::BitRate ts::TSPacketQueue::getBitrate() const
 
 bool ts::TSPacketQueue::getPacket(TSPacket& packet, TSPacketMetadata* mdata, BitRate& bitrate)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-
     // Get bitrate, either from reader thread or from PCR analysis.
     bitrate = getBitrate();
 
@@ -218,59 +253,87 @@ bool ts::TSPacketQueue::getPacket(TSPacket& packet, TSPacketMetadata* mdata, Bit
         // No packet available.
         return false;
     }
-    else {
-        // Return next packet.
-        packet = _pkt_buffer[_readIndex];
-        if (mdata != nullptr) {
-            *mdata = _md_buffer[_readIndex];
-        }
-        _readIndex = (_readIndex + 1) % _pkt_buffer.size();
-        _inCount--;
 
-        // Signal the condition that a packet was freed.
-        _dequeued.notify_all();
+    // Return next packet.
+    const size_t read_index = _readIndex;
+    packet = _pkt_buffer[read_index];
+    if (mdata != nullptr) {
+        *mdata = _md_buffer[read_index];
+    }
+    _readIndex = (read_index + 1) % _pkt_buffer.size();
+    _inCount -= 1;
 
-        return true;
+    // Wake up the writer thread, only when it waits for free space.
+    if (_writer_waiting) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _dequeued.notify_all();
     }
+    return true;
 }
 
 
 //----------------------------------------------------------------------------
-// Called by the reader thread to wait for packets.
+// Called by the reader thread to get several packets without waiting.
 //----------------------------------------------------------------------------
 
-bool ts::TSPacketQueue::waitPackets(TSPacket* buffer, TSPacketMetadata* mdata, size_t buffer_count, size_t& actual_count, BitRate& bitrate)
+bool ts::TSPacketQueue::getPackets(TSPacket* buffer, TSPacketMetadata* mdata, size_t buffer_count, size_t& actual_count, BitRate& bitrate)
 {
     // Clear out params.
     actual_count = 0;
 
-    // Wait until there is some packet in the buffer.
-    std::unique_lock<std::mutex> lock(_mutex);
-    while (!_eof && !_stopped && _inCount == 0) {
-        _enqueued.wait(lock);
-    }
+    // Get bitrate, either from reader thread or from PCR analysis.
+    bitrate = getBitrate();
 
-    // Return as many packets as we can. Ignore eof for now.
-    while (_inCount > 0 && buffer_count > 0) {
-        *buffer++ = _pkt_buffer[_readIndex];
+    // Return as many packets as we can, without waiting.
+    const size_t buf_size = _pkt_buffer.size();
+    size_t avail = _inCount;
+    size_t read_index = _readIndex;
+    while (avail > 0 && buffer_count > 0) {
+        *buffer++ = _pkt_buffer[read_index];
         if (mdata != nullptr) {
-            *mdata++ = _md_buffer[_readIndex];
+            *mdata++ = _md_buffer[read_index];
         }
+        read_index = (read_index + 1) % buf_size;
+        avail--;
         buffer_count--;
         actual_count++;
-        _readIndex = (_readIndex + 1) % _pkt_buffer.size();
-        _inCount--;
     }
 
-    // Get bitrate, either from reader thread or from PCR analysis.
-    bitrate = getBitrate();
+    if (actual_count > 0) {
+        // The index publication is batched: one single atomic update for the whole batch.
+        _readIndex = read_index;
+        _inCount -= actual_count;
+
+        // Wake up the writer thread, only when it waits for free space.
+        if (_writer_waiting) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _dequeued.notify_all();
+        }
+    }
+    return actual_count > 0;
+}
 
-    // Signal that packets were freed.
-    _dequeued.notify_all();
 
+//----------------------------------------------------------------------------
+// Called by the reader thread to wait for packets.
+//----------------------------------------------------------------------------
+
+bool ts::TSPacketQueue::waitPackets(TSPacket* buffer, TSPacketMetadata* mdata, size_t buffer_count, size_t& actual_count, BitRate& bitrate)
+{
+    // Wait until there is some packet in the buffer.
+    if (!_eof && !_stopped && _inCount == 0) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _reader_waiting = true;
+        while (!_eof && !_stopped && _inCount == 0) {
+            _enqueued.wait(lock);
+        }
+        _reader_waiting = false;
+    }
+
+    // Return as many packets as we can. Ignore eof for now.
     // Return false when no packet is returned. Do not return false immediately
     // when _eof is true, wait for all enqueued packets to be returned.
-    return actual_count > 0;
+    return getPackets(buffer, mdata, buffer_count, actual_count, bitrate);
 }
 
 
@@ -280,12 +343,11 @@ bool ts::TSPacketQueue::waitPackets(TSPacket* buffer, TSPacketMetadata* mdata, s
 
 void ts::TSPacketQueue::stop()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-
     // Report a stop condition.
     _stopped = true;
 
     // Signal the condition that a packet was freed. This is not really freeing
     // a packet but it means that the writer thread should wake up.
+    std::lock_guard<std::mutex> lock(_mutex);
     _dequeued.notify_all();
 }
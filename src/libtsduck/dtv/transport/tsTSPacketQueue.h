@@ -36,6 +36,11 @@ namespace ts {
     //!
     //! Termination conditions can be triggered on both sides.
     //!
+    //! The queue is designed for one single writer thread and one single reader
+    //! thread. On the fast path, packets are exchanged through atomic indexes,
+    //! without locking. A mutex and condition variables are only used when one
+    //! thread must block: the writer on a full buffer, the reader on an empty one.
+    //!
     class TSDUCKDLL TSPacketQueue
     {
         TS_NOCOPY(TSPacketQueue);
@@ -125,6 +130,19 @@ namespace ts {
         //!
         bool getPacket(TSPacket& packet, TSPacketMetadata* mdata, BitRate& bitrate);
 
+        //!
+        //! Called by the reader thread to get several packets without waiting.
+        //! The reader thread is never suspended. Dequeuing packets by batches
+        //! amortizes the cost of the queue mutex over several packets.
+        //! @param [out] buffer Address of packet buffer.
+        //! @param [out] mdata Address of the packet metadata buffer. Can be null.
+        //! @param [in] buffer_count Size of @a buffer in number of packets.
+        //! @param [out] actual_count Number of returned packets in @a buffer.
+        //! @param [out] bitrate Input bitrate or zero if unknown.
+        //! @return True if at least one packet was returned in @a buffer.
+        //!
+        bool getPackets(TSPacket* buffer, TSPacketMetadata* mdata, size_t buffer_count, size_t& actual_count, BitRate& bitrate);
+
         //!
         //! Called by the reader thread to wait for packets.
         //! The reader thread is suspended until at least one packet is available.
@@ -149,20 +167,31 @@ namespace ts {
         void stop();
 
     private:
-        volatile bool                   _eof = false;      // The writer thread has reported an end of file.
-        volatile bool                   _stopped = false;  // The read thread has reported a stop condition.
-        mutable std::mutex              _mutex {};         // Protect access to shared data.
-        mutable std::condition_variable _enqueued {};      // Signaled when packets are inserted.
-        mutable std::condition_variable _dequeued {};      // Signaled when packets were freed.
-        TSPacketVector         _pkt_buffer {};   // The packet buffer.
-        TSPacketMetadataVector _md_buffer {};    // The packet metadata buffer.
-        PCRAnalyzer            _pcr {1, 12};     // PCR analyzer to get the bitrate.
-        size_t                 _inCount = 0;     // Number of packets currently inside the buffer.
-        size_t                 _readIndex = 0;   // Index of next packet to read.
-        size_t                 _writeIndex = 0;  // Index of next packet to write.
-        BitRate                _bitrate = 0;     // Bitrate as set by the writer thread.
-
-        // Get bitrate, must be called with mutex held.
+        std::atomic<bool>               _eof {false};             // The writer thread has reported an end of file.
+        std::atomic<bool>               _stopped {false};         // The read thread has reported a stop condition.
+        std::atomic<bool>               _reader_waiting {false};  // The reader thread waits on _enqueued.
+        std::atomic<bool>               _writer_waiting {false};  // The writer thread waits on _dequeued.
+        mutable std::mutex              _mutex {};                // Used with the two condition variables only.
+        mutable std::condition_variable _enqueued {};             // Signaled when packets are inserted.
+        mutable std::condition_variable _dequeued {};             // Signaled when packets were freed.
+        mutable std::mutex     _bitrate_mutex {};  // Protect _cur_bitrate between the two threads.
+        TSPacketVector         _pkt_buffer {};     // The packet buffer.
+        TSPacketMetadataVector _md_buffer {};      // The packet metadata buffer.
+        PCRAnalyzer            _pcr {1, 12};       // PCR analyzer to get the bitrate (writer thread only).
+        BitRate                _bitrate = 0;       // Bitrate as set by the writer thread (writer thread only).
+        BitRate                _cur_bitrate = 0;   // Published bitrate (under _bitrate_mutex).
+        size_t                 _writeIndex = 0;    // Index of next packet to write (writer thread only).
+
+        // The fields which are shared on the fast path are kept on separate
+        // cache lines to avoid false sharing between the two threads.
+        static constexpr size_t CACHE_LINE = 64;
+        alignas(CACHE_LINE) std::atomic<size_t> _readIndex {0};  // Index of next packet to read (written by the reader thread).
+        alignas(CACHE_LINE) std::atomic<size_t> _inCount {0};    // Number of packets currently inside the buffer.
+
+        // Get the published bitrate, called by the reader thread.
         BitRate getBitrate() const;
+
+        // Compute and publish the current bitrate, called by the writer thread.
+        void publishBitrate();
     };
 }
@@ -85,10 +85,9 @@ size_t ts::TSPacketStream::readPackets(TSPacket *buffer, TSPacketMetadata *metad
     size_t read_packets = 0;
     size_t read_size = 0;
 
-    // Header buffer for non-TS formats.
-    uint8_t header[MAX_HEADER_SIZE];
+    // Header size for non-TS formats.
     size_t header_size = packetHeaderSize();
-    assert(header_size <= sizeof(header));
+    assert(header_size <= MAX_HEADER_SIZE);
 
     // If format is autodetect, read one packet to check where the sync byte is.
     if (_format == TSPacketFormat::AUTODETECT) {
@@ -123,7 +122,7 @@ size_t ts::TSPacketStream::readPackets(TSPacket *buffer, TSPacketMetadata *metad
 
         // If there was a header, remove it and read the rest of the packet.
         header_size = packetHeaderSize();
-        assert(header_size <= sizeof(header));
+        assert(header_size <= MAX_HEADER_SIZE);
         if (header_size > 0) {
             char* data = reinterpret_cast<char*>(buffer);
             MemCopy(data, data + header_size, PKT_SIZE - header_size);
@@ -192,50 +191,78 @@ size_t ts::TSPacketStream::readPackets(TSPacket *buffer, TSPacketMetadata *metad
                 break;
             }
             case TSPacketFormat::RS204: {
-                // Read packet. Make sure that the trailer buffer from first packet is used in second packet.
-                uint8_t* const cbuffer = reinterpret_cast<uint8_t*>(buffer);
-                MemCopy(cbuffer, _trail, _trail_size);
-                success = _reader->readStreamComplete(cbuffer + _trail_size, PKT_SIZE - _trail_size, read_size, report);
+                // Bulk read whole 204-byte entries in a staging buffer and split
+                // packets and trailers from there, instead of two small reads per
+                // packet. Make sure that the trailer buffer from first packet is
+                // used in second packet.
+                constexpr size_t CHUNK_PACKETS = 64;
+                uint8_t chunk[CHUNK_PACKETS * PKT_RS_SIZE];
+                const size_t req_size = std::min(max_packets, CHUNK_PACKETS) * PKT_RS_SIZE;
+                MemCopy(chunk, _trail, _trail_size);
+                success = _reader->readStreamComplete(chunk + _trail_size, req_size - _trail_size, read_size, report);
                 read_size += _trail_size;
                 _trail_size = 0;
-                if (success && read_size == PKT_SIZE) {
-                    // Read trailer.
-                    success = _reader->readStreamComplete(_trail, RS_SIZE, read_size, report) && read_size == RS_SIZE;
-                    // Move to next packet.
-                    read_packets++;
-                    buffer++;
-                    max_packets--;
+                // Split packets and trailers. Truncate incomplete packets at end of file.
+                size_t count = read_size / PKT_RS_SIZE;
+                const size_t extra = read_size % PKT_RS_SIZE;
+                assert(count <= max_packets);
+                for (size_t i = 0; i < count; ++i) {
+                    MemCopy(buffer[i].b, chunk + i * PKT_RS_SIZE, PKT_SIZE);
+                    if (metadata != nullptr) {
+                        metadata[i].reset();
+                        metadata[i].setAuxData(chunk + i * PKT_RS_SIZE + PKT_SIZE, RS_SIZE);
+                    }
+                }
+                if (extra >= PKT_SIZE) {
+                    // One complete packet with a truncated trailer at end of file.
+                    MemCopy(buffer[count].b, chunk + count * PKT_RS_SIZE, PKT_SIZE);
                     if (metadata != nullptr) {
-                        metadata->reset();
-                        metadata->setAuxData(_trail, read_size);
-                        metadata++;
+                        metadata[count].reset();
+                        metadata[count].setAuxData(chunk + count * PKT_RS_SIZE + PKT_SIZE, extra - PKT_SIZE);
                     }
+                    count++;
+                }
+                read_packets += count;
+                buffer += count;
+                max_packets -= count;
+                if (metadata != nullptr) {
+                    metadata += count;
                 }
                 break;
             }
             case TSPacketFormat::M2TS:
             case TSPacketFormat::DUCK: {
-                // Read header + packet. No trailer was read at first packet.
-                success = _reader->readStreamComplete(header, header_size, read_size, report);
-                if (success && read_size == header_size) {
-                    success = _reader->readStreamComplete(buffer, PKT_SIZE, read_size, report);
-                    if (success && read_size == PKT_SIZE) {
-                        read_packets++;
-                        buffer++;
-                        max_packets--;
-                        if (metadata != nullptr) {
-                            if (_format == TSPacketFormat::M2TS) {
-                                // M2TS timestamps are in PCR units.
-                                metadata->reset();
-                                metadata->setInputTimeStamp(PCR(GetUInt32(header) & 0x3FFFFFFF), TimeSource::M2TS);
-                            }
-                            else {
-                                metadata->deserialize(header, TSPacketMetadata::SERIALIZATION_SIZE);
-                            }
-                            metadata++;
+                // Bulk read whole header + packet entries in a staging buffer and
+                // split headers and packets from there, instead of two small reads
+                // per packet. No trailer was read at first packet.
+                constexpr size_t CHUNK_PACKETS = 64;
+                uint8_t chunk[CHUNK_PACKETS * (MAX_HEADER_SIZE + PKT_SIZE)];
+                const size_t entry_size = header_size + PKT_SIZE;
+                const size_t req_size = std::min(max_packets, CHUNK_PACKETS) * entry_size;
+                success = _reader->readStreamComplete(chunk, req_size, read_size, report);
+                // Split headers and packets. Truncate incomplete packets at end of file.
+                const size_t count = read_size / entry_size;
+                assert(count <= max_packets);
+                for (size_t i = 0; i < count; ++i) {
+                    const uint8_t* const entry = chunk + i * entry_size;
+                    MemCopy(buffer[i].b, entry + header_size, PKT_SIZE);
+                    if (metadata != nullptr) {
+                        if (_format == TSPacketFormat::M2TS) {
+                            // M2TS timestamps are in PCR units.
+                            metadata[i].reset();
+                            metadata[i].setInputTimeStamp(PCR(GetUInt32(entry) & 0x3FFFFFFF), TimeSource::M2TS);
+                        }
+                        else {
+                            metadata[i].deserialize(entry, TSPacketMetadata::SERIALIZATION_SIZE);
                         }
                     }
                 }
+                read_packets += count;
+                buffer += count;
+                max_packets -= count;
+                if (metadata != nullptr) {
+                    metadata += count;
+                }
                 break;
             }
             default: {
@@ -276,32 +303,39 @@ bool ts::TSPacketStream::writePackets(const TSPacket* buffer, const TSPacketMeta
             break;
         }
         case TSPacketFormat::RS204: {
-            // Write packet + trailer, packet by packet.
-            uint8_t trailer[RS_SIZE];
-            bool trailer_ff = false;
-            size_t written_size = 0;
+            // Interleave packets and trailers in a staging buffer and write it in
+            // large chunks, instead of two writes per packet.
+            constexpr size_t CHUNK_PACKETS = 64;
+            uint8_t chunk[CHUNK_PACKETS * (PKT_SIZE + RS_SIZE)];
+            size_t fill = 0;
             for (size_t i = 0; success && i < packet_count; ++i) {
+                MemCopy(chunk + fill, buffer[i].b, PKT_SIZE);
+                fill += PKT_SIZE;
                 if (metadata != nullptr) {
-                    metadata[i].getAuxData(trailer, sizeof(trailer), 0xFF);
-                    trailer_ff = false;
+                    metadata[i].getAuxData(chunk + fill, RS_SIZE, 0xFF);
                 }
-                else if (!trailer_ff) {
-                    MemSet(trailer, 0xFF, sizeof(trailer));
-                    trailer_ff = true;
+                else {
+                    MemSet(chunk + fill, 0xFF, RS_SIZE);
                 }
-                success = _writer->writeStream(&buffer[i], PKT_SIZE, written_size, report) &&
-                          _writer->writeStream(trailer, sizeof(trailer), written_size, report);
-                if (success) {
-                    _total_write++;
+                fill += RS_SIZE;
+                if (fill >= sizeof(chunk) || i == packet_count - 1) {
+                    size_t written_size = 0;
+                    success = _writer->writeStream(chunk, fill, written_size, report);
+                    _total_write += written_size / (PKT_SIZE + RS_SIZE);
+                    fill = 0;
                 }
             }
             break;
         }
         case TSPacketFormat::M2TS:
         case TSPacketFormat::DUCK: {
-            // Write header + packet, packet by packet.
-            uint8_t header[MAX_HEADER_SIZE];
+            // Interleave headers and packets in a staging buffer and write it in
+            // large chunks, instead of two writes per packet.
+            constexpr size_t CHUNK_PACKETS = 64;
+            uint8_t chunk[CHUNK_PACKETS * (MAX_HEADER_SIZE + PKT_SIZE)];
             const size_t header_size = packetHeaderSize();
+            const size_t entry_size = header_size + PKT_SIZE;
+            size_t fill = 0;
             for (size_t i = 0; success && i < packet_count; ++i) {
                 // Get time stamp of current packet or reuse last one.
                 if (metadata != nullptr && metadata[i].hasInputTimeStamp()) {
@@ -310,23 +344,26 @@ bool ts::TSPacketStream::writePackets(const TSPacket* buffer, const TSPacketMeta
                 // Build header.
                 if (_format == TSPacketFormat::M2TS) {
                     // 30-bit time stamp in PCR units (2 most-significant bits are copy-control).
-                    PutUInt32(header, uint32_t(_last_timestamp.count()) & 0x3FFFFFFF);
+                    PutUInt32(chunk + fill, uint32_t(_last_timestamp.count()) & 0x3FFFFFFF);
                 }
                 else if (metadata != nullptr) {
                     // DUCK format with application-provided metadata.
-                    metadata[i].serialize(header, sizeof(header));
+                    metadata[i].serialize(chunk + fill, header_size);
                 }
                 else {
                     // DUCK format with default metadata.
                     TSPacketMetadata mdata;
-                    mdata.serialize(header, sizeof(header));
+                    mdata.serialize(chunk + fill, header_size);
                 }
-                // Write header, then packet.
-                size_t written_size = 0;
-                success = _writer->writeStream(header, header_size, written_size, report) &&
-                          _writer->writeStream(&buffer[i], PKT_SIZE, written_size, report);
-                if (success) {
-                    _total_write++;
+                fill += header_size;
+                // Then the packet.
+                MemCopy(chunk + fill, buffer[i].b, PKT_SIZE);
+                fill += PKT_SIZE;
+                if (fill + entry_size > sizeof(chunk) || i == packet_count - 1) {
+                    size_t written_size = 0;
+                    success = _writer->writeStream(chunk, fill, written_size, report);
+                    _total_write += written_size / entry_size;
+                    fill = 0;
                 }
             }
             break;
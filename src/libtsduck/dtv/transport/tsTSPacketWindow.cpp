@@ -20,6 +20,15 @@ void ts::TSPacketWindow::clear()
     _drop_count = 0;
     _last_range_index = 0;
     _ranges.clear();
+    _planes_valid = false;
+    _planes.labels.clear();
+    _planes.input_times.clear();
+    _planes.flags.clear();
+    _nulls_valid = false;
+    _null_runs.clear();
+    _stats_valid = false;
+    _stats.pids.clear();
+    _stats.pid_packets.clear();
 }
 
 
@@ -32,6 +41,12 @@ void ts::TSPacketWindow::addPacketsReference(TSPacket* pkt, TSPacketMetadata* md
     assert(pkt != nullptr);
     assert(mdata != nullptr);
 
+    // The SoA metadata view, the null packet index and the header statistics,
+    // if any, no longer describe the complete window.
+    _planes_valid = false;
+    _nulls_valid = false;
+    _stats_valid = false;
+
     // Enlarge the last range if the next packets are contiguous.
     if (!_ranges.empty()) {
         PacketRange& last(_ranges.back());
@@ -48,6 +63,132 @@ void ts::TSPacketWindow::addPacketsReference(TSPacket* pkt, TSPacketMetadata* md
 }
 
 
+//----------------------------------------------------------------------------
+// Get a structure-of-arrays view over the metadata of the packet window.
+//----------------------------------------------------------------------------
+
+ts::TSPacketWindow::MetadataPlanes& ts::TSPacketWindow::metadataPlanes()
+{
+    if (!_planes_valid) {
+        _planes.labels.resize(_size);
+        _planes.input_times.resize(_size);
+        _planes.flags.resize(_size);
+
+        // Gather each plane range by range, the metadata are contiguous inside a range.
+        for (const auto& range : _ranges) {
+            for (size_t i = 0; i < range.count; ++i) {
+                const TSPacketMetadata& md(range.metadata[i]);
+                const size_t wi = range.first + i;
+                _planes.labels[wi] = md.labels();
+                _planes.input_times[wi] = md.hasInputTimeStamp() ? uint64_t(md.getInputTimeStamp().count()) : INVALID_PCR;
+                _planes.flags[wi] = uint8_t((md.getInputStuffing() ? MetadataPlanes::FLAG_INPUT_STUFFING : 0) |
+                                            (md.getNullified() ? MetadataPlanes::FLAG_NULLIFIED : 0));
+            }
+        }
+        _planes_valid = true;
+    }
+    return _planes;
+}
+
+
+//----------------------------------------------------------------------------
+// Write back the labels plane into the packet metadata.
+//----------------------------------------------------------------------------
+
+void ts::TSPacketWindow::commitLabels()
+{
+    if (_planes_valid) {
+        for (const auto& range : _ranges) {
+            for (size_t i = 0; i < range.count; ++i) {
+                TSPacketMetadata& md(range.metadata[i]);
+                md.clearAllLabels();
+                md.setLabels(_planes.labels[range.first + i]);
+            }
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Get the runs of consecutive null packets inside the window.
+//----------------------------------------------------------------------------
+
+const std::vector<ts::TSPacketWindow::NullRun>& ts::TSPacketWindow::nullPacketRuns()
+{
+    if (!_nulls_valid) {
+        _null_runs.clear();
+
+        // Scan the window range by range, the packets are contiguous inside a range.
+        for (const auto& range : _ranges) {
+            for (size_t i = 0; i < range.count; ++i) {
+                const TSPacket& pkt(range.packets[i]);
+                if (pkt.b[0] == SYNC_BYTE && pkt.getPID() == PID_NULL) {
+                    const size_t wi = range.first + i;
+                    if (!_null_runs.empty() && _null_runs.back().first + _null_runs.back().count == wi) {
+                        // Extend the current run of null packets.
+                        _null_runs.back().count++;
+                    }
+                    else {
+                        // Start a new run.
+                        _null_runs.push_back({wi, 1});
+                    }
+                }
+            }
+        }
+        _nulls_valid = true;
+    }
+    return _null_runs;
+}
+
+
+//----------------------------------------------------------------------------
+// Get the per-window statistics over the TS packet headers.
+//----------------------------------------------------------------------------
+
+const ts::TSPacketWindow::HeaderStats& ts::TSPacketWindow::headerStats()
+{
+    if (!_stats_valid) {
+        // Reset the previous statistics. In the histogram, only the counters
+        // of the PID's which were present are reset, not all 8192 entries.
+        _stats.pid_packets.resize(PID_MAX, 0);
+        for (PID pid : _stats.pids) {
+            _stats.pid_packets[pid] = 0;
+        }
+        _stats.pids.clear();
+        _stats.null_count = 0;
+
+        // Sweep the window range by range, the packets are contiguous inside
+        // a range. Only the first four header bytes of each packet are read,
+        // with a fixed 188-byte stride, and the flag counters are updated
+        // without branches on the packet content.
+        size_t tei = 0;
+        size_t pusi = 0;
+        size_t scrambled = 0;
+        for (const auto& range : _ranges) {
+            const uint8_t* b = range.packets->b;
+            for (size_t i = 0; i < range.count; ++i, b += PKT_SIZE) {
+                if (b[0] == SYNC_BYTE) {
+                    const PID pid = PID(GetUInt16(b + 1) & 0x1FFF);
+                    tei += (b[1] >> 7) & 1;
+                    pusi += (b[1] >> 6) & 1;
+                    scrambled += size_t((b[3] & 0xC0) != 0);
+                    if (_stats.pid_packets[pid]++ == 0) {
+                        _stats.pids.push_back(pid);
+                    }
+                }
+            }
+        }
+        _stats.tei_count = tei;
+        _stats.pusi_count = pusi;
+        _stats.scrambled_count = scrambled;
+        _stats.null_count = _stats.pid_packets[PID_NULL];
+        std::sort(_stats.pids.begin(), _stats.pids.end());
+        _stats_valid = true;
+    }
+    return _stats;
+}
+
+
 //----------------------------------------------------------------------------
 // Get the address of a packet or metadata inside the window.
 //----------------------------------------------------------------------------
@@ -162,6 +303,9 @@ void ts::TSPacketWindow::nullify(size_t index)
         // Count nullified packets once only.
         _nullify_count++;
         *pkt = NullPacket;
+        // The null packet index and the header statistics, if any, are now incomplete.
+        _nulls_valid = false;
+        _stats_valid = false;
     }
 }
 
@@ -176,5 +320,8 @@ void ts::TSPacketWindow::drop(size_t index)
     if (pkt != nullptr) {
         _drop_count++;
         pkt->b[0] = 0;
+        // The dropped packet may have been indexed as a null packet or counted in the header statistics.
+        _nulls_valid = false;
+        _stats_valid = false;
     }
 }
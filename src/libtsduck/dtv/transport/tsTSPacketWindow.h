@@ -131,6 +131,101 @@ namespace ts {
         //!
         size_t segmentCount() const { return _ranges.size(); }
 
+        //!
+        //! Structure-of-arrays view over the metadata of the packet window.
+        //!
+        //! In the packet buffer, each TSPacketMetadata is interleaved with the others.
+        //! A plugin which only scans one field (the labels for instance) on each packet
+        //! drags one full metadata cache line per packet through the data cache. This
+        //! structure holds the same information in separate parallel arrays, one entry
+        //! per packet in the window, so that scanning one field touches a fraction of
+        //! the memory. All arrays have size() entries and are indexed like the window.
+        //!
+        class TSDUCKDLL MetadataPlanes
+        {
+        public:
+            MetadataPlanes() = default;               //!< Constructor.
+            std::vector<TSPacketLabelSet> labels {};  //!< Labels of each packet in the window.
+            std::vector<uint64_t> input_times {};     //!< Input timestamp of each packet in PCR units, INVALID_PCR if unknown.
+            std::vector<uint8_t> flags {};            //!< Flags of each packet, a bit mask of FLAG_* values.
+
+            static constexpr uint8_t FLAG_INPUT_STUFFING = 0x01;  //!< The packet was artificially inserted as input stuffing.
+            static constexpr uint8_t FLAG_NULLIFIED = 0x02;       //!< The packet was explicitly turned into a null packet by a plugin.
+        };
+
+        //!
+        //! Get a structure-of-arrays view over the metadata of the packet window.
+        //! The view is built on the first call and remains valid until the window is modified.
+        //! The arrays are read-only snapshots, except the labels which can be modified
+        //! and written back into the metadata using commitLabels().
+        //! @return A reference to the structure-of-arrays view, valid as long as this window is.
+        //!
+        MetadataPlanes& metadataPlanes();
+
+        //!
+        //! Write back the labels plane of the structure-of-arrays view into the packet metadata.
+        //! Only the labels are written back, the other planes are read-only snapshots.
+        //!
+        void commitLabels();
+
+        //!
+        //! Per-window statistics over the TS packet headers.
+        //!
+        //! Several plugins in a chain (analyzers, continuity checkers, bitrate
+        //! monitors) independently inspect the same four header bytes of every
+        //! packet. This structure holds the result of one single sweep over the
+        //! window, shared by all plugins which query it.
+        //!
+        class TSDUCKDLL HeaderStats
+        {
+        public:
+            HeaderStats() = default;     //!< Constructor.
+            size_t scrambled_count = 0;  //!< Number of packets with a non-zero transport scrambling control.
+            size_t tei_count = 0;        //!< Number of packets with the transport error indicator set.
+            size_t pusi_count = 0;       //!< Number of packets with the payload unit start indicator set.
+            size_t null_count = 0;       //!< Number of null packets.
+            std::vector<PID> pids {};    //!< List of PID's which are present in the window, in ascending order.
+            std::vector<uint32_t> pid_packets {};  //!< Packet count per PID, indexed by PID value (PID_MAX entries).
+        };
+
+        //!
+        //! Get the per-window statistics over the TS packet headers.
+        //!
+        //! The statistics are computed on the first call, with one tight sweep
+        //! over the packet headers, and cached for all subsequent callers in
+        //! the chain. They are invalidated when the window is modified or when
+        //! a packet is nullified or dropped; the next call recomputes them.
+        //! Dropped packets are not counted.
+        //!
+        //! @return A constant reference to the statistics, valid as long as
+        //! the window is not modified.
+        //!
+        const HeaderStats& headerStats();
+
+        //!
+        //! Description of a run of consecutive null packets inside the window.
+        //!
+        class TSDUCKDLL NullRun
+        {
+        public:
+            size_t first = 0;  //!< Index in the window of the first null packet of the run.
+            size_t count = 0;  //!< Number of consecutive null packets.
+        };
+
+        //!
+        //! Get the runs of consecutive null packets inside the window.
+        //!
+        //! Plugins which replace stuffing (data or table injectors for instance) all look
+        //! for the same null packets. The index is built once per window, on the first
+        //! call, so that all injectors in a chain share one scan instead of inspecting
+        //! the window packet by packet each. The index is invalidated when the window is
+        //! modified or when a packet is nullified or dropped; the next call rebuilds it.
+        //!
+        //! @return A constant reference to the list of runs of null packets, in ascending
+        //! order of window indexes. Valid as long as the window is not modified.
+        //!
+        const std::vector<NullRun>& nullPacketRuns();
+
     private:
         // This class describes a physically contiguous range of TS packets.
         class PacketRange
@@ -150,5 +245,11 @@ namespace ts {
         size_t                   _drop_count = 0;        // Number of dropped packets.
         mutable volatile size_t  _last_range_index = 0;  // Last accessed range (to optimiza sequential access).
         std::vector<PacketRange> _ranges {};             // Ranges of contiguous packets.
+        bool                     _planes_valid = false;  // The SoA metadata view is up to date.
+        MetadataPlanes           _planes {};             // SoA view over the metadata, built on demand.
+        bool                     _nulls_valid = false;   // The null packet index is up to date.
+        std::vector<NullRun>     _null_runs {};          // Runs of null packets, built on demand.
+        bool                     _stats_valid = false;   // The header statistics are up to date.
+        HeaderStats              _stats {};              // Header statistics, built on demand.
     };
 }
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsTSTimingFile.h"
+#include "tsMemory.h"
+
+
+//----------------------------------------------------------------------------
+// Create the capture file for writing.
+//----------------------------------------------------------------------------
+
+bool ts::TSTimingFile::openWrite(const fs::path& filename, Report& report)
+{
+    if (isOpen()) {
+        report.error(u"timing capture file already open");
+        return false;
+    }
+
+    _out.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!_out) {
+        report.error(u"error creating %s", filename);
+        return false;
+    }
+    _filename = filename;
+    _eof = false;
+
+    // Write the file header.
+    _data.clear();
+    _data.appendUInt32(FILE_MAGIC);
+    _data.appendUInt8(FILE_VERSION);
+    _out.write(reinterpret_cast<const char*>(_data.data()), std::streamsize(_data.size()));
+    if (!_out) {
+        report.error(u"error writing %s", _filename);
+        _out.close();
+        return false;
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Open an existing capture file for reading.
+//----------------------------------------------------------------------------
+
+bool ts::TSTimingFile::openRead(const fs::path& filename, Report& report)
+{
+    if (isOpen()) {
+        report.error(u"timing capture file already open");
+        return false;
+    }
+
+    _in.open(filename, std::ios::in | std::ios::binary);
+    if (!_in) {
+        report.error(u"error opening %s", filename);
+        return false;
+    }
+    _filename = filename;
+    _eof = false;
+
+    // Read and validate the file header.
+    uint8_t header[FILE_HEADER_SIZE];
+    _in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!_in || size_t(_in.gcount()) != sizeof(header) || GetUInt32(header) != FILE_MAGIC || header[4] != FILE_VERSION) {
+        report.error(u"%s is not a valid timing capture file", _filename);
+        _in.close();
+        return false;
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Close the capture file.
+//----------------------------------------------------------------------------
+
+bool ts::TSTimingFile::close(Report& report)
+{
+    bool success = true;
+    if (_out.is_open()) {
+        _out.close();
+        if (!_out) {
+            report.error(u"error closing %s", _filename);
+            success = false;
+        }
+    }
+    if (_in.is_open()) {
+        _in.close();
+    }
+    return success;
+}
+
+
+//----------------------------------------------------------------------------
+// Append one receive window to the capture file.
+//----------------------------------------------------------------------------
+
+bool ts::TSTimingFile::writeWindow(cn::nanoseconds timestamp, size_t buffer_packets, const TSPacketMetadata* mdata, size_t count, Report& report)
+{
+    // Serialize the packet metadata of the window as one columnar batch.
+    ByteBlock batch;
+    TSPacketMetadata::SerializeBatch(batch, mdata, count);
+
+    // Build and write the window record.
+    _data.clear();
+    _data.appendUInt64(uint64_t(timestamp.count()));
+    _data.appendUInt32(uint32_t(buffer_packets));
+    _data.appendUInt32(uint32_t(batch.size()));
+    _data.append(batch);
+    _out.write(reinterpret_cast<const char*>(_data.data()), std::streamsize(_data.size()));
+    if (!_out) {
+        report.error(u"error writing %s", _filename);
+        return false;
+    }
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Read the next receive window from the capture file.
+//----------------------------------------------------------------------------
+
+bool ts::TSTimingFile::readWindow(cn::nanoseconds& timestamp, size_t& buffer_packets, std::vector<TSPacketMetadata>& mdata, Report& report)
+{
+    mdata.clear();
+
+    // Read the window header. A clean end of file is expected here.
+    uint8_t header[WINDOW_HEADER_SIZE];
+    _in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (_in.eof() && _in.gcount() == 0) {
+        _eof = true;
+        return false;
+    }
+    if (!_in || size_t(_in.gcount()) != sizeof(header)) {
+        report.error(u"truncated timing capture file %s", _filename);
+        return false;
+    }
+    timestamp = cn::nanoseconds(cn::nanoseconds::rep(GetUInt64(header)));
+    buffer_packets = size_t(GetUInt32(header + 8));
+
+    // Read and deserialize the metadata batch.
+    const size_t batch_size = size_t(GetUInt32(header + 12));
+    _data.resize(batch_size);
+    _in.read(reinterpret_cast<char*>(_data.data()), std::streamsize(batch_size));
+    if (!_in || size_t(_in.gcount()) != batch_size || !TSPacketMetadata::DeserializeBatch(mdata, _data)) {
+        report.error(u"invalid timing capture file %s", _filename);
+        mdata.clear();
+        return false;
+    }
+    return true;
+}
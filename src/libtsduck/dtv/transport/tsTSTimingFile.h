@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Capture file of input timing, for deterministic replay.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsTSPacketMetadata.h"
+#include "tsReport.h"
+
+namespace ts {
+    //!
+    //! Capture file of input timing, for deterministic replay.
+    //! @ingroup libtsduck mpeg
+    //!
+    //! Some misbehaviours only show up with the packet arrival timing of a
+    //! live source and are lost when the stream is replayed from a plain
+    //! file. A timing capture file records the successive input operations
+    //! of a processing chain: for each receive window, the arrival time
+    //! since the start of the capture, the occupancy of the packet buffer
+    //! and the metadata of the received packets (including their input time
+    //! stamps), as one columnar batch (see TSPacketMetadata::SerializeBatch()).
+    //! The TS packets themselves are not stored; the capture file is a small
+    //! sidecar of a saved copy of the stream. Replaying the stream file with
+    //! the capture file reproduces the original pacing.
+    //!
+    //! This is the file format behind the tsp option --timing-capture and
+    //! the input plugin "file" option --timing-replay.
+    //!
+    class TSDUCKDLL TSTimingFile
+    {
+        TS_NOCOPY(TSTimingFile);
+    public:
+        //!
+        //! Default constructor.
+        //!
+        TSTimingFile() = default;
+
+        //!
+        //! Create the capture file for writing.
+        //! @param [in] filename Name of the capture file to create.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool openWrite(const fs::path& filename, Report& report);
+
+        //!
+        //! Open an existing capture file for reading.
+        //! @param [in] filename Name of the capture file to read.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool openRead(const fs::path& filename, Report& report);
+
+        //!
+        //! Close the capture file.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool close(Report& report);
+
+        //!
+        //! Check if the capture file is open.
+        //! @return True if the capture file is open.
+        //!
+        bool isOpen() const { return _in.is_open() || _out.is_open(); }
+
+        //!
+        //! Check if the end of the capture file was reached while reading.
+        //! @return True after readWindow() returned false because of the end of file.
+        //!
+        bool endOfFile() const { return _eof; }
+
+        //!
+        //! Append one receive window to the capture file.
+        //! @param [in] timestamp Arrival time of the window, since the start of the capture.
+        //! @param [in] buffer_packets Occupancy of the packet buffer, in packets, when the
+        //! window was received. This value is informational only and is not used on replay.
+        //! @param [in] mdata Address of the metadata of the first packet in the window.
+        //! @param [in] count Number of packets in the window.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool writeWindow(cn::nanoseconds timestamp, size_t buffer_packets, const TSPacketMetadata* mdata, size_t count, Report& report);
+
+        //!
+        //! Read the next receive window from the capture file.
+        //! @param [out] timestamp Arrival time of the window, since the start of the capture.
+        //! @param [out] buffer_packets Occupancy of the packet buffer, in packets, when the
+        //! window was received.
+        //! @param [out] mdata Metadata of the packets in the window, one per packet.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error or end of file. Use endOfFile() to
+        //! distinguish the end of file (not an error) from an invalid capture file.
+        //!
+        bool readWindow(cn::nanoseconds& timestamp, size_t& buffer_packets, std::vector<TSPacketMetadata>& mdata, Report& report);
+
+    private:
+        // File header: magic and format version.
+        static constexpr uint32_t FILE_MAGIC = 0x5453544D;  // "TSTM"
+        static constexpr uint8_t  FILE_VERSION = 1;
+        static constexpr size_t   FILE_HEADER_SIZE = 5;
+
+        // Each window record: 64-bit timestamp in nanoseconds, 32-bit buffer
+        // occupancy in packets, 32-bit size of the metadata batch, then the
+        // batch itself as serialized by TSPacketMetadata::SerializeBatch().
+        static constexpr size_t WINDOW_HEADER_SIZE = 16;
+
+        fs::path      _filename {};  // File name, for error messages.
+        std::ifstream _in {};        // Input stream, when open for reading.
+        std::ofstream _out {};       // Output stream, when open for writing.
+        bool          _eof = false;  // End of capture file was reached.
+        ByteBlock     _data {};      // Transient serialization buffer.
+    };
+}
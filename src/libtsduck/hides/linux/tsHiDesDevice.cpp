@@ -81,12 +81,14 @@
 class ts::HiDesDevice::Guts
 {
 public:
-    int             fd = -1;                // File descriptor.
-    bool            transmitting = false;   // Transmission in progress.
-    bool            waiting_write = false;  // The driver supports waiting write.
-    uint64_t        all_write = 0;          // Statistics: total number of write(2) operations.
-    uint64_t        fail_write = 0;         // Statistics: number of failed write(2) operations.
-    HiDesDeviceInfo info {};                // Portable device information.
+    int              fd = -1;                // File descriptor.
+    bool             transmitting = false;   // Transmission in progress.
+    bool             waiting_write = false;  // The driver supports waiting write.
+    BitRate          bitrate = 0;            // Nominal bitrate from tuning parameters.
+    uint64_t         all_write = 0;          // Statistics: total number of write(2) operations.
+    uint64_t         fail_write = 0;         // Statistics: number of failed write(2) operations.
+    cn::microseconds total_wait {};          // Statistics: total time spent waiting for the driver buffer.
+    HiDesDeviceInfo  info {};                // Portable device information.
 
     // Constructor, destructor.
     Guts() = default;
@@ -658,6 +660,9 @@ bool ts::HiDesDevice::tune(const ModulationArgs& in_params, Report& report)
         return false;
     }
 
+    // Keep the nominal bitrate, used to pace write retries in send().
+    _guts->bitrate = params.theoreticalBitrate();
+
     return true;
 }
 
@@ -706,6 +711,7 @@ bool ts::HiDesDevice::Guts::startTransmission(Report& report)
     transmitting = true;
     all_write = 0;
     fail_write = 0;
+    total_wait = cn::microseconds::zero();
 
     report.debug(u"HiDesDevice: starting transmission");
     return true;
@@ -729,7 +735,7 @@ bool ts::HiDesDevice::stopTransmission(Report& report)
 
 bool ts::HiDesDevice::Guts::stopTransmission(Report& report)
 {
-    report.debug(u"HiDesDevice: stopping transmission, total write: %'d, failed: %'d", all_write, fail_write);
+    report.debug(u"HiDesDevice: stopping transmission, total write: %'d, failed: %'d, buffer-full wait: %s", all_write, fail_write, total_wait);
 
     // Stop transfer.
     ite::TxStopTransferRequest stopRequest;
@@ -788,10 +794,16 @@ bool ts::HiDesDevice::Guts::send(const TSPacket* packets, size_t packet_count, R
 
     // With the patched it950x driver, a write operation waits for free space in
     // the device buffer. But, with the original driver, it immediately fails and
-    // we must retry later. In that case, we need to retry a number of times using
-    // short wait timers. These values are arbitrary and may require some tuning.
-    const ::useconds_t error_delay = 100;
-    const size_t max_retry = waiting_write ? 0 : 500;
+    // we must retry later. In that case, when the nominal bitrate is known, the
+    // wait is sized on the time the modulator needs to drain half a URB (the
+    // internal buffer unit of the driver): polling much faster than that only
+    // burns CPU in failed write(2) calls. Without bitrate, poll every 100 us.
+    // The total wait budget per chunk is about one second before giving up.
+    cn::microseconds error_delay = cn::microseconds(100);
+    if (bitrate > 0) {
+        error_delay = std::clamp(ByteInterval<cn::microseconds>(bitrate, ITE_MAX_SEND_BYTES / 2), cn::microseconds(100), cn::microseconds(20000));
+    }
+    const size_t max_retry = waiting_write ? 0 : std::max<size_t>(1, size_t(cn::microseconds(cn::seconds(1)) / error_delay));
     size_t retry_count = 0;
 
     while (remain > 0) {
@@ -832,7 +844,8 @@ bool ts::HiDesDevice::Guts::send(const TSPacket* packets, size_t packet_count, R
         }
         else if (retry_count < max_retry) {
             // Short wait and retry same I/O.
-            ::usleep(error_delay);
+            std::this_thread::sleep_for(error_delay);
+            total_wait += error_delay;
             retry_count++;
         }
         else {
@@ -8,6 +8,7 @@
 
 #include "tsSRTSocket.h"
 #include "tsLibSRT.h"
+#include "tsTS.h"
 #include "tsArgs.h"
 #include "tsjsonObject.h"
 #include "tsTime.h"
@@ -15,6 +16,7 @@
 #include "tsNullReport.h"
 #include "tsFatal.h"
 #include "tsFeatures.h"
+#include "tsThread.h"
 
 
 //----------------------------------------------------------------------------
@@ -387,7 +389,7 @@ ts::UString ts::SRTSocket::GetLibraryVersion()
 // Internal representation ("guts")
 //----------------------------------------------------------------------------
 
-class ts::SRTSocket::Guts
+class ts::SRTSocket::Guts : private Thread
 {
      TS_NOBUILD_NOCOPY(Guts);
 private:
@@ -397,13 +399,15 @@ public:
      Guts(SRTSocket* parent) : _parent(parent) {}
 
      bool send(const void* data, size_t size, const IPSocketAddress& dest, Report& report);
+     bool receive(void* data, size_t max_size, size_t& ret_size, cn::microseconds& timestamp, Report& report);
      bool setSockOpt(int optName, const char* optNameStr, const void* optval, size_t optlen, Report& report);
      bool setSockOptPre(Report& report);
      bool setSockOptPost(Report& report);
      bool srtListen(const IPSocketAddress& addr, Report& report);
      bool srtConnect(const IPSocketAddress& addr, Report& report);
      bool srtBind(const IPSocketAddress& addr, Report& report);
-     bool reportStats(Report& report);
+     void startStatsThread(Report& report);
+     void stopStatsThread();
 
      // Socket working data.
      IPSocketAddress      local_address {};
@@ -413,7 +417,13 @@ public:
      volatile ::SRTSOCKET listener  = SRT_INVALID_SOCK;  // Listener SRT socket when srt_listen() is used.
      size_t               total_sent_bytes = 0;
      size_t               total_received_bytes = 0;
-     Time                 next_stats {};
+
+     // Periodic statistics thread, active when stats_interval is not zero.
+     Report*                 stats_report = nullptr;
+     bool                    stats_started = false;
+     bool                    stats_stop = false;
+     std::mutex              stats_mutex {};
+     std::condition_variable stats_cv {};
 
      // Socket options.
      ::SRT_TRANSTYPE transtype = SRTT_INVALID;
@@ -459,6 +469,9 @@ public:
 private:
      // Callback which is called on any incoming connection.
      static int listenCallback(void* param, SRTSOCKET ns, int hsversion, const ::sockaddr* peeraddr, const char* streamid);
+
+     // Implementation of Thread: the periodic statistics thread.
+     virtual void main() override;
 };
 
 
@@ -577,8 +590,10 @@ bool ts::SRTSocket::open(SRTSocketMode mode,
 
     // Reset send/receive statistics.
     _guts->total_sent_bytes = _guts->total_received_bytes = 0;
-    if (_guts->stats_interval > cn::milliseconds::zero()) {
-        _guts->next_stats = Time::CurrentUTC() + _guts->stats_interval;
+
+    // Report periodic statistics from a dedicated thread, off the data path.
+    if (success) {
+        _guts->startStatsThread(report);
     }
 
     if (!success) {
@@ -596,6 +611,9 @@ bool ts::SRTSocket::close(Report& report)
 {
     report.debug(u"SRTSocket::close, sock = 0x%X, listener = 0x%X, final stats: %s", _guts->sock, _guts->listener, _guts->final_stats);
 
+    // Terminate the periodic statistics thread first, it uses the socket.
+    _guts->stopStatsThread();
+
     // Report final statistics if required.
     if (_guts->final_stats) {
         // Sometimes, final statistics are not available, typically when the peer disconnected.
@@ -657,20 +675,47 @@ bool ts::SRTSocket::getPeers(IPSocketAddress& local, IPSocketAddress& remote, Re
 
 
 //----------------------------------------------------------------------------
-// Report statistics when necessary.
+// The periodic statistics thread.
 //----------------------------------------------------------------------------
 
-bool ts::SRTSocket::Guts::reportStats(Report& report)
+void ts::SRTSocket::Guts::startStatsThread(Report& report)
+{
+    if (stats_interval > cn::milliseconds::zero() && !stats_started) {
+        stats_report = &report;
+        stats_stop = false;
+        stats_started = start();
+        if (!stats_started) {
+            report.warning(u"error starting SRT statistics thread");
+        }
+    }
+}
+
+void ts::SRTSocket::Guts::stopStatsThread()
 {
-    bool status = true;
-    if (stats_interval > cn::milliseconds::zero()) {
-        const Time now(Time::CurrentUTC());
-        if (now >= next_stats) {
-            next_stats = now + stats_interval;
-            status = _parent->reportStatistics(stats_mode, report);
+    if (stats_started) {
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            stats_stop = true;
         }
+        stats_cv.notify_all();
+        waitForTermination();
+        stats_started = false;
+    }
+}
+
+void ts::SRTSocket::Guts::main()
+{
+    for (;;) {
+        // Wait for the statistics interval or a termination request.
+        {
+            std::unique_lock<std::mutex> lock(stats_mutex);
+            stats_cv.wait_for(lock, stats_interval, [this]() { return stats_stop; });
+            if (stats_stop) {
+                break;
+            }
+        }
+        _parent->reportStatistics(stats_mode, *stats_report);
     }
-    return status;
 }
 
 
@@ -1074,7 +1119,7 @@ bool ts::SRTSocket::Guts::send(const void* data, size_t size, const IPSocketAddr
     }
 
     total_sent_bytes += size;
-    return reportStats(report);
+    return true;
 }
 
 
@@ -1089,38 +1134,72 @@ bool ts::SRTSocket::receive(void* data, size_t max_size, size_t& ret_size, Repor
 }
 
 bool ts::SRTSocket::receive(void* data, size_t max_size, size_t& ret_size, cn::microseconds& timestamp, Report& report)
+{
+    return _guts->receive(data, max_size, ret_size, timestamp, report);
+}
+
+bool ts::SRTSocket::Guts::receive(void* data, size_t max_size, size_t& ret_size, cn::microseconds& timestamp, Report& report)
 {
     ret_size = 0;
     timestamp = cn::microseconds(-1);
 
     // If socket was disconnected or aborted, silently fail.
-    if (_guts->disconnected || _guts->sock == SRT_INVALID_SOCK) {
+    if (disconnected || sock == SRT_INVALID_SOCK) {
         return false;
     }
 
-    // Message data
-    ::SRT_MSGCTRL ctrl;
-    TS_ZERO(ctrl);
-
-    const int ret = ::srt_recvmsg2(_guts->sock, reinterpret_cast<char*>(data), int(max_size), &ctrl);
-    if (ret < 0) {
-        // Differentiate peer disconnection (aka "end of file") and actual errors.
-        const int err = ::srt_getlasterror(nullptr);
-        if (err == SRT_ECONNLOST || err == SRT_EINVSOCK) {
-            _guts->disconnected = true;
+    // Maximum size of one message, to check if more messages fit in the buffer.
+    const size_t msg_max = payload_size > 0 ? size_t(payload_size) : size_t(SRT_LIVE_DEF_PLSIZE);
+    uint8_t* const buffer = reinterpret_cast<uint8_t*>(data);
+    size_t received = 0;
+
+    for (;;) {
+        // Receive one message. Block only for the first one.
+        ::SRT_MSGCTRL ctrl;
+        TS_ZERO(ctrl);
+        const int ret = ::srt_recvmsg2(sock, reinterpret_cast<char*>(buffer + received), int(max_size - received), &ctrl);
+        if (ret < 0) {
+            // Differentiate peer disconnection (aka "end of file") and actual errors.
+            const int err = ::srt_getlasterror(nullptr);
+            if (err == SRT_ECONNLOST || err == SRT_EINVSOCK) {
+                disconnected = true;
+            }
+            else if (sock != SRT_INVALID_SOCK) {
+                // Display error only if the socket was not closed in the meantime.
+                report.error(u"error during srt_recv(): %s", ::srt_getlasterror_str());
+            }
+            // Keep the messages which were already received, the error will show up again.
+            break;
         }
-        else if (_guts->sock != SRT_INVALID_SOCK) {
-            // Display error only if the socket was not closed in the meantime.
-            report.error(u"error during srt_recv(): %s", ::srt_getlasterror_str());
+        if (ret == 0) {
+            break;
+        }
+        if (received == 0 && ctrl.srctime != 0) {
+            // Use the source timestamp of the first message for the whole batch.
+            timestamp = cn::microseconds(cn::microseconds::rep(ctrl.srctime));
+        }
+        received += size_t(ret);
+
+        // In message mode, when the stream is made of raw TS packets, drain all messages
+        // which are already available in the receive buffer, as long as a full message
+        // fits in the caller's buffer. This avoids one library call per 1316-byte payload
+        // at high bitrates. Messages with another structure (such as RTP, where each
+        // message has its own header) are returned one by one, as before.
+        int avail = 0;
+        int avail_size = sizeof(avail);
+        if (!messageapi ||
+            buffer[0] != SYNC_BYTE ||
+            max_size - received < msg_max ||
+            ::srt_getsockflag(sock, SRTO_RCVDATA, &avail, &avail_size) < 0 ||
+            avail <= 0)
+        {
+            break;
         }
-        return false;
-    }
-    if (ctrl.srctime != 0) {
-        timestamp = cn::microseconds(cn::microseconds::rep(ctrl.srctime));
     }
-    ret_size = size_t(ret);
-    _guts->total_received_bytes += ret_size;
-    return _guts->reportStats(report);
+
+    ret_size = received;
+    total_received_bytes += received;
+    return received > 0;
 }
 
 
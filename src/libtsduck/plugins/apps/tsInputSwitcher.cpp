@@ -9,6 +9,7 @@
 #include "tsInputSwitcher.h"
 #include "tstsswitchCore.h"
 #include "tstsswitchCommandListener.h"
+#include "tsMetricsServer.h"
 #include "tsFatal.h"
 
 
@@ -79,6 +80,13 @@ bool ts::InputSwitcher::start(const InputSwitcherArgs& args)
         _success = _remote->open();
     }
 
+    // If a metrics server is specified, start an HTTP server thread.
+    if (_success && _args.metrics_server.server_addr.hasPort()) {
+        _metrics = new MetricsServer(_args.metrics_server, *_core, _report);
+        CheckNonNull(_metrics);
+        _success = _metrics->open();
+    }
+
     // Start the processing.
     _success = _success && _core->start();
 
@@ -134,11 +142,15 @@ void ts::InputSwitcher::stop()
 void ts::InputSwitcher::internalCleanup()
 {
     // Deleting each object waits for all its internal threads terminations.
-    // Terminate the remote control first since it references the core.
+    // Terminate the remote control and the metrics server first since they reference the core.
     if (_remote != nullptr) {
         delete _remote;
         _remote = nullptr;
     }
+    if (_metrics != nullptr) {
+        delete _metrics;
+        _metrics = nullptr;
+    }
 
     // Then, terminate the core.
     if (_core != nullptr) {
@@ -18,6 +18,7 @@
 namespace ts {
 
     // Used in private part.
+    class MetricsServer;
     namespace tsswitch {
         class Core;
         class CommandListener;
@@ -123,6 +124,7 @@ namespace ts {
         InputSwitcherArgs          _args {};
         tsswitch::Core*            _core = nullptr;
         tsswitch::CommandListener* _remote = nullptr;
+        MetricsServer*             _metrics = nullptr;
         volatile bool              _success = false;
 
         // Internal and unconditional cleanupp of resources.
@@ -41,6 +41,7 @@ void ts::InputSwitcherArgs::enforceDefaults()
 void ts::InputSwitcherArgs::defineArgs(Args& args)
 {
     remote_control.defineServerArgs(args);
+    metrics_server.defineServerArgs(args);
 
     args.option(u"allow", 'a', Args::IPADDR);
     args.help(u"allow",
@@ -50,7 +51,9 @@ void ts::InputSwitcherArgs::defineArgs(Args& args)
     args.option(u"buffer-packets", 'b', Args::POSITIVE);
     args.help(u"buffer-packets",
               u"Specify the size in TS packets of each input plugin buffer. "
-              u"The default is " + UString::Decimal(DEFAULT_BUFFERED_PACKETS) + u" packets.");
+              u"The default is " + UString::Decimal(DEFAULT_BUFFERED_PACKETS) + u" packets. "
+              u"The buffer is allocated only while the input plugin is started, "
+              u"the total buffer memory depends on the number of started inputs.");
 
     args.option(u"cycle", 'c', Args::POSITIVE);
     args.help(u"cycle",
@@ -140,6 +143,15 @@ void ts::InputSwitcherArgs::defineArgs(Args& args)
               u"the primary input, the reception is immediately switched back to it. "
               u"By default, there is no primary input, all input plugins are equal.");
 
+    args.option(u"metrics", 0, Args::IPSOCKADDR_OA);
+    args.help(u"metrics",
+              u"Specify the local TCP port on which an HTTP server exposes internal metrics: "
+              u"current input, packet counts, buffered packets, per plugin. "
+              u"The metrics are returned in JSON format by default, or in Prometheus text "
+              u"format with the query parameter \"format=prometheus\". "
+              u"If an optional address is specified, it must be a local IP address of the system. "
+              u"By default, there is no metrics server.");
+
     args.option(u"no-reuse-port");
     args.help(u"no-reuse-port",
               u"Disable the reuse port socket option for the remote control. "
@@ -160,6 +172,16 @@ void ts::InputSwitcherArgs::defineArgs(Args& args)
               u"If an optional address is specified, it must be a local IP address of the system. "
               u"By default, there is no remote control.");
 
+    args.option(u"standby-packets", 0, Args::POSITIVE);
+    args.help(u"standby-packets",
+              u"With --fast-switch, specify the number of packets to keep in the buffer "
+              u"of the input plugins which are not the current one. The non-current "
+              u"plugins continuously maintain a small rolling buffer of the most recent "
+              u"packets. When a switch occurs, the output resumes from these recent "
+              u"packets instead of replaying a full buffer of stale packets. "
+              u"By default, non-current plugins fill their complete buffer "
+              u"(--buffer-packets) before dropping the oldest packets.");
+
     args.option(u"terminate", 't');
     args.help(u"terminate", u"Terminate execution when the current input plugin terminates.");
 
@@ -177,7 +199,8 @@ bool ts::InputSwitcherArgs::loadArgs(DuckContext& duck, Args& args)
 {
     bool success =
         remote_control.loadServerArgs(args, u"remote") &&
-        remote_control.loadAllowedClients(args, u"allow");
+        remote_control.loadAllowedClients(args, u"allow") &&
+        metrics_server.loadServerArgs(args, u"metrics");
 
     app_name = args.appName();
     fast_switch = args.present(u"fast-switch");
@@ -185,6 +208,7 @@ bool ts::InputSwitcherArgs::loadArgs(DuckContext& duck, Args& args)
     terminate = args.present(u"terminate");
     args.getIntValue(cycle_count, u"cycle", args.present(u"infinite") ? 0 : 1);
     args.getIntValue(buffered_packets, u"buffer-packets", DEFAULT_BUFFERED_PACKETS);
+    standby_packets = std::min(args.intValue<size_t>(u"standby-packets", 0), buffered_packets);
     max_input_packets = std::min(args.intValue<size_t>(u"max-input-packets", DEFAULT_MAX_INPUT_PACKETS), buffered_packets / 2);
     args.getIntValue(max_output_packets, u"max-output-packets", DEFAULT_MAX_OUTPUT_PACKETS);
     remote_control.reuse_port = !args.present(u"no-reuse-port");
@@ -209,6 +233,10 @@ bool ts::InputSwitcherArgs::loadArgs(DuckContext& duck, Args& args)
         args.error(u"options --delayed-switch and --fast-switch are mutually exclusive");
         success = false;
     }
+    if (standby_packets > 0 && !fast_switch) {
+        args.error(u"option --standby-packets requires --fast-switch");
+        success = false;
+    }
 
     // Load all plugin descriptions. Default output is the standard output file.
     ArgsWithPlugins* pargs = dynamic_cast<ArgsWithPlugins*>(&args);
@@ -36,6 +36,7 @@ namespace ts {
         size_t              primary_input = NPOS;   //!< Index of primary input plugin, NPOS if there is none.
         size_t              cycle_count = 1;        //!< Number of input cycles to execute (0 = infinite).
         size_t              buffered_packets = 0;   //!< Input buffer size in packets.
+        size_t              standby_packets = 0;    //!< With fast_switch, number of packets to keep in non-current input buffers (0 = full buffer).
         size_t              max_input_packets = 0;  //!< Maximum input packets to read at a time.
         size_t              max_output_packets = 0; //!< Maximum output packets to send at a time.
         UString             event_command {};       //!< External shell command to run on an event.
@@ -45,6 +46,7 @@ namespace ts {
         UString             event_user_data {};     //!< User-defined data string in event messages.
         size_t              sock_buffer_size = 0;   //!< Socket buffer size.
         RestArgs            remote_control {u"remote control", u"remote"};  //!< Options for remote control (UDP or TCP/TLS).
+        RestArgs            metrics_server {u"metrics server", u"metrics"}; //!< Options for the HTTP metrics server.
         cn::milliseconds    receive_timeout {};     //!< Receive timeout before switch (0=none).
         PluginOptionsVector inputs {};              //!< Input plugins descriptions.
         PluginOptions       output {};              //!< Output plugin description.
@@ -102,6 +102,7 @@ void ts::LatencyMonitor::processPacket(const TSPacketVector& pkt, const TSPacket
         const bool has_pcr = pcr != INVALID_PCR;
         if (has_pcr) {
             const PCR timestamp = metadata[i].getInputTimeStamp();
+            _inputs[pluginIndex].timeSource = metadata[i].getInputTimeSource();
             // Checking to see if the buffer time has been reached, and pop back element (oldest element) if the buffer time has been reached
             while (!timingDataList.empty() && (timestamp - timingDataList.back().timestamp) >= _args.buffer_time) {
                 timingDataList.pop_back();
@@ -129,7 +130,9 @@ void ts::LatencyMonitor::csvHeader()
     *_output_file << "PCR1" << DEFAULT_CSV_SEPARATOR
                   << "PCR2" << DEFAULT_CSV_SEPARATOR
                   << "Latency (ms)" << DEFAULT_CSV_SEPARATOR
-                  << "Max Latency (ms)"
+                  << "Max Latency (ms)" << DEFAULT_CSV_SEPARATOR
+                  << "P99 Latency (ms)" << DEFAULT_CSV_SEPARATOR
+                  << "P99 Jitter (ms)"
                   << std::endl;
 }
 
@@ -145,6 +148,19 @@ void ts::LatencyMonitor::calculatePCRDelta(InputDataVector& inputs)
         return;
     }
 
+    // The latency is meaningful only when the two inputs use the same reference clock.
+    // Warn once when the time stamps come from different sources (e.g. kernel time
+    // stamps on one input and RTP time stamps on the other one).
+    if (!_clock_warned &&
+        inputs[0].timeSource != TimeSource::UNDEFINED &&
+        inputs[1].timeSource != TimeSource::UNDEFINED &&
+        inputs[0].timeSource != inputs[1].timeSource)
+    {
+        _report.warning(u"inputs use different time stamp sources (%s and %s), latency values may be offset",
+                        TimeSourceEnum().name(inputs[0].timeSource), TimeSourceEnum().name(inputs[1].timeSource));
+        _clock_warned = true;
+    }
+
     TimingDataList& timingDataList1 = inputs[0].timingDataList;
     TimingDataList& timingDataList2 = inputs[1].timingDataList;
 
@@ -177,11 +193,21 @@ void ts::LatencyMonitor::calculatePCRDelta(InputDataVector& inputs)
                 const PCR::rep pcrDelta = std::abs(refTimingData.timestamp.count() - shiftTimingData.timestamp.count());
                 const double latency = double(pcrDelta) / SYSTEM_CLOCK_FREQ * 1000;
                 _max_latency = std::max(_max_latency, latency);
+                _latency_quant.feed(latency);
+
+                // The jitter is the variation between two consecutive latency measurements.
+                if (_got_latency) {
+                    _jitter_quant.feed(std::abs(latency - _last_latency));
+                }
+                _last_latency = latency;
+                _got_latency = true;
 
                 *_output_file << (refTimingDataList == &timingDataList1 ? refTimingData.pcr : shiftTimingData.pcr) << DEFAULT_CSV_SEPARATOR
                               << (refTimingDataList == &timingDataList2 ? refTimingData.pcr : shiftTimingData.pcr) << DEFAULT_CSV_SEPARATOR
                               << latency << DEFAULT_CSV_SEPARATOR
-                              << _max_latency << std::endl;
+                              << _max_latency << DEFAULT_CSV_SEPARATOR
+                              << _latency_quant.quantile(0.99) << DEFAULT_CSV_SEPARATOR
+                              << _jitter_quant.quantile(0.99) << std::endl;
 
                 return;
             }
@@ -202,5 +228,7 @@ void ts::LatencyMonitor::calculatePCRDelta(InputDataVector& inputs)
     *_output_file << ((timingDataList1.empty()) ? "LOST" : std::to_string(timingDataList1.front().pcr)) << DEFAULT_CSV_SEPARATOR
                   << ((timingDataList2.empty()) ? "LOST" : std::to_string(timingDataList2.front().pcr)) << DEFAULT_CSV_SEPARATOR
                   << "N/A" << DEFAULT_CSV_SEPARATOR
+                  << "N/A" << DEFAULT_CSV_SEPARATOR
+                  << "N/A" << DEFAULT_CSV_SEPARATOR
                   << "N/A" << std::endl;
 }
@@ -13,6 +13,7 @@
 
 #pragma once
 #include "tsLatencyMonitorArgs.h"
+#include "tsTDigest.h"
 #include "tsTime.h"
 
 namespace ts {
@@ -70,6 +71,7 @@ namespace ts {
         {
             std::shared_ptr<tslatencymonitor::InputExecutor> inputExecutor;
             TimingDataList timingDataList;
+            TimeSource timeSource = TimeSource::UNDEFINED;
         };
         using InputDataVector = std::vector<InputData>;
 
@@ -78,6 +80,11 @@ namespace ts {
         InputDataVector      _inputs {};
         std::recursive_mutex _mutex {};              // Global mutex, protect access to all subsequent fields.
         double               _max_latency = 0;       // Maximum latency between two inputs
+        double               _last_latency = 0;      // Last measured latency, to compute the jitter
+        bool                 _got_latency = false;   // At least one latency sample was measured
+        bool                 _clock_warned = false;  // Warned about inputs using different time stamp sources
+        TDigest              _latency_quant {};      // Latency quantiles (p99), in constant memory
+        TDigest              _jitter_quant {};       // Latency variation quantiles (p99), in constant memory
         Time                 _last_output_time {};   // Timestamp to record last output time
         std::ofstream        _output_stream {};      // Output stream file
         std::ostream*        _output_file = nullptr; // Reference to actual output stream file
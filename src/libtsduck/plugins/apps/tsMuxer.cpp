@@ -8,6 +8,7 @@
 
 #include "tsMuxer.h"
 #include "tstsmuxCore.h"
+#include "tsMetricsServer.h"
 #include "tsFatal.h"
 
 
@@ -59,6 +60,20 @@ bool ts::Muxer::start(const MuxerArgs& args)
     // Allocate a muxer core object.
     _core = new tsmux::Core(args, *this, _report);
     CheckNonNull(_core);
+
+    // If a metrics server is specified, start an HTTP server thread.
+    if (_args.metrics_server.server_addr.hasPort()) {
+        _metrics = new MetricsServer(_args.metrics_server, *_core, _report);
+        CheckNonNull(_metrics);
+        if (!_metrics->open()) {
+            delete _metrics;
+            _metrics = nullptr;
+            delete _core;
+            _core = nullptr;
+            return false;
+        }
+    }
+
     return _core->start();
 }
 
@@ -83,6 +98,13 @@ void ts::Muxer::waitForTermination()
 {
     if (_core != nullptr) {
         _core->waitForTermination();
+    }
+    // The metrics server references the core, terminate it first.
+    if (_metrics != nullptr) {
+        delete _metrics;
+        _metrics = nullptr;
+    }
+    if (_core != nullptr) {
         delete _core;
         _core = nullptr;
     }
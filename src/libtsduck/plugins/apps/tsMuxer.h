@@ -18,6 +18,7 @@
 namespace ts {
 
     // Used in private part.
+    class MetricsServer;
     namespace tsmux {
         class Core;
     }
@@ -71,8 +72,9 @@ namespace ts {
         void waitForTermination();
 
     private:
-        Report&      _report;
-        MuxerArgs    _args {};
-        tsmux::Core* _core = nullptr;
+        Report&        _report;
+        MuxerArgs      _args {};
+        tsmux::Core*   _core = nullptr;
+        MetricsServer* _metrics = nullptr;
     };
 }
@@ -41,6 +41,8 @@ void ts::MuxerArgs::enforceDefaults()
 
 void ts::MuxerArgs::defineArgs(Args& args)
 {
+    metrics_server.defineServerArgs(args);
+
     args.option<BitRate>(u"bitrate", 'b');
     args.help(u"bitrate",
               u"Specify the target constant output bitrate in bits per seconds. "
@@ -91,6 +93,15 @@ void ts::MuxerArgs::defineArgs(Args& args)
               u"Specify the maximum number of TS packets to write at a time. "
               u"The default is " + UString::Decimal(DEFAULT_MAX_OUTPUT_PACKETS) + u" packets.");
 
+    args.option(u"metrics", 0, Args::IPSOCKADDR_OA);
+    args.help(u"metrics",
+              u"Specify the local TCP port on which an HTTP server exposes internal metrics: "
+              u"output bitrate, packet counts, per plugin. "
+              u"The metrics are returned in JSON format by default, or in Prometheus text "
+              u"format with the query parameter \"format=prometheus\". "
+              u"If an optional address is specified, it must be a local IP address of the system. "
+              u"By default, there is no metrics server.");
+
     args.option(u"nit", 0, TableScopeEnum());
     args.help(u"nit", u"type",
               u"Specify which type of NIT shall be merged in the output stream. The default is \"actual\".");
@@ -150,6 +161,8 @@ void ts::MuxerArgs::defineArgs(Args& args)
 
 bool ts::MuxerArgs::loadArgs(DuckContext& duck, Args& args)
 {
+    metrics_server.loadServerArgs(args, u"metrics");
+
     appName = args.appName();
     lossyInput = args.present(u"lossy-input");
     inputOnce = args.present(u"terminate");
@@ -14,6 +14,7 @@
 #pragma once
 #include "tsPluginOptions.h"
 #include "tsAbstractTable.h"
+#include "tsRestArgs.h"
 
 namespace ts {
 
@@ -53,6 +54,7 @@ namespace ts {
         TableScope          sdtScope = TableScope::ACTUAL;  //!< Type of SDT to filter.
         TableScope          eitScope = TableScope::ACTUAL;  //!< Type of EIT to filter.
         size_t              timeInputIndex = NPOS;          //!< Index of input plugin from which the TDT/TOT PID is used. By default, use the first found.
+        RestArgs            metrics_server {u"metrics server", u"metrics"};  //!< Options for the HTTP metrics server.
         DuckContext::SavedArgs duckArgs {};                 //!< Default TSDuck context options for all plugins. Each plugin can override them in its context.
 
         static constexpr size_t DEFAULT_MAX_INPUT_PACKETS = 128;      //!< Default maximum input packets to read at a time.
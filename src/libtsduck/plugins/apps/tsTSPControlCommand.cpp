@@ -35,6 +35,13 @@ ts::TSPControlCommand::TSPControlCommand(Report& report) :
 
     arg = command(u"list", u"List all running plugins", u"[options]", flags);
 
+    arg = command(u"metrics", u"Report performance metrics of all running plugins", u"[options]", flags);
+    arg->setIntro(u"For each plugin, report the number of processed packets, the packet rate, "
+                  u"the mean and maximum duration of one processing phase and of one wait for "
+                  u"packets. With --verbose, also report a logarithmic histogram of the wait "
+                  u"times, useful to spot the bottleneck plugin of a chain (a bottleneck "
+                  u"almost never waits, its successors show long waits).");
+
     arg = command(u"suspend", u"Suspend a plugin", u"[options] plugin-index", flags);
     arg->setIntro(u"Suspend a plugin. When a packet processing plugin is suspended, "
                   u"the TS packets are directly passed from the previous to the next plugin, "
@@ -52,8 +59,31 @@ ts::TSPControlCommand::TSPControlCommand(Report& report) :
     arg->option(u"", 0, Args::STRING, 1, Args::UNLIMITED_COUNT);
     arg->help(u"",
               u"Index of the plugin to restart, followed by the new plugin parameters to use.");
+    arg->option(u"no-wait", 'n');
+    arg->help(u"no-wait",
+              u"Do not wait for the completion of the restart. The command returns immediately "
+              u"and the result of the restart is reported in the tsp process log. "
+              u"By default, the command waits for the completion of the restart and reports its result. "
+              u"A restart can be slow (e.g. tuner or network reconnection) and, while a synchronous "
+              u"restart is in progress, other control commands are delayed.");
+
     arg->option(u"same", 's');
     arg->help(u"same",
               u"Restart the plugin with the same options and parameters. "
               u"By default, when no plugin options are specified, restart with no option at all.");
+
+    arg = command(u"reconfigure", u"Change plugin parameters without restarting it", u"[options] plugin-index [plugin-options ...]", flags | Args::GATHER_PARAMETERS);
+    arg->setIntro(u"Apply new parameters to a running plugin, in place, between two processing "
+                  u"passes. Unlike 'restart', the plugin is not stopped and restarted: its "
+                  u"internal state and the packet buffer are preserved and the stream is not "
+                  u"interrupted. The plugin must support in-place reconfiguration; if it does "
+                  u"not, or if it rejects the new parameters, it continues with the previous ones.");
+    arg->option(u"", 0, Args::STRING, 1, Args::UNLIMITED_COUNT);
+    arg->help(u"",
+              u"Index of the plugin to reconfigure, followed by the new plugin parameters to use.");
+    arg->option(u"no-wait", 'n');
+    arg->help(u"no-wait",
+              u"Do not wait for the completion of the reconfiguration. The command returns "
+              u"immediately and the result is reported in the tsp process log. "
+              u"By default, the command waits for the completion of the reconfiguration and reports its result.");
 }
@@ -109,10 +109,23 @@ bool ts::TSProcessor::start(const TSProcessorArgs& args)
         // plugin has a hight priority to make room in the buffer, but not as
         // high as the input which must remain the top-most priority?
 
-        _input = new tsp::InputExecutor(_args, *this, _args.input, ThreadAttributes().setPriority(ts::ThreadAttributes::GetMaximumPriority()), _global_mutex, &_report);
+        // Helper to build the thread attributes of a plugin executor. With option
+        // --pin-threads, each plugin thread is pinned on one CPU, in round-robin
+        // order over the specified list of CPU indexes.
+        size_t next_cpu = 0;
+        auto thread_attributes = [this, &next_cpu](int priority) {
+            ThreadAttributes attr;
+            attr.setPriority(priority);
+            if (!_args.pinned_cpus.empty()) {
+                attr.setAffinity({_args.pinned_cpus[next_cpu++ % _args.pinned_cpus.size()]});
+            }
+            return attr;
+        };
+
+        _input = new tsp::InputExecutor(_args, *this, _args.input, thread_attributes(ts::ThreadAttributes::GetMaximumPriority()), _global_mutex, &_report);
         CheckNonNull(_input);
 
-        _output = new tsp::OutputExecutor(_args, *this, _args.output, ThreadAttributes().setPriority(ts::ThreadAttributes::GetHighPriority()), _global_mutex, &_report);
+        _output = new tsp::OutputExecutor(_args, *this, _args.output, thread_attributes(ts::ThreadAttributes::GetHighPriority()), _global_mutex, &_report);
         CheckNonNull(_output);
 
         _output->ringInsertAfter(_input);
@@ -121,7 +134,7 @@ bool ts::TSProcessor::start(const TSProcessorArgs& args)
         bool realtime = _args.realtime == Tristate::True || _input->isRealTime() || _output->isRealTime();
 
         for (size_t i = 0; i < _args.plugins.size(); ++i) {
-            tsp::PluginExecutor* p = new tsp::ProcessorExecutor(_args, *this, i, ThreadAttributes(), _global_mutex, &_report);
+            tsp::PluginExecutor* p = new tsp::ProcessorExecutor(_args, *this, i, thread_attributes(ts::ThreadAttributes::GetNormalPriority()), _global_mutex, &_report);
             CheckNonNull(p);
             p->ringInsertBefore(_output);
             realtime = realtime || p->isRealTime();
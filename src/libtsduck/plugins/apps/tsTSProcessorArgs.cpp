@@ -34,6 +34,7 @@ ts::TSProcessorArgs::TSProcessorArgs()
 void ts::TSProcessorArgs::defineArgs(Args& args)
 {
     control.defineServerArgs(args);
+    metrics_server.defineServerArgs(args);
 
     args.option(u"add-input-stuffing", 'a', Args::STRING);
     args.help(u"add-input-stuffing", u"nullpkt/inpkt",
@@ -131,6 +132,15 @@ void ts::TSProcessorArgs::defineArgs(Args& args)
               u"a valid bitrate value from the beginning. "
               u"The default initial load is half the size of the global buffer.");
 
+    args.option(u"lock-free-buffer");
+    args.help(u"lock-free-buffer",
+              u"Coordinate the plugin threads using lock-free atomic sequence counters "
+              u"instead of the default mutex and condition variables. Each plugin thread "
+              u"claims contiguous windows of packets in the global buffer without blocking "
+              u"system calls. This reduces wakeup and lock contention with long plugin "
+              u"chains at high bitrates, at the expense of a higher idle CPU usage "
+              u"(waiting threads spin and yield instead of sleeping).");
+
     args.option(u"log-plugin-index");
     args.help(u"log-plugin-index",
               u"In log messages, add the plugin index to the plugin name. "
@@ -165,6 +175,35 @@ void ts::TSProcessorArgs::defineArgs(Args& args)
               u"This option is useful only when an output plugin or device has problems with large output requests. "
               u"This option forces multiple smaller send operations.");
 
+    args.option(u"metrics", 0, Args::IPSOCKADDR_OA);
+    args.help(u"metrics",
+              u"Specify the local TCP port on which an HTTP server exposes internal metrics: "
+              u"packet counts, processing and wait times, per plugin. "
+              u"The metrics are returned in JSON format by default, or in Prometheus text "
+              u"format with the query parameter \"format=prometheus\". "
+              u"If an optional address is specified, it must be a local IP address of the system. "
+              u"By default, there is no metrics server.");
+
+    args.option(u"parallel", 0, Args::POSITIVE);
+    args.help(u"parallel",
+              u"Specify a number of worker threads for packet processor plugins which "
+              u"declare themselves safe for parallel processing. Such a plugin works in "
+              u"packet window mode and each window is split into that many disjoint "
+              u"sub-windows which are processed concurrently. The original packet order "
+              u"is preserved. Plugins without the parallel-safe capability are not affected. "
+              u"By default, each plugin processes its packets in one single thread.");
+
+    args.option(u"pin-threads", 0, Args::UNSIGNED, 0, Args::UNLIMITED_COUNT);
+    args.help(u"pin-threads", u"cpu1[-cpu2]",
+              u"Pin the plugin threads on the specified CPU indexes, in round-robin order "
+              u"(input plugin first, then packet processors, then output plugin). "
+              u"Several --pin-threads options or ranges of CPU indexes are allowed. "
+              u"On NUMA systems, pinning all threads on the CPU's of one node avoids "
+              u"remote memory accesses on the global packet buffer. In that case, start "
+              u"tsp with a memory policy bound to the same node (e.g. using numactl) so "
+              u"that the buffer pages are allocated on that node. "
+              u"This option is ignored on systems without CPU affinity support.");
+
     args.option(u"realtime", 'r', Args::TRISTATE, 0, 1, -255, 256, true);
     args.help(u"realtime",
               u"Specifies if tsp and all plugins should use default values for real-time "
@@ -174,6 +213,25 @@ void ts::TSProcessorArgs::defineArgs(Args& args)
               u"are enforced. The explicit values 'no', 'false', 'off' are used to enforce "
               u"the offline defaults and the explicit values 'yes', 'true', 'on' are used "
               u"to enforce the real-time defaults.");
+
+    args.option(u"spin-wait", 0, Args::UNSIGNED);
+    args.help(u"spin-wait", u"count",
+              u"When a plugin thread waits for packets from the previous plugin, spin on "
+              u"the packet counter for the specified number of iterations before sleeping "
+              u"on a condition variable. At high packet rates, the previous plugin usually "
+              u"delivers packets within the spin budget and the two context switches of a "
+              u"sleep/wake cycle are avoided. At low rates, the budget is quickly exhausted "
+              u"and the thread sleeps as usual. By default, the threads sleep immediately. "
+              u"This option is ignored with --lock-free-buffer (which always spins).");
+
+    args.option(u"timing-capture", 0, Args::FILENAME);
+    args.help(u"timing-capture", u"filename",
+              u"Record the input timing in the specified capture file. "
+              u"For each input operation, the arrival time, the buffer occupancy and the "
+              u"metadata of the received packets (including their input time stamps) are recorded. "
+              u"Replaying a saved copy of the stream with the input plugin 'file' and its option "
+              u"--timing-replay reproduces the original input pacing, to investigate "
+              u"timing-sensitive misbehaviours offline.");
 }
 
 
@@ -183,7 +241,7 @@ void ts::TSProcessorArgs::defineArgs(Args& args)
 
 bool ts::TSProcessorArgs::loadArgs(DuckContext& duck, Args& args)
 {
-    bool success = control.loadServerArgs(args, u"control");
+    bool success = control.loadServerArgs(args, u"control") && metrics_server.loadServerArgs(args, u"metrics");
 
     // Legacy options when --control is not specified.
     if (!args.present(u"control")) {
@@ -197,6 +255,8 @@ bool ts::TSProcessorArgs::loadArgs(DuckContext& duck, Args& args)
 
     app_name = args.appName();
     log_plugin_index = args.present(u"log-plugin-index");
+    lock_free = args.present(u"lock-free-buffer");
+    args.getIntValue(spin_wait, u"spin-wait", 0);
     ts_buffer_size = args.intValue<size_t>(u"buffer-size-mb", DEFAULT_BUFFER_SIZE);
     args.getValue(fixed_bitrate, u"bitrate", 0);
     args.getChronoValue(bitrate_adj, u"bitrate-adjust-interval", DEFAULT_BITRATE_INTERVAL);
@@ -204,11 +264,14 @@ bool ts::TSProcessorArgs::loadArgs(DuckContext& duck, Args& args)
     args.getIntValue(max_input_pkt, u"max-input-packets", 0);
     args.getIntValue(max_output_pkt, u"max-output-packets", NPOS); // unlimited by default
     args.getIntValue(init_input_pkt, u"initial-input-packets", 0);
+    args.getIntValue(parallel, u"parallel", 0);
+    args.getIntValues(pinned_cpus, u"pin-threads");
     args.getIntValue(instuff_start, u"add-start-stuffing", 0);
     args.getIntValue(instuff_stop, u"add-stop-stuffing", 0);
     ignore_jt = args.present(u"ignore-joint-termination");
     args.getTristateValue(realtime, u"realtime");
     args.getChronoValue(receive_timeout, u"receive-timeout");
+    args.getPathValue(timing_capture, u"timing-capture");
     args.getChronoValue(final_wait, u"final-wait", cn::milliseconds(-1));
     args.getChronoValue(control.receive_timeout, u"control-timeout", DEFAULT_CONTROL_TIMEOUT);
     control.reuse_port = args.present(u"control-reuse-port");
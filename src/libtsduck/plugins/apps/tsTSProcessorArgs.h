@@ -30,11 +30,15 @@ namespace ts {
         UString           app_name {};              //!< Application name, for help messages.
         bool              ignore_jt = false;        //!< Ignore "joint termination" options in plugins.
         bool              log_plugin_index = false; //!< Log plugin index with plugin name.
+        bool              lock_free = false;        //!< Use lock-free coordination between plugin threads (atomic sequence counters instead of mutex/condition).
+        size_t            spin_wait = 0;            //!< Spin on the packet counter for this number of iterations before sleeping, when waiting for packets (zero means sleep immediately).
         size_t            ts_buffer_size = DEFAULT_BUFFER_SIZE; //!< Size in bytes of the global TS packet buffer.
         size_t            max_flush_pkt = 0;        //!< Max processed packets before flush.
         size_t            max_input_pkt = 0;        //!< Max packets per input operation.
         size_t            max_output_pkt = NPOS;    //!< Max packets per outsput operation. NPOS means unlimited.
         size_t            init_input_pkt = 0;       //!< Initial number of input packets to read before starting the processing (zero means default).
+        size_t            parallel = 0;             //!< Number of worker threads for parallel-safe packet processor plugins (zero or one means no parallelism).
+        std::vector<size_t> pinned_cpus {};         //!< List of CPU indexes on which the plugin threads are pinned, round-robin (empty means no pinning).
         size_t            instuff_nullpkt = 0;      //!< Add input stuffing: add @a instuff_nullpkt null packets every @a instuff_inpkt input packets.
         size_t            instuff_inpkt = 0;        //!< Add input stuffing: add @a instuff_nullpkt null packets every @a instuff_inpkt input packets.
         size_t            instuff_start = 0;        //!< Add input stuffing: add @a instuff_start null packets before actual input.
@@ -44,8 +48,10 @@ namespace ts {
         PacketCounter     init_bitrate_adj = DEFAULT_INIT_BITRATE_PKT_INTERVAL; //!< As long as input bitrate is unknown, reevaluate periodically.
         Tristate          realtime = Tristate::Maybe; //!< Use real-time options.
         cn::milliseconds  receive_timeout {};       //!< Timeout on input operations.
+        fs::path          timing_capture {};        //!< File where the input timing is captured for later replay (empty means none).
         cn::milliseconds  final_wait = cn::milliseconds(-1);     //!< Time to wait after last input packet. Zero means infinite, negative means none.
         RestArgs          control {u"control port", u"control"}; //!< Options for remote control (TCP/Telnet or TCP/TLS).
+        RestArgs          metrics_server {u"metrics server", u"metrics"}; //!< Options for the HTTP metrics server.
         DuckContext::SavedArgs duck_args {};        //!< Default TSDuck context options for all plugins. Each plugin can override them in its context.
         PluginOptions          input {};            //!< Input plugin description.
         PluginOptionsVector    plugins {};          //!< Packet processor plugins descriptions.
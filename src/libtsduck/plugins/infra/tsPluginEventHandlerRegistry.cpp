@@ -11,6 +11,45 @@
 // A common empty criteria, meaning "any event".
 const ts::PluginEventHandlerRegistry::Criteria ts::PluginEventHandlerRegistry::Criteria::Any;
 
+// Per-thread guard against recursive event dispatch from within an event handler.
+namespace {
+    thread_local bool calling_handlers = false;
+}
+
+
+//----------------------------------------------------------------------------
+// Rebuild and publish a new snapshot from the handler list (with mutex held).
+//----------------------------------------------------------------------------
+
+void ts::PluginEventHandlerRegistry::publishSnapshot()
+{
+    auto snap = std::make_shared<Snapshot>();
+
+    // Create one bucket per event code which appears in some criteria.
+    for (const auto& it : _handlers) {
+        if (it.second.event_code.has_value()) {
+            snap->by_code[it.second.event_code.value()];
+        }
+    }
+
+    // Distribute the handlers in the buckets, preserving registration order.
+    for (const auto& it : _handlers) {
+        if (it.second.event_code.has_value()) {
+            snap->by_code[it.second.event_code.value()].push_back(it);
+        }
+        else {
+            // No event code criteria: can match any code.
+            for (auto& bucket : snap->by_code) {
+                bucket.second.push_back(it);
+            }
+            snap->others.push_back(it);
+        }
+    }
+
+    // Atomically publish the new snapshot. Dispatches in progress keep using the old one.
+    _snapshot.store(snap);
+}
+
 
 //----------------------------------------------------------------------------
 // Register an event handler.
@@ -18,10 +57,10 @@ const ts::PluginEventHandlerRegistry::Criteria ts::PluginEventHandlerRegistry::C
 
 void ts::PluginEventHandlerRegistry::registerEventHandler(PluginEventHandlerInterface* handler, const Criteria& criteria)
 {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    std::lock_guard<std::mutex> lock(_mutex);
 
-    // Don't register null handlers, don't call from an event handler.
-    if (handler != nullptr && !_calling_handlers) {
+    // Don't register null handlers.
+    if (handler != nullptr) {
 
         // Look through the list to find an identical handler with the same criteria.
         for (const auto& it : _handlers) {
@@ -38,6 +77,7 @@ void ts::PluginEventHandlerRegistry::registerEventHandler(PluginEventHandlerInte
 
         // Finally add a new entry at the end of the list.
         _handlers.push_back(std::make_pair(handler, criteria));
+        publishSnapshot();
     }
 }
 
@@ -48,26 +88,24 @@ void ts::PluginEventHandlerRegistry::registerEventHandler(PluginEventHandlerInte
 
 void ts::PluginEventHandlerRegistry::unregisterEventHandler(PluginEventHandlerInterface* handler)
 {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    std::lock_guard<std::mutex> lock(_mutex);
 
-    // Don't call from an event handler.
-    if (!_calling_handlers) {
-        if (handler == nullptr) {
-            // Remove all handlers.
-            _handlers.clear();
-        }
-        else {
-            // Remove all entries with the specified handler.
-            for (auto it = _handlers.begin(); it != _handlers.end(); ) {
-                if (it->first == handler) {
-                    it = _handlers.erase(it);
-                }
-                else {
-                    ++it;
-                }
+    if (handler == nullptr) {
+        // Remove all handlers.
+        _handlers.clear();
+    }
+    else {
+        // Remove all entries with the specified handler.
+        for (auto it = _handlers.begin(); it != _handlers.end(); ) {
+            if (it->first == handler) {
+                it = _handlers.erase(it);
+            }
+            else {
+                ++it;
             }
         }
     }
+    publishSnapshot();
 }
 
 
@@ -77,23 +115,25 @@ void ts::PluginEventHandlerRegistry::unregisterEventHandler(PluginEventHandlerIn
 
 void ts::PluginEventHandlerRegistry::callEventHandlers(const PluginEventContext& context) const
 {
-    // Keep the global lock all along the list lookup and handler executions...
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    // Get the current snapshot without locking. The snapshot is immutable and
+    // remains valid even if a registration change publishes a new one meanwhile.
+    const std::shared_ptr<const Snapshot> snap(_snapshot.load());
 
-    // Don't recurse.
-    if (context.plugin() != nullptr && !_calling_handlers) {
+    // Don't recurse from an event handler.
+    if (snap != nullptr && context.plugin() != nullptr && !calling_handlers) {
 
         const PluginType type = context.plugin()->type();
 
+        // Select the pre-bucketed handler list for that event code.
+        const auto bucket = snap->by_code.find(context.eventCode());
+        const HandlerEntryVector& handlers(bucket != snap->by_code.end() ? bucket->second : snap->others);
+
         // Recursion protection.
-        _calling_handlers = true;
+        calling_handlers = true;
 
-        // Loop on all registered handlers.
-        for (const auto& it : _handlers) {
+        // Loop on all handlers which can match that event code.
+        for (const auto& it : handlers) {
             // For each handler, if a criteria is specified and does not match, skip this handler.
-            if (it.second.event_code.has_value() && it.second.event_code.value() != context.eventCode()) {
-                continue;
-            }
             if (it.second.plugin_type.has_value() && it.second.plugin_type.value() != type) {
                 continue;
             }
@@ -113,6 +153,6 @@ void ts::PluginEventHandlerRegistry::callEventHandlers(const PluginEventContext&
         }
 
         // End of recursion protection.
-        _calling_handlers = false;
+        calling_handlers = false;
     }
 }
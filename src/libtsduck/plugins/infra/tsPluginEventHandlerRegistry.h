@@ -83,7 +83,8 @@ namespace ts {
 
         //!
         //! Register an event handler.
-        //! Note: calling this function while executing a plugin event hander does nothing.
+        //! The registration is safe at any time, including while event handlers are executing
+        //! in other threads. It will be effective for subsequent events only.
         //! @param [in] handler The event handler to register.
         //! @param [in] criteria The criteria for which the handler is to be called.
         //!
@@ -91,8 +92,9 @@ namespace ts {
 
         //!
         //! Unregister all occurences of an event handler.
-        //! Note: calling this function while executing a plugin event hander does nothing.
         //! This is typically used in the destructor of an event handler.
+        //! The unregistration is safe at any time, including while event handlers are executing
+        //! in other threads. It will be effective for subsequent events only.
         //! @param [in] handler The event handler to unregister. When null, all events are unregistered.
         //!
         void unregisterEventHandler(PluginEventHandlerInterface* handler = nullptr);
@@ -104,15 +106,33 @@ namespace ts {
         void callEventHandlers(const PluginEventContext& context) const;
 
     private:
-        // It is difficult to find an efficient method to lookup registered handlers,
-        // due to the combinations of criteria. We store them in a sequential list.
-        // Since we do not expect many handlers and many events, that should be ok.
+        // The reference list of registered handlers, in registration order.
+        // It is only accessed under the mutex, on registration changes.
         using HandlerEntry = std::pair<PluginEventHandlerInterface*, Criteria>;
         using HandlerEntryList = std::list<HandlerEntry>;
+        using HandlerEntryVector = std::vector<HandlerEntry>;
 
-        // Accessing the list, including executing an event handler is done under a mutex.
-        mutable std::recursive_mutex _mutex {};
-        mutable bool _calling_handlers = false;
+        // Immutable snapshot of the registered handlers, pre-bucketed by event code.
+        // A new snapshot is built on each registration change and atomically published.
+        // Event dispatch, which runs at event rate in the packet path, reads one atomic
+        // shared pointer and walks one bucket, without taking any lock. Events which
+        // were dispatched before a registration change complete on the old snapshot.
+        class Snapshot
+        {
+        public:
+            // For each event code in some registered criteria, all handlers which can
+            // match that code (with or without event code criteria), in registration order.
+            std::map<uint32_t, HandlerEntryVector> by_code {};
+            // Handlers without event code criteria, for event codes which are absent from the map.
+            HandlerEntryVector others {};
+        };
+
+        // Rebuild and publish a new snapshot from _handlers (with mutex held).
+        void publishSnapshot();
+
+        // The mutex only serializes registration changes, never event dispatch.
+        std::mutex _mutex {};
         HandlerEntryList _handlers {};
+        std::atomic<std::shared_ptr<const Snapshot>> _snapshot {};
     };
 }
@@ -10,6 +10,7 @@
 #include "tsApplicationSharedLibrary.h"
 #include "tsEnvironment.h"
 #include "tsAlgorithm.h"
+#include "tsFileUtils.h"
 #include "tsCerrReport.h"
 
 TS_DEFINE_SINGLETON(ts::PluginRepository);
@@ -107,23 +108,14 @@ FACTORY ts::PluginRepository::getFactory(const UString& plugin_name, const UStri
 
     // Load a shared library if not found and allowed.
     if (it == plugin_map.end() && _sharedLibraryAllowed) {
-        // Load shareable library. Use name resolution. Use permanent mapping to keep
-        // the shareable image in memory after returning from this function. Also make
-        // sure to include the plugin's directory in the shared library search path:
-        // an extension may install a library in the same directory as the plugin.
-        ApplicationSharedLibrary shlib(plugin_name, u"tsplugin_", PLUGINS_PATH_ENVIRONMENT_VARIABLE, SharedLibraryFlags::PERMANENT, report);
-        if (shlib.isLoaded()) {
-            // Search again if the shareable library was loaded.
-            // The shareable library is supposed to register its plugins on initialization.
-            it = plugin_map.find(plugin_name);
-        }
-        else {
-            report.error(shlib.errorMessage());
-            // If a shared library was loaded but registered its plugin with the wrong name,
-            // then plugin_map was modified but the previous 'plugin_map.end()' in invalidated.
-            // So, just to make sure  we don't fail on invalid plugins, reassign it.
-            it = plugin_map.end();
-        }
+        // Load the shareable library of that plugin.
+        loadPluginLibrary(plugin_name, report);
+        // Search again if the shareable library was loaded.
+        // The shareable library is supposed to register its plugins on initialization.
+        // Note that if a shared library was loaded but registered its plugin with the
+        // wrong name, then plugin_map was modified and the previous 'plugin_map.end()'
+        // is invalidated. So, unconditionally reassign the iterator.
+        it = plugin_map.find(plugin_name);
     }
 
     // Return the factory function if one was found.
@@ -153,6 +145,110 @@ ts::PluginRepository::OutputPluginFactory ts::PluginRepository::getOutput(const
 }
 
 
+//----------------------------------------------------------------------------
+// Load the shared library of a plugin, using the resolution cache when possible.
+//----------------------------------------------------------------------------
+
+void ts::PluginRepository::loadPluginLibrary(const UString& name, Report& report)
+{
+    // Load the persistent resolution cache on first use.
+    if (!_cacheLoaded) {
+        loadCache();
+        _cacheLoaded = true;
+    }
+
+    // Check if the resolution of that plugin name was previously cached. A cache entry
+    // is used only when the library file still exists with the same modification time.
+    // This avoids probing all candidate directories for each plugin, which can be slow
+    // on remote (e.g. NFS-mounted) installations.
+    const auto cached = _cache.find(name);
+    if (cached != _cache.end()) {
+        const Time mtime(GetFileModificationTimeUTC(cached->second.path));
+        if (mtime != Time::Epoch && mtime == cached->second.mtime) {
+            // Permanent mapping to keep the shareable image in memory after returning
+            // from this function. The library registers its plugins on initialization.
+            SharedLibrary shlib(cached->second.path, SharedLibraryFlags::PERMANENT, report);
+            CERR.debug(u"loaded cached plugin file \"%s\", status: %s", cached->second.path, shlib.isLoaded());
+            if (shlib.isLoaded()) {
+                return;
+            }
+        }
+        // The cache entry is stale, drop it and fall back to the full name resolution.
+        _cache.erase(cached);
+    }
+
+    // Full name resolution. Use permanent mapping to keep the shareable image in memory
+    // after returning from this function. Also make sure to include the plugin's directory
+    // in the shared library search path: an extension may install a library in the same
+    // directory as the plugin.
+    ApplicationSharedLibrary shlib(name, u"tsplugin_", PLUGINS_PATH_ENVIRONMENT_VARIABLE, SharedLibraryFlags::PERMANENT, report);
+    if (shlib.isLoaded()) {
+        // Remember the resolved path for the next processes.
+        CacheEntry entry;
+        entry.path = UString(shlib.fileName());
+        entry.mtime = GetFileModificationTimeUTC(entry.path);
+        if (entry.mtime != Time::Epoch) {
+            _cache[name] = entry;
+            saveCache();
+        }
+    }
+    else {
+        report.error(shlib.errorMessage());
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Load and save the persistent plugin resolution cache.
+//----------------------------------------------------------------------------
+
+ts::UString ts::PluginRepository::CacheFileName()
+{
+    return UserConfigurationFileName(u".tsduck.plugins", u"tsduck.plugins");
+}
+
+void ts::PluginRepository::loadCache()
+{
+    // Same convention as the TSDuck configuration file: when the environment
+    // variable is not empty, do not use any file in the user's environment.
+    _cacheEnabled = GetEnvironment(u"TSDUCK_NO_USER_CONFIG").empty();
+    if (!_cacheEnabled) {
+        return;
+    }
+
+    // Each line of the cache file contains a plugin name, the full path of its
+    // shared library and the modification time of that file, tab-separated.
+    // The cache file is a best-effort accelerator, ignore all errors and all
+    // lines which cannot be parsed.
+    UStringVector lines;
+    UString::Load(lines, CacheFileName());
+    for (const auto& line : lines) {
+        UStringVector fields;
+        line.split(fields, u'\t', true, false);
+        cn::milliseconds::rep ms = 0;
+        if (fields.size() == 3 && !fields[0].empty() && !fields[1].empty() && fields[2].toInteger(ms)) {
+            CacheEntry& entry(_cache[fields[0]]);
+            entry.path = fields[1];
+            entry.mtime = Time::Epoch + cn::milliseconds(ms);
+        }
+    }
+    CERR.debug(u"loaded %d entries from plugin cache file \"%s\"", _cache.size(), CacheFileName());
+}
+
+void ts::PluginRepository::saveCache()
+{
+    if (_cacheEnabled) {
+        UStringVector lines;
+        lines.reserve(_cache.size());
+        for (const auto& it : _cache) {
+            lines.push_back(UString::Format(u"%s\t%s\t%d", it.first, it.second.path, (it.second.mtime - Time::Epoch).count()));
+        }
+        // Best effort, silently ignore write errors (e.g. read-only home directory).
+        UString::Save(lines, CacheFileName());
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Get the names of all registered plugins.
 //----------------------------------------------------------------------------
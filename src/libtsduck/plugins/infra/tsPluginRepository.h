@@ -16,6 +16,7 @@
 #include "tsProcessorPlugin.h"
 #include "tsOutputPlugin.h"
 #include "tsReport.h"
+#include "tsTime.h"
 #include "tsLibTSDuckVersion.h"
 
 namespace ts {
@@ -215,15 +216,36 @@ namespace ts {
         using ProcessorMap = std::map<UString, ProcessorPluginFactory>;
         using OutputMap = std::map<UString, OutputPluginFactory>;
 
+        // One entry of the persistent plugin resolution cache: the full path of the
+        // shared library implementing a plugin and its modification time when resolved.
+        class CacheEntry
+        {
+        public:
+            CacheEntry() = default;
+            UString path {};
+            Time    mtime {};
+        };
+
         bool         _sharedLibraryAllowed = true;
+        bool         _cacheLoaded = false;
+        bool         _cacheEnabled = true;
         InputMap     _inputPlugins {};
         ProcessorMap _processorPlugins {};
         OutputMap    _outputPlugins {};
+        std::map<UString, CacheEntry> _cache {};
 
         // Get plugin factory by name.
         template <typename FACTORY>
         FACTORY getFactory(const UString& name, const UString& type, const std::map<UString,FACTORY>&, Report&);
 
+        // Load the shared library of a plugin, using the resolution cache when possible.
+        void loadPluginLibrary(const UString& name, Report& report);
+
+        // Load and save the persistent plugin resolution cache.
+        void loadCache();
+        void saveCache();
+        static UString CacheFileName();
+
         // List one plugin.
         static void ListOnePlugin(UString& out, const UString& name, Plugin* plugin, size_t name_width, int flags);
     };
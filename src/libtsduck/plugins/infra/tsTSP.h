@@ -71,6 +71,16 @@ namespace ts {
         //!
         BitRateConfidence bitrateConfidence() const { return _tsp_bitrate_confidence; }
 
+        //!
+        //! Get the generation of the input bitrate value.
+        //! The generation is incremented each time the values which are returned by bitrate()
+        //! or bitrateConfidence() actually change. The bitrate is stable between two waits for
+        //! packets, so plugins which derive costly state from the bitrate may cache that state
+        //! and recompute it only when the generation moves, once per burst or packet window.
+        //! @return The current generation of the input bitrate value.
+        //!
+        size_t bitrateGeneration() const { return _tsp_bitrate_generation; }
+
         //!
         //! Access the shared library through the plugin interface.
         //! @return Address of the plugin interface.
@@ -223,9 +233,25 @@ namespace ts {
         //!
         void restartPluginSession() { _plugin_packets = 0; }
 
+        //!
+        //! Update the input bitrate and confidence, as returned by bitrate() and bitrateConfidence().
+        //! The bitrate generation is incremented only when the values actually change.
+        //! @param [in] bitrate New input bitrate.
+        //! @param [in] br_confidence New bitrate confidence.
+        //!
+        void setTSPBitrate(const BitRate& bitrate, BitRateConfidence br_confidence)
+        {
+            if (bitrate != _tsp_bitrate || br_confidence != _tsp_bitrate_confidence) {
+                _tsp_bitrate = bitrate;
+                _tsp_bitrate_confidence = br_confidence;
+                _tsp_bitrate_generation++;
+            }
+        }
+
     private:
         PacketCounter _total_packets = 0;   // Total processed packets in the plugin thread.
         PacketCounter _plugin_packets = 0;  // Total processed packets in the plugin object.
+        size_t _tsp_bitrate_generation = 0; // Incremented each time _tsp_bitrate actually changes.
 
         // A dirty hack for the default implementation of ts::ProcessorPlugin::processPacketWindow().
         friend class ProcessorPlugin;
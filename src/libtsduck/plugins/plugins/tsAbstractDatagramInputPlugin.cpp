@@ -159,30 +159,44 @@ size_t ts::AbstractDatagramInputPlugin::receive(TSPacket* buffer, TSPacketMetada
 {
     cn::microseconds timestamp = cn::microseconds(-1);
     TimeSource timesource = TimeSource::UNDEFINED;
+    TSPacketLabelSet labels;
 
     // Check if we receive new packets or process remain of previous buffer.
     bool new_packets = false;
 
+    // Number of packets which were directly received in the caller's buffer.
+    size_t direct_count = 0;
+
     // If there is no remaining packet in the input buffer, wait for a datagram message.
     // Loop until we get some TS packets.
-    while (_inbuf_count == 0) {
+    while (_inbuf_count == 0 && direct_count == 0) {
+
+        // When the caller's buffer is large enough for a complete datagram, receive the
+        // datagram directly into it. This is the common case with tsp, where receive()
+        // is called with large chunks of the global packet buffer, and this avoids one
+        // copy of the whole stream. Otherwise, use the intermediate input buffer.
+        const bool direct = max_packets * PKT_SIZE >= _inbuf.size();
+        uint8_t* const inbuf = direct ? buffer->b : _inbuf.data();
 
         // Wait for a datagram message
         size_t insize = 0;
-        if (!receiveDatagram(_inbuf.data(), _inbuf.size(), insize, timestamp, timesource)) {
+        labels.reset();
+        if (!receiveDatagram(inbuf, _inbuf.size(), insize, timestamp, timesource, labels)) {
             return 0;
         }
 
         // Look for TS packets in the UDP message.
-        new_packets = TSPacket::Locate(_inbuf.data(), insize, _inbuf_next, _inbuf_count, _packet_size);
+        size_t start_index = 0;
+        size_t packet_count = 0;
+        new_packets = TSPacket::Locate(inbuf, insize, start_index, packet_count, _packet_size);
 
         if (new_packets) {
             assert(_packet_size == PKT_SIZE || _packet_size == PKT_RS_SIZE);
 
             // Look for an RTP header before the first packet. There is no clear proof of the presence of the RTP header.
             // We check if the header size is large enough for an RTP header and if the "RTP payload type" is MPEG-2 TS.
-            const bool rtp = _inbuf_next >= RTP_HEADER_SIZE && (_inbuf[1] & 0x7F) == RTP_PT_MP2T;
-            const ts::rtp_units rtp_timestamp = ts::rtp_units(rtp ? GetUInt32(_inbuf.data() + 4) : 0);
+            const bool rtp = start_index >= RTP_HEADER_SIZE && (inbuf[1] & 0x7F) == RTP_PT_MP2T;
+            const ts::rtp_units rtp_timestamp = ts::rtp_units(rtp ? GetUInt32(inbuf + 4) : 0);
 
             // Use RTP time stamp if there is one and RTP is the preferred choice.
             bool use_rtp = false;
@@ -211,11 +225,45 @@ size_t ts::AbstractDatagramInputPlugin::receive(TSPacket* buffer, TSPacketMetada
                     break;
             }
 
+            if (direct && _packet_size == PKT_SIZE) {
+                // The packets will be returned from the caller's buffer, without intermediate copy.
+                // Compact the datagram in place when the packets do not start at the beginning of
+                // the message (e.g. remove an RTP header). MemCopy() is overlap-safe.
+                if (start_index > 0) {
+                    MemCopy(buffer->b, inbuf + start_index, packet_count * PKT_SIZE);
+                }
+                // Build time stamps directly in the caller's metadata.
+                for (size_t i = 0; i < packet_count; ++i) {
+                    TSPacketMetadata& md(pkt_data[i]);
+                    md.reset();
+                    md.setLabels(labels);
+                    if (use_rtp) {
+                        md.setInputTimeStamp(rtp_timestamp, TimeSource::RTP);
+                    }
+                    else if (use_kernel) {
+                        md.setInputTimeStamp(timestamp, timesource);
+                    }
+                }
+                direct_count = packet_count;
+                break; // found packets.
+            }
+
+            // Intermediate buffer mode. With 204-byte packets, the packets must be compacted
+            // to 188 bytes with the trailer in metadata, an intermediate copy is required.
+            // If the datagram was received in the caller's buffer, move it back first.
+            if (direct) {
+                MemCopy(_inbuf.data(), inbuf + start_index, packet_count * _packet_size);
+                start_index = 0;
+            }
+            _inbuf_next = start_index;
+            _inbuf_count = packet_count;
+
             // Build time stamps in packet metadata.
             _mdata_next = 0;
             for (size_t i = 0; i < _inbuf_count; ++i) {
                 TSPacketMetadata& md(_mdata[i]);
                 md.reset();
+                md.setLabels(labels);
                 if (use_rtp) {
                     md.setInputTimeStamp(rtp_timestamp, TimeSource::RTP);
                 }
@@ -235,6 +283,9 @@ size_t ts::AbstractDatagramInputPlugin::receive(TSPacket* buffer, TSPacketMetada
         debug(u"no TS packet in message, %s bytes", insize);
     }
 
+    // Number of packets in the newly received datagram, if any.
+    const size_t new_count = direct_count > 0 ? direct_count : _inbuf_count;
+
     // If new packets were received, we may need to re-evaluate the real-time input bitrate.
     if (new_packets && bool(_options & TSDatagramInputOptions::REAL_TIME) && _eval_time > cn::milliseconds::zero()) {
 
@@ -249,9 +300,9 @@ size_t ts::AbstractDatagramInputPlugin::receive(TSPacket* buffer, TSPacketMetada
         }
 
         // Count packets
-        _packets += _inbuf_count;
-        _packets_0 += _inbuf_count;
-        _packets_1 += _inbuf_count;
+        _packets += new_count;
+        _packets_0 += new_count;
+        _packets_1 += new_count;
 
         // Detect new evaluation period
         if (now >= _start_1 + _eval_time) {
@@ -275,6 +326,11 @@ size_t ts::AbstractDatagramInputPlugin::receive(TSPacket* buffer, TSPacketMetada
         }
     }
 
+    // With direct reception, the packets are already in the caller's buffer.
+    if (direct_count > 0) {
+        return direct_count;
+    }
+
     // Return packets from the input buffer
     size_t pkt_cnt = std::min(_inbuf_count, max_packets);
     TSPacket::Copy(buffer, _inbuf.data() + _inbuf_next, pkt_cnt, _packet_size);
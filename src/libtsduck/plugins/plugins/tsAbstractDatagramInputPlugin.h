@@ -79,9 +79,12 @@ namespace ts {
         //! @param [out] ret_size Size in bytes of the received message. Will never be larger than @a buffer_size.
         //! @param [out] timestamp Receive timestamp in micro-seconds or -1 if not available.
         //! @param [out] timesource Type of timestamp.
+        //! @param [in,out] labels Labels to set on all TS packets of the datagram. Preset to no label
+        //! by the caller. Subclasses which receive from several datagram sources may use labels to
+        //! identify the source of each datagram in the multiplexed stream.
         //! @return True on success, false on error.
         //!
-        virtual bool receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource) = 0;
+        virtual bool receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource, TSPacketLabelSet& labels) = 0;
 
     private:
         // Order of priority for input timestamps. SYSTEM means lower layer from subclass (UDP, SRT, etc).
@@ -45,6 +45,14 @@ ts::AbstractDescrambler::AbstractDescrambler(TSP* tsp_, const UString& descripti
          u"Several -p or --pid options may be specified. "
          u"By default, descramble the specified service.");
 
+    option(u"batch-size", 0, POSITIVE);
+    help(u"batch-size", u"count",
+         u"Descramble packets by batches of the specified size. "
+         u"The packets of a batch are accumulated and then descrambled in one single operation "
+         u"per descrambling engine, which is faster than packet by packet. "
+         u"This adds some latency in the stream processing. "
+         u"By default, packets are descrambled one by one.");
+
     option(u"synchronous");
     help(u"synchronous",
          u"Specify to synchronously decipher the ECM's. By default, in real-time "
@@ -69,6 +77,7 @@ bool ts::AbstractDescrambler::getOptions()
     _service.set(value(u""));
     _synchronous = present(u"synchronous") || !tsp->realtime();
     _swap_cw = present(u"swap-cw");
+    getIntValue(_batch_size, u"batch-size", 0);
     getIntValues(_pids, u"pid");
     if (!duck.loadArgs(*this) || !_scrambling.loadArgs(duck, *this)) {
         return false;
@@ -122,6 +131,9 @@ bool ts::AbstractDescrambler::start()
     _ecm_streams.clear();
     _scrambled_streams.clear();
     _demux.reset();
+    _batch.clear();
+    _batch.reserve(_batch_size);
+    _batch_scrambling = nullptr;
 
     // Initialize the scrambling engine.
     if (!_scrambling.start()) {
@@ -441,18 +453,22 @@ void ts::AbstractDescrambler::ECMThread::main()
 
 
 //----------------------------------------------------------------------------
-// Packet processing method
+// Common processing of one packet, with deferrable payload descrambling.
 //----------------------------------------------------------------------------
 
-ts::ProcessorPlugin::Status ts::AbstractDescrambler::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
+ts::ProcessorPlugin::Status ts::AbstractDescrambler::analyzePacket(TSPacket& pkt, TSScrambling*& descrambler)
 {
     const PID pid = pkt.getPID();
+    descrambler = nullptr;
 
     // Descramble packets from fixed PID's using fixed control words.
     // If there is a user-specified list of PID's, we don't manage a service
     // and there is nothing else to do.
     if (_pids.any()) {
-        return !_pids.test(pid) || _scrambling.decrypt(pkt) ? TSP_OK : TSP_END;
+        if (_pids.test(pid)) {
+            descrambler = &_scrambling;
+        }
+        return TSP_OK;
     }
 
     // Filter sections to locate the service and grab ECM's.
@@ -474,7 +490,8 @@ ts::ProcessorPlugin::Status ts::AbstractDescrambler::processPacket(TSPacket& pkt
 
     // Without ECM's, we descramble using fixed control words.
     if (!_need_ecm) {
-        return _scrambling.decrypt(pkt) ? TSP_OK : TSP_END;
+        descrambler = &_scrambling;
+        return TSP_OK;
     }
 
     // Get PID context. If the PID is not known as a scrambled PID,
@@ -503,6 +520,12 @@ ts::ProcessorPlugin::Status ts::AbstractDescrambler::processPacket(TSPacket& pkt
     // Flags new_cw_even/odd are "write-protected, read-volatile", no mutex needed.
     if ((scv == SC_EVEN_KEY && pecm->new_cw_even) || (scv == SC_ODD_KEY && pecm->new_cw_odd)) {
 
+        // A new CW will be stored in the descrambling engine. In window mode, packets
+        // which were deferred for this engine must be descrambled with the previous CW first.
+        if (!flushBatch()) {
+            return TSP_END;
+        }
+
         // A new CW was deciphered.
         // In asynchronous mode, the CW are accessed under mutex protection.
         if (!_synchronous) {
@@ -526,6 +549,79 @@ ts::ProcessorPlugin::Status ts::AbstractDescrambler::processPacket(TSPacket& pkt
         }
     }
 
-    // Descramble the packet payload.
-    return pecm->scrambling.decrypt(pkt) ? TSP_OK : TSP_END;
+    // Descramble the packet payload with the scrambling engine of the ECM stream.
+    descrambler = &pecm->scrambling;
+    return TSP_OK;
+}
+
+
+//----------------------------------------------------------------------------
+// Descramble all packets in _batch in one batch operation.
+//----------------------------------------------------------------------------
+
+bool ts::AbstractDescrambler::flushBatch()
+{
+    bool ok = true;
+    if (!_batch.empty()) {
+        assert(_batch_scrambling != nullptr);
+        ok = _batch_scrambling->decrypt(_batch.data(), _batch.size());
+        _batch.clear();
+    }
+    return ok;
+}
+
+
+//----------------------------------------------------------------------------
+// Packet processing method
+//----------------------------------------------------------------------------
+
+ts::ProcessorPlugin::Status ts::AbstractDescrambler::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
+{
+    // Packet by packet mode: descramble the payload immediately.
+    TSScrambling* descrambler = nullptr;
+    const Status status = analyzePacket(pkt, descrambler);
+    if (status == TSP_OK && descrambler != nullptr && !descrambler->decrypt(pkt)) {
+        return TSP_END;
+    }
+    return status;
+}
+
+
+//----------------------------------------------------------------------------
+// Packet window processing methods, when --batch-size is used.
+//----------------------------------------------------------------------------
+
+size_t ts::AbstractDescrambler::getPacketWindowSize()
+{
+    // Without --batch-size, process packets one by one.
+    return _batch_size;
+}
+
+size_t ts::AbstractDescrambler::processPacketWindow(TSPacketWindow& win)
+{
+    // Run the sequential control logic on each packet. Packets to descramble are
+    // accumulated in _batch, per descrambling engine, instead of being decrypted inline.
+    for (size_t i = 0; i < win.size(); ++i) {
+        TSPacket* pkt = nullptr;
+        TSPacketMetadata* pkt_data = nullptr;
+        if (!win.get(i, pkt, pkt_data)) {
+            continue;
+        }
+        TSScrambling* descrambler = nullptr;
+        if (analyzePacket(*pkt, descrambler) == TSP_END) {
+            // Stop the stream processing here, after the packets which were already descrambled.
+            flushBatch();
+            return i;
+        }
+        if (descrambler != nullptr) {
+            // When the packet uses another engine than the pending batch, flush the batch
+            // first so that all packets are descrambled in their arrival order.
+            if (descrambler != _batch_scrambling && !flushBatch()) {
+                return i;
+            }
+            _batch_scrambling = descrambler;
+            _batch.push_back(pkt);
+        }
+    }
+    return flushBatch() ? win.size() : 0;
 }
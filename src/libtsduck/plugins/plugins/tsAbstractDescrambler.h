@@ -37,6 +37,8 @@ namespace ts {
         virtual bool start() override;
         virtual bool stop() override;
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
+        virtual size_t getPacketWindowSize() override;
+        virtual size_t processPacketWindow(TSPacketWindow&) override;
 
     protected:
         //!
@@ -226,6 +228,15 @@ namespace ts {
         // Get the ECM stream for a PID, create it if non existent
         ECMStreamPtr getOrCreateECMStream(PID);
 
+        // Common processing of one packet for processPacket() and processPacketWindow().
+        // When the payload of the packet shall be descrambled, the descrambling engine
+        // to use is returned in @a descrambler instead of being invoked, so that the
+        // caller can either decrypt the packet immediately or defer it to a batch.
+        Status analyzePacket(TSPacket&, TSScrambling*& descrambler);
+
+        // Descramble all packets in _batch in one batch operation and clear the batch.
+        bool flushBatch();
+
         // Process one ECM (the one in ECMStream::ecm).
         // In asynchronous mode, this method must be invoked with the mutex held. The method
         // releases the mutex while deciphering the ECM and relocks it before exiting.
@@ -240,6 +251,9 @@ namespace ts {
         bool                    _abort = false;               // Error, abort asap.
         bool                    _synchronous = false;         // Synchronous ECM deciphering.
         bool                    _swap_cw = false;             // Swap even/odd CW from ECM.
+        size_t                  _batch_size = 0;              // Packet window size for batch descrambling (0: packet by packet).
+        std::vector<TSPacket*>  _batch {};                    // Packets with deferred descrambling in window mode.
+        TSScrambling*           _batch_scrambling = nullptr;  // Descrambling engine for the packets in _batch.
         TSScrambling            _scrambling {*this};          // Default descrambling (used with fixed control words).
         PIDSet                  _pids {};                     // Explicit PID's to descramble.
         ServiceDiscovery        _service {duck, this};        // Service to descramble (by name, id or none).
@@ -131,5 +131,16 @@ bool ts::AbstractDuplicateRemapPlugin::getOptions()
         }
     }
 
+    // Rebuild the flat lookup table and the set of remapped/duplicated PID's.
+    // The packet processing hot path uses them instead of the configuration map.
+    for (size_t pid = 0; pid < _pidTable.size(); ++pid) {
+        _pidTable[pid] = PID(pid);
+    }
+    _mappedPIDs.reset();
+    for (const auto& it : _pidMap) {
+        _pidTable[it.first] = it.second;
+        _mappedPIDs.set(it.first);
+    }
+
     return true;
 }
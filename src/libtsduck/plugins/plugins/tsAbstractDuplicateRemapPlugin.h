@@ -44,8 +44,28 @@ namespace ts {
         TSPacketLabelSet _setLabels {};       //!< Labels to set on output packets.
         TSPacketLabelSet _resetLabels {};     //!< Labels to reset on output packets.
 
+        //!
+        //! Get the output value of a PID (same PID when not remapped or duplicated).
+        //! This is a simple indexed load, for use in the packet processing hot path.
+        //! @param [in] pid PID value in the input stream.
+        //! @return Corresponding output PID value.
+        //!
+        PID outputPID(PID pid) const { return _pidTable[pid]; }
+
+        //!
+        //! Check if a PID is remapped or duplicated.
+        //! This is a simple bitset test, for use in the packet processing hot path.
+        //! @param [in] pid PID value in the input stream.
+        //! @return True when @a pid is remapped or duplicated.
+        //!
+        bool isMappedPID(PID pid) const { return _mappedPIDs.test(pid); }
+
     private:
         const bool _remap;
+        // Flat lookup structures, rebuilt from _pidMap at the end of getOptions().
+        // The packet processing hot path uses them instead of the std::map.
+        std::array<PID, PID_MAX> _pidTable {};
+        PIDSet _mappedPIDs {};
         // Strings for help and error messages:
         const UString _noun;
         const UString _verb;
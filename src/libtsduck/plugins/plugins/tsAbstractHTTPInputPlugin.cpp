@@ -20,6 +20,19 @@ ts::AbstractHTTPInputPlugin::AbstractHTTPInputPlugin(TSP* tsp_, const UString& d
     _request(*this)
 {
     webArgs.defineArgs(*this);
+
+    option(u"prefetch-segments", 0, INTEGER, 0, 1, 1, UNLIMITED_VALUE, true);
+    help(u"prefetch-segments",
+         u"Download the contents (the media segments in the case of HLS) in a dedicated thread, "
+         u"ahead of the playout position. The next downloads are started while the current content "
+         u"is passed to the next plugin, so that the download time no longer stalls the stream. "
+         u"The optional value is the maximum number of downloads which are buffered in memory "
+         u"(default: " + UString::Decimal(DEFAULT_PREFETCH_SEGMENTS) + u"), which bounds the memory usage.");
+}
+
+ts::AbstractHTTPInputPlugin::~AbstractHTTPInputPlugin()
+{
+    stopPrefetch();
 }
 
 
@@ -29,6 +42,7 @@ ts::AbstractHTTPInputPlugin::AbstractHTTPInputPlugin(TSP* tsp_, const UString& d
 
 bool ts::AbstractHTTPInputPlugin::getOptions()
 {
+    _prefetch = present(u"prefetch-segments") ? intValue<size_t>(u"prefetch-segments", DEFAULT_PREFETCH_SEGMENTS) : 0;
     return webArgs.loadArgs(*this);
 }
 
@@ -52,6 +66,7 @@ bool ts::AbstractHTTPInputPlugin::setReceiveTimeout(cn::milliseconds timeout)
 
 bool ts::AbstractHTTPInputPlugin::abortInput()
 {
+    _prefetchStop = true;
     _request.abort();
     return true;
 }
@@ -63,8 +78,46 @@ bool ts::AbstractHTTPInputPlugin::abortInput()
 
 bool ts::AbstractHTTPInputPlugin::start()
 {
-    // Start the first transfer. Here, terminating the session is an error.
-    return startTransfer();
+    if (_prefetch == 0) {
+        // Start the first transfer. Here, terminating the session is an error.
+        return startTransfer();
+    }
+    else {
+        // Start the prefetch thread. The transfers are performed there.
+        _partialSize = 0;
+        _segData.clear();
+        _segNext = 0;
+        _prefetchEOF = false;
+        _prefetchStop = false;
+        _queue.clear();
+        _queue.setMaxMessages(_prefetch);
+        _prefetchStarted = Thread::start();
+        if (!_prefetchStarted) {
+            error(u"error starting prefetch thread");
+        }
+        return _prefetchStarted;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Terminate the prefetch thread, if started.
+//----------------------------------------------------------------------------
+
+void ts::AbstractHTTPInputPlugin::stopPrefetch()
+{
+    if (_prefetchStarted) {
+        _prefetchStop = true;
+        // Abort the transfer which may be in progress in the thread.
+        _request.abort();
+        // Unblock the thread if it waits for free space in the queue.
+        _queue.clear();
+        waitForTermination();
+        _prefetchStarted = false;
+        _queue.clear();
+        _segData.clear();
+        _segNext = 0;
+    }
 }
 
 
@@ -74,8 +127,15 @@ bool ts::AbstractHTTPInputPlugin::start()
 
 bool ts::AbstractHTTPInputPlugin::stop()
 {
-    // Stop current transfer.
-    return stopTransfer();
+    if (_prefetch > 0) {
+        // Terminate the prefetch thread. The transfers are closed there.
+        stopPrefetch();
+        return true;
+    }
+    else {
+        // Stop current transfer.
+        return stopTransfer();
+    }
 }
 
 
@@ -85,6 +145,11 @@ bool ts::AbstractHTTPInputPlugin::stop()
 
 size_t ts::AbstractHTTPInputPlugin::receive(TSPacket* buffer, TSPacketMetadata* metadata, size_t maxPackets)
 {
+    // With prefetch, the transfers are performed in the prefetch thread.
+    if (_prefetch > 0) {
+        return receivePrefetch(buffer, maxPackets);
+    }
+
     // Loop until we get an error or some packets.
     for (;;) {
 
@@ -143,7 +208,10 @@ bool ts::AbstractHTTPInputPlugin::startTransfer()
     }
 
     // Reinitialize partial packet if some bytes were left from a previous iteration.
-    _partialSize = 0;
+    // With prefetch, the partial packet belongs to the plugin thread, do not touch it.
+    if (_prefetch == 0) {
+        _partialSize = 0;
+    }
     return true;
 }
 
@@ -154,7 +222,10 @@ bool ts::AbstractHTTPInputPlugin::startTransfer()
 
 bool ts::AbstractHTTPInputPlugin::stopTransfer()
 {
-    _partialSize = 0;
+    // With prefetch, the partial packet belongs to the plugin thread, do not touch it.
+    if (_prefetch == 0) {
+        _partialSize = 0;
+    }
 
     // Close auto save file if one was open.
     if (_outSave.isOpen()) {
@@ -227,3 +298,108 @@ size_t ts::AbstractHTTPInputPlugin::receiveTransfer(TSPacket* buffer, size_t max
     }
     return packetCount;
 }
+
+
+//----------------------------------------------------------------------------
+// The prefetch thread.
+//----------------------------------------------------------------------------
+
+void ts::AbstractHTTPInputPlugin::main()
+{
+    uint8_t chunk[64 * 1024];
+
+    while (!_prefetchStop) {
+
+        // Let the subclass open the next transfer. This is the end of the session otherwise.
+        if (!startTransfer()) {
+            break;
+        }
+
+        // Download the complete content in one memory buffer.
+        DataQueue::MessagePtr data(new ByteBlock);
+        data->reserve(std::max(_request.announdedContentSize(), sizeof(chunk)));
+        size_t size = 0;
+        while (!_prefetchStop && _request.receive(chunk, sizeof(chunk), size) && size > 0) {
+            data->append(chunk, size);
+        }
+
+        // If an intermediate save file was specified, save the complete packets.
+        // Display errors but do not fail, this is just auto save.
+        if (_outSave.isOpen() && !data->empty() && !_outSave.writePackets(reinterpret_cast<const TSPacket*>(data->data()), nullptr, data->size() / PKT_SIZE, *this)) {
+            _outSave.close(*this);
+        }
+
+        stopTransfer();
+
+        // Enqueue the downloaded content. When the maximum number of prefetched
+        // contents is reached, wait until the plugin thread consumes one.
+        if (!data->empty()) {
+            _queue.enqueue(data);
+        }
+    }
+
+    // Report the end of the session to the plugin thread.
+    _queue.forceEnqueue(new ByteBlock);
+}
+
+
+//----------------------------------------------------------------------------
+// Receive packets from the prefetch queue.
+//----------------------------------------------------------------------------
+
+size_t ts::AbstractHTTPInputPlugin::receivePrefetch(TSPacket* buffer, size_t maxPackets)
+{
+    // Eliminate invalid or empty buffer.
+    if (buffer == nullptr || maxPackets == 0) {
+        return 0;
+    }
+
+    uint8_t* const out = buffer->b;
+    const size_t maxBytes = maxPackets * PKT_SIZE;
+    size_t outBytes = 0;
+
+    // Start with the partial packet from the previous call, if any.
+    if (_partialSize > 0) {
+        MemCopy(out, _partial.b, _partialSize);
+        outBytes = _partialSize;
+        _partialSize = 0;
+    }
+
+    // Fill the buffer from prefetched downloads.
+    while (outBytes < maxBytes && !_prefetchEOF) {
+
+        // When the current download is exhausted, get the next one from the queue.
+        if (_segNext >= _segData.size()) {
+            DataQueue::MessagePtr msg;
+            if (outBytes < PKT_SIZE) {
+                // Nothing to return so far, wait for the next download.
+                _queue.dequeue(msg);
+            }
+            else if (!_queue.dequeue(msg, cn::milliseconds::zero())) {
+                // We already have packets to return, do not wait.
+                break;
+            }
+            if (msg == nullptr || msg->empty()) {
+                // Received the end of session marker from the prefetch thread.
+                _prefetchEOF = true;
+                break;
+            }
+            _segData = std::move(*msg);
+            _segNext = 0;
+        }
+
+        // Copy as many bytes as possible in the caller's buffer.
+        const size_t size = std::min(maxBytes - outBytes, _segData.size() - _segNext);
+        MemCopy(out + outBytes, _segData.data() + _segNext, size);
+        outBytes += size;
+        _segNext += size;
+    }
+
+    // Save the residue after the last complete packet for the next call.
+    const size_t packetCount = outBytes / PKT_SIZE;
+    _partialSize = outBytes % PKT_SIZE;
+    if (_partialSize > 0) {
+        MemCopy(_partial.b, out + packetCount * PKT_SIZE, _partialSize);
+    }
+    return packetCount;
+}
@@ -16,13 +16,15 @@
 #include "tsTSFile.h"
 #include "tsWebRequest.h"
 #include "tsWebRequestArgs.h"
+#include "tsMessageQueue.h"
+#include "tsThread.h"
 
 namespace ts {
     //!
     //! Abstract base class for HTTP-based input plugins.
     //! @ingroup libtsduck plugin
     //!
-    class TSDUCKDLL AbstractHTTPInputPlugin: public InputPlugin
+    class TSDUCKDLL AbstractHTTPInputPlugin: public InputPlugin, private Thread
     {
         TS_NOBUILD_NOCOPY(AbstractHTTPInputPlugin);
     public:
@@ -35,6 +37,16 @@ namespace ts {
         virtual size_t receive(TSPacket*, TSPacketMetadata*, size_t) override;
         virtual bool setReceiveTimeout(cn::milliseconds timeout) override;
 
+        //!
+        //! Destructor.
+        //!
+        virtual ~AbstractHTTPInputPlugin() override;
+
+        //!
+        //! Default number of prefetched downloads with option --prefetch-segments.
+        //!
+        static constexpr size_t DEFAULT_PREFETCH_SEGMENTS = 3;
+
     protected:
         //!
         //! Constructor for subclasses.
@@ -71,15 +83,35 @@ namespace ts {
         WebRequestArgs webArgs {};
 
     private:
+        // Queue of downloaded contents, from the prefetch thread to the plugin thread.
+        // An empty content is the end of session marker.
+        using DataQueue = MessageQueue<ByteBlock>;
+
         WebRequest _request;          // Current Web transfer in progress.
         TSPacket   _partial {};       // Buffer for incomplete packets.
         size_t     _partialSize = 0;  // Number of bytes in partial.
         UString    _autoSaveDir {};   // If not empty, automatically save loaded files to this directory.
         TSFile     _outSave {};       // TS file where to store the loaded file.
+        size_t     _prefetch = 0;     // Max number of prefetched downloads (zero means no prefetch).
+        DataQueue  _queue {};         // Queue of prefetched downloads.
+        ByteBlock  _segData {};       // Current download the packets of which are returned to the application.
+        size_t     _segNext = 0;      // Next byte to return from _segData.
+        bool       _prefetchEOF = false;      // The end of session marker was dequeued.
+        bool       _prefetchStarted = false;  // The prefetch thread is active.
+        volatile bool _prefetchStop = false;  // Request the prefetch thread to terminate.
 
         // Start/receive/stop on one single transfer.
         bool startTransfer();
         size_t receiveTransfer(TSPacket*, size_t);
         bool stopTransfer();
+
+        // Receive packets from the prefetch queue.
+        size_t receivePrefetch(TSPacket*, size_t);
+
+        // Terminate the prefetch thread, if started.
+        void stopPrefetch();
+
+        // Implementation of Thread: the prefetch thread.
+        virtual void main() override;
     };
 }
@@ -79,7 +79,7 @@ bool ts::ForkPacketPlugin::start()
     // Create pipe & process.
     return _pipe.open(_command,
                       _nowait ? ForkPipe::ASYNCHRONOUS : ForkPipe::SYNCHRONOUS,
-                      PKT_SIZE * _buffer_size,  // Pipe buffer size (Windows only), same as internal buffer size.
+                      PKT_SIZE * _buffer_size,  // Pipe buffer size (Windows and Linux), same as internal buffer size.
                       *this,                    // Error reporting.
                       ForkPipe::KEEP_BOTH,      // Output: same stdout and stderr as tsp process.
                       ForkPipe::STDIN_PIPE,     // Input: use the pipe.
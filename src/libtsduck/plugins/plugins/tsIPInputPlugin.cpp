@@ -24,6 +24,22 @@ ts::IPInputPlugin::IPInputPlugin(TSP* tsp_) :
 {
     // Add UDP receiver common options.
     _sock_args.defineArgs(*this, true, true);
+
+    option(u"add-group", 0, STRING, 0, UNLIMITED_COUNT);
+    help(u"add-group", u"address",
+         u"Join an additional multicast group on the same socket. "
+         u"The additional group is received on the same UDP port as the main [address:]port parameter. "
+         u"Several --add-group options may be specified to receive several multicast streams "
+         u"with one single plugin instance and one single receive thread. "
+         u"Use --first-label to identify the packets of each stream with a distinct label.");
+
+    option(u"first-label", 0, INTEGER, 0, 1, 0, TSPacketLabelSet::MAX);
+    help(u"first-label",
+         u"Set a label on the TS packets of each received multicast stream. "
+         u"The packets from the main [address:]port parameter are tagged with the specified label. "
+         u"The packets from each additional group are tagged with the subsequent label values, "
+         u"in the order of the --add-group options. Downstream plugins can then process each "
+         u"stream separately, using options such as --only-label. By default, no label is set.");
 }
 
 
@@ -34,7 +50,45 @@ ts::IPInputPlugin::IPInputPlugin(TSP* tsp_) :
 bool ts::IPInputPlugin::getOptions()
 {
     // Get command line arguments for superclass and socket.
-    const bool ok = AbstractDatagramInputPlugin::getOptions() && _sock_args.loadArgs(*this, _sock.parameters().receive_timeout);
+    bool ok = AbstractDatagramInputPlugin::getOptions() && _sock_args.loadArgs(*this, _sock.parameters().receive_timeout);
+
+    // Additional multicast groups to receive on the same socket, in option order.
+    IPAddressVector groups;
+    _sock_args.additional_groups.clear();
+    for (size_t i = 0; i < count(u"add-group"); ++i) {
+        IPAddress addr;
+        if (!addr.resolve(value(u"add-group", u"", i), *this)) {
+            ok = false;
+        }
+        else if (!addr.isMulticast()) {
+            error(u"address %s is not multicast", addr);
+            ok = false;
+        }
+        else if (_sock_args.additional_groups.insert(addr).second) {
+            groups.push_back(addr);
+        }
+    }
+    if (!groups.empty() && !_sock_args.destination.hasAddress()) {
+        error(u"--add-group requires a multicast address in the [address:]port parameter");
+        ok = false;
+    }
+
+    // Map each destination group to its label.
+    _group_labels.clear();
+    if (present(u"first-label")) {
+        size_t label = intValue<size_t>(u"first-label");
+        if (label + groups.size() > TSPacketLabelSet::MAX) {
+            error(u"too many multicast groups, labels from %d to %d do not fit, max label is %d", label, label + groups.size(), TSPacketLabelSet::MAX);
+            ok = false;
+        }
+        else {
+            _group_labels[IPAddress(_sock_args.destination)] = label++;
+            for (const auto& addr : groups) {
+                _group_labels[addr] = label++;
+            }
+        }
+    }
+
     _sock.setParameters(_sock_args);
     return ok;
 }
@@ -91,10 +145,22 @@ bool ts::IPInputPlugin::setReceiveTimeout(cn::milliseconds timeout)
 // Datagram reception method.
 //----------------------------------------------------------------------------
 
-bool ts::IPInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource)
+bool ts::IPInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource, TSPacketLabelSet& labels)
 {
     IPSocketAddress sender;
     IPSocketAddress destination;
     timesource = TimeSource::KERNEL; // could be HARDWARE if generated by NIC, but no way to know
-    return _sock.receive(buffer, buffer_size, ret_size, sender, destination, tsp, *this, &timestamp);
+    if (!_sock.receive(buffer, buffer_size, ret_size, sender, destination, tsp, *this, &timestamp)) {
+        return false;
+    }
+
+    // With --first-label, identify the multicast group of the datagram with a label.
+    if (!_group_labels.empty()) {
+        // When the system cannot report the destination address, assume the main group.
+        const auto it = _group_labels.find(destination.hasAddress() ? IPAddress(destination) : IPAddress(_sock_args.destination));
+        if (it != _group_labels.end()) {
+            labels.set(it->second);
+        }
+    }
+    return true;
 }
@@ -33,10 +33,11 @@ namespace ts {
 
     protected:
         // Implementation of AbstractDatagramInputPlugin.
-        virtual bool receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource) override;
+        virtual bool receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource, TSPacketLabelSet& labels) override;
 
     private:
         UDPReceiverArgs _sock_args {};
         UDPReceiver     _sock {*tsp};
+        std::map<IPAddress,size_t> _group_labels {};  // Label to set per destination multicast group.
     };
 }
@@ -73,6 +73,12 @@ bool ts::Plugin::stop()
     return true;
 }
 
+bool ts::Plugin::reconfigure()
+{
+    // By default, in-place reconfiguration is not supported.
+    return false;
+}
+
 ts::BitRate ts::Plugin::getBitrate()
 {
     return 0;
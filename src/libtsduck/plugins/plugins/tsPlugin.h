@@ -88,6 +88,25 @@ namespace ts {
         //!
         virtual bool stop();
 
+        //!
+        //! Apply new command line parameters in place, without restarting the plugin.
+        //!
+        //! This method is invoked by the @a tspcontrol command @c reconfigure, between
+        //! two processing passes, after the new command line parameters were analyzed
+        //! into this object. Unlike a restart, stop() and start() are not invoked, the
+        //! plugin keeps its internal state and the stream is not interrupted.
+        //!
+        //! Optionally implemented by subclasses which can update their working data
+        //! from the new option values on the fly (typically by reinvoking their own
+        //! getOptions()). The default implementation returns false, meaning that the
+        //! plugin does not support in-place reconfiguration; in that case, @a tsp
+        //! restores the previous parameters and the plugin continues unmodified.
+        //!
+        //! @return True on success, false if the plugin does not support in-place
+        //! reconfiguration or rejects the new parameters.
+        //!
+        virtual bool reconfigure();
+
         //!
         //! Get the plugin bitrate.
         //!
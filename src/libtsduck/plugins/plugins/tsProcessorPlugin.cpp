@@ -75,6 +75,11 @@ size_t ts::ProcessorPlugin::getPacketWindowSize()
     return 0;
 }
 
+bool ts::ProcessorPlugin::isParallelSafe() const
+{
+    return false;
+}
+
 ts::ProcessorPlugin::Status ts::ProcessorPlugin::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
 {
     return TSP_OK;
@@ -119,8 +124,7 @@ size_t ts::ProcessorPlugin::processPacketWindow(TSPacketWindow& win)
                 break;
             }
             if (mdata->getBitrateChanged()) {
-                tsp->_tsp_bitrate = getBitrate();
-                tsp->_tsp_bitrate_confidence = getBitrateConfidence();
+                tsp->setTSPBitrate(getBitrate(), getBitrateConfidence());
             }
             tsp->_plugin_packets++;
         }
@@ -102,6 +102,22 @@ namespace ts {
         //!
         virtual size_t getPacketWindowSize();
 
+        //!
+        //! Check if the plugin can safely process disjoint packet windows from several threads.
+        //!
+        //! This method shall be overriden by plugins which use the "packet window" processing
+        //! method and which are stateless or whose state does not depend on the processing
+        //! order of the packets (per-PID state with PID's spread over the windows is not safe).
+        //! When a plugin declares itself parallel-safe, the application may invoke
+        //! processPacketWindow() concurrently from several threads, on disjoint packet windows,
+        //! when the tsp option -\-parallel is used. The relative order of the packets in the
+        //! stream is preserved, whichever thread processes them.
+        //!
+        //! @return True if processPacketWindow() can be concurrently invoked on disjoint windows.
+        //! If this method is not overriden, the default implementation returns false.
+        //!
+        virtual bool isParallelSafe() const;
+
         //!
         //! Simple packet processing interface.
         //!
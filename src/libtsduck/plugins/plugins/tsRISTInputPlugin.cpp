@@ -39,7 +39,7 @@ bool ts::RISTInputPlugin::getOptions() NORIST_ERROR(false)
 bool ts::RISTInputPlugin::setReceiveTimeout(cn::milliseconds) NORIST_ERROR(false)
 bool ts::RISTInputPlugin::start() NORIST_ERROR(false)
 bool ts::RISTInputPlugin::stop() NORIST_ERROR(false)
-bool ts::RISTInputPlugin::receiveDatagram(uint8_t*, size_t, size_t&, cn::microseconds&, TimeSource&) NORIST_ERROR(false)
+bool ts::RISTInputPlugin::receiveDatagram(uint8_t*, size_t, size_t&, cn::microseconds&, TimeSource&, TSPacketLabelSet&) NORIST_ERROR(false)
 
 #else
 
@@ -59,6 +59,12 @@ public:
     cn::nanoseconds  buffer_ntp = cn::nanoseconds(0); // time stamp of all packets in buffer.
     int              last_qsize = 0;       // last queue size in data blocks.
     bool             qsize_warned = false; // a warning was reporting on heavy queue size.
+    ::rist_data_block* pending = nullptr;  // data block which did not fit in the buffer during the previous call.
+    int              pending_qsize = 0;    // queue size when the pending block was read.
+
+    // Copy one data block into the buffer, with librist bug correction.
+    // Return the number of copied bytes.
+    size_t copyBlock(RISTInputPlugin& plugin, const ::rist_data_block* dblock, uint8_t* buffer, size_t buffer_size);
 
     // Identified librist bug detection and automatic correction.
     // See https://code.videolan.org/rist/librist/-/issues/184
@@ -167,6 +173,11 @@ bool ts::RISTInputPlugin::start()
 
 bool ts::RISTInputPlugin::stop()
 {
+    // Free a pending data block, if any.
+    if (_guts->pending != nullptr) {
+        ::rist_receiver_data_block_free2(&_guts->pending);
+        _guts->pending = nullptr;
+    }
     _guts->rist.cleanup();
     debug(u"invalid messages: %d/%d, invalid short messages: %d/%d",
           _guts->lrbug_inv_msg_count, _guts->lrbug_msg_count,
@@ -179,7 +190,7 @@ bool ts::RISTInputPlugin::stop()
 // Datagram reception method.
 //----------------------------------------------------------------------------
 
-bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource)
+bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource, TSPacketLabelSet& labels)
 {
     // There is no blocking read. Only a timed read with zero meaning "no wait".
     // Here, we poll every 5 seconds when no timeout is specified and check for abort.
@@ -193,9 +204,19 @@ bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, s
     bool success = true;
     while (success && ret_size == 0) {
 
-        // Wait for a RIST data block.
+        // Wait for a RIST data block. Use the data block which did not fit in the
+        // buffer during the previous call, if there is one.
         // The returned value is: number of buffers remaining on queue +1 (0 if no buffer returned), -1 on error.
-        const int queue_size = ::rist_receiver_data_read2(_guts->rist.ctx, &dblock, timeout_ms);
+        int queue_size = 0;
+        if (_guts->pending != nullptr) {
+            dblock = _guts->pending;
+            queue_size = _guts->pending_qsize;
+            _guts->pending = nullptr;
+            _guts->pending_qsize = 0;
+        }
+        else {
+            queue_size = ::rist_receiver_data_read2(_guts->rist.ctx, &dblock, timeout_ms);
+        }
         if (queue_size < 0) {
             error(u"reception error");
             success = false;
@@ -218,8 +239,6 @@ bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, s
         }
         else {
             // A data block has been returned.
-            size_t data_size = dblock->payload_len;
-            const uint8_t* data_addr = reinterpret_cast<const uint8_t*>(dblock->payload);
 
             // Report excessive queue size to diagnose reception issues.
             if (queue_size > _guts->last_qsize + 10) {
@@ -232,34 +251,6 @@ bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, s
             }
             _guts->last_qsize = queue_size;
 
-            // --- BEGIN LIBRIST-BUG
-            if (data_size >= PKT_SIZE) {
-                // Detection, correction and reporting of a bug in librist. In short messages (less than 7 TS packets),
-                // the first packet is sometimes missing (the content in memory contains various strings and data).
-                // The logic behind the superclass AbstractDatagramInputPlugin will ignore incorrect data before packets.
-                // We just want to log it here. First, we need to guess the packet size, assuming that the message contains
-                // an integral number of packets.
-                const size_t packet_size = data_size % PKT_RS_SIZE == 0 ? PKT_RS_SIZE : PKT_SIZE;
-                const size_t packet_count = data_size / packet_size;
-                _guts->lrbug_msg_count++;
-                if (packet_count < 7) {
-                    _guts->lrbug_short_msg_count++;
-                }
-                if (data_addr[0] != SYNC_BYTE) {
-                    // First packet in message is invalid.
-                    _guts->lrbug_inv_msg_count++;
-                    if (packet_count < 7) {
-                        _guts->lrbug_inv_short_msg_count++;
-                    }
-                    debug(u"*** librist bug: invalid packet (1/%d), invalid messages: %d/%d, invalid short messages: %d/%d", packet_count,
-                          _guts->lrbug_inv_msg_count, _guts->lrbug_msg_count, _guts->lrbug_inv_short_msg_count, _guts->lrbug_short_msg_count);
-                    // Simply ignore the invalid packet.
-                    data_addr += packet_size;
-                    data_size -= packet_size;
-                }
-            }
-            // --- END LIBRIST-BUG
-
             // Get the input RIST timestamp. This value is in NTP units (Network Time Protocol).
             // NTP represents 64-bit times as a uniform 64-bit integer value, a number of "units",
             // where the seconds are in the upper 32 bits. Therefore, the "unit" is such that
@@ -273,15 +264,78 @@ bool ts::RISTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, s
             timestamp = cn::duration_cast<cn::milliseconds>(cn::nanoseconds(dblock->ts_ntp == 0 ? 0 : 232 * (dblock->ts_ntp / 1000)));
 
             // Return the received data which fit in the caller's buffer.
-            ret_size = std::min(data_size, buffer_size);
-            MemCopy(buffer, data_addr, ret_size);
+            ret_size = _guts->copyBlock(*this, dblock, buffer, buffer_size);
 
             // Free returned data block.
             ::rist_receiver_data_block_free2(&dblock);
+
+            // Drain more queued data blocks into the caller's buffer, as long as they
+            // fully fit. This empties the receive queue in batches during recovery
+            // bursts, instead of going through the whole plugin cycle per data block.
+            // All blocks in the batch share the time stamp of the first one.
+            while (queue_size > 1 && ret_size + PKT_SIZE <= buffer_size) {
+                dblock = nullptr;
+                queue_size = ::rist_receiver_data_read2(_guts->rist.ctx, &dblock, 0);
+                if (queue_size <= 0 || dblock == nullptr) {
+                    break;
+                }
+                if (dblock->payload_len > buffer_size - ret_size) {
+                    // Does not fit in the remaining space, keep it for the next call.
+                    _guts->pending = dblock;
+                    _guts->pending_qsize = queue_size;
+                    break;
+                }
+                ret_size += _guts->copyBlock(*this, dblock, buffer + ret_size, buffer_size - ret_size);
+                ::rist_receiver_data_block_free2(&dblock);
+            }
         }
     }
 
     return success;
 }
 
+
+//----------------------------------------------------------------------------
+// Copy one data block into the buffer, with librist bug correction.
+//----------------------------------------------------------------------------
+
+size_t ts::RISTInputPlugin::Guts::copyBlock(RISTInputPlugin& plugin, const ::rist_data_block* dblock, uint8_t* buffer, size_t buffer_size)
+{
+    size_t data_size = dblock->payload_len;
+    const uint8_t* data_addr = reinterpret_cast<const uint8_t*>(dblock->payload);
+
+    // --- BEGIN LIBRIST-BUG
+    if (data_size >= PKT_SIZE) {
+        // Detection, correction and reporting of a bug in librist. In short messages (less than 7 TS packets),
+        // the first packet is sometimes missing (the content in memory contains various strings and data).
+        // The logic behind the superclass AbstractDatagramInputPlugin will ignore incorrect data before packets.
+        // We just want to log it here. First, we need to guess the packet size, assuming that the message contains
+        // an integral number of packets.
+        const size_t packet_size = data_size % PKT_RS_SIZE == 0 ? PKT_RS_SIZE : PKT_SIZE;
+        const size_t packet_count = data_size / packet_size;
+        lrbug_msg_count++;
+        if (packet_count < 7) {
+            lrbug_short_msg_count++;
+        }
+        if (data_addr[0] != SYNC_BYTE) {
+            // First packet in message is invalid.
+            lrbug_inv_msg_count++;
+            if (packet_count < 7) {
+                lrbug_inv_short_msg_count++;
+            }
+            plugin.debug(u"*** librist bug: invalid packet (1/%d), invalid messages: %d/%d, invalid short messages: %d/%d", packet_count,
+                         lrbug_inv_msg_count, lrbug_msg_count, lrbug_inv_short_msg_count, lrbug_short_msg_count);
+            // Simply ignore the invalid packet.
+            data_addr += packet_size;
+            data_size -= packet_size;
+        }
+    }
+    // --- END LIBRIST-BUG
+
+    // Copy the data which fit in the caller's buffer.
+    const size_t ret_size = std::min(data_size, buffer_size);
+    MemCopy(buffer, data_addr, ret_size);
+    return ret_size;
+}
+
 #endif // TS_NO_RIST
@@ -106,7 +106,7 @@ bool ts::SRTInputPlugin::abortInput()
 // Datagram reception method.
 //----------------------------------------------------------------------------
 
-bool ts::SRTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource)
+bool ts::SRTInputPlugin::receiveDatagram(uint8_t* buffer, size_t buffer_size, size_t& ret_size, cn::microseconds& timestamp, TimeSource& timesource, TSPacketLabelSet& labels)
 {
     timesource = TimeSource::SRT;
 
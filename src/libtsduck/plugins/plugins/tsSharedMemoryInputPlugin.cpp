@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsSharedMemoryInputPlugin.h"
+#include "tsPluginRepository.h"
+#include "tsNullReport.h"
+
+TS_REGISTER_INPUT_PLUGIN(u"shm", ts::SharedMemoryInputPlugin);
+
+namespace {
+    // Polling interval when the ring is empty or not yet created.
+    constexpr cn::milliseconds POLL_INTERVAL = cn::milliseconds(1);
+}
+
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+ts::SharedMemoryInputPlugin::SharedMemoryInputPlugin(TSP* tsp_) :
+    InputPlugin(tsp_, u"Receive TS packets from another process through shared memory", u"[options] name")
+{
+    setIntro(u"Receive a transport stream from another process on the same machine, "
+             u"through a ring of TS packets in shared memory. The ring is created by "
+             u"the shm output plugin of the sending process, under the same name. "
+             u"The packets and their metadata (labels, input time stamps) are passed "
+             u"through memory, without going through a pipe and its extra copies.");
+
+    option(u"", 0, STRING, 1, 1);
+    help(u"", u"name", u"Name of the shared memory ring, as specified in the shm output plugin of the sending process.");
+
+    option<cn::milliseconds>(u"open-timeout");
+    help(u"open-timeout",
+         u"Maximum time to wait for the creation of the shared memory ring by the "
+         u"sending process, in milliseconds. By default, wait 5,000 milliseconds.");
+}
+
+
+//----------------------------------------------------------------------------
+// Get command line options.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryInputPlugin::getOptions()
+{
+    getValue(_name, u"");
+    getChronoValue(_open_timeout, u"open-timeout", cn::milliseconds(5000));
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Start method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryInputPlugin::start()
+{
+    _aborted = false;
+
+    // Wait for the creation of the ring by the sending process.
+    const monotonic_time deadline = monotonic_time::clock::now() + _open_timeout;
+    while (!_ring.open(_name, NULLREP)) {
+        if (_aborted || tsp->aborting() || monotonic_time::clock::now() >= deadline) {
+            // Report the actual error this time.
+            return _ring.open(_name, *this);
+        }
+        std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+    verbose(u"connected to shared memory ring %s, %'d packets", _name, _ring.ringPackets());
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Stop method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryInputPlugin::stop()
+{
+    _ring.close(*this);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Abort input method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryInputPlugin::abortInput()
+{
+    _aborted = true;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Receive packets method.
+//----------------------------------------------------------------------------
+
+size_t ts::SharedMemoryInputPlugin::receive(TSPacket* buffer, TSPacketMetadata* pkt_data, size_t max_packets)
+{
+    // Wait for packets from the sending process. The producer and consumer
+    // indexes are lock-free, an empty ring is polled at short intervals.
+    for (;;) {
+        const size_t count = _ring.readPackets(buffer, pkt_data, max_packets);
+        if (count > 0) {
+            return count;
+        }
+        if (_aborted || tsp->aborting() || _ring.endOfStream()) {
+            return 0;
+        }
+        std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+}
@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Shared memory input plugin for tsp.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsInputPlugin.h"
+#include "tsSharedMemoryRing.h"
+
+namespace ts {
+    //!
+    //! Shared memory input plugin for tsp.
+    //! @ingroup libtsduck plugin
+    //!
+    //! Receive TS packets and their metadata from another process on the same
+    //! machine, through a ring of packets in named shared memory which was
+    //! created by the @c shm output plugin.
+    //!
+    class TSDUCKDLL SharedMemoryInputPlugin: public InputPlugin
+    {
+        TS_PLUGIN_CONSTRUCTORS(SharedMemoryInputPlugin);
+    public:
+        // Implementation of plugin API
+        virtual bool getOptions() override;
+        virtual bool start() override;
+        virtual bool stop() override;
+        virtual bool abortInput() override;
+        virtual size_t receive(TSPacket*, TSPacketMetadata*, size_t) override;
+
+    private:
+        UString          _name {};          // Name of the shared memory ring.
+        cn::milliseconds _open_timeout {};  // Maximum time to wait for the ring creation.
+        volatile bool    _aborted = false;  // Abort the polling loops.
+        SharedMemoryRing _ring {};          // The shared memory ring.
+    };
+}
@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsSharedMemoryOutputPlugin.h"
+#include "tsPluginRepository.h"
+
+TS_REGISTER_OUTPUT_PLUGIN(u"shm", ts::SharedMemoryOutputPlugin);
+
+namespace {
+    // Polling interval when the ring is full.
+    constexpr cn::milliseconds POLL_INTERVAL = cn::milliseconds(1);
+}
+
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+ts::SharedMemoryOutputPlugin::SharedMemoryOutputPlugin(TSP* tsp_) :
+    OutputPlugin(tsp_, u"Send TS packets to another process through shared memory", u"[options] name")
+{
+    setIntro(u"Send the transport stream to another process on the same machine, "
+             u"through a ring of TS packets in shared memory. The ring is created "
+             u"by this plugin and read by the shm input plugin of the receiving "
+             u"process, under the same name. The packets and their metadata (labels, "
+             u"input time stamps) are passed through memory, without going through "
+             u"a pipe and its extra copies. When the ring is full, this plugin waits "
+             u"for the receiving process, the ring acts as flow control between the "
+             u"two processes.");
+
+    option(u"", 0, STRING, 1, 1);
+    help(u"", u"name", u"Name of the shared memory ring. The same name shall be used in the shm input plugin of the receiving process.");
+
+    option(u"buffer-packets", 'b', POSITIVE);
+    help(u"buffer-packets",
+         u"Specify the size of the shared memory ring in TS packets. "
+         u"The default is " + UString::Decimal(SharedMemoryRing::DEFAULT_RING_PACKETS) + u" packets.");
+}
+
+
+//----------------------------------------------------------------------------
+// Get command line options.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryOutputPlugin::getOptions()
+{
+    getValue(_name, u"");
+    getIntValue(_ring_size, u"buffer-packets", SharedMemoryRing::DEFAULT_RING_PACKETS);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Start method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryOutputPlugin::start()
+{
+    if (!_ring.create(_name, _ring_size, *this)) {
+        return false;
+    }
+    verbose(u"created shared memory ring %s, %'d packets", _name, _ring.ringPackets());
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Stop method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryOutputPlugin::stop()
+{
+    // Signal the end of stream to the receiving process, then delete the name
+    // of the ring. The receiving process safely drains the remaining packets,
+    // the memory is released when the last process detaches.
+    _ring.setEndOfStream();
+    _ring.close(*this);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Send packets method.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryOutputPlugin::send(const TSPacket* packets, const TSPacketMetadata* pkt_data, size_t packet_count)
+{
+    // Write the packets, waiting for the receiving process when the ring is
+    // full. The producer and consumer indexes are lock-free, a full ring is
+    // polled at short intervals.
+    size_t done = 0;
+    while (done < packet_count) {
+        const size_t count = _ring.writePackets(packets + done, pkt_data == nullptr ? nullptr : pkt_data + done, packet_count - done);
+        done += count;
+        if (done < packet_count) {
+            if (tsp->aborting()) {
+                return false;
+            }
+            if (count == 0) {
+                std::this_thread::sleep_for(POLL_INTERVAL);
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  Shared memory output plugin for tsp.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsOutputPlugin.h"
+#include "tsSharedMemoryRing.h"
+
+namespace ts {
+    //!
+    //! Shared memory output plugin for tsp.
+    //! @ingroup libtsduck plugin
+    //!
+    //! Send TS packets and their metadata to another process on the same
+    //! machine, through a ring of packets in named shared memory. The ring is
+    //! created by this plugin and read by the @c shm input plugin.
+    //!
+    class TSDUCKDLL SharedMemoryOutputPlugin: public OutputPlugin
+    {
+        TS_PLUGIN_CONSTRUCTORS(SharedMemoryOutputPlugin);
+    public:
+        // Implementation of plugin API
+        virtual bool getOptions() override;
+        virtual bool start() override;
+        virtual bool stop() override;
+        virtual bool send(const TSPacket*, const TSPacketMetadata*, size_t) override;
+
+    private:
+        UString          _name {};         // Name of the shared memory ring.
+        size_t           _ring_size = 0;   // Number of TS packets in the ring.
+        SharedMemoryRing _ring {};         // The shared memory ring.
+    };
+}
@@ -0,0 +1,336 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+
+#include "tsSharedMemoryRing.h"
+#include "tsSysUtils.h"
+#include "tsNullReport.h"
+#include "tsMemory.h"
+
+#if !defined(TS_WINDOWS)
+    #include "tsBeforeStandardHeaders.h"
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include "tsAfterStandardHeaders.h"
+#endif
+
+
+//----------------------------------------------------------------------------
+// Destructor.
+//----------------------------------------------------------------------------
+
+ts::SharedMemoryRing::~SharedMemoryRing()
+{
+    close(NULLREP);
+}
+
+
+//----------------------------------------------------------------------------
+// Map the named shared memory area, creating it if required.
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryRing::map(size_t size, bool create, Report& report)
+{
+#if defined(TS_WINDOWS)
+
+    // Windows implementation, using a named file mapping backed by the paging file.
+    if (create) {
+        _handle = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, uint32_t(uint64_t(size) >> 32), uint32_t(size), _name.wc_str());
+    }
+    else {
+        _handle = ::OpenFileMappingW(FILE_MAP_ALL_ACCESS, false, _name.wc_str());
+    }
+    if (_handle == nullptr) {
+        report.error(u"error %s shared memory %s: %s", create ? u"creating" : u"opening", _name, SysErrorCodeMessage());
+        return false;
+    }
+    void* const base = ::MapViewOfFile(_handle, FILE_MAP_ALL_ACCESS, 0, 0, create ? size : 0);
+    if (base == nullptr) {
+        report.error(u"error mapping shared memory %s: %s", _name, SysErrorCodeMessage());
+        ::CloseHandle(_handle);
+        _handle = nullptr;
+        return false;
+    }
+
+#else
+
+    // POSIX implementation, using a named shared memory object.
+    if (create) {
+        // Delete any stale ring with the same name from a previous session.
+        ::shm_unlink(_name.toUTF8().c_str());
+        _fd = ::shm_open(_name.toUTF8().c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    else {
+        _fd = ::shm_open(_name.toUTF8().c_str(), O_RDWR, 0);
+    }
+    if (_fd < 0) {
+        // The consumer polls for the ring creation, do not pollute its log at error level.
+        report.log(create ? Severity::Error : Severity::Debug, u"error %s shared memory %s: %s", create ? u"creating" : u"opening", _name, SysErrorCodeMessage());
+        return false;
+    }
+    if (create && ::ftruncate(_fd, off_t(size)) < 0) {
+        report.error(u"error resizing shared memory %s: %s", _name, SysErrorCodeMessage());
+        ::close(_fd);
+        _fd = -1;
+        return false;
+    }
+    if (!create) {
+        // Get the actual size of the area, as created by the producer.
+        struct stat st;
+        if (::fstat(_fd, &st) < 0 || size_t(st.st_size) < HEADER_SIZE) {
+            report.error(u"invalid shared memory %s", _name);
+            ::close(_fd);
+            _fd = -1;
+            return false;
+        }
+        size = size_t(st.st_size);
+    }
+    void* const base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (base == MAP_FAILED) {
+        report.error(u"error mapping shared memory %s: %s", _name, SysErrorCodeMessage());
+        ::close(_fd);
+        _fd = -1;
+        return false;
+    }
+
+#endif
+
+    _total_size = size;
+    _header = reinterpret_cast<Header*>(base);
+    _packets = reinterpret_cast<uint8_t*>(base) + HEADER_SIZE;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Unmap and release local resources.
+//----------------------------------------------------------------------------
+
+void ts::SharedMemoryRing::unmap()
+{
+#if defined(TS_WINDOWS)
+    if (_header != nullptr) {
+        ::UnmapViewOfFile(_header);
+    }
+    if (_handle != nullptr) {
+        ::CloseHandle(_handle);
+        _handle = nullptr;
+    }
+#else
+    if (_header != nullptr) {
+        ::munmap(_header, _total_size);
+    }
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+#endif
+    _header = nullptr;
+    _packets = nullptr;
+    _mdata = nullptr;
+    _ring_packets = 0;
+    _total_size = 0;
+}
+
+
+//----------------------------------------------------------------------------
+// Create a new ring in shared memory (producer side).
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryRing::create(const UString& name, size_t packets, Report& report)
+{
+    if (isOpen()) {
+        report.error(u"shared memory ring already open");
+        return false;
+    }
+    if (packets == 0) {
+        report.error(u"invalid shared memory ring size");
+        return false;
+    }
+
+#if defined(TS_WINDOWS)
+    _name = name;
+#else
+    // POSIX shared memory object names must start with a slash.
+    _name = name.starts_with(u"/") ? name : u"/" + name;
+#endif
+
+    if (!map(HEADER_SIZE + packets * (PKT_SIZE + MDATA_SLOT_SIZE), true, report)) {
+        return false;
+    }
+
+    // Initialize the header. The area is created zero-filled, set the magic
+    // last so that a consumer never sees a partially initialized header.
+    _creator = true;
+    _ring_packets = packets;
+    _mdata = _packets + packets * PKT_SIZE;
+    new (_header) Header;
+    _header->version = RING_VERSION;
+    _header->ring_packets = packets;
+    _header->magic.store(RING_MAGIC, std::memory_order_release);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Open an existing ring in shared memory (consumer side).
+//----------------------------------------------------------------------------
+
+bool ts::SharedMemoryRing::open(const UString& name, Report& report)
+{
+    if (isOpen()) {
+        report.error(u"shared memory ring already open");
+        return false;
+    }
+
+#if defined(TS_WINDOWS)
+    _name = name;
+#else
+    _name = name.starts_with(u"/") ? name : u"/" + name;
+#endif
+
+    if (!map(0, false, report)) {
+        return false;
+    }
+
+    // Validate the header and the consistency of the area size.
+    const uint64_t packets = _header->magic.load(std::memory_order_acquire) == RING_MAGIC && _header->version == RING_VERSION ? _header->ring_packets : 0;
+    if (packets == 0 || HEADER_SIZE + packets * (PKT_SIZE + MDATA_SLOT_SIZE) > _total_size) {
+        report.error(u"shared memory %s does not contain a valid TS packet ring", _name);
+        unmap();
+        return false;
+    }
+    _creator = false;
+    _ring_packets = size_t(packets);
+    _mdata = _packets + _ring_packets * PKT_SIZE;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Close the ring.
+//----------------------------------------------------------------------------
+
+void ts::SharedMemoryRing::close(Report& report)
+{
+    if (isOpen()) {
+        const bool creator = _creator;
+        unmap();
+#if !defined(TS_WINDOWS)
+        // The creator deletes the name. The memory is released when the last
+        // process unmaps it, a consumer can safely drain the remaining packets.
+        if (creator && ::shm_unlink(_name.toUTF8().c_str()) < 0) {
+            report.debug(u"error deleting shared memory %s: %s", _name, SysErrorCodeMessage());
+        }
+#endif
+        _creator = false;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Write TS packets and their metadata into the ring (producer side).
+//----------------------------------------------------------------------------
+
+size_t ts::SharedMemoryRing::writePackets(const TSPacket* pkt, const TSPacketMetadata* mdata, size_t count)
+{
+    if (!isOpen()) {
+        return 0;
+    }
+
+    // Number of free packets in the ring. Acquire the consumer index so that
+    // the freed slots are safely reusable.
+    const uint64_t wr = _header->write_index.load(std::memory_order_relaxed);
+    const uint64_t rd = _header->read_index.load(std::memory_order_acquire);
+    count = std::min(count, _ring_packets - size_t(wr - rd));
+
+    // Copy the packets and their metadata, in up to two contiguous chunks when
+    // the area wraps up at the end of the ring.
+    size_t index = size_t(wr % _ring_packets);
+    for (size_t done = 0; done < count; ) {
+        const size_t chunk = std::min(count - done, _ring_packets - index);
+        MemCopy(_packets + index * PKT_SIZE, pkt[done].b, chunk * PKT_SIZE);
+        for (size_t i = 0; i < chunk; ++i) {
+            uint8_t* const slot = _mdata + (index + i) * MDATA_SLOT_SIZE;
+            if (mdata != nullptr) {
+                mdata[done + i].serialize(slot, MDATA_SLOT_SIZE);
+            }
+            else {
+                MemZero(slot, MDATA_SLOT_SIZE);
+            }
+        }
+        done += chunk;
+        index = 0;
+    }
+
+    // Publish the packets to the consumer.
+    if (count > 0) {
+        _header->write_index.store(wr + count, std::memory_order_release);
+    }
+    return count;
+}
+
+
+//----------------------------------------------------------------------------
+// Read TS packets and their metadata from the ring (consumer side).
+//----------------------------------------------------------------------------
+
+size_t ts::SharedMemoryRing::readPackets(TSPacket* pkt, TSPacketMetadata* mdata, size_t max_packets)
+{
+    if (!isOpen()) {
+        return 0;
+    }
+
+    // Number of packets available in the ring. Acquire the producer index so
+    // that the packet data are safely readable.
+    const uint64_t rd = _header->read_index.load(std::memory_order_relaxed);
+    const uint64_t wr = _header->write_index.load(std::memory_order_acquire);
+    const size_t count = std::min(max_packets, size_t(wr - rd));
+
+    // Copy the packets and their metadata, in up to two contiguous chunks.
+    size_t index = size_t(rd % _ring_packets);
+    for (size_t done = 0; done < count; ) {
+        const size_t chunk = std::min(count - done, _ring_packets - index);
+        MemCopy(pkt[done].b, _packets + index * PKT_SIZE, chunk * PKT_SIZE);
+        if (mdata != nullptr) {
+            for (size_t i = 0; i < chunk; ++i) {
+                // On invalid serialized data, deserialize() resets to default values.
+                mdata[done + i].deserialize(_mdata + (index + i) * MDATA_SLOT_SIZE, TSPacketMetadata::SERIALIZATION_SIZE);
+            }
+        }
+        done += chunk;
+        index = 0;
+    }
+
+    // Release the slots to the producer.
+    if (count > 0) {
+        _header->read_index.store(rd + count, std::memory_order_release);
+    }
+    return count;
+}
+
+
+//----------------------------------------------------------------------------
+// End of stream signaling.
+//----------------------------------------------------------------------------
+
+void ts::SharedMemoryRing::setEndOfStream()
+{
+    if (isOpen()) {
+        _header->eos.store(1, std::memory_order_release);
+    }
+}
+
+bool ts::SharedMemoryRing::endOfStream() const
+{
+    return isOpen() &&
+        _header->eos.load(std::memory_order_acquire) != 0 &&
+        _header->read_index.load(std::memory_order_relaxed) == _header->write_index.load(std::memory_order_acquire);
+}
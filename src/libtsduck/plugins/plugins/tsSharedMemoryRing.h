@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//!
+//!  @file
+//!  A ring of TS packets and their metadata in named shared memory.
+//!
+//----------------------------------------------------------------------------
+
+#pragma once
+#include "tsTSPacket.h"
+#include "tsTSPacketMetadata.h"
+#include "tsReport.h"
+
+namespace ts {
+    //!
+    //! A ring of TS packets and their metadata in named shared memory.
+    //! @ingroup libtsduck plugin
+    //!
+    //! The ring is used to hand off a transport stream between two processes on
+    //! the same machine, typically two @c tsp instances using the @c shm output
+    //! and input plugins, without going through a pipe and its extra copies.
+    //!
+    //! The layout mirrors the @c tsp global buffer: a contiguous circular array
+    //! of TS packets, followed by a parallel array of fixed-size serialized
+    //! packet metadata, preceded by a page-aligned header. The header contains
+    //! the producer and consumer indexes as lock-free atomic counters: the
+    //! single producer and the single consumer synchronize without any system
+    //! call on the packet path.
+    //!
+    //! The ring is created by the producer and deleted when the producer closes
+    //! it. The read and write primitives are non-blocking; the callers implement
+    //! their own flow control, waiting when the ring is full or empty.
+    //!
+    class TSDUCKDLL SharedMemoryRing
+    {
+        TS_NOCOPY(SharedMemoryRing);
+    public:
+        //!
+        //! Constructor.
+        //!
+        SharedMemoryRing() = default;
+
+        //!
+        //! Destructor.
+        //!
+        ~SharedMemoryRing();
+
+        //!
+        //! Default number of TS packets in a ring.
+        //!
+        static constexpr size_t DEFAULT_RING_PACKETS = 10000;
+
+        //!
+        //! Create a new ring in shared memory (producer side).
+        //! Any previous ring with the same name is deleted first.
+        //! @param [in] name Name of the shared memory area. The name shall be
+        //! identical in the producer and consumer processes.
+        //! @param [in] packets Number of TS packets in the ring.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error.
+        //!
+        bool create(const UString& name, size_t packets, Report& report);
+
+        //!
+        //! Open an existing ring in shared memory (consumer side).
+        //! @param [in] name Name of the shared memory area, as created by the producer.
+        //! @param [in,out] report Where to report errors.
+        //! @return True on success, false on error (including ring not yet created).
+        //!
+        bool open(const UString& name, Report& report);
+
+        //!
+        //! Close the ring.
+        //! The shared memory area is unmapped. The creator also deletes its name;
+        //! the memory itself is released when the last process detaches.
+        //! @param [in,out] report Where to report errors.
+        //!
+        void close(Report& report);
+
+        //!
+        //! Check if the ring is open.
+        //! @return True if the ring is open.
+        //!
+        bool isOpen() const { return _header != nullptr; }
+
+        //!
+        //! Get the total number of TS packets in the ring.
+        //! @return The total number of TS packets in the ring.
+        //!
+        size_t ringPackets() const { return _ring_packets; }
+
+        //!
+        //! Write TS packets and their metadata into the ring (producer side).
+        //! Non-blocking: no more packets than the current free space are written.
+        //! @param [in] pkt Address of the first packet to write.
+        //! @param [in] mdata Address of the first packet metadata, can be null.
+        //! @param [in] count Number of packets to write.
+        //! @return Number of packets actually written, zero when the ring is full.
+        //!
+        size_t writePackets(const TSPacket* pkt, const TSPacketMetadata* mdata, size_t count);
+
+        //!
+        //! Read TS packets and their metadata from the ring (consumer side).
+        //! Non-blocking: no more packets than currently available are read.
+        //! @param [out] pkt Address of the buffer for the read packets.
+        //! @param [out] mdata Address of the buffer for the packet metadata, can be null.
+        //! @param [in] max_packets Maximum number of packets to read.
+        //! @return Number of packets actually read, zero when the ring is empty.
+        //!
+        size_t readPackets(TSPacket* pkt, TSPacketMetadata* mdata, size_t max_packets);
+
+        //!
+        //! Signal the end of the stream (producer side).
+        //! The consumer drains the remaining packets, then sees the end of stream.
+        //!
+        void setEndOfStream();
+
+        //!
+        //! Check if the end of the stream is reached (consumer side).
+        //! @return True when the producer signaled the end of the stream and all
+        //! packets were read from the ring.
+        //!
+        bool endOfStream() const;
+
+    private:
+        // Header of the shared memory area, at the start of the first page.
+        // The area is created zero-filled, the magic is set last by the creator.
+        class Header
+        {
+        public:
+            Header() = default;
+            std::atomic<uint32_t> magic {0};        // Magic number, valid when fully initialized.
+            uint32_t              version = 0;      // Layout version.
+            uint64_t              ring_packets = 0; // Number of TS packets in the ring.
+            std::atomic<uint64_t> write_index {0};  // Total number of packets written (free-running).
+            std::atomic<uint64_t> read_index {0};   // Total number of packets read (free-running).
+            std::atomic<uint32_t> eos {0};          // Non-zero when the producer signaled the end of stream.
+        };
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "lock-free 64-bit atomics required for shared memory");
+
+        static constexpr uint32_t RING_MAGIC = 0x54535352;  // "TSSR"
+        static constexpr uint32_t RING_VERSION = 1;
+        static constexpr size_t   HEADER_SIZE = 4096;       // One page, keep the packet area page-aligned.
+        static constexpr size_t   MDATA_SLOT_SIZE = 16;     // TSPacketMetadata::SERIALIZATION_SIZE, rounded up.
+
+        // Map the named shared memory area, creating it if required.
+        bool map(size_t size, bool create, Report& report);
+
+        // Unmap and release local resources.
+        void unmap();
+
+        UString  _name {};               // Name of the shared memory area, in system syntax.
+        bool     _creator = false;       // This process created the ring.
+        size_t   _ring_packets = 0;      // Number of TS packets in the ring.
+        size_t   _total_size = 0;        // Total size in bytes of the shared memory area.
+        Header*  _header = nullptr;      // Header, at the base of the shared memory area.
+        uint8_t* _packets = nullptr;     // Circular array of TS packets.
+        uint8_t* _mdata = nullptr;       // Circular array of serialized packet metadata.
+#if defined(TS_WINDOWS)
+        ::HANDLE _handle = nullptr;      // Handle of the file mapping object.
+#else
+        int      _fd = -1;               // File descriptor of the shared memory object.
+#endif
+    };
+}
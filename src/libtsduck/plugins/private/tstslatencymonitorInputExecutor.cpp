@@ -102,6 +102,18 @@ void ts::tslatencymonitor::InputExecutor::main()
                 break;
             }
 
+            // Fill input time stamps with the monotonic clock if none was provided by the
+            // input plugin. Only check the first returned packet. Assume that the input
+            // plugin generates time stamps for all or none. All input executors use the
+            // same clock epoch so that their time stamps remain comparable when the
+            // monitor correlates the two inputs.
+            if (!_metadata[0].hasInputTimeStamp()) {
+                const cn::nanoseconds current = monotonic_time::clock::now().time_since_epoch();
+                for (size_t i = 0; i < count; ++i) {
+                    _metadata[i].setInputTimeStamp(current, TimeSource::TSP);
+                }
+            }
+
             // Pass packet to monitor for analyzing
             _monitor.processPacket(_buffer, _metadata, count, _pluginIndex);
         }
@@ -82,6 +82,9 @@ bool ts::tsmux::Core::start()
         _bitrate = _opt.outputBitRate;
     }
 
+    // The output bitrate is now known and constant, cache the PCR interpolation model.
+    _pcr_model.setBitRate(_bitrate);
+
     // Get all plugin command line options and start them
     // (start the plugins but do not start the plugin executor threads).
     for (size_t i = 0; i < _inputs.size(); ++i) {
@@ -148,6 +151,65 @@ void ts::tsmux::Core::waitForTermination()
 }
 
 
+//----------------------------------------------------------------------------
+// Build a snapshot of the metrics (called by the metrics server thread).
+//----------------------------------------------------------------------------
+
+void ts::tsmux::Core::provideMetrics(json::Object& root)
+{
+    // Only read simple counters, do not disturb the muxer threads.
+    root.add(u"bitrate", _bitrate.toInt());
+    root.add(u"output-packets", int64_t(_output_packets));
+    for (size_t i = 0; i < _inputs.size(); ++i) {
+        json::Value& jin(root.query(u"inputs[]", true));
+        jin.add(u"index", int64_t(i));
+        jin.add(u"plugin", _inputs[i]->pluginName());
+        jin.add(u"packets", int64_t(_inputs[i]->pluginPackets()));
+    }
+    json::Value& jout(root.query(u"output", true));
+    jout.add(u"plugin", _output.pluginName());
+    jout.add(u"packets", int64_t(_output.pluginPackets()));
+}
+
+
+//----------------------------------------------------------------------------
+// Cached linear PCR interpolation model for the output bitrate.
+//----------------------------------------------------------------------------
+
+void ts::tsmux::Core::PCRModel::setBitRate(const BitRate& bitrate)
+{
+    _bitrate_int = bitrate.toInt();
+    if (_bitrate_int == 0) {
+        _pcr_per_pkt_q = _pcr_per_pkt_r = 0;
+    }
+    else {
+        // Number of PCR units per packet is (PKT_SIZE_BITS * SYSTEM_CLOCK_FREQ) / bitrate,
+        // kept as an exact quotient / remainder pair.
+        constexpr uint64_t num = uint64_t(PKT_SIZE_BITS) * SYSTEM_CLOCK_FREQ;
+        _pcr_per_pkt_q = num / _bitrate_int;
+        _pcr_per_pkt_r = num % _bitrate_int;
+    }
+}
+
+uint64_t ts::tsmux::Core::PCRModel::nextPCR(uint64_t last_pcr, PacketCounter distance) const
+{
+    if (last_pcr == INVALID_PCR || _bitrate_int == 0) {
+        return INVALID_PCR;
+    }
+    uint64_t next_pcr = last_pcr + distance * _pcr_per_pkt_q + (distance * _pcr_per_pkt_r) / _bitrate_int;
+    if (next_pcr >= PCR_SCALE) {
+        next_pcr -= PCR_SCALE;
+    }
+    return next_pcr;
+}
+
+ts::PacketCounter ts::tsmux::Core::PCRModel::packetDistance(uint64_t pcr_distance) const
+{
+    constexpr uint64_t num = uint64_t(PKT_SIZE_BITS) * SYSTEM_CLOCK_FREQ;
+    return PacketCounter((pcr_distance * _bitrate_int) / num);
+}
+
+
 //----------------------------------------------------------------------------
 // Invoked in the context of the core thread.
 //----------------------------------------------------------------------------
@@ -211,8 +273,12 @@ void ts::tsmux::Core::main()
     // Reset output packet counter.
     _output_packets = 0;
 
-    TSPacket pkt;
-    TSPacketMetadata pkt_data;
+    // Output window. Generated packets are accumulated there and sent to the
+    // output executor in batches, locking the output buffer once per window
+    // instead of once per packet.
+    TSPacketVector out_packets(_opt.maxOutputPackets);
+    TSPacketMetadataVector out_metadata(_opt.maxOutputPackets);
+    size_t out_count = 0;
 
     // Loop until we are instructed to stop. Each iteration is a muxing period at the defined cadence.
     while (!_terminate) {
@@ -230,6 +296,9 @@ void ts::tsmux::Core::main()
         // Loop on packets to send during this time interval.
         while (!_terminate && packet_count > 0) {
 
+            // Compose the next packet directly in the output window.
+            TSPacket& pkt(out_packets[out_count]);
+            TSPacketMetadata& pkt_data(out_metadata[out_count]);
             pkt_data.reset();
 
             // This section selects packets to insert. Initially, the insertion strategy was very basic.
@@ -263,15 +332,25 @@ void ts::tsmux::Core::main()
                 pkt_data.setNullified(true);
             }
 
-            // Output that packet.
-            if (!_output.send(&pkt, &pkt_data, 1)) {
+            // The packet stays in the output window. Flush the window when full.
+            _output_packets++;
+            packet_count--;
+            if (++out_count >= out_packets.size()) {
+                if (!_output.send(out_packets.data(), out_metadata.data(), out_count)) {
+                    _log.error(u"output plugin terminated on error, aborting");
+                    _terminate = true;
+                }
+                out_count = 0;
+            }
+        }
+
+        // Flush the remaining packets of this muxing period.
+        if (out_count > 0) {
+            if (!_output.send(out_packets.data(), out_metadata.data(), out_count)) {
                 _log.error(u"output plugin terminated on error, aborting");
                 _terminate = true;
             }
-            else {
-                _output_packets++;
-                packet_count--;
-            }
+            out_count = 0;
         }
 
         // Wait until next muxing period.
@@ -403,6 +482,10 @@ ts::tsmux::Core::Input::Input(Core& core, size_t index) :
     _next_insertion(0),
     _next_packet(),
     _next_metadata(),
+    _stage_packets(core._opt.maxInputPackets),
+    _stage_metadata(core._opt.maxInputPackets),
+    _stage_next(0),
+    _stage_count(0),
     _pid_clocks()
 {
     // Filter all global PSI/SI for merging in output PSI.
@@ -451,12 +534,21 @@ bool ts::tsmux::Core::Input::getPacket(TSPacket& pkt, TSPacketMetadata& pkt_data
         }
     }
 
-    // Get one packet from the input executor thread, non-blocking.
-    size_t ret_count = 0;
-    _terminated = _terminated || !_input.getPackets(&pkt, &pkt_data, 1, ret_count, false);
-    if (_terminated || ret_count == 0) {
-        return false;
+    // Refill the staging buffer from the input executor thread when it is empty,
+    // non-blocking. Packets are read in batches to lock the executor buffer once
+    // per window instead of once per packet.
+    if (_stage_next >= _stage_count) {
+        _stage_next = _stage_count = 0;
+        _terminated = _terminated || !_input.getPackets(_stage_packets.data(), _stage_metadata.data(), _stage_packets.size(), _stage_count, false);
+        if (_terminated || _stage_count == 0) {
+            return false;
+        }
     }
+
+    // Consume one packet from the staging buffer.
+    pkt = _stage_packets[_stage_next];
+    pkt_data = _stage_metadata[_stage_next];
+    _stage_next++;
     const PID pid = pkt.getPID();
 
     // Feed the two PSI/SI demux.
@@ -487,7 +579,7 @@ bool ts::tsmux::Core::Input::getPacket(TSPacket& pkt, TSPacketMetadata& pkt_data
             else {
                 // Compute current PCR for previous packet in the output TS.
                 assert(_core._output_packets > clock->second.pcr_packet);
-                const uint64_t output_pcr = NextPCR(clock->second.pcr_value, _core._output_packets - clock->second.pcr_packet - 1, _core._bitrate);
+                const uint64_t output_pcr = _core._pcr_model.nextPCR(clock->second.pcr_value, _core._output_packets - clock->second.pcr_packet - 1);
 
                 // Compute difference between packet's PCR and current output PCR.
                 // If they differ by more than one second, we consider that there was a clock leap and
@@ -495,7 +587,7 @@ bool ts::tsmux::Core::Input::getPacket(TSPacket& pkt, TSPacketMetadata& pkt_data
                 // one second, we consider that the PCR progression is valid and we synchronize on it.
                 if (AbsDiffPCR(packet_pcr, output_pcr) < SYSTEM_CLOCK_FREQ) {
                     // Compute the theoretical position of the packet in the output stream.
-                    const PacketCounter target_packet = clock->second.pcr_packet + PacketDistance(_core._bitrate, PCR(DiffPCR(clock->second.pcr_value, packet_pcr)));
+                    const PacketCounter target_packet = clock->second.pcr_packet + _core._pcr_model.packetDistance(DiffPCR(clock->second.pcr_value, packet_pcr));
                     if (target_packet > _core._output_packets) {
                         // This packet will be inserted later.
                         _core._log.debug(u"input #%d, PID %n, output packet %'d, delay packet by %'d packets", _plugin_index, pid, _core._output_packets, target_packet - _core._output_packets);
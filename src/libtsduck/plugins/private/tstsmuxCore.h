@@ -16,6 +16,7 @@
 #include "tsMuxerArgs.h"
 #include "tstsmuxInputExecutor.h"
 #include "tstsmuxOutputExecutor.h"
+#include "tsMetricsServer.h"
 #include "tsTime.h"
 #include "tsSectionDemux.h"
 #include "tsCyclingPacketizer.h"
@@ -31,7 +32,7 @@ namespace ts {
         //! Multiplexer (tsmux) core engine.
         //! @ingroup libtsduck plugin
         //!
-        class Core: private Thread, private SectionProviderInterface
+        class Core: public MetricsProviderInterface, private Thread, private SectionProviderInterface
         {
             TS_NOBUILD_NOCOPY(Core);
         public:
@@ -64,6 +65,9 @@ namespace ts {
             //!
             void waitForTermination();
 
+            // Implementation of MetricsProviderInterface.
+            virtual void provideMetrics(json::Object& root) override;
+
         private:
             // Description of an input stream.
             class Input;
@@ -86,6 +90,27 @@ namespace ts {
                 PIDClock(uint64_t value = INVALID_PCR, PacketCounter packet = 0) : pcr_value(value), pcr_packet(packet) {}
             };
 
+            // Cached linear PCR interpolation model for the output bitrate.
+            // The generic NextPCR() and PacketDistance() perform a BitRate division
+            // on each call. The output bitrate is constant after start(), so the
+            // model caches the quotient and remainder of the per-packet PCR
+            // increment and each evaluation is reduced to integer multiplications
+            // and one integer division, exact for integer bitrates.
+            class PCRModel
+            {
+            public:
+                // Recompute the model for a new bitrate.
+                void setBitRate(const BitRate& bitrate);
+                // Same as NextPCR(last_pcr, distance, bitrate) with the cached model.
+                uint64_t nextPCR(uint64_t last_pcr, PacketCounter distance) const;
+                // Same as PacketDistance(bitrate, PCR(pcr_distance)) with the cached model.
+                PacketCounter packetDistance(uint64_t pcr_distance) const;
+            private:
+                uint64_t _bitrate_int = 0;    // Output bitrate, rounded to an integer.
+                uint64_t _pcr_per_pkt_q = 0;  // Quotient of the per-packet PCR increment.
+                uint64_t _pcr_per_pkt_r = 0;  // Remainder of the per-packet PCR increment.
+            };
+
             // Core private members.
             const PluginEventHandlerRegistry& _handlers;
             Report&             _log;                      // Asynchronous log report.
@@ -93,6 +118,7 @@ namespace ts {
             DuckContext         _duck {&_log};             // TSDuck execution context.
             volatile bool       _terminate = false;        // Termination request.
             BitRate             _bitrate = 0;              // Constant output bitrate.
+            PCRModel            _pcr_model {};             // Cached PCR interpolation model for _bitrate.
             PacketCounter       _output_packets = 0;       // Count of output packets which were sent.
             size_t              _time_input_index = 0;     // Input plugin index containing time reference (TDT/TOT).
             std::vector<Input*> _inputs;                   // Input plugins threads.
@@ -158,6 +184,10 @@ namespace ts {
                 // Get one input packet. Return false when none is immediately available.
                 bool getPacket(TSPacket& pkt, TSPacketMetadata& pkt_data);
 
+                // Plugin name and packet count, for monitoring purposes.
+                UString pluginName() const { return _input.pluginName(); }
+                PacketCounter pluginPackets() const { return _input.pluginPackets(); }
+
             private:
                 Core&            _core;           // Reference to the parent Core.
                 const size_t     _plugin_index;   // Input plugin index.
@@ -172,6 +202,10 @@ namespace ts {
                 PacketCounter    _next_insertion; // Insertion point of next packet.
                 TSPacket         _next_packet;    // Next packet to insert if already received but not yet inserted.
                 TSPacketMetadata _next_metadata;  // Associated metadata.
+                TSPacketVector         _stage_packets;   // Staging buffer, packets read from the executor in one batch.
+                TSPacketMetadataVector _stage_metadata;  // Corresponding metadata.
+                size_t           _stage_next;     // Next packet to consume from the staging buffer.
+                size_t           _stage_count;    // Number of valid packets in the staging buffer.
                 std::map<PID,PIDClock> _pid_clocks;  // Output clock of each input PID.
 
                 // Adjust the PCR of a packet before insertion.
@@ -87,7 +87,8 @@ bool ts::tsmux::InputExecutor::getPackets(TSPacket* pkt, TSPacketMetadata* mdata
         // Signal that there are some free space.
         // The mutex was initially locked for the _got_packets condition because we needed to wait
         // for that condition but we can also use it to signal the _got_freespace condition.
-        _got_freespace.notify_all();
+        // Only the plugin thread waits on this condition, one notification is enough.
+        _got_freespace.notify_one();
     }
     return true;
 }
@@ -132,7 +133,8 @@ void ts::tsmux::InputExecutor::main()
                 std::unique_lock<std::recursive_mutex> lock(_mutex);
                 _packets_count += count;
                 // Signal that there are some new packets in the buffer.
-                _got_packets.notify_all();
+                // Only the core thread waits on this condition, one notification is enough.
+                _got_packets.notify_one();
             }
             else if (_opt.inputOnce) {
                 // Terminates when the input plugin terminates or fails.
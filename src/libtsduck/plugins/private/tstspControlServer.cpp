@@ -47,9 +47,11 @@ ts::tsp::ControlServer::ControlServer(TSProcessorArgs& options, Report& log, std
     _reference.setCommandLineHandler(this, &ControlServer::executeExit, u"exit");
     _reference.setCommandLineHandler(this, &ControlServer::executeSetLog, u"set-log");
     _reference.setCommandLineHandler(this, &ControlServer::executeList, u"list");
+    _reference.setCommandLineHandler(this, &ControlServer::executeMetrics, u"metrics");
     _reference.setCommandLineHandler(this, &ControlServer::executeSuspend, u"suspend");
     _reference.setCommandLineHandler(this, &ControlServer::executeResume, u"resume");
     _reference.setCommandLineHandler(this, &ControlServer::executeRestart, u"restart");
+    _reference.setCommandLineHandler(this, &ControlServer::executeReconfig, u"reconfigure");
 }
 
 ts::tsp::ControlServer::~ControlServer()
@@ -66,6 +68,12 @@ ts::tsp::ControlServer::~ControlServer()
 
 bool ts::tsp::ControlServer::open()
 {
+    // Start the metrics server first. It is independent from the control port
+    // and does nothing when no metrics port is specified.
+    if (!_metrics_server.open()) {
+        return false;
+    }
+
     if (!_options.control.server_addr.hasPort()) {
         // No control server, do nothing.
         return true;
@@ -109,6 +117,9 @@ bool ts::tsp::ControlServer::open()
 
 void ts::tsp::ControlServer::close()
 {
+    // Stop the metrics server, independently from the control port.
+    _metrics_server.close();
+
     if (_is_open) {
         // Close the server. This will force the server thread to terminate.
         _terminate = true;
@@ -309,6 +320,84 @@ void ts::tsp::ControlServer::listOnePlugin(size_t index, UChar type, PluginExecu
 }
 
 
+//----------------------------------------------------------------------------
+// Metrics command.
+//----------------------------------------------------------------------------
+
+ts::CommandStatus ts::tsp::ControlServer::executeMetrics(const UString& command, Args& args)
+{
+    metricsOnePlugin(0, u'I', _input, args);
+    size_t index = 1;
+    for (size_t i = 0; i < _plugins.size(); ++i) {
+        metricsOnePlugin(index++, u'P', _plugins[i], args);
+    }
+    metricsOnePlugin(index, u'O', _output, args);
+    return CommandStatus::SUCCESS;
+}
+
+void ts::tsp::ControlServer::metricsOnePlugin(size_t index, UChar type, PluginExecutor* plugin, Args& args)
+{
+    PluginExecutor::Metrics met;
+    plugin->getMetrics(met);
+
+    const cn::seconds::rep seconds = cn::duration_cast<cn::seconds>(met.uptime).count();
+    const PacketCounter pkt_rate = seconds <= 0 ? 0 : met.packets / uint64_t(seconds);
+    const cn::nanoseconds work_mean(met.cycles == 0 ? 0 : met.work_total.count() / int64_t(met.cycles));
+    const cn::nanoseconds wait_mean(met.cycles == 0 ? 0 : met.wait_total.count() / int64_t(met.cycles));
+
+    args.info(u"%2d: -%c %s: %'d packets, %'d pkt/s, work mean/max: %s/%s, wait mean/max: %s/%s",
+              index, type, plugin->pluginName(), met.packets, pkt_rate,
+              UString::Chrono(cn::duration_cast<cn::microseconds>(work_mean)),
+              UString::Chrono(cn::duration_cast<cn::microseconds>(met.work_max)),
+              UString::Chrono(cn::duration_cast<cn::microseconds>(wait_mean)),
+              UString::Chrono(cn::duration_cast<cn::microseconds>(met.wait_max)));
+
+    // The histogram is reported in verbose mode only.
+    if (args.verbose()) {
+        UString histo;
+        for (size_t i = 0; i < met.wait_histogram.size(); ++i) {
+            if (met.wait_histogram[i] != 0) {
+                histo.format(u" [>=%dus: %'d]", uint64_t(1) << i, met.wait_histogram[i]);
+            }
+        }
+        args.info(u"    wait histogram:%s", histo.empty() ? u" none" : histo);
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Build a snapshot of the metrics (called by the metrics server thread).
+//----------------------------------------------------------------------------
+
+void ts::tsp::ControlServer::provideMetrics(json::Object& root)
+{
+    metricsOnePlugin(0, u'I', _input, root);
+    size_t index = 1;
+    for (size_t i = 0; i < _plugins.size(); ++i) {
+        metricsOnePlugin(index++, u'P', _plugins[i], root);
+    }
+    metricsOnePlugin(index, u'O', _output, root);
+}
+
+void ts::tsp::ControlServer::metricsOnePlugin(size_t index, UChar type, PluginExecutor* plugin, json::Object& root)
+{
+    PluginExecutor::Metrics met;
+    plugin->getMetrics(met);
+
+    json::Value& jp(root.query(u"plugins[]", true));
+    jp.add(u"index", int64_t(index));
+    jp.add(u"type", UString(1, type));
+    jp.add(u"plugin", plugin->pluginName());
+    jp.add(u"packets", int64_t(met.packets));
+    jp.add(u"cycles", int64_t(met.cycles));
+    jp.add(u"uptime-ms", cn::duration_cast<cn::milliseconds>(met.uptime).count());
+    jp.add(u"work-total-ns", met.work_total.count());
+    jp.add(u"work-max-ns", met.work_max.count());
+    jp.add(u"wait-total-ns", met.wait_total.count());
+    jp.add(u"wait-max-ns", met.wait_max.count());
+}
+
+
 //----------------------------------------------------------------------------
 // Suspend/resume commands.
 //----------------------------------------------------------------------------
@@ -343,10 +432,20 @@ ts::CommandStatus ts::tsp::ControlServer::executeSuspendResume(bool state, Args&
 
 
 //----------------------------------------------------------------------------
-// Restart commands.
+// Restart and reconfigure commands.
 //----------------------------------------------------------------------------
 
 ts::CommandStatus ts::tsp::ControlServer::executeRestart(const UString& command, Args& args)
+{
+    return executeRestartReconfig(false, args);
+}
+
+ts::CommandStatus ts::tsp::ControlServer::executeReconfig(const UString& command, Args& args)
+{
+    return executeRestartReconfig(true, args);
+}
+
+ts::CommandStatus ts::tsp::ControlServer::executeRestartReconfig(bool in_place, Args& args)
 {
     // Get all parameters. The first one is the plugin index. Others are plugin parameters.
     UStringVector params;
@@ -360,8 +459,9 @@ ts::CommandStatus ts::tsp::ControlServer::executeRestart(const UString& command,
     // Keep only plugin parameters.
     params.erase(params.begin());
 
-    // Same we use new parameters?
-    const bool same = args.present(u"same");
+    // Same we use new parameters? The reconfigure command has no --same option,
+    // reapplying the current parameters in place would be a no-operation.
+    const bool same = !in_place && args.present(u"same");
     if (same && !params.empty()) {
         args.error(u"do not specify new plugin options with --same");
         return CommandStatus::ERROR;
@@ -379,12 +479,25 @@ ts::CommandStatus ts::tsp::ControlServer::executeRestart(const UString& command,
         plugin = _output;
     }
 
-    // Restart the plugin.
-    if (same) {
-        plugin->restart(args);
+    // Restart the plugin. In asynchronous mode (--no-wait), acknowledge the command
+    // immediately and report the restart result in the tsp log. The control server
+    // processes one command at a time: a synchronous restart can be slow and would
+    // delay subsequent commands (e.g. health polls) until its completion.
+    // The provided report must remain valid until the asynchronous restart completes,
+    // use the control server log, not the client connection.
+    const bool wait = !args.present(u"no-wait");
+    Report& report(wait ? static_cast<Report&>(args) : static_cast<Report&>(_log));
+    if (in_place) {
+        plugin->reconfigure(params, report, wait);
+    }
+    else if (same) {
+        plugin->restart(report, wait);
     }
     else {
-        plugin->restart(params, args);
+        plugin->restart(params, report, wait);
+    }
+    if (!wait) {
+        args.info(u"%s plugin %s", in_place ? u"reconfiguring" : u"restarting", plugin->pluginName());
     }
     return CommandStatus::SUCCESS;
 }
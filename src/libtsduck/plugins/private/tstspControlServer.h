@@ -17,6 +17,7 @@
 #include "tstspProcessorExecutor.h"
 #include "tstspOutputExecutor.h"
 #include "tsTSPControlCommand.h"
+#include "tsMetricsServer.h"
 #include "tsThread.h"
 #include "tsTLSServer.h"
 
@@ -27,7 +28,7 @@ namespace ts {
         //! This class is internal to the TSDuck library and cannot be called by applications.
         //! @ingroup libtsduck plugin
         //!
-        class ControlServer : public CommandLineHandler, private Thread
+        class ControlServer : public CommandLineHandler, public MetricsProviderInterface, private Thread
         {
             TS_NOBUILD_NOCOPY(ControlServer);
         public:
@@ -56,6 +57,9 @@ namespace ts {
             //!
             void close();
 
+            // Implementation of MetricsProviderInterface.
+            virtual void provideMetrics(json::Object& root) override;
+
         private:
             volatile bool         _is_open = false;
             volatile bool         _terminate = false;
@@ -69,6 +73,7 @@ namespace ts {
             InputExecutor*        _input = nullptr;
             OutputExecutor*       _output = nullptr;
             std::vector<ProcessorExecutor*> _plugins {};  // Packet processing plugins
+            MetricsServer         _metrics_server {_options.metrics_server, *this, _log};  // Optional HTTP metrics server
 
             // Implementation of Thread.
             virtual void main() override;
@@ -78,10 +83,15 @@ namespace ts {
             CommandStatus executeSetLog(const UString&, Args&);
             CommandStatus executeList(const UString&, Args&);
             void listOnePlugin(size_t index, UChar type, PluginExecutor* plugin, Report& report);
+            CommandStatus executeMetrics(const UString&, Args&);
+            void metricsOnePlugin(size_t index, UChar type, PluginExecutor* plugin, Args& args);
+            void metricsOnePlugin(size_t index, UChar type, PluginExecutor* plugin, json::Object& root);
             CommandStatus executeSuspend(const UString&, Args&);
             CommandStatus executeResume(const UString&, Args&);
             CommandStatus executeSuspendResume(bool state, Args&);
             CommandStatus executeRestart(const UString&, Args&);
+            CommandStatus executeReconfig(const UString&, Args&);
+            CommandStatus executeRestartReconfig(bool in_place, Args&);
         };
     }
 }
@@ -8,6 +8,7 @@
 
 #include "tstspInputExecutor.h"
 #include "tsTime.h"
+#include "tsUSDT.h"
 
 // Minimum number of PID's and PCR/DTS to analyze before getting a valid bitrate.
 #define MIN_ANALYZE_PID   1
@@ -395,6 +396,11 @@ void ts::tsp::InputExecutor::main()
 {
     debug(u"input thread started");
 
+    // Create the timing capture file when requested. The capture starts here,
+    // after the initial buffer preload which is never paced anyway. On error,
+    // the input continues without capture, the error is already reported.
+    bool timing_capture = !_options.timing_capture.empty() && _timing_file.openWrite(_options.timing_capture, *this);
+
     Time current_time(Time::CurrentUTC());
     Time bitrate_due_time(current_time + _options.bitrate_adj);
     PacketCounter bitrate_due_packet = _options.init_bitrate_adj;
@@ -432,6 +438,10 @@ void ts::tsp::InputExecutor::main()
             break;
         }
 
+        // Approximate buffer occupancy for the timing capture: all packets which
+        // are not in our free window are owned by the downstream plugins.
+        const size_t buffer_used = _buffer->count() - pkt_max;
+
         // Do not read more packets than request by --max-input-packets
         if (_options.max_input_pkt > 0 && pkt_max > _options.max_input_pkt) {
             pkt_max = _options.max_input_pkt;
@@ -477,18 +487,30 @@ void ts::tsp::InputExecutor::main()
             getBitrate(bitrate, br_confidence);
 
             if (bitrate > 0) {
-                // Keep this bitrate
-                _tsp_bitrate = bitrate;
-                _tsp_bitrate_confidence = br_confidence;
+                // Keep this bitrate. The bitrate generation moves only on actual change.
+                setTSPBitrate(bitrate, br_confidence);
                 debug(u"input: got bitrate %'d b/s", bitrate);
             }
         }
 
+        // Record the receive window in the timing capture file. On write error,
+        // stop the capture but continue the processing.
+        if (timing_capture && pkt_read > 0) {
+            const cn::nanoseconds current = monotonic_time::clock::now() - _start_time;
+            timing_capture = _timing_file.writeWindow(current, buffer_used, _metadata->base() + pkt_first, pkt_read, *this);
+        }
+
         // Pass received packets to next processor
+        TS_PROBE3(input_commit, pkt_first, pkt_read, pluginPackets());
         passInputPackets(pkt_read, input_end);
 
     } while (!input_end);
 
+    // Close the timing capture file.
+    if (_timing_file.isOpen()) {
+        _timing_file.close(*this);
+    }
+
     // Close the input processor.
     debug(u"stopping the input plugin");
     _input->stop();
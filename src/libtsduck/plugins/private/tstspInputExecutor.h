@@ -15,6 +15,7 @@
 #include "tstspPluginExecutor.h"
 #include "tsInputPlugin.h"
 #include "tsPCRAnalyzer.h"
+#include "tsTSTimingFile.h"
 #include "tsWatchDog.h"
 
 namespace ts {
@@ -81,6 +82,7 @@ namespace ts {
             bool           _use_dts_analyzer = false;  // Use DTS analyzer, not PCR analyzer.
             WatchDog       _watchdog {};               // Watchdog when plugin does not support receive timeout.
             bool           _use_watchdog = false;      // The watchdog shall be used.
+            TSTimingFile   _timing_file {};            // Capture file for input timing (--timing-capture).
             monotonic_time _start_time {monotonic_time::clock::now()}; // Creation time, initialized with current system time.
 
             // Inherited from Thread
@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------
 
 #include "tstspOutputExecutor.h"
+#include "tsUSDT.h"
 
 
 //----------------------------------------------------------------------------
@@ -64,7 +65,10 @@ void ts::tsp::OutputExecutor::main()
         size_t pkt_cnt = 0;
         bool input_end = false;
         bool timeout = false;
-        waitWork(1, pkt_first, pkt_cnt, _tsp_bitrate, _tsp_bitrate_confidence, input_end, aborted, timeout);
+        BitRate bitrate = _tsp_bitrate;
+        BitRateConfidence br_confidence = _tsp_bitrate_confidence;
+        waitWork(1, pkt_first, pkt_cnt, bitrate, br_confidence, input_end, aborted, timeout);
+        setTSPBitrate(bitrate, br_confidence);
 
         // We ignore the returned "aborted" which comes from the "next"
         // processor in the chain, here the input thread. For the
@@ -130,6 +134,7 @@ void ts::tsp::OutputExecutor::main()
                     // Packet successfully sent.
                     addPluginPackets(out_subcnt);
                     output_packets += out_subcnt;
+                    TS_PROBE2(output_flush, out_subcnt, output_packets);
                 }
                 else {
                     // Send error.
@@ -105,8 +105,7 @@ void ts::tsp::PluginExecutor::initBuffer(PacketBuffer*         buffer,
     _tsp_aborting = aborted;
     _bitrate = bitrate;
     _br_confidence = br_confidence;
-    _tsp_bitrate = bitrate;
-    _tsp_bitrate_confidence = br_confidence;
+    setTSPBitrate(bitrate, br_confidence);
 }
 
 
@@ -114,12 +113,23 @@ void ts::tsp::PluginExecutor::initBuffer(PacketBuffer*         buffer,
 // Signal that the specified number of packets have been processed.
 //----------------------------------------------------------------------------
 
+// GCC 12 wrongly reports a zero-size destination on the atomic counter of the
+// next executor, reached through the RingNode cast, when the atomic operation
+// is inlined at -O2.
+TS_PUSH_WARNING()
+TS_GCC_NOWARNING(stringop-overflow)
+
 bool ts::tsp::PluginExecutor::passPackets(size_t count, const BitRate& bitrate, BitRateConfidence br_confidence, bool input_end, bool aborted)
 {
     assert(count <= _pkt_cnt);
 
     log(10, u"passPackets(count = %'d, bitrate = %'d, input_end = %s, aborted = %s)", count, bitrate, input_end, aborted);
 
+    // Alternative lock-free coordination engine.
+    if (_options.lock_free) {
+        return passPacketsLockFree(count, bitrate, br_confidence, input_end, aborted);
+    }
+
     // We access data under the protection of the global mutex.
     std::lock_guard<std::recursive_mutex> lock(_global_mutex);
 
@@ -157,11 +167,29 @@ bool ts::tsp::PluginExecutor::passPackets(size_t count, const BitRate& bitrate,
     return !input_end && !aborted;
 }
 
+TS_POP_WARNING()
+
 
 //----------------------------------------------------------------------------
 // Wait for packets to process or some error condition.
 //----------------------------------------------------------------------------
 
+namespace {
+    // Hint the CPU that the thread is in a spin-wait loop.
+    inline void SpinPause()
+    {
+#if defined(TS_MSC) && (defined(TS_I386) || defined(TS_X86_64))
+        _mm_pause();
+#elif defined(TS_I386) || defined(TS_X86_64)
+        __builtin_ia32_pause();
+#elif defined(TS_ARM64) && !defined(TS_MSC)
+        asm volatile("yield" ::: "memory");
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
+
 void ts::tsp::PluginExecutor::waitWork(size_t min_pkt_cnt, size_t& pkt_first, size_t& pkt_cnt,
                                        BitRate& bitrate, BitRateConfidence& br_confidence,
                                        bool& input_end, bool& aborted, bool &timeout)
@@ -174,10 +202,38 @@ void ts::tsp::PluginExecutor::waitWork(size_t min_pkt_cnt, size_t& pkt_first, si
         min_pkt_cnt = _buffer->count();
     }
 
+    // Performance metrics: account for the processing time since the previous wakeup.
+    const uint64_t met_enter_ns = uint64_t(cn::duration_cast<cn::nanoseconds>(cn::steady_clock::now().time_since_epoch()).count());
+    metricsWorkDone(met_enter_ns);
+
+    // Alternative lock-free coordination engine.
+    if (_options.lock_free) {
+        waitWorkLockFree(min_pkt_cnt, pkt_first, pkt_cnt, bitrate, br_confidence, input_end, aborted, timeout);
+        metricsWaitDone(met_enter_ns);
+        return;
+    }
+
+    PluginExecutor* next = ringNext<PluginExecutor>();
+
+    // Adaptive wait (--spin-wait): spin on the atomic packet counter before taking
+    // the mutex and sleeping on the condition variable. At high packet rates, the
+    // previous plugin publishes enough packets within the spin budget and the two
+    // context switches of a sleep/wake cycle are avoided. The counter has atomic
+    // semantics and can be read without the mutex; the consistent state is read
+    // below, under the mutex, as usual.
+    for (size_t spins = _options.spin_wait; spins > 0; --spins) {
+        if (_pkt_cnt.load(std::memory_order_acquire) >= min_pkt_cnt ||
+            _input_end.load(std::memory_order_relaxed) ||
+            next->_tsp_aborting)
+        {
+            break;
+        }
+        SpinPause();
+    }
+
     // We access data under the protection of the global mutex.
     std::unique_lock<std::recursive_mutex> lock(_global_mutex);
 
-    PluginExecutor* next = ringNext<PluginExecutor>();
     timeout = false;
 
     // Loop until enough packets are available (or some error condition).
@@ -204,7 +260,7 @@ void ts::tsp::PluginExecutor::waitWork(size_t min_pkt_cnt, size_t& pkt_first, si
     }
     else if (_pkt_first + min_pkt_cnt <= _buffer->count()) {
         // Return up to the wrap-up point. This will satisfy the requested minimum.
-        pkt_cnt = std::min(_pkt_cnt, _buffer->count() - _pkt_first);
+        pkt_cnt = std::min<size_t>(_pkt_cnt, _buffer->count() - _pkt_first);
     }
     else {
         // The requested minimum does not fit into a contiguous area.
@@ -223,6 +279,191 @@ void ts::tsp::PluginExecutor::waitWork(size_t min_pkt_cnt, size_t& pkt_first, si
 
     log(10, u"waitWork(min_pkt_cnt = %'d, pkt_first = %'d, pkt_cnt = %'d, bitrate = %'d, input_end = %s, aborted = %s, timeout = %s)",
         min_pkt_cnt, pkt_first, pkt_cnt, bitrate, input_end, aborted, timeout);
+
+    metricsWaitDone(met_enter_ns);
+}
+
+
+//----------------------------------------------------------------------------
+// Performance metrics accounting, at the beginning and end of waitWork().
+//----------------------------------------------------------------------------
+
+namespace {
+    // Current steady clock value in nanoseconds.
+    uint64_t SteadyNanoSeconds()
+    {
+        return uint64_t(cn::duration_cast<cn::nanoseconds>(cn::steady_clock::now().time_since_epoch()).count());
+    }
+}
+
+void ts::tsp::PluginExecutor::metricsWorkDone(uint64_t now_ns)
+{
+    const uint64_t last = _met_last_wakeup_ns.load(std::memory_order_relaxed);
+    if (last == 0) {
+        // First wait: the plugin thread starts processing packets.
+        _met_start_ns.store(now_ns, std::memory_order_relaxed);
+    }
+    else {
+        // The time since the last wakeup was spent processing packets.
+        const uint64_t work = now_ns - last;
+        _met_work_total_ns.fetch_add(work, std::memory_order_relaxed);
+        if (work > _met_work_max_ns.load(std::memory_order_relaxed)) {
+            _met_work_max_ns.store(work, std::memory_order_relaxed);
+        }
+    }
+    _met_cycles.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ts::tsp::PluginExecutor::metricsWaitDone(uint64_t enter_ns)
+{
+    const uint64_t now_ns = SteadyNanoSeconds();
+    const uint64_t wait = now_ns - enter_ns;
+    _met_wait_total_ns.fetch_add(wait, std::memory_order_relaxed);
+    if (wait > _met_wait_max_ns.load(std::memory_order_relaxed)) {
+        _met_wait_max_ns.store(wait, std::memory_order_relaxed);
+    }
+
+    // Logarithmic histogram: bucket i counts the waits in [2^i, 2^(i+1)) microseconds.
+    const uint64_t us = wait / 1000;
+    size_t bucket = 0;
+    while (bucket < Metrics::HISTOGRAM_SIZE - 1 && (us >> (bucket + 1)) != 0) {
+        ++bucket;
+    }
+    _met_wait_histo[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    _met_last_wakeup_ns.store(now_ns, std::memory_order_relaxed);
+}
+
+
+//----------------------------------------------------------------------------
+// Get a snapshot of the performance metrics of this plugin executor.
+//----------------------------------------------------------------------------
+
+void ts::tsp::PluginExecutor::getMetrics(Metrics& metrics) const
+{
+    const uint64_t start = _met_start_ns.load(std::memory_order_relaxed);
+    metrics.uptime = start == 0 ? cn::nanoseconds::zero() : cn::nanoseconds(SteadyNanoSeconds() - start);
+    metrics.packets = pluginPackets();
+    metrics.cycles = _met_cycles.load(std::memory_order_relaxed);
+    metrics.work_total = cn::nanoseconds(_met_work_total_ns.load(std::memory_order_relaxed));
+    metrics.work_max = cn::nanoseconds(_met_work_max_ns.load(std::memory_order_relaxed));
+    metrics.wait_total = cn::nanoseconds(_met_wait_total_ns.load(std::memory_order_relaxed));
+    metrics.wait_max = cn::nanoseconds(_met_wait_max_ns.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < Metrics::HISTOGRAM_SIZE; ++i) {
+        metrics.wait_histogram[i] = _met_wait_histo[i].load(std::memory_order_relaxed);
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Lock-free variant of passPackets(), used with --lock-free-buffer.
+//----------------------------------------------------------------------------
+
+bool ts::tsp::PluginExecutor::passPacketsLockFree(size_t count, const BitRate& bitrate, BitRateConfidence br_confidence, bool input_end, bool aborted)
+{
+    PluginExecutor* next = ringNext<PluginExecutor>();
+
+    // Remove the first 'count' packets from the beginning of our slice of the buffer.
+    // This thread is the only writer of its own _pkt_first.
+    _pkt_first = (_pkt_first + count) % _buffer->count();
+    _pkt_cnt.fetch_sub(count, std::memory_order_relaxed);
+
+    // Propagate bitrate to the next processor under a small dedicated mutex.
+    // This mutex is never taken on the packet claiming path (see waitWorkLockFree)
+    // and is virtually uncontended.
+    {
+        std::lock_guard<std::mutex> lock(next->_meta_mutex);
+        next->_bitrate = bitrate;
+        next->_br_confidence = br_confidence;
+    }
+    if (input_end) {
+        next->_input_end.store(true, std::memory_order_relaxed);
+    }
+
+    // Publish the packets to the next processor. The release ordering guarantees
+    // that the packet data and metadata are visible to the next processor thread
+    // before it observes the incremented counter.
+    next->_pkt_cnt.fetch_add(count, std::memory_order_release);
+
+    // Force to abort our processor when the next one is aborting (same logic as the mutex version).
+    if (plugin()->type() != PluginType::OUTPUT) {
+        aborted = aborted || next->_tsp_aborting;
+    }
+    if (aborted) {
+        _tsp_aborting = true; // volatile bool in TSP superclass
+    }
+
+    return !input_end && !aborted;
+}
+
+
+//----------------------------------------------------------------------------
+// Lock-free variant of waitWork(), used with --lock-free-buffer.
+//----------------------------------------------------------------------------
+
+void ts::tsp::PluginExecutor::waitWorkLockFree(size_t min_pkt_cnt, size_t& pkt_first, size_t& pkt_cnt,
+                                               BitRate& bitrate, BitRateConfidence& br_confidence,
+                                               bool& input_end, bool& aborted, bool& timeout)
+{
+    // Number of busy-wait iterations before yielding the CPU to other threads.
+    constexpr size_t SPIN_COUNT = 1000;
+
+    PluginExecutor* next = ringNext<PluginExecutor>();
+    timeout = false;
+
+    // Optional deadline when the plugin defined a packet reception timeout.
+    const bool use_timeout = _tsp_timeout.count() >= 0;
+    auto deadline = std::chrono::steady_clock::now() + _tsp_timeout;
+
+    // Spin until enough packets are published by the previous processor (or some error condition).
+    // The acquire ordering pairs with the release in passPacketsLockFree().
+    size_t spins = 0;
+    while (_pkt_cnt.load(std::memory_order_acquire) < min_pkt_cnt &&
+           !_input_end.load(std::memory_order_relaxed) &&
+           !timeout &&
+           !next->_tsp_aborting)
+    {
+        if (++spins >= SPIN_COUNT) {
+            spins = 0;
+            std::this_thread::yield();
+        }
+        else {
+            SpinPause();
+        }
+        if (use_timeout && std::chrono::steady_clock::now() >= deadline) {
+            if (plugin()->handlePacketTimeout()) {
+                // The plugin wants to continue, rearm the timeout.
+                deadline = std::chrono::steady_clock::now() + _tsp_timeout;
+            }
+            else {
+                timeout = true;
+            }
+        }
+    }
+
+    // Same contiguous window computation as the mutex version, see waitWork().
+    const size_t avail = _pkt_cnt.load(std::memory_order_acquire);
+    if (timeout) {
+        pkt_cnt = 0;
+    }
+    else if (_pkt_first + min_pkt_cnt <= _buffer->count()) {
+        pkt_cnt = std::min(avail, _buffer->count() - _pkt_first);
+    }
+    else {
+        pkt_cnt = avail;
+    }
+
+    pkt_first = _pkt_first;
+    {
+        std::lock_guard<std::mutex> lock(_meta_mutex);
+        bitrate = _bitrate;
+        br_confidence = _br_confidence;
+    }
+    input_end = _input_end.load(std::memory_order_relaxed) && pkt_cnt == avail;
+    aborted = plugin()->type() != PluginType::OUTPUT && next->_tsp_aborting;
+
+    log(10, u"waitWorkLockFree(min_pkt_cnt = %'d, pkt_first = %'d, pkt_cnt = %'d, bitrate = %'d, input_end = %s, aborted = %s, timeout = %s)",
+        min_pkt_cnt, pkt_first, pkt_cnt, bitrate, input_end, aborted, timeout);
 }
 
 
@@ -230,9 +471,10 @@ void ts::tsp::PluginExecutor::waitWork(size_t min_pkt_cnt, size_t& pkt_first, si
 // Description of a restart operation (constructor).
 //----------------------------------------------------------------------------
 
-ts::tsp::PluginExecutor::RestartData::RestartData(const UStringVector& params, bool same, Report& rep) :
+ts::tsp::PluginExecutor::RestartData::RestartData(const UStringVector& params, bool same, bool in_pl, Report& rep) :
     report(rep),
     same_args(same),
+    in_place(in_pl),
     args(params)
 {
 }
@@ -242,17 +484,28 @@ ts::tsp::PluginExecutor::RestartData::RestartData(const UStringVector& params, b
 // Restart the plugin.
 //----------------------------------------------------------------------------
 
-void ts::tsp::PluginExecutor::restart(Report& report)
+void ts::tsp::PluginExecutor::restart(Report& report, bool wait)
+{
+    restart(std::make_shared<RestartData>(UStringVector(), true, false, report), wait);
+}
+
+void ts::tsp::PluginExecutor::restart(const UStringVector& params, Report& report, bool wait)
 {
-    restart(std::make_shared<RestartData>(UStringVector(), true, report));
+    restart(std::make_shared<RestartData>(params, false, false, report), wait);
 }
 
-void ts::tsp::PluginExecutor::restart(const UStringVector& params, Report& report)
+
+//----------------------------------------------------------------------------
+// Reconfigure the plugin in place, with new parameters, without restarting it.
+//----------------------------------------------------------------------------
+
+void ts::tsp::PluginExecutor::reconfigure(const UStringVector& params, Report& report, bool wait)
 {
-    restart(std::make_shared<RestartData>(params, false, report));
+    // Internally handled as a restart operation with the in-place flag set.
+    restart(std::make_shared<RestartData>(params, false, true, report), wait);
 }
 
-void ts::tsp::PluginExecutor::restart(const RestartDataPtr& rd)
+void ts::tsp::PluginExecutor::restart(const RestartDataPtr& rd, bool wait)
 {
     // Acquire the global mutex to modify global data.
     // To avoid deadlocks, always acquire the global mutex first, then a RestartData mutex.
@@ -277,8 +530,12 @@ void ts::tsp::PluginExecutor::restart(const RestartDataPtr& rd)
     }
 
     // Now wait for the restart operation to complete.
-    std::unique_lock<std::recursive_mutex> lock3(rd->mutex);
-    rd->condition.wait(lock3, [rd]() { return rd->completed; });
+    // In asynchronous mode, the plugin thread performs the restart on its own
+    // and reports the completion in the caller-provided report.
+    if (wait) {
+        std::unique_lock<std::recursive_mutex> lock3(rd->mutex);
+        rd->condition.wait(lock3, [rd]() { return rd->completed; });
+    }
 }
 
 
@@ -317,6 +574,49 @@ bool ts::tsp::PluginExecutor::processPendingRestart(bool& restarted)
     // Now lock the content of the restart data.
     std::lock_guard<std::recursive_mutex> lock2(_restart_data->mutex);
 
+    // In-place reconfiguration: apply the new parameters without stopping the
+    // plugin. This code runs in the plugin thread, between two processing
+    // passes, the plugin internal state and the packet buffer are preserved.
+    if (_restart_data->in_place) {
+        verbose(u"reconfiguring due to remote tspcontrol");
+        _restart_data->report.verbose(u"reconfiguring plugin %s", pluginName());
+
+        // Save previous arguments to restore the previous configuration if the new parameters are rejected.
+        UStringVector previous_args;
+        plugin()->getCommandArgs(previous_args);
+
+        // This command line analysis shall not affect the tsp process.
+        plugin()->setFlags(plugin()->getFlags() | Args::NO_HELP | Args::NO_EXIT_ON_ERROR);
+
+        // Redirect error messages from command line analysis to the remote tspcontrol.
+        Report* previous_report = plugin()->delegateReport(&_restart_data->report);
+
+        // Analyze the new command line and let the plugin apply it in place.
+        const bool success = plugin()->analyze(pluginName(), _restart_data->args, false) && plugin()->reconfigure();
+        if (!success) {
+            // The plugin continues with its previous configuration, restore the previous arguments.
+            _restart_data->report.error(u"failed to reconfigure plugin %s in place, keeping previous parameters", pluginName());
+            plugin()->analyze(pluginName(), previous_args, false);
+            restarted = false;
+        }
+
+        // Restore error messages to previous report.
+        plugin()->delegateReport(previous_report);
+
+        // Finally notify the calling thread that the reconfiguration is completed.
+        _restart_data->completed = true;
+        _restart_data->condition.notify_one();
+
+        // Clear restart trigger.
+        _restart = false;
+        _restart_data.reset();
+
+        debug(u"reconfigured plugin %s, status: %s", pluginName(), success);
+
+        // A failed reconfiguration is never fatal, the plugin was not stopped.
+        return true;
+    }
+
     // Verbose message in the current tsp process and back to the remote tspcontrol.
     verbose(u"restarting due to remote tspcontrol");
     _restart_data->report.verbose(u"restarting plugin %s", pluginName());
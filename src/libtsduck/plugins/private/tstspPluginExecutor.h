@@ -109,16 +109,67 @@ namespace ts {
             //! Restart the plugin with new parameters.
             //! This method is called from another thread, not the plugin thread.
             //! @param [in] params New command line parameters.
-            //! @param [in,out] report Where to report errors.
+            //! @param [in,out] report Where to report errors. When @a wait is false,
+            //! the report must remain valid until the restart completes.
+            //! @param [in] wait When true, wait for the completion of the restart.
+            //! When false, return immediately, the restart is executed asynchronously
+            //! by the plugin thread.
             //!
-            void restart(const UStringVector& params, Report& report);
+            void restart(const UStringVector& params, Report& report, bool wait = true);
 
             //!
             //! Restart the plugin with same parameters.
             //! This method is called from another thread, not the plugin thread.
-            //! @param [in,out] report Where to report errors.
+            //! @param [in,out] report Where to report errors. When @a wait is false,
+            //! the report must remain valid until the restart completes.
+            //! @param [in] wait When true, wait for the completion of the restart.
+            //! When false, return immediately, the restart is executed asynchronously
+            //! by the plugin thread.
             //!
-            void restart(Report& report);
+            void restart(Report& report, bool wait = true);
+
+            //!
+            //! Reconfigure the plugin in place, with new parameters, without restarting it.
+            //! The new parameters are applied by the plugin thread, between two processing
+            //! passes, using Plugin::reconfigure(). The plugin is not stopped, the packet
+            //! buffer is preserved. If the plugin does not support in-place reconfiguration
+            //! or rejects the new parameters, it continues with the previous ones.
+            //! This method is called from another thread, not the plugin thread.
+            //! @param [in] params New command line parameters.
+            //! @param [in,out] report Where to report errors. When @a wait is false,
+            //! the report must remain valid until the reconfiguration completes.
+            //! @param [in] wait When true, wait for the completion of the reconfiguration.
+            //! When false, return immediately, the reconfiguration is executed
+            //! asynchronously by the plugin thread.
+            //!
+            void reconfigure(const UStringVector& params, Report& report, bool wait = true);
+
+            //!
+            //! Performance metrics of a plugin executor, as reported by the "metrics" control command.
+            //! The wait-time histogram is logarithmic: bucket @e i counts the waits in
+            //! [2^i, 2^(i+1)) microseconds, the last bucket being open-ended.
+            //!
+            class Metrics
+            {
+            public:
+                Metrics() = default;          //!< Constructor.
+                static constexpr size_t HISTOGRAM_SIZE = 16;  //!< Number of buckets in the wait-time histogram.
+                cn::nanoseconds uptime {};    //!< Time since the plugin thread started processing packets.
+                PacketCounter   packets = 0;  //!< Number of packets which were processed by the plugin.
+                uint64_t cycles = 0;          //!< Number of processing cycles (one wait for packets, one processing phase).
+                cn::nanoseconds work_total {};  //!< Cumulated packet processing time.
+                cn::nanoseconds work_max {};    //!< Longest processing phase.
+                cn::nanoseconds wait_total {};  //!< Cumulated time waiting for packets.
+                cn::nanoseconds wait_max {};    //!< Longest wait for packets.
+                std::array<uint64_t, HISTOGRAM_SIZE> wait_histogram {};  //!< Logarithmic histogram of wait times.
+            };
+
+            //!
+            //! Get a snapshot of the performance metrics of this plugin executor.
+            //! Can be called from another thread (typically the control server).
+            //! @param [out] metrics Returned snapshot of the metrics.
+            //!
+            void getMetrics(Metrics& metrics) const;
 
             // Implementation of TSP virtual methods.
             virtual size_t pluginCount() const override;
@@ -185,10 +236,13 @@ namespace ts {
             bool pendingRestart();
 
             //!
-            //! Process a pending restart operation if there is one.
-            //! @param [out] restarted Set to true if the plugin was restarted.
+            //! Process a pending restart or in-place reconfiguration operation if there is one.
+            //! @param [out] restarted Set to true if the plugin was restarted or successfully
+            //! reconfigured in place (the caller shall recheck the plugin options).
             //! @return True in case of success (no pending restart or successfully restarted)
             //! or false on fatal error (cannot even restart with the original parameters).
+            //! A failed in-place reconfiguration is not fatal, the plugin continues with
+            //! its previous parameters.
             //!
             bool processPendingRestart(bool& restarted);
 
@@ -201,27 +255,54 @@ namespace ts {
             using RestartDataPtr = std::shared_ptr<RestartData>;
 
             // The following private data must be accessed exclusively under the protection of the global mutex.
+            // In lock-free mode (--lock-free-buffer), _pkt_cnt and _input_end are accessed without the global
+            // mutex, using their atomic semantics, and _bitrate / _br_confidence are protected by _meta_mutex.
             // Implementation details: see the file src/docs/developing-plugins.dox.
             // [*] After initialization, these fields are read/written only in passPackets() and waitWork().
             std::condition_variable_any _to_do {}; // Notify the processor thread to do something.
-            size_t            _pkt_first = 0;      // Starting index of packets area [*]
-            size_t            _pkt_cnt = 0;        // Size of packets area [*]
-            bool              _input_end = false;  // No more packet after current ones [*]
+            size_t              _pkt_first = 0;    // Starting index of packets area, written by this thread only [*]
+            std::atomic<size_t> _pkt_cnt {0};      // Size of packets area, incremented by previous plugin, decremented by this one [*]
+            std::atomic<bool>   _input_end {false}; // No more packet after current ones [*]
             BitRate           _bitrate = 0;        // Input bitrate (set by previous plugin) [*]
             BitRateConfidence _br_confidence = BitRateConfidence::LOW;  // Input bitrate confidence (set by previous plugin) [*]
+            std::mutex        _meta_mutex {};      // Lock-free mode only: protect _bitrate and _br_confidence (not on the packet path).
             bool              _restart = false;    // Restart the plugin asap using _restart_data
             RestartDataPtr    _restart_data {};    // How to restart the plugin
 
+            // Performance metrics, updated by the plugin thread in waitWork(), read by the
+            // control server thread. Relaxed atomics, the instrumentation must remain cheap.
+            std::atomic<uint64_t> _met_start_ns {0};        // Time of first wait (steady clock, ns), 0 if never waited.
+            std::atomic<uint64_t> _met_last_wakeup_ns {0};  // Time of last waitWork() return.
+            std::atomic<uint64_t> _met_cycles {0};          // Number of waitWork() calls.
+            std::atomic<uint64_t> _met_work_total_ns {0};   // Cumulated processing time.
+            std::atomic<uint64_t> _met_work_max_ns {0};     // Longest processing phase.
+            std::atomic<uint64_t> _met_wait_total_ns {0};   // Cumulated wait time.
+            std::atomic<uint64_t> _met_wait_max_ns {0};     // Longest wait.
+            std::array<std::atomic<uint64_t>, Metrics::HISTOGRAM_SIZE> _met_wait_histo {};  // Wait-time histogram.
+
+            // Metrics accounting, called at the beginning and end of waitWork().
+            void metricsWorkDone(uint64_t now_ns);
+            void metricsWaitDone(uint64_t enter_ns);
+
+            // Lock-free variants of passPackets() and waitWork(), used with --lock-free-buffer.
+            // Each plugin thread claims contiguous packet windows using the atomic packet
+            // counters only, without taking the global mutex.
+            bool passPacketsLockFree(size_t count, const BitRate& bitrate, BitRateConfidence br_confidence, bool input_end, bool aborted);
+            void waitWorkLockFree(size_t min_pkt_cnt, size_t& pkt_first, size_t& pkt_cnt,
+                                  BitRate& bitrate, BitRateConfidence& br_confidence,
+                                  bool& input_end, bool& aborted, bool& timeout);
+
             // Description of a restart operation.
             class RestartData
             {
                 TS_NOBUILD_NOCOPY(RestartData);
             public:
                 // Constructor.
-                RestartData(const UStringVector& params, bool same, Report& rep);
+                RestartData(const UStringVector& params, bool same, bool in_place, Report& rep);
 
                 Report&                     report;             // Report progress and error messages.
                 bool                        same_args = false;  // Use same args as previously.
+                bool                        in_place = false;   // Reconfigure in place, without stop() / start().
                 UStringVector               args {};            // New command line parameters for the plugin (read-only).
                 std::recursive_mutex        mutex {};           // Mutex to protect the following fields.
                 std::condition_variable_any condition {};       // Condition to report the end of restart (for the requesting thread).
@@ -229,7 +310,7 @@ namespace ts {
             };
 
             // Restart this plugin.
-            void restart(const RestartDataPtr&);
+            void restart(const RestartDataPtr&, bool wait);
         };
     }
 }
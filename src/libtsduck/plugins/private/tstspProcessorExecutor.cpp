@@ -8,6 +8,7 @@
 
 #include "tstspProcessorExecutor.h"
 #include "tsEnvironment.h"
+#include "tsUSDT.h"
 
 
 //----------------------------------------------------------------------------
@@ -107,7 +108,10 @@ void ts::tsp::ProcessorExecutor::processIndividualPackets()
         size_t pkt_first = 0;
         size_t pkt_cnt = 0;
         bool timeout = false;
-        waitWork(1, pkt_first, pkt_cnt, _tsp_bitrate, _tsp_bitrate_confidence, input_end, aborted, timeout);
+        BitRate in_bitrate = _tsp_bitrate;
+        BitRateConfidence in_confidence = _tsp_bitrate_confidence;
+        waitWork(1, pkt_first, pkt_cnt, in_bitrate, in_confidence, input_end, aborted, timeout);
+        setTSPBitrate(in_bitrate, in_confidence);
 
         // If bitrate was never modified by the plugin, always copy the input bitrate as output bitrate.
         // Otherwise, keep previous output bitrate, as modified by the plugin.
@@ -139,6 +143,7 @@ void ts::tsp::ProcessorExecutor::processIndividualPackets()
         // Now process the packets.
         size_t pkt_done = 0;
         size_t pkt_flush = 0;
+        TS_PROBE3(plugin_window_start, pluginIndex(), pkt_first, pkt_cnt);
 
         while (pkt_done < pkt_cnt && !aborted) {
 
@@ -237,6 +242,7 @@ void ts::tsp::ProcessorExecutor::processIndividualPackets()
                 pkt_flush = 0;
             }
         }
+        TS_PROBE3(plugin_window_end, pluginIndex(), pkt_first, pkt_done);
 
     } while (!input_end && !aborted);
 
@@ -265,6 +271,12 @@ void ts::tsp::ProcessorExecutor::processPacketWindows(size_t window_size)
     bool timeout = false;
     bool restarted = false;
 
+    // Number of worker threads when the plugin is safe for parallel processing (tsp option --parallel).
+    const size_t par_workers = _options.parallel > 1 && _processor->isParallelSafe() ? _options.parallel : 1;
+    if (par_workers > 1) {
+        debug(u"parallel-safe plugin, processing packet windows with %d worker threads", par_workers);
+    }
+
     // Get generic label options --only-label and --except-label.
     _processor->getOnlyExceptLabelOption(only_labels, except_labels);
 
@@ -293,7 +305,10 @@ void ts::tsp::ProcessorExecutor::processPacketWindows(size_t window_size)
             win.clear();
 
             // Wait for packets to process.
-            waitWork(request_packets, first_packet_index, allocated_packets, _tsp_bitrate, _tsp_bitrate_confidence, input_end, aborted, timeout);
+            BitRate in_bitrate = _tsp_bitrate;
+            BitRateConfidence in_confidence = _tsp_bitrate_confidence;
+            waitWork(request_packets, first_packet_index, allocated_packets, in_bitrate, in_confidence, input_end, aborted, timeout);
+            setTSPBitrate(in_bitrate, in_confidence);
 
             // If bitrate was never modified by the plugin, always copy the input bitrate as output bitrate.
             // Otherwise, keep previous output bitrate, as modified by the plugin.
@@ -357,8 +372,20 @@ void ts::tsp::ProcessorExecutor::processPacketWindows(size_t window_size)
             request_packets += window_size - win.size();
         }
 
-        // Let the plugin process the packet window.
-        const size_t processed_packets = _processor->processPacketWindow(win);
+        // Let the plugin process the packet window, possibly using the parallel worker pool.
+        size_t processed_packets = 0;
+        size_t win_dropped = 0;
+        size_t win_nullified = 0;
+        TS_PROBE3(plugin_window_start, pluginIndex(), first_packet_index, win.size());
+        if (par_workers > 1 && win.size() >= 2 * par_workers) {
+            processed_packets = processWindowParallel(win, par_workers, win_dropped, win_nullified);
+        }
+        else {
+            processed_packets = _processor->processPacketWindow(win);
+            win_dropped = win.dropCount();
+            win_nullified = win.nullifyCount();
+        }
+        TS_PROBE3(plugin_window_end, pluginIndex(), first_packet_index, processed_packets);
 
         // If not all packets from the window were processed, the plugin want to terminate the stream processing.
         if (processed_packets < win.size()) {
@@ -386,9 +413,9 @@ void ts::tsp::ProcessorExecutor::processPacketWindows(size_t window_size)
         }
 
         // Count packets which were processed in the plugin.
-        passed_packets += processed_packets - win.dropCount();
-        dropped_packets += win.dropCount();
-        nullified_packets += win.nullifyCount();
+        passed_packets += processed_packets - win_dropped;
+        dropped_packets += win_dropped;
+        nullified_packets += win_nullified;
         addPluginPackets(processed_packets);
         addNonPluginPackets(allocated_packets - processed_packets);
 
@@ -417,6 +444,120 @@ void ts::tsp::ProcessorExecutor::processPacketWindows(size_t window_size)
 
     } while (!input_end && !aborted);
 
+    // Terminate the parallel worker pool, if it was started.
+    stopParallelWorkers();
+
     debug(u"packet processing thread %s after %'d packets, %'d passed, %'d dropped, %'d nullified",
           input_end ? u"terminated" : u"aborted", pluginPackets(), passed_packets, dropped_packets, nullified_packets);
 }
+
+
+//----------------------------------------------------------------------------
+// Process one packet window using the worker pool, preserving packet order.
+//----------------------------------------------------------------------------
+
+size_t ts::tsp::ProcessorExecutor::processWindowParallel(const TSPacketWindow& win, size_t workers, size_t& dropped, size_t& nullified)
+{
+    // Create the worker threads on first use.
+    if (_par_threads.empty()) {
+        debug(u"starting %d parallel worker threads", workers);
+        _par_windows.resize(workers);
+        _par_processed.resize(workers);
+        _par_threads.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            _par_threads.emplace_back(&ProcessorExecutor::parallelWorkerMain, this, i);
+        }
+    }
+
+    // Split the window into disjoint sub-windows, one per worker, in original stream order.
+    const size_t chunk = win.size() / workers;
+    size_t index = 0;
+    for (size_t i = 0; i < workers; ++i) {
+        const size_t end = i + 1 == workers ? win.size() : index + chunk;
+        _par_windows[i].clear();
+        for (; index < end; ++index) {
+            TSPacket* pkt = nullptr;
+            TSPacketMetadata* mdata = nullptr;
+            if (win.get(index, pkt, mdata)) {
+                _par_windows[i].addPacketsReference(pkt, mdata, 1);
+            }
+        }
+    }
+
+    // Release the workers on the new batch of sub-windows and wait for their completion.
+    {
+        std::unique_lock<std::mutex> lock(_par_mutex);
+        _par_pending = workers;
+        _par_generation++;
+        _par_start.notify_all();
+        _par_done.wait(lock, [this]() { return _par_pending == 0; });
+    }
+
+    // Aggregate the results in stream order. The packets are processed in place in the
+    // global buffer, so the output order is restored by construction. If a worker
+    // terminated in the middle of its sub-window, the stream logically stops there.
+    dropped = 0;
+    nullified = 0;
+    for (size_t i = 0; i < workers; ++i) {
+        dropped += _par_windows[i].dropCount();
+        nullified += _par_windows[i].nullifyCount();
+    }
+    size_t processed = 0;
+    for (size_t i = 0; i < workers; ++i) {
+        processed += _par_processed[i];
+        if (_par_processed[i] < _par_windows[i].size()) {
+            break;
+        }
+    }
+    return processed;
+}
+
+
+//----------------------------------------------------------------------------
+// Main loop of one worker thread of the parallel pool.
+//----------------------------------------------------------------------------
+
+void ts::tsp::ProcessorExecutor::parallelWorkerMain(size_t worker_index)
+{
+    size_t generation = 0;
+    for (;;) {
+        // Wait for a new batch of sub-windows (or a termination request).
+        {
+            std::unique_lock<std::mutex> lock(_par_mutex);
+            _par_start.wait(lock, [this, generation]() { return _par_terminate || _par_generation != generation; });
+            if (_par_terminate) {
+                return;
+            }
+            generation = _par_generation;
+        }
+
+        // Process our sub-window outside the lock, concurrently with the other workers.
+        _par_processed[worker_index] = _processor->processPacketWindow(_par_windows[worker_index]);
+
+        // Signal the plugin thread when the batch is complete.
+        std::lock_guard<std::mutex> lock(_par_mutex);
+        if (--_par_pending == 0) {
+            _par_done.notify_one();
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Terminate and join the worker pool, if started.
+//----------------------------------------------------------------------------
+
+void ts::tsp::ProcessorExecutor::stopParallelWorkers()
+{
+    if (!_par_threads.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(_par_mutex);
+            _par_terminate = true;
+            _par_start.notify_all();
+        }
+        for (auto& thread : _par_threads) {
+            thread.join();
+        }
+        _par_threads.clear();
+    }
+}
@@ -54,12 +54,33 @@ namespace ts {
             ProcessorPlugin* _processor = nullptr;
             const size_t _plugin_index;
 
+            // Worker pool for parallel-safe plugins (--parallel), see processWindowParallel().
+            std::vector<std::thread>    _par_threads {};    // Worker threads, created on first parallel window.
+            std::deque<TSPacketWindow>  _par_windows {};    // Disjoint sub-window assigned to each worker (deque: TSPacketWindow is not copyable).
+            std::vector<size_t>         _par_processed {};  // Number of packets processed by each worker.
+            std::mutex                  _par_mutex {};      // Protect the worker pool state.
+            std::condition_variable     _par_start {};      // Signal workers that sub-windows are ready.
+            std::condition_variable     _par_done {};       // Signal the plugin thread that all workers completed.
+            size_t                      _par_generation = 0; // Incremented for each batch of sub-windows.
+            size_t                      _par_pending = 0;   // Number of workers still processing the current batch.
+            bool                        _par_terminate = false; // Ask the workers to exit.
+
             // Inherited from Thread
             virtual void main() override;
 
             // Process packets one by one or using packet windows.
             void processIndividualPackets();
             void processPacketWindows(size_t window_size);
+
+            // Process one packet window using the worker pool, preserving packet order.
+            // Return the number of processed packets and the dropped / nullified counts.
+            size_t processWindowParallel(const TSPacketWindow& win, size_t workers, size_t& dropped, size_t& nullified);
+
+            // Main loop of one worker thread of the parallel pool.
+            void parallelWorkerMain(size_t worker_index);
+
+            // Terminate and join the worker pool, if started.
+            void stopParallelWorkers();
         };
     }
 }
@@ -73,6 +73,7 @@ bool ts::tsswitch::Core::start()
     // Start with the designated first input plugin.
     assert(_opt.first_input < _inputs.size());
     _curPlugin = _opt.first_input;
+    _curPluginCopy = _curPlugin;
 
     // Start all input threads (but do not open the input "devices").
     bool success = true;
@@ -299,6 +300,7 @@ void ts::tsswitch::Core::enqueue(const Action& action, bool highPriority)
     else {
         _actions.push_back(action);
     }
+    _actionsPending.store(true, std::memory_order_relaxed);
 }
 
 
@@ -320,6 +322,7 @@ void ts::tsswitch::Core::cancelActions(int typeMask)
             ++it;
         }
     }
+    _actionsPending.store(!_actions.empty(), std::memory_order_relaxed);
 }
 
 
@@ -384,6 +387,10 @@ void ts::tsswitch::Core::execute(const Action& event)
             case SET_CURRENT: {
                 _eventDispatcher.signalNewInput(_curPlugin, action.index);
                 _curPlugin = action.index;
+                _curPluginCopy.store(_curPlugin, std::memory_order_relaxed);
+                // Wake up the output plugin: with --fast-switch, the buffer of the
+                // new current plugin may already contain packets to output.
+                _gotInput.notify_all();
                 break;
             }
             case WAIT_STARTED:
@@ -410,6 +417,32 @@ void ts::tsswitch::Core::execute(const Action& event)
         // Command executed, dequeue it.
         _actions.pop_front();
     }
+
+    // All actions executed, none left in the queue.
+    _actionsPending.store(false, std::memory_order_relaxed);
+}
+
+
+//----------------------------------------------------------------------------
+// Build a snapshot of the metrics (called by the metrics server thread).
+//----------------------------------------------------------------------------
+
+void ts::tsswitch::Core::provideMetrics(json::Object& root)
+{
+    // Only read lock-free or informational data, do not disturb the switching threads.
+    const size_t current = _curPluginCopy.load(std::memory_order_relaxed);
+    root.add(u"current-input", int64_t(current));
+    for (size_t i = 0; i < _inputs.size(); ++i) {
+        json::Value& jin(root.query(u"inputs[]", true));
+        jin.add(u"index", int64_t(i));
+        jin.add(u"plugin", _inputs[i]->pluginName());
+        jin.add(u"packets", int64_t(_inputs[i]->pluginPackets()));
+        jin.add(u"buffered-packets", int64_t(_inputs[i]->bufferedPackets()));
+        jin.add(u"current", json::Bool(i == current));
+    }
+    json::Value& jout(root.query(u"output", true));
+    jout.add(u"plugin", _output.pluginName());
+    jout.add(u"packets", int64_t(_output.pluginPackets()));
 }
 
 
@@ -489,6 +522,20 @@ bool ts::tsswitch::Core::inputStarted(size_t pluginIndex, bool success)
 
 bool ts::tsswitch::Core::inputReceived(size_t pluginIndex)
 {
+    // Lock-free fast path. With --fast-switch, all input plugins call this method
+    // after each batch of received packets. When the calling plugin is neither the
+    // current nor the primary input and no action is queued, the notification has
+    // no effect. Return without locking the global mutex to avoid contending with
+    // the output thread on each batch which is received by a standby input.
+    // The copies are updated under mutex; a stale value only leads to taking the
+    // slow path or skipping one notification which the next batch will deliver.
+    if (pluginIndex != _curPluginCopy.load(std::memory_order_relaxed) &&
+        pluginIndex != _opt.primary_input &&
+        !_actionsPending.load(std::memory_order_relaxed))
+    {
+        return !_terminate;
+    }
+
     std::lock_guard<std::recursive_mutex> lock(_mutex);
 
     // Restart the receive timeout, if any, when the current input receives packets.
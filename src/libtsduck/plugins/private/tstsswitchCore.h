@@ -16,6 +16,7 @@
 #include "tstsswitchInputExecutor.h"
 #include "tstsswitchOutputExecutor.h"
 #include "tstsswitchEventDispatcher.h"
+#include "tsMetricsServer.h"
 #include "tsWatchDog.h"
 
 namespace ts {
@@ -27,7 +28,7 @@ namespace ts {
         //! Input switch (tsswitch) core engine.
         //! @ingroup libtsduck plugin
         //!
-        class Core: private WatchDogHandlerInterface
+        class Core: public MetricsProviderInterface, private WatchDogHandlerInterface
         {
             TS_NOBUILD_NOCOPY(Core);
         public:
@@ -126,6 +127,9 @@ namespace ts {
             //!
             bool outputSent(size_t pluginIndex, size_t count);
 
+            // Implementation of MetricsProviderInterface.
+            virtual void provideMetrics(json::Object& root) override;
+
         private:
             // Upon reception of an event (end of input, remote command, etc), there
             // is a list of actions to execute which depends on the switch policy.
@@ -174,6 +178,8 @@ namespace ts {
             OutputExecutor              _output;            // Output plugin thread.
             EventDispatcher             _eventDispatcher;   // External event dispatcher.
             WatchDog                    _receiveWatchDog;   // Handle reception timeout.
+            std::atomic<size_t>         _curPluginCopy {0}; // Lock-free copy of _curPlugin for the fast path of inputReceived().
+            std::atomic<bool>           _actionsPending {false}; // Lock-free indicator that _actions is not empty.
             std::recursive_mutex        _mutex {};          // Global mutex, protect access to all subsequent fields.
             std::condition_variable_any _gotInput {};       // Signaled each time an input plugin reports new packets.
             size_t                      _curPlugin = 0;     // Index of current input plugin.
@@ -23,9 +23,7 @@ ts::tsswitch::InputExecutor::InputExecutor(const InputSwitcherArgs& opt,
     // Input threads have a high priority to be always ready to load incoming packets in the buffer.
     PluginExecutor(opt, handlers, PluginType::INPUT, opt.inputs[index], ThreadAttributes().setPriority(ThreadAttributes::GetHighPriority()), core, log),
     _input(dynamic_cast<InputPlugin*>(PluginThread::plugin())),
-    _pluginIndex(index),
-    _buffer(opt.buffered_packets),
-    _metadata(opt.buffered_packets)
+    _pluginIndex(index)
 {
     // Make sure that the input plugins display their index.
     setLogName(UString::Format(u"%s[%d]", pluginName(), _pluginIndex));
@@ -119,9 +117,17 @@ void ts::tsswitch::InputExecutor::terminateInput()
 void ts::tsswitch::InputExecutor::getOutputArea(ts::TSPacket*& first, TSPacketMetadata*& data, size_t& count)
 {
     std::lock_guard<std::recursive_mutex> lock(_mutex);
-    first = &_buffer[_outFirst];
-    data = &_metadata[_outFirst];
-    count = std::min(_outCount, _buffer.size() - _outFirst);
+    if (_buffer.empty()) {
+        // No input session in progress, the buffer is not allocated.
+        first = nullptr;
+        data = nullptr;
+        count = 0;
+    }
+    else {
+        first = &_buffer[_outFirst];
+        data = &_metadata[_outFirst];
+        count = std::min(_outCount, _buffer.size() - _outFirst);
+    }
     _outputInUse = count > 0;
     _todo.notify_one();
 }
@@ -143,6 +149,17 @@ void ts::tsswitch::InputExecutor::freeOutput(size_t count)
 }
 
 
+//----------------------------------------------------------------------------
+// Get the number of packets which are currently buffered (monitoring).
+//----------------------------------------------------------------------------
+
+size_t ts::tsswitch::InputExecutor::bufferedPackets()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _outCount;
+}
+
+
 //----------------------------------------------------------------------------
 // Invoked in the context of the plugin thread.
 //----------------------------------------------------------------------------
@@ -176,6 +193,15 @@ void ts::tsswitch::InputExecutor::main()
             restartPluginSession();
         }
 
+        // Allocate the packet buffer for the duration of the input session. It is
+        // released at the end of the session, so that the buffer memory scales with
+        // the number of started inputs, not with the number of configured inputs.
+        {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
+            _buffer.resize(_opt.buffered_packets);
+            _metadata.resize(_opt.buffered_packets);
+        }
+
         // Here, we need to start an input session.
         debug(u"starting input plugin");
         const bool started = _input->start();
@@ -183,7 +209,12 @@ void ts::tsswitch::InputExecutor::main()
         _core.inputStarted(_pluginIndex, started);
 
         if (!started) {
-            // Failed to start.
+            // Failed to start. Release the buffer while waiting for a new session.
+            {
+                std::lock_guard<std::recursive_mutex> lock(_mutex);
+                TSPacketVector().swap(_buffer);
+                TSPacketMetadataVector().swap(_metadata);
+            }
             _core.inputStopped(_pluginIndex, false);
             // Loop back, waiting for a new session.
             continue;
@@ -256,6 +287,16 @@ void ts::tsswitch::InputExecutor::main()
             {
                 std::lock_guard<std::recursive_mutex> lock(_mutex);
                 _outCount += inCount;
+                // In warm standby mode (--fast-switch with --standby-packets), a non-current
+                // plugin keeps only the most recent packets in its buffer. When a switch
+                // occurs, the output plugin resumes from these recent packets instead of
+                // replaying a full buffer of stale packets. Do not touch the buffer while
+                // the output plugin uses it (transient state during a switch).
+                if (!_isCurrent && _opt.fast_switch && _opt.standby_packets > 0 && !_outputInUse && _outCount > _opt.standby_packets) {
+                    const size_t freeCount = _outCount - _opt.standby_packets;
+                    _outFirst = (_outFirst + freeCount) % _buffer.size();
+                    _outCount = _opt.standby_packets;
+                }
             }
             _core.inputReceived(_pluginIndex);
         }
@@ -272,6 +313,9 @@ void ts::tsswitch::InputExecutor::main()
             // And reset the output part of the buffer.
             _outFirst = 0;
             _outCount = 0;
+            // Release the buffer memory, it will be reallocated at next session start.
+            TSPacketVector().swap(_buffer);
+            TSPacketMetadataVector().swap(_metadata);
         }
 
         // End of input session.
@@ -96,14 +96,21 @@ namespace ts {
             //!
             void freeOutput(size_t count);
 
+            //!
+            //! Get the number of packets which are currently buffered in this input plugin.
+            //! Used for monitoring purposes only.
+            //! @return The number of buffered packets.
+            //!
+            size_t bufferedPackets();
+
             // Implementation of TSP.
             virtual size_t pluginIndex() const override;
 
         private:
             InputPlugin*           _input;                // Plugin API.
             const size_t           _pluginIndex;          // Index of this input plugin.
-            TSPacketVector         _buffer;               // Packet buffer.
-            TSPacketMetadataVector _metadata;             // Packet metadata.
+            TSPacketVector         _buffer {};            // Packet buffer, allocated for the duration of an input session.
+            TSPacketMetadataVector _metadata {};          // Packet metadata, same allocation policy.
             std::recursive_mutex   _mutex {};             // Mutex to protect all subsequent fields.
             std::condition_variable_any _todo {};         // Condition to signal something to do.
             bool                   _isCurrent = false;    // This plugin is the current input one.
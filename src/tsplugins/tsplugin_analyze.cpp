@@ -15,6 +15,11 @@
 #include "tsTSAnalyzerReport.h"
 #include "tsTSSpeedMetrics.h"
 #include "tsFileNameGenerator.h"
+#include "tsMessageQueue.h"
+#include "tsThread.h"
+
+#define BATCH_PACKETS      64  // with --threaded, number of packets per inter-thread message
+#define QUEUE_MAX_MESSAGES 256 // with --threaded, maximum queued messages before blocking the packet thread
 
 
 //----------------------------------------------------------------------------
@@ -22,7 +27,7 @@
 //----------------------------------------------------------------------------
 
 namespace ts {
-    class AnalyzePlugin: public ProcessorPlugin
+    class AnalyzePlugin: public ProcessorPlugin, private Thread
     {
         TS_PLUGIN_CONSTRUCTORS(AnalyzePlugin);
     public:
@@ -33,11 +38,25 @@ namespace ts {
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
 
     private:
+        // With --threaded, packets are passed to the analysis thread in batches.
+        // The last known input bitrate is captured with each batch for use as
+        // hint in reports which are produced on the analysis thread.
+        class PacketBatch
+        {
+        public:
+            PacketBatch() = default;
+            BitRate bitrate = 0;
+            BitRateConfidence bitrate_confidence = BitRateConfidence::LOW;
+            std::vector<std::pair<TSPacket, TSPacketMetadata>> packets {};
+        };
+        using BatchQueue = MessageQueue<PacketBatch>;
+
         // Command line options:
         fs::path          _output_name {};
         cn::nanoseconds   _output_interval {};
         bool              _multiple_output = false;
         bool              _cumulative = false;
+        bool              _threaded = false;
         TSAnalyzerOptions _analyzer_options {};
 
         // Working data:
@@ -47,10 +66,19 @@ namespace ts {
         cn::nanoseconds   _next_report {};
         TSAnalyzerReport  _analyzer {duck};
         FileNameGenerator _name_gen {};
+        BatchQueue        _queue {};
+        BatchQueue::MessagePtr _batch {};
+        std::atomic<bool> _report_error = false;
 
         bool openOutput();
         void closeOutput();
         bool produceReport();
+        bool analyzePacket(TSPacket&, TSPacketMetadata&, const BitRate& bitrate, BitRateConfidence bitrate_confidence);
+        void flushBatch();
+
+        // With --threaded, the analysis and the report generation are performed in this
+        // thread, so that the packet processing never blocks on report formatting.
+        virtual void main() override;
     };
 }
 
@@ -95,6 +123,13 @@ ts::AnalyzePlugin::AnalyzePlugin(TSP* tsp_) :
     help(u"output-file",
          u"Specify the output text file for the analysis result. "
          u"By default, use the standard output.");
+
+    option(u"threaded", 't');
+    help(u"threaded",
+         u"Perform the analysis and the report generation in a separate thread. "
+         u"With --interval on a high-bitrate stream, this prevents the generation "
+         u"of each report from blocking the transmission of TS packets. "
+         u"By default, the analysis is performed in the packet processing thread.");
 }
 
 
@@ -110,6 +145,7 @@ bool ts::AnalyzePlugin::getOptions()
     getChronoValue(_output_interval, u"interval");
     _multiple_output = present(u"multiple-files");
     _cumulative = present(u"cumulative");
+    _threaded = present(u"threaded");
     return true;
 }
 
@@ -136,6 +172,15 @@ bool ts::AnalyzePlugin::start()
         return false;
     }
 
+    // With --threaded, start the analysis thread.
+    if (_threaded) {
+        _batch.reset();
+        _report_error = false;
+        _queue.clear();
+        _queue.setMaxMessages(QUEUE_MAX_MESSAGES);
+        return Thread::start();
+    }
+
     return true;
 }
 
@@ -188,9 +233,6 @@ bool ts::AnalyzePlugin::produceReport()
         return false;
     }
     else {
-        // Set last known input bitrate as hint
-        _analyzer.setBitrateHint(tsp->bitrate(), tsp->bitrateConfidence());
-
         // Produce the report
         _analyzer.report(*_output, _analyzer_options, *this);
         closeOutput();
@@ -199,12 +241,96 @@ bool ts::AnalyzePlugin::produceReport()
 }
 
 
+//----------------------------------------------------------------------------
+// Feed the analyzer with one packet and produce periodic reports.
+//----------------------------------------------------------------------------
+
+bool ts::AnalyzePlugin::analyzePacket(TSPacket& pkt, TSPacketMetadata& pkt_data, const BitRate& bitrate, BitRateConfidence bitrate_confidence)
+{
+    // Feed the analyzer with one packet
+    _analyzer.feedPacket(pkt, pkt_data);
+
+    // With --interval, check if it is time to produce a report
+    if (_output_interval > cn::nanoseconds::zero() && _metrics.processedPacket() && _metrics.sessionNanoSeconds() >= _next_report) {
+        // Time to produce a report. Set last known input bitrate as hint.
+        _analyzer.setBitrateHint(bitrate, bitrate_confidence);
+        if (!produceReport()) {
+            return false;
+        }
+        // Reset analysis context.
+        if (!_cumulative) {
+            _analyzer.reset();
+        }
+        // Compute next report time.
+        _next_report += _output_interval;
+    }
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// With --threaded, pass the current batch of packets to the analysis thread.
+//----------------------------------------------------------------------------
+
+void ts::AnalyzePlugin::flushBatch()
+{
+    if (_batch != nullptr) {
+        // Capture the last known input bitrate with the batch.
+        _batch->bitrate = tsp->bitrate();
+        _batch->bitrate_confidence = tsp->bitrateConfidence();
+        // If the queue is full (the analysis thread is formatting a report),
+        // wait instead of dropping packets, the analysis must remain exact.
+        _queue.enqueue(_batch);
+        _batch.reset();
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Analysis thread with --threaded.
+//----------------------------------------------------------------------------
+
+void ts::AnalyzePlugin::main()
+{
+    debug(u"analysis thread started");
+
+    for (;;) {
+        // Wait for one batch of packets, stop on null pointer.
+        BatchQueue::MessagePtr batch;
+        _queue.dequeue(batch);
+        if (batch == nullptr) {
+            break;
+        }
+        for (auto& it : batch->packets) {
+            if (!analyzePacket(it.first, it.second, batch->bitrate, batch->bitrate_confidence)) {
+                // Report the error to the packet processing thread.
+                _report_error = true;
+                break;
+            }
+        }
+    }
+
+    debug(u"analysis thread terminated");
+}
+
+
 //----------------------------------------------------------------------------
 // Stop method
 //----------------------------------------------------------------------------
 
 bool ts::AnalyzePlugin::stop()
 {
+    // With --threaded, flush buffered packets, send a termination message and
+    // wait for the analysis thread to drain the queue.
+    if (_threaded) {
+        flushBatch();
+        _queue.forceEnqueue(nullptr);
+        Thread::waitForTermination();
+    }
+
+    // Produce the final report.
+    _analyzer.setBitrateHint(tsp->bitrate(), tsp->bitrateConfidence());
     produceReport();
     return true;
 }
@@ -216,22 +342,22 @@ bool ts::AnalyzePlugin::stop()
 
 ts::ProcessorPlugin::Status ts::AnalyzePlugin::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
 {
-    // Feed the analyzer with one packet
-    _analyzer.feedPacket(pkt, pkt_data);
-
-    // With --interval, check if it is time to produce a report
-    if (_output_interval > cn::nanoseconds::zero() && _metrics.processedPacket() && _metrics.sessionNanoSeconds() >= _next_report) {
-        // Time to produce a report.
-        if (!produceReport()) {
+    if (_threaded) {
+        // Pass the packet to the analysis thread, never analyze or format here.
+        if (_report_error) {
             return TSP_END;
         }
-        // Reset analysis context.
-        if (!_cumulative) {
-            _analyzer.reset();
+        if (_batch == nullptr) {
+            _batch = std::make_shared<PacketBatch>();
+            _batch->packets.reserve(BATCH_PACKETS);
         }
-        // Compute next report time.
-        _next_report += _output_interval;
+        _batch->packets.emplace_back(pkt, pkt_data);
+        if (_batch->packets.size() >= BATCH_PACKETS) {
+            flushBatch();
+        }
+        return TSP_OK;
     }
 
-    return TSP_OK;
+    // Synchronous analysis in the packet processing thread.
+    return analyzePacket(pkt, pkt_data, tsp->bitrate(), tsp->bitrateConfidence()) ? TSP_OK : TSP_END;
 }
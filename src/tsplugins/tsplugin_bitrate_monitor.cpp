@@ -18,6 +18,8 @@
 #include "tsxmlAttribute.h"
 #include "tsTime.h"
 #include "tsSingleDataStatistics.h"
+#include "tsMessageQueue.h"
+#include "tsThread.h"
 
 
 //----------------------------------------------------------------------------
@@ -25,7 +27,7 @@
 //----------------------------------------------------------------------------
 
 namespace ts {
-    class BitrateMonitorPlugin: public ProcessorPlugin
+    class BitrateMonitorPlugin: public ProcessorPlugin, private Thread
     {
         TS_PLUGIN_CONSTRUCTORS(BitrateMonitorPlugin);
     public:
@@ -41,6 +43,12 @@ namespace ts {
         static constexpr BitRate::int_t DEFAULT_BITRATE_MIN = 10;
         static constexpr BitRate::int_t DEFAULT_BITRATE_MAX = 0xFFFFFFFF;
         static constexpr size_t DEFAULT_TIME_WINDOW_SIZE = 5;
+        static constexpr size_t MAX_QUEUED_COMMANDS = 16;
+        static constexpr size_t COMMAND_THREAD_STACK_SIZE = 128 * 1024;
+        static constexpr PacketCounter MAX_CLOCK_CHECK_INTERVAL = 256;
+
+        // Queue of alarm commands to execute in the internal thread.
+        using CommandQueue = MessageQueue<UString>;
 
         // Type indicating status of current bitrate, regarding allowed range.
         enum RangeStatus {LOWER, IN_RANGE, GREATER};
@@ -93,7 +101,15 @@ namespace ts {
         bool                _startup = false;         // Measurement in progress.
         size_t              _periods_index = 0;       // Index for packet number array.
         std::vector<Period> _periods {};              // Number of packets received during last time window, second per second.
+        cn::nanoseconds     _window_duration {0};     // Rolling sum of the duration of all periods in the window.
+        PacketCounter       _window_packets = 0;      // Rolling sum of matching packets in the window.
+        PacketCounter       _window_non_null = 0;     // Rolling sum of non-null matching packets in the window.
+        PacketCounter       _check_countdown = 0;     // Number of packets to process before the next clock check.
+        PacketCounter       _period_packets = 0;      // All processed packets (any PID) in the current period.
+        PacketCounter       _packets_per_period = 0;  // All processed packets in the last complete period.
+        bool                _command_thread = false;  // The alarm command thread was started.
         TSPacketLabelSet    _labels_next {};          // Set these labels on next packet.
+        CommandQueue        _command_queue {MAX_QUEUED_COMMANDS};  // Alarm commands to execute.
         SingleDataStatistics<int64_t> _stats {};      // Bitrate statistics.
         SingleDataStatistics<int64_t> _net_stats {};  // Non-null bitrate statistics.
 
@@ -105,6 +121,9 @@ namespace ts {
 
         // Add common JSON parts and log the message.
         void jsonLine(const UChar* status, int64_t bitrate, int64_t net_bitrate);
+
+        // Invoked in the context of the alarm command execution thread.
+        virtual void main() override;
     };
 }
 
@@ -116,7 +135,8 @@ TS_REGISTER_PROCESSOR_PLUGIN(u"bitrate_monitor", ts::BitrateMonitorPlugin);
 //----------------------------------------------------------------------------
 
 ts::BitrateMonitorPlugin::BitrateMonitorPlugin(TSP* tsp_) :
-    ProcessorPlugin(tsp_, u"Monitor bitrate for TS or a given set of PID's", u"[options]")
+    ProcessorPlugin(tsp_, u"Monitor bitrate for TS or a given set of PID's", u"[options]"),
+    Thread(ThreadAttributes().setStackSize(COMMAND_THREAD_STACK_SIZE))
 {
     // The PID was previously passed as argument. We now use option --pid.
     // We still accept the argument for legacy, but not both.
@@ -305,6 +325,12 @@ bool ts::BitrateMonitorPlugin::start()
     }
 
     _periods_index = 0;
+    _window_duration = cn::nanoseconds::zero();
+    _window_packets = 0;
+    _window_non_null = 0;
+    _check_countdown = 0;
+    _period_packets = 0;
+    _packets_per_period = 0;
     _labels_next.reset();
     _bitrate_countdown = _periodic_bitrate;
     _command_countdown = _periodic_command;
@@ -314,6 +340,13 @@ bool ts::BitrateMonitorPlugin::start()
     _stats.reset();
     _net_stats.reset();
 
+    // Start the internal thread which executes the alarm commands.
+    if (!_alarm_command.empty()) {
+        _command_queue.clear();
+        _command_thread = true;
+        Thread::start();
+    }
+
     // We must never wait for packets more than one second.
     tsp->setPacketTimeout(cn::seconds(1));
 
@@ -327,6 +360,15 @@ bool ts::BitrateMonitorPlugin::start()
 
 bool ts::BitrateMonitorPlugin::stop()
 {
+    // Send a termination message to the alarm command thread and wait for its completion.
+    // An empty message is the end-of-thread marker, actual commands are never empty.
+    if (_command_thread) {
+        _command_thread = false;
+        CommandQueue::MessagePtr eot(new UString);
+        _command_queue.forceEnqueue(eot);
+        Thread::waitForTermination();
+    }
+
     if (_summary) {
         const int64_t bitrate = _stats.meanRound();
         const int64_t net_bitrate = _net_stats.meanRound();
@@ -374,21 +416,13 @@ void ts::BitrateMonitorPlugin::jsonLine(const UChar* status, int64_t bitrate, in
 
 void ts::BitrateMonitorPlugin::computeBitrate()
 {
-    // Compute total duration and packets.
-    cn::nanoseconds duration {0};
-    PacketCounter total_pkt_count = 0;
-    PacketCounter non_null_count = 0;
-    for (auto& p : _periods) {
-        duration += p.duration;
-        total_pkt_count += p.packets;
-        non_null_count += p.non_null;
-    }
-
+    // The total duration and packets over the time window are maintained
+    // as rolling sums in checkTime(), no need to loop on the periods.
     // Nanoseconds is an unusually large precision which may lead to overflows.
     // Using seconds is not precise enough. Use microseconds.
-    const cn::microseconds microsec = cn::duration_cast<cn::microseconds>(duration);
-    const BitRate bitrate = PacketBitRate(total_pkt_count, microsec);
-    const BitRate net_bitrate = PacketBitRate(non_null_count, microsec);
+    const cn::microseconds microsec = cn::duration_cast<cn::microseconds>(_window_duration);
+    const BitRate bitrate = PacketBitRate(_window_packets, microsec);
+    const BitRate net_bitrate = PacketBitRate(_window_non_null, microsec);
 
     // Accumulate statistics for the final report.
     if (_summary) {
@@ -464,11 +498,14 @@ void ts::BitrateMonitorPlugin::computeBitrate()
         }
 
         // Call alarm script if defined.
-        // The command is run asynchronously, do not wait for completion.
+        // The command is executed from the internal thread, the cost of the
+        // fork does not disturb the packet path. Do not wait on a full queue.
         if (!_alarm_command.empty()) {
-            UString command;
-            command.format(u"%s \"%s\" %s %s %d %d %d %d", _alarm_command, alarm_message, _alarm_target, alarm_status, bitrate, _min_bitrate, _max_bitrate, net_bitrate);
-            ForkPipe::Launch(command, *this, ForkPipe::STDERR_ONLY, ForkPipe::STDIN_NONE);
+            CommandQueue::MessagePtr command(new UString);
+            command->format(u"%s \"%s\" %s %s %d %d %d %d", _alarm_command, alarm_message, _alarm_target, alarm_status, bitrate, _min_bitrate, _max_bitrate, net_bitrate);
+            if (!_command_queue.enqueue(command, cn::milliseconds::zero())) {
+                warning(u"alarm command queue overflow, command dropped");
+            }
         }
 
         // Update status
@@ -490,9 +527,15 @@ void ts::BitrateMonitorPlugin::checkTime()
     // New second : compute the bitrate for the last time window
     if (since_last_second >= cn::seconds(1)) {
 
-        // Exact duration of the last period and restart a new period.
-        _periods[_periods_index].duration = since_last_second;
+        // Exact duration of the last period, add it to the rolling sums.
+        Period& last(_periods[_periods_index]);
+        last.duration = since_last_second;
+        _window_duration += last.duration;
+        _window_packets += last.packets;
+        _window_non_null += last.non_null;
         _last_second = now;
+        _packets_per_period = _period_packets;
+        _period_packets = 0;
 
         // Bitrate computation is done only when the packet counter
         // array if fully filled (to avoid bad values at startup).
@@ -500,15 +543,24 @@ void ts::BitrateMonitorPlugin::checkTime()
             computeBitrate();
         }
 
-        // update index, and reset packet count.
+        // Update index, retire the oldest period from the rolling sums and reuse its slot.
         _periods_index = (_periods_index + 1) % _periods.size();
-        _periods[_periods_index].clear();
+        Period& oldest(_periods[_periods_index]);
+        _window_duration -= oldest.duration;
+        _window_packets -= oldest.packets;
+        _window_non_null -= oldest.non_null;
+        oldest.clear();
 
         // We are no more at startup if the index cycles.
         if (_startup) {
             _startup = _periods_index != 0;
         }
     }
+
+    // Recalibrate the number of packets before the next clock check, targetting
+    // approximately one check per millisecond. At startup or at very low bitrate,
+    // the countdown is zero and the clock is checked on each packet.
+    _check_countdown = std::min<PacketCounter>(_packets_per_period / 1024, MAX_CLOCK_CHECK_INTERVAL);
 }
 
 
@@ -539,9 +591,17 @@ ts::ProcessorPlugin::Status ts::BitrateMonitorPlugin::processPacket(TSPacket& pk
             _periods[_periods_index].non_null++;
         }
     }
+    _period_packets++;
 
-    // Check time and bitrates.
-    checkTime();
+    // Check time and bitrates. Reading the system clock is more expensive than
+    // the rest of the per-packet processing. At significant bitrates, check the
+    // clock every few packets only, the countdown being calibrated in checkTime().
+    if (_check_countdown == 0) {
+        checkTime();
+    }
+    else {
+        _check_countdown--;
+    }
 
     // Set labels according to trigger.
     pkt_data.setLabels(_labels_next);
@@ -565,3 +625,26 @@ ts::ProcessorPlugin::Status ts::BitrateMonitorPlugin::processPacket(TSPacket& pk
     // Pass all packets
     return TSP_OK;
 }
+
+
+//----------------------------------------------------------------------------
+// Invoked in the context of the alarm command execution thread.
+//----------------------------------------------------------------------------
+
+void ts::BitrateMonitorPlugin::main()
+{
+    debug(u"alarm command thread started");
+
+    // Loop on enqueued alarm commands, until the empty end-of-thread marker.
+    // The commands are run asynchronously, do not wait for their completion.
+    CommandQueue::MessagePtr command;
+    for (;;) {
+        _command_queue.dequeue(command);
+        if (command == nullptr || command->empty()) {
+            break;
+        }
+        ForkPipe::Launch(*command, *this, ForkPipe::STDERR_ONLY, ForkPipe::STDIN_NONE);
+    }
+
+    debug(u"alarm command thread completed");
+}
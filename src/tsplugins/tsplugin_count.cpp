@@ -29,7 +29,10 @@ namespace ts {
         virtual bool getOptions() override;
         virtual bool start() override;
         virtual bool stop() override;
+        virtual size_t getPacketWindowSize() override;
+        virtual bool isParallelSafe() const override;
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
+        virtual size_t processPacketWindow(TSPacketWindow& win) override;
 
     private:
         // This structure is used at each --interval.
@@ -54,17 +57,26 @@ namespace ts {
         PacketCounter  _report_interval = 0;     // If non-zero, report time-stamp at this packet interval
         fs::path       _outfile_name {};         // Output file name.
 
+        // Default number of packets per window in pure counting mode.
+        static constexpr size_t DEFAULT_PACKET_WINDOW = 512;
+
         // Working data:
         std::ofstream  _outfile {};              // User-specified output file
         IntervalReport _last_report {};          // Last report content
-        PacketCounter  _counters[PID_MAX] {};    // Packet counter per PID
+
+        // Packet counter per PID. Relaxed atomics: in pure counting mode, disjoint
+        // packet windows can be counted in parallel and asynchronous readers always
+        // see consistent values. The counters are order-independent, no other memory
+        // ordering is needed.
+        std::atomic<PacketCounter> _counters[PID_MAX] {};
 
         // Report a line
         template <class... Args>
         void report(const UChar* fmt, Args&&... args)
         {
             if (_outfile.is_open()) {
-                _outfile << UString::Format(fmt, std::forward<ArgMixIn>(args)...) << std::endl;
+                // Do not flush on each line, the file is flushed when closed.
+                _outfile << UString::Format(fmt, std::forward<ArgMixIn>(args)...) << '\n';
             }
             else {
                 info(fmt, std::forward<ArgMixIn>(args)...);
@@ -173,8 +185,29 @@ bool ts::CountPlugin::start()
     }
 
     // Reset state
-    TS_ZERO(_counters);
+    for (size_t pid = 0; pid < PID_MAX; pid++) {
+        _counters[pid].store(0, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Packet window processing parameters.
+//----------------------------------------------------------------------------
+
+size_t ts::CountPlugin::getPacketWindowSize()
+{
+    // In pure counting mode, count whole packet windows at a time.
+    // With per-packet or interval reporting, keep the packet method so that
+    // report lines stay synchronous with the stream.
+    return _report_all || _report_interval > 0 ? 0 : DEFAULT_PACKET_WINDOW;
+}
 
+bool ts::CountPlugin::isParallelSafe() const
+{
+    // Counting is order-independent, disjoint windows can be counted concurrently.
     return true;
 }
 
@@ -188,12 +221,13 @@ bool ts::CountPlugin::stop()
     // Display final report
     if (_report_summary) {
         for (size_t pid = 0; pid < PID_MAX; pid++) {
-            if (_counters[pid] > 0) {
+            const PacketCounter count = _counters[pid].load(std::memory_order_relaxed);
+            if (count > 0) {
                 if (_brief_report) {
-                    report(u"%d %d", pid, _counters[pid]);
+                    report(u"%d %d", pid, count);
                 }
                 else {
-                    report(u"%sPID %4d (0x%04X): %10'd packets", _tag, pid, pid, _counters[pid]);
+                    report(u"%sPID %4d (0x%04X): %10'd packets", _tag, pid, pid, count);
                 }
             }
         }
@@ -201,7 +235,7 @@ bool ts::CountPlugin::stop()
     if (_report_total) {
         PacketCounter total = 0;
         for (size_t pid = 0; pid < PID_MAX; pid++) {
-            total += _counters[pid];
+            total += _counters[pid].load(std::memory_order_relaxed);
         }
         if (_brief_report) {
             report(u"%d", total);
@@ -249,7 +283,7 @@ ts::ProcessorPlugin::Status ts::CountPlugin::processPacket(TSPacket& pkt, TSPack
             now.total_packets = tsp->pluginPackets();
             now.counted_packets = 0;
             for (size_t p = 0; p < PID_MAX; p++) {
-                now.counted_packets += _counters[p];
+                now.counted_packets += _counters[p].load(std::memory_order_relaxed);
             }
 
             // Compute bitrates.
@@ -278,8 +312,28 @@ ts::ProcessorPlugin::Status ts::CountPlugin::processPacket(TSPacket& pkt, TSPack
                 report(u"%spacket: %10'd, PID: %4d (0x%04X)", _tag, tsp->pluginPackets(), pid, pid);
             }
         }
-        _counters[pid]++;
+        _counters[pid].fetch_add(1, std::memory_order_relaxed);
     }
 
     return TSP_OK;
 }
+
+
+//----------------------------------------------------------------------------
+// Packet window processing method. Called in pure counting mode.
+//----------------------------------------------------------------------------
+
+size_t ts::CountPlugin::processPacketWindow(TSPacketWindow& win)
+{
+    // No per-packet reporting in this mode, simply update the counters.
+    for (size_t i = 0; i < win.size(); ++i) {
+        const TSPacket* pkt = win.packet(i);
+        if (pkt != nullptr) {
+            const PID pid = pkt->getPID();
+            if (_pids[pid] != _negate) {
+                _counters[pid].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    return win.size();
+}
@@ -39,6 +39,7 @@ namespace ts {
 
         // Working data:
         PacketCounter    _limit = 0;            // Current max number of packets
+        bool             _incrementCC = false;  // Increment the continuity counter between packets
         TSPacket         _packet {NullPacket};  // Template of packet to generate
         TSPacketMetadata _mdata {};             // Metadata of packet to generate
     };
@@ -375,6 +376,9 @@ bool ts::CraftInput::start()
 {
     _packet.setCC(_initCC);
     _limit = _maxCount;
+    // The packet template was fully built in getOptions(). The only field
+    // which may change from one packet to the next is the continuity counter.
+    _incrementCC = !_constantCC && _packet.hasPayload();
     return true;
 }
 
@@ -411,16 +415,20 @@ size_t ts::CraftInput::receive(TSPacket* buffer, TSPacketMetadata* pkt_data, siz
         _limit = std::numeric_limits<PacketCounter>::max();
     }
 
-    // Fill buffer
+    // Fill buffer. Each packet is a plain copy of the template, then the
+    // continuity counter is patched in place in the copy when necessary.
+    uint8_t cc = _packet.getCC();
     size_t n;
     for (n = 0; n < maxPackets && previousCount + n < _limit; n++) {
         buffer[n] = _packet;
         pkt_data[n] = _mdata;
-        // Increment the continuity counter for the next packet when necessary.
-        if (!_constantCC && _packet.hasPayload()) {
-            _packet.setCC((_packet.getCC() + 1) & CC_MASK);
+        if (_incrementCC) {
+            buffer[n].b[3] = uint8_t((buffer[n].b[3] & ~CC_MASK) | cc);
+            cc = (cc + 1) & CC_MASK;
         }
     }
+    // Save the continuity counter of the next packet in the template.
+    _packet.setCC(cc);
     return n;
 }
 
@@ -32,12 +32,13 @@ namespace ts {
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
 
     private:
-        using TSPacketPtr = std::shared_ptr<TSPacket>;
-        using TSPacketPtrQueue = std::deque<TSPacketPtr>;
+        // Buffered packets are stored by value: the deque allocates them by
+        // chunks, avoiding one heap allocation per duplicated packet.
+        using TSPacketQueue = std::deque<TSPacket>;
 
-        bool             _silentDrop = false;  // Silently drop packets on overflow.
-        size_t           _maxBuffered = 0;     // Max buffered packets.
-        TSPacketPtrQueue _queue {};            // Buffered packets, waiting for null packets to replace.
+        bool          _silentDrop = false;  // Silently drop packets on overflow.
+        size_t        _maxBuffered = 0;     // Max buffered packets.
+        TSPacketQueue _queue {};            // Buffered packets, waiting for null packets to replace.
     };
 }
 
@@ -101,9 +102,8 @@ ts::ProcessorPlugin::Status ts::DuplicatePlugin::processPacket(TSPacket& pkt, TS
 {
     // Get old and new PID.
     const PID pid = pkt.getPID();
-    const auto it = _pidMap.find(pid);
-    const bool duplicate = it != _pidMap.end();
-    const PID newpid = duplicate ? it->second : pid;
+    const bool duplicate = isMappedPID(pid);
+    const PID newpid = outputPID(pid);
 
     // Check PID conflicts.
     if (!_unchecked && !duplicate && _newPIDs.test(pid)) {
@@ -114,7 +114,7 @@ ts::ProcessorPlugin::Status ts::DuplicatePlugin::processPacket(TSPacket& pkt, TS
     // Process insertion of buffered packet when input is a null packet.
     if (pid == PID_NULL && !_queue.empty()) {
         // Copy the packet in front of the list.
-        pkt = *_queue.front();
+        pkt = _queue.front();
         // And remove it from the list.
         _queue.pop_front();
         // Apply labels on duplicated packets.
@@ -132,9 +132,8 @@ ts::ProcessorPlugin::Status ts::DuplicatePlugin::processPacket(TSPacket& pkt, TS
             }
         }
         // Copy the packet in the buffer with the new PID.
-        const TSPacketPtr newpkt(new TSPacket(pkt));
-        newpkt->setPID(newpid);
-        _queue.push_back(newpkt);
+        _queue.push_back(pkt);
+        _queue.back().setPID(newpid);
     }
 
     return TSP_OK;
@@ -84,19 +84,19 @@ namespace ts {
         EITRepetitionProfile _eit_profile {};
 
         // Working data.
-        FileListener  _file_listener {this};
-        EITGenerator  _eit_gen {duck, PID_EIT};
-        volatile bool _check_files = false;    // there are files in _polled_files
-        std::mutex    _polled_files_mutex {};  // exclusive access to _polled_files
-        UStringList   _polled_files {};        // accessed by two threads, protected by mutex above.
+        FileListener     _file_listener {this};
+        EITGenerator     _eit_gen {duck, PID_EIT};
+        volatile bool    _check_staged = false;  // there are sections in _staged_sections
+        std::mutex       _staged_mutex {};       // exclusive access to _staged_sections
+        SectionPtrVector _staged_sections {};    // sections parsed by the listener thread, waiting to be loaded in the EPG.
 
         // Specific support for deterministic start (wfb = wait first batch, non-regression testing).
         volatile bool _wfb_received = false;   // First batch was received.
         std::mutex    _wfb_mutex {};           // Mutex waiting for _wfb_received.
         std::condition_variable _wfb_cond {};  // Condition waiting for _wfb_received.
 
-        // Load files in the context of the plugin thread.
-        void loadFiles();
+        // Load the staged sections in the EPG, in the context of the plugin thread.
+        void loadStagedSections();
 
         // Read a chrone option, using its current version as default value.
         template <class Rep, class Period>
@@ -427,9 +427,9 @@ bool ts::EITInjectPlugin::start()
 
     // Start the file polling.
     {
-        std::lock_guard<std::mutex> lock(_polled_files_mutex);
-        _check_files = false;
-        _polled_files.clear();
+        std::lock_guard<std::mutex> lock(_staged_mutex);
+        _check_staged = false;
+        _staged_sections.clear();
     }
     if (!_files.empty()) {
 
@@ -444,7 +444,7 @@ bool ts::EITInjectPlugin::start()
                 _wfb_cond.wait(lock, [this]() { return _wfb_received; });
             }
             verbose(u"received first batch of events");
-            loadFiles();
+            loadStagedSections();
         }
     }
 
@@ -472,9 +472,9 @@ bool ts::EITInjectPlugin::stop()
 
 ts::ProcessorPlugin::Status ts::EITInjectPlugin::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
 {
-    // If the file listener thread signaled the volatile bool, process files.
-    if (_check_files) {
-        loadFiles();
+    // If the file listener thread staged parsed sections, load them in the EPG.
+    if (_check_staged) {
+        loadStagedSections();
     }
 
     // Let the EIT generator process the packet.
@@ -534,20 +534,36 @@ bool ts::EITInjectPlugin::FileListener::updatePollFiles(UString& wildcard, cn::m
 // Invoked with modified files.
 bool ts::EITInjectPlugin::FileListener::handlePolledFiles(const PolledFileList& files)
 {
-    // Add the polled files to the list to be processed by the plugin thread.
-    {
-        std::lock_guard<std::mutex> lock(_plugin->_polled_files_mutex);
-        // Insert one by one, avoiding duplicates.
-        for (const auto& it : files) {
-            // If file was updated (ie. not deleted) and not already present in _polled_files.
-            if (it->updated() && std::find(_plugin->_polled_files.begin(), _plugin->_polled_files.end(), it->getFileName()) == _plugin->_polled_files.end()) {
-                _plugin->_polled_files.push_back(it->getFileName());
-                _plugin->_check_files = true;
+    // Load and parse the files in the context of the listener thread. Parsing a large
+    // XML file takes time and would freeze the injection in the plugin thread.
+    SectionPtrVector sections;
+    for (const auto& it : files) {
+        // Process only files which were updated (ie. not deleted).
+        if (it->updated()) {
+            const UString name(it->getFileName());
+
+            // Load sections from the file.
+            _plugin->verbose(u"loading events from file %s", name);
+            SectionFile secfile(_plugin->duck);
+            if (secfile.load(name)) {
+                sections.insert(sections.end(), secfile.sections().begin(), secfile.sections().end());
+            }
+
+            // Delete file after successful load when required.
+            if (_plugin->_delete_files) {
+                fs::remove(name, &ErrCodeReport(*_plugin, u"error deleting", name));
             }
         }
     }
 
-    // If --wait-first-batch was specified, signal when the first batch of commands is queued.
+    // Stage the parsed sections for the plugin thread.
+    if (!sections.empty()) {
+        std::lock_guard<std::mutex> lock(_plugin->_staged_mutex);
+        _plugin->_staged_sections.insert(_plugin->_staged_sections.end(), sections.begin(), sections.end());
+        _plugin->_check_staged = true;
+    }
+
+    // If --wait-first-batch was specified, signal when the first batch of events is staged.
     if (_plugin->_wait_first_batch && !_plugin->_wfb_received) {
         std::lock_guard<std::mutex> lock(_plugin->_wfb_mutex);
         _plugin->_wfb_received = true;
@@ -559,29 +575,20 @@ bool ts::EITInjectPlugin::FileListener::handlePolledFiles(const PolledFileList&
 
 
 //----------------------------------------------------------------------------
-// Load files in the context of the plugin thread.
+// Load the staged sections in the EPG, in the context of the plugin thread.
 //----------------------------------------------------------------------------
 
-void ts::EITInjectPlugin::loadFiles()
+void ts::EITInjectPlugin::loadStagedSections()
 {
-    std::lock_guard<std::mutex> lock(_polled_files_mutex);
-
-    for (const auto& it : _polled_files) {
-
-        // Load events from the file into the EPG database
-        verbose(u"loading events from file %s", it);
-        SectionFile secfile(duck);
-        if (secfile.load(it)) {
-            _eit_gen.loadEvents(secfile);
-        }
-
-        // Delete file after successful load when required.
-        if (_delete_files) {
-            fs::remove(it, &ErrCodeReport(*this, u"error deleting", it));
-        }
+    // Atomically grab the sections which were staged by the listener thread.
+    // The plugin thread is never blocked by a file being parsed.
+    SectionPtrVector sections;
+    {
+        std::lock_guard<std::mutex> lock(_staged_mutex);
+        sections.swap(_staged_sections);
+        _check_staged = false;
     }
 
-    // Reset polled files.
-    _polled_files.clear();
-    _check_files = false;
+    // Load the events in the EPG database.
+    _eit_gen.loadEvents(sections);
 }
@@ -31,6 +31,7 @@ namespace ts {
         virtual bool getOptions() override;
         virtual bool start() override;
         virtual bool stop() override;
+        virtual bool reconfigure() override;
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
 
     private:
@@ -42,6 +43,7 @@ namespace ts {
         Status             _drop_status = TSP_DROP;     // Return status for unselected packets
         int                _scrambling_ctrl = 0;        // Scrambling control value (<0: no filter)
         bool               _need_demux = false;         // Need the help of the signalization demux.
+        bool               _simple_filter = false;      // Only PID and label filters, use a fast path.
         bool               _with_payload = false;       // Packets with payload
         bool               _with_af = false;            // Packets with adaptation field
         bool               _with_pes = false;           // Packets with clear PES headers
@@ -435,6 +437,49 @@ bool ts::FilterPlugin::getOptions()
     // If we look for service names, we also need to be notified of changes in service list.
     _demux.setHandler(_service_names.empty() ? nullptr : this);
 
+    // Check if the PID and label filters are the only active criteria. This is a
+    // common case (eg. "tsp -P filter -p pid -l label") and the packet processing
+    // then uses a fast path with two bitset tests instead of the full chain of
+    // conditions. All other criteria are compared to their "no filter" value.
+    _simple_filter =
+        !_need_demux &&
+        _scrambling_ctrl < 0 && !_with_payload && !_with_af && !_with_pes && !_with_pcr && !_with_splice &&
+        !_unit_start && !_nullified && !_input_stuffing && !_valid &&
+        _min_payload < 0 && _max_payload < 0 && _min_af < 0 && _max_af < 0 &&
+        _splice < -128 && _min_splice < -128 && _max_splice < -128 &&
+        _every_packets == 0 &&
+        _ranges.empty() && _stream_ids.empty() && _isdb_layers.empty() && _pattern.empty();
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Apply new options in place (tspcontrol command "reconfigure").
+//----------------------------------------------------------------------------
+
+bool ts::FilterPlugin::reconfigure()
+{
+    // Reload all filtering criteria from the new command line.
+    if (!getOptions()) {
+        return false;
+    }
+
+    // Rebuild the set of filtered service ids from the new criteria. Services
+    // which are filtered by name are re-resolved from the signalization which
+    // the demux has already accumulated, without waiting for a PMT update.
+    _all_service_ids = _service_ids;
+    ServiceList services;
+    _demux.getServices(services);
+    for (const auto& srv : services) {
+        const UString service_name(srv.getName());
+        for (const auto& name : _service_names) {
+            if (srv.hasId() && name.similar(service_name)) {
+                _all_service_ids.insert(srv.getId());
+                break;
+            }
+        }
+    }
     return true;
 }
 
@@ -492,61 +537,68 @@ ts::ProcessorPlugin::Status ts::FilterPlugin::processPacket(TSPacket& pkt, TSPac
     }
 
     // Check if the packet matches one of the selected criteria.
-    const PIDClass pidclass = _demux.pidClass(pid);
-    bool ok = _explicit_pid[pid] ||
-        pkt_data.hasAnyLabel(_labels) ||
-        _stream_id_pid[pid] ||
-        _demux.inAnyService(pid, _all_service_ids) ||
-        (_with_payload && pkt.hasPayload()) ||
-        (_with_af && pkt.hasAF()) ||
-        (_unit_start && pkt.getPUSI()) ||
-        (_codec != CodecType::UNDEFINED && _demux.codecType(pid) == _codec) ||
-        (_audio && pidclass == PIDClass::AUDIO) ||
-        (_video && pidclass == PIDClass::VIDEO) ||
-        (_subtitles && pidclass == PIDClass::SUBTITLES) ||
-        (_ecm && pidclass == PIDClass::ECM) ||
-        (_emm && pidclass == PIDClass::EMM) ||
-        (_psi && pidclass == PIDClass::PSI) ||
-        (_intra_frame && _demux.atIntraFrame(pid)) ||
-        (_nullified && pkt_data.getNullified()) ||
-        (_input_stuffing && pkt_data.getInputStuffing()) ||
-        (_valid && pkt.hasValidSync() && !pkt.getTEI()) ||
-        (_scrambling_ctrl == pkt.getScrambling()) ||
-        (_with_pcr && (pkt.hasPCR() || pkt.hasOPCR())) ||
-        (_with_splice && pkt.hasSpliceCountdown()) ||
-        (_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() == _splice) ||
-        (_min_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() >= _min_splice) ||
-        (_max_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() <= _max_splice) ||
-        (_min_payload >= 0 && int(pkt.getPayloadSize()) >= _min_payload) ||
-        (int(pkt.getPayloadSize()) <= _max_payload) ||
-        (_min_af >= 0 && int(pkt.getAFSize()) >= _min_af) ||
-        (int(pkt.getAFSize()) <= _max_af) ||
-        (_every_packets > 0 && (tsp->pluginPackets() - _after_packets) % _every_packets == 0) ||
-        (_with_pes && pkt.startPES());
-
-    // Get ISDB layer if required.
-    if (!ok && !_isdb_layers.empty()) {
-        // Do not check if ISDB is part of the standards, assume it if option --isdb-layer is present.
-        const ISDBTInformation info(duck, pkt_data, false);
-        ok = info.is_valid && _isdb_layers.contains(info.layer_indicator);
+    bool ok = false;
+    if (_simple_filter) {
+        // Fast path: only the PID and label filters are active.
+        ok = _explicit_pid[pid] || pkt_data.hasAnyLabel(_labels);
     }
+    else {
+        const PIDClass pidclass = _demux.pidClass(pid);
+        ok = _explicit_pid[pid] ||
+            pkt_data.hasAnyLabel(_labels) ||
+            _stream_id_pid[pid] ||
+            _demux.inAnyService(pid, _all_service_ids) ||
+            (_with_payload && pkt.hasPayload()) ||
+            (_with_af && pkt.hasAF()) ||
+            (_unit_start && pkt.getPUSI()) ||
+            (_codec != CodecType::UNDEFINED && _demux.codecType(pid) == _codec) ||
+            (_audio && pidclass == PIDClass::AUDIO) ||
+            (_video && pidclass == PIDClass::VIDEO) ||
+            (_subtitles && pidclass == PIDClass::SUBTITLES) ||
+            (_ecm && pidclass == PIDClass::ECM) ||
+            (_emm && pidclass == PIDClass::EMM) ||
+            (_psi && pidclass == PIDClass::PSI) ||
+            (_intra_frame && _demux.atIntraFrame(pid)) ||
+            (_nullified && pkt_data.getNullified()) ||
+            (_input_stuffing && pkt_data.getInputStuffing()) ||
+            (_valid && pkt.hasValidSync() && !pkt.getTEI()) ||
+            (_scrambling_ctrl == pkt.getScrambling()) ||
+            (_with_pcr && (pkt.hasPCR() || pkt.hasOPCR())) ||
+            (_with_splice && pkt.hasSpliceCountdown()) ||
+            (_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() == _splice) ||
+            (_min_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() >= _min_splice) ||
+            (_max_splice >= -128 && pkt.hasSpliceCountdown() && pkt.getSpliceCountdown() <= _max_splice) ||
+            (_min_payload >= 0 && int(pkt.getPayloadSize()) >= _min_payload) ||
+            (int(pkt.getPayloadSize()) <= _max_payload) ||
+            (_min_af >= 0 && int(pkt.getAFSize()) >= _min_af) ||
+            (int(pkt.getAFSize()) <= _max_af) ||
+            (_every_packets > 0 && (tsp->pluginPackets() - _after_packets) % _every_packets == 0) ||
+            (_with_pes && pkt.startPES());
+
+        // Get ISDB layer if required.
+        if (!ok && !_isdb_layers.empty()) {
+            // Do not check if ISDB is part of the standards, assume it if option --isdb-layer is present.
+            const ISDBTInformation info(duck, pkt_data, false);
+            ok = info.is_valid && _isdb_layers.contains(info.layer_indicator);
+        }
 
-    // Search binary patterns in packets.
-    if (!ok && !_pattern.empty()) {
-        const size_t start = _search_payload ? pkt.getHeaderSize() : 0;
-        if (start + _search_offset + _pattern.size() <= PKT_SIZE) {
-            if (_use_search_offset) {
-                ok = MemEqual(pkt.b + start + _search_offset, _pattern.data(), _pattern.size());
-            }
-            else {
-                ok = LocatePattern(pkt.b + start, PKT_SIZE - start, _pattern.data(), _pattern.size()) != nullptr;
+        // Search binary patterns in packets.
+        if (!ok && !_pattern.empty()) {
+            const size_t start = _search_payload ? pkt.getHeaderSize() : 0;
+            if (start + _search_offset + _pattern.size() <= PKT_SIZE) {
+                if (_use_search_offset) {
+                    ok = MemEqual(pkt.b + start + _search_offset, _pattern.data(), _pattern.size());
+                }
+                else {
+                    ok = LocatePattern(pkt.b + start, PKT_SIZE - start, _pattern.data(), _pattern.size()) != nullptr;
+                }
             }
         }
-    }
 
-    // Search if packet is in one selected range.
-    for (auto it = _ranges.begin(); !ok && it != _ranges.end(); ++it) {
-        ok = packetIndex >= it->first && packetIndex <= it->second;
+        // Search if packet is in one selected range.
+        for (auto it = _ranges.begin(); !ok && it != _ranges.end(); ++it) {
+            ok = packetIndex >= it->first && packetIndex <= it->second;
+        }
     }
 
     // Reverse selection criteria with --negate.
@@ -24,6 +24,9 @@
 #include "tsTDT.h"
 #include "tsEIT.h"
 
+// Size in bytes of the output file stream buffer.
+#define OUTPUT_BUFFER_SIZE 65536
+
 
 //----------------------------------------------------------------------------
 // Plugin definition
@@ -73,6 +76,7 @@ namespace ts {
 
         // Working data
         std::ofstream _outfile {};                // User-specified output file
+        std::vector<char> _outbuf {};             // Large buffer for the output file
         PacketCounter _suspend_after = 0;         // Number of missing packets after which a PID is considered as suspended
         TDT           _last_tdt {};               // Last received TDT
         PacketCounter _last_tdt_pkt = 0;          // Packet# of last TDT
@@ -204,6 +208,10 @@ bool ts::HistoryPlugin::start()
     // Create output file
     if (!_outfile_name.empty()) {
         verbose(u"creating %s", _outfile_name);
+        // Use a large stream buffer: history lines are then flushed to disk in
+        // large chunks and the packet thread never waits on one write per line.
+        _outbuf.resize(OUTPUT_BUFFER_SIZE);
+        _outfile.rdbuf()->pubsetbuf(_outbuf.data(), std::streamsize(_outbuf.size()));
         _outfile.open(_outfile_name, std::ios::out);
         if (!_outfile) {
             error(u"cannot create %s", _outfile_name);
@@ -281,7 +289,8 @@ void ts::HistoryPlugin::report(PacketCounter pkt, const UString& line)
 
     // Then report the message.
     if (_outfile.is_open()) {
-        _outfile << _tag << UString::Format(u"%d: ", pkt) << line << std::endl;
+        // Use '\n' instead of std::endl to avoid flushing the file on each line.
+        _outfile << _tag << UString::Format(u"%d: ", pkt) << line << '\n';
     }
     else {
         info(u"%s%d: %s", _tag, pkt, line);
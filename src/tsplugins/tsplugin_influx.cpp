@@ -54,6 +54,7 @@ namespace ts {
         bool        _pcr_based = false;
         bool        _timestamp_based = false;
         bool        _use_local_time = false;
+        bool        _compress = false;
         int         _max_severity = std::numeric_limits<int>::max();
         Time        _start_time {};
         size_t      _queue_size = DEFAULT_QUEUE_SIZE;
@@ -196,6 +197,11 @@ ts::InfluxPlugin::InfluxPlugin(TSP* tsp_) :
          PIDClassIdentifier().nameList(u", ", u"\"", u"\"") +
          u".");
 
+    option(u"compress", 'z');
+    help(u"compress",
+         u"Compress the metrics data which are sent to the InfluxDB server, using gzip format. "
+         u"This reduces the network usage, especially when several reports are batched in one request.");
+
     // Timing options.
     option<cn::seconds>(u"interval", 'i');
     help(u"interval",
@@ -254,6 +260,7 @@ bool ts::InfluxPlugin::getOptions()
     _pcr_based = present(u"pcr-based");
     _timestamp_based = present(u"timestamp-based");
     _use_local_time = present(u"local-time");
+    _compress = present(u"compress");
     getIntValue(_max_severity, u"max-severity", std::numeric_limits<int>::max());
     getIntValue(_max_metrics, u"max-metrics", std::numeric_limits<size_t>::max());
     getIntValue(_queue_size, u"queue-size", DEFAULT_QUEUE_SIZE);
@@ -592,14 +599,17 @@ void ts::InfluxPlugin::reportMetrics(Time timestamp, cn::milliseconds duration)
     // Debug output of the complete message to InfluxDB.
     debug(u"report at %s, for last %s, data: \"%s\"", timestamp, duration, *data);
 
-    // Send the data to the outgoing thread. Use a zero timeout.
-    // It the thread is so slow that the queue is full, just drop the metrics for this interval.
-    if (_metrics_queue.enqueue(data, cn::milliseconds::zero())) {
-        _sent_metrics++;
-    }
-    else {
-        warning(u"lost metrics, consider increasing --queue-size (current: %d)", _queue_size);
+    // Send the data to the outgoing thread. Use a zero timeout, never wait for the
+    // communication thread. If the queue is full (the InfluxDB server is too slow),
+    // drop the oldest queued metrics to make room: the most recent data are the most
+    // valuable ones for monitoring.
+    while (!_metrics_queue.enqueue(data, cn::milliseconds::zero())) {
+        decltype(_metrics_queue)::MessagePtr dropped;
+        if (_metrics_queue.dequeue(dropped, cn::milliseconds::zero())) {
+            warning(u"lost oldest metrics, consider increasing --queue-size (current: %d)", _queue_size);
+        }
     }
+    _sent_metrics++;
 
     // Reset metrics.
     _ts_packets = 0;
@@ -649,7 +659,8 @@ void ts::InfluxPlugin::main()
 {
     debug(u"metrics output thread started");
 
-    for (;;) {
+    bool terminated = false;
+    while (!terminated) {
         // Wait for one message, stop on null pointer.
         decltype(_metrics_queue)::MessagePtr msg;
         _metrics_queue.dequeue(msg);
@@ -657,8 +668,21 @@ void ts::InfluxPlugin::main()
             break;
         }
 
+        // If more metrics were queued while the server was busy, batch all
+        // immediately available messages in one single request.
+        UString data(*msg);
+        decltype(_metrics_queue)::MessagePtr next;
+        while (_metrics_queue.dequeue(next, cn::milliseconds::zero())) {
+            if (next == nullptr) {
+                terminated = true;
+                break;
+            }
+            data.append(u'\n');
+            data.append(*next);
+        }
+
         // Send the data to the InfluxDB server.
-        _request.write(_influx_args, *msg, u"ms");
+        _request.write(_influx_args, data, u"ms", _compress);
     }
 
     debug(u"metrics output thread terminated");
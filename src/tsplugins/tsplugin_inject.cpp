@@ -68,14 +68,28 @@ namespace ts {
         PacketCounter     _cycle_count = 0;           // Number of insertion cycles
         CyclingPacketizer _pzer {duck, PID_NULL, StuffPolicy::NEVER};
 
+        // Compiled injection image. When the sections are cycled in order, without
+        // section-specific repetition rate, the complete cycle is packetized once at
+        // load time and steady-state injection is a simple indexed copy. The image is
+        // rebuilt and swapped on file reload. The continuity counters are patched at
+        // injection time, so that a reload does not break their sequence.
+        bool              _use_image = false;         // Use the compiled injection image.
+        size_t            _image_next = 0;            // Index of next packet in the image.
+        uint8_t           _image_cc = 0;              // Continuity counter of next injected packet.
+        TSPacketVector    _image {};                  // One complete cycle of packets.
+        std::vector<bool> _image_boundary {};         // Per-packet flag: the packet starts a new section.
+
         // Reload files, reset packetizer. Return true on success, false on error.
         bool reloadFiles();
 
         // Process bitrates and compute inter-packet distance.
         bool processBitRates();
 
-        // Replace current packet with one from the packetizer.
+        // Replace current packet with one from the packetizer or the image.
         void replacePacket(TSPacket& pkt);
+
+        // Check if the next injected packet will start a new section.
+        bool atSectionBoundary() const;
     };
 }
 
@@ -263,6 +277,11 @@ bool ts::InjectPlugin::getOptions()
         error(u"all files must have a repetition rate when none of --replace, --bitrate, --inter-packet is used");
     }
 
+    // The compiled injection image can be used when the sections are cycled in order,
+    // without section-specific repetition rate, and when the cycle is aligned on a
+    // packet boundary (stuffing at end of cycle at least).
+    _use_image = !_specific_rates && _stuffing_policy != StuffPolicy::NEVER;
+
     return true;
 }
 
@@ -288,6 +307,7 @@ bool ts::InjectPlugin::start()
     _pid_packet_count = 0;
     _pid_next_pkt = 0;
     _cycle_count = 0;
+    _image_cc = 0;
     return true;
 }
 
@@ -352,6 +372,24 @@ bool ts::InjectPlugin::reloadFiles()
         _pzer.setBitRate(_pid_bitrate);  // non-zero only if --bitrate is specified
     }
 
+    // Build the compiled injection image: packetize the complete cycle once.
+    // This is called at a section boundary only, swapping the image is safe.
+    if (_use_image) {
+        _image.clear();
+        _image_boundary.clear();
+        _image_next = 0;
+        if (_pzer.storedSectionCount() > 0) {
+            TSPacket pkt;
+            do {
+                _pzer.getNextPacket(pkt);
+                // The packet starts a new section when it has a zero pointer field.
+                _image_boundary.push_back(pkt.getPUSI() && pkt.getPayloadSize() > 0 && *pkt.getPayload() == 0);
+                _image.push_back(pkt);
+            } while (!_pzer.atCycleBoundary());
+            debug(u"compiled injection image: %d packets per cycle", _image.size());
+        }
+    }
+
     return success;
 }
 
@@ -404,9 +442,40 @@ bool ts::InjectPlugin::processBitRates()
 
 void ts::InjectPlugin::replacePacket(TSPacket& pkt)
 {
-    _pzer.getNextPacket(pkt);
-    if (_pzer.atCycleBoundary()) {
-        _cycle_count++;
+    if (_use_image) {
+        // Steady state fast path: copy the next packet image and patch its continuity counter.
+        if (_image.empty()) {
+            pkt = NullPacket;
+            return;
+        }
+        pkt = _image[_image_next];
+        pkt.setCC(_image_cc);
+        _image_cc = (_image_cc + 1) & CC_MASK;
+        if (++_image_next >= _image.size()) {
+            _image_next = 0;
+            _cycle_count++;
+        }
+    }
+    else {
+        _pzer.getNextPacket(pkt);
+        if (_pzer.atCycleBoundary()) {
+            _cycle_count++;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Check if the next injected packet will start a new section.
+//----------------------------------------------------------------------------
+
+bool ts::InjectPlugin::atSectionBoundary() const
+{
+    if (_use_image) {
+        return _image.empty() || _image_boundary[_image_next];
+    }
+    else {
+        return _pzer.atSectionBoundary();
     }
 }
 
@@ -446,7 +515,7 @@ ts::ProcessorPlugin::Status ts::InjectPlugin::processPacket(TSPacket& pkt, TSPac
 
     // Poll files when necessary.
     // Do that only at section boundary in the output PID to avoid truncated sections.
-    if (_poll_files && _pzer.atSectionBoundary() && Time::CurrentUTC() >= _poll_file_next) {
+    if (_poll_files && atSectionBoundary() && Time::CurrentUTC() >= _poll_file_next) {
         if (_infiles.scanFiles(FILE_RETRY, *this) > 0) {
             // Some files have changed. Reset packetizer and reload files.
             reloadFiles();
@@ -42,7 +42,7 @@ namespace ts {
         // Context per PID in the TS.
         class PIDContext;
         using PIDContextPtr = std::shared_ptr<PIDContext>;
-        using PIDContextMap = std::map<PID, PIDContextPtr>;
+        using PIDContextVector = std::vector<PIDContextPtr>;  // Indexed by PID value.
 
         // Plugin fields.
         bool           _useWallClock = false;
@@ -58,7 +58,7 @@ namespace ts {
         PacketCounter  _excessBits = 0;      // Number of bits in excess, in addition to packets.
         PIDSet         _pids1 {};            // PIDs to sacrifice at threshold 1.
         SectionDemux   _demux {duck, this};  // Demux to collect PAT and PMT's.
-        PIDContextMap  _pidContexts {};      // One context per PID in the TS.
+        PIDContextVector _pidContexts {};    // One context per PID in the TS, indexed by PID.
         monotonic_time _clock {};            // Monotonic clock for live streams.
         size_t         _bitsSecond = 0;      // Number of bits in current second.
 
@@ -195,6 +195,7 @@ bool ts::LimitPlugin::start()
     _excessBits = 0;
     _curBitrate = 0;
     _pidContexts.clear();
+    _pidContexts.resize(PID_MAX);
     _demux.reset();
     _demux.setPIDFilter(PID_PAT);
 
@@ -208,15 +209,11 @@ bool ts::LimitPlugin::start()
 
 ts::LimitPlugin::PIDContextPtr ts::LimitPlugin::getContext(PID pid)
 {
-    auto it = _pidContexts.find(pid);
-    if (it != _pidContexts.end()) {
-        return it->second;
-    }
-    else {
-        PIDContextPtr pc(new PIDContext(pid));
-        _pidContexts.insert(std::make_pair(pid, pc));
-        return pc;
+    PIDContextPtr& pc(_pidContexts[pid]);
+    if (pc == nullptr) {
+        pc = std::make_shared<PIDContext>(pid);
     }
+    return pc;
 }
 
 
@@ -300,8 +297,11 @@ ts::ProcessorPlugin::Status ts::LimitPlugin::processPacket(TSPacket& pkt, TSPack
         _clock = monotonic_time::clock::now();
     }
 
-    // Filter sections to process.
-    _demux.feedPacket(pkt);
+    // Filter sections to process. Only feed the demux with the PID's it
+    // monitors (PAT and PMT's), not with every packet of the stream.
+    if (_demux.hasPID(pid)) {
+        _demux.feedPacket(pkt);
+    }
 
     // Get the PID context.
     const PIDContextPtr pc(getContext(pid));
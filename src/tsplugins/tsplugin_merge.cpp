@@ -26,6 +26,7 @@
 
 #define DEFAULT_MAX_QUEUED_PACKETS  1000            // Default size in packet of the inter-thread queue.
 #define SERVER_THREAD_STACK_SIZE    (128 * 1024)    // Size in byte of the thread stack.
+#define PACKET_PREFETCH_COUNT       16              // Number of packets to dequeue from the queue in one batch.
 
 
 //----------------------------------------------------------------------------
@@ -75,6 +76,10 @@ namespace ts {
         PacketCounter _empty_count = 0;    // Number of times we could merge but there was no packet to merge.
         TSForkPipePtr _pipe {};            // Executed command.
         TSPacketQueue _queue {};           // TS packet queue from merge to main.
+        TSPacketVector _prefetch_pkt {};   // Local batch of packets which were dequeued in one operation.
+        TSPacketMetadataVector _prefetch_md {};  // Metadata of the packets in the local batch.
+        size_t        _prefetch_next = 0;  // Index of next packet to use in the local batch.
+        size_t        _prefetch_count = 0; // Number of packets in the local batch.
         PIDSet        _main_pids {};       // Set of detected PID's in main stream.
         PIDSet        _merge_pids {};      // Set of detected PID's in merged stream that we pass in main stream.
         PCRMerger     _pcr_merger {duck};  // Adjust PCR's in merged stream.
@@ -361,8 +366,11 @@ bool ts::MergePlugin::startStopCommand(bool do_close, bool do_restart)
 
 bool ts::MergePlugin::start()
 {
-    // Resize the inter-thread packet queue.
+    // Resize the inter-thread packet queue and the local dequeuing batch.
     _queue.reset(_max_queue);
+    _prefetch_pkt.resize(PACKET_PREFETCH_COUNT);
+    _prefetch_md.resize(PACKET_PREFETCH_COUNT);
+    _prefetch_next = _prefetch_count = 0;
 
     // Configure the PSI merger.
     if (_merge_psi) {
@@ -525,15 +533,26 @@ ts::ProcessorPlugin::Status ts::MergePlugin::processMergePacket(TSPacket& pkt, T
     _insert_control.setMainBitRate(main_bitrate);
 
     // In case of packet insertion smoothing, check if we need to insert packets here.
-    if (_merge_smoothing && !_insert_control.mustInsert(_queue.currentSize())) {
+    // Count the packets which were already dequeued in the local batch as still waiting.
+    if (_merge_smoothing && !_insert_control.mustInsert(_queue.currentSize() + _prefetch_count - _prefetch_next)) {
         // Don't insert now, would burst over target merged bitrate.
         _hold_count++;
         return TSP_NULL;
     }
 
+    // Refill the local batch when empty. Dequeuing the packets by batches
+    // amortizes the cost of the queue mutex over several merged packets.
+    if (_prefetch_next >= _prefetch_count) {
+        _prefetch_next = 0;
+        BitRate merged_bitrate = 0;
+        if (_queue.getPackets(_prefetch_pkt.data(), _prefetch_md.data(), _prefetch_pkt.size(), _prefetch_count, merged_bitrate)) {
+            // Report merged bitrate change.
+            _insert_control.setSubBitRate(merged_bitrate);
+        }
+    }
+
     // Replace current null packet in main stream with next packet from merged stream.
-    BitRate merged_bitrate = 0;
-    if (!_queue.getPacket(pkt, &pkt_data, merged_bitrate)) {
+    if (_prefetch_next >= _prefetch_count) {
         // No packet available, keep original null packet.
         _empty_count++;
         if (!_got_eof && _queue.eof()) {
@@ -551,9 +570,9 @@ ts::ProcessorPlugin::Status ts::MergePlugin::processMergePacket(TSPacket& pkt, T
         }
         return TSP_OK;
     }
-
-    // Report merged bitrate change.
-    _insert_control.setSubBitRate(merged_bitrate);
+    pkt = _prefetch_pkt[_prefetch_next];
+    pkt_data = _prefetch_md[_prefetch_next];
+    _prefetch_next++;
 
     // Declare that one packet was merged. Must be done here, before dropping unused PID's,
     // because it is used in computation involving the bitrate of the complete merged stream.
@@ -54,6 +54,7 @@ namespace ts {
         size_t        _max_udp_size = 0;        // Maximum size of UDP datagrams.
         size_t        _dump_max = 0;            // Max dump size in bytes.
         size_t        _skip_size = 0;           // Initial bytes to skip for --dump and --output-file.
+        size_t        _send_batch = 0;          // Datagrams per sendmmsg() batch, 0 or 1 for none.
         uint32_t      _event_code = 0;          // Event code to signal.
         int           _ttl = 0;                 // Time to live option.
         PIDSet        _pids {};                 // Explicitly specified PID's to extract.
@@ -175,6 +176,18 @@ ts::MPEPlugin::MPEPlugin(TSP* tsp_) :
          u"recommended to use --destination to filter a specific stream. If the "
          u"port is not specified, the original port is used.");
 
+    option(u"send-batch", 0, Args::INTEGER, 0, 1, 1, Args::UNLIMITED_VALUE, true);
+    help(u"send-batch", u"count",
+         u"With --udp-forward and --redirect, send the forwarded UDP datagrams by batches "
+         u"of the specified maximum size, using one single system call per batch, on "
+         u"systems which support it (Linux only). "
+         u"This reduces the transmission overhead at high datagram rates. "
+         u"This option requires a fixed destination: the --redirect address must include "
+         u"an IP address and a port. "
+         u"The default batch size is " + UString::Decimal(UDPSocket::DEFAULT_SEND_BATCH) +
+         u" datagrams when the option is present without value. "
+         u"By default, datagrams are sent one by one.");
+
     option(u"skip", 0, UNSIGNED);
     help(u"skip",
          u"With --output-file, --dump-datagram, --dump-udp or --log-hexa-line, specify the initial "
@@ -270,6 +283,13 @@ bool ts::MPEPlugin::getOptions()
         }
     }
 
+    // Batch transmission works on a fixed destination only.
+    _send_batch = present(u"send-batch") ? intValue<size_t>(u"send-batch", UDPSocket::DEFAULT_SEND_BATCH) : 0;
+    if (_send_batch > 1 && (!_send_udp || !_ip_forward.hasAddress() || !_ip_forward.hasPort())) {
+        error(u"--send-batch requires --udp-forward and a --redirect address with IP address and port");
+        return false;
+    }
+
     // If no PID is specified, extract all.
     _all_mpe_pids = _pids.none();
     return true;
@@ -318,6 +338,13 @@ bool ts::MPEPlugin::start()
         if (_local_address.hasAddress() && !_sock.setOutgoingMulticast(_local_address, *this)) {
             return false;
         }
+        // With batch transmission, all datagrams are sent to the fixed redirected address.
+        if (_send_batch > 1) {
+            _sock.setSendBatchSize(_send_batch);
+            if (!_sock.setDefaultDestination(_ip_forward, *this)) {
+                return false;
+            }
+        }
     }
 
     // Other states.
@@ -339,8 +366,11 @@ bool ts::MPEPlugin::stop()
         _outfile.close();
     }
 
-    // Close the forwarding socket.
+    // Close the forwarding socket, flushing queued datagrams first.
     if (_sock.isOpen()) {
+        if (_send_batch > 1) {
+            _sock.flushSendBatch(*this);
+        }
         _sock.close(*this);
     }
 
@@ -466,17 +496,26 @@ void ts::MPEPlugin::handleMPEPacket(MPEDemux& demux, const MPEPacket& mpe)
         const bool mc = dest.isMulticast();
         const int previous_ttl = mc ? _previous_mc_ttl : _previous_uc_ttl;
         const int mpe_ttl = mpe.datagram()[8]; // in original IP header
-        if (_ttl <= 0 && mpe_ttl != previous_ttl && _sock.setTTL(mpe_ttl, mc, *this)) {
-            if (mc) {
-                _previous_mc_ttl = mpe_ttl;
+        if (_ttl <= 0 && mpe_ttl != previous_ttl) {
+            // The TTL is a socket option: with batch transmission, first flush
+            // the datagrams which were queued with the previous TTL.
+            if (_send_batch > 1 && !_sock.flushSendBatch(*this)) {
+                _abort = true;
             }
-            else {
-                _previous_uc_ttl = mpe_ttl;
+            if (_sock.setTTL(mpe_ttl, mc, *this)) {
+                if (mc) {
+                    _previous_mc_ttl = mpe_ttl;
+                }
+                else {
+                    _previous_uc_ttl = mpe_ttl;
+                }
             }
         }
 
-        // Send the UDP datagram.
-        if (!_sock.send(udp_data, udp_size, dest, *this)) {
+        // Send the UDP datagram. With batch transmission, the destination is
+        // fixed and the datagram is queued for the default destination.
+        const bool sent = _send_batch > 1 ? _sock.send(udp_data, udp_size, *this) : _sock.send(udp_data, udp_size, dest, *this);
+        if (!sent) {
             _abort = true;
         }
     }
@@ -201,6 +201,10 @@ ts::MPEInjectPlugin::ReceiverThread::ReceiverThread(MPEInjectPlugin* plugin, con
     // Set UDP socket options.
     _sock.setParameters(opt);
 
+    // Use batch reception: at high datagram rates, one recvmmsg() system call
+    // returns several datagrams (Linux only, ignored on other systems).
+    _sock.setReceiveBatchSize(UDPSocket::DEFAULT_RECEIVE_BATCH);
+
     // Get optional new source and destination.
     const size_t dst_count = _plugin->count(u"new-destination");
     const size_t src_count = _plugin->count(u"new-source");
@@ -336,6 +340,11 @@ void ts::MPEInjectPlugin::ReceiverThread::main()
     IPSocketAddress destination;
     ByteBlock buffer(MAX_IP_SIZE);
 
+    // The MPE packet is reused for all datagrams. Its internal datagram buffer
+    // is recycled from one datagram to the next, instead of being reallocated.
+    MPEPacket mpe;
+    mpe.setSourcePID(_plugin->_mpe_pid);
+
     // Loop on message reception until a receive error (probably an end of execution).
     while (!_plugin->_terminate && _sock.receive(buffer.data(), buffer.size(), insize, sender, destination, _plugin->tsp, *_plugin)) {
 
@@ -359,9 +368,7 @@ void ts::MPEInjectPlugin::ReceiverThread::main()
             mac.toMulticast(destination);
         }
 
-        // Create an MPE packet containing this datagram.
-        MPEPacket mpe;
-        mpe.setSourcePID(_plugin->_mpe_pid);
+        // Fill the MPE packet with this datagram.
         mpe.setSourceSocket(sender);
         mpe.setDestinationSocket(destination);
         mpe.setDestinationMACAddress(mac);
@@ -72,6 +72,9 @@ namespace ts {
         using PIDContextPtr = std::shared_ptr<PIDContext>;
         using PIDContextMap = std::map<PID, PIDContextPtr>;
 
+        // Number of fractional bits in _ticks_per_packet.
+        static constexpr unsigned int TICKS_SHIFT = 20;
+
         // PCRAdjustPlugin private members
         BitRate       _user_bitrate = 0;          // User-specified bitrate.
         PIDSet        _pids {};                   // User-specified list of PIDs.
@@ -81,6 +84,9 @@ namespace ts {
         uint64_t      _min_pcr_interval = 0;      // Minimum interval between two PCR's. Ignored if zero.
         SectionDemux  _demux {duck, this};        // Section demux to get service descriptions.
         PIDContextMap _pid_contexts {};           // Map of all PID contexts.
+        PIDContextMap _pcr_owners {};             // Subset of _pid_contexts: PID's which carry their own PCR's.
+        BitRate       _cur_bitrate = 0;           // Bitrate for which _ticks_per_packet was computed.
+        uint64_t      _ticks_per_packet = 0;      // PCR ticks per packet, fixed point, TICKS_SHIFT fractional bits.
 
         // TableHandlerInterface implementation.
         virtual void handleTable(SectionDemux&, const BinaryTable&) override;
@@ -88,6 +94,12 @@ namespace ts {
         // Get the context for a PID. Create one when necessary.
         PIDContextPtr getContext(PID pid);
 
+        // Set the reference bitrate and precompute the per-packet PCR increment.
+        void setBitrate(const BitRate& bitrate);
+
+        // Same as ts::NextPCR(), without the division, using the precomputed increment.
+        uint64_t nextPCR(uint64_t last_pcr, PacketCounter distance) const;
+
         // Description of one PID. One structure is created per PID in the TS.
         class PIDContext
         {
@@ -111,10 +123,10 @@ namespace ts {
             uint64_t lastPCR() const;
 
             // Compute the theoretical updated PCR at the given packet index. INVALID_PCR if unknown.
-            uint64_t updatedPCR(PacketCounter packet_index, const BitRate& bitrate) const;
+            uint64_t updatedPCR(PacketCounter packet_index, const PCRAdjustPlugin& plugin) const;
 
             // Compute an updated PTS or DTS at the given packet index. Unchanged if unknown.
-            uint64_t updatedPDTS(PacketCounter packet_index, const BitRate& bitrate, uint64_t original_pdts);
+            uint64_t updatedPDTS(PacketCounter packet_index, const PCRAdjustPlugin& plugin, uint64_t original_pdts);
         };
     };
 }
@@ -190,6 +202,9 @@ bool ts::PCRAdjustPlugin::start()
 {
     // Reset packet processing.
     _pid_contexts.clear();
+    _pcr_owners.clear();
+    _cur_bitrate = 0;
+    _ticks_per_packet = 0;
 
     // Reset demux for service analysis.
     _demux.reset();
@@ -219,19 +234,57 @@ uint64_t ts::PCRAdjustPlugin::PIDContext::lastPCR() const
 }
 
 
+//----------------------------------------------------------------------------
+// Set the reference bitrate and precompute the per-packet PCR increment.
+//----------------------------------------------------------------------------
+
+void ts::PCRAdjustPlugin::setBitrate(const BitRate& bitrate)
+{
+    _cur_bitrate = bitrate;
+    if (bitrate == 0) {
+        _ticks_per_packet = 0;
+    }
+    else {
+        // Number of PCR ticks per packet, in fixed-point notation.
+        _ticks_per_packet = ((BitRate(PKT_SIZE_BITS * SYSTEM_CLOCK_FREQ) * (1 << TICKS_SHIFT)) / bitrate).toInt();
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Same as ts::NextPCR(), without the division, using the precomputed increment.
+//----------------------------------------------------------------------------
+
+uint64_t ts::PCRAdjustPlugin::nextPCR(uint64_t last_pcr, PacketCounter distance) const
+{
+    if (last_pcr == INVALID_PCR || _ticks_per_packet == 0) {
+        return INVALID_PCR;
+    }
+    if (distance > std::numeric_limits<uint64_t>::max() / _ticks_per_packet) {
+        // Huge distance, the fixed-point multiplication would overflow.
+        return NextPCR(last_pcr, distance, _cur_bitrate);
+    }
+    uint64_t next_pcr = last_pcr + ((distance * _ticks_per_packet) >> TICKS_SHIFT);
+    if (next_pcr >= PCR_SCALE) {
+        next_pcr -= PCR_SCALE;
+    }
+    return next_pcr;
+}
+
+
 //----------------------------------------------------------------------------
 // Compute the theoretical updated PCR at the given packet index.
 //----------------------------------------------------------------------------
 
-uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPCR(PacketCounter packet_index, const BitRate& bitrate) const
+uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPCR(PacketCounter packet_index, const PCRAdjustPlugin& plugin) const
 {
     if (last_updated_pcr != INVALID_PCR && (last_created_pcr == INVALID_PCR || last_created_packet < last_pcr_packet)) {
         // The most recent is an original packet with a previous PCR.
-        return NextPCR(last_updated_pcr, packet_index - last_pcr_packet, bitrate);
+        return plugin.nextPCR(last_updated_pcr, packet_index - last_pcr_packet);
     }
     else if (last_created_pcr != INVALID_PCR && (last_updated_pcr == INVALID_PCR || last_pcr_packet < last_created_packet)) {
         // The most recent is a PCR we created in a null packet.
-        return NextPCR(last_created_pcr, packet_index - last_created_packet, bitrate);
+        return plugin.nextPCR(last_created_pcr, packet_index - last_created_packet);
     }
     else {
         // No previous PCR was found, no reference.
@@ -244,7 +297,7 @@ uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPCR(PacketCounter packet_index,
 // Compute an updated PTS or DTS at the given packet index.
 //----------------------------------------------------------------------------
 
-uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPDTS(PacketCounter packet_index, const BitRate& bitrate, uint64_t original_pdts)
+uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPDTS(PacketCounter packet_index, const PCRAdjustPlugin& plugin, uint64_t original_pdts)
 {
     // If the PCR PID is unknown, we cannot compute anything and keep the original PTS/DTS.
     if (pcr_ctx == nullptr) {
@@ -252,7 +305,7 @@ uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPDTS(PacketCounter packet_index
     }
 
     // Estimated updated PCR for the current packet:
-    const uint64_t updated_pcr = pcr_ctx->updatedPCR(packet_index, bitrate);
+    const uint64_t updated_pcr = pcr_ctx->updatedPCR(packet_index, plugin);
     if (updated_pcr == INVALID_PCR) {
         // There is no PCR found yet in the PCR PID, cannot compute a new PTS/DTS.
         return original_pdts;
@@ -275,7 +328,7 @@ uint64_t ts::PCRAdjustPlugin::PIDContext::updatedPDTS(PacketCounter packet_index
     else {
         // The difference between the PTS/DTS and the PCR is too high, update the PTS/DTS.
         // First, compute the original PCR for this packet:
-        const uint64_t original_pcr = NextPCR(pcr_ctx->last_original_pcr, packet_index - pcr_ctx->last_pcr_packet, bitrate);
+        const uint64_t original_pcr = plugin.nextPCR(pcr_ctx->last_original_pcr, packet_index - pcr_ctx->last_pcr_packet);
 
         // Compute the difference between the original PTS and the original PCR.
         const int64_t diff = int64_t(original_pdts) - int64_t(original_pcr / SYSTEM_CLOCK_SUBFACTOR);
@@ -357,7 +410,11 @@ ts::ProcessorPlugin::Status ts::PCRAdjustPlugin::processPacket(TSPacket& pkt, TS
     ctx->last_cc = pkt.getCC();
 
     // Get reference bitrate value (cannot do anything if zero).
+    // The per-packet PCR increment is recomputed only when the bitrate changes.
     const BitRate bitrate = _user_bitrate != 0 ? _user_bitrate : tsp->bitrate();
+    if (bitrate != _cur_bitrate) {
+        setBitrate(bitrate);
+    }
 
     // Only process packets from selected PID's (all by default).
     if (bitrate != 0 && _pids.test(pid) && (!ctx->scrambled || !_ignore_scrambled)) {
@@ -367,6 +424,7 @@ ts::ProcessorPlugin::Status ts::PCRAdjustPlugin::processPacket(TSPacket& pkt, TS
             // The PID is its own PCR reference.
             ctx->pcr_ctx = ctx;
             ctx->last_original_pcr = pkt.getPCR();
+            _pcr_owners[pid] = ctx;
 
             if (ctx->last_updated_pcr == INVALID_PCR) {
                 // First packet in this PID with a PCR, use it as base.
@@ -375,7 +433,7 @@ ts::ProcessorPlugin::Status ts::PCRAdjustPlugin::processPacket(TSPacket& pkt, TS
             }
             else {
                 // A previous PCR value was known in the PID. Compute the new PCR from the previous one.
-                const uint64_t pcr = ctx->updatedPCR(current_packet, bitrate);
+                const uint64_t pcr = ctx->updatedPCR(current_packet, *this);
                 pkt.setPCR(pcr);
                 ctx->last_updated_pcr = pcr;
             }
@@ -384,12 +442,12 @@ ts::ProcessorPlugin::Status ts::PCRAdjustPlugin::processPacket(TSPacket& pkt, TS
 
         // Process PTS.
         if (!_ignore_pts && pkt.hasPTS()) {
-            pkt.setPTS(ctx->updatedPDTS(current_packet, bitrate, pkt.getPTS()));
+            pkt.setPTS(ctx->updatedPDTS(current_packet, *this, pkt.getPTS()));
         }
 
         // Process DTS.
         if (!_ignore_dts && pkt.hasDTS()) {
-            pkt.setDTS(ctx->updatedPDTS(current_packet, bitrate, pkt.getDTS()));
+            pkt.setDTS(ctx->updatedPDTS(current_packet, *this, pkt.getDTS()));
         }
     }
 
@@ -398,23 +456,21 @@ ts::ProcessorPlugin::Status ts::PCRAdjustPlugin::processPacket(TSPacket& pkt, TS
 
         // Look for PID's with PCR for which the PCR are outdated.
         // Keep the "most urgent" PID, ie. the one which is the most late.
+        // Only the PID's which carry their own PCR's need to be checked.
         PIDContextPtr pcr_ctx;
         uint64_t pcr_delay = 0;
         uint64_t pcr_value = INVALID_PCR;
-        for (const auto& it : _pid_contexts) {
+        for (const auto& it : _pcr_owners) {
             const PIDContextPtr& cur_ctx(it.second);
-            // Consider only PID's which contain PCR, ie. which are their own PCR reference.
-            if (cur_ctx != nullptr && cur_ctx->pcr_ctx != nullptr && cur_ctx->pid == cur_ctx->pcr_ctx->pid) {
-                const uint64_t last_pcr = cur_ctx->lastPCR();
-                const uint64_t updated_pcr = cur_ctx->updatedPCR(current_packet, bitrate);
-                if (last_pcr != INVALID_PCR && updated_pcr != INVALID_PCR && updated_pcr > last_pcr) {
-                    const uint64_t delay = updated_pcr - last_pcr;
-                    if (delay > _min_pcr_interval && delay > pcr_delay) {
-                        // This is the "most late" PID so far.
-                        pcr_ctx = cur_ctx;
-                        pcr_delay = delay;
-                        pcr_value = updated_pcr;
-                    }
+            const uint64_t last_pcr = cur_ctx->lastPCR();
+            const uint64_t updated_pcr = cur_ctx->updatedPCR(current_packet, *this);
+            if (last_pcr != INVALID_PCR && updated_pcr != INVALID_PCR && updated_pcr > last_pcr) {
+                const uint64_t delay = updated_pcr - last_pcr;
+                if (delay > _min_pcr_interval && delay > pcr_delay) {
+                    // This is the "most late" PID so far.
+                    pcr_ctx = cur_ctx;
+                    pcr_delay = delay;
+                    pcr_value = updated_pcr;
                 }
             }
         }
@@ -20,6 +20,13 @@
 #include "tsRegistrationDescriptor.h"
 #include "tsSCTE35.h"
 #include "tsFileUtils.h"
+#include "tsMemory.h"
+
+// Size in bytes of a binary record with --binary.
+#define BINARY_RECORD_SIZE 60
+
+// Size in bytes of the output stream buffer.
+#define OUTPUT_BUFFER_SIZE 65536
 
 
 //----------------------------------------------------------------------------
@@ -61,6 +68,7 @@ namespace ts {
         bool             _get_dts = false;        // Get DTS
         bool             _csv_format = false;     // Output in CSV format
         bool             _log_format = false;     // Output in log format
+        bool             _binary_format = false;  // Output in binary format (fixed-size records)
         bool             _evaluate_pcr = false;   // Evaluate PCR offset for packets with PTS/DTS without PCR
         bool             _scte35 = false;         // Detect SCTE 35 PTS values
         bool             _input_time = false;     // Add an input timestamp of the TS packet
@@ -68,6 +76,7 @@ namespace ts {
         // Working data:
         std::ofstream    _output_stream {};       // Output stream file
         std::ostream*    _output = nullptr;       // Reference to actual output stream file
+        std::vector<char> _output_buffer {};      // Large buffer for the output stream file
         PIDContextMap    _stats {};               // Per-PID statistics
         SpliceContextMap _splices {};             // Per-PID splice information
         SectionDemux     _demux {duck, this};     // Section demux for service and SCTE 35 analysis
@@ -163,6 +172,14 @@ TS_REGISTER_PROCESSOR_PLUGIN(u"pcrextract", ts::PCRExtractPlugin);
 ts::PCRExtractPlugin::PCRExtractPlugin(TSP* tsp_) :
     ProcessorPlugin(tsp_, u"Extracts PCR, OPCR, PTS, DTS from TS packet for analysis", u"[options]")
 {
+    option(u"binary", 'b');
+    help(u"binary",
+         u"Report data in binary format. Each value is written as a fixed-size "
+         u"record of " TS_STRINGIFY(BINARY_RECORD_SIZE) u" bytes, in big-endian order, "
+         u"without any formatting cost. This is the fastest output mode, suitable "
+         u"for full-rate extraction on large streams. The option --output-file is "
+         u"required with --binary.");
+
     option(u"csv", 'c');
     help(u"csv",
          u"Report data in CSV (comma-separated values) format. All values are reported "
@@ -267,16 +284,26 @@ bool ts::PCRExtractPlugin::getOptions()
     _get_pcr = present(u"pcr");
     _get_opcr = present(u"opcr");
     _evaluate_pcr = present(u"evaluate-pcr-offset");
-    _csv_format = present(u"csv") || !_output_name.empty();
+    _binary_format = present(u"binary");
+    _csv_format = present(u"csv") || (!_binary_format && !_output_name.empty());
     _log_format = present(u"log") || _scte35;
     _input_time = present(u"input-timestamp");
 
+    if (_binary_format && _csv_format) {
+        error(u"--binary and --csv are mutually exclusive");
+        return false;
+    }
+    if (_binary_format && _output_name.empty()) {
+        error(u"--output-file is required with --binary");
+        return false;
+    }
+
     if (!_get_pts && !_get_dts && !_get_pcr && !_get_opcr) {
         // Report them all by default
         _get_pts = _get_dts = _get_pcr = _get_opcr = true;
     }
 
-    if (!_csv_format && !_log_format) {
+    if (!_csv_format && !_log_format && !_binary_format) {
         // Use CSV format by default.
         _csv_format = true;
     }
@@ -303,7 +330,11 @@ bool ts::PCRExtractPlugin::start()
     }
     else {
         _output = &_output_stream;
-        _output_stream.open(_output_name);
+        // Use a large stream buffer so that formatted lines or records are
+        // flushed to disk in large chunks, not line by line.
+        _output_buffer.resize(OUTPUT_BUFFER_SIZE);
+        _output_stream.rdbuf()->pubsetbuf(_output_buffer.data(), std::streamsize(_output_buffer.size()));
+        _output_stream.open(_output_name, _binary_format ? (std::ios::out | std::ios::binary) : std::ios::out);
         if (!_output_stream) {
             error(u"cannot create file %s", _output_name);
             return false;
@@ -322,6 +353,9 @@ bool ts::PCRExtractPlugin::start()
 
 bool ts::PCRExtractPlugin::stop()
 {
+    if (_output != nullptr) {
+        _output->flush();
+    }
     if (!_output_name.empty()) {
         _output_stream.close();
     }
@@ -377,12 +411,16 @@ ts::ProcessorPlugin::Status ts::PCRExtractPlugin::processPacket(TSPacket& pkt, T
             processValue(pc, &PIDContext::pcr, pcr, INVALID_PCR, _get_pcr, pkt_data);
         }
 
-        if (pkt.hasOPCR()) {
-            processValue(pc, &PIDContext::opcr, pkt.getOPCR(), pcr, _get_opcr, pkt_data);
+        // Get each value once: the accessors return an invalid value marker
+        // when the field is absent, re-checking with has*() would parse the
+        // packet headers a second time.
+        const uint64_t opcr = pkt.getOPCR();
+        if (opcr != INVALID_PCR) {
+            processValue(pc, &PIDContext::opcr, opcr, pcr, _get_opcr, pkt_data);
         }
 
-        if (pkt.hasPTS()) {
-            const uint64_t pts = pkt.getPTS();
+        const uint64_t pts = pkt.getPTS();
+        if (pts != INVALID_PTS) {
             // Check if this is a "good" PTS, ie. greater than the last good PTS
             // (or wrapping around the max PTS value 2**33)
             const bool good_pts = pc.pts.count == 0 || SequencedPTS(pc.last_good_pts, pts);
@@ -392,8 +430,9 @@ ts::ProcessorPlugin::Status ts::PCRExtractPlugin::processPacket(TSPacket& pkt, T
             processValue(pc, &PIDContext::pts, pts, pcr, _get_pts && (good_pts || !_good_pts_only), pkt_data);
         }
 
-        if (pkt.hasDTS()) {
-            processValue(pc, &PIDContext::dts, pkt.getDTS(), pcr, _get_dts, pkt_data);
+        const uint64_t dts = pkt.getDTS();
+        if (dts != INVALID_DTS) {
+            processValue(pc, &PIDContext::dts, dts, pcr, _get_dts, pkt_data);
         }
 
         pc.packet_count++;
@@ -436,7 +475,6 @@ void ts::PCRExtractPlugin::csvHeader()
 void ts::PCRExtractPlugin::processValue(PIDContext& ctx, PIDData PIDContext::* pdata, uint64_t value, uint64_t pcr, bool report_it, const TSPacketMetadata& mdata)
 {
     PIDData& data(ctx.*pdata);
-    const UString name(_type_names.name(data.type));
     const uint32_t pcr_subfactor = pcrSubfactor(data.type);
     const std::intmax_t ticks = ticksPerMS(data.type);
 
@@ -449,12 +487,35 @@ void ts::PCRExtractPlugin::processValue(PIDContext& ctx, PIDData PIDContext::* p
     const uint64_t since_start = value - data.first_value;
     const int64_t since_previous = data.last_value == INVALID_PCR ? 0 : int64_t(value) - int64_t(data.last_value);
 
+    // Report in binary format: one fixed-size record in big-endian order.
+    if (_binary_format && report_it) {
+        uint8_t rec[BINARY_RECORD_SIZE];
+        uint8_t flags = 0;
+        if (pcr != INVALID_PCR) {
+            flags |= 0x01;
+        }
+        if (_input_time && mdata.hasInputTimeStamp()) {
+            flags |= 0x02;
+        }
+        PutUInt16(rec, ctx.pid);
+        PutUInt8(rec + 2, uint8_t(data.type));
+        PutUInt8(rec + 3, flags);
+        PutUInt64(rec + 4, tsp->pluginPackets());
+        PutUInt64(rec + 12, ctx.packet_count);
+        PutUInt64(rec + 20, data.count);
+        PutUInt64(rec + 28, value);
+        PutUInt64(rec + 36, since_start);
+        PutInt64(rec + 44, pcr != INVALID_PCR ? int64_t(value) - int64_t(pcr / pcr_subfactor) : 0);
+        PutUInt64(rec + 52, (_input_time && mdata.hasInputTimeStamp()) ? uint64_t(mdata.getInputTimeStamp().count()) : 0);
+        _output->write(reinterpret_cast<const char*>(rec), sizeof(rec));
+    }
+
     // Report in CSV format.
     if (_csv_format && report_it) {
         *_output << ctx.pid << _separator
                  << tsp->pluginPackets() << _separator
                  << ctx.packet_count << _separator
-                 << name << _separator
+                 << _type_names.name(data.type) << _separator
                  << data.count << _separator
                  << value << _separator
                  << since_start << _separator;
@@ -475,7 +536,8 @@ void ts::PCRExtractPlugin::processValue(PIDContext& ctx, PIDData PIDContext::* p
                 *_output << (int64_t(value) - int64_t(mdata.getInputTimeStamp().count() / pcr_subfactor));
             }
         }
-        *_output << std::endl;
+        // Use '\n' instead of std::endl to avoid flushing the stream on each line.
+        *_output << '\n';
     }
 
     // Report in log format.
@@ -487,7 +549,7 @@ void ts::PCRExtractPlugin::processValue(PIDContext& ctx, PIDData PIDContext::* p
         // Number of hexa digits: 11 for PCR (42 bits) and 9 for PTS/DTS (33 bits).
         const size_t width = pcr_subfactor == 1 ? 11 : 9;
         info(u"PID: %n, %s: 0x%0*X, (0x%0*X, %'d ms from start of PID, %'d ms from previous)%s",
-                  ctx.pid, name, width, value, width, since_start, since_start / ticks, since_previous / ticks, trailer);
+                  ctx.pid, _type_names.name(data.type), width, value, width, since_start, since_start / ticks, since_previous / ticks, trailer);
     }
 
     // Remember last value.
@@ -183,15 +183,17 @@ ts::ProcessorPlugin::Status ts::PCRVerifyPlugin::processPacket(TSPacket& pkt, TS
 {
     const PID pid = pkt.getPID();
 
-    // Check if this PID shall be filtered and packet has a PCR
-    if (_pid_list[pid] && pkt.hasPCR()) {
+    // Check if this PID shall be filtered and packet has a PCR.
+    // The PCR is read once, INVALID_PCR means none.
+    const uint64_t pcr_value = _pid_list[pid] ? pkt.getPCR() : INVALID_PCR;
+    if (pcr_value != INVALID_PCR) {
 
         // PID context at previous PCR packet.
         PIDContext& pc(_stats[pid]);
 
         // PID context at current packet.
         PIDContext next_pc;
-        next_pc.pcr_value = pkt.getPCR();
+        next_pc.pcr_value = pcr_value;
         next_pc.pcr_packet = tsp->pluginPackets();
         const PCR pkt_timestamp = pkt_data.getInputTimeStamp();
         next_pc.pcr_timestamp = pkt_timestamp < PCR::zero() ? INVALID_PCR : pkt_data.getInputTimeStamp().count();
@@ -28,7 +28,8 @@ namespace ts {
         virtual bool getOptions() override;
         virtual bool start() override;
         virtual bool stop() override;
-        virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
+        virtual size_t getPacketWindowSize() override;
+        virtual size_t processPacketWindow(TSPacketWindow& win) override;
 
     private:
         // Command line options:
@@ -45,6 +46,7 @@ namespace ts {
 
         static constexpr cn::milliseconds DEF_EVAL_MS = cn::milliseconds(1000);  // Default initial evaluation duration in milliseconds.
         static constexpr PacketCounter MAX_EVAL_PACKETS = 30000;                 // Max number of packets after which the bitrate must be known.
+        static constexpr size_t WINDOW_PACKETS = 512;                            // Number of packets to process at once.
     };
 }
 
@@ -171,29 +173,45 @@ bool ts::PIDShiftPlugin::stop()
 
 
 //----------------------------------------------------------------------------
-// Packet processing method
+// Get requested window size, called between start() and first packet.
 //----------------------------------------------------------------------------
 
-ts::ProcessorPlugin::Status ts::PIDShiftPlugin::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
+size_t ts::PIDShiftPlugin::getPacketWindowSize()
 {
-    const PID pid = pkt.getPID();
+    return WINDOW_PACKETS;
+}
+
+
+//----------------------------------------------------------------------------
+// Packet window processing method
+//----------------------------------------------------------------------------
 
+size_t ts::PIDShiftPlugin::processPacketWindow(TSPacketWindow& win)
+{
     // After an ignored error, let all packets pass, don't shift.
     if (_pass_all) {
-        return TSP_OK;
+        return win.size();
     }
 
+    // The per-window header statistics are computed in one sweep over the packet
+    // headers and shared with the other plugins in the chain. They replace the
+    // per-packet PID lookups of this plugin.
+    const TSPacketWindow::HeaderStats& stats(win.headerStats());
+
     // If the buffer is not yet open, we are in the initial evaluation phase.
     if (!_buffer.isOpen()) {
 
-        // Count packets in the PID's to shift.
-        if (_pids.test(pid)) {
-            _init_packets++;
+        // Count packets in the PID's to shift, using the per-PID packet counts
+        // of the window instead of testing each packet.
+        for (const PID pid : stats.pids) {
+            if (_pids.test(pid)) {
+                _init_packets += stats.pid_packets[pid];
+            }
         }
 
         // Evaluate the duration from the beginning of the TS (zero if bitrate is unknown).
         const BitRate ts_bitrate = tsp->bitrate();
-        const PacketCounter ts_packets = tsp->pluginPackets() + 1;
+        const PacketCounter ts_packets = tsp->pluginPackets() + win.size();
         const cn::milliseconds ms = PacketInterval(ts_bitrate, ts_packets);
 
         if (ms >= _eval_ms) {
@@ -208,7 +226,7 @@ ts::ProcessorPlugin::Status ts::PIDShiftPlugin::processPacket(TSPacket& pkt, TSP
             if (count < TimeShiftBuffer::MIN_TOTAL_PACKETS) {
                 error(u"not enough packets from selected PID's during evaluation phase, cannot compute the shift buffer size");
                 _pass_all = true;
-                return _ignore_errors ? TSP_OK : TSP_END;
+                return _ignore_errors ? win.size() : 0;
             }
 
             verbose(u"setting shift buffer size to %'d packets", count);
@@ -217,24 +235,40 @@ ts::ProcessorPlugin::Status ts::PIDShiftPlugin::processPacket(TSPacket& pkt, TSP
             // Open the shift buffer.
             if (!_buffer.open(*this)) {
                 _pass_all = true;
-                return _ignore_errors ? TSP_OK : TSP_END;
+                return _ignore_errors ? win.size() : 0;
             }
         }
         else if (ts_packets > MAX_EVAL_PACKETS && ts_bitrate == 0) {
             error(u"bitrate still unknown after %'d packets, cannot compute the shift buffer size", ts_packets);
             _pass_all = true;
-            return _ignore_errors ? TSP_OK : TSP_END;
+            return _ignore_errors ? win.size() : 0;
         }
         else {
             // Still in evaluation phase, pass all packets.
-            return TSP_OK;
+            return win.size();
         }
     }
 
     // No longer in evaluation phase, shift packets.
-    if (_pids.test(pid) && !_buffer.shift(pkt, pkt_data, *this)) {
-        _pass_all = true;
-        return _ignore_errors ? TSP_OK : TSP_END;
+    // Skip the whole window when it contains no packet from the selected PID's.
+    bool shift_some = false;
+    for (const PID pid : stats.pids) {
+        if (_pids.test(pid)) {
+            shift_some = true;
+            break;
+        }
+    }
+    if (!shift_some) {
+        return win.size();
+    }
+
+    for (size_t i = 0; i < win.size(); ++i) {
+        TSPacket* pkt = nullptr;
+        TSPacketMetadata* mdata = nullptr;
+        if (win.get(i, pkt, mdata) && _pids.test(pkt->getPID()) && !_buffer.shift(*pkt, *mdata, *this)) {
+            _pass_all = true;
+            return _ignore_errors ? win.size() : i;
+        }
     }
-    return TSP_OK;
+    return win.size();
 }
@@ -312,8 +312,25 @@ size_t ts::ReducePlugin::processPacketWindow(TSPacketWindow& win)
         }
     }
 
+    // Collect the window indexes of all null packets from the shared null-run
+    // index of the window (one single scan, shared with the other plugins in
+    // the chain). A flat copy is required because drop() invalidates the index.
+    std::vector<size_t> null_indexes;
+    const auto& runs = win.nullPacketRuns();
+    size_t total_nulls = 0;
+    for (const auto& run : runs) {
+        total_nulls += run.count;
+    }
+    null_indexes.reserve(total_nulls);
+    for (const auto& run : runs) {
+        for (size_t i = 0; i < run.count; ++i) {
+            null_indexes.push_back(run.first + i);
+        }
+    }
+
     // Loop on each sub-window inside the window.
     size_t subwin_start = 0;
+    size_t null_lo = 0;  // First entry of null_indexes in the current sub-window.
     while (subwin_start < win.size()) {
 
         // Reduce size of last sub-window.
@@ -322,54 +339,58 @@ size_t ts::ReducePlugin::processPacketWindow(TSPacketWindow& win)
         // Compute how many bits should be removed from this sub-window and add them to remaining late bits.
         _bits_to_remove += (((subwin_size * PKT_SIZE_BITS) * removed_bitrate) / bitrate).toInt();
 
+        // Null packets of this sub-window: the slice [null_lo..null_hi) of null_indexes.
+        size_t null_hi = null_lo;
+        while (null_hi < null_indexes.size() && null_indexes[null_hi] < subwin_start + subwin_size) {
+            null_hi++;
+        }
+        const size_t next_null_lo = null_hi;
+
         // Remove as many packets as possible, regularly spaced over the packet sub-window.
-        // We proceed in several passes. In each pass, we process equally-sized slices of the buffer.
-        // In each slice, we remove at most one null packet. If there is at least one null packet per
-        // slice, one pass is enough. Otherwise, re-iterate with larger slices for remaining packets
-        // to remove. Stop when all required packets are removed or there is no more null packet in
-        // the packet window.
+        // We proceed in several passes. In each pass, the sub-window is divided in
+        // equally-sized slices and at most one null packet is removed per slice (the
+        // first one). If there is at least one null packet per slice, one pass is
+        // enough. Otherwise, re-iterate with larger slices over the remaining null
+        // packets. Stop when all required packets are removed or there is no more
+        // null packet in the sub-window. Each pass only walks the null packets, not
+        // the whole sub-window; the surviving ones are compacted for the next pass.
         // To be improved: For drastic reduction, there are so many packets to remove than the slice
         // size is just one packet. Then, in each window, all removed null packets are at the beginning
         // of the window and the remaining null packets are at the end of the window. Is this a problem?
-        size_t null_count = 1; // dummy non-null initial value
         size_t pass_count = 0;
-        while (_bits_to_remove >= PKT_SIZE_BITS && null_count > 0) {
+        while (_bits_to_remove >= PKT_SIZE_BITS && null_hi > null_lo) {
             // Number of null packets we would like to remove in this pass.
             size_t pkt_count = std::min(subwin_size, size_t(_bits_to_remove / PKT_SIZE_BITS));
             // Size of a slice, where one packet should be removed.
             const size_t slice_size = subwin_size / pkt_count;
-            // Number of remaining null packets after this pass.
-            null_count = 0;
-            // In each slice, check if a packet was already dropped.
-            bool slice_done = false;
             // Count passes.
             pass_count++;
             log(3, u"pass #%d, packets to remove: %'d, slice size: %'d packets", pass_count, pkt_count, slice_size);
-            // Perform the pass over the packet window.
-            for (size_t i = 0; i < subwin_size && pkt_count > 0; ++i) {
-                // Reset at start of slice.
-                if (i % slice_size == 0) {
-                    slice_done = false;
+            // Perform the pass over the null packets of the sub-window.
+            size_t out = null_lo;
+            size_t last_slice = NPOS;
+            for (size_t n = null_lo; n < null_hi; ++n) {
+                const size_t slice = (null_indexes[n] - subwin_start) / slice_size;
+                if (pkt_count > 0 && slice != last_slice) {
+                    // First null packet in this slice, drop it.
+                    last_slice = slice;
+                    win.drop(null_indexes[n]);
+                    pkt_count--;
+                    assert(_bits_to_remove >= PKT_SIZE_BITS);
+                    _bits_to_remove -= PKT_SIZE_BITS;
                 }
-                // Null packets are either dropped (first one in slice) or counted.
-                if (win.isNullPacket(subwin_start + i)) {
-                    if (slice_done) {
-                        null_count++;
-                    }
-                    else {
-                        slice_done = true;
-                        win.drop(subwin_start + i);
-                        pkt_count--;
-                        assert(_bits_to_remove >= PKT_SIZE_BITS);
-                        _bits_to_remove -= PKT_SIZE_BITS;
-                    }
+                else {
+                    // Keep this null packet for the next pass.
+                    null_indexes[out++] = null_indexes[n];
                 }
             }
+            null_hi = out;
         }
-        log(2, u"subwindow size: %'d packets, number of passes: %d, remaining null: %'d, remaining bits: %'d", subwin_size, pass_count, null_count, _bits_to_remove);
+        log(2, u"subwindow size: %'d packets, number of passes: %d, remaining null: %'d, remaining bits: %'d", subwin_size, pass_count, null_hi - null_lo, _bits_to_remove);
 
         // Iterate to next sub-window.
         subwin_start += subwin_size;
+        null_lo = next_null_lo;
     }
 
     // Report overflow if not enough null packets were found in the window.
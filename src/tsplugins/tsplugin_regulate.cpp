@@ -36,6 +36,7 @@ namespace ts {
     private:
         // Command line options:
         bool             _pcr_synchronous = false;
+        bool             _precise = false;
         BitRate          _bitrate = 0;
         PacketCounter    _burst = 0;
         cn::milliseconds _wait_min {};
@@ -44,6 +45,8 @@ namespace ts {
         // Working data:
         BitRateRegulator _bitrate_regulator {this, Severity::Verbose};
         PCRRegulator     _pcr_regulator {this, Severity::Verbose};
+        BitRate          _input_bitrate = 0;      // Cached tsp input bitrate.
+        size_t           _bitrate_generation = 0; // Generation of the cached bitrate.
     };
 }
 
@@ -79,6 +82,14 @@ ts::RegulatePlugin::RegulatePlugin(TSP* tsp_) :
          u"With --pcr-synchronous, specify the reference PID for PCR's. By default, "
          u"use the first PID containing PCR's.");
 
+    option(u"precise");
+    help(u"precise",
+         u"Use a high-precision pacing mode: the wait between two packet bursts "
+         u"combines a coarse system sleep and a short busy-wait tail. This reduces "
+         u"the burst jitter from the system timer precision (typically a few "
+         u"milliseconds) down to a few microseconds, at the expense of a slightly "
+         u"higher CPU usage. This option is not used with --pcr-synchronous.");
+
     option<cn::milliseconds>(u"wait-min", 'w');
     help(u"wait-min",
          u"With --pcr-synchronous, specify the minimum wait time in milli-seconds. "
@@ -97,11 +108,16 @@ bool ts::RegulatePlugin::getOptions()
     getChronoValue(_wait_min, u"wait-min", PCRRegulator::DEFAULT_MIN_WAIT);
     getIntValue(_pid_pcr, u"pid-pcr", PID_NULL);
     _pcr_synchronous = present(u"pcr-synchronous");
+    _precise = present(u"precise");
 
     if (present(u"bitrate") && _pcr_synchronous) {
         error(u"--bitrate cannot be used with --pcr-synchronous");
         return false;
     }
+    if (_precise && _pcr_synchronous) {
+        error(u"--precise cannot be used with --pcr-synchronous");
+        return false;
+    }
     if (present(u"pid-pcr") && !_pcr_synchronous) {
         error(u"--pid-pcr cannot be used without --pcr-synchronous");
         return false;
@@ -128,8 +144,14 @@ bool ts::RegulatePlugin::start()
         debug(u"starting bitrate-based regulation");
         _bitrate_regulator.setBurstPacketCount(_burst);
         _bitrate_regulator.setFixedBitRate(_bitrate);
+        _bitrate_regulator.setPrecise(_precise);
         _bitrate_regulator.start();
     }
+
+    // Cache the initial input bitrate.
+    _input_bitrate = tsp->bitrate();
+    _bitrate_generation = tsp->bitrateGeneration();
+
     return true;
 }
 
@@ -147,7 +169,12 @@ ts::ProcessorPlugin::Status ts::RegulatePlugin::processPacket(TSPacket& pkt, TSP
         flush = _pcr_regulator.regulate(pkt);
     }
     else {
-        _bitrate_regulator.regulate(tsp->bitrate(), flush, bitrate_changed);
+        // Re-read the input bitrate only when its generation moves.
+        if (tsp->bitrateGeneration() != _bitrate_generation) {
+            _bitrate_generation = tsp->bitrateGeneration();
+            _input_bitrate = tsp->bitrate();
+        }
+        _bitrate_regulator.regulate(_input_bitrate, flush, bitrate_changed);
     }
 
     pkt_data.setFlush(flush);
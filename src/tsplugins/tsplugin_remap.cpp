@@ -122,8 +122,7 @@ bool ts::RemapPlugin::start()
 
 ts::PID ts::RemapPlugin::remap(PID pid)
 {
-    const auto it = _pidMap.find(pid);
-    return it == _pidMap.end() ? pid : it->second;
+    return outputPID(pid);
 }
 
 
@@ -70,6 +70,7 @@ namespace ts {
             uint64_t   outStart = INVALID_PTS;             // When spliced out, PTS value at the time of splicing out.
             uint64_t   totalAdjust = 0;                    // Total removed time in PTS units.
             uint64_t   lastPTS = INVALID_PTS;              // Last PTS value in this PID.
+            uint64_t   nextEventPTS = INVALID_PTS;         // PTS of earliest scheduled event, cached from events, INVALID_PTS if none.
             EventByPTS events {};                          // Ordered map of upcoming slice events.
             bool       immediateOut = false;               // Currently splicing out for an immediate event
             uint32_t   immediateEventId = 0;               // Event ID associated with immediate splice out event
@@ -108,6 +109,7 @@ namespace ts {
         SectionDemux       _demux {duck, nullptr, this}; // Section filter for splice information.
         TagByPID           _tagsByPID {};                // Mapping between PID's and component tags in the service.
         StateByPID         _states {};                   // Map of current state by PID in the service.
+        PIDSet             _splicedPIDs {};              // Fast check of PID's which are subject to splicing (keys of _states).
         std::set<uint32_t> _eventIDs {};                 // Set of event IDs of interest
         bool               _dryRun = false;              // Just report what it would do
         PID                _videoPID = PID_NULL;         // First video PID, if there is one
@@ -198,6 +200,7 @@ bool ts::RMSplicePlugin::start()
 {
     _tagsByPID.clear();
     _states.clear();
+    _splicedPIDs.reset();
     _demux.reset();
     _videoPID = PID_NULL;
     _abort = false;
@@ -232,6 +235,7 @@ void ts::RMSplicePlugin::handlePMT(const PMT& pmt, PID)
         }
         else {
             // Other component, possibly a PID to splice.
+            _splicedPIDs.set(pid);
             if (!_states.contains(pid)) {
                 // Enforce the creation of the state for this PID if non-existent.
                 PIDState& pidState(_states[pid]);
@@ -339,6 +343,7 @@ void ts::RMSplicePlugin::PIDState::addEvent(uint64_t pts, bool spliceOut, uint32
         if (pts <= PTS_DTS_MASK && (lastPTS > PTS_DTS_MASK || SequencedPTS(lastPTS, pts))) {
             // Simply replace the event if it already existed.
             events[pts] = Event(spliceOut, eventId);
+            nextEventPTS = events.begin()->first;
         }
     }
 }
@@ -399,6 +404,7 @@ void ts::RMSplicePlugin::PIDState::cancelEvent(uint32_t event_id)
             ++it;
         }
     }
+    nextEventPTS = events.empty() ? INVALID_PTS : events.begin()->first;
 }
 
 
@@ -416,9 +422,9 @@ ts::ProcessorPlugin::Status ts::RMSplicePlugin::processPacket(TSPacket& pkt, TSP
     _demux.feedPacket(pkt);
 
     // Is this a PID which is subject to splicing?
-    auto it = _states.find(pid);
-    if (it != _states.end()) {
-        PIDState& state(it->second);
+    // The bitset test avoids a map lookup on all other PID's of the mux.
+    if (_splicedPIDs.test(pid)) {
+        PIDState& state(_states[pid]);
 
         // If this packet has a PTS, there is maybe a splice point to process.
         if (pkt.hasPTS()) {
@@ -443,12 +449,17 @@ ts::ProcessorPlugin::Status ts::RMSplicePlugin::processPacket(TSPacket& pkt, TSP
             state.lastPTS = currentPTS;
 
             // Remove all leading splicing events older than current PTS.
+            // The cached earliest event PTS makes this a single comparison when
+            // no splice point is reached, the most common case by far.
             uint64_t eventPTS = INVALID_PTS;
             Event event;
-            while (!state.events.empty() && state.events.begin()->first <= state.lastPTS) {
-                eventPTS = state.events.begin()->first;
-                event = state.events.begin()->second;
-                state.events.erase(state.events.begin());
+            if (state.nextEventPTS <= state.lastPTS) {
+                while (!state.events.empty() && state.events.begin()->first <= state.lastPTS) {
+                    eventPTS = state.events.begin()->first;
+                    event = state.events.begin()->second;
+                    state.events.erase(state.events.begin());
+                }
+                state.nextEventPTS = state.events.empty() ? INVALID_PTS : state.events.begin()->first;
             }
 
             if (state.immediateOut) {
@@ -22,10 +22,13 @@
 #include "tsBetterSystemRandomGenerator.h"
 #include "tsCADescriptor.h"
 #include "tsScramblingDescriptor.h"
+#include "tsThread.h"
 
 #define DEFAULT_ECM_BITRATE 30000
 #define DEFAULT_ECM_INTER_PACKET  7000  // When bitrate is unknown, use 10 ECM/s for TS @10Mb/s
 #define ASYNC_HANDLER_EXTRA_STACK_SIZE (1024 * 1024)
+#define SCRAMBLING_THREAD_STACK_SIZE (128 * 1024)
+#define PKT_PER_SCRAMBLING_THREAD 512  // Packet window size is this value times --threads
 
 
 //----------------------------------------------------------------------------
@@ -82,6 +85,8 @@ namespace ts {
         virtual bool start() override;
         virtual bool stop() override;
         virtual Status processPacket(TSPacket&, TSPacketMetadata&) override;
+        virtual size_t getPacketWindowSize() override;
+        virtual size_t processPacketWindow(TSPacketWindow&) override;
 
     private:
         // Description of a crypto-period.
@@ -134,6 +139,49 @@ namespace ts {
             virtual void handleECM(const ecmgscs::ECMResponse&) override;
         };
 
+        // One worker of the scrambling thread pool (option --threads).
+        // Each worker owns a private copy of the scrambling engine. The plugin
+        // mirrors all key and parity changes into the workers so that all engines
+        // remain in lockstep. On each flush, the pending packets are sharded
+        // across the workers which encrypt their slices in parallel. Since the
+        // packets are encrypted in place in the global buffer, their order in
+        // the stream is preserved.
+        class ScramblingThread: public Thread
+        {
+            TS_NOCOPY(ScramblingThread);
+        public:
+            // Constructor. Duplicate the scrambling configuration of the plugin.
+            ScramblingThread(ScramblerPlugin* plugin);
+
+            // Destructor, wait for termination of the thread.
+            virtual ~ScramblingThread() override;
+
+            // Get the scrambling engine of this worker (to mirror key changes).
+            TSScrambling& scrambling() { return _scrambling; }
+
+            // Submit a slice of packets to scramble. Called from the plugin thread.
+            void scramble(TSPacket* const* packets, size_t count);
+
+            // Wait until the last submitted slice is completed. Return false on scrambling error.
+            bool waitSliceCompletion();
+
+            // Request the termination of the thread.
+            void terminate();
+
+        private:
+            ScramblerPlugin* const  _plugin;         // Reference to scrambler plugin.
+            TSScrambling            _scrambling;     // Private copy of the scrambling engine.
+            std::mutex              _mutex {};       // Protect the following fields.
+            std::condition_variable _cond {};        // Signal slice submission and completion.
+            TSPacket* const*        _packets = nullptr;  // Current slice, null when idle.
+            size_t                  _count = 0;      // Number of packets in current slice.
+            bool                    _success = true; // All packets were correctly scrambled.
+            volatile bool           _terminate = false;  // Termination request.
+
+            // Thread main code.
+            virtual void main() override;
+        };
+
         // ScramblerPlugin parameters, remain constant after start()
         ServiceDiscovery  _service {duck, this};        // Service description
         bool              _use_service = false;         // Scramble a service (ie. not a specific list of PID's).
@@ -154,6 +202,7 @@ namespace ts {
         PID               _ecm_pid = PID_NULL;          // PID for ECM
         PacketCounter     _partial_scrambling = 0;      // Do not scramble all packets if > 1
         cn::seconds       _clear_period {0};            // Clear period before scrambling commences
+        size_t            _thread_count = 0;            // Size of the scrambling thread pool, 0 means inline scrambling
         ECMGClientArgs    _ecmg_args {};                // Parameters for ECMG client
         tlv::Logger       _logger {Severity::Debug, this}; // Message logger for ECMG <=> SCS protocol
         ecmgscs::Protocol      _ecmgscs {};                // ECMG <=> SCS protocol instance.
@@ -182,6 +231,8 @@ namespace ts {
         size_t            _current_ecm = 0;             // Index to current ECM (ECM being broadcast)
         TSScrambling      _scrambling {*this};          // Scrambler
         CyclingPacketizer _pzer_pmt {duck};             // Packetizer for modified PMT
+        std::vector<std::unique_ptr<ScramblingThread>> _threads {};  // Scrambling thread pool (empty without --threads)
+        std::vector<TSPacket*> _pending_packets {};     // Packets of the current window, waiting to be scrambled
 
         // Initialize ECM and CP scheduling.
         void initializeScheduling();
@@ -196,6 +247,14 @@ namespace ts {
         bool changeCW();
         void changeECM();
 
+        // Change the scrambling key or parity in all scrambling engines (plugin and thread pool).
+        // Pending packets, queued under the previous key, are flushed first.
+        bool setEncryptParityAll(int parity);
+        bool setCWAll(const ByteBlock& cw, int parity);
+
+        // Distribute the pending packets over the thread pool and wait for their encryption.
+        bool flushPendingPackets();
+
         // Check if we are in degraded mode or if we enter degraded mode
         bool inDegradedMode();
 
@@ -309,6 +368,16 @@ ts::ScramblerPlugin::ScramblerPlugin(TSP* tsp_) :
          u"Scramble subtitles components in the selected service. By default, the "
          u"subtitles components are not scrambled.");
 
+    option(u"threads", 0, POSITIVE);
+    help(u"threads", u"count",
+         u"Distribute the scrambling workload over the specified number of threads. "
+         u"By default, the packets are scrambled in the plugin thread. "
+         u"With this option, the packets are processed by windows: the control logic "
+         u"(service discovery, PMT update, ECM insertion, crypto-period transitions) "
+         u"remains sequential but the payload encryption of the packets of each window "
+         u"is spread over the threads. The order of the packets in the stream is preserved. "
+         u"Use this option when a single CPU core cannot sustain the scrambling of the full stream.");
+
     option(u"synchronous");
     help(u"synchronous",
          u"Specify to synchronously generate the ECM's. By default, in real-time "
@@ -343,6 +412,7 @@ bool ts::ScramblerPlugin::getOptions()
     getChronoValue(_clear_period, u"clear-period", cn::seconds(0));
     getIntValue(_partial_scrambling, u"partial-scrambling", 1);
     getIntValue(_ecm_pid, u"pid-ecm", PID_NULL);
+    getIntValue(_thread_count, u"threads", 0);
     getValue(_ecm_bitrate, u"bitrate-ecm", DEFAULT_ECM_BITRATE);
     getHexaValue(_ca_desc_private, u"private-data");
 
@@ -410,6 +480,23 @@ bool ts::ScramblerPlugin::start()
         return false;
     }
 
+    // Create the scrambling thread pool (--threads). The pool must exist before
+    // the first scrambling key is set since all key changes are mirrored into it.
+    _pending_packets.clear();
+    for (size_t i = 0; i < _thread_count; ++i) {
+        _threads.push_back(std::make_unique<ScramblingThread>(this));
+    }
+    if (!_threads.empty()) {
+        // With fixed control words, load the first CW in all engines now so that
+        // subsequent parity changes advance all CW lists in the same sequence.
+        if (_scrambling.hasFixedCW() && !setEncryptParityAll(SC_EVEN_KEY)) {
+            return false;
+        }
+        for (auto& thr : _threads) {
+            thr->start();
+        }
+    }
+
     // Initialize ECMG.
     if (_need_ecm) {
         if (!_ecmg_args.ecmg_address.hasAddress()) {
@@ -471,6 +558,13 @@ bool ts::ScramblerPlugin::stop()
         _ecmg.disconnect();
     }
 
+    // Terminate the scrambling thread pool. The destructors wait for the threads.
+    for (auto& thr : _threads) {
+        thr->terminate();
+    }
+    _threads.clear();
+    _pending_packets.clear();
+
     // Terminate the scrambling engine.
     _scrambling.stop();
 
@@ -692,7 +786,7 @@ bool ts::ScramblerPlugin::changeCW()
         }
 
         // Set next crypto-period key.
-        return _scrambling.setEncryptParity(int(_current_cw));
+        return setEncryptParityAll(int(_current_cw));
     }
     else if (!inDegradedMode()) {
         // Random CW and ECM generation at each crypto-period.
@@ -848,8 +942,13 @@ ts::ProcessorPlugin::Status ts::ScramblerPlugin::processPacket(TSPacket& pkt, TS
         _partial_clear = _partial_scrambling - 1;
     }
 
-    // Scramble the packet payload.
-    if (!_scrambling.encrypt(pkt)) {
+    // Scramble the packet payload. In packet window mode (--threads), defer the
+    // encryption: the packet is queued and encrypted by the thread pool on the
+    // next flush, which always occurs before any subsequent key change.
+    if (!_threads.empty()) {
+        _pending_packets.push_back(&pkt);
+    }
+    else if (!_scrambling.encrypt(pkt)) {
         return TSP_END;
     }
     _scrambled_count++;
@@ -858,6 +957,177 @@ ts::ProcessorPlugin::Status ts::ScramblerPlugin::processPacket(TSPacket& pkt, TS
 }
 
 
+//----------------------------------------------------------------------------
+// Packet window processing method, used with --threads.
+//----------------------------------------------------------------------------
+
+size_t ts::ScramblerPlugin::getPacketWindowSize()
+{
+    // Without --threads, process packets one by one.
+    return _thread_count == 0 ? 0 : _thread_count * PKT_PER_SCRAMBLING_THREAD;
+}
+
+size_t ts::ScramblerPlugin::processPacketWindow(TSPacketWindow& win)
+{
+    // Run the sequential control logic on each packet. Packets to scramble are
+    // queued in _pending_packets instead of being encrypted inline.
+    for (size_t i = 0; i < win.size(); ++i) {
+        TSPacket* pkt = nullptr;
+        TSPacketMetadata* pkt_data = nullptr;
+        if (!win.get(i, pkt, pkt_data)) {
+            continue;
+        }
+        const Status status = processPacket(*pkt, *pkt_data);
+        if (status == TSP_NULL) {
+            win.nullify(i);
+        }
+        else if (status == TSP_DROP) {
+            win.drop(i);
+        }
+        else if (status != TSP_OK) {
+            // TSP_END: terminate the stream after the packets which were already processed.
+            flushPendingPackets();
+            return i;
+        }
+    }
+
+    // Encrypt all queued packets of the window in parallel.
+    return flushPendingPackets() ? win.size() : 0;
+}
+
+
+//----------------------------------------------------------------------------
+// Distribute the pending packets over the thread pool.
+//----------------------------------------------------------------------------
+
+bool ts::ScramblerPlugin::flushPendingPackets()
+{
+    if (_pending_packets.empty()) {
+        return true;
+    }
+    assert(!_threads.empty());
+
+    // Shard the pending packets into contiguous slices, one per thread.
+    const size_t count = _pending_packets.size();
+    const size_t slice = (count + _threads.size() - 1) / _threads.size();
+    for (size_t first = 0, i = 0; first < count; first += slice, ++i) {
+        _threads[i]->scramble(&_pending_packets[first], std::min(slice, count - first));
+    }
+
+    // Wait for the completion of all slices.
+    bool success = true;
+    for (auto& thr : _threads) {
+        success = thr->waitSliceCompletion() && success;
+    }
+    _pending_packets.clear();
+    return success;
+}
+
+
+//----------------------------------------------------------------------------
+// Change the scrambling key or parity in all scrambling engines.
+//----------------------------------------------------------------------------
+
+bool ts::ScramblerPlugin::setEncryptParityAll(int parity)
+{
+    // Packets which were queued under the previous key must be encrypted first.
+    // After the flush, all workers are idle and their engines can be safely updated.
+    bool success = flushPendingPackets();
+    success = _scrambling.setEncryptParity(parity) && success;
+    for (auto& thr : _threads) {
+        success = thr->scrambling().setEncryptParity(parity) && success;
+    }
+    return success;
+}
+
+bool ts::ScramblerPlugin::setCWAll(const ByteBlock& cw, int parity)
+{
+    bool success = flushPendingPackets();
+    success = _scrambling.setCW(cw, parity) && success;
+    for (auto& thr : _threads) {
+        success = thr->scrambling().setCW(cw, parity) && success;
+    }
+    return success;
+}
+
+
+//----------------------------------------------------------------------------
+// Scrambling thread pool worker.
+//----------------------------------------------------------------------------
+
+ts::ScramblerPlugin::ScramblingThread::ScramblingThread(ScramblerPlugin* plugin) :
+    Thread(ThreadAttributes().setStackSize(SCRAMBLING_THREAD_STACK_SIZE)),
+    _plugin(plugin),
+    _scrambling(plugin->_scrambling)
+{
+}
+
+ts::ScramblerPlugin::ScramblingThread::~ScramblingThread()
+{
+    terminate();
+    waitForTermination();
+}
+
+void ts::ScramblerPlugin::ScramblingThread::terminate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _terminate = true;
+    _cond.notify_all();
+}
+
+void ts::ScramblerPlugin::ScramblingThread::scramble(TSPacket* const* packets, size_t count)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _packets = packets;
+    _count = count;
+    _cond.notify_all();
+}
+
+bool ts::ScramblerPlugin::ScramblingThread::waitSliceCompletion()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this]() { return _packets == nullptr; });
+    return _success;
+}
+
+void ts::ScramblerPlugin::ScramblingThread::main()
+{
+    _plugin->debug(u"scrambling thread started");
+
+    for (;;) {
+        // Wait for a slice of packets to scramble or a termination request.
+        TSPacket* const* packets = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait(lock, [this]() { return _terminate || _packets != nullptr; });
+            if (_terminate) {
+                break;
+            }
+            packets = _packets;
+            count = _count;
+        }
+
+        // Encrypt the slice, outside the lock.
+        bool ok = true;
+        for (size_t i = 0; ok && i < count; ++i) {
+            ok = _scrambling.encrypt(*packets[i]);
+        }
+
+        // Report the completion of the slice.
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _success = ok;
+            _packets = nullptr;
+            _count = 0;
+            _cond.notify_all();
+        }
+    }
+
+    _plugin->debug(u"scrambling thread completed");
+}
+
+
 //----------------------------------------------------------------------------
 // Initialize first crypto period.
 //----------------------------------------------------------------------------
@@ -916,8 +1186,8 @@ bool ts::ScramblerPlugin::CryptoPeriod::initScramblerKey() const
 
     // Change the parity of the scrambled packets.
     // Set our random current control word if no fixed CW.
-    return _plugin->_scrambling.setEncryptParity(_cp_number) &&
-        (!_plugin->_need_ecm || _plugin->_scrambling.setCW(_cw_current, _cp_number));
+    return _plugin->setEncryptParityAll(_cp_number) &&
+        (!_plugin->_need_ecm || _plugin->setCWAll(_cw_current, _cp_number));
 }
 
 
@@ -49,11 +49,14 @@ namespace ts {
         size_t                 _max_buffered_sections = 1024;  // hard-coded for now
         PIDSet                 _input_pids {};
         PID                    _output_pid = PID_NULL;
-        std::set<TID>          _tids {};
-        std::set<uint16_t>     _exts {};
-        std::set<uint32_t>     _etids {};
-        std::set<uint8_t>      _versions {};
-        std::set<uint8_t>      _section_numbers {};
+        // Selection criteria are stored in bitsets, indexed by criteria value,
+        // for a constant-time match on each section. The 24-bit extended table
+        // ids are an exception and are kept in a set.
+        std::bitset<0x100>     _tids {};              // --tid
+        std::bitset<0x10000>   _exts {};              // --tid-ext
+        std::set<uint32_t>     _etids {};             // --etid
+        std::bitset<0x20>      _versions {};          // --version
+        std::bitset<0x100>     _section_numbers {};   // --section-number
         std::vector<ByteBlock> _contents {};
         std::vector<ByteBlock> _contents_masks {};
 
@@ -240,7 +243,7 @@ bool ts::SectionsPlugin::getOptions()
     }
 
     // If there any section to remove/keep?
-    _selections_present = !_tids.empty() || !_exts.empty() || !_etids.empty() || !_versions.empty() || !_section_numbers.empty() || !_contents.empty();
+    _selections_present = _tids.any() || _exts.any() || !_etids.empty() || _versions.any() || _section_numbers.any() || !_contents.empty();
 
     if (present(u"and")) {
         // Global "AND" on all (!valid || condition)
@@ -335,11 +338,11 @@ void ts::SectionsPlugin::handleSection(SectionDemux& demux, const Section& secti
 
     // Detect sections to be selected. This can be an "and" or an "or" on the conditions.
     const bool selected = _selections_present && _predicate({
-        condition(!_tids.empty(), _tids.contains(tid)),
-        condition(is_long && !_exts.empty(), _exts.contains(ext)),
+        condition(_tids.any(), _tids.test(tid)),
+        condition(is_long && _exts.any(), _exts.test(ext)),
         condition(is_long && !_etids.empty(), _etids.contains(etid)),
-        condition(is_long && !_versions.empty(), _versions.contains(section.version())),
-        condition(is_long && !_section_numbers.empty(), _section_numbers.contains(section.sectionNumber())),
+        condition(is_long && _versions.any(), _versions.test(section.version())),
+        condition(is_long && _section_numbers.any(), _section_numbers.test(section.sectionNumber())),
         condition(!_contents.empty(), matchContent(section)),
     });
 
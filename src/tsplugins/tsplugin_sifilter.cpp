@@ -218,6 +218,12 @@ void ts::SIFilterPlugin::processPAT(const PAT& pat)
 
 ts::ProcessorPlugin::Status ts::SIFilterPlugin::processPacket(TSPacket& pkt, TSPacketMetadata& pkt_data)
 {
-    _demux.feedPacket(pkt);
-    return _pass_pids[pkt.getPID()] ? TSP_OK : _drop_status;
+    // The demux only monitors a few signalization PID's (PAT, sometimes CAT
+    // and PMT's). Do not even feed it with packets from other PID's, the
+    // filtering decision is a simple bitset lookup.
+    const PID pid = pkt.getPID();
+    if (_demux.hasPID(pid)) {
+        _demux.feedPacket(pkt);
+    }
+    return _pass_pids[pid] ? TSP_OK : _drop_status;
 }
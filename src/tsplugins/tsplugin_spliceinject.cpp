@@ -16,7 +16,7 @@
 #include "tsSectionFile.h"
 #include "tsUDPReceiver.h"
 #include "tsPollFiles.h"
-#include "tsPacketizer.h"
+#include "tsOneShotPacketizer.h"
 #include "tsMessagePriorityQueue.h"
 #include "tsThread.h"
 #include "tsNullReport.h"
@@ -57,8 +57,7 @@ namespace {
 namespace ts {
     class SpliceInjectPlugin:
         public ProcessorPlugin,
-        private SignalizationHandlerInterface,
-        private SectionProviderInterface
+        private SignalizationHandlerInterface
     {
         TS_PLUGIN_CONSTRUCTORS(SpliceInjectPlugin);
     public:
@@ -110,6 +109,7 @@ namespace ts {
 
             SpliceInformationTable sit {};      // The analyzed Splice Information Table.
             SectionPtr section {};              // The binary SIT section.
+            TSPacketVector packets {};          // The pre-packetized section, ready-to-copy packet images.
             uint64_t   next_pts = INVALID_PTS;  // Next PTS after which the section shall be inserted (INVALID_PTS means immediate).
             uint64_t   last_pts = INVALID_PTS;  // PTS after which the section shall no longer be inserted (INVALID_PTS means never).
             uint64_t   interval = cn::duration_cast<PTS>(_plugin->_inject_interval).count(); // Interval between two insertions in PTS units.
@@ -184,7 +184,9 @@ namespace ts {
         FileListener     _file_listener {this};        // File listener thread.
         UDPListener      _udp_listener {this};         // UDP listener thread.
         CommandQueue     _queue {};                    // Queue for splice commands.
-        Packetizer       _packetizer {duck, PID_NULL, this};  // Packetizer for Splice Information sections.
+        std::deque<TSPacket> _ready_packets {};        // Pre-packetized sections, ready to inject.
+        TSPacketVector   _null_splice_pkts {};         // Pre-packetized null splice section.
+        uint8_t          _continuity = 0;              // Continuity counter in the injection PID.
         uint64_t         _last_pts = INVALID_PTS;      // Last PTS value from a clock reference.
         PID              _inject_pid_act = PID_NULL;   // PID for injection, actual.
         PID              _pcr_pid_act = PID_NULL;      // PID containing PCR's, actual.
@@ -200,9 +202,12 @@ namespace ts {
         // Implementation of SignalizationHandlerInterface.
         virtual void handlePMT(const PMT&, PID) override;
 
-        // Implementation of SectionProviderInterface.
-        virtual void provideSection(SectionCounter counter, SectionPtr& section) override;
-        virtual bool doStuffing() override;
+        // Refill the queue of ready-to-inject packets from the queued splice commands.
+        void loadReadyPackets();
+
+        // Pre-packetize a splice information section. The packets are generated on a
+        // null PID, the actual PID and continuity counters are patched at injection.
+        void packetizeSection(const SectionPtr& section, TSPacketVector& packets);
 
         // Process a section file or message. Invoked from listener threads.
         void processSectionMessage(const uint8_t*, size_t);
@@ -441,9 +446,11 @@ bool ts::SpliceInjectPlugin::start()
     _service.clear();
     _service.set(_service_ref);
 
-    // The packetizer generates packets for the inject PID.
-    _packetizer.reset();
-    _packetizer.setPID(_inject_pid_act);
+    // Pre-packetize the null splice section. All pre-packetized sections are built
+    // on a null PID, the actual PID and continuity counters are patched at injection.
+    packetizeSection(_null_splice, _null_splice_pkts);
+    _ready_packets.clear();
+    _continuity = 0;
 
     // Tune the section queue.
     _queue.clear();
@@ -520,8 +527,17 @@ ts::ProcessorPlugin::Status ts::SpliceInjectPlugin::processPacket(TSPacket& pkt,
     }
 
     if (pid == PID_NULL) {
-        // Replace null packets with splice information section data, when available.
-        if (_packetizer.getNextPacket(pkt)) {
+        // Replace null packets with pre-packetized splice information sections, when available.
+        if (_ready_packets.empty()) {
+            loadReadyPackets();
+        }
+        if (!_ready_packets.empty()) {
+            // Copy the next ready packet image, patch its PID and continuity counter.
+            pkt = _ready_packets.front();
+            _ready_packets.pop_front();
+            pkt.setPID(_inject_pid_act);
+            pkt.setCC(_continuity);
+            _continuity = (_continuity + 1) & CC_MASK;
             // Remember position of last injected packet.
             _last_inject_pkt = tsp->pluginPackets();
         }
@@ -567,7 +583,6 @@ void ts::SpliceInjectPlugin::handlePMT(const PMT& pmt, PID)
         if (_inject_pid_act == PID_NULL && it.second.stream_type == ST_SCTE35_SPLICE) {
             // Found an SCTE 35 splice information stream, use its PID.
             _inject_pid_act = it.first;
-            _packetizer.setPID(_inject_pid_act);
         }
     }
 
@@ -589,15 +604,11 @@ void ts::SpliceInjectPlugin::handlePMT(const PMT& pmt, PID)
 
 
 //----------------------------------------------------------------------------
-// Invoked when a new splice information section is required.
-// Implementation of SectionProviderInterface.
+// Refill the queue of ready-to-inject packets from the queued splice commands.
 //----------------------------------------------------------------------------
 
-void ts::SpliceInjectPlugin::provideSection(SectionCounter counter, SectionPtr& section)
+void ts::SpliceInjectPlugin::loadReadyPackets()
 {
-    // The default is to return no section, meaning do not insert splice information.
-    section.reset();
-
     // If injection PID is unknown or if we have no time reference, do nothing.
     if (_inject_pid_act == PID_NULL || _last_pts == INVALID_PTS) {
         return;
@@ -635,8 +646,8 @@ void ts::SpliceInjectPlugin::provideSection(SectionCounter counter, SectionPtr&
             assert(dequeued);
             assert(cmd2 == cmd);
 
-            // Now we have a section to send.
-            section = cmd->section;
+            // Now we have packets to send, copy the pre-packetized section.
+            _ready_packets.insert(_ready_packets.end(), cmd->packets.begin(), cmd->packets.end());
             verbose(u"injecting %s, current PTS: 0x%09X", *cmd, _last_pts);
 
             // If the command must be repeated, compute next PTS and requeue.
@@ -662,23 +673,24 @@ void ts::SpliceInjectPlugin::provideSection(SectionCounter counter, SectionPtr&
     }
 
     // Inject null splice commands when necessary to fill the PID.
-    if (section == nullptr && _inter_packet > 0 && tsp->pluginPackets() >= _last_inject_pkt + _inter_packet) {
+    if (_ready_packets.empty() && _inter_packet > 0 && tsp->pluginPackets() >= _last_inject_pkt + _inter_packet) {
         // It is time to insert a null splice command.
-        section = _null_splice;
+        _ready_packets.insert(_ready_packets.end(), _null_splice_pkts.begin(), _null_splice_pkts.end());
     }
 }
 
 
 //----------------------------------------------------------------------------
-// Shall we perform section stuffing.
-// Implementation of SectionProviderInterface.
+// Pre-packetize a splice information section.
 //----------------------------------------------------------------------------
 
-bool ts::SpliceInjectPlugin::doStuffing()
+void ts::SpliceInjectPlugin::packetizeSection(const SectionPtr& section, TSPacketVector& packets)
 {
     // Splice Information Table are rare and mostly contained in one or two
     // TS packets. We always stuff to the end of packets after a section.
-    return true;
+    OneShotPacketizer pzer(duck, PID_NULL, true);
+    pzer.addSection(section);
+    pzer.getPackets(packets);
 }
 
 
@@ -799,6 +811,12 @@ ts::SpliceInjectPlugin::SpliceCommand::SpliceCommand(SpliceInjectPlugin* plugin,
         sit.deserialize(_plugin->duck, table);
     }
 
+    // Pre-packetize the section now, in the listener thread, so that the
+    // time-critical packet processing thread only copies ready packet images.
+    if (sit.isValid()) {
+        _plugin->packetizeSection(section, packets);
+    }
+
     // The initial values for the member fields are set for one immediate injection.
     // This must be changed for non-immediate splice_insert() and time_signal() commands.
     if (sit.isValid() &&
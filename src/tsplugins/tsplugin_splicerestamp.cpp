@@ -43,6 +43,7 @@ namespace ts {
         // Command line options:
         bool     _replace = false;           // Replace pts_adjustment field without adding previous value.
         bool     _continuous = false;        // Continuously recompute the adjustment between the old and new PCR PID's.
+        bool     _patch = false;             // Patch pts_adjustment in place in the binary sections.
         PID      _pid_arg = PID_NULL;        // The splice PID to restamp.
         PID      _old_pcr_pid = PID_NULL;    // Previous PCR reference.
         PID      _new_pcr_pid = PID_NULL;    // New PCR reference.
@@ -101,6 +102,16 @@ ts::SpliceRestampPlugin::SpliceRestampPlugin(TSP* tsp_) :
          u"Specify the PID carrying the PCR which was used as reference clock by the splice commands on input. "
          u"Must be used with --new-pcr-pid.");
 
+    option(u"patch");
+    help(u"patch",
+         u"Patch the pts_adjustment field directly in the binary sections, at its fixed offset, "
+         u"and recompute the CRC32, without full table deserialization. "
+         u"The sections are transmitted byte for byte, except the pts_adjustment and CRC32 fields. "
+         u"This is faster and preserves splice commands and descriptors exactly as received, "
+         u"including non-standard ones. "
+         u"Sections with encrypted commands cannot be patched and are processed the standard way. "
+         u"By default, the sections are deserialized and rebuilt.");
+
     option(u"pid", 'p', PIDVAL);
     help(u"pid",
          u"Specify the PID carrying SCTE-35 sections to restamp. "
@@ -129,6 +140,7 @@ bool ts::SpliceRestampPlugin::getOptions()
 {
     _replace = present(u"replace");
     _continuous = present(u"continuous");
+    _patch = present(u"patch");
     getIntValue(_pid_arg, u"pid", PID_NULL);
     getIntValue(_old_pcr_pid, u"old-pcr-pid", PID_NULL);
     getIntValue(_new_pcr_pid, u"new-pcr-pid", PID_NULL);
@@ -221,52 +233,78 @@ void ts::SpliceRestampPlugin::handlePMT(const PMT& pmt, PID)
 
 void ts::SpliceRestampPlugin::handleTable(SectionDemux& demux, const BinaryTable& table)
 {
-    // Convert to a Splice Information Table.
-    SpliceInformationTable sit(duck, table);
-    if (sit.isValid()) {
-        debug(u"processing splice table, adjust value: %s, first PTS count: %d", _current_adjustment.has_value(), _first_pts.size());
-
-        // With --rebase-pts, compute the PTS adjustment at the first splice section.
-        if (_rebase_pts != INVALID_PTS && !_current_adjustment.has_value() && !_first_pts.empty()) {
-            // Get the lowest PTS value in the same service as the splice PID (or in the TS if the service is unknown).
-            uint64_t min_pts = INVALID_PTS;
-            for (const auto& it : _first_pts) {
-                if (_service_pids.empty() || _service_pids.contains(it.first)) {
-                    min_pts = std::min(min_pts, it.second);
-                }
-            }
-            // The idea of --rebase-pts is that the current PTS "min_pts" will be rebased as "_rebase_pts".
-            // Compute the required pts_adjustment.
-            if (min_pts != INVALID_PTS) {
-                _current_adjustment = min_pts > _rebase_pts ? PTS_DTS_SCALE - (min_pts - _rebase_pts) : _rebase_pts - min_pts;
-                verbose(u"initial PTS adjustment is %'d", _current_adjustment.value());
-                debug(u"lowest PTS is %n", min_pts);
+    debug(u"processing splice table, adjust value: %s, first PTS count: %d", _current_adjustment.has_value(), _first_pts.size());
+
+    // With --rebase-pts, compute the PTS adjustment at the first splice section.
+    if (_rebase_pts != INVALID_PTS && !_current_adjustment.has_value() && !_first_pts.empty()) {
+        // Get the lowest PTS value in the same service as the splice PID (or in the TS if the service is unknown).
+        uint64_t min_pts = INVALID_PTS;
+        for (const auto& it : _first_pts) {
+            if (_service_pids.empty() || _service_pids.contains(it.first)) {
+                min_pts = std::min(min_pts, it.second);
             }
         }
+        // The idea of --rebase-pts is that the current PTS "min_pts" will be rebased as "_rebase_pts".
+        // Compute the required pts_adjustment.
+        if (min_pts != INVALID_PTS) {
+            _current_adjustment = min_pts > _rebase_pts ? PTS_DTS_SCALE - (min_pts - _rebase_pts) : _rebase_pts - min_pts;
+            verbose(u"initial PTS adjustment is %'d", _current_adjustment.value());
+            debug(u"lowest PTS is %n", min_pts);
+        }
+    }
 
-        // Now adjust the PTS in the splice section.
-        if (_current_adjustment.has_value()) {
-            // Update PTS adjustment.
-            if (_replace) {
-                sit.pts_adjustment = _current_adjustment.value();
+    // If the current PTS adjustment is not yet known, we prefer to drop the splice section.
+    // Otherwise, we could propagate a splice section with an incorrect PTS and create holes
+    // in the stream when the splice is processed.
+    if (!_current_adjustment.has_value()) {
+        warning(u"dropped SCTE-35 section, PTS adjustment not yet known");
+        return;
+    }
+
+    // With --patch, modify the pts_adjustment field in place in the binary sections,
+    // without full table deserialization. The cost is then independent of the
+    // complexity of the splice commands and descriptors.
+    if (_patch) {
+        bool patched = true;
+        std::list<SectionPtr> sections;
+        for (size_t i = 0; patched && i < table.sectionCount(); ++i) {
+            // Duplicate the section, the original is shared with the demux.
+            const SectionPtr section = std::make_shared<Section>(*table.sectionAt(i), ShareMode::COPY);
+            uint64_t adjust = _current_adjustment.value();
+            if (!_replace && section->isValid() && section->payloadSize() >= 6) {
+                // Add the previous value of pts_adjustment, at fixed offset in the payload.
+                const uint8_t* const data = section->payload();
+                adjust = (adjust + ((uint64_t(data[1] & 0x01) << 32) | uint64_t(GetUInt32(data + 2)))) & PTS_DTS_MASK;
             }
-            else {
-                sit.pts_adjustment = (sit.pts_adjustment + _current_adjustment.value()) & PTS_DTS_MASK;
+            patched = SpliceInformationTable::PatchPTSAdjustment(*section, adjust);
+            if (patched) {
+                sections.push_back(section);
             }
+        }
+        if (patched) {
+            _sections.splice(_sections.end(), sections);
+            return;
+        }
+        // Cannot patch in place (e.g. encrypted commands), use full table processing.
+    }
 
-            // Serialize the modified table and enqueue the section (only one, normally).
-            BinaryTable bin;
-            if (sit.serialize(duck, bin)) {
-                for (size_t i = 0; i < bin.sectionCount(); ++i) {
-                    _sections.push_back(bin.sectionAt(i));
-                }
-            }
+    // Convert to a Splice Information Table.
+    SpliceInformationTable sit(duck, table);
+    if (sit.isValid()) {
+        // Update PTS adjustment.
+        if (_replace) {
+            sit.pts_adjustment = _current_adjustment.value();
         }
         else {
-            // If the current PTS adjustment is not yet known, we prefer to drop the splice section.
-            // Otherwise, we could propagate a splice section with an incorrect PTS and create holes
-            // in the stream when the splice is processed.
-            warning(u"dropped SCTE-35 section, PTS adjustment not yet known");
+            sit.pts_adjustment = (sit.pts_adjustment + _current_adjustment.value()) & PTS_DTS_MASK;
+        }
+
+        // Serialize the modified table and enqueue the section (only one, normally).
+        BinaryTable bin;
+        if (sit.serialize(duck, bin)) {
+            for (size_t i = 0; i < bin.sectionCount(); ++i) {
+                _sections.push_back(bin.sectionAt(i));
+            }
         }
     }
 }
@@ -14,6 +14,7 @@
 #include "tsPluginRepository.h"
 #include "tsTSSpeedMetrics.h"
 #include "tsSingleDataStatistics.h"
+#include "tsTDigest.h"
 #include "tsFileNameGenerator.h"
 #include "tsFileUtils.h"
 #include "tsFatal.h"
@@ -77,6 +78,7 @@ namespace ts {
             uint64_t total_pkt = 0;      // Total number of packets in that category.
             uint64_t last_ts_index = 0;  // Index in TS of last packet of the category.
             SingleDataStatistics<uint64_t> ipkt {}; // Inter-packet distance statistics.
+            TDigest ipkt_quant {};       // Inter-packet distance quantiles (p99, p999).
 
             // Add packet data to the context.
             void addPacketData(PacketCounter, const TSPacket&);
@@ -265,13 +267,15 @@ bool ts::StatsPlugin::produceReport()
                 << "IPD min" << _csv_separator
                 << "IPD max" << _csv_separator
                 << "IPD mean" << _csv_separator
-                << "IPD std dev" << std::endl;
+                << "IPD std dev" << _csv_separator
+                << "IPD p99" << _csv_separator
+                << "IPD p999" << std::endl;
         }
         else {
-            out << "          Total nb  ......Inter-packet distance......." << std::endl
+            out << "          Total nb  ...............Inter-packet distance................" << std::endl
                 << name.toJustifiedLeft(6)
-                <<       "  of packets     min     max      mean   std dev" << std::endl
-                << "------  ----------  ------  ------  --------  --------" << std::endl;
+                <<       "  of packets     min     max      mean   std dev      p99     p999" << std::endl
+                << "------  ----------  ------  ------  --------  --------  -------  -------" << std::endl;
         }
     }
 
@@ -283,8 +287,9 @@ bool ts::StatsPlugin::produceReport()
         const Context& ctx(*(it.second));
 
         if (_log) {
-            info(u"%s: 0x%X  Total: %8'd  IPD min: %3d  max: %5d  mean: %s  std-dev: %s",
-                 name, index, ctx.total_pkt, ctx.ipkt.minimum(), ctx.ipkt.maximum(), ctx.ipkt.meanString(7), ctx.ipkt.standardDeviationString(7));
+            info(u"%s: 0x%X  Total: %8'd  IPD min: %3d  max: %5d  mean: %s  std-dev: %s  p99: %s  p999: %s",
+                 name, index, ctx.total_pkt, ctx.ipkt.minimum(), ctx.ipkt.maximum(), ctx.ipkt.meanString(7), ctx.ipkt.standardDeviationString(7),
+                 ctx.ipkt_quant.quantileString(0.99, 5, 1), ctx.ipkt_quant.quantileString(0.999, 5, 1));
         }
         else if (_csv) {
             out << index << _csv_separator
@@ -292,11 +297,14 @@ bool ts::StatsPlugin::produceReport()
                 << ctx.ipkt.minimum() << _csv_separator
                 << ctx.ipkt.maximum() << _csv_separator
                 << ctx.ipkt.meanString() << _csv_separator
-                << ctx.ipkt.standardDeviationString() << std::endl;
+                << ctx.ipkt.standardDeviationString() << _csv_separator
+                << ctx.ipkt_quant.quantileString(0.99) << _csv_separator
+                << ctx.ipkt_quant.quantileString(0.999) << std::endl;
         }
         else {
             out << UString::Format(_track_pids ? u"0x%04X" : u"%-6d", index)
-                << UString::Format(u"  %10'd  %6d  %6d  %s  %s", ctx.total_pkt, ctx.ipkt.minimum(), ctx.ipkt.maximum(), ctx.ipkt.meanString(8), ctx.ipkt.standardDeviationString(8))
+                << UString::Format(u"  %10'd  %6d  %6d  %s  %s  %s  %s", ctx.total_pkt, ctx.ipkt.minimum(), ctx.ipkt.maximum(), ctx.ipkt.meanString(8), ctx.ipkt.standardDeviationString(8),
+                                   ctx.ipkt_quant.quantileString(0.99, 7, 1), ctx.ipkt_quant.quantileString(0.999, 7, 1))
                 << std::endl;
         }
     }
@@ -386,6 +394,7 @@ void ts::StatsPlugin::Context::addPacketData(PacketCounter ts_index, const TSPac
     // Accumulate inter-packet statistics, starting at the second packet.
     if (total_pkt > 0) {
         ipkt.feed(ts_index - last_ts_index);
+        ipkt_quant.feed(double(ts_index - last_ts_index));
     }
 
     // Global packet statistics.
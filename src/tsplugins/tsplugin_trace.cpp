@@ -38,8 +38,18 @@ namespace ts {
         TSPacketLabelSet _labels {};        // Trace packets with any of these labels
         fs::path         _outfile_name {};  // Output file name
 
+        // A pre-parsed segment of the format string: a literal part,
+        // followed by an optional field to format (0 when none).
+        class FormatSegment
+        {
+        public:
+            UString literal {};
+            UChar   field = 0;
+        };
+
         // Working data
-        std::ofstream _outfile {};          // User-specified output file
+        std::vector<FormatSegment> _segments {};  // Pre-parsed format string
+        std::ofstream _outfile {};                // User-specified output file
     };
 }
 
@@ -110,6 +120,46 @@ bool ts::TracePlugin::getOptions()
 
 bool ts::TracePlugin::start()
 {
+    // Pre-parse the format string once, so that building a trace line only
+    // appends literals and formats the field values.
+    _segments.clear();
+    FormatSegment seg;
+    bool percent = false;
+    for (auto c : _format) {
+        if (percent) {
+            percent = false;
+            switch (c) {
+                case 'p':
+                case 'P':
+                case 'i':
+                case 'I':
+                case 'a':
+                case 'A':
+                    seg.field = c;
+                    _segments.push_back(seg);
+                    seg.literal.clear();
+                    seg.field = 0;
+                    break;
+                case '%':
+                    seg.literal.append(u'%');
+                    break;
+                default:
+                    seg.literal.append(u'%');
+                    seg.literal.append(c);
+                    break;
+            }
+        }
+        else if (c == u'%') {
+            percent = true;
+        }
+        else {
+            seg.literal.append(c);
+        }
+    }
+    if (!seg.literal.empty()) {
+        _segments.push_back(seg);
+    }
+
     // Create output file
     if (!_outfile_name.empty()) {
         verbose(u"creating %s", _outfile_name);
@@ -152,51 +202,38 @@ ts::ProcessorPlugin::Status ts::TracePlugin::processPacket(TSPacket& pkt, TSPack
         return TSP_OK;
     }
 
-    // Build the trace message.
+    // Build the trace message from the pre-parsed format.
     UString line;
-    bool percent = false;
-    for (auto c : _format) {
-        if (percent) {
-            percent = false;
-            switch (c) {
-                case 'p':
-                    line.format(u"%d", pid);
-                    break;
-                case 'P':
-                    line.format(u"0x%X", pid);
-                    break;
-                case 'i':
-                    line.format(u"%d", tsp->pluginPackets());
-                    break;
-                case 'I':
-                    line.format(u"0x%08X", tsp->pluginPackets());
-                    break;
-                case 'a':
-                    line.format(u"%d", tsp->totalPacketsInThread());
-                    break;
-                case 'A':
-                    line.format(u"0x%08X", tsp->totalPacketsInThread());
-                    break;
-                case '%':
-                    line.append(u'%');
-                    break;
-                default:
-                    line.append(u'%');
-                    line.append(c);
-                    break;
-            }
-        }
-        else if (c == u'%') {
-            percent = true;
-        }
-        else {
-            line.append(c);
+    for (const auto& seg : _segments) {
+        line.append(seg.literal);
+        switch (seg.field) {
+            case 'p':
+                line.format(u"%d", pid);
+                break;
+            case 'P':
+                line.format(u"0x%X", pid);
+                break;
+            case 'i':
+                line.format(u"%d", tsp->pluginPackets());
+                break;
+            case 'I':
+                line.format(u"0x%08X", tsp->pluginPackets());
+                break;
+            case 'a':
+                line.format(u"%d", tsp->totalPacketsInThread());
+                break;
+            case 'A':
+                line.format(u"0x%08X", tsp->totalPacketsInThread());
+                break;
+            default:
+                break;
         }
     }
 
     // Then report the message.
     if (_outfile.is_open()) {
-        _outfile << line << std::endl;
+        // Do not flush on each line, the file is flushed when closed.
+        _outfile << line << '\n';
     }
     else {
         info(line);
@@ -335,8 +335,13 @@ ts::ProcessorPlugin::Status ts::TSRenamePlugin::processPacket(TSPacket& pkt, TSP
 {
     const PID pid = pkt.getPID();
 
-    // Filter interesting sections
-    _demux.feedPacket(pkt);
+    // Filter interesting sections. Only feed the demux with the PID's it
+    // monitors, packets from other PID's are passed through untouched.
+    // Tables are processed once per version; in steady state, the replaced
+    // packets are served from the packetizers' cached cycles.
+    if (_demux.hasPID(pid)) {
+        _demux.feedPacket(pkt);
+    }
 
     // If a fatal error occured during section analysis, give up.
     if (_abort) {
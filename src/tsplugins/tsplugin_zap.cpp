@@ -96,6 +96,8 @@ namespace ts {
         CyclingPacketizer    _pzer_pat {duck, PID_PAT, CyclingPacketizer::StuffingPolicy::ALWAYS};
         EITProcessor         _eit_process {duck, PID_EIT};
         uint8_t              _pid_state[PID_MAX] {};   // Status of each PID.
+        PIDSet               _demux_pids {};           // Snapshot of the PID's which are watched by the demux.
+        ServiceContext*      _pmt_service[PID_MAX] {}; // Direct PMT PID to service lookup.
 
         // Implementation of TableHandlerInterface.
         virtual void handleTable(SectionDemux& demux, const BinaryTable& table) override;
@@ -110,6 +112,9 @@ namespace ts {
         // Send a new PAT.
         void sendNewPAT();
 
+        // Recompile the flat per-PID plan after a signalization change.
+        void compilePlan();
+
         // Forget all previous components of a service.
         void forgetServiceComponents(ServiceContext& ctx);
 
@@ -337,10 +342,35 @@ bool ts::ZapPlugin::start()
     _pzer_pat.reset();
     _pzer_sdt.reset();
 
+    // Compile the initial per-PID plan.
+    compilePlan();
+
     return true;
 }
 
 
+//----------------------------------------------------------------------------
+// Recompile the flat per-PID plan after a signalization change.
+//----------------------------------------------------------------------------
+
+void ts::ZapPlugin::compilePlan()
+{
+    // Snapshot the set of PID's which are watched by the section demux.
+    // In the packet processing hot path, all other packets bypass the demux.
+    for (PID pid = 0; pid < PID_MAX; ++pid) {
+        _demux_pids.set(pid, _demux.hasPID(pid));
+    }
+
+    // Direct PMT PID to service lookup, replacing a linear search on each PMT packet.
+    MemZero(_pmt_service, sizeof(_pmt_service));
+    for (const auto& ctx : _services) {
+        if (ctx->id_known && ctx->pmt_pid != PID_NULL) {
+            _pmt_service[ctx->pmt_pid] = ctx.get();
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 // Send a new PAT.
 //----------------------------------------------------------------------------
@@ -518,6 +548,9 @@ void ts::ZapPlugin::handleTable(SectionDemux& demux, const BinaryTable& table)
             break;
         }
     }
+
+    // The received table may have modified the demux filters or the PMT PID's.
+    compilePlan();
 }
 
 
@@ -810,12 +843,16 @@ ts::ProcessorPlugin::Status ts::ZapPlugin::processPacket(TSPacket& pkt, TSPacket
 {
     const PID pid = pkt.getPID();
 
-    // Filter interesting sections
-    _demux.feedPacket(pkt);
+    // Filter interesting sections. The compiled plan knows which PID's the demux
+    // watches, all other packets bypass the section demux entirely. This plugin
+    // does not use the TS packet indexes which the demux records in sections.
+    if (_demux_pids.test(pid)) {
+        _demux.feedPacket(pkt);
 
-    // If a fatal error occured during section analysis, give up.
-    if (_abort) {
-        return TSP_END;
+        // If a fatal error occured during section analysis, give up.
+        if (_abort) {
+            return TSP_END;
+        }
     }
 
     // Process EIT's (at least when some service id is known).
@@ -844,16 +881,13 @@ ts::ProcessorPlugin::Status ts::ZapPlugin::processPacket(TSPacket& pkt, TSPacket
             // Packet is passed unmodified.
             return TSP_OK;
 
-        case TSPID_PMT:
-            // Replace all PMT packets with modified PMT. Look for the right PMT.
-            for (size_t i = 0; i < _services.size(); ++i) {
-                ServiceContext& ctx(*_services[i]);
-                if (ctx.pmt_pid == pid) {
-                    return ctx.pzer_pmt.getNextPacket(pkt) ? TSP_OK : _drop_status;
-                }
-            }
-            // If PMT not found, drop the packet.
-            return _drop_status;
+        case TSPID_PMT: {
+            // Replace all PMT packets with modified PMT.
+            // Direct lookup of the right PMT from the compiled plan.
+            // If the PMT is not found, drop the packet.
+            ServiceContext* const ctx = _pmt_service[pid];
+            return ctx != nullptr && ctx->pzer_pmt.getNextPacket(pkt) ? TSP_OK : _drop_status;
+        }
 
         case TSPID_PAT:
             // Replace all PAT packets with modified PAT.
@@ -15,11 +15,23 @@
 #include "tsjsonOutputArgs.h"
 #include "tsTSFile.h"
 #include "tsFileUtils.h"
+#include "tsSysUtils.h"
+#include "tsByteBlock.h"
+#include "tsMemory.h"
 #include "tsjsonObject.h"
+
+#if !defined(TS_WINDOWS)
+    #include "tsBeforeStandardHeaders.h"
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include "tsAfterStandardHeaders.h"
+#endif
+
 TS_MAIN(MainCode);
 
 #define DEFAULT_BUFFERED_PACKETS 10000
 #define DEFAULT_MIN_REORDER          7
+#define FAST_WINDOW_PACKETS      65536
 
 
 //----------------------------------------------------------------------------
@@ -43,6 +55,7 @@ namespace ts {
         size_t           threshold_diff = 0;
         size_t           min_reorder = 0;
         bool             search_reorder = false;
+        bool             fast = false;
         bool             dump = false;
         uint32_t         dump_flags = 0;
         bool             normalized = false;
@@ -85,6 +98,14 @@ ts::TSCompareOptions::TSCompareOptions(int argc, char *argv[]) :
     option(u"dump", 'd');
     help(u"dump", u"Dump the content of all differing packets.");
 
+    option(u"fast");
+    help(u"fast",
+         u"Use a fast byte-level comparison engine. "
+         u"The files are memory-mapped (when the operating system supports it) and compared in large windows, "
+         u"only dropping to a per-packet diagnosis around differing areas. "
+         u"This engine directly compares raw 188-byte packets. It cannot be used on other file formats, "
+         u"on the standard input, or with options which modify the packet comparison.");
+
     option(u"min-reorder", 'm', POSITIVE);
     help(u"min-reorder", u"count",
          u"With --search-reorder, this is the minimum number of consecutive packets to consider in reordered sequences of packets. "
@@ -139,6 +160,7 @@ ts::TSCompareOptions::TSCompareOptions(int argc, char *argv[]) :
     getIntValue(threshold_diff, u"threshold-diff", 0);
     getIntValue(min_reorder, u"min-reorder", std::min<size_t>(DEFAULT_MIN_REORDER, buffered_packets));
     search_reorder = present(u"subset") || present(u"search-reorder");
+    fast = present(u"fast");
     payload_only = present(u"payload-only");
     pcr_ignore = present(u"pcr-ignore");
     pid_ignore = present(u"pid-ignore");
@@ -155,6 +177,15 @@ ts::TSCompareOptions::TSCompareOptions(int argc, char *argv[]) :
     if (json.useFile() && normalized) {
         error(u"options --json and --normalized are mutually exclusive");
     }
+    if (fast && (search_reorder || payload_only || pcr_ignore || pid_ignore || cc_ignore)) {
+        error(u"--fast is incompatible with options which modify the packet comparison");
+    }
+    if (fast && format != TSPacketFormat::AUTODETECT && format != TSPacketFormat::TS) {
+        error(u"--fast only supports files of raw 188-byte TS packets");
+    }
+    if (fast && (filename0.empty() || filename0 == u"-" || filename1.empty() || filename1 == u"-")) {
+        error(u"--fast cannot read from the standard input");
+    }
     if (quiet) {
         setMaxSeverity(Severity::Info);
     }
@@ -270,6 +301,136 @@ void ts::PacketComparator::compare(const uint8_t* mem1, size_t size1, const uint
 }
 
 
+//----------------------------------------------------------------------------
+// One file in the fast comparison engine (--fast).
+//----------------------------------------------------------------------------
+
+namespace ts {
+    class FastFile
+    {
+        TS_NOBUILD_NOCOPY(FastFile);
+    public:
+        // Constructor and destructor, open and optionally map the file.
+        FastFile(TSCompareOptions& opt, const UString& filename);
+        ~FastFile();
+
+        // Check that the file was successfully open. Errors are already reported.
+        bool valid() const { return _valid; }
+
+        // File name and size in bytes, excluding the initial --byte-offset.
+        UString fileName() const { return _filename; }
+        uint64_t size() const { return _size; }
+
+        // Return the address of a window of the file, size bytes at the given offset
+        // after --byte-offset. The windows must be requested in sequential order.
+        // Return a pointer inside the memory mapping or inside an internal buffer.
+        // Return a null pointer on read error (already reported).
+        const uint8_t* window(uint64_t offset, size_t size);
+
+    private:
+        TSCompareOptions& _opt;
+        UString           _filename;
+        uint64_t          _size = 0;       // usable size, after --byte-offset
+        bool              _valid = false;
+        std::ifstream     _stream {};      // buffered input, when the file cannot be mapped
+        ByteBlock         _buffer {};      // read buffer for _stream
+#if !defined(TS_WINDOWS)
+        uint8_t*          _base = nullptr; // memory mapping of the complete file
+        uint64_t          _map_size = 0;   // total mapped size, including the initial offset
+#endif
+    };
+}
+
+
+// Constructor of one fast file, open and optionally map the file.
+ts::FastFile::FastFile(TSCompareOptions& opt, const UString& filename) :
+    _opt(opt),
+    _filename(filename)
+{
+#if !defined(TS_WINDOWS)
+    // Try to map the complete file in memory first.
+    const fs::path path(filename);
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        _opt.error(u"cannot open %s: %s", filename, SysErrorCodeMessage());
+        return;
+    }
+    struct ::stat st;
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void* const base = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (base != MAP_FAILED) {
+            _base = reinterpret_cast<uint8_t*>(base);
+            _map_size = uint64_t(st.st_size);
+            _size = _map_size - std::min(_map_size, _opt.byte_offset);
+            // Declare the global sequential pattern, the kernel enlarges its readahead.
+            ::madvise(_base, size_t(_map_size), MADV_SEQUENTIAL);
+            _valid = true;
+        }
+        else {
+            _opt.debug(u"mmap failed on %s, using buffered reads: %s", filename, SysErrorCodeMessage());
+        }
+    }
+    // The mapping remains valid after closing the descriptor.
+    ::close(fd);
+    if (_valid) {
+        return;
+    }
+#endif
+
+    // Portable fallback: buffered reads in large windows.
+    _stream.open(fs::path(filename), std::ios::in | std::ios::binary);
+    if (!_stream) {
+        _opt.error(u"cannot open %s", filename);
+        return;
+    }
+    _stream.seekg(0, std::ios::end);
+    const uint64_t file_size = uint64_t(std::streamoff(_stream.tellg()));
+    _size = file_size - std::min(file_size, _opt.byte_offset);
+    _stream.seekg(std::streamoff(std::min<uint64_t>(_opt.byte_offset, file_size)));
+    _valid = !_stream.fail();
+    if (!_valid) {
+        _opt.error(u"error seeking %s", filename);
+    }
+}
+
+
+// Destructor of one fast file.
+ts::FastFile::~FastFile()
+{
+#if !defined(TS_WINDOWS)
+    if (_base != nullptr) {
+        ::munmap(_base, size_t(_map_size));
+        _base = nullptr;
+    }
+#endif
+}
+
+
+// Return the address of a window of the file.
+const uint8_t* ts::FastFile::window(uint64_t offset, size_t size)
+{
+#if !defined(TS_WINDOWS)
+    if (_base != nullptr) {
+        const uint64_t start = _opt.byte_offset + offset;
+        // Trigger the read-ahead of the next window while this one is compared.
+        // The advised address must be aligned on a page boundary.
+        static const uint64_t page_mask = uint64_t(::sysconf(_SC_PAGESIZE)) - 1;
+        const uint64_t next = (start + size) & ~page_mask;
+        if (next < _map_size) {
+            ::madvise(_base + next, size_t(std::min<uint64_t>(size, _map_size - next)), MADV_WILLNEED);
+        }
+        return _base + start;
+    }
+#endif
+    _buffer.resize(size);
+    if (!_stream.read(reinterpret_cast<char*>(_buffer.data()), std::streamsize(size))) {
+        _opt.error(u"error reading %s", _filename);
+        return nullptr;
+    }
+    return _buffer.data();
+}
+
+
 //----------------------------------------------------------------------------
 // Context of one file to compare.
 //----------------------------------------------------------------------------
@@ -507,16 +668,36 @@ namespace ts {
         bool success = false;
 
     private:
+        // Final statistics of one file, for displayFinal().
+        struct FileSummary {
+            PacketCounter packets = 0;
+            PacketCounter missing = 0;
+            PacketCounter holes = 0;
+        };
+
         TSCompareOptions& _opt;
-        FileToCompare     _file0;
-        FileToCompare     _file1;
+        std::unique_ptr<FileToCompare> _file0 {};
+        std::unique_ptr<FileToCompare> _file1 {};
+        UString           _name0 {};
+        UString           _name1 {};
+        FileSummary       _sum0 {};
+        FileSummary       _sum1 {};
         json::Object      _jroot {};
         PacketCounter     _diff_count = 0;
 
+        // Standard packet-level comparison, using buffered TS file input.
+        void standardCompare();
+
+        // Fast byte-level comparison in memory-mapped windows (--fast).
+        void fastCompare();
+
         void displayHeader();
         void displayFinal();
-        void displayOneDifference(const PacketComparator& comp, PacketCounter index0, PacketCounter index1);
-        void displayTruncated(size_t file_index, const FileToCompare& file);
+        void displayOneDifference(const PacketComparator& comp,
+                                  PacketCounter index0, PacketCounter index1,
+                                  const TSPacket& pkt0, const TSPacket& pkt1,
+                                  PacketCounter index_in_pid0, PacketCounter index_in_pid1);
+        void displayTruncated(size_t file_index, PacketCounter packets);
         void displayMissingChunk(size_t ref_file_index, FileToCompare& ref_file,
                                  size_t miss_file_index, FileToCompare& miss_file);
         void displayReorder(size_t file0_index, const FileToCompare& file0, PacketCounter packet_index0,
@@ -528,12 +709,29 @@ namespace ts {
 
 // File comparator constructor.
 ts::FileComparator::FileComparator(TSCompareOptions& opt) :
-    _opt(opt),
-    _file0(_opt, _opt.filename0),
-    _file1(_opt, _opt.filename1)
+    _opt(opt)
 {
+    if (_opt.fast) {
+        fastCompare();
+    }
+    else {
+        standardCompare();
+    }
+}
+
+
+// Standard packet-level comparison, using buffered TS file input.
+void ts::FileComparator::standardCompare()
+{
+    _file0 = std::make_unique<FileToCompare>(_opt, _opt.filename0);
+    _file1 = std::make_unique<FileToCompare>(_opt, _opt.filename1);
+    FileToCompare& file0(*_file0);
+    FileToCompare& file1(*_file1);
+    _name0 = file0.fileName();
+    _name1 = file1.fileName();
+
     // No need to go further if at least one file is on error or empty.
-    if (_file0.eof() || _file1.eof()) {
+    if (file0.eof() || file1.eof()) {
         return;
     }
 
@@ -541,79 +739,173 @@ ts::FileComparator::FileComparator(TSCompareOptions& opt) :
 
     // Read and compare all packets in the files.
     // Stop at first difference in quiet mode (only report if equal) or not --continue.
-    while (!_file0.eof() && !_file1.eof() && (_diff_count == 0 || (!_opt.quiet && _opt.continue_all))) {
-        const PacketComparator comp(_file0.packet(), _file1.packet(), _opt);
+    while (!file0.eof() && !file1.eof() && (_diff_count == 0 || (!_opt.quiet && _opt.continue_all))) {
+        const PacketComparator comp(file0.packet(), file1.packet(), _opt);
         if (comp.equal) {
             // Current packets are identical.
-            displayMissingChunk(0, _file0, 1, _file1);
-            displayMissingChunk(1, _file1, 0, _file0);
-            _file0.moveNext();
-            _file1.moveNext();
+            displayMissingChunk(0, file0, 1, file1);
+            displayMissingChunk(1, file1, 0, file0);
+            file0.moveNext();
+            file1.moveNext();
         }
         else if (_opt.search_reorder) {
             // Start a deep comparison in the internal buffers. Make sure that they are full.
-            _file0.fillBuffer();
-            _file1.fillBuffer();
+            file0.fillBuffer();
+            file1.fillBuffer();
             PacketCounter index0 = 0;
             PacketCounter index1 = 0;
             PacketCounter count0 = 0;
             PacketCounter count1 = 0;
-            const bool moved0 = _file0.findPackets(_file1, index1, count1);
-            const bool moved1 = _file1.findPackets(_file0, index0, count0);
+            const bool moved0 = file0.findPackets(file1, index1, count1);
+            const bool moved1 = file1.findPackets(file0, index0, count0);
             if (!moved0) {
-                // The current packet in _file0 is not found in _file1 buffer, consider it as lost.
-                _file0.startMissingArea();
-                _file0.moveNext();
+                // The current packet in file0 is not found in file1 buffer, consider it as lost.
+                file0.startMissingArea();
+                file0.moveNext();
             }
             if (!moved1) {
-                // The current packet in _file1 is not found in _file0 buffer, consider it as lost.
-                _file1.startMissingArea();
-                _file1.moveNext();
+                // The current packet in file1 is not found in file0 buffer, consider it as lost.
+                file1.startMissingArea();
+                file1.moveNext();
             }
             if (moved0 && moved1) {
                 // No missing packet, both sides are found re-ordered.
-                const PacketCounter start0 = _file0.packetIndex();
-                const PacketCounter start1 = _file1.packetIndex();
+                const PacketCounter start0 = file0.packetIndex();
+                const PacketCounter start1 = file1.packetIndex();
                 if (index0 >= start0 + count1 && index1 >= start1 + count0) {
                     // Disjoint re-ordered sets of packets, report them both.
-                    displayReorder(0, _file0, start0, 1, _file1, index1, count1);
-                    _file0.ignore(start0, count1);
-                    _file1.ignore(index1, count1);
-                    displayReorder(1, _file1, start1, 0, _file0, index0, count0);
-                    _file0.ignore(index0, count0);
-                    _file1.ignore(start1, count0);
+                    displayReorder(0, file0, start0, 1, file1, index1, count1);
+                    file0.ignore(start0, count1);
+                    file1.ignore(index1, count1);
+                    displayReorder(1, file1, start1, 0, file0, index0, count0);
+                    file0.ignore(index0, count0);
+                    file1.ignore(start1, count0);
                 }
                 else if (count1 >= count0) {
                     // Overlapped sets of packets, they cannot be really reordered packets.
-                    // The segment at beginning of _file0 is larger than the segment at beginning of _file1, use this one only.
-                    displayReorder(0, _file0, start0, 1, _file1, index1, count1);
-                    _file0.ignore(start0, count1);
-                    _file1.ignore(index1, count1);
+                    // The segment at beginning of file0 is larger than the segment at beginning of file1, use this one only.
+                    displayReorder(0, file0, start0, 1, file1, index1, count1);
+                    file0.ignore(start0, count1);
+                    file1.ignore(index1, count1);
                 }
                 else {
-                    // The segment at beginning of _file1 is larger than the segment at beginning of _file0, use this one only.
-                    displayReorder(1, _file1, start1, 0, _file0, index0, count0);
-                    _file0.ignore(index0, count0);
-                    _file1.ignore(start1, count0);
+                    // The segment at beginning of file1 is larger than the segment at beginning of file0, use this one only.
+                    displayReorder(1, file1, start1, 0, file0, index0, count0);
+                    file0.ignore(index0, count0);
+                    file1.ignore(start1, count0);
                 }
             }
         }
         else {
             // Simply report a difference between packets.
-            displayOneDifference(comp, _file0.packetIndex(), _file1.packetIndex());
-            _file0.moveNext();
-            _file1.moveNext();
+            const PacketCounter index0 = file0.packetIndex();
+            const PacketCounter index1 = file1.packetIndex();
+            displayOneDifference(comp, index0, index1, file0.packet(), file1.packet(), file0.countInPID(index0), file1.countInPID(index1));
+            file0.moveNext();
+            file1.moveNext();
         }
     }
 
-    displayMissingChunk(0, _file0, 1, _file1);
-    displayMissingChunk(1, _file1, 0, _file0);
-    if (_file0.eof() && !_file1.eof()) {
-        displayTruncated(0, _file0);
+    displayMissingChunk(0, file0, 1, file1);
+    displayMissingChunk(1, file1, 0, file0);
+    if (file0.eof() && !file1.eof()) {
+        displayTruncated(0, file0.readPacketsCount());
+    }
+    else if (!file0.eof() && file1.eof()) {
+        displayTruncated(1, file1.readPacketsCount());
     }
-    else if (!_file0.eof() && _file1.eof()) {
-        displayTruncated(1, _file1);
+    _sum0 = {file0.readPacketsCount(), file0.missingPackets(), file0.missingChunks()};
+    _sum1 = {file1.readPacketsCount(), file1.missingPackets(), file1.missingChunks()};
+    displayFinal();
+
+    success = _diff_count == 0 && _opt.valid() && !_opt.gotErrors();
+}
+
+
+// Fast byte-level comparison in memory-mapped windows (--fast).
+void ts::FileComparator::fastCompare()
+{
+    FastFile file0(_opt, _opt.filename0);
+    FastFile file1(_opt, _opt.filename1);
+    if (!file0.valid() || !file1.valid()) {
+        return;
+    }
+    _name0 = file0.fileName();
+    _name1 = file1.fileName();
+
+    displayHeader();
+
+    // Number of complete packets in each file and in common. Trailing partial packets
+    // are ignored, as they are in the standard engine.
+    const PacketCounter packets0 = file0.size() / PKT_SIZE;
+    const PacketCounter packets1 = file1.size() / PKT_SIZE;
+    const PacketCounter common = std::min(packets0, packets1);
+
+    // Packet counters per PID, used to report the index in its PID of a differing packet.
+    std::vector<PacketCounter> by_pid0(PID_MAX, 0);
+    std::vector<PacketCounter> by_pid1(PID_MAX, 0);
+
+    PacketCounter index = 0;
+    bool aborted = false;  // stopped on a read error or after the first reported difference
+    while (index < common && !aborted) {
+        const size_t count = size_t(std::min<PacketCounter>(FAST_WINDOW_PACKETS, common - index));
+        const size_t size = count * PKT_SIZE;
+        const uint8_t* const win0 = file0.window(index * PKT_SIZE, size);
+        const uint8_t* const win1 = file1.window(index * PKT_SIZE, size);
+        if (win0 == nullptr || win1 == nullptr) {
+            aborted = true;
+        }
+        else if (index == 0 && (win0[0] != SYNC_BYTE || win1[0] != SYNC_BYTE)) {
+            _opt.error(u"--fast requires files of contiguous raw 188-byte TS packets");
+            return;
+        }
+        else if (MemEqual(win0, win1, size)) {
+            // The complete window is identical, just maintain the per-PID packet counters.
+            // The window is already in the CPU cache after the comparison, this is cheap.
+            for (size_t i = 0; i < size; i += PKT_SIZE) {
+                const PID pid = PID(GetUInt16(win0 + i + 1) & 0x1FFF);
+                by_pid0[pid]++;
+                by_pid1[pid]++;
+            }
+        }
+        else {
+            // At least one packet differs, drop to a per-packet diagnosis inside the window.
+            for (size_t i = 0; i < count && !aborted; i++) {
+                const uint8_t* const p0 = win0 + i * PKT_SIZE;
+                const uint8_t* const p1 = win1 + i * PKT_SIZE;
+                const PID pid0 = PID(GetUInt16(p0 + 1) & 0x1FFF);
+                const PID pid1 = PID(GetUInt16(p1 + 1) & 0x1FFF);
+                if (!MemEqual(p0, p1, PKT_SIZE)) {
+                    // Use the same comparison logic as the standard engine (null packets
+                    // with differing content are not reported as different, for instance).
+                    TSPacket pkt0;
+                    TSPacket pkt1;
+                    MemCopy(pkt0.b, p0, PKT_SIZE);
+                    MemCopy(pkt1.b, p1, PKT_SIZE);
+                    const PacketComparator comp(pkt0, pkt1, _opt);
+                    if (!comp.equal) {
+                        displayOneDifference(comp, index + i, index + i, pkt0, pkt1, by_pid0[pid0], by_pid1[pid1]);
+                        aborted = _opt.quiet || !_opt.continue_all;
+                    }
+                }
+                by_pid0[pid0]++;
+                by_pid1[pid1]++;
+            }
+        }
+        index += count;
+    }
+
+    // Report a truncated file only when the common part was fully compared.
+    if (!aborted) {
+        if (packets0 < packets1) {
+            displayTruncated(0, packets0);
+        }
+        else if (packets1 < packets0) {
+            displayTruncated(1, packets1);
+        }
     }
+    _sum0 = {packets0, 0, 0};
+    _sum1 = {packets1, 0, 0};
     displayFinal();
 
     success = _diff_count == 0 && _opt.valid() && !_opt.gotErrors();
@@ -624,11 +916,11 @@ ts::FileComparator::FileComparator(TSCompareOptions& opt) :
 void ts::FileComparator::displayHeader()
 {
     if (_opt.json.useJSON()) {
-        _jroot.query(u"files[0]", true).add(u"name", AbsoluteFilePath(_file0.fileName()));
-        _jroot.query(u"files[1]", true).add(u"name", AbsoluteFilePath(_file1.fileName()));
+        _jroot.query(u"files[0]", true).add(u"name", AbsoluteFilePath(_name0));
+        _jroot.query(u"files[1]", true).add(u"name", AbsoluteFilePath(_name1));
     }
     else if (!_opt.normalized && _opt.verbose() && !_opt.json.useFile()) {
-        std::cout << "* Comparing " << _file0.fileName() << " and " << _file1.fileName() << std::endl;
+        std::cout << "* Comparing " << _name0 << " and " << _name1 << std::endl;
     }
 }
 
@@ -638,39 +930,39 @@ void ts::FileComparator::displayFinal()
 {
     if (_opt.json.useJSON()) {
         json::Value& jv0(_jroot.query(u"files[0]"));
-        jv0.add(u"packets", _file0.readPacketsCount());
-        jv0.add(u"missing", _file0.missingPackets());
-        jv0.add(u"holes", _file0.missingChunks());
+        jv0.add(u"packets", _sum0.packets);
+        jv0.add(u"missing", _sum0.missing);
+        jv0.add(u"holes", _sum0.holes);
         json::Value& jv1(_jroot.query(u"files[1]"));
-        jv1.add(u"packets", _file1.readPacketsCount());
-        jv1.add(u"missing", _file1.missingPackets());
-        jv1.add(u"holes", _file1.missingChunks());
+        jv1.add(u"packets", _sum1.packets);
+        jv1.add(u"missing", _sum1.missing);
+        jv1.add(u"holes", _sum1.holes);
         _jroot.query(u"summary", true).add(u"differences", _diff_count);
     }
     if (_opt.normalized) {
-        std::cout << "file:file=1:filename=" << _file0.fileName()
-                  << ":packets=" << _file0.readPacketsCount()
-                  << ":missing=" << _file0.missingPackets()
-                  << ":holes=" << _file0.missingChunks()
+        std::cout << "file:file=1:filename=" << _name0
+                  << ":packets=" << _sum0.packets
+                  << ":missing=" << _sum0.missing
+                  << ":holes=" << _sum0.holes
                   << ":" << std::endl;
-        std::cout << "file:file=2:filename=" << _file1.fileName()
-                  << ":packets=" << _file1.readPacketsCount()
-                  << ":missing=" << _file1.missingPackets()
-                  << ":holes=" << _file1.missingChunks()
+        std::cout << "file:file=2:filename=" << _name1
+                  << ":packets=" << _sum1.packets
+                  << ":missing=" << _sum1.missing
+                  << ":holes=" << _sum1.holes
                   << ":" << std::endl;
         std::cout << "total:diff=" << _diff_count
                   << ":" << std::endl;
     }
     else if (_opt.verbose() && !_opt.json.useFile()) {
         std::cout << "* Found " << UString::Decimal(_diff_count) << " differences" << std::endl;
-        if (_file0.missingPackets() > 0) {
-            std::cout << "* " << _file0.fileName() << ", " << UString::Decimal(_file0.readPacketsCount()) << " packets, missing "
-                      << UString::Decimal(_file0.missingPackets()) << " packets in " << UString::Decimal(_file0.missingChunks()) << " holes"
+        if (_sum0.missing > 0) {
+            std::cout << "* " << _name0 << ", " << UString::Decimal(_sum0.packets) << " packets, missing "
+                      << UString::Decimal(_sum0.missing) << " packets in " << UString::Decimal(_sum0.holes) << " holes"
                       << std::endl;
         }
-        if (_file1.missingPackets() > 0) {
-            std::cout << "* " << _file1.fileName() << ", " << UString::Decimal(_file1.readPacketsCount()) << " packets, missing "
-                      << UString::Decimal(_file1.missingPackets()) << " packets in " << UString::Decimal(_file1.missingChunks()) << " holes"
+        if (_sum1.missing > 0) {
+            std::cout << "* " << _name1 << ", " << UString::Decimal(_sum1.packets) << " packets, missing "
+                      << UString::Decimal(_sum1.missing) << " packets in " << UString::Decimal(_sum1.holes) << " holes"
                       << std::endl;
         }
     }
@@ -681,16 +973,15 @@ void ts::FileComparator::displayFinal()
 
 
 // Report a difference in a packet.
-void ts::FileComparator::displayOneDifference(const PacketComparator& comp, PacketCounter index0, PacketCounter index1)
+void ts::FileComparator::displayOneDifference(const PacketComparator& comp,
+                                              PacketCounter index0, PacketCounter index1,
+                                              const TSPacket& pkt0, const TSPacket& pkt1,
+                                              PacketCounter index_in_pid0, PacketCounter index_in_pid1)
 {
     _diff_count++;
 
-    const TSPacket& pkt0(_file0.packet(index0));
-    const TSPacket& pkt1(_file1.packet(index1));
     const PID pid0 = pkt0.getPID();
     const PID pid1 = pkt1.getPID();
-    const PacketCounter index_in_pid0 = _file0.countInPID(index0);
-    const PacketCounter index_in_pid1 = _file1.countInPID(index1);
 
     if (_opt.json.useJSON()) {
         json::Value& jv(_jroot.query(u"events[]", true));
@@ -742,13 +1033,13 @@ void ts::FileComparator::displayOneDifference(const PacketComparator& comp, Pack
         }
         std::cout << " in PID" << std::endl;
         if (_opt.dump) {
-            std::cout << "  Packet from " << _file0.fileName() << ":" << std::endl;
+            std::cout << "  Packet from " << _name0 << ":" << std::endl;
             pkt0.display (std::cout, _opt.dump_flags, 6);
-            std::cout << "  Packet from " << _file1.fileName() << ":" << std::endl;
+            std::cout << "  Packet from " << _name1 << ":" << std::endl;
             pkt1.display (std::cout, _opt.dump_flags, 6);
-            std::cout << "  Differing area from " << _file0.fileName() << ":" << std::endl
+            std::cout << "  Differing area from " << _name0 << ":" << std::endl
                       << UString::Dump(pkt0.b + (_opt.payload_only ? pkt0.getHeaderSize() : 0) + comp.first_diff, comp.end_diff - comp.first_diff, _opt.dump_flags, 6)
-                      << "  Differing area from " << _file1.fileName() << ":" << std::endl
+                      << "  Differing area from " << _name1 << ":" << std::endl
                       << UString::Dump(pkt1.b + (_opt.payload_only ? pkt1.getHeaderSize() : 0) + comp.first_diff, comp.end_diff - comp.first_diff, _opt.dump_flags, 6);
         }
     }
@@ -756,19 +1047,20 @@ void ts::FileComparator::displayOneDifference(const PacketComparator& comp, Pack
 
 
 // Report a truncated file.
-void ts::FileComparator::displayTruncated(size_t file_index, const FileToCompare& file)
+void ts::FileComparator::displayTruncated(size_t file_index, PacketCounter packets)
 {
+    const UString& name(file_index == 0 ? _name0 : _name1);
     if (_opt.json.useJSON()) {
         json::Value& jv(_jroot.query(u"events[]", true));
         jv.add(u"type", u"truncated");
-        jv.add(u"packet", file.readPacketsCount());
+        jv.add(u"packet", packets);
         jv.add(u"file-index", file_index);
     }
     if (_opt.normalized) {
-        std::cout << "truncated:file=" << file_index << ":packet=" << file.readPacketsCount() << ":filename=" << file.fileName() << ":" << std::endl;
+        std::cout << "truncated:file=" << file_index << ":packet=" << packets << ":filename=" << name << ":" << std::endl;
     }
     else if (!_opt.quiet && !_opt.json.useFile()) {
-        std::cout << "* Packet " << UString::Decimal(file.readPacketsCount()) << ": file " << file.fileName() << " is truncated" << std::endl;
+        std::cout << "* Packet " << UString::Decimal(packets) << ": file " << name << " is truncated" << std::endl;
     }
     _diff_count++;
 }
@@ -19,6 +19,7 @@
 #include "tsDuckContext.h"
 #include "tsUDPReceiver.h"
 #include "tsIPProtocols.h"
+#include "tsHexDump.h"
 #include "tsArgs.h"
 TS_MAIN(MainCode);
 
@@ -185,17 +186,18 @@ namespace {
             }
         }
 
-        // Raw dump of file
+        // Raw dump of file, reading and formatting large chunks at a time.
+        // The chunk size is a multiple of the line size to preserve the line alignment.
         // Stop on output error (typically 'quit' in the pager).
-        ts::ByteBlock buffer(opt.raw_bpl);
+        ts::ByteBlock buffer(opt.raw_bpl * 4096);
         size_t offset = 0;
-        size_t size = 0;
-        int c = EOF;
-        while (*in && out) {
-            for (size = 0; size < buffer.size() && (c = in->get()) != EOF; size++) {
-                buffer[size] = uint8_t(c);
+        while (out) {
+            in->read(reinterpret_cast<char*>(buffer.data()), std::streamsize(buffer.size()));
+            const size_t size = size_t(in->gcount());
+            if (size == 0) {
+                break;
             }
-            out << ts::UString::Dump(buffer.data(), size, opt.raw_flags, 0, opt.raw_bpl, offset);
+            ts::HexDump(out, buffer.data(), size, opt.raw_flags, 0, opt.raw_bpl, offset);
             offset += size;
         }
     }
@@ -235,7 +237,7 @@ namespace {
                     << sender << " -> " << destination
                     << std::endl;
             }
-            out << ts::UString::Dump(buffer.data(), size, opt.raw_flags, 0, opt.raw_bpl);
+            ts::HexDump(out, buffer.data(), size, opt.raw_flags, 0, opt.raw_bpl);
         }
         sock.close(opt);
     }
@@ -36,6 +36,9 @@ namespace {
     // Stack size for execution of the client connection thread
     static constexpr size_t CLIENT_STACK_SIZE = 128 * 1024;
 
+    // Backlog of the server socket. Large SCS farms open many sessions in bursts.
+    static constexpr int SERVER_BACKLOG = 128;
+
     // Instantiation of a TCP connection in a multi-thread context for TLV messages.
     using ECMGConnection = ts::tlv::Connection<ts::ThreadSafety::Full>;
     using ECMGConnectionPtr = std::shared_ptr<ECMGConnection>;
@@ -291,6 +294,7 @@ private:
     ts::UString                 _peer {};
     std::optional<uint16_t>     _channel {};    // Current channel id.
     std::map<uint16_t,uint16_t> _streams {};    // Map of current stream id => ECM id.
+    ts::ByteBlockPtr            _ecmBin {};     // Reusable buffer for ECM serialization.
 
     // Handle the various ECMG client messages.
     bool handleChannelSetup(ts::ecmgscs::ChannelSetup* msg);
@@ -606,7 +610,10 @@ bool ECMGClientHandler::handleCWProvision(ts::ecmgscs::CWProvision* msg)
                 ecm.cw_odd = it->CW;
             }
             // In debug mode, display if CW has reduced entropy.
-            _shared->report().debug(u"incoming CW entropy: %s", it->CW.size() == ts::DVBCSA2::KEY_SIZE && ts::DVBCSA2::IsReducedCW(it->CW.data()) ? u"reduced" : u"not reduced");
+            // Do not even compute the entropy when debug is off, this is per-CW work on the fast path.
+            if (_shared->report().debug()) {
+                _shared->report().log(ts::Severity::Debug, u"incoming CW entropy: %s", it->CW.size() == ts::DVBCSA2::KEY_SIZE && ts::DVBCSA2::IsReducedCW(it->CW.data()) ? u"reduced" : u"not reduced");
+            }
         }
 
         // Add optional access criteria in ECM.
@@ -615,8 +622,14 @@ bool ECMGClientHandler::handleCWProvision(ts::ecmgscs::CWProvision* msg)
         }
 
         // Serialize the ECM section payload.
-        ts::ByteBlockPtr ecmBin(new ts::ByteBlock);
-        ts::tlv::Serializer serial(ecmBin);
+        // Reuse the session buffer, its content is copied into the section below.
+        if (_ecmBin == nullptr) {
+            _ecmBin = std::make_shared<ts::ByteBlock>();
+        }
+        else {
+            _ecmBin->clear();
+        }
+        ts::tlv::Serializer serial(_ecmBin);
         ecm.serialize(serial);
 
         // Compute the table id for the ECM, 0x80 or 0x81. There are two incompatible possibilities.
@@ -629,7 +642,7 @@ bool ECMGClientHandler::handleCWProvision(ts::ecmgscs::CWProvision* msg)
         const ts::TID tid = ts::TID(ts::TID_ECM_80 | (msg->CP_number & 0x01));
 
         // Build the ECM section.
-        ts::SectionPtr ecmSection(new ts::Section(tid, true, ecmBin->data(), ecmBin->size()));
+        ts::SectionPtr ecmSection(new ts::Section(tid, true, _ecmBin->data(), _ecmBin->size()));
 
         // Format ECM for the response message.
         if (_opt.channelStatus.section_TSpkt_flag) {
@@ -673,7 +686,7 @@ int MainCode(int argc, char *argv[])
     if (!server.open(opt.serverAddress.generation(), shared.report()) ||
         !server.reusePort(opt.reusePort, shared.report()) ||
         !server.bind(opt.serverAddress, shared.report()) ||
-        !server.listen(5, shared.report()))
+        !server.listen(SERVER_BACKLOG, shared.report()))
     {
         return EXIT_FAILURE;
     }
@@ -84,11 +84,17 @@ ts::EITMainOptions::EITMainOptions(int argc, char *argv[]) :
 
     cmd = cmdline.command(u"load", u"Load events from a file", u"filename", flags);
     cmd->option(u"", 0, FILENAME, 1, 1);
-    cmd->help(u"", u"A binary, XML or JSON file containing EIT sections.");
+    cmd->help(u"", u"A binary, XML or JSON file containing EIT sections. "
+                   u"The events are merged into the current EPG database. "
+                   u"Events which are identical to already loaded ones are ignored, so the file "
+                   u"can be a full snapshot or a delta, only new or modified events are processed.");
 
     cmd = cmdline.command(u"save", u"Save all current EIT sections in a file", u"filename", flags);
     cmd->option(u"", 0, FILENAME, 1, 1);
-    cmd->help(u"", u"Name of the output file receiving EIT sections in binary format.");
+    cmd->help(u"", u"Name of the output file receiving the EIT sections. "
+                   u"The format depends on the file name extension: .xml, .json, binary otherwise. "
+                   u"The binary format is the fastest to reload and is recommended to persist the "
+                   u"EPG database between sessions.");
 
     cmd = cmdline.command(u"process", u"Process a TS file with EIT generation", u"[options] infile outfile", flags);
     cmd->option(u"", 0, FILENAME, 2, 2);
@@ -357,9 +363,26 @@ ts::CommandStatus ts::EITCommand::load(const UString& command, Args& args)
 
 ts::CommandStatus ts::EITCommand::save(const UString& command, Args& args)
 {
+    const UString name(outputFileName(args.value(u"")));
     SectionFile file(_duck);
     _eit_gen.saveEITs(file);
-    return file.saveBinary(outputFileName(args.value(u""))) ? CommandStatus::SUCCESS : CommandStatus::ERROR;
+
+    // Select the output format from the file name extension, binary by default.
+    bool ok = false;
+    switch (GetSectionFileFormat(name)) {
+        case SectionFormat::XML:
+            ok = file.saveXML(name);
+            break;
+        case SectionFormat::JSON:
+            ok = file.saveJSON(name);
+            break;
+        case SectionFormat::BINARY:
+        case SectionFormat::UNSPECIFIED:
+        default:
+            ok = file.saveBinary(name);
+            break;
+    }
+    return ok ? CommandStatus::SUCCESS : CommandStatus::ERROR;
 }
 
 ts::CommandStatus ts::EITCommand::process(const UString& command, Args& args)
@@ -77,7 +77,7 @@ namespace {
         uint64_t              maxBytes = 0;              // Stop after injecting that number of bytes.
         ts::BitRate           dataBitrate = 0;           // Actual data bitrate.
         size_t                bytesPerSend = 0;          // Approximate size of each send.
-        cn::milliseconds      sendInterval {};           // Interval between two send operations.
+        cn::nanoseconds       sendInterval {};           // Interval between two send operations.
         cn::milliseconds      udpEndWait {};             // Number of ms to wait between last UDP message and stream close.
 
         // Adjust the various rates and delays according to the allocated bandwidth.
@@ -312,11 +312,11 @@ bool EMMGOptions::adjustBandwidth(uint16_t allocated)
     info(u"Target data bitrate: %'d b/s", dataBitrate);
 
     // Compute interval between two send operations in nanoseconds.
-    sendInterval = std::max(MIN_SEND_INTERVAL, ts::ByteInterval(dataBitrate, bytesPerSend));
+    sendInterval = std::max<cn::nanoseconds>(MIN_SEND_INTERVAL, ts::ByteInterval<cn::nanoseconds>(dataBitrate, bytesPerSend));
 
     // Make sure we can have that precision from the system if less than 100 ms.
     if (sendInterval < cn::milliseconds(100)) {
-        cn::milliseconds actualInterval = sendInterval;
+        cn::nanoseconds actualInterval = sendInterval;
         ts::SetTimersPrecision(actualInterval);
         if (actualInterval > sendInterval) {
             // Cannot get that precision from the system.
@@ -450,6 +450,11 @@ int MainCode(int argc, char *argv[])
     // This clock will be our reference.
     ts::monotonic_time currentTime(startTime);
 
+    // Preallocated buffers for the send operations. They are reused from one
+    // send to the next one, the allocated capacity remains stable.
+    ts::SectionPtrVector sections;
+    ts::TSPacketVector packets;
+
     // Send data as long as the maximum is not reached.
     bool ok = true;
     while (ok && client.totalBytes() < opt.maxBytes) {
@@ -488,7 +493,7 @@ int MainCode(int argc, char *argv[])
             // Build a set of data to send.
             if (opt.sectionMode) {
                 // Get complete sections from the section provider.
-                ts::SectionPtrVector sections;
+                sections.clear();
                 while (ok && sendSize < targetSendSize) {
                     // Get one section.
                     ts::SectionPtr sec;
@@ -507,7 +512,7 @@ int MainCode(int argc, char *argv[])
             else {
                 // Get TS packets from the packetizer.
                 sendSize = ts::round_up<uint64_t>(targetSendSize, ts::PKT_SIZE);
-                ts::TSPacketVector packets(size_t(sendSize / ts::PKT_SIZE));
+                packets.resize(size_t(sendSize / ts::PKT_SIZE));
                 for (size_t i = 0; ok && i < packets.size(); ++i) {
                     ok = packetizer.getNextPacket(packets[i]);
                     if (!ok) {
@@ -37,10 +37,15 @@ namespace ts {
         FileCleanOptions(int argc, char *argv[]);
         virtual ~FileCleanOptions() override;
 
-        DuckContext           duck {this};  // TSDuck execution context.
-        std::vector<fs::path> in_files {};  // Input file names.
-        fs::path              out_file {};  // Output file name or directory.
-        bool                  out_dir {};   // Output name is a directory.
+        DuckContext           duck {this};         // TSDuck execution context.
+        std::vector<fs::path> in_files {};         // Input file names.
+        fs::path              out_file {};         // Output file name or directory.
+        bool                  out_dir {};          // Output name is a directory.
+        bool                  single_pass {};      // Cleanup the files in one single pass.
+        size_t                buffered_packets {}; // Max buffered packets in single-pass mode.
+
+        // Default maximum number of buffered packets in single-pass mode.
+        static constexpr size_t DEFAULT_BUFFERED_PACKETS = 100'000;
     };
 }
 
@@ -50,19 +55,37 @@ ts::FileCleanOptions::FileCleanOptions(int argc, char *argv[]) :
     option(u"", 0, FILENAME, 0, UNLIMITED_COUNT);
     help(u"",
          u"MPEG transport stream input files to cleanup. "
-         u"All input files must be regular files (no pipe) since the processing is done on two passes. "
+         u"All input files must be regular files (no pipe) since the processing is done on two passes, "
+         u"unless --single-pass is specified. "
          u"If more than one file is specified, the output name shall specify a directory.");
 
+    option(u"buffered-packets", 0, POSITIVE);
+    help(u"buffered-packets",
+         u"With --single-pass, specify the maximum number of TS packets to buffer in memory "
+         u"while waiting for the complete signalization at the beginning of the file. "
+         u"The default is " + UString::Decimal(DEFAULT_BUFFERED_PACKETS) + u" packets.");
+
     option(u"output", 'o', FILENAME, 1, 1);
     help(u"output",
          u"Output file or directory. "
          u"This is a mandatory parameter, there is no default. "
          u"If more than one input file is specified, the output name shall specify a directory.");
 
+    option(u"single-pass", 's');
+    help(u"single-pass",
+         u"Cleanup the files in one single pass instead of two. "
+         u"The beginning of each file is buffered in memory until the signalization is complete, "
+         u"then the rest of the file is streamed through sequential reads and writes. "
+         u"This is faster on large files and allows non-seekable inputs such as pipes. "
+         u"However, tables which are updated later in the file are no longer merged into the "
+         u"initial signalization, they are output as versioned updates.");
+
     analyze(argc, argv);
 
     getPathValues(in_files, u"");
     getPathValue(out_file, u"output");
+    single_pass = present(u"single-pass");
+    getIntValue(buffered_packets, u"buffered-packets", DEFAULT_BUFFERED_PACKETS);
     out_dir = fs::is_directory(out_file);
 
     if (in_files.size() > 1 && !out_dir) {
@@ -128,17 +151,21 @@ namespace ts {
         using PIDMap = std::map<PID,PIDContext>;
 
         // File cleaner private fields:
-        bool              _success = true;
-        FileCleanOptions& _opt;
-        TSFile            _in_file {};
-        TSFile            _out_file {};
-        PAT               _pat {};
-        CyclingPacketizer _pat_pzer {_opt.duck, PID_PAT, CyclingPacketizer::StuffingPolicy::ALWAYS};
-        CAT               _cat {};
-        CyclingPacketizer _cat_pzer {_opt.duck, PID_CAT, CyclingPacketizer::StuffingPolicy::ALWAYS};
-        SDT               _sdt {};
-        CyclingPacketizer _sdt_pzer {_opt.duck, PID_SDT, CyclingPacketizer::StuffingPolicy::ALWAYS};
-        ServiceMap        _pmts {};
+        bool               _success = true;
+        bool               _streaming = false;  // Single-pass mode: the leading region was flushed, PSI updates are repacketized.
+        FileCleanOptions&  _opt;
+        TSFile             _in_file {};
+        TSFile             _out_file {};
+        PAT                _pat {};
+        CyclingPacketizer  _pat_pzer {_opt.duck, PID_PAT, CyclingPacketizer::StuffingPolicy::ALWAYS};
+        CAT                _cat {};
+        CyclingPacketizer  _cat_pzer {_opt.duck, PID_CAT, CyclingPacketizer::StuffingPolicy::ALWAYS};
+        SDT                _sdt {};
+        CyclingPacketizer  _sdt_pzer {_opt.duck, PID_SDT, CyclingPacketizer::StuffingPolicy::ALWAYS};
+        ServiceMap         _pmts {};
+        PIDMap             _pids {};
+        SignalizationDemux _sig {_opt.duck, this, {TID_PAT, TID_CAT, TID_PMT, TID_SDT_ACT}};
+        EITProcessor       _eit_proc {_opt.duck};
 
         // Implementation of SignalizationHandlerInterface:
         virtual void handlePAT(const PAT& pat, PID pid) override;
@@ -146,12 +173,28 @@ namespace ts {
         virtual void handleSDT(const SDT& sdt, PID pid) override;
         virtual void handlePMT(const PMT& pmt, PID pid) override;
 
+        // The two cleanup strategies. Files are already open.
+        void twoPassCleanup();
+        void singlePassCleanup();
+
+        // Build the PID contexts from the signalization which was analyzed so far.
+        void buildPIDContexts();
+
+        // Check if the leading region of the file is complete (single-pass mode).
+        bool leadingRegionComplete() const;
+
+        // Process one input packet and write it when appropriate.
+        void cleanupPacket(TSPacket& pkt);
+
         // Close and delete the output file, set error status.
         void errorCleanup();
 
         // Initialize a packetizer with one table and output the first cycle.
         void initCycle(AbstractLongTable& table, CyclingPacketizer& pzer);
 
+        // Replace the content of a packetizer with an updated table, with a new version.
+        void updateCycle(AbstractLongTable& table, CyclingPacketizer& pzer);
+
         // Write one packet.
         void writePacket(const TSPacket& pkt);
 
@@ -181,8 +224,12 @@ ts::FileCleaner::FileCleaner(FileCleanOptions& opt, const fs::path& infile_name)
     }
     _opt.verbose(u"cleaning %s -> %s", infile_name, outfile_name);
 
-    // Open the input file in rewindable mode.
-    if (!_in_file.openRead(infile_name, 0, _opt)) {
+    // Open the input file. In two-pass mode, the file must be rewindable.
+    // In single-pass mode, any sequential input is fine, including pipes.
+    const bool in_ok = _opt.single_pass ?
+        _in_file.openRead(infile_name, 1, 0, _opt) :
+        _in_file.openRead(infile_name, 0, _opt);
+    if (!in_ok) {
         errorCleanup();
         return;
     }
@@ -193,40 +240,160 @@ ts::FileCleaner::FileCleaner(FileCleanOptions& opt, const fs::path& infile_name)
         return;
     }
 
+    // Perform the cleanup.
+    if (_opt.single_pass) {
+        singlePassCleanup();
+    }
+    else {
+        twoPassCleanup();
+    }
+
+    // Close files (unless already closed by errorCleanup).
+    if (_in_file.isOpen()) {
+        _success = _in_file.close(_opt) && _success;
+    }
+    if (_out_file.isOpen()) {
+        _success = _out_file.close(_opt) && _success;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Default cleanup mode, in two passes over the input file.
+//----------------------------------------------------------------------------
+
+void ts::FileCleaner::twoPassCleanup()
+{
     // First pass: read all packets, process TS structure.
-    SignalizationDemux sig(_opt.duck, this, {TID_PAT, TID_CAT, TID_PMT, TID_SDT_ACT});
     TSPacket pkt;
     while (_success && _in_file.readPackets(&pkt, nullptr, 1, _opt) == 1) {
-        sig.feedPacket(pkt);
+        _sig.feedPacket(pkt);
     }
 
     // Build PID contexts for all component PID's of all services.
-    PIDMap pids;
+    buildPIDContexts();
+
+    // Rewind input file to prepare for second pass.
+    _success = _success && _in_file.rewind(_opt);
+
+    // Delete output file in case of error in first pass.
+    if (!_success) {
+        errorCleanup();
+        return;
+    }
+
+    // Process EIT's in the second pass: keep only EITp/f Actual for known services.
+    _eit_proc.removeOther();
+    _eit_proc.removeSchedule();
+    for (const auto& it : _pmts) {
+        _eit_proc.keepService(it.second->pmt.service_id);
+    }
+
+    // Start output file. First, issue a full cycle of each PSI/SI.
+    initCycle(_pat, _pat_pzer);
+    initCycle(_cat, _cat_pzer);
+    initCycle(_sdt, _sdt_pzer);
+    for (const auto& it : _pmts) {
+        initCycle(it.second->pmt, it.second->pzer);
+    }
+
+    // Second pass: read input file again, write output file.
+    while (_success && _in_file.readPackets(&pkt, nullptr, 1, _opt) == 1) {
+        cleanupPacket(pkt);
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Single-pass cleanup mode, the input file is read only once.
+//----------------------------------------------------------------------------
+
+void ts::FileCleaner::singlePassCleanup()
+{
+    // Process EIT's: keep only EITp/f Actual for known services.
+    _eit_proc.removeOther();
+    _eit_proc.removeSchedule();
+
+    // First phase: buffer the leading region of the file in memory until the
+    // signalization is complete: a PAT, all referenced PMT's and a start point
+    // (intra-frame or PUSI) on the video PID of each service.
+    TSPacketVector buffer;
+    TSPacket pkt;
+    bool complete = false;
+    while (_success && !complete && buffer.size() < _opt.buffered_packets && _in_file.readPackets(&pkt, nullptr, 1, _opt) == 1) {
+        _sig.feedPacket(pkt);
+        buffer.push_back(pkt);
+        complete = leadingRegionComplete();
+    }
+    if (!complete && buffer.size() >= _opt.buffered_packets) {
+        _opt.verbose(u"signalization still incomplete after %'d buffered packets, use --buffered-packets to buffer more", buffer.size());
+    }
+    _opt.debug(u"buffered %'d leading packets", buffer.size());
+
+    // Build PID contexts from the tables and start points of the leading region.
+    buildPIDContexts();
+    for (const auto& it : _pmts) {
+        _eit_proc.keepService(it.second->pmt.service_id);
+    }
+
+    // Start output file. First, issue a full cycle of each PSI/SI.
+    initCycle(_pat, _pat_pzer);
+    initCycle(_cat, _cat_pzer);
+    initCycle(_sdt, _sdt_pzer);
+    for (const auto& it : _pmts) {
+        initCycle(it.second->pmt, it.second->pzer);
+    }
+
+    // Replay the buffered packets through the same processing as the second pass
+    // of the two-pass mode, then release the buffer.
+    for (auto& bpkt : buffer) {
+        cleanupPacket(bpkt);
+    }
+    TSPacketVector().swap(buffer);
+
+    // Second phase: stream the rest of the file with sequential reads and writes.
+    // The demux keeps analyzing the packets to classify new PID's. From now on,
+    // PSI/SI updates can no longer be merged into the initial tables, they are
+    // repacketized with a new version.
+    _streaming = true;
+    while (_success && _in_file.readPackets(&pkt, nullptr, 1, _opt) == 1) {
+        _sig.feedPacket(pkt);
+        cleanupPacket(pkt);
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Build the PID contexts from the signalization which was analyzed so far.
+//----------------------------------------------------------------------------
+
+void ts::FileCleaner::buildPIDContexts()
+{
     for (const auto& svc : _pmts) {
         // Get first intra-frame and PTS.
         const PID vpid = svc.second->pmt.firstVideoPID(_opt.duck);
         if (vpid != PID_NULL) {
 
             // Build context for video PID.
-            auto& vctx(pids[vpid]);
+            auto& vctx(_pids[vpid]);
             vctx.pmt_pid = svc.first;
             vctx.video_pid = vpid;
 
             // Start passing video PID at first intra-frame.
-            vctx.start_packet = sig.intraFrameFirstIndex(vpid);
-            vctx.start_pts = sig.intraFrameFirstPTS(vpid);
-            vctx.start_cc = sig.intraFrameFirstCC(vpid);
+            vctx.start_packet = _sig.intraFrameFirstIndex(vpid);
+            vctx.start_pts = _sig.intraFrameFirstPTS(vpid);
+            vctx.start_cc = _sig.intraFrameFirstCC(vpid);
             if (vctx.start_packet == INVALID_PACKET_COUNTER) {
                 // No intra-frame detected (maybe an unknown codec), use first PUSI.
-                vctx.start_packet = sig.pusiFirstIndex(vpid);
-                vctx.start_pts = sig.pusiFirstPTS(vpid);
-                vctx.start_cc = sig.pusiFirstCC(vpid);
+                vctx.start_packet = _sig.pusiFirstIndex(vpid);
+                vctx.start_pts = _sig.pusiFirstPTS(vpid);
+                vctx.start_cc = _sig.pusiFirstCC(vpid);
             }
 
             // Build context for all other component PID's.
             for (const auto& st : svc.second->pmt.streams) {
                 if (st.first != vpid) {
-                    auto& ctx(pids[st.first]);
+                    auto& ctx(_pids[st.first]);
                     ctx.pmt_pid = svc.first;
                     ctx.video_pid = vpid;
                     ctx.start_pts = vctx.start_pts;
@@ -234,117 +401,120 @@ ts::FileCleaner::FileCleaner(FileCleanOptions& opt, const fs::path& infile_name)
             }
         }
     }
+}
 
-    // Rewind input file to prepare for second pass.
-    _success = _success && _in_file.rewind(_opt);
 
-    // Delete output file in case of error in first pass.
-    if (!_success) {
-        errorCleanup();
-        return;
-    }
+//----------------------------------------------------------------------------
+// Check if the leading region of the file is complete (single-pass mode).
+//----------------------------------------------------------------------------
 
-    // Process EIT's in the second pass: keep only EITp/f Actual for known services.
-    EITProcessor eit_proc(_opt.duck);
-    eit_proc.removeOther();
-    eit_proc.removeSchedule();
-    for (const auto& it : _pmts) {
-        eit_proc.keepService(it.second->pmt.service_id);
+bool ts::FileCleaner::leadingRegionComplete() const
+{
+    // Need a PAT and all PMT's it references.
+    if (!_pat.isValid() || _pat.pmts.empty()) {
+        return false;
     }
-
-    // Start output file. First, issue a full cycle of each PSI/SI.
-    initCycle(_pat, _pat_pzer);
-    initCycle(_cat, _cat_pzer);
-    initCycle(_sdt, _sdt_pzer);
-    for (const auto& it : _pmts) {
-        initCycle(it.second->pmt, it.second->pzer);
+    for (const auto& it : _pat.pmts) {
+        const auto svc = _pmts.find(it.second);
+        if (svc == _pmts.end() || !svc->second->pmt.isValid()) {
+            return false;
+        }
+        // Need a start point on the video PID of the service.
+        const PID vpid = svc->second->pmt.firstVideoPID(_opt.duck);
+        if (vpid != PID_NULL &&
+            _sig.intraFrameFirstIndex(vpid) == INVALID_PACKET_COUNTER &&
+            _sig.pusiFirstIndex(vpid) == INVALID_PACKET_COUNTER)
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    // Second pass: read input file again, write output file.
-    while (_success && _in_file.readPackets(&pkt, nullptr, 1, _opt) == 1) {
 
-        // Count input packets per PID.
-        const PacketCounter pkt_index = pids[pkt.getPID()].packets++;
+//----------------------------------------------------------------------------
+// Process one input packet and write it when appropriate.
+//----------------------------------------------------------------------------
 
-        // Process EIT's. The packet may be nullified (some EIT's are removed).
-        eit_proc.processPacket(pkt);
+void ts::FileCleaner::cleanupPacket(TSPacket& pkt)
+{
+    // Count input packets per PID.
+    const PacketCounter pkt_index = _pids[pkt.getPID()].packets++;
 
-        const PID pid = pkt.getPID();
-        const PIDClass pid_class = sig.pidClass(pid);
-        auto& pctx(pids[pid]);
+    // Process EIT's. The packet may be nullified (some EIT's are removed).
+    _eit_proc.processPacket(pkt);
 
-        if (pid == PID_PAT) {
-            pctx.hold = false;
-            writeFromPacketizer(_pat_pzer);
-        }
-        else if (pid == PID_CAT) {
-            pctx.hold = false;
-            writeFromPacketizer(_cat_pzer);
-        }
-        else if (pid == PID_SDT) {
+    const PID pid = pkt.getPID();
+    const PIDClass pid_class = _sig.pidClass(pid);
+    auto& pctx(_pids[pid]);
+
+    if (pid == PID_PAT) {
+        pctx.hold = false;
+        writeFromPacketizer(_pat_pzer);
+    }
+    else if (pid == PID_CAT) {
+        pctx.hold = false;
+        writeFromPacketizer(_cat_pzer);
+    }
+    else if (pid == PID_SDT) {
+        pctx.hold = false;
+        writeFromPacketizer(_sdt_pzer);
+    }
+    else if (pid == PID_EIT || pid_class == PIDClass::ECM || pid_class == PIDClass::EMM || pid_class == PIDClass::PCR_ONLY) {
+        // Write these packets transparently.
+        pctx.hold = false;
+        writePacket(pkt);
+    }
+    else if (pid_class == PIDClass::PSI && _pmts.contains(pid)) {
+        pctx.hold = false;
+        writeFromPacketizer(_pmts[pid]->pzer);
+    }
+    else if (pid_class == PIDClass::VIDEO) {
+        // Write these packets transparently after the first intra-frame (or after first PUSI if none detected).
+        if (pctx.hold && pkt.getPUSI() && (pctx.start_packet == INVALID_PACKET_COUNTER || pkt_index >= pctx.start_packet)) {
             pctx.hold = false;
-            writeFromPacketizer(_sdt_pzer);
+            _opt.debug(u"releasing video PID %n, PTS %'d (%s)", pid, pctx.start_pts, pctx.start_pts == INVALID_PTS ? u"invalid" : u"valid");
         }
-        else if (pid == PID_EIT || pid_class == PIDClass::ECM || pid_class == PIDClass::EMM || pid_class == PIDClass::PCR_ONLY) {
-            // Write these packets transparently.
-            pctx.hold = false;
+        if (!pctx.hold) {
             writePacket(pkt);
         }
-        else if (pid_class == PIDClass::PSI && _pmts.contains(pid)) {
-            pctx.hold = false;
-            writeFromPacketizer(_pmts[pid]->pzer);
-        }
-        else if (pid_class == PIDClass::VIDEO) {
-            // Write these packets transparently after the first intra-frame (or after first PUSI if none detected).
-            if (pctx.hold && pkt.getPUSI() && (pctx.start_packet == INVALID_PACKET_COUNTER || pkt_index >= pctx.start_packet)) {
-                pctx.hold = false;
-                _opt.debug(u"releasing video PID %n, PTS %'d (%s)", pid, pctx.start_pts, pctx.start_pts == INVALID_PTS ? u"invalid" : u"valid");
-            }
-            if (!pctx.hold) {
-                writePacket(pkt);
-            }
-        }
-        else if (pid_class == PIDClass::AUDIO || pid_class == PIDClass::SUBTITLES || pid_class == PIDClass::DATA) {
-            // Write these packets transparently after the start PTS for that PID.
-            if (pctx.hold && pkt.getPUSI()) {
-                // We are in the initial hold period and we got a PUSI packet. Check its PTS.
-                const uint64_t pts = pkt.getPTS();
-                if (pts == INVALID_PTS || pctx.start_pts == INVALID_PTS) {
-                    // No PTS detected in this PID. Start passing it after video.
-                    pctx.hold = pids[pctx.video_pid].hold;
-                    if (!pctx.hold) {
-                        _opt.debug(u"releasing %s PID %n, associated video PID %d, no PTS found", PIDClassEnum().name(pid_class), pid, pctx.video_pid);
-                    }
-                }
-                else if (SequencedPTS(pctx.start_pts, pts)) {
-                    // Passed the video start PTS -> start passing audio or
-                    pctx.hold = false;
-                    _opt.debug(u"releasing %s PID %n, associated video PID %d, PTS %'d (%s)", PIDClassEnum().name(pid_class), pid, pctx.video_pid, pts, pts == INVALID_PTS ? u"invalid" : u"valid");
+    }
+    else if (pid_class == PIDClass::AUDIO || pid_class == PIDClass::SUBTITLES || pid_class == PIDClass::DATA) {
+        // Write these packets transparently after the start PTS for that PID.
+        if (pctx.hold && pkt.getPUSI()) {
+            // We are in the initial hold period and we got a PUSI packet. Check its PTS.
+            const uint64_t pts = pkt.getPTS();
+            if (pts == INVALID_PTS || pctx.start_pts == INVALID_PTS) {
+                // No PTS detected in this PID. Start passing it after video.
+                pctx.hold = _pids[pctx.video_pid].hold;
+                if (!pctx.hold) {
+                    _opt.debug(u"releasing %s PID %n, associated video PID %d, no PTS found", PIDClassEnum().name(pid_class), pid, pctx.video_pid);
                 }
             }
-            if (!pctx.hold) {
-                writePacket(pkt);
+            else if (SequencedPTS(pctx.start_pts, pts)) {
+                // Passed the video start PTS -> start passing audio or
+                pctx.hold = false;
+                _opt.debug(u"releasing %s PID %n, associated video PID %d, PTS %'d (%s)", PIDClassEnum().name(pid_class), pid, pctx.video_pid, pts, pts == INVALID_PTS ? u"invalid" : u"valid");
             }
         }
-
-        // If the PID is identified in a service but still on hold and contains a PCR, write the PCR.
-        if (pctx.hold && pkt.hasPCR() && (pid_class == PIDClass::VIDEO || pid_class == PIDClass::AUDIO)) {
-            // Erase the payload, only keep the PCR in adaptation fields.
-            MemSet(pkt.getPayload(), 0xFF, pkt.getPayloadSize());  // overwrite payload content
-            pkt.b[3] &= ~0x10; // clear payload existence
-            pkt.b[4] = 183; // extend adaptation field to end of packet
-            if (pctx.start_cc != INVALID_CC) {
-                // Set CC to previous value before start packet.
-                pkt.setCC(pctx.start_cc + CC_MAX - 1);
-            }
+        if (!pctx.hold) {
             writePacket(pkt);
-            _opt.debug(u"passing PCR-only packet on %s PID %n, associated video PID %d", PIDClassEnum().name(pid_class), pid, pctx.video_pid);
         }
     }
 
-    // Close files.
-    _success = _in_file.close(_opt) && _success;
-    _success = _out_file.close(_opt) && _success;
+    // If the PID is identified in a service but still on hold and contains a PCR, write the PCR.
+    if (pctx.hold && pkt.hasPCR() && (pid_class == PIDClass::VIDEO || pid_class == PIDClass::AUDIO)) {
+        // Erase the payload, only keep the PCR in adaptation fields.
+        MemSet(pkt.getPayload(), 0xFF, pkt.getPayloadSize());  // overwrite payload content
+        pkt.b[3] &= ~0x10; // clear payload existence
+        pkt.b[4] = 183; // extend adaptation field to end of packet
+        if (pctx.start_cc != INVALID_CC) {
+            // Set CC to previous value before start packet.
+            pkt.setCC(pctx.start_cc + CC_MAX - 1);
+        }
+        writePacket(pkt);
+        _opt.debug(u"passing PCR-only packet on %s PID %n, associated video PID %d", PIDClassEnum().name(pid_class), pid, pctx.video_pid);
+    }
 }
 
 
@@ -394,6 +564,9 @@ void ts::FileCleaner::handlePAT(const PAT& pat, PID pid)
                 _success = false;
             }
         }
+        if (_streaming) {
+            updateCycle(_pat, _pat_pzer);
+        }
     }
 }
 
@@ -413,6 +586,9 @@ void ts::FileCleaner::handleCAT(const CAT& cat, PID pid)
         // Updated CAT, merge descriptors (don't duplicate existing ones).
         _opt.verbose(u"got CAT update, version %d", cat.version());
         _cat.descs.merge(_opt.duck, cat.descs);
+        if (_streaming) {
+            updateCycle(_cat, _cat_pzer);
+        }
     }
 }
 
@@ -443,6 +619,9 @@ void ts::FileCleaner::handleSDT(const SDT& sdt, PID pid)
                 cur->second.descs.merge(_opt.duck, it.second.descs);
             }
         }
+        if (_streaming) {
+            updateCycle(_sdt, _sdt_pzer);
+        }
     }
 }
 
@@ -457,8 +636,9 @@ void ts::FileCleaner::handlePMT(const PMT& pmt, PID pid)
 
     // Get or create service context for this PMT.
     auto& ctx(getServiceContext(pid));
+    const bool first = !ctx.pmt.isValid();
 
-    if (!ctx.pmt.isValid()) {
+    if (first) {
         // First PMT on this PID.
         ctx.pmt = pmt;
     }
@@ -478,6 +658,23 @@ void ts::FileCleaner::handlePMT(const PMT& pmt, PID pid)
             }
         }
     }
+
+    // In the streaming phase of the single-pass mode, repacketize the updated
+    // PMT with a new version. Components which appear in the middle of the
+    // file are passed without waiting for a start point, the hold logic only
+    // applies to the beginning of the file.
+    if (_streaming) {
+        for (const auto& it : ctx.pmt.streams) {
+            if (!_pids.contains(it.first)) {
+                _pids[it.first].hold = false;
+            }
+        }
+        updateCycle(ctx.pmt, ctx.pzer);
+        if (first) {
+            // New service in the middle of the file, keep its EIT's too.
+            _eit_proc.keepService(ctx.pmt.service_id);
+        }
+    }
 }
 
 
@@ -520,6 +717,19 @@ void ts::FileCleaner::initCycle(AbstractLongTable& table, CyclingPacketizer& pze
 }
 
 
+//----------------------------------------------------------------------------
+// Replace the content of a packetizer with an updated table, with a new version.
+//----------------------------------------------------------------------------
+
+void ts::FileCleaner::updateCycle(AbstractLongTable& table, CyclingPacketizer& pzer)
+{
+    table.setVersion((table.version() + 1) & SVERSION_MASK);
+    table.setCurrent(true);
+    pzer.removeAll();
+    pzer.addTable(_opt.duck, table);
+}
+
+
 //----------------------------------------------------------------------------
 // Write one packet.
 //----------------------------------------------------------------------------
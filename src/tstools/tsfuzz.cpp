@@ -14,6 +14,9 @@
 #include "tsDuckContext.h"
 #include "tsTSFuzzing.h"
 #include "tsTSFile.h"
+#include "tsTSForkPipe.h"
+#include "tsSystemRandomGenerator.h"
+#include "tsThread.h"
 TS_MAIN(MainCode);
 
 
@@ -33,6 +36,8 @@ namespace ts {
         std::vector<fs::path> in_files {};  // Input file names.
         fs::path              out_file {};  // Output file name or directory.
         bool                  out_dir {};   // Output name is a directory.
+        size_t                max_jobs = 1; // Maximum number of parallel threads.
+        UString               validate {};  // Validation command, receives each fuzzed stream on stdin.
         ts::TSFuzzingArgs     fuzz {};      // Fuzzing options.
     };
 }
@@ -45,24 +50,63 @@ ts::FuzzOptions::FuzzOptions(int argc, char *argv[]) :
     option(u"", 0, FILENAME, 0, UNLIMITED_COUNT);
     help(u"",
          u"MPEG transport stream input files to corrupt. "
-         u"If more than one file is specified, the output name shall specify a directory.");
+         u"If more than one file is specified, the output name shall specify a directory. "
+         u"With more than one input file, a distinct seed is derived from the master seed "
+         u"and the index of each file, so that the result for each file is reproducible "
+         u"with --seed, regardless of --parallel.");
 
-    option(u"output", 'o', FILENAME, 1, 1);
+    option(u"output", 'o', FILENAME);
     help(u"output",
          u"Output file or directory. "
-         u"This is a mandatory parameter, there is no default. "
+         u"This parameter is mandatory, unless --validate is specified. "
          u"If more than one input file is specified, the output name shall specify a directory.");
 
+    option(u"parallel", 'p', POSITIVE, 0, 1, 0, 0, true);
+    help(u"parallel", u"count",
+         u"Process the input files in parallel, using several threads. "
+         u"The files are dispatched on the threads in their order on the command line. "
+         u"Each file is processed in one single thread, with its own fuzzing state. "
+         u"The optional value is the maximum number of threads. "
+         u"The default is the number of logical processors in the system.");
+
+    option(u"validate", 0, STRING);
+    help(u"validate", u"'command'",
+         u"Pipe each fuzzed stream to the specified command, without writing an intermediate file. "
+         u"The fuzzed transport stream is piped to the standard input of the command and the name "
+         u"of the original input file is appended as the last argument. "
+         u"If the command exits with a non-zero status, tsfuzz reports the failure and exits with "
+         u"an error code at the end of the run. "
+         u"With --validate, --output is optional.");
+
     analyze(argc, argv);
 
     fuzz.loadArgs(duck, *this);
     getPathValues(in_files, u"");
     getPathValue(out_file, u"output");
-    out_dir = fs::is_directory(out_file);
+    getValue(validate, u"validate");
+    out_dir = !out_file.empty() && fs::is_directory(out_file);
 
-    if (in_files.size() > 1 && !out_dir) {
+    // The --parallel option has an optional value. If present without value, use the number of processors.
+    max_jobs = present(u"parallel") ? intValue<size_t>(u"parallel", std::max<size_t>(1, std::thread::hardware_concurrency())) : 1;
+
+    if (out_file.empty() && validate.empty()) {
+        error(u"specify at least one of --output and --validate");
+    }
+    if (in_files.size() > 1 && !out_file.empty() && !out_dir) {
         error(u"the output name must be a directory when more than one input file is specified");
     }
+
+    // With more than one input file, a distinct seed is derived for each file from the
+    // master seed and the file index. Generate a random master seed now when none was
+    // specified, so that the derived seeds do not depend on threads scheduling.
+    if (fuzz.seed.empty() && in_files.size() > 1) {
+        SystemRandomGenerator sysrng;
+        if (!sysrng.readByteBlock(fuzz.seed, Xoshiro256ss::MIN_SEED_SIZE)) {
+            error(u"error generating random seed");
+        }
+        verbose(u"fuzzing master seed: %s", UString::Dump(fuzz.seed, UString::COMPACT));
+    }
+
     exitOnError();
 }
 
@@ -72,61 +116,165 @@ ts::FuzzOptions::~FuzzOptions()
 
 
 //----------------------------------------------------------------------------
-// Program entry point.
+//  Process one input file.
 //----------------------------------------------------------------------------
 
-int MainCode(int argc, char *argv[])
-{
-    ts::FuzzOptions opt(argc, argv);
-    ts::TSFuzzing fuzzer(opt.duck);
-    bool success = true;
-
-    // Process input files one by one.
-    for (const auto& infile_name : opt.in_files) {
+namespace {
+    bool ProcessFile(ts::FuzzOptions& opt, ts::TSFuzzing& fuzzer, size_t index)
+    {
+        const fs::path& infile_name(opt.in_files[index]);
         opt.verbose(u"Fuzzing %s", infile_name);
 
         // Open input file.
         ts::TSFile infile;
         if (!infile.openRead(infile_name, 0, opt)) {
-            success = false;
-            continue;
+            return false;
         }
 
-        // Output file name.
-        fs::path outfile_name(opt.out_file);
-        if (opt.out_dir) {
-            // Output name is a directory.
-            outfile_name /= infile_name.filename();
+        // Derive a distinct reproducible seed for this file.
+        ts::TSFuzzingArgs fuzz(opt.fuzz);
+        if (opt.in_files.size() > 1) {
+            fuzz.seed.appendUInt32(uint32_t(index));
         }
 
-        // Create output file.
+        // Create the output file, unless the stream is only piped to a validation command.
         ts::TSFile outfile;
-        if (!outfile.open(outfile_name, ts::TSFile::WRITE, opt)) {
-            success = false;
-            continue;
+        if (!opt.out_file.empty()) {
+            fs::path outfile_name(opt.out_file);
+            if (opt.out_dir) {
+                // Output name is a directory.
+                outfile_name /= infile_name.filename();
+            }
+            if (!outfile.open(outfile_name, ts::TSFile::WRITE, opt)) {
+                return false;
+            }
         }
 
-        // Reinitialize the fuzzer.
-        if (!fuzzer.start(opt.fuzz)) {
-            success = false;
-            break; // won't work on other files either
+        // Create the validation process, receiving the fuzzed stream on its standard input.
+        ts::TSForkPipe pipe;
+        if (!opt.validate.empty()) {
+            ts::UString command;
+            command.format(u"%s \"%s\"", opt.validate, infile_name);
+            if (!pipe.open(command, ts::ForkPipe::SYNCHRONOUS, ts::PKT_SIZE * 1000, opt, ts::ForkPipe::KEEP_BOTH, ts::ForkPipe::STDIN_PIPE, ts::TSPacketFormat::TS)) {
+                return false;
+            }
         }
 
+        // Reinitialize the fuzzer for this file.
+        bool success = fuzzer.start(fuzz);
+
         // Process all packets.
         ts::TSPacketVector pkts(1000);
         size_t count = 0;
-        while ((count = infile.readPackets(pkts.data(), nullptr, pkts.size(), opt)) > 0) {
-            for (size_t i = 0; i < count; ++i) {
-                if (!fuzzer.processPacket(pkts[i])) {
-                    success = false;
-                    break;
-                }
+        while (success && (count = infile.readPackets(pkts.data(), nullptr, pkts.size(), opt)) > 0) {
+            for (size_t i = 0; success && i < count; ++i) {
+                success = fuzzer.processPacket(pkts[i]);
+            }
+            if (success && outfile.isOpen() && !outfile.writePackets(pkts.data(), nullptr, count, opt)) {
+                success = false;
             }
-            if (!outfile.writePackets(pkts.data(), nullptr, count, opt)) {
+            if (success && pipe.isOpen() && !pipe.writePackets(pkts.data(), nullptr, count, opt)) {
                 success = false;
-                break;
             }
         }
+
+        // Close everything and wait for the completion of the validation command.
+        infile.close(opt);
+        if (outfile.isOpen()) {
+            success = outfile.close(opt) && success;
+        }
+        if (pipe.isOpen()) {
+            success = pipe.close(opt) && success;
+            if (pipe.exitCode() != 0) {
+                opt.error(u"validation failed for %s, command exit code %d", infile_name, pipe.exitCode());
+                success = false;
+            }
+        }
+        return success;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+//  A thread which processes input files, with --parallel.
+//----------------------------------------------------------------------------
+
+namespace {
+    class FuzzerThread: public ts::Thread
+    {
+        TS_NOBUILD_NOCOPY(FuzzerThread);
+    public:
+        // Constructor. The file indexes and the global status are shared between all threads.
+        FuzzerThread(ts::FuzzOptions& opt, std::atomic<size_t>& next_file, std::atomic<bool>& success) :
+            _opt(opt),
+            _next_file(next_file),
+            _success(success)
+        {
+        }
+
+    protected:
+        // Thread main code.
+        virtual void main() override;
+
+    private:
+        ts::FuzzOptions&     _opt;
+        std::atomic<size_t>& _next_file;
+        std::atomic<bool>&   _success;
+    };
+}
+
+void FuzzerThread::main()
+{
+    // Each thread has its own execution context and fuzzing state, neither is thread-safe.
+    // The command line was already analyzed, loading the options only reads it.
+    ts::DuckContext duck(&_opt);
+    duck.loadArgs(_opt);
+    ts::TSFuzzing fuzzer(duck);
+
+    // Pick the input files one by one, in their order on the command line.
+    for (;;) {
+        const size_t index = _next_file.fetch_add(1);
+        if (index >= _opt.in_files.size()) {
+            break;
+        }
+        if (!ProcessFile(_opt, fuzzer, index)) {
+            _success = false;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Program entry point.
+//----------------------------------------------------------------------------
+
+int MainCode(int argc, char *argv[])
+{
+    ts::FuzzOptions opt(argc, argv);
+    bool success = true;
+
+    if (opt.max_jobs > 1 && opt.in_files.size() > 1) {
+        // Process the input files in parallel, using a pool of threads.
+        std::atomic<size_t> next_file(0);
+        std::atomic<bool> thread_success(true);
+        std::vector<std::unique_ptr<FuzzerThread>> threads;
+        const size_t thread_count = std::min(opt.max_jobs, opt.in_files.size());
+        threads.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads.push_back(std::make_unique<FuzzerThread>(opt, next_file, thread_success));
+            success = threads.back()->start() && success;
+        }
+        for (const auto& th : threads) {
+            th->waitForTermination();
+        }
+        success = success && thread_success;
+    }
+    else {
+        // Process input files one by one.
+        ts::TSFuzzing fuzzer(opt.duck);
+        for (size_t i = 0; i < opt.in_files.size(); ++i) {
+            success = ProcessFile(opt, fuzzer, i) && success;
+        }
     }
 
     return success ? EXIT_SUCCESS : EXIT_FAILURE;
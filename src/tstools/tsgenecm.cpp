@@ -6,7 +6,7 @@
 //
 //----------------------------------------------------------------------------
 //
-//  Generate one ECM using any DVB SimulCrypt compliant ECMG.
+//  Generate ECMs using any DVB SimulCrypt compliant ECMG.
 //
 //----------------------------------------------------------------------------
 
@@ -31,36 +31,58 @@ namespace {
     public:
         GenECMOptions(int argc, char *argv[]);
 
-        ts::DuckContext       duck {this};   // TSDuck execution context.
-        ts::ecmgscs::Protocol ecmgscs {};    // ECMG <=> SCS protocol instance.
-        ts::UString           outFile {};    // Name of binary output file.
-        ts::ECMGClientArgs    ecmg {};       // ECMG parameters
-        uint16_t              cpNumber = 0;  // Crypto-period number
-        ts::ByteBlock         cwCurrent {};  // Current CW
-        ts::ByteBlock         cwNext {};     // Next CW
+        ts::DuckContext       duck {this};      // TSDuck execution context.
+        ts::ecmgscs::Protocol ecmgscs {};       // ECMG <=> SCS protocol instance.
+        ts::UString           outFile {};       // Name of binary output file.
+        ts::ECMGClientArgs    ecmg {};          // ECMG parameters
+        uint16_t              cpNumber = 0;     // First crypto-period number
+        size_t                cpCount = 1;      // Number of crypto periods to generate ECMs for
+        size_t                requestAhead = 8; // Maximum number of ECM requests submitted in advance
+        std::vector<ts::ByteBlock> cws {};      // Control words for consecutive crypto periods
     };
 }
 
 GenECMOptions::GenECMOptions(int argc, char *argv[]) :
-    ts::Args(u"Generate one ECM using any DVB SimulCrypt compliant ECMG", u"[options] output-file")
+    ts::Args(u"Generate ECMs using any DVB SimulCrypt compliant ECMG", u"[options] output-file")
 {
     setIntro(u"This command connects to a DVB SimulCrypt compliant ECMG and requests "
-             u"the generation of one ECM. Restriction: The target ECMG shall support "
+             u"the generation of one ECM or of a batch of ECMs for consecutive crypto "
+             u"periods. Restriction: The target ECMG shall support "
              u"current or current/next control words in ECM, meaning CW_per_msg = 1 or 2 "
              u"and lead_CW = 0 or 1.");
 
     option(u"", 0, FILENAME, 1, 1);
-    help(u"", u"filename", u"Name of the binary output file which receives the ECM.");
+    help(u"", u"filename", u"Name of the binary output file which receives the ECM's.");
 
     option(u"cp-number", 0, UINT16);
-    help(u"cp-number", u"Crypto-period number. Default: 0.");
+    help(u"cp-number", u"First crypto-period number. Default: 0.");
 
-    option(u"cw-current", 'c', HEXADATA, 1, 1, 1);
-    help(u"cw-current", u"Current control word (required). The value must be a suite of hexadecimal digits.");
+    option(u"cp-count", 0, POSITIVE);
+    help(u"cp-count", u"count",
+         u"Number of consecutive crypto periods for which ECMs are generated, "
+         u"starting at --cp-number. Values greater than 1 require --cw-file. Default: 1.");
+
+    option(u"cw-current", 'c', HEXADATA, 0, 1, 1);
+    help(u"cw-current", u"Current control word. The value must be a suite of hexadecimal digits.");
 
     option(u"cw-next", 'n', HEXADATA, 0, 1, 1);
     help(u"cw-next", u"Next control word (optional). The value must be a suite of hexadecimal digits.");
 
+    option(u"cw-file", 0, FILENAME);
+    help(u"cw-file", u"filename",
+         u"Text file containing one control word per line, in hexadecimal digits, for "
+         u"consecutive crypto periods starting at --cp-number. Empty lines and lines "
+         u"starting with '#' are ignored. The file should contain one more control word "
+         u"than --cp-count so that each ECM carries its current and next control words; "
+         u"otherwise the last ECM carries its current control word only. "
+         u"Mutually exclusive with --cw-current and --cw-next.");
+
+    option(u"request-ahead", 0, POSITIVE);
+    help(u"request-ahead", u"count",
+         u"With --cp-count, maximum number of ECM requests which are submitted to the "
+         u"ECMG in advance. The requests for the next crypto periods are pipelined "
+         u"instead of waiting for each ECMG round trip. Default: 8.");
+
     // Common ECMG parameters.
     ecmg.defineArgs(*this);
 
@@ -71,8 +93,53 @@ GenECMOptions::GenECMOptions(int argc, char *argv[]) :
     ecmg.loadArgs(duck, *this);
     getValue(outFile, u"");
     getIntValue(cpNumber, u"cp-number", 0);
-    getHexaValue(cwCurrent, u"cw-current");
-    getHexaValue(cwNext, u"cw-next");
+    getIntValue(cpCount, u"cp-count", 1);
+    getIntValue(requestAhead, u"request-ahead", 8);
+
+    // Get the control words, one per crypto period, either from the command line or from a file.
+    if (present(u"cw-file")) {
+        if (present(u"cw-current") || present(u"cw-next")) {
+            error(u"--cw-current and --cw-next are mutually exclusive with --cw-file");
+        }
+        fs::path cwFile;
+        getPathValue(cwFile, u"cw-file");
+        ts::UStringVector lines;
+        if (ts::UString::Load(lines, cwFile)) {
+            for (auto& line : lines) {
+                line.trim();
+                if (!line.empty() && !line.starts_with(u"#")) {
+                    ts::ByteBlock cw;
+                    if (line.hexaDecode(cw)) {
+                        cws.push_back(cw);
+                    }
+                    else {
+                        error(u"invalid control word \"%s\" in %s", line, cwFile);
+                    }
+                }
+            }
+        }
+        else {
+            error(u"error loading %s", cwFile);
+        }
+        if (valid() && cws.size() < cpCount) {
+            error(u"only %d control words in %s, %d crypto periods requested", cws.size(), cwFile, cpCount);
+        }
+    }
+    else if (!present(u"cw-current")) {
+        error(u"--cw-current or --cw-file is required");
+    }
+    else if (cpCount > 1) {
+        error(u"--cp-count requires --cw-file");
+    }
+    else {
+        ts::ByteBlock cw;
+        getHexaValue(cw, u"cw-current");
+        cws.push_back(cw);
+        if (present(u"cw-next")) {
+            getHexaValue(cw, u"cw-next");
+            cws.push_back(cw);
+        }
+    }
 
     // Specify which ECMG <=> SCS version to use.
     ecmgscs.setVersion(ecmg.dvbsim_version);
@@ -130,6 +197,47 @@ namespace {
 }
 
 
+//----------------------------------------------------------------------------
+//  Collector of asynchronous ECM responses.
+//----------------------------------------------------------------------------
+
+namespace {
+    class ECMCollector: public ts::ECMGClientHandlerInterface
+    {
+        TS_NOCOPY(ECMCollector);
+    public:
+        // Constructor.
+        ECMCollector() = default;
+
+        // Invoked in the context of the receiver thread of the ECMG client.
+        virtual void handleECM(const ts::ecmgscs::ECMResponse& response) override
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _responses.insert(std::make_pair(response.CP_number, response));
+            _received.notify_all();
+        }
+
+        // Wait for the ECM of a given crypto period. Return false on timeout.
+        bool waitECM(uint16_t cp_number, cn::milliseconds timeout, ts::ecmgscs::ECMResponse& response)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (!_received.wait_for(lock, timeout, [this, cp_number]() { return _responses.contains(cp_number); })) {
+                return false;
+            }
+            const auto it = _responses.find(cp_number);
+            response = it->second;
+            _responses.erase(it);
+            return true;
+        }
+
+    private:
+        std::mutex _mutex {};
+        std::condition_variable _received {};
+        std::map<uint16_t, ts::ecmgscs::ECMResponse> _responses {};
+    };
+}
+
+
 //----------------------------------------------------------------------------
 //  Program entry point
 //----------------------------------------------------------------------------
@@ -153,23 +261,51 @@ int MainCode(int argc, char *argv[])
         return EXIT_FAILURE;
     }
 
-    // Request the ECM (synchronous operation).
-    ts::ecmgscs::ECMResponse response(opt.ecmgscs);
-    if (!ecmg.generateECM(opt.cpNumber, opt.cwCurrent, opt.cwNext, opt.ecmg.access_criteria, opt.ecmg.cp_duration, response)) {
-        ecmg.disconnect();
-        return EXIT_FAILURE;
+    // Timeout on each ECM response, same conservative formula as synchronous generation.
+    cn::milliseconds timeout = cn::milliseconds(2 * cn::milliseconds::rep(channelStatus.max_comp_time));
+    if (timeout < cn::seconds(5)) {
+        timeout = cn::seconds(5);
     }
 
-    // Disconnect from ECMG.
-    ecmg.disconnect();
-
-    // Get the ECM section from the ECMG response.
+    // Request the ECM's, pipelined several crypto periods in advance. The requests
+    // are submitted asynchronously, up to --request-ahead of them in flight, so that
+    // the ECMG processes the next crypto periods while previous responses are
+    // collected, instead of paying one full round trip per crypto period.
+    ECMCollector collector;
     ts::SectionFile ecmFile(opt.duck);
-    if (!ExtractECMs(opt, ecmFile, channelStatus, response)) {
-        // Malformed response, error message already reported
-        return EXIT_FAILURE;
+    size_t submitted = 0;
+    size_t collected = 0;
+    bool success = true;
+
+    while (success && collected < opt.cpCount) {
+
+        // Keep the request pipeline full.
+        while (success && submitted < opt.cpCount && submitted - collected < opt.requestAhead) {
+            const ts::ByteBlock& current(opt.cws[submitted]);
+            const ts::ByteBlock next(submitted + 1 < opt.cws.size() ? opt.cws[submitted + 1] : ts::ByteBlock());
+            success = ecmg.submitECM(uint16_t(opt.cpNumber + submitted), current, next, opt.ecmg.access_criteria, opt.ecmg.cp_duration, &collector);
+            submitted++;
+        }
+
+        // Collect the responses in crypto-period order.
+        if (success) {
+            const uint16_t cp = uint16_t(opt.cpNumber + collected);
+            ts::ecmgscs::ECMResponse response(opt.ecmgscs);
+            if (!collector.waitECM(cp, timeout, response)) {
+                opt.error(u"ECM generation timeout for crypto period %d", cp);
+                success = false;
+            }
+            else {
+                // Get the ECM sections from the ECMG response.
+                success = ExtractECMs(opt, ecmFile, channelStatus, response);
+            }
+            collected++;
+        }
     }
 
+    // Disconnect from ECMG.
+    ecmg.disconnect();
+
     // Save the binary file containing the ECM's.
-    return ecmFile.saveBinary(opt.outFile) ? EXIT_SUCCESS : EXIT_FAILURE;
+    return success && ecmFile.saveBinary(opt.outFile) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -36,6 +36,7 @@ namespace {
         // Option values
         bool                monitor = false;     // Run a resource monitoring thread in the background.
         ts::UString         monitor_config {};   // System monitoring configuration file.S
+        fs::path            monitor_json {};     // Append JSON monitoring snapshots to this file.
         ts::DuckContext     duck {this};         // TSDuck context
         ts::AsyncReportArgs log_args {};         // Asynchronous logger arguments.
         ts::TSProcessorArgs tsp_args {};         // TS processing arguments.
@@ -62,12 +63,19 @@ TSPOptions::TSPOptions(int argc, char *argv[]) :
          u"Useful to verify the stability of the application. "
          u"The optional file is an XML monitoring configuration file.");
 
+    option(u"monitor-json", 0, FILENAME);
+    help(u"monitor-json", u"filename",
+         u"With --monitor, append a monitoring snapshot to the specified file at each monitoring interval. "
+         u"Each snapshot is one JSON object on one line (JSON Lines format). "
+         u"It includes the virtual memory breakdown and, on Linux, the per-thread CPU usage.");
+
     // Analyze the command.
     analyze(argc, argv);
 
     // Load option values.
     monitor = present(u"monitor");
     getValue(monitor_config, u"monitor");
+    getPathValue(monitor_json, u"monitor-json");
     duck.loadArgs(*this);
     log_args.loadArgs(*this);
     tsp_args.loadArgs(duck, *this);
@@ -141,6 +149,10 @@ int MainCode(int argc, char *argv[])
 
     // Start the monitoring thread if required.
     if (opt.monitor) {
+        monitor.declareMemoryRegion(u"buffer", opt.tsp_args.ts_buffer_size);
+        if (!opt.monitor_json.empty()) {
+            monitor.setJsonFile(opt.monitor_json);
+        }
         monitor.start();
     }
 
@@ -18,6 +18,7 @@
 #include "tsOutputRedirector.h"
 #include "tsCyclingPacketizer.h"
 #include "tsSysUtils.h"
+#include "tsThread.h"
 TS_MAIN(MainCode);
 
 // To avoid long prefixes
@@ -45,6 +46,7 @@ namespace {
         ts::FileNameRateList  infiles {};          // Input file names and repetition rates
         ts::SectionFormat     inType = ts::SectionFormat::UNSPECIFIED;
         ts::SectionFileArgs   sections_opt {};     // Section file options
+        size_t                max_jobs = 1;        // Number of threads to load the input files
     };
 }
 
@@ -87,6 +89,14 @@ Options::Options(int argc, char *argv[]) :
     option(u"output", 'o', FILENAME);
     help(u"output", u"Output file name for TS packets. By default, use standard output.");
 
+    option(u"parallel", 0, POSITIVE, 0, 1, 0, 0, true);
+    help(u"parallel", u"count",
+         u"Load and compile the input section files in parallel, using several threads. "
+         u"The sections are packetized in the order of the files on the command line, "
+         u"regardless of the order in which the files are loaded. "
+         u"The optional value is the maximum number of threads. "
+         u"The default is the number of processors in the system.");
+
     option(u"pid", 'p', PIDVAL, 1, 1);
     help(u"pid", u"PID of the output TS packets. This is a required parameter, there is no default value.");
 
@@ -129,6 +139,9 @@ Options::Options(int argc, char *argv[]) :
         inType = ts::SectionFormat::BINARY;
     }
 
+    // The --parallel option has an optional value. If present without value, use the number of processors.
+    max_jobs = present(u"parallel") ? intValue<size_t>(u"parallel", std::max<size_t>(1, std::thread::hardware_concurrency())) : 1;
+
     // If any non-zero repetition rate is specified, make sure that a bitrate is specified.
     for (const auto& it : infiles) {
         if (it.repetition != cn::milliseconds::zero() && bitrate == 0) {
@@ -141,6 +154,65 @@ Options::Options(int argc, char *argv[]) :
 }
 
 
+//----------------------------------------------------------------------------
+//  A thread which loads input section files, with --parallel.
+//----------------------------------------------------------------------------
+
+namespace {
+    class LoaderThread: public ts::Thread
+    {
+        TS_NOBUILD_NOCOPY(LoaderThread);
+    public:
+        // Constructor. The file list, the loaded sections and the global status are shared between all threads.
+        LoaderThread(Options& opt, const std::vector<const ts::FileNameRate*>& files, std::atomic<size_t>& next_file, std::vector<ts::SectionPtrVector>& sections, std::atomic<bool>& success) :
+            _opt(opt),
+            _files(files),
+            _next_file(next_file),
+            _sections(sections),
+            _success(success)
+        {
+        }
+
+    protected:
+        // Thread main code.
+        virtual void main() override;
+
+    private:
+        Options&                                   _opt;
+        const std::vector<const ts::FileNameRate*>& _files;
+        std::atomic<size_t>&                       _next_file;
+        std::vector<ts::SectionPtrVector>&         _sections;
+        std::atomic<bool>&                         _success;
+    };
+}
+
+void LoaderThread::main()
+{
+    // Each thread has its own execution context, a DuckContext is not thread-safe.
+    // The command line was already analyzed, loading the options only reads it.
+    ts::DuckContext duck(&_opt);
+    duck.loadArgs(_opt);
+    ts::SectionFile file(duck);
+    file.setCRCValidation(_opt.crc_op);
+
+    // Pick the input files one by one, in their order on the command line.
+    for (;;) {
+        const size_t index = _next_file.fetch_add(1);
+        if (index >= _files.size()) {
+            break;
+        }
+        file.clear();
+        if (file.load(_files[index]->file_name, _opt.inType) && _opt.sections_opt.processSectionFile(file, _opt)) {
+            // The sections are shared pointers, they outlive the section file.
+            _sections[index] = file.sections();
+        }
+        else {
+            _success = false;
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 //  Program entry point
 //----------------------------------------------------------------------------
@@ -169,6 +241,41 @@ int MainCode(int argc, char *argv[])
             std::cerr << "* Loaded " << file.sections().size() << " sections from standard input" << std::endl;
         }
     }
+    else if (opt.max_jobs > 1 && opt.infiles.size() > 1) {
+        // Load the input files in parallel, using a pool of threads.
+        std::vector<const ts::FileNameRate*> files;
+        files.reserve(opt.infiles.size());
+        for (const auto& it : opt.infiles) {
+            files.push_back(&it);
+        }
+        std::vector<ts::SectionPtrVector> sections(files.size());
+        std::atomic<size_t> next_file(0);
+        std::atomic<bool> success(true);
+        bool ok = true;
+        std::vector<std::unique_ptr<LoaderThread>> threads;
+        threads.reserve(std::min(opt.max_jobs, files.size()));
+        for (size_t i = 0; i < std::min(opt.max_jobs, files.size()); ++i) {
+            threads.push_back(std::make_unique<LoaderThread>(opt, files, next_file, sections, success));
+            ok = threads.back()->start() && ok;
+        }
+        for (const auto& th : threads) {
+            th->waitForTermination();
+        }
+        if (!ok || !success) {
+            return EXIT_FAILURE;
+        }
+        // Add the sections in the order of the files on the command line.
+        for (size_t i = 0; i < files.size(); ++i) {
+            pzer.addSections(sections[i], files[i]->repetition);
+            if (opt.verbose()) {
+                std::cerr << "* Loaded " << sections[i].size() << " sections from " << files[i]->display_name;
+                if (files[i]->repetition > cn::milliseconds::zero()) {
+                    std::cerr << ", repetition rate: " << ts::UString::Chrono(files[i]->repetition, true);
+                }
+                std::cerr << std::endl;
+            }
+        }
+    }
     else {
         for (const auto& it : opt.infiles) {
             file.clear();
@@ -710,12 +710,14 @@ bool TCPSessionDump::dump(std::ostream& out)
 
     // Read all TCP sessions matching the source and destination.
     for (;;) {
-        // Read byte by byte, to make sure the alternance between client and server traffic is clearly identified.
+        // Read segment by segment. The alternance between client and server traffic can only
+        // occur on segment boundaries, so it remains clearly identified without the overhead
+        // of reading byte by byte.
         buf.clear();
         buf_source.clear();
-        size_t size = 1;
+        size_t size = 0;
         cn::microseconds timestamp = cn::microseconds::zero();
-        if (!_file.readTCP(buf_source, buf, size, timestamp, _opt)) {
+        if (!_file.readTCPSegment(buf_source, buf, size, timestamp, _opt)) {
             break;
         }
         if (data_timestamp <= cn::microseconds::zero()) {
@@ -286,15 +286,42 @@ int MainCode(int argc, char *argv[])
         uint8_t* const end_search = sync_end - search_size + 1;
 
         // Search a range of valid packets. Try all expected packet sizes.
+        // When the current position cannot start a packet, jump straight to the next
+        // sync byte in the buffer using memchr(), which is heavily vectorized in all
+        // modern libc's. Skipping garbage areas in bulk is much faster than testing
+        // every byte offset, which matters when resynchronizing very large captures.
         const uint8_t* start;
         for (start = sync_buf; start < end_search; start++) {
             if (opt.packet_size > 0) {
+                if (start[opt.header_size] != ts::SYNC_BYTE) {
+                    // Jump to the next position with a sync byte at the expected offset.
+                    const uint8_t* const next = reinterpret_cast<const uint8_t*>(std::memchr(start + opt.header_size + 1, ts::SYNC_BYTE, end_search - start - 1));
+                    if (next == nullptr) {
+                        start = end_search;
+                        break;
+                    }
+                    // The -1 compensates the start++ of the loop.
+                    start = next - opt.header_size - 1;
+                    continue;
+                }
                 if (resync.checkSync(start, search_size, opt.packet_size, opt.header_size)) {
                     // Found user-specified encapsulation of TS packets
                     break;
                 }
             }
             else {
+                if (start[0] != ts::SYNC_BYTE && start[ts::M2TS_HEADER_SIZE] != ts::SYNC_BYTE) {
+                    // No sync byte at any expected offset. The next possible packet start
+                    // is 4 bytes (a potential M2TS header) before the next sync byte.
+                    const uint8_t* const next = reinterpret_cast<const uint8_t*>(std::memchr(start + 1, ts::SYNC_BYTE, end_search - start - 1 + ts::M2TS_HEADER_SIZE));
+                    if (next == nullptr) {
+                        start = end_search;
+                        break;
+                    }
+                    // The -1 compensates the start++ of the loop.
+                    start = std::max(start, next - ts::M2TS_HEADER_SIZE - 1);
+                    continue;
+                }
                 if (resync.checkSync(start, search_size, ts::PKT_SIZE, 0)) {
                     // Found standard TS packets
                     break;
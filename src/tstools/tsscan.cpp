@@ -22,6 +22,7 @@
 #include "tsNIT.h"
 #include "tsTransportStreamId.h"
 #include "tsDescriptorList.h"
+#include "tsThread.h"
 TS_MAIN(MainCode);
 
 #define DEFAULT_PSI_TIMEOUT   10000 // ms
@@ -60,6 +61,7 @@ namespace {
         ts::UString       channel_file {};
         bool              update_channel_file = false;
         bool              default_channel_file = false;
+        ts::UStringVector extra_devices {};
         std::vector<ts::DeliverySystem> delivery_systems {};
     };
 }
@@ -89,6 +91,14 @@ ScanOptions::ScanOptions(int argc, char *argv[]) :
          u"This is typically used to scan terrestrial networks using DVB-T and DVT-T2. "
          u"Be aware that the scan time is multiplied by the number of specified systems on channels without signal.");
 
+    option(u"add-device", 0, STRING, 0, UNLIMITED_COUNT);
+    help(u"add-device", u"name",
+         u"Use an additional tuner device for parallel scanning. "
+         u"The main tuner (see --device-name) and all additional devices scan distinct "
+         u"channels or transponders concurrently, dividing the total scan time by the "
+         u"number of tuners. Several --add-device options may be specified. "
+         u"Use tslsdvb to list the available tuner device names.");
+
     option(u"nit-scan", 'n');
     help(u"nit-scan",
          u"Tuning parameters for a reference transport stream must be present (frequency or channel reference). "
@@ -220,6 +230,7 @@ ScanOptions::ScanOptions(int argc, char *argv[]) :
     // Type of HF band to use.
     hfband = vhf_scan ? duck.vhfBand() : duck.uhfBand();
 
+    getValues(extra_devices, u"add-device");
     use_best_strength = present(u"best-strength");
     list_services = present(u"service-list");
     global_services = present(u"global-service-list");
@@ -487,6 +498,8 @@ bool OffsetScanner::tryOffset(int32_t offset, ts::DeliverySystem sys)
 // Scanning context.
 //----------------------------------------------------------------------------
 
+class ScanThread;
+
 class ScanContext
 {
     TS_NOBUILD_NOCOPY(ScanContext);
@@ -498,19 +511,71 @@ public:
     void main();
 
 private:
+    friend class ScanThread;
+
     ScanOptions&    _opt;
-    ts::Tuner       _tuner;
-    ts::ServiceList _services;
-    ts::ChannelFile _channels;
+    ts::Tuner       _tuner;     // Main tuner.
+    ts::ServiceList _services;  // Global service list, shared between scanning threads.
+    ts::ChannelFile _channels;  // Channels file, shared between scanning threads.
+    std::mutex      _mutex {};  // Protect access to the shared state between scanning threads.
+    std::vector<ts::ModulationArgs> _transponders {};  // Transponders to scan with --nit-scan.
+    size_t          _task_count = 0;  // Total number of channels or transponders to scan.
+    size_t          _next_task = 0;   // Next channel or transponder to allocate to a tuner.
+    size_t          _next_print = 0;  // Next task result to print.
+    std::map<size_t, std::string> _completed {};  // Buffered reports of completed tasks, until printable in order.
 
     // Analyze a TS and generate relevant info.
-    void scanTS(std::ostream& strm, const ts::UString& margin, ts::ModulationArgs& tparams);
+    void scanTS(std::ostream& strm, const ts::UString& margin, ts::DuckContext& duck, ts::Tuner& tuner, ts::ModulationArgs& tparams);
 
     // UHF/VHF-band scanning
     void hfBandScan();
 
     // NIT-based scanning
     void nitScan();
+
+    // Scan all channels or transponders, using all tuners concurrently.
+    void scanInParallel(size_t task_count);
+
+    // Allocate the next channel or transponder to scan. Thread-safe.
+    // Return false when all tasks are allocated.
+    bool nextTask(size_t& index);
+
+    // Scan one channel or transponder on one tuner. Invoked in scanning threads.
+    void scanTask(size_t index, ts::Tuner& tuner);
+
+    // Report the result of one task. The results are printed in scan order,
+    // regardless of the completion order in the various threads. Thread-safe.
+    void reportTask(size_t index, const std::string& text);
+};
+
+
+//----------------------------------------------------------------------------
+// A thread which scans channels or transponders on one additional tuner.
+// The main tuner is driven by the main thread, using the same task loop.
+//----------------------------------------------------------------------------
+
+class ScanThread: public ts::Thread
+{
+    TS_NOBUILD_NOCOPY(ScanThread);
+public:
+    // Constructor.
+    ScanThread(ScanContext& ctx, ts::Tuner& tuner) : _ctx(ctx), _tuner(tuner) {}
+
+    // Destructor.
+    virtual ~ScanThread() override { waitForTermination(); }
+
+private:
+    ScanContext& _ctx;
+    ts::Tuner&   _tuner;
+
+    // Thread main code: scan tasks until they are all allocated.
+    virtual void main() override
+    {
+        size_t index = 0;
+        while (_ctx.nextTask(index)) {
+            _ctx.scanTask(index, _tuner);
+        }
+    }
 };
 
 // Constructor.
@@ -527,13 +592,13 @@ ScanContext::ScanContext(ScanOptions& opt) :
 // Analyze a TS and generate relevant info.
 //----------------------------------------------------------------------------
 
-void ScanContext::scanTS(std::ostream& strm, const ts::UString& margin, ts::ModulationArgs& tparams)
+void ScanContext::scanTS(std::ostream& strm, const ts::UString& margin, ts::DuckContext& duck, ts::Tuner& tuner, ts::ModulationArgs& tparams)
 {
     const bool get_services = _opt.list_services || _opt.global_services;
 
     // Collect info from the TS.
     // Use "PAT only" when we do not need the services or channels file.
-    ts::TSScanner info(_opt.duck, _tuner, _opt.psi_timeout, !get_services && _opt.channel_file.empty());
+    ts::TSScanner info(duck, tuner, _opt.psi_timeout, !get_services && _opt.channel_file.empty());
 
     // Get tuning parameters again, as TSScanner waits for a lock.
     // Also keep the original frequency and polarity since satellite tuners can only report the intermediate frequency.
@@ -566,40 +631,44 @@ void ScanContext::scanTS(std::ostream& strm, const ts::UString& margin, ts::Modu
         net_id = nit->network_id;
     }
 
+    // Display modulation parameters
+    if (_opt.show_modulation) {
+        tparams.display(strm, margin, _opt.maxSeverity());
+    }
+
+    // Get the list of services when required.
+    ts::ServiceList srvlist;
+    const bool got_services = (get_services || !_opt.channel_file.empty()) && info.getServices(srvlist);
+
     // Reset TS description in channels file.
-    ts::ChannelFile::TransportStreamPtr ts_info;
+    // The channels file is shared between all scanning threads.
     if (!_opt.channel_file.empty()) {
+        std::lock_guard<std::mutex> lock(_mutex);
         ts::ChannelFile::NetworkPtr net_info(_channels.networkGetOrCreate(net_id, ts::TunerTypeOf(tparams.delivery_system.value_or(ts::DS_UNDEFINED))));
-        ts_info = net_info->tsGetOrCreate(ts_id);
+        ts::ChannelFile::TransportStreamPtr ts_info(net_info->tsGetOrCreate(ts_id));
         ts_info->clear(); // reset all services in TS.
         ts_info->onid = sdt == nullptr ? 0 : sdt->onetw_id;
         ts_info->tune = tparams;
-    }
-
-    // Display modulation parameters
-    if (_opt.show_modulation) {
-        tparams.display(strm, margin, _opt.maxSeverity());
+        if (got_services) {
+            // Add all services in the channels info.
+            ts_info->addServices(srvlist);
+        }
     }
 
     // Display or collect services
-    if (get_services || ts_info != nullptr) {
-        ts::ServiceList srvlist;
-        if (info.getServices(srvlist)) {
-            if (ts_info != nullptr) {
-                // Add all services in the channels info.
-                ts_info->addServices(srvlist);
-            }
-            if (_opt.list_services) {
-                // Display services for this TS
-                srvlist.sort(ts::Service::Sort1);
-                strm << std::endl;
-                ts::Service::Display(strm, margin, srvlist);
-                strm << std::endl;
-            }
-            if (_opt.global_services) {
-                // Add collected services in global service list
-                _services.insert(_services.end(), srvlist.begin(), srvlist.end());
-            }
+    if (got_services) {
+        if (_opt.list_services) {
+            // Display services for this TS
+            srvlist.sort(ts::Service::Sort1);
+            strm << std::endl;
+            ts::Service::Display(strm, margin, srvlist);
+            strm << std::endl;
+        }
+        if (_opt.global_services) {
+            // Add collected services in global service list.
+            // The global list is shared between all scanning threads.
+            std::lock_guard<std::mutex> lock(_mutex);
+            _services.insert(_services.end(), srvlist.begin(), srvlist.end());
         }
     }
 }
@@ -611,24 +680,8 @@ void ScanContext::scanTS(std::ostream& strm, const ts::UString& margin, ts::Modu
 
 void ScanContext::hfBandScan()
 {
-    // Loop on all selected UHF channels
-    for (uint32_t chan = _opt.first_channel; chan <= _opt.last_channel; ++chan) {
-
-        // Scan all offsets surrounding the channel.
-        OffsetScanner offscan(_opt, _tuner, chan);
-        if (offscan.signalFound()) {
-
-            // A channel was found, report its characteristics.
-            ts::SignalState state;
-            _tuner.getSignalState(state);
-            std::cout << "* " << _opt.hfband->description(chan, offscan.bestOffset()) << ", " << state.toString() << std::endl;
-
-            // Analyze PSI/SI if required.
-            ts::ModulationArgs tparams;
-            offscan.getTunerParameters(tparams);
-            scanTS(std::cout, u"  ", tparams);
-        }
-    }
+    // Scan all selected UHF channels, using all tuners concurrently.
+    scanInParallel(size_t(_opt.last_channel - _opt.first_channel + 1));
 }
 
 
@@ -654,7 +707,8 @@ void ScanContext::nitScan()
         return;
     }
 
-    // Process each TS descriptor list in the NIT.
+    // Build the list of transponders to scan from each TS descriptor list in the NIT.
+    _transponders.clear();
     for (const auto& it : nit->transports) {
         const ts::TransportStreamId& tsid(it.first);
         const ts::DescriptorList& dlist(it.second.descs);
@@ -664,18 +718,144 @@ void ScanContext::nitScan()
             // Copy the local reception parameters (LNB, etc.) from the command line options
             // (we use the same reception equipment).
             params.copyLocalReceptionParameters(_opt.tuner_args);
-            // Tune to this transponder.
-            _opt.debug(u"* tuning to " + params.toPluginOptions(true));
-            if (_tuner.tune(params)) {
-                // Report channel characteristics
-                ts::SignalState state;
-                _tuner.getSignalState(state);
-                std::cout << "* Frequency: " << params.shortDescription(_opt.duck) << ", " << state.toString() << std::endl;
-                // Analyze PSI/SI if required
-                scanTS(std::cout, u"  ", params);
-            }
+            _transponders.push_back(params);
         }
     }
+
+    // Scan all transponders, using all tuners concurrently.
+    scanInParallel(_transponders.size());
+}
+
+
+//----------------------------------------------------------------------------
+// Allocate the next channel or transponder to scan. Thread-safe.
+//----------------------------------------------------------------------------
+
+bool ScanContext::nextTask(size_t& index)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_next_task >= _task_count) {
+        return false;
+    }
+    index = _next_task++;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------
+// Scan one channel or transponder on one tuner. Invoked in scanning threads.
+//----------------------------------------------------------------------------
+
+void ScanContext::scanTask(size_t index, ts::Tuner& tuner)
+{
+    // The report of this task is built in a string stream and printed in scan
+    // order at the end of the task, so that the outputs of concurrent tuners
+    // do not interleave.
+    std::ostringstream strm;
+
+    // Each scanning thread uses its own DuckContext. Table deserialization
+    // accumulates the encountered standards in the context and this
+    // accumulation is not thread-safe on a context shared between tuners.
+    ts::DuckContext duck(&_opt);
+    ts::DuckContext::SavedArgs duck_args;
+    _opt.duck.saveArgs(duck_args);
+    duck.restoreArgs(duck_args);
+
+    if (_opt.nit_scan) {
+        // Tune to one transponder from the NIT.
+        ts::ModulationArgs params(_transponders[index]);
+        _opt.debug(u"* tuning to " + params.toPluginOptions(true));
+        if (tuner.tune(params)) {
+            // Report channel characteristics
+            ts::SignalState state;
+            tuner.getSignalState(state);
+            strm << "* Frequency: " << params.shortDescription(duck) << ", " << state.toString() << std::endl;
+            // Analyze PSI/SI if required
+            scanTS(strm, u"  ", duck, tuner, params);
+        }
+    }
+    else {
+        // Scan all offsets surrounding one HF band channel.
+        const uint32_t chan = _opt.first_channel + uint32_t(index);
+        OffsetScanner offscan(_opt, tuner, chan);
+        if (offscan.signalFound()) {
+
+            // A channel was found, report its characteristics.
+            ts::SignalState state;
+            tuner.getSignalState(state);
+            strm << "* " << _opt.hfband->description(chan, offscan.bestOffset()) << ", " << state.toString() << std::endl;
+
+            // Analyze PSI/SI if required.
+            ts::ModulationArgs tparams;
+            offscan.getTunerParameters(tparams);
+            scanTS(strm, u"  ", duck, tuner, tparams);
+        }
+    }
+
+    reportTask(index, strm.str());
+}
+
+
+//----------------------------------------------------------------------------
+// Report the result of one task, keep the output in scan order. Thread-safe.
+//----------------------------------------------------------------------------
+
+void ScanContext::reportTask(size_t index, const std::string& text)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _completed[index] = text;
+
+    // Print all completed tasks which are printable in scan order.
+    // The text is empty when no signal was found on the channel.
+    while (!_completed.empty() && _completed.begin()->first == _next_print) {
+        std::cout << _completed.begin()->second << std::flush;
+        _completed.erase(_completed.begin());
+        _next_print++;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Scan all channels or transponders, using all tuners concurrently.
+//----------------------------------------------------------------------------
+
+void ScanContext::scanInParallel(size_t task_count)
+{
+    _task_count = task_count;
+    _next_task = 0;
+    _next_print = 0;
+    _completed.clear();
+
+    // Open the additional tuners and create their scanning threads.
+    std::vector<std::shared_ptr<ts::Tuner>> tuners;
+    std::vector<std::shared_ptr<ScanThread>> threads;
+    for (const auto& name : _opt.extra_devices) {
+        auto tuner = std::make_shared<ts::Tuner>(_opt.duck);
+        tuner->setSignalTimeoutSilent(true);
+        ts::TunerArgs args(_opt.tuner_args);
+        args.device_name = name;
+        if (!args.configureTuner(*tuner)) {
+            return;
+        }
+        tuners.push_back(tuner);
+        threads.push_back(std::make_shared<ScanThread>(*this, *tuner));
+    }
+
+    // Start the additional scanning threads.
+    for (auto& thread : threads) {
+        thread->start();
+    }
+
+    // The main tuner scans in the current thread, using the same task loop.
+    size_t index = 0;
+    while (nextTask(index)) {
+        scanTask(index, _tuner);
+    }
+
+    // Wait for the completion of the additional scanning threads.
+    for (auto& thread : threads) {
+        thread->waitForTermination();
+    }
 }
 
 
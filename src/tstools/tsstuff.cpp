@@ -23,6 +23,7 @@ static constexpr size_t   MIN_TS_BUFFER_SIZE     = 1024;             // 1 kB
 static constexpr size_t   DEFAULT_TS_BUFFER_SIZE = 4 * 1024 * 1024;  // 4 MB
 static constexpr size_t   MAX_TS_BUFFER_SIZE     = 16 * 1024 * 1024; // 16 MB
 static constexpr uint64_t DEFAULT_MIN_INTERVAL   = 100;              // milliseconds
+static constexpr size_t   OUT_BUFFER_PACKETS     = 8 * 1024;         // output write batch, in packets
 
 namespace {
     class Options: public ts::Args
@@ -170,6 +171,7 @@ public:
         _opt(opt),
         _input(opt.buffer_size / ts::PKT_SIZE)
     {
+        _out_buffer.reserve(OUT_BUFFER_PACKETS);
     }
 
     // Process the content
@@ -186,6 +188,7 @@ private:
     uint64_t                 _current_residue_packets = 0; // Packets to add to inter_packets.
     uint64_t                 _remaining_stuff_count = 0;   // Remaining number of stuffing packets to add before end of segment.
     uint64_t                 _additional_bits = 0;         // Additional bits (less than one packet) to add in next segment.
+    ts::TSPacketVector       _out_buffer {};               // Staging buffer for output packets, flushed in large writes.
 
     // Abort processing (invoked on fatal error, when message already reported)
     [[noreturn]] void fatalError();
@@ -200,9 +203,15 @@ private:
     // Compute _current_inter_packet, _remaining_stuff_count, _additional_bits.
     void evaluateNextStuffing();
 
+    // Buffer one output packet, flush the staging buffer when full.
+    void writePacket(const ts::TSPacket& pkt);
+
     // Write the specified number of stuffing packets
     void writeStuffing(uint64_t stuffing_packet_count);
 
+    // Flush the staging buffer to the output file.
+    void flushOutput();
+
     // Read input up to end_packet and perform simple inter-packet stuffing.
     void simpleInterPacketStuffing(uint64_t inter_packet, uint64_t end_packet);
 };
@@ -242,16 +251,33 @@ bool Stuffer::getTimeStamp(const ts::TSPacket& pkt, uint64_t& tstamp) const
 
 
 //-----------------------------------------------------------------------------
-// Write the specified number of stuffing packets
+// Buffered output. Packets are staged in memory and written in large
+// sequential chunks, instead of one system call per packet.
 //-----------------------------------------------------------------------------
 
+void Stuffer::writePacket(const ts::TSPacket& pkt)
+{
+    _out_buffer.push_back(pkt);
+    if (_out_buffer.size() >= OUT_BUFFER_PACKETS) {
+        flushOutput();
+    }
+}
+
 void Stuffer::writeStuffing(uint64_t count)
 {
     while (count > 0) {
-        if (!_output.writePackets(&ts::NullPacket, nullptr, 1, _opt)) {
+        writePacket(ts::NullPacket);
+        count--;
+    }
+}
+
+void Stuffer::flushOutput()
+{
+    if (!_out_buffer.empty()) {
+        if (!_output.writePackets(_out_buffer.data(), nullptr, _out_buffer.size(), _opt)) {
             fatalError();
         }
-        count--;
+        _out_buffer.clear();
     }
 }
 
@@ -266,9 +292,7 @@ void Stuffer::simpleInterPacketStuffing(uint64_t inter_packet, uint64_t end_pack
 
     ts::TSPacket pkt;
     while (_input.readPacketsCount() < end_packet && _input.read(&pkt, 1, _opt) == 1) {
-        if (!_output.writePackets(&pkt, nullptr, 1, _opt)) {
-            fatalError();
-        }
+        writePacket(pkt);
         writeStuffing(inter_packet);
     }
 }
@@ -428,9 +452,7 @@ void Stuffer::stuff()
         ts::TSPacket pkt;
         while (_input.readPacketsCount() < _tstamp2->packet && _input.read(&pkt, 1, _opt) == 1) {
             // Write the input packet.
-            if (!_output.writePackets(&pkt, nullptr, 1, _opt)) {
-                fatalError();
-            }
+            writePacket(pkt);
             // Write stuffing packets after each input packet.
             const uint64_t residue = _current_residue_packets > 0 ? 1 : 0;
             const uint64_t count = std::min(_current_inter_packet + residue, _remaining_stuff_count);
@@ -453,6 +475,9 @@ void Stuffer::stuff()
     // Write trailing stuffing packets
     writeStuffing(_opt.trailing_packets);
 
+    // Flush the last partial chunk of output packets.
+    flushOutput();
+
     _opt.verbose(u"stuffing completed, read %'d packets, written %'d packets", _input.readPacketsCount(), _output.writePacketsCount());
 
     // Close files
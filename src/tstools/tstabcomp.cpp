@@ -15,6 +15,7 @@
 #include "tsSectionFileArgs.h"
 #include "tsxmlTweaks.h"
 #include "tsSysUtils.h"
+#include "tsThread.h"
 TS_MAIN(MainCode);
 
 
@@ -41,6 +42,7 @@ namespace {
         bool                toJSON = false;          // Decompile to JSON.
         bool                xmlModel = false;        // Display XML model instead of compilation.
         bool                withExtensions = false;  // XML model with extensions.
+        size_t              maxJobs = 1;             // Number of threads to process the input files.
         ts::SectionFileArgs sectionOptions {};       // Section file processing options.
         ts::xml::Tweaks     xmlTweaks {};            // XML formatting options.
     };
@@ -105,6 +107,15 @@ Options::Options(int argc, char *argv[]) :
          u"The default output file for the standard input (\"-\") is the standard output (\"-\"). "
          u"If more than one input file is specified, the output path, if present, must be either a directory name or \"-\".");
 
+    option(u"parallel", 'p', POSITIVE, 0, 1, 0, 0, true);
+    help(u"parallel", u"count",
+         u"Process the input files in parallel, using several threads. "
+         u"The files are dispatched on the threads in their order on the command line. "
+         u"Each file is processed in one single thread. "
+         u"The optional value is the maximum number of threads. "
+         u"The default is the number of logical processors in the system. "
+         u"This option is incompatible with the standard input and the standard output.");
+
     option(u"xml-model", 'x');
     help(u"xml-model",
          u"Display the XML model of the table files. This model is not a full "
@@ -130,6 +141,9 @@ Options::Options(int argc, char *argv[]) :
     useStdOut = present(u"output") && (outFile.empty() || outFile == u"-");
     outIsDir = !useStdOut && fs::is_directory(outFile);
 
+    // The --parallel option has an optional value. If present without value, use the number of processors.
+    maxJobs = present(u"parallel") ? intValue<size_t>(u"parallel", std::max<size_t>(1, std::thread::hardware_concurrency())) : 1;
+
     if (useStdOut) {
         outFile.clear();
     }
@@ -145,6 +159,9 @@ Options::Options(int argc, char *argv[]) :
     if (compile && decompile) {
         error(u"specify either --compile or --decompile but not both");
     }
+    if (maxJobs > 1 && (useStdIn || useStdOut)) {
+        error(u"--parallel is incompatible with the standard input and the standard output");
+    }
 
     exitOnError();
 }
@@ -179,7 +196,7 @@ namespace {
 //----------------------------------------------------------------------------
 
 namespace {
-    bool ProcessFile(Options& opt, const ts::UString& infile)
+    bool ProcessFile(Options& opt, ts::DuckContext& duck, const ts::UString& infile)
     {
         const ts::SectionFormat inType = opt.fromJSON ? ts::SectionFormat::JSON : ts::GetSectionFileFormat(infile);
         const bool useStdIn = infile.empty() || infile == u"-";
@@ -208,7 +225,7 @@ namespace {
             }
         }
 
-        ts::SectionFile file(opt.duck);
+        ts::SectionFile file(duck);
         file.setTweaks(opt.xmlTweaks);
         file.setCRCValidation(ts::CRC32::CHECK);
 
@@ -243,6 +260,54 @@ namespace {
 }
 
 
+//----------------------------------------------------------------------------
+//  A thread which processes input files, with --parallel.
+//----------------------------------------------------------------------------
+
+namespace {
+    class ProcessorThread: public ts::Thread
+    {
+        TS_NOBUILD_NOCOPY(ProcessorThread);
+    public:
+        // Constructor. The file indexes and the global status are shared between all threads.
+        ProcessorThread(Options& opt, std::atomic<size_t>& next_file, std::atomic<bool>& success) :
+            _opt(opt),
+            _next_file(next_file),
+            _success(success)
+        {
+        }
+
+    protected:
+        // Thread main code.
+        virtual void main() override;
+
+    private:
+        Options&             _opt;
+        std::atomic<size_t>& _next_file;
+        std::atomic<bool>&   _success;
+    };
+}
+
+void ProcessorThread::main()
+{
+    // Each thread has its own execution context, a DuckContext is not thread-safe.
+    // The command line was already analyzed, loading the options only reads it.
+    ts::DuckContext duck(&_opt);
+    duck.loadArgs(_opt);
+
+    // Pick the input files one by one, in their order on the command line.
+    for (;;) {
+        const size_t index = _next_file.fetch_add(1);
+        if (index >= _opt.inFiles.size()) {
+            break;
+        }
+        if (!_opt.inFiles[index].empty() && !ProcessFile(_opt, duck, _opt.inFiles[index])) {
+            _success = false;
+        }
+    }
+}
+
+
 //----------------------------------------------------------------------------
 //  Program entry point
 //----------------------------------------------------------------------------
@@ -254,10 +319,25 @@ int MainCode(int argc, char *argv[])
     if (opt.xmlModel) {
         ok = DisplayModel(opt);
     }
+    else if (opt.maxJobs > 1 && opt.inFiles.size() > 1) {
+        // Process the input files in parallel, using a pool of threads.
+        std::atomic<size_t> next_file(0);
+        std::atomic<bool> success(true);
+        std::vector<std::unique_ptr<ProcessorThread>> threads;
+        threads.reserve(std::min(opt.maxJobs, opt.inFiles.size()));
+        for (size_t i = 0; i < std::min(opt.maxJobs, opt.inFiles.size()); ++i) {
+            threads.push_back(std::make_unique<ProcessorThread>(opt, next_file, success));
+            ok = threads.back()->start() && ok;
+        }
+        for (const auto& th : threads) {
+            th->waitForTermination();
+        }
+        ok = ok && success;
+    }
     else {
         for (size_t i = 0; i < opt.inFiles.size(); ++i) {
             if (!opt.inFiles[i].empty()) {
-                ok = ProcessFile(opt, opt.inFiles[i]) && ok;
+                ok = ProcessFile(opt, opt.duck, opt.inFiles[i]) && ok;
             }
         }
     }
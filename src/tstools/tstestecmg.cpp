@@ -231,12 +231,12 @@ namespace {
         };
 
         // EventScheduler private fields.
-        const CmdOptions&       _opt;
-        ts::Report&             _report;
-        std::mutex              _mutex {};
-        std::condition_variable _condition {};
-        std::list<Event>        _events {};
-        size_t                  _request_count = 0;
+        const CmdOptions&           _opt;
+        ts::Report&                 _report;
+        std::mutex                  _mutex {};
+        std::condition_variable     _condition {};
+        std::multimap<ts::Time, Event> _events {};  // Events sorted by due time, earliest first.
+        size_t                      _request_count = 0;
 
         // Enqueue an event.
         void enqueue(const Event& event);
@@ -260,16 +260,13 @@ void EventQueue::enqueue(const Event& event)
     _report.debug(u"enqueue event, due: %s, term: %s, channel: %d, stream: %d", event.due, event.terminate, event.channel_id, event.stream_id);
     std::lock_guard<std::mutex> lock(_mutex);
 
-    // Keep an ordered list of events by due time, most future first.
-    auto iter = _events.begin();
-    while (iter != _events.end() && iter->due > event.due) {
-        ++iter;
-    }
-    const bool at_end = iter == _events.end();
-    _events.insert(iter, event);
+    // Events are sorted by due time. With tens of thousands of pending
+    // requests, the multimap insertion stays logarithmic.
+    const bool earliest = _events.empty() || event.due < _events.begin()->first;
+    _events.insert(std::make_pair(event.due, event));
 
-    // If event was inserted at end, maybe we need to wake up.
-    if (at_end) {
+    // If the new event becomes the earliest one, the wait must be shortened.
+    if (earliest) {
         _condition.notify_one();
     }
 }
@@ -290,17 +287,17 @@ bool EventQueue::waitEvent(uint16_t& channel_id, uint16_t& stream_id)
             // Wait until explicitly signalled.
             _condition.wait(lock);
         }
-        else if (_events.back().due <= now) {
-            // Last event is ready.
-            channel_id = _events.back().channel_id;
-            stream_id = _events.back().stream_id;
-            const bool terminate = _events.back().terminate;
-            _events.pop_back();
+        else if (_events.begin()->first <= now) {
+            // Earliest event is ready.
+            channel_id = _events.begin()->second.channel_id;
+            stream_id = _events.begin()->second.stream_id;
+            const bool terminate = _events.begin()->second.terminate;
+            _events.erase(_events.begin());
             return !terminate;
         }
         else {
-            // Wait until last event time (or explicitly signalled).
-            _condition.wait_for(lock, _events.back().due - now);
+            // Wait until earliest event time (or explicitly signalled).
+            _condition.wait_for(lock, _events.begin()->first - now);
         }
     }
 }
@@ -333,6 +330,10 @@ namespace {
     private:
         using ResponseStat = ts::SingleDataStatistics<cn::milliseconds>;
 
+        // Histogram of response times, one bucket per millisecond, last bucket for all slower responses.
+        static constexpr size_t HISTO_MAX_MS = 10000;
+        using ResponseHisto = std::vector<size_t>;
+
         const CmdOptions&          _opt;
         ts::Report&                _report;
         std::atomic<std::uint32_t> _request_count {0}; // same as std::atomic_uint32_t, missing in old GCC
@@ -341,9 +342,14 @@ namespace {
         std::condition_variable    _condition {};
         ResponseStat               _instant_response {};
         ResponseStat               _global_response {};
+        ResponseHisto              _instant_histo = ResponseHisto(HISTO_MAX_MS + 1, 0);
+        ResponseHisto              _global_histo = ResponseHisto(HISTO_MAX_MS + 1, 0);
+
+        // Compute a percentile of response times, in milliseconds, from a histogram.
+        static cn::milliseconds::rep Percentile(const ResponseHisto& histo, size_t total, size_t pcent);
 
         // Report statistics. Must be called with mutex held.
-        void reportStatistics(const ResponseStat& stat);
+        void reportStatistics(const ResponseStat& stat, const ResponseHisto& histo);
     };
 }
 
@@ -364,18 +370,40 @@ CmdStatistics::~CmdStatistics()
 // Provide statistics.
 void CmdStatistics::oneResponse(const cn::milliseconds& time)
 {
+    const size_t bucket = std::min<size_t>(size_t(std::max<cn::milliseconds::rep>(0, time.count())), HISTO_MAX_MS);
     std::lock_guard<std::mutex> lock(_mutex);
     _instant_response.feed(time);
     _global_response.feed(time);
+    _instant_histo[bucket]++;
+    _global_histo[bucket]++;
+}
+
+// Compute a percentile of response times, in milliseconds, from a histogram.
+cn::milliseconds::rep CmdStatistics::Percentile(const ResponseHisto& histo, size_t total, size_t pcent)
+{
+    if (total == 0) {
+        return 0;
+    }
+    const size_t threshold = ((total * pcent) + 99) / 100;
+    size_t cumul = 0;
+    for (size_t ms = 0; ms < histo.size(); ++ms) {
+        cumul += histo[ms];
+        if (cumul >= threshold) {
+            return cn::milliseconds::rep(ms);
+        }
+    }
+    return cn::milliseconds::rep(histo.size() - 1);
 }
 
 // Report statistics. Must be called with mutex held.
-void CmdStatistics::reportStatistics(const ResponseStat& stat)
+void CmdStatistics::reportStatistics(const ResponseStat& stat, const ResponseHisto& histo)
 {
-    _report.info(u"req: %'d, ecm: %'d, response mean: %s ms, min: %d, max: %d, dev: %s",
+    const size_t total = size_t(stat.count());
+    _report.info(u"req: %'d, ecm: %'d, response mean: %s ms, min: %d, max: %d, dev: %s, p50: %d, p90: %d, p99: %d",
                  _request_count.load(), _global_response.count(),
                  stat.meanString(0, 3), stat.minimum(), stat.maximum(),
-                 stat.standardDeviationString(0, 3));
+                 stat.standardDeviationString(0, 3),
+                 Percentile(histo, total, 50), Percentile(histo, total, 90), Percentile(histo, total, 99));
 }
 
 // Thread code.
@@ -390,13 +418,14 @@ void CmdStatistics::main()
             _condition.wait_for(lock, _opt.stat_interval);
         }
         if (!_terminate) {
-            reportStatistics(_instant_response);
+            reportStatistics(_instant_response, _instant_histo);
             _instant_response.reset();
+            std::fill(_instant_histo.begin(), _instant_histo.end(), 0);
         }
     }
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        reportStatistics(_global_response);
+        reportStatistics(_global_response, _global_histo);
     }
 }
 
@@ -635,15 +664,19 @@ bool ECMGConnection::sendStreamSetup(uint16_t stream_id)
 // Send an ECM request.
 bool ECMGConnection::sendRequest(uint16_t stream_id)
 {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
-    const size_t index = stream_id - _opt.first_ecm_stream_id;
-    if (stream_id < _opt.first_ecm_stream_id || index >= _streams.size() || !_streams[index].ready) {
-        _logger.report().error(u"invalid stream id: %d", stream_id);
-        return false;
-    }
-    else {
+    // Build the request message under the mutex but send it outside: the TCP
+    // send must not block the reception thread which needs the same mutex to
+    // process ECM responses on the other streams of the channel.
+    ts::ecmgscs::CWProvision msg(_opt.ecmgscs);
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        const size_t index = stream_id - _opt.first_ecm_stream_id;
+        if (stream_id < _opt.first_ecm_stream_id || index >= _streams.size() || !_streams[index].ready) {
+            _logger.report().error(u"invalid stream id: %d", stream_id);
+            return false;
+        }
+
         // Build the request message.
-        ts::ecmgscs::CWProvision msg(_opt.ecmgscs);
         msg.channel_id = _channel_id;
         msg.stream_id = stream_id;
         msg.CP_number = _streams[index].cp_number++;
@@ -659,10 +692,10 @@ bool ECMGConnection::sendRequest(uint16_t stream_id)
         // Register the message.
         _streams[index].start_request = ts::Time::CurrentUTC();
         _stat.oneRequest();
-
-        // Send the message.
-        return _conn.sendMessage(msg, _logger);
     }
+
+    // Send the message.
+    return _conn.sendMessage(msg, _logger);
 }
 
 
@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  Micro-benchmarks for cryptographic classes.
+//
+//  This tool measures the throughput of the scrambling, hashing and checksum
+//  classes, across buffer sizes and threads, and prints one CSV line per
+//  measurement. It is built and run using the "bench" make target, beside
+//  the unitary tests. The results are used to track acceleration regressions
+//  from one release or one machine to another.
+//
+//----------------------------------------------------------------------------
+
+#include "tsMain.h"
+#include "tsArgs.h"
+#include "tsByteBlock.h"
+#include "tsThread.h"
+#include "tsSysInfo.h"
+#include "tsDVBCSA2.h"
+#include "tsAES128.h"
+#include "tsCBC.h"
+#include "tsCTR.h"
+#include "tsCRC32.h"
+#include "tsSHA256.h"
+#include <functional>
+TS_MAIN(MainCode);
+
+#define DEFAULT_MIN_TIME 500  // milliseconds per measurement
+
+
+//----------------------------------------------------------------------------
+// Command line options
+//----------------------------------------------------------------------------
+
+namespace {
+    class Options: public ts::Args
+    {
+        TS_NOBUILD_NOCOPY(Options);
+    public:
+        Options(int argc, char *argv[]);
+
+        ts::UStringVector   algos {};        // Algorithm names to benchmark (all by default).
+        std::vector<size_t> sizes {};        // Buffer sizes in bytes.
+        size_t              max_threads = 0; // Maximum number of threads.
+        cn::milliseconds    min_time {};     // Minimum measurement time.
+    };
+}
+
+Options::Options(int argc, char *argv[]) :
+    Args(u"Benchmark the cryptographic classes", u"[options] [algorithm ...]")
+{
+    option(u"", 0, STRING, 0, UNLIMITED_COUNT);
+    help(u"",
+         u"Names of the algorithms to benchmark, as displayed in the first output column. "
+         u"The names are not case sensitive. By default, benchmark all algorithms.");
+
+    option(u"buffer-size", 'b', POSITIVE, 0, UNLIMITED_COUNT);
+    help(u"buffer-size", u"bytes",
+         u"Buffer size in bytes. Several --buffer-size options may be specified. "
+         u"The sizes are rounded down to a multiple of the block size of each algorithm. "
+         u"The default is a predefined list of sizes from one TS packet payload to 1 MB.");
+
+    option<cn::milliseconds>(u"min-time", 'm');
+    help(u"min-time",
+         u"Minimum measurement time in milliseconds for each combination of "
+         u"algorithm, buffer size and thread count. The default is " +
+         ts::UString::Decimal(DEFAULT_MIN_TIME) + u" ms.");
+
+    option(u"threads", 't', POSITIVE);
+    help(u"threads", u"count",
+         u"Maximum number of concurrent threads. The thread counts are explored in "
+         u"powers of two, up to that maximum. The default is the number of logical "
+         u"processors in the system.");
+
+    analyze(argc, argv);
+
+    getValues(algos);
+    getIntValues(sizes, u"buffer-size");
+    getIntValue(max_threads, u"threads", std::max<size_t>(1, std::thread::hardware_concurrency()));
+    getChronoValue(min_time, u"min-time", cn::milliseconds(DEFAULT_MIN_TIME));
+
+    if (sizes.empty()) {
+        sizes = {184, 1316, 4096, 65536, 1048576};
+    }
+
+    exitOnError();
+}
+
+
+//----------------------------------------------------------------------------
+// Description of the benchmarked operations.
+//----------------------------------------------------------------------------
+
+namespace {
+    // One iteration of a benchmarked operation, over a private buffer.
+    using Operation = std::function<bool()>;
+
+    // Build an instance of an operation, with its own algorithm instance and
+    // buffer, so that each thread works on private data.
+    using OperationFactory = std::function<Operation(size_t buffer_size)>;
+
+    // A benchmark case: an algorithm, an operation and how to instantiate it.
+    struct BenchCase {
+        ts::UString      algorithm;   // Algorithm name (first output column).
+        ts::UString      operation;   // Operation name (second output column).
+        size_t           block_size;  // Buffer sizes are rounded down to a multiple of this.
+        OperationFactory factory;     // Build one operation instance.
+    };
+
+    // Arbitrary fixed key and IV (the values do not matter for performance).
+    const ts::ByteBlock KEY {0x5A, 0x21, 0xF3, 0x8E, 0x01, 0xC7, 0x64, 0xB9,
+                             0x33, 0xD0, 0x4F, 0x7C, 0xA8, 0x12, 0xE5, 0x96};
+    const ts::ByteBlock IV  {0x6B, 0x09, 0xDE, 0x40, 0x97, 0x3C, 0xF1, 0x28,
+                             0x84, 0x5D, 0x02, 0xBF, 0x71, 0xCA, 0x1E, 0x63};
+
+    // Build the list of all benchmark cases.
+    std::vector<BenchCase> AllBenchCases()
+    {
+        std::vector<BenchCase> cases;
+
+        // Scrambling and deciphering with each block cipher.
+        const auto add_cipher = [&cases](const ts::UString& name, size_t block_size, const std::function<std::shared_ptr<ts::BlockCipher>()>& create) {
+            cases.push_back({name, u"encrypt", block_size, [create](size_t size) {
+                auto cipher = create();
+                auto buf = std::make_shared<ts::ByteBlock>(size, 0xA5);
+                return [cipher, buf]() { return cipher->encrypt(buf->data(), buf->size(), buf->data(), buf->size()); };
+            }});
+            cases.push_back({name, u"decrypt", block_size, [create](size_t size) {
+                auto cipher = create();
+                auto buf = std::make_shared<ts::ByteBlock>(size, 0xA5);
+                return [cipher, buf]() { return cipher->decrypt(buf->data(), buf->size(), buf->data(), buf->size()); };
+            }});
+        };
+        add_cipher(u"DVB-CSA2", 1, []() {
+            auto cipher = std::make_shared<ts::DVBCSA2>();
+            cipher->setKey(KEY.data(), ts::DVBCSA2::KEY_SIZE);
+            return cipher;
+        });
+        add_cipher(u"AES-128-CBC", ts::AES128::BLOCK_SIZE, []() {
+            auto cipher = std::make_shared<ts::CBC<ts::AES128>>();
+            cipher->setKey(KEY.data(), ts::AES128::KEY_SIZE);
+            cipher->setIV(IV.data(), IV.size());
+            return cipher;
+        });
+        add_cipher(u"AES-128-CTR", 1, []() {
+            auto cipher = std::make_shared<ts::CTR<ts::AES128>>();
+            cipher->setKey(KEY.data(), ts::AES128::KEY_SIZE);
+            cipher->setIV(IV.data(), IV.size());
+            return cipher;
+        });
+
+        // CRC32 accumulation.
+        cases.push_back({u"CRC32", u"add", 1, [](size_t size) {
+            auto crc = std::make_shared<ts::CRC32>();
+            auto buf = std::make_shared<ts::ByteBlock>(size, 0xA5);
+            return [crc, buf]() { crc->add(buf->data(), buf->size()); return true; };
+        }});
+
+        // SHA-256 complete hash.
+        cases.push_back({u"SHA-256", u"hash", 1, [](size_t size) {
+            auto sha = std::make_shared<ts::SHA256>();
+            auto buf = std::make_shared<ts::ByteBlock>(size, 0xA5);
+            auto digest = std::make_shared<ts::ByteBlock>(ts::SHA256::HASH_SIZE);
+            return [sha, buf, digest]() { return sha->hash(buf->data(), buf->size(), digest->data(), digest->size()); };
+        }});
+
+        return cases;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// A thread which repeats an operation until requested to stop.
+//----------------------------------------------------------------------------
+
+namespace {
+    class BenchThread: public ts::Thread
+    {
+        TS_NOBUILD_NOCOPY(BenchThread);
+    public:
+        BenchThread(const Operation& op, const std::atomic<bool>& stop) : _op(op), _stop(stop) {}
+
+        uint64_t iterations() const { return _iterations; }
+        bool success() const { return _success; }
+
+    private:
+        virtual void main() override
+        {
+            while (!_stop) {
+                _success = _op() && _success;
+                ++_iterations;
+            }
+        }
+
+        Operation _op;
+        const std::atomic<bool>& _stop;
+        uint64_t _iterations = 0;
+        bool _success = true;
+    };
+}
+
+
+//----------------------------------------------------------------------------
+// Program main code.
+//----------------------------------------------------------------------------
+
+int MainCode(int argc, char *argv[])
+{
+    Options opt(argc, argv);
+
+    // Thread counts to explore: powers of two up to the maximum, plus the maximum.
+    std::vector<size_t> thread_counts;
+    for (size_t t = 1; t < opt.max_threads; t *= 2) {
+        thread_counts.push_back(t);
+    }
+    thread_counts.push_back(opt.max_threads);
+
+    // Context lines and CSV header.
+    std::cout << "# " << ts::SysInfo::GetSystemVersion() << std::endl;
+    std::cout << "# " << ts::SysInfo::GetAccelerations() << std::endl;
+    std::cout << "algorithm,operation,buffer-bytes,threads,iterations,microseconds,bytes-per-second" << std::endl;
+
+    bool success = true;
+    for (const auto& bench : AllBenchCases()) {
+
+        // Filter algorithms from the command line.
+        if (!opt.algos.empty() && !ts::UString(bench.algorithm).isContainedSimilarIn(opt.algos)) {
+            continue;
+        }
+
+        for (size_t size : opt.sizes) {
+            // Round the buffer size down to a multiple of the block size.
+            size -= size % bench.block_size;
+            if (size == 0) {
+                continue;
+            }
+
+            for (size_t threads : thread_counts) {
+
+                // Create one operation instance and one thread per requested thread.
+                std::atomic<bool> stop(false);
+                std::vector<std::unique_ptr<BenchThread>> pool;
+                for (size_t i = 0; i < threads; ++i) {
+                    pool.push_back(std::make_unique<BenchThread>(bench.factory(size), stop));
+                }
+
+                // Run all threads for the requested duration.
+                const auto start_time = cn::steady_clock::now();
+                for (const auto& th : pool) {
+                    th->start();
+                }
+                std::this_thread::sleep_for(opt.min_time);
+                stop = true;
+                for (const auto& th : pool) {
+                    th->waitForTermination();
+                }
+                const auto duration = cn::duration_cast<cn::microseconds>(cn::steady_clock::now() - start_time);
+
+                // Aggregate the results of all threads.
+                uint64_t iterations = 0;
+                for (const auto& th : pool) {
+                    iterations += th->iterations();
+                    success = th->success() && success;
+                }
+                const uint64_t bps = duration.count() <= 0 ? 0 : (iterations * size * UINT64_C(1'000'000)) / uint64_t(duration.count());
+                std::cout << ts::UString::Format(u"%s,%s,%d,%d,%d,%d,%d", bench.algorithm, bench.operation, size, threads, iterations, duration.count(), bps) << std::endl;
+            }
+        }
+    }
+
+    if (!success) {
+        opt.error(u"some operations failed, the results are not reliable");
+    }
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
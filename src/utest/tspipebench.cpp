@@ -0,0 +1,372 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  End-to-end benchmark for tsp plugin chains.
+//
+//  This tool runs complete TSProcessor pipelines in memory: a synthetic
+//  multiplex is generated by the application and fed through the "memory"
+//  input plugin, the output of the chain is counted, validated and discarded
+//  through the "memory" output plugin. One JSON object is printed per chain,
+//  with wall-clock and CPU times and the packet throughput. It is built and
+//  run using the "bench" make target, beside the unitary tests, to track
+//  pipeline regressions from one release or one machine to another.
+//
+//----------------------------------------------------------------------------
+
+#include "tsMain.h"
+#include "tsArgs.h"
+#include "tsTSProcessor.h"
+#include "tsTSProcessorArgs.h"
+#include "tsAsyncReport.h"
+#include "tsPluginEventHandlerInterface.h"
+#include "tsPluginEventData.h"
+#include "tsDuckContext.h"
+#include "tsOneShotPacketizer.h"
+#include "tsPAT.h"
+#include "tsPMT.h"
+#include "tsSysInfo.h"
+#include "tsSysUtils.h"
+#include "tsFileUtils.h"
+TS_MAIN(MainCode);
+
+#define DEFAULT_PACKETS   1'000'000  // packets per measurement
+#define DEFAULT_PID_COUNT 8          // number of elementary stream PID's
+
+
+//----------------------------------------------------------------------------
+// Command line options
+//----------------------------------------------------------------------------
+
+namespace {
+    class Options: public ts::Args
+    {
+        TS_NOBUILD_NOCOPY(Options);
+    public:
+        Options(int argc, char *argv[]);
+
+        ts::UStringVector chain_names {};  // Names of built-in chains to run (all by default).
+        ts::UStringVector user_chains {};  // User-specified chain definitions.
+        uint64_t          packets = 0;     // Number of packets per measurement.
+        size_t            pid_count = 0;   // Number of elementary stream PID's in the synthetic mux.
+    };
+}
+
+Options::Options(int argc, char *argv[]) :
+    Args(u"Benchmark tsp plugin chains", u"[options] [chain-name ...]")
+{
+    option(u"", 0, STRING, 0, UNLIMITED_COUNT);
+    help(u"",
+         u"Names of the built-in plugin chains to benchmark, as displayed in the "
+         u"\"chain\" field of the output. The names are not case sensitive. "
+         u"By default, benchmark all built-in chains.");
+
+    option(u"chain", 'c', STRING, 0, UNLIMITED_COUNT);
+    help(u"chain", u"'plugin [options] | plugin [options] ...'",
+         u"Additional chain of packet processor plugins to benchmark. "
+         u"The plugins are separated by '|' characters, their options by spaces. "
+         u"Several --chain options may be specified.");
+
+    option(u"packets", 'p', POSITIVE);
+    help(u"packets",
+         u"Number of TS packets to push through each chain. The default is " +
+         ts::UString::Decimal(DEFAULT_PACKETS) + u" packets.");
+
+    option(u"pids", 0, INTEGER, 0, 1, 1, 100);
+    help(u"pids", u"count",
+         u"Number of elementary stream PID's in the synthetic multiplex. "
+         u"The default is " + ts::UString::Decimal(DEFAULT_PID_COUNT) + u" PID's.");
+
+    analyze(argc, argv);
+
+    getValues(chain_names);
+    getValues(user_chains, u"chain");
+    getIntValue(packets, u"packets", DEFAULT_PACKETS);
+    getIntValue(pid_count, u"pids", DEFAULT_PID_COUNT);
+
+    exitOnError();
+}
+
+
+//----------------------------------------------------------------------------
+// Synthetic multiplex: a repeatable cycle of packets with PAT, PMT and PES.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // PID allocation in the synthetic multiplex.
+    constexpr ts::PID PMT_PID = 100;
+    constexpr ts::PID FIRST_ES_PID = 101;
+
+    // The first elementary stream PID carries one PCR every that many of its packets.
+    constexpr size_t PCR_INTERVAL = 25;
+
+    // PCR increment per transport packet, the equivalent of a 38 Mb/s mux.
+    constexpr uint64_t PCR_PER_PACKET = (uint64_t(ts::PKT_SIZE_BITS) * ts::SYSTEM_CLOCK_FREQ) / 38'000'000;
+
+    // Build one cycle of the synthetic multiplex: the PSI tables, then a round
+    // robin of elementary stream packets. Continuity counters and PCR values
+    // are patched at delivery time, when the cycle repeats.
+    void BuildMuxCycle(ts::DuckContext& duck, size_t pid_count, ts::TSPacketVector& cycle)
+    {
+        cycle.clear();
+
+        // One service with all elementary streams.
+        ts::PAT pat;
+        pat.ts_id = 0x0001;
+        pat.pmts[0x0001] = PMT_PID;
+        ts::PMT pmt;
+        pmt.service_id = 0x0001;
+        pmt.pcr_pid = FIRST_ES_PID;
+        for (size_t i = 0; i < pid_count; ++i) {
+            pmt.streams[ts::PID(FIRST_ES_PID + i)].stream_type = i == 0 ? ts::ST_MPEG2_VIDEO : ts::ST_MPEG2_AUDIO;
+        }
+
+        // Packetize the tables at the start of the cycle.
+        ts::TSPacketVector table_packets;
+        ts::OneShotPacketizer pzer(duck, ts::PID_PAT, true);
+        pzer.addTable(duck, pat);
+        pzer.getPackets(table_packets);
+        cycle.insert(cycle.end(), table_packets.begin(), table_packets.end());
+        ts::OneShotPacketizer pzer2(duck, PMT_PID, true);
+        pzer2.addTable(duck, pmt);
+        pzer2.getPackets(table_packets);
+        cycle.insert(cycle.end(), table_packets.begin(), table_packets.end());
+
+        // Round robin of elementary stream packets between two table repetitions.
+        // The first ES PID periodically gets an adaptation field with a PCR.
+        for (size_t i = 0; i < pid_count * 100; ++i) {
+            ts::TSPacket pkt;
+            pkt.init(ts::PID(FIRST_ES_PID + i % pid_count), 0, 0xA5);
+            if (i % pid_count == 0 && (i / pid_count) % PCR_INTERVAL == 0) {
+                pkt.setPCR(0, true);
+            }
+            cycle.push_back(pkt);
+        }
+    }
+
+    // Event handler for the memory input plugin: deliver the requested number
+    // of packets from the multiplex cycle, fixing continuity counters and PCR.
+    class InputHandler: public ts::PluginEventHandlerInterface
+    {
+        TS_NOBUILD_NOCOPY(InputHandler);
+    public:
+        InputHandler(const ts::TSPacketVector& cycle, uint64_t total) : _cycle(cycle), _remaining(total) {}
+
+        uint64_t deliveredPackets() const { return _delivered; }
+
+        virtual void handlePluginEvent(const ts::PluginEventContext& context) override
+        {
+            ts::PluginEventData* data = dynamic_cast<ts::PluginEventData*>(context.pluginData());
+            if (data == nullptr || data->outputData() == nullptr) {
+                return;
+            }
+            while (_remaining > 0 && data->remainingSize() >= ts::PKT_SIZE) {
+                ts::TSPacket* const dest = reinterpret_cast<ts::TSPacket*>(data->outputData() + data->size());
+                *dest = _cycle[_next];
+                if (++_next >= _cycle.size()) {
+                    _next = 0;
+                }
+                dest->setCC(_cc[dest->getPID()]++ & ts::CC_MASK);
+                if (dest->hasPCR()) {
+                    dest->setPCR((_delivered * PCR_PER_PACKET) % ts::PCR_SCALE);
+                }
+                data->updateSize(data->size() + ts::PKT_SIZE);
+                _remaining--;
+                _delivered++;
+            }
+        }
+
+    private:
+        const ts::TSPacketVector& _cycle;
+        uint64_t _remaining;
+        uint64_t _delivered = 0;
+        size_t   _next = 0;
+        std::array<uint8_t, ts::PID_MAX> _cc {};
+    };
+
+    // Event handler for the memory output plugin: a null sink which counts
+    // and validates the packets it receives.
+    class OutputHandler: public ts::PluginEventHandlerInterface
+    {
+        TS_NOCOPY(OutputHandler);
+    public:
+        OutputHandler() = default;
+
+        uint64_t receivedPackets() const { return _received; }
+        uint64_t invalidPackets() const { return _invalid; }
+
+        virtual void handlePluginEvent(const ts::PluginEventContext& context) override
+        {
+            ts::PluginEventData* data = dynamic_cast<ts::PluginEventData*>(context.pluginData());
+            if (data != nullptr) {
+                const uint8_t* pkt = data->data();
+                const size_t count = data->size() / ts::PKT_SIZE;
+                for (size_t i = 0; i < count; ++i, pkt += ts::PKT_SIZE) {
+                    if (*pkt != ts::SYNC_BYTE) {
+                        _invalid++;
+                    }
+                }
+                _received += count;
+            }
+        }
+
+    private:
+        uint64_t _received = 0;
+        uint64_t _invalid = 0;
+    };
+}
+
+
+//----------------------------------------------------------------------------
+// Benchmarked chains.
+//----------------------------------------------------------------------------
+
+namespace {
+
+    // A benchmark case: a name and a chain of packet processor plugins.
+    struct BenchChain {
+        ts::UString             name;     // Chain name (in the output).
+        ts::PluginOptionsVector plugins;  // Packet processor plugins.
+    };
+
+    // The built-in chains. They only use stream features which are present in
+    // the synthetic multiplex (PAT, PMT, PCR's). The analysis report goes to a
+    // temporary file to keep the standard output parseable.
+    std::vector<BenchChain> BuiltinChains(const ts::UString& analyze_out)
+    {
+        return {
+            {u"baseline", {}},
+            {u"analyze", {{u"analyze", {u"--output-file", analyze_out}}}},
+            {u"remap-filter", {{u"filter", {u"--negate", u"--pid", u"8191"}},
+                               {u"remap", {ts::UString::Format(u"%d=%d", FIRST_ES_PID, 601)}}}},
+            {u"pcradjust", {{u"pcradjust", {}}}},
+            {u"scramble", {{u"scramble", {u"--pid", ts::UString::Format(u"%d", FIRST_ES_PID), u"--cw", u"0123456789ABCDEF"}}}},
+        };
+    }
+
+    // Parse a user-specified chain: plugins separated by '|', options by spaces.
+    bool ParseUserChain(const ts::UString& spec, BenchChain& chain, ts::Report& report)
+    {
+        chain.name = spec;
+        chain.plugins.clear();
+        ts::UStringVector plugins;
+        spec.split(plugins, u'|', true, true);
+        for (const auto& plugin : plugins) {
+            ts::UStringVector fields;
+            plugin.split(fields, u' ', true, true);
+            if (fields.empty()) {
+                report.error(u"empty plugin in chain '%s'", spec);
+                return false;
+            }
+            const ts::UString name(fields.front());
+            fields.erase(fields.begin());
+            chain.plugins.push_back({name, fields});
+        }
+        return true;
+    }
+
+    // Format the plugin chain as a one-line string for the output.
+    ts::UString ChainSpec(const ts::PluginOptionsVector& plugins)
+    {
+        ts::UString spec;
+        for (const auto& plugin : plugins) {
+            if (!spec.empty()) {
+                spec.append(u" | ");
+            }
+            spec.append(plugin.toString(ts::PluginType::PROCESSOR));
+        }
+        return spec;
+    }
+}
+
+
+//----------------------------------------------------------------------------
+// Program main code.
+//----------------------------------------------------------------------------
+
+int MainCode(int argc, char *argv[])
+{
+    Options opt(argc, argv);
+
+    // Build the synthetic multiplex cycle.
+    ts::DuckContext duck;
+    ts::TSPacketVector cycle;
+    BuildMuxCycle(duck, opt.pid_count, cycle);
+
+    // Build the list of chains to benchmark.
+    const fs::path analyze_out(ts::TempFile());
+    std::vector<BenchChain> chains;
+    for (const auto& chain : BuiltinChains(ts::UString(analyze_out))) {
+        if (opt.chain_names.empty() || chain.name.isContainedSimilarIn(opt.chain_names)) {
+            chains.push_back(chain);
+        }
+    }
+    for (const auto& spec : opt.user_chains) {
+        BenchChain chain;
+        if (!ParseUserChain(spec, chain, opt)) {
+            return EXIT_FAILURE;
+        }
+        chains.push_back(chain);
+    }
+
+    // Context line, one JSON object per line ("JSON lines" format).
+    std::cout << ts::UString::Format(u"{\"system\": \"%s\", \"accelerations\": \"%s\", \"packets\": %d, \"pids\": %d}",
+                                     ts::SysInfo::GetSystemVersion(), ts::SysInfo::GetAccelerations(), opt.packets, opt.pid_count)
+              << std::endl;
+
+    bool success = true;
+    for (const auto& chain : chains) {
+
+        // The plugin event handlers implement the synthetic input and the null sink.
+        InputHandler input(cycle, opt.packets);
+        OutputHandler output;
+
+        // Build the processing pipeline.
+        ts::AsyncReport report(opt.maxSeverity());
+        ts::TSProcessor tsp(report);
+        tsp.registerEventHandler(&input, ts::PluginType::INPUT);
+        tsp.registerEventHandler(&output, ts::PluginType::OUTPUT);
+
+        ts::TSProcessorArgs args;
+        args.app_name = u"tspipebench";
+        args.input = {u"memory", {}};
+        args.plugins = chain.plugins;
+        args.output = {u"memory", {}};
+        args.applyDefaults(false);
+
+        // Run the pipeline to completion and measure it.
+        const cn::milliseconds cpu_start = ts::GetProcessCpuTime();
+        const auto wall_start = cn::steady_clock::now();
+        if (!tsp.start(args)) {
+            opt.error(u"error starting chain '%s'", chain.name);
+            success = false;
+            continue;
+        }
+        tsp.waitForTermination();
+        const auto wall = cn::duration_cast<cn::microseconds>(cn::steady_clock::now() - wall_start);
+        const cn::milliseconds cpu = ts::GetProcessCpuTime() - cpu_start;
+
+        // Validate the counters of the null sink.
+        if (output.receivedPackets() == 0 || output.invalidPackets() != 0) {
+            opt.error(u"chain '%s' output %d packets, %d invalid, results are not reliable",
+                      chain.name, output.receivedPackets(), output.invalidPackets());
+            success = false;
+        }
+
+        const uint64_t pps = wall.count() <= 0 ? 0 : (input.deliveredPackets() * UINT64_C(1'000'000)) / uint64_t(wall.count());
+        std::cout << ts::UString::Format(u"{\"chain\": \"%s\", \"spec\": \"%s\", \"packets-in\": %d, \"packets-out\": %d, "
+                                         u"\"wall-microseconds\": %d, \"cpu-milliseconds\": %d, \"packets-per-second\": %d, \"mbits-per-second\": %d}",
+                                         chain.name, ChainSpec(chain.plugins), input.deliveredPackets(), output.receivedPackets(),
+                                         wall.count(), cpu.count(), pps, (pps * ts::PKT_SIZE_BITS) / 1'000'000)
+                  << std::endl;
+    }
+
+    // Cleanup the temporary analysis report.
+    fs::remove(analyze_out);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
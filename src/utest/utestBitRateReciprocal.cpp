@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for class ts::BitRateReciprocal
+//
+//----------------------------------------------------------------------------
+
+#include "tsBitRateReciprocal.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class BitRateReciprocalTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(Zero);
+    TSUNIT_DECLARE_TEST(Exact);
+    TSUNIT_DECLARE_TEST(Generic);
+    TSUNIT_DECLARE_TEST(LowBitRate);
+};
+
+TSUNIT_REGISTER(BitRateReciprocalTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+TSUNIT_DEFINE_TEST(Zero)
+{
+    ts::BitRateReciprocal rec;
+
+    TSUNIT_EQUAL(0, rec.bitrate().toInt());
+    TSUNIT_EQUAL(0, rec.packetInterval(1000).count());
+    TSUNIT_EQUAL(0, rec.byteInterval(1000).count());
+    TSUNIT_EQUAL(0, rec.packetPCRInterval(1000));
+    TSUNIT_EQUAL(0, rec.bitsDuring(cn::seconds(1)));
+
+    rec.setBitRate(38'400'000);
+    TSUNIT_EQUAL(38'400'000, rec.bitrate().toInt());
+    rec.setBitRate(0);
+    TSUNIT_EQUAL(0, rec.packetInterval(1000).count());
+    TSUNIT_EQUAL(0, rec.bitsDuring(cn::seconds(1)));
+}
+
+TSUNIT_DEFINE_TEST(Exact)
+{
+    // At 1 Gb/s, one bit lasts exactly one nanosecond.
+    ts::BitRateReciprocal rec(1'000'000'000);
+
+    TSUNIT_EQUAL(1'000'000'000, rec.bitrate().toInt());
+    TSUNIT_EQUAL(1504, rec.packetInterval(1).count());
+    TSUNIT_EQUAL(15'040'000, rec.packetInterval(10'000).count());
+    TSUNIT_EQUAL(800, rec.byteInterval(100).count());
+    TSUNIT_EQUAL(1'000'000'000, rec.bitsDuring(cn::seconds(1)));
+    TSUNIT_EQUAL(1'000'000'000, rec.bitsDuring(cn::seconds(-1)));
+}
+
+TSUNIT_DEFINE_TEST(Generic)
+{
+    // The cached factors shall track the generic functions within a few units of rounding.
+    const ts::BitRate bitrate = 38'400'000;
+    ts::BitRateReciprocal rec(bitrate);
+
+    const int64_t interval = rec.packetInterval(1000).count();
+    const int64_t ref_interval = ts::PacketInterval<cn::nanoseconds>(bitrate, 1000).count();
+    TSUNIT_ASSERT(std::abs(interval - ref_interval) <= 2);
+
+    const int64_t bits = rec.bitsDuring(cn::milliseconds(250));
+    const int64_t ref_bits = ts::BitDistance(1, bitrate, cn::nanoseconds(cn::milliseconds(250)));
+    TSUNIT_ASSERT(std::abs(bits - ref_bits) <= 2);
+
+    const int64_t pcr = int64_t(rec.packetPCRInterval(1000));
+    const int64_t ref_pcr = ((1000 * ts::PKT_SIZE_BITS * uint64_t(ts::SYSTEM_CLOCK_FREQ)) / bitrate).toInt();
+    TSUNIT_ASSERT(std::abs(pcr - ref_pcr) <= 2);
+}
+
+TSUNIT_DEFINE_TEST(LowBitRate)
+{
+    // The reciprocal factors must keep their precision below 1 Gb/s, whatever
+    // the compile-time representation of BitRate. A "bits per nanosecond"
+    // factor stored as an integer or fixed-point BitRate would truncate to
+    // zero here and bitsDuring() would never return any bit credit.
+    ts::BitRateReciprocal rec(38'000'000);
+
+    TSUNIT_EQUAL(38'000, rec.bitsDuring(cn::milliseconds(1)));
+    TSUNIT_EQUAL(38'000'000, rec.bitsDuring(cn::seconds(1)));
+
+    // 1504 bits at 38 Mb/s: 39578.9... ns, more precise than the 26 vs 26.32
+    // ns/bit truncation of an integer "nanoseconds per bit" factor.
+    TSUNIT_EQUAL(39'579, rec.packetInterval(1).count());
+    TSUNIT_EQUAL(39'578'947, rec.packetInterval(1000).count());
+
+    // Very low bitrate, outside any realistic TS, still non-zero.
+    rec.setBitRate(10'000);
+    TSUNIT_EQUAL(10, rec.bitsDuring(cn::milliseconds(1)));
+    TSUNIT_EQUAL(150'400'000, rec.packetInterval(1).count());
+}
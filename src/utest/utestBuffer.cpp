@@ -66,6 +66,7 @@ class BufferTest: public tsunit::Test
     TSUNIT_DECLARE_TEST(PutBCD);
     TSUNIT_DECLARE_TEST(GetBCD);
     TSUNIT_DECLARE_TEST(TryGetASCII);
+    TSUNIT_DECLARE_TEST(GetBytesView);
     TSUNIT_DECLARE_TEST(GetUTF8);
     TSUNIT_DECLARE_TEST(GetUTF8WithLength);
     TSUNIT_DECLARE_TEST(GetUTF16);
@@ -1173,6 +1174,38 @@ TSUNIT_DEFINE_TEST(TryGetASCII)
     TSUNIT_EQUAL(15, b.currentReadByteOffset());
 }
 
+TSUNIT_DEFINE_TEST(GetBytesView)
+{
+    ts::Buffer b(_bytes1, 16);
+    TSUNIT_ASSERT(b.readOnly());
+
+    const auto v1(b.getBytesView(4));
+    TSUNIT_ASSERT(!b.readError());
+    TSUNIT_EQUAL(4, v1.size());
+    TSUNIT_EQUAL(_bytes1, v1.data());
+    TSUNIT_EQUAL(0x03, v1[3]);
+    TSUNIT_EQUAL(4, b.currentReadByteOffset());
+
+    const auto v2(b.getBytesView());
+    TSUNIT_ASSERT(!b.readError());
+    TSUNIT_EQUAL(12, v2.size());
+    TSUNIT_EQUAL(_bytes1 + 4, v2.data());
+    TSUNIT_EQUAL(0x0F, v2[11]);
+    TSUNIT_EQUAL(16, b.currentReadByteOffset());
+    TSUNIT_ASSERT(b.endOfRead());
+
+    const auto v3(b.getBytesView(2));
+    TSUNIT_ASSERT(b.readError());
+    TSUNIT_EQUAL(0, v3.size());
+
+    // A view cannot start on a partially read byte.
+    ts::Buffer b2(_bytes1, 16);
+    b2.skipBits(3);
+    const auto v4(b2.getBytesView(2));
+    TSUNIT_ASSERT(b2.readError());
+    TSUNIT_EQUAL(0, v4.size());
+}
+
 TSUNIT_DEFINE_TEST(GetUTF8)
 {
     static const char mem[] = "abcdefgh";
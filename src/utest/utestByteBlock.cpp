@@ -261,4 +261,11 @@ TSUNIT_DEFINE_TEST(File)
 
     TSUNIT_EQUAL(999, bb1.size());
     TSUNIT_ASSERT(bb1 == bb);
+
+    // Partial load, the maximum size shall be honored.
+    ts::ByteBlock bb2;
+    TSUNIT_ASSERT(bb2.loadFromFile(_tempFileName, 100));
+
+    TSUNIT_EQUAL(100, bb2.size());
+    TSUNIT_ASSERT(std::equal(bb2.begin(), bb2.end(), bb.begin()));
 }
@@ -11,6 +11,9 @@
 //----------------------------------------------------------------------------
 
 #include "tsChannelFile.h"
+#include "tsConfigCacheFile.h"
+#include "tsFileUtils.h"
+#include "tsErrCodeReport.h"
 #include "tsNullReport.h"
 #include "tsunit.h"
 
@@ -22,6 +25,7 @@
 class ChannelsTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(Text);
+    TSUNIT_DECLARE_TEST(BinaryCache);
 };
 
 TSUNIT_REGISTER(ChannelsTest);
@@ -187,3 +191,45 @@ TSUNIT_DEFINE_TEST(Text)
 
     TSUNIT_EQUAL(document, channels.toXML());
 }
+
+TSUNIT_DEFINE_TEST(BinaryCache)
+{
+    static const ts::UChar* const document =
+        u"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        u"<tsduck>\n"
+        u"  <network id=\"0x1234\" type=\"ATSC\">\n"
+        u"    <ts id=\"0x5678\" onid=\"0x9ABC\">\n"
+        u"      <atsc frequency=\"123,456\" modulation=\"16-VSB\"/>\n"
+        u"      <service id=\"0x0002\" name=\"Foo Channel\" provider=\"Foo Provider\" LCN=\"23\" PMTPID=\"0x0789\" type=\"0x12\" cas=\"true\" atsc_major_id=\"1\" atsc_minor_id=\"4\"/>\n"
+        u"    </ts>\n"
+        u"  </network>\n"
+        u"  <network id=\"0x8753\" type=\"DVB-S\">\n"
+        u"    <ts id=\"0x8793\" onid=\"0x5896\">\n"
+        u"      <dvbs frequency=\"8,523,698\" symbolrate=\"1,237,418\" modulation=\"8-PSK\" system=\"DVB-S2\" polarity=\"horizontal\" FEC=\"7/8\" pilots=\"on\" rolloff=\"0.35\"/>\n"
+        u"      <service id=\"0x4591\" name=\"Foo Channel\"/>\n"
+        u"    </ts>\n"
+        u"  </network>\n"
+        u"</tsduck>\n"
+        u"";
+
+    const ts::UString xmlName(ts::TempFile(u".xml"));
+    const ts::UString binName(ts::ConfigCacheFile::CacheName(xmlName));
+
+    ts::ChannelFile channels;
+    TSUNIT_ASSERT(channels.parse(document));
+    TSUNIT_ASSERT(channels.save(xmlName));
+
+    // The first load parses the XML file and creates the binary cache next to it.
+    ts::ChannelFile file1;
+    TSUNIT_ASSERT(file1.load(xmlName));
+    TSUNIT_ASSERT(fs::exists(binName));
+    TSUNIT_EQUAL(document, file1.toXML());
+
+    // The second load uses the binary cache and rebuilds the same content.
+    ts::ChannelFile file2;
+    TSUNIT_ASSERT(file2.load(xmlName));
+    TSUNIT_EQUAL(document, file2.toXML());
+
+    fs::remove(xmlName, &ts::ErrCodeReport());
+    fs::remove(binName, &ts::ErrCodeReport());
+}
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for ts::HexDump
+//
+//----------------------------------------------------------------------------
+
+#include "tsHexDump.h"
+#include "tsByteBlock.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class HexDumpTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(SameAsUString);
+    TSUNIT_DECLARE_TEST(SingleLine);
+};
+
+TSUNIT_REGISTER(HexDumpTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+// The fast formatter shall produce exactly the same output as UString::Dump(),
+// including on the fallback flag combinations.
+TSUNIT_DEFINE_TEST(SameAsUString)
+{
+    ts::ByteBlock data(300);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = uint8_t(5 * i + 1);
+    }
+
+    static const uint32_t flags_list[] = {
+        ts::UString::HEXA,
+        ts::UString::HEXA | ts::UString::ASCII,
+        ts::UString::HEXA | ts::UString::ASCII | ts::UString::OFFSET,
+        ts::UString::HEXA | ts::UString::ASCII | ts::UString::OFFSET | ts::UString::WIDE_OFFSET,
+        ts::UString::HEXA | ts::UString::BPL | ts::UString::WIDE_OFFSET,
+        ts::UString::HEXA | ts::UString::ASCII | ts::UString::OFFSET | ts::UString::BPL,
+        ts::UString::HEXA | ts::UString::BINARY,  // fallback path
+        ts::UString::C_STYLE,                     // fallback path
+    };
+
+    for (const uint32_t flags : flags_list) {
+        for (const size_t size : {size_t(1), size_t(15), size_t(16), size_t(300)}) {
+            const size_t bpl = (flags & ts::UString::BPL) != 0 ? 16 : ts::UString::DEFAULT_HEXA_LINE_WIDTH;
+            std::ostringstream strm;
+            ts::HexDump(strm, data.data(), size, flags, 2, bpl, 0x1234);
+            const std::string reference(ts::UString::Dump(data.data(), size, flags, 2, bpl, 0x1234).toUTF8());
+            TSUNIT_EQUAL(reference, strm.str());
+        }
+    }
+}
+
+TSUNIT_DEFINE_TEST(SingleLine)
+{
+    static const uint8_t data[] = {0x47, 0x1F, 0xFF, 0x10};
+
+    std::ostringstream strm1;
+    ts::HexDump(strm1, data, sizeof(data), ts::UString::SINGLE_LINE);
+    TSUNIT_EQUAL("47 1F FF 10", strm1.str());
+
+    std::ostringstream strm2;
+    ts::HexDump(strm2, data, sizeof(data), ts::UString::COMPACT);
+    TSUNIT_EQUAL("471FFF10", strm2.str());
+}
@@ -13,6 +13,8 @@
 #include "tsKeyTable.h"
 #include "tsCerrReport.h"
 #include "tsNullReport.h"
+#include "tsFileUtils.h"
+#include "tsErrCodeReport.h"
 #include "tsunit.h"
 
 
@@ -23,11 +25,39 @@
 class KeyTableTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(XML);
+    TSUNIT_DECLARE_TEST(Binary);
+
+public:
+    virtual void beforeTest() override;
+    virtual void afterTest() override;
+
+private:
+    ts::UString _tempFileName {};
 };
 
 TSUNIT_REGISTER(KeyTableTest);
 
 
+//----------------------------------------------------------------------------
+// Initialization.
+//----------------------------------------------------------------------------
+
+// Test suite initialization method.
+void KeyTableTest::beforeTest()
+{
+    if (_tempFileName.empty()) {
+        _tempFileName = ts::TempFile(u".tmp.keys");
+    }
+    fs::remove(_tempFileName, &ts::ErrCodeReport());
+}
+
+// Test suite cleanup method.
+void KeyTableTest::afterTest()
+{
+    fs::remove(_tempFileName, &ts::ErrCodeReport());
+}
+
+
 //----------------------------------------------------------------------------
 // Unitary tests.
 //----------------------------------------------------------------------------
@@ -69,3 +99,32 @@ TSUNIT_DEFINE_TEST(XML)
     TSUNIT_ASSERT(table.getKey(u"5A99C9E8CB9A81EEAE80C69BFB55B4B6", value));
     TSUNIT_EQUAL(u"D9F91156DC9FC5B6E679C3E1ED8B6667", ts::UString::Dump(value, ts::UString::COMPACT));
 }
+
+TSUNIT_DEFINE_TEST(Binary)
+{
+    ts::KeyTable table;
+    TSUNIT_ASSERT(table.storeKey(u"5A99C9E8CB9A81EEAE80C69BFB55B4B6", u"D9F91156DC9FC5B6E679C3E1ED8B6667", true));
+    TSUNIT_ASSERT(table.storeKey(u"7A77C81AF4E1EE0E94DB6A0C359F2E71", u"C01BEF7E15D7AFD2B4CBB0A696892899", true));
+    TSUNIT_ASSERT(table.storeKey(u"D1CDB386C4AFCEF329A987B93D913140", u"2974B88317CAE2DCECA19BE408376B7D", true));
+    TSUNIT_EQUAL(3, table.size());
+
+    TSUNIT_ASSERT(table.saveBinaryFile(CERR, _tempFileName));
+
+    ts::KeyTable table2;
+    TSUNIT_ASSERT(table2.loadBinaryFile(CERR, _tempFileName, true, 16, 16));
+    TSUNIT_EQUAL(3, table2.size());
+
+    ts::ByteBlock value;
+    TSUNIT_ASSERT(table2.getKey(u"5A99C9E8CB9A81EEAE80C69BFB55B4B6", value));
+    TSUNIT_EQUAL(u"D9F91156DC9FC5B6E679C3E1ED8B6667", ts::UString::Dump(value, ts::UString::COMPACT));
+    TSUNIT_ASSERT(table2.getKey(u"D1CDB386C4AFCEF329A987B93D913140", value));
+    TSUNIT_EQUAL(u"2974B88317CAE2DCECA19BE408376B7D", ts::UString::Dump(value, ts::UString::COMPACT));
+    TSUNIT_ASSERT(!table2.getKey(u"2299C9E8CB9A81EEAE80C69BFB55B4B6", value));
+
+    // Do not replace existing keys on reload.
+    TSUNIT_ASSERT(table2.storeKey(u"5A99C9E8CB9A81EEAE80C69BFB55B4B6", u"210C502F2FFDCA98587DBA7C9082F1A1", true));
+    TSUNIT_ASSERT(table2.loadBinaryFile(CERR, _tempFileName, false, 16, 16));
+    TSUNIT_EQUAL(3, table2.size());
+    TSUNIT_ASSERT(table2.getKey(u"5A99C9E8CB9A81EEAE80C69BFB55B4B6", value));
+    TSUNIT_EQUAL(u"210C502F2FFDCA98587DBA7C9082F1A1", ts::UString::Dump(value, ts::UString::COMPACT));
+}
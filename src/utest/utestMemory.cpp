@@ -638,6 +638,11 @@ TSUNIT_DEFINE_TEST(LocateZeroZero)
     TSUNIT_ASSERT(ts::LocateZeroZero(data2, sizeof(data2), 7) == data2);
     TSUNIT_ASSERT(ts::LocateZeroZero(data2, sizeof(data2), 12) == data2 + 61);
     TSUNIT_ASSERT(ts::LocateZeroZero(data2, sizeof(data2) - 1, 12) == nullptr);
+    TSUNIT_ASSERT(ts::LocateZeroZero(data1, sizeof(data1), 7, 9) == nullptr);
+    TSUNIT_ASSERT(ts::LocateZeroZero(data1, sizeof(data1), 7, 1) == data1 + 21);
+    TSUNIT_ASSERT(ts::LocateZeroZero(data1, sizeof(data1), 1, 7) == data1 + 21);
+    TSUNIT_ASSERT(ts::LocateZeroZero(data2, sizeof(data2), 12, 7) == data2);
+    TSUNIT_ASSERT(ts::LocateZeroZero(data2, sizeof(data2) - 1, 12, 9) == nullptr);
 }
 
 TSUNIT_DEFINE_TEST(Xor)
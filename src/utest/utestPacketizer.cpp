@@ -32,6 +32,7 @@
 class PacketizerTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(Packetizer);
+    TSUNIT_DECLARE_TEST(CycleCache);
 
 private:
     // Demux one table from a list of packets
@@ -132,3 +133,58 @@ TSUNIT_DEFINE_TEST(Packetizer)
     TSUNIT_ASSERT(pmt_count == 4);
     TSUNIT_ASSERT(sdt_count >= 12 && sdt_count <= 18);
 }
+
+TSUNIT_DEFINE_TEST(CycleCache)
+{
+    // Build a static carousel (unscheduled sections only). After the first
+    // cycle, the packets come from the internal cache and must be identical
+    // to the first cycle, except for the continuity counters.
+
+    ts::DuckContext duck;
+    ts::BinaryTablePtr binpat;
+    ts::BinaryTablePtr binpmt;
+
+    DemuxTable(binpat, "PAT", psi_pat_r4_packets, sizeof(psi_pat_r4_packets));
+    DemuxTable(binpmt, "PMT", psi_pmt_planete_packets, sizeof(psi_pmt_planete_packets));
+
+    ts::CyclingPacketizer pzer(duck, ts::PID_PAT, ts::CyclingPacketizer::StuffingPolicy::AT_END);
+    pzer.addTable(*binpat);
+    pzer.addTable(*binpmt);
+
+    // Generate the first cycle and keep its packets.
+    std::vector<ts::TSPacket> first_cycle;
+    do {
+        ts::TSPacket pkt;
+        TSUNIT_ASSERT(pzer.getNextPacket(pkt));
+        first_cycle.push_back(pkt);
+        TSUNIT_ASSERT(first_cycle.size() < 100); // no endless loop on test failure
+    } while (!pzer.atCycleBoundary());
+
+    // Generate two more cycles, they must replay the first one.
+    uint8_t expected_cc = first_cycle.back().getCC();
+    for (size_t cycle = 0; cycle < 2; ++cycle) {
+        for (size_t pi = 0; pi < first_cycle.size(); ++pi) {
+            ts::TSPacket pkt;
+            TSUNIT_ASSERT(pzer.getNextPacket(pkt));
+            TSUNIT_EQUAL(expected_cc = (expected_cc + 1) & 0x0F, pkt.getCC());
+            ts::TSPacket ref(first_cycle[pi]);
+            ref.setCC(pkt.getCC());
+            TSUNIT_ASSERT(ts::MemEqual(pkt.b, ref.b, ts::PKT_SIZE));
+            TSUNIT_EQUAL(pi == first_cycle.size() - 1, pzer.atCycleBoundary());
+        }
+    }
+
+    // Removing a table invalidates the cache: the next cycle no longer contains the PMT.
+    pzer.removeSections(ts::TID_PMT);
+    size_t pmt_count = 0;
+    size_t packet_count = 0;
+    do {
+        ts::TSPacket pkt;
+        TSUNIT_ASSERT(pzer.getNextPacket(pkt));
+        if (pkt.getPUSI() && pkt.b[5] == ts::TID_PMT) {
+            pmt_count++;
+        }
+        TSUNIT_ASSERT(++packet_count < 100); // no endless loop on test failure
+    } while (!pzer.atCycleBoundary());
+    TSUNIT_EQUAL(0, pmt_count);
+}
@@ -0,0 +1,64 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for class ts::SectionBufferPool
+//
+//----------------------------------------------------------------------------
+
+#include "tsSectionBufferPool.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class SectionBufferPoolTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(Get);
+    TSUNIT_DECLARE_TEST(GetData);
+    TSUNIT_DECLARE_TEST(Recycle);
+};
+
+TSUNIT_REGISTER(SectionBufferPoolTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+TSUNIT_DEFINE_TEST(Get)
+{
+    const ts::ByteBlockPtr buf(ts::SectionBufferPool::Instance().get(100));
+    TSUNIT_ASSERT(buf != nullptr);
+    TSUNIT_EQUAL(100, buf->size());
+}
+
+TSUNIT_DEFINE_TEST(GetData)
+{
+    static const uint8_t data[] = {0x12, 0x34, 0x56, 0x78};
+    const ts::ByteBlockPtr buf(ts::SectionBufferPool::Instance().get(data, sizeof(data)));
+    TSUNIT_ASSERT(buf != nullptr);
+    TSUNIT_EQUAL(sizeof(data), buf->size());
+    TSUNIT_ASSERT(*buf == ts::ByteBlock(data, sizeof(data)));
+}
+
+TSUNIT_DEFINE_TEST(Recycle)
+{
+    // Get a buffer, remember its storage address, release it, get another one
+    // of the same size. The pool is a LIFO, the storage must be recycled.
+    ts::ByteBlockPtr buf(ts::SectionBufferPool::Instance().get(500));
+    TSUNIT_ASSERT(buf != nullptr);
+    const ts::ByteBlock* const block = buf.get();
+    buf.reset();
+
+    buf = ts::SectionBufferPool::Instance().get(500);
+    TSUNIT_ASSERT(buf != nullptr);
+    TSUNIT_EQUAL(500, buf->size());
+    TSUNIT_ASSERT(buf.get() == block);
+}
@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for class ts::SharedMemoryRing
+//
+//----------------------------------------------------------------------------
+
+#include "tsSharedMemoryRing.h"
+#include "tsNullReport.h"
+#include "tsUID.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class SharedMemoryRingTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(ProducerConsumer);
+    TSUNIT_DECLARE_TEST(WrapUp);
+};
+
+TSUNIT_REGISTER(SharedMemoryRingTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+TSUNIT_DEFINE_TEST(ProducerConsumer)
+{
+    const ts::UString name(ts::UString::Format(u"utest-ring-%d", ts::UID()));
+
+    // Not created yet, the consumer cannot open it.
+    ts::SharedMemoryRing reader;
+    TSUNIT_ASSERT(!reader.open(name, NULLREP));
+
+    // Create the ring, then open it from a second object, as another process would.
+    ts::SharedMemoryRing writer;
+    TSUNIT_ASSERT(writer.create(name, 16, NULLREP));
+    TSUNIT_ASSERT(writer.isOpen());
+    TSUNIT_EQUAL(16, writer.ringPackets());
+    TSUNIT_ASSERT(reader.open(name, NULLREP));
+    TSUNIT_EQUAL(16, reader.ringPackets());
+    TSUNIT_ASSERT(!reader.endOfStream());
+
+    // Write 10 packets with distinct PID's and labels.
+    ts::TSPacket packets[16];
+    ts::TSPacketMetadata mdata[16];
+    for (size_t i = 0; i < 10; ++i) {
+        packets[i].init(ts::PID(100 + i));
+        mdata[i].setLabel(uint32_t(i % ts::TSPacketLabelSet::SIZE));
+    }
+    TSUNIT_EQUAL(10, writer.writePackets(packets, mdata, 10));
+
+    // Read them back, in two batches.
+    ts::TSPacket rpackets[16];
+    ts::TSPacketMetadata rmdata[16];
+    TSUNIT_EQUAL(4, reader.readPackets(rpackets, rmdata, 4));
+    TSUNIT_EQUAL(6, reader.readPackets(rpackets + 4, rmdata + 4, 16));
+    TSUNIT_EQUAL(0, reader.readPackets(rpackets, rmdata, 16));
+    for (size_t i = 0; i < 10; ++i) {
+        TSUNIT_EQUAL(ts::PID(100 + i), rpackets[i].getPID());
+        TSUNIT_ASSERT(rmdata[i].hasLabel(uint32_t(i % ts::TSPacketLabelSet::SIZE)));
+    }
+
+    // End of stream is seen when the ring is drained.
+    writer.setEndOfStream();
+    TSUNIT_ASSERT(reader.endOfStream());
+    writer.close(NULLREP);
+    reader.close(NULLREP);
+    TSUNIT_ASSERT(!writer.isOpen());
+    TSUNIT_ASSERT(!reader.isOpen());
+}
+
+TSUNIT_DEFINE_TEST(WrapUp)
+{
+    const ts::UString name(ts::UString::Format(u"utest-ring-wrap-%d", ts::UID()));
+
+    ts::SharedMemoryRing writer;
+    ts::SharedMemoryRing reader;
+    TSUNIT_ASSERT(writer.create(name, 8, NULLREP));
+    TSUNIT_ASSERT(reader.open(name, NULLREP));
+
+    // Fill the ring, the 9th packet does not fit.
+    ts::TSPacket packets[9];
+    for (size_t i = 0; i < 9; ++i) {
+        packets[i].init(ts::PID(200 + i));
+    }
+    TSUNIT_EQUAL(8, writer.writePackets(packets, nullptr, 9));
+    TSUNIT_EQUAL(0, writer.writePackets(packets + 8, nullptr, 1));
+
+    // Drain 5 packets, then write across the end of the ring.
+    ts::TSPacket rpackets[9];
+    TSUNIT_EQUAL(5, reader.readPackets(rpackets, nullptr, 5));
+    TSUNIT_EQUAL(5, writer.writePackets(packets, nullptr, 9));
+    TSUNIT_EQUAL(8, reader.readPackets(rpackets, nullptr, 9));
+    TSUNIT_EQUAL(ts::PID(205), rpackets[0].getPID());
+    TSUNIT_EQUAL(ts::PID(200), rpackets[3].getPID());
+    TSUNIT_EQUAL(ts::PID(204), rpackets[7].getPID());
+
+    writer.close(NULLREP);
+    reader.close(NULLREP);
+}
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for class ts::SpliceInformationTable
+//
+//----------------------------------------------------------------------------
+
+#include "tsSpliceInformationTable.h"
+#include "tsBinaryTable.h"
+#include "tsDuckContext.h"
+#include "tsCRC32.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class SpliceInformationTableTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(PatchPTSAdjustment);
+};
+
+TSUNIT_REGISTER(SpliceInformationTableTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+TSUNIT_DEFINE_TEST(PatchPTSAdjustment)
+{
+    ts::DuckContext duck;
+
+    // Build a reference splice information section with a time_signal command.
+    ts::SpliceInformationTable sit;
+    sit.pts_adjustment = 0;
+    sit.splice_command_type = ts::SPLICE_TIME_SIGNAL;
+    sit.time_signal = 0x000012345678;
+
+    ts::BinaryTable bin;
+    TSUNIT_ASSERT(sit.serialize(duck, bin));
+    TSUNIT_ASSERT(bin.isValid());
+    TSUNIT_EQUAL(1, bin.sectionCount());
+
+    // Patch the pts_adjustment in place, using a 33-bit value.
+    ts::Section sec(*bin.sectionAt(0), ts::ShareMode::COPY);
+    const uint64_t adjust = 0x123456789;
+    TSUNIT_ASSERT(ts::SpliceInformationTable::PatchPTSAdjustment(sec, adjust));
+    TSUNIT_ASSERT(sec.isValid());
+
+    // The trailing CRC32 must be valid after patching. A splice information
+    // section is a short section, its CRC32 is part of the payload.
+    TSUNIT_EQUAL(uint32_t(ts::CRC32(sec.content(), sec.size() - 4)), ts::GetUInt32(sec.content() + sec.size() - 4));
+
+    // Reload the patched section with CRC check and deserialize it.
+    ts::BinaryTable bin2;
+    TSUNIT_ASSERT(bin2.addNewSection(sec.content(), sec.size(), ts::PID_NULL, ts::CRC32::CHECK));
+    const ts::SpliceInformationTable sit2(duck, bin2);
+    TSUNIT_ASSERT(sit2.isValid());
+    TSUNIT_EQUAL(adjust, sit2.pts_adjustment);
+    TSUNIT_EQUAL(ts::SPLICE_TIME_SIGNAL, sit2.splice_command_type);
+    TSUNIT_ASSERT(sit2.time_signal.has_value());
+    TSUNIT_EQUAL(0x000012345678, sit2.time_signal.value());
+
+    // A section with encrypted commands cannot be patched.
+    ts::Section enc(*bin.sectionAt(0), ts::ShareMode::COPY);
+    enc.setUInt8(1, uint8_t(enc.payload()[1] | 0x80), false);
+    TSUNIT_ASSERT(!ts::SpliceInformationTable::PatchPTSAdjustment(enc, adjust));
+}
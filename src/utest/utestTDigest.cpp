@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//
+// TSDuck - The MPEG Transport Stream Toolkit
+// Copyright (c) 2005-2025, Thierry Lelegard
+// BSD-2-Clause license, see LICENSE.txt file or https://tsduck.io/license
+//
+//----------------------------------------------------------------------------
+//
+//  TSUnit test suite for class ts::TDigest
+//
+//----------------------------------------------------------------------------
+
+#include "tsTDigest.h"
+#include "tsunit.h"
+
+
+//----------------------------------------------------------------------------
+// The test fixture
+//----------------------------------------------------------------------------
+
+class TDigestTest: public tsunit::Test
+{
+    TSUNIT_DECLARE_TEST(Empty);
+    TSUNIT_DECLARE_TEST(Small);
+    TSUNIT_DECLARE_TEST(Uniform);
+    TSUNIT_DECLARE_TEST(Reset);
+};
+
+TSUNIT_REGISTER(TDigestTest);
+
+
+//----------------------------------------------------------------------------
+// Unitary tests.
+//----------------------------------------------------------------------------
+
+TSUNIT_DEFINE_TEST(Empty)
+{
+    ts::TDigest dig;
+
+    TSUNIT_EQUAL(0, dig.count());
+    TSUNIT_EQUAL(0.0, dig.minimum());
+    TSUNIT_EQUAL(0.0, dig.maximum());
+    TSUNIT_EQUAL(0.0, dig.quantile(0.5));
+}
+
+TSUNIT_DEFINE_TEST(Small)
+{
+    ts::TDigest dig;
+
+    dig.feed(42.0);
+    TSUNIT_EQUAL(1, dig.count());
+    TSUNIT_EQUAL(42.0, dig.quantile(0.0));
+    TSUNIT_EQUAL(42.0, dig.quantile(0.5));
+    TSUNIT_EQUAL(42.0, dig.quantile(1.0));
+
+    dig.feed(10.0);
+    TSUNIT_EQUAL(2, dig.count());
+    TSUNIT_EQUAL(10.0, dig.minimum());
+    TSUNIT_EQUAL(42.0, dig.maximum());
+    TSUNIT_EQUAL(10.0, dig.quantile(0.0));
+    TSUNIT_EQUAL(42.0, dig.quantile(1.0));
+}
+
+TSUNIT_DEFINE_TEST(Uniform)
+{
+    ts::TDigest dig;
+
+    // Deterministic pseudo-random permutation of 0..99999 (100003 is prime).
+    constexpr size_t total = 100'000;
+    for (size_t i = 0; i < total; ++i) {
+        dig.feed(double((i * 48271) % 100'003 % total));
+    }
+
+    debug() << "TDigestTest::testUniform(): p50: " << dig.quantileString(0.50)
+            << ", p99: " << dig.quantileString(0.99)
+            << ", p999: " << dig.quantileString(0.999)
+            << std::endl;
+
+    TSUNIT_EQUAL(total, dig.count());
+    TSUNIT_EQUAL(0.0, dig.minimum());
+    TSUNIT_EQUAL(double(total - 1), dig.maximum());
+
+    // The exact quantile of a uniform distribution over 0..99999 is q * 100000.
+    // Allow a 1% relative error on the estimations.
+    TSUNIT_ASSERT(std::abs(dig.quantile(0.50) - 50'000.0) < 500.0);
+    TSUNIT_ASSERT(std::abs(dig.quantile(0.99) - 99'000.0) < 990.0);
+    TSUNIT_ASSERT(std::abs(dig.quantile(0.999) - 99'900.0) < 999.0);
+}
+
+TSUNIT_DEFINE_TEST(Reset)
+{
+    ts::TDigest dig;
+
+    dig.feed(1.0);
+    dig.feed(2.0);
+    dig.reset();
+
+    TSUNIT_EQUAL(0, dig.count());
+    TSUNIT_EQUAL(0.0, dig.quantile(0.5));
+
+    dig.feed(7.0);
+    TSUNIT_EQUAL(1, dig.count());
+    TSUNIT_EQUAL(7.0, dig.quantile(0.5));
+}
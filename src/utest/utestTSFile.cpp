@@ -30,6 +30,9 @@ class TSFileTest: public tsunit::Test
     TSUNIT_DECLARE_TEST(Duck);
     TSUNIT_DECLARE_TEST(StuffingRead);
     TSUNIT_DECLARE_TEST(StuffingWrite);
+    TSUNIT_DECLARE_TEST(AsyncIO);
+    TSUNIT_DECLARE_TEST(MemoryMap);
+    TSUNIT_DECLARE_TEST(Compressed);
 
 public:
     virtual void beforeTest() override;
@@ -358,3 +361,136 @@ TSUNIT_DEFINE_TEST(StuffingWrite)
     TSUNIT_EQUAL(184, packets[5].getPayloadSize());
     TSUNIT_EQUAL(0xFF, packets[5].getPayload()[0]);
 }
+
+TSUNIT_DEFINE_TEST(AsyncIO)
+{
+    // Write the file with the asynchronous I/O engine. On platforms or kernels
+    // without a supported interface, TSFile transparently uses synchronous I/O
+    // and the test remains valid.
+    ts::TSFile out;
+    out.setAsyncIO(true);
+    TSUNIT_ASSERT(!fs::exists(_tempFileName));
+    TSUNIT_ASSERT(out.open(_tempFileName, ts::TSFile::WRITE, CERR));
+
+    ts::TSPacketVector packets(500);
+    for (size_t i = 0; i < packets.size(); ++i) {
+        packets[i] = ts::NullPacket;
+        packets[i].setPID(ts::PID(i % 1000));
+    }
+    TSUNIT_ASSERT(out.writePackets(packets.data(), nullptr, packets.size(), CERR));
+    TSUNIT_ASSERT(out.close(CERR));
+    TSUNIT_EQUAL(packets.size() * ts::PKT_SIZE, fs::file_size(_tempFileName, &ts::ErrCodeReport(CERR)));
+
+    // Read it back with the asynchronous I/O engine, with two repetitions.
+    ts::TSFile in;
+    in.setAsyncIO(true);
+    TSUNIT_ASSERT(in.openRead(_tempFileName, 2, 0, CERR));
+
+    ts::TSPacketVector inpackets(2 * packets.size());
+    size_t count = 0;
+    while (count < inpackets.size()) {
+        const size_t more = in.readPackets(&inpackets[count], nullptr, std::min<size_t>(17, inpackets.size() - count), CERR);
+        if (more == 0) {
+            break;
+        }
+        count += more;
+    }
+    TSUNIT_EQUAL(inpackets.size(), count);
+    TSUNIT_EQUAL(0, in.readPackets(&inpackets[0], nullptr, 1, CERR));
+    TSUNIT_ASSERT(in.close(CERR));
+
+    for (size_t i = 0; i < count; ++i) {
+        TSUNIT_EQUAL((i % packets.size()) % 1000, inpackets[i].getPID());
+    }
+}
+
+TSUNIT_DEFINE_TEST(Compressed)
+{
+    // Streaming compression requires the zlib library.
+    if (!ts::ZlibStream::Supported()) {
+        debug() << "TSFileTest::testCompressed: no zlib support, test skipped" << std::endl;
+        return;
+    }
+
+    // Write a gzip-compressed file.
+    ts::TSFile out;
+    out.setWriteCompression(6);
+    TSUNIT_ASSERT(!fs::exists(_tempFileName));
+    TSUNIT_ASSERT(out.open(_tempFileName, ts::TSFile::WRITE, CERR));
+
+    ts::TSPacketVector packets(400);
+    for (size_t i = 0; i < packets.size(); ++i) {
+        packets[i] = ts::NullPacket;
+        packets[i].setPID(ts::PID(i % 1000));
+    }
+    TSUNIT_ASSERT(out.writePackets(packets.data(), nullptr, packets.size(), CERR));
+    TSUNIT_ASSERT(out.close(CERR));
+
+    // The file shall be smaller than the packets and start with the gzip magic number.
+    TSUNIT_ASSERT(fs::file_size(_tempFileName, &ts::ErrCodeReport(CERR)) < packets.size() * ts::PKT_SIZE);
+    ts::ByteBlock header;
+    TSUNIT_ASSERT(header.loadFromFile(_tempFileName, 2, &CERR));
+    TSUNIT_EQUAL(2, header.size());
+    TSUNIT_EQUAL(0x1F, header[0]);
+    TSUNIT_EQUAL(0x8B, header[1]);
+
+    // Read it back with transparent decompression, with two repetitions (rewind the compressed file).
+    ts::TSFile in;
+    TSUNIT_ASSERT(in.openRead(_tempFileName, 2, 0, CERR));
+
+    ts::TSPacketVector inpackets(2 * packets.size());
+    size_t count = 0;
+    while (count < inpackets.size()) {
+        const size_t more = in.readPackets(&inpackets[count], nullptr, std::min<size_t>(19, inpackets.size() - count), CERR);
+        if (more == 0) {
+            break;
+        }
+        count += more;
+    }
+    TSUNIT_EQUAL(inpackets.size(), count);
+    TSUNIT_EQUAL(0, in.readPackets(&inpackets[0], nullptr, 1, CERR));
+    TSUNIT_ASSERT(in.close(CERR));
+
+    for (size_t i = 0; i < count; ++i) {
+        TSUNIT_EQUAL((i % packets.size()) % 1000, inpackets[i].getPID());
+    }
+}
+
+TSUNIT_DEFINE_TEST(MemoryMap)
+{
+    // Write a regular file.
+    ts::TSFile out;
+    TSUNIT_ASSERT(!fs::exists(_tempFileName));
+    TSUNIT_ASSERT(out.open(_tempFileName, ts::TSFile::WRITE, CERR));
+
+    ts::TSPacketVector packets(300);
+    for (size_t i = 0; i < packets.size(); ++i) {
+        packets[i] = ts::NullPacket;
+        packets[i].setPID(ts::PID(i % 1000));
+    }
+    TSUNIT_ASSERT(out.writePackets(packets.data(), nullptr, packets.size(), CERR));
+    TSUNIT_ASSERT(out.close(CERR));
+
+    // Read it back with memory-mapped input, with two repetitions. On Windows,
+    // TSFile transparently uses standard input and the test remains valid.
+    ts::TSFile in;
+    in.setMemoryMap(true);
+    TSUNIT_ASSERT(in.openRead(_tempFileName, 2, 0, CERR));
+
+    ts::TSPacketVector inpackets(2 * packets.size());
+    size_t count = 0;
+    while (count < inpackets.size()) {
+        const size_t more = in.readPackets(&inpackets[count], nullptr, std::min<size_t>(23, inpackets.size() - count), CERR);
+        if (more == 0) {
+            break;
+        }
+        count += more;
+    }
+    TSUNIT_EQUAL(inpackets.size(), count);
+    TSUNIT_EQUAL(0, in.readPackets(&inpackets[0], nullptr, 1, CERR));
+    TSUNIT_ASSERT(in.close(CERR));
+
+    for (size_t i = 0; i < count; ++i) {
+        TSUNIT_EQUAL((i % packets.size()) % 1000, inpackets[i].getPID());
+    }
+}
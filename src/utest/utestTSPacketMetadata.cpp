@@ -21,6 +21,7 @@
 class TSPacketMetadataTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(Size);
+    TSUNIT_DECLARE_TEST(Batch);
 };
 
 TSUNIT_REGISTER(TSPacketMetadataTest);
@@ -45,3 +46,61 @@ TSUNIT_DEFINE_TEST(Size)
 
     TSUNIT_ASSUME(4 == sizeof(ts::TSPacketLabelSet));
 }
+
+TSUNIT_DEFINE_TEST(Batch)
+{
+    // Build a batch of metadata which looks like a real capture: increasing
+    // time stamps, a constant time source, a few label and flag changes.
+    ts::TSPacketMetadataVector in(1000);
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i].setInputTimeStamp(ts::PCR(1'000'000 + 1234 * int64_t(i)), ts::TimeSource::KERNEL);
+        if (i >= 100 && i < 200) {
+            in[i].setLabel(7);
+        }
+        if (i % 50 == 0) {
+            in[i].setInputStuffing(true);
+        }
+    }
+    in[42].clearInputTimeStamp();
+
+    // Uncompressed batch.
+    ts::ByteBlock bin;
+    ts::TSPacketMetadata::SerializeBatch(bin, in.data(), in.size());
+    debug() << "TSPacketMetadataTest::testBatch: uncompressed batch: " << bin.size() << " bytes for " << in.size() << " packets" << std::endl;
+    TSUNIT_ASSERT(!bin.empty());
+    TSUNIT_ASSERT(bin.size() < in.size() * ts::TSPacketMetadata::SERIALIZATION_SIZE / 2);
+
+    ts::TSPacketMetadataVector out;
+    TSUNIT_ASSERT(ts::TSPacketMetadata::DeserializeBatch(out, bin));
+    TSUNIT_EQUAL(in.size(), out.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        TSUNIT_EQUAL(in[i].getInputTimeStamp().count(), out[i].getInputTimeStamp().count());
+        TSUNIT_ASSERT(in[i].getInputTimeSource() == out[i].getInputTimeSource());
+        TSUNIT_ASSERT(in[i].labels() == out[i].labels());
+        TSUNIT_EQUAL(in[i].getInputStuffing(), out[i].getInputStuffing());
+        TSUNIT_EQUAL(in[i].getNullified(), out[i].getNullified());
+    }
+
+    // Compressed batch.
+    ts::ByteBlock zbin;
+    ts::TSPacketMetadata::SerializeBatch(zbin, in.data(), in.size(), 6);
+    debug() << "TSPacketMetadataTest::testBatch: compressed batch: " << zbin.size() << " bytes for " << in.size() << " packets" << std::endl;
+    TSUNIT_ASSERT(!zbin.empty());
+
+    out.clear();
+    TSUNIT_ASSERT(ts::TSPacketMetadata::DeserializeBatch(out, zbin));
+    TSUNIT_EQUAL(in.size(), out.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        TSUNIT_EQUAL(in[i].getInputTimeStamp().count(), out[i].getInputTimeStamp().count());
+        TSUNIT_ASSERT(in[i].labels() == out[i].labels());
+    }
+
+    // Empty and invalid batches.
+    ts::TSPacketMetadata::SerializeBatch(bin, nullptr, 0);
+    TSUNIT_ASSERT(ts::TSPacketMetadata::DeserializeBatch(out, bin));
+    TSUNIT_ASSERT(out.empty());
+    bin[0] = 0x47;
+    TSUNIT_ASSERT(!ts::TSPacketMetadata::DeserializeBatch(out, bin));
+    bin.resize(3);
+    TSUNIT_ASSERT(!ts::TSPacketMetadata::DeserializeBatch(out, bin));
+}
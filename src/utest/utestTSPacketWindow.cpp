@@ -21,6 +21,9 @@
 class TSPacketWindowTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(All);
+    TSUNIT_DECLARE_TEST(MetadataPlanes);
+    TSUNIT_DECLARE_TEST(NullPacketRuns);
+    TSUNIT_DECLARE_TEST(HeaderStats);
 };
 
 TSUNIT_REGISTER(TSPacketWindowTest);
@@ -127,3 +130,146 @@ TSUNIT_DEFINE_TEST(All)
     TSUNIT_EQUAL(map[7], win.packetIndexInBuffer(7, packets, 10));
     TSUNIT_EQUAL(ts::NPOS, win.packetIndexInBuffer(11, packets, 10));
 }
+
+TSUNIT_DEFINE_TEST(MetadataPlanes)
+{
+    // Physical buffer of 6 packets, two segments in the window.
+    ts::TSPacket packets[6];
+    ts::TSPacketMetadata mdata[6];
+    for (size_t i = 0; i < 6; ++i) {
+        packets[i].init(ts::PID(200 + i));
+    }
+    mdata[1].setLabel(3);
+    mdata[4].setLabel(17);
+    mdata[4].setInputStuffing(true);
+    mdata[5].setNullified(true);
+    mdata[5].setInputTimeStamp(ts::PCR(123456), ts::TimeSource::TSP);
+
+    ts::TSPacketWindow win;
+    win.addPacketsReference(packets + 3, mdata + 3, 3);
+    win.addPacketsReference(packets, mdata, 3);
+    TSUNIT_EQUAL(6, win.size());
+    TSUNIT_EQUAL(2, win.segmentCount());
+
+    ts::TSPacketWindow::MetadataPlanes& planes(win.metadataPlanes());
+    TSUNIT_EQUAL(6, planes.labels.size());
+    TSUNIT_EQUAL(6, planes.input_times.size());
+    TSUNIT_EQUAL(6, planes.flags.size());
+
+    // Window index 0..2 -> physical 3..5, window index 3..5 -> physical 0..2.
+    TSUNIT_ASSERT(planes.labels[4].test(3));
+    TSUNIT_ASSERT(planes.labels[1].test(17));
+    TSUNIT_ASSERT(planes.labels[0].none());
+    TSUNIT_EQUAL(ts::TSPacketWindow::MetadataPlanes::FLAG_INPUT_STUFFING, planes.flags[1]);
+    TSUNIT_EQUAL(ts::TSPacketWindow::MetadataPlanes::FLAG_NULLIFIED, planes.flags[2]);
+    TSUNIT_EQUAL(0, planes.flags[0]);
+    TSUNIT_EQUAL(123456, planes.input_times[2]);
+    TSUNIT_EQUAL(ts::INVALID_PCR, planes.input_times[0]);
+
+    // Modify the labels plane and write it back.
+    planes.labels[3].set(25);
+    planes.labels[4].reset(3);
+    win.commitLabels();
+    TSUNIT_ASSERT(mdata[0].hasLabel(25));
+    TSUNIT_ASSERT(!mdata[1].hasLabel(3));
+    TSUNIT_ASSERT(mdata[4].hasLabel(17));
+}
+
+TSUNIT_DEFINE_TEST(NullPacketRuns)
+{
+    // Physical buffer of 8 packets, null packets at physical indexes 1, 2, 3, 5, 7.
+    ts::TSPacket packets[8];
+    ts::TSPacketMetadata mdata[8];
+    for (size_t i = 0; i < 8; ++i) {
+        packets[i].init(ts::PID(300 + i));
+    }
+    packets[1] = packets[2] = packets[3] = packets[5] = packets[7] = ts::NullPacket;
+
+    // Two segments in the window, all packets in physical order.
+    ts::TSPacketWindow win;
+    win.addPacketsReference(packets, mdata, 4);
+    win.addPacketsReference(packets + 4, mdata + 4, 4);
+    TSUNIT_EQUAL(8, win.size());
+
+    const auto& runs(win.nullPacketRuns());
+    TSUNIT_EQUAL(3, runs.size());
+    TSUNIT_EQUAL(1, runs[0].first);
+    TSUNIT_EQUAL(3, runs[0].count);
+    TSUNIT_EQUAL(5, runs[1].first);
+    TSUNIT_EQUAL(1, runs[1].count);
+    TSUNIT_EQUAL(7, runs[2].first);
+    TSUNIT_EQUAL(1, runs[2].count);
+
+    // Nullifying a packet invalidates the index, the next call rebuilds it.
+    win.nullify(4);
+    const auto& runs2(win.nullPacketRuns());
+    TSUNIT_EQUAL(2, runs2.size());
+    TSUNIT_EQUAL(1, runs2[0].first);
+    TSUNIT_EQUAL(5, runs2[0].count);
+    TSUNIT_EQUAL(7, runs2[1].first);
+    TSUNIT_EQUAL(1, runs2[1].count);
+
+    // A dropped packet is no longer indexed.
+    win.drop(7);
+    const auto& runs3(win.nullPacketRuns());
+    TSUNIT_EQUAL(1, runs3.size());
+    TSUNIT_EQUAL(1, runs3[0].first);
+    TSUNIT_EQUAL(5, runs3[0].count);
+}
+
+TSUNIT_DEFINE_TEST(HeaderStats)
+{
+    // Physical buffer of 8 packets: PID 400 three times, PID 401 twice,
+    // PID 402 once, two null packets.
+    ts::TSPacket packets[8];
+    ts::TSPacketMetadata mdata[8];
+    packets[0].init(ts::PID(400));
+    packets[1].init(ts::PID(401));
+    packets[2].init(ts::PID(400));
+    packets[3].init(ts::PID_NULL);
+    packets[4].init(ts::PID(402));
+    packets[5].init(ts::PID(400));
+    packets[6].init(ts::PID(401));
+    packets[7].init(ts::PID_NULL);
+    packets[0].setPUSI();
+    packets[4].setPUSI();
+    packets[1].setTEI();
+    packets[5].setScrambling(ts::SC_EVEN_KEY);
+    packets[6].setScrambling(ts::SC_ODD_KEY);
+
+    // Two segments in the window, all packets in physical order.
+    ts::TSPacketWindow win;
+    win.addPacketsReference(packets, mdata, 5);
+    win.addPacketsReference(packets + 5, mdata + 5, 3);
+    TSUNIT_EQUAL(8, win.size());
+
+    const auto& stats(win.headerStats());
+    TSUNIT_EQUAL(2, stats.pusi_count);
+    TSUNIT_EQUAL(1, stats.tei_count);
+    TSUNIT_EQUAL(2, stats.scrambled_count);
+    TSUNIT_EQUAL(2, stats.null_count);
+    TSUNIT_EQUAL(4, stats.pids.size());
+    TSUNIT_EQUAL(400, stats.pids[0]);
+    TSUNIT_EQUAL(401, stats.pids[1]);
+    TSUNIT_EQUAL(402, stats.pids[2]);
+    TSUNIT_EQUAL(ts::PID_NULL, stats.pids[3]);
+    TSUNIT_EQUAL(3, stats.pid_packets[400]);
+    TSUNIT_EQUAL(2, stats.pid_packets[401]);
+    TSUNIT_EQUAL(1, stats.pid_packets[402]);
+    TSUNIT_EQUAL(2, stats.pid_packets[ts::PID_NULL]);
+    TSUNIT_EQUAL(0, stats.pid_packets[403]);
+
+    // Nullifying a packet invalidates the statistics, the next call recomputes them.
+    win.nullify(4);
+    const auto& stats2(win.headerStats());
+    TSUNIT_EQUAL(3, stats2.null_count);
+    TSUNIT_EQUAL(0, stats2.pid_packets[402]);
+    TSUNIT_EQUAL(1, stats2.pusi_count);
+    TSUNIT_EQUAL(3, stats2.pids.size());
+
+    // A dropped packet is no longer counted.
+    win.drop(6);
+    const auto& stats3(win.headerStats());
+    TSUNIT_EQUAL(1, stats3.pid_packets[401]);
+    TSUNIT_EQUAL(1, stats3.scrambled_count);
+}
@@ -27,6 +27,7 @@ class UStringTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(IsSpace);
     TSUNIT_DECLARE_TEST(UTF);
+    TSUNIT_DECLARE_TEST(UTFBoundary);
     TSUNIT_DECLARE_TEST(Diacritical);
     TSUNIT_DECLARE_TEST(Surrogate);
     TSUNIT_DECLARE_TEST(FromWChar);
@@ -71,6 +72,7 @@ class UStringTest: public tsunit::Test
     TSUNIT_DECLARE_TEST(ArgMixIn);
     TSUNIT_DECLARE_TEST(ArgMixOut);
     TSUNIT_DECLARE_TEST(ArgMixOutFloat);
+    TSUNIT_DECLARE_TEST(ValidFormat);
     TSUNIT_DECLARE_TEST(Format);
     TSUNIT_DECLARE_TEST(Scan);
     TSUNIT_DECLARE_TEST(CommonPrefix);
@@ -228,6 +230,7 @@ TSUNIT_DEFINE_TEST(UTF)
     ts::UString s2(reinterpret_cast<const ts::UChar*>(utf16_values), utf16_count);
     ts::UString s3(ts::UString::FromUTF8(reinterpret_cast<const char*>(utf8_bytes)));
     ts::UString s4(ts::UString::FromUTF8(reinterpret_cast<const char*>(utf8_bytes), utf8_count));
+    ts::UString s5(ts::UString::FromUTF8(std::string_view(reinterpret_cast<const char*>(utf8_bytes), utf8_count)));
 
     debug() << "UStringTest::testUTF: utf16_count = " << utf16_count << ", s1.length() = " << s1.length() << std::endl;
 
@@ -235,15 +238,79 @@ TSUNIT_DEFINE_TEST(UTF)
     TSUNIT_EQUAL(s2.length(), s2.size());
     TSUNIT_EQUAL(s3.length(), s3.size());
     TSUNIT_EQUAL(s4.length(), s4.size());
+    TSUNIT_EQUAL(s5.length(), s5.size());
 
     TSUNIT_EQUAL(s1.length(), utf16_count);
     TSUNIT_EQUAL(s2.length(), utf16_count);
     TSUNIT_EQUAL(s3.length(), utf16_count);
     TSUNIT_EQUAL(s4.length(), utf16_count);
+    TSUNIT_EQUAL(s5.length(), utf16_count);
 
     TSUNIT_EQUAL(s1, s2);
     TSUNIT_EQUAL(s1, s3);
     TSUNIT_EQUAL(s1, s4);
+    TSUNIT_EQUAL(s1, s5);
+
+    // Round-trip back to UTF-8, exercising the bulk ASCII fast path.
+    TSUNIT_EQUAL(std::string(reinterpret_cast<const char*>(utf8_bytes), utf8_count), s1.toUTF8());
+}
+
+TSUNIT_DEFINE_TEST(UTFBoundary)
+{
+    // ASCII input, longer than the output buffer, with output sizes which are
+    // exact multiples of the bulk ASCII fast path granularity (4 UChars in
+    // UTF-16 to UTF-8, 8 bytes in UTF-8 to UTF-16). The conversion must stop
+    // exactly at the end of the output buffer, without writing one unit past it.
+    static const ts::UChar utf16_in[] = u"abcdefghijklm";
+    static const char utf8_in[] = "abcdefghijklm";
+
+    // UTF-16 to UTF-8, output window of 8 bytes.
+    {
+        char out[10];
+        out[8] = out[9] = '\x7F';
+        const ts::UChar* in_start = utf16_in;
+        const ts::UChar* const in_end = utf16_in + 13;
+        char* out_start = out;
+        char* const out_end = out + 8;
+        ts::UString::ConvertUTF16ToUTF8(in_start, in_end, out_start, out_end);
+        TSUNIT_ASSERT(out_start == out_end);
+        TSUNIT_ASSERT(in_start == utf16_in + 8);
+        TSUNIT_EQUAL('\x7F', out[8]);
+        TSUNIT_EQUAL('\x7F', out[9]);
+        TSUNIT_EQUAL(std::string("abcdefgh"), std::string(out, 8));
+    }
+
+    // UTF-8 to UTF-16, output window of 8 UChars.
+    {
+        ts::UChar out[10];
+        out[8] = out[9] = ts::UChar(0x7FFF);
+        const char* in_start = utf8_in;
+        const char* const in_end = utf8_in + 13;
+        ts::UChar* out_start = out;
+        ts::UChar* const out_end = out + 8;
+        ts::UString::ConvertUTF8ToUTF16(in_start, in_end, out_start, out_end);
+        TSUNIT_ASSERT(out_start == out_end);
+        TSUNIT_ASSERT(in_start == utf8_in + 8);
+        TSUNIT_EQUAL(ts::UChar(0x7FFF), out[8]);
+        TSUNIT_EQUAL(ts::UChar(0x7FFF), out[9]);
+        TSUNIT_EQUAL(ts::UString(u"abcdefgh"), ts::UString(out, 8));
+    }
+
+    // UTF-16 to UTF-8, output window of 4 bytes (bulk loop fills it in one pass).
+    {
+        char out[6];
+        out[4] = out[5] = '\x7F';
+        const ts::UChar* in_start = utf16_in;
+        const ts::UChar* const in_end = utf16_in + 13;
+        char* out_start = out;
+        char* const out_end = out + 4;
+        ts::UString::ConvertUTF16ToUTF8(in_start, in_end, out_start, out_end);
+        TSUNIT_ASSERT(out_start == out_end);
+        TSUNIT_ASSERT(in_start == utf16_in + 4);
+        TSUNIT_EQUAL('\x7F', out[4]);
+        TSUNIT_EQUAL('\x7F', out[5]);
+        TSUNIT_EQUAL(std::string("abcd"), std::string(out, 4));
+    }
 }
 
 TSUNIT_DEFINE_TEST(Diacritical)
@@ -1880,6 +1947,29 @@ void UStringTest::testArgMixInCalled2(std::initializer_list<ts::ArgMixIn> list)
     TSUNIT_ASSERT(it == list.end());
 }
 
+TSUNIT_DEFINE_TEST(ValidFormat)
+{
+    // Compile-time validation of literal format strings.
+    static_assert(ts::UString::ValidFormat(u""));
+    static_assert(ts::UString::ValidFormat(u"abc"));
+    static_assert(ts::UString::ValidFormat(u"100%%"));
+    static_assert(ts::UString::ValidFormat(u"abc%d", 1));
+    static_assert(ts::UString::ValidFormat(u"i = %'d, u16 = 0x%X, %d %s", 4));
+    static_assert(ts::UString::ValidFormat(u"%-8.3f %+0d %!s", 3));
+    static_assert(ts::UString::ValidFormat(u"%*d", 2));
+    static_assert(ts::UString::ValidFormat(u"%.*s", 2));
+    static_assert(ts::UString::ValidFormat(u"%d %<d", 1));
+    static_assert(!ts::UString::ValidFormat(u"a %z"));
+    static_assert(!ts::UString::ValidFormat(u"f) %d %01"));
+    static_assert(!ts::UString::ValidFormat(u"a) %d %d", 4));
+    static_assert(!ts::UString::ValidFormat(u"b) %d %d", 1));
+
+    // Same checks at run time, on non-literal strings.
+    const ts::UString fmt(u"e) ab%scd%sef");
+    TSUNIT_ASSERT(ts::UString::ValidFormat(fmt.c_str(), 2));
+    TSUNIT_ASSERT(!ts::UString::ValidFormat(fmt.c_str(), 1));
+}
+
 TSUNIT_DEFINE_TEST(Format)
 {
     TSUNIT_EQUAL(u"", ts::UString::Format(u""));
@@ -11,6 +11,7 @@
 //----------------------------------------------------------------------------
 
 #include "tsxmlModelDocument.h"
+#include "tsxmlStreamingDocument.h"
 #include "tsxmlElement.h"
 #include "tsxmlDeclaration.h"
 #include "tsSectionFile.h"
@@ -29,6 +30,7 @@
 class XMLTest: public tsunit::Test
 {
     TSUNIT_DECLARE_TEST(Document);
+    TSUNIT_DECLARE_TEST(Streaming);
     TSUNIT_DECLARE_TEST(Invalid);
     TSUNIT_DECLARE_TEST(FileBOM);
     TSUNIT_DECLARE_TEST(Validation);
@@ -161,6 +163,59 @@ TSUNIT_DEFINE_TEST(Document)
     TSUNIT_ASSERT(elem == nullptr);
 }
 
+TSUNIT_DEFINE_TEST(Streaming)
+{
+    static const ts::UChar* const document =
+        u"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        u"<root attr1=\"val1\">\n"
+        u"  <node1 a1=\"v1\">Text in node1</node1>\n"
+        u"  <node2/>\n"
+        u"  <node3 b1=\"x1\"/>\n"
+        u"</root>\n";
+
+    // A handler which collects a description of all elements.
+    class Handler: public ts::xml::StreamingDocumentHandler
+    {
+    public:
+        ts::UStringList log {};
+        size_t abort_after = ts::NPOS;
+        virtual bool handleRootElement(const ts::xml::Element& root) override
+        {
+            log.push_back(ts::UString::Format(u"root: %s, attr1: %s", root.name(), root.attribute(u"attr1").value()));
+            return true;
+        }
+        virtual bool handleChildElement(const ts::xml::Element& element) override
+        {
+            log.push_back(ts::UString::Format(u"child: %s, text: \"%s\"", element.name(), element.text()));
+            return log.size() < abort_after;
+        }
+    };
+
+    Handler handler;
+    ts::xml::StreamingDocument doc(&handler, report());
+    TSUNIT_ASSERT(doc.scanFile(document));
+
+    // The document retains the declaration and the root element, without children.
+    TSUNIT_EQUAL(2, doc.childrenCount());
+    TSUNIT_ASSERT(doc.rootElement() != nullptr);
+    TSUNIT_EQUAL(u"root", doc.rootElement()->name());
+    TSUNIT_ASSERT(!doc.rootElement()->hasChildren());
+
+    // All elements were passed to the handler.
+    TSUNIT_EQUAL(4, handler.log.size());
+    auto it = handler.log.begin();
+    TSUNIT_EQUAL(u"root: root, attr1: val1", *it++);
+    TSUNIT_EQUAL(u"child: node1, text: \"Text in node1\"", *it++);
+    TSUNIT_EQUAL(u"child: node2, text: \"\"", *it++);
+    TSUNIT_EQUAL(u"child: node3, text: \"\"", *it++);
+
+    // The parsing is aborted when the handler returns false.
+    handler.log.clear();
+    handler.abort_after = 2;
+    TSUNIT_ASSERT(!doc.scanFile(document));
+    TSUNIT_EQUAL(2, handler.log.size());
+}
+
 TSUNIT_DEFINE_TEST(Invalid)
 {
     // Incorrect XML document
@@ -33,6 +33,7 @@ namespace {
 
         bool                monitor = false;    // Run a resource monitoring thread in the background.
         ts::UString         monitor_config {};  // System monitoring configuration file.
+        fs::path            monitor_json {};    // Append JSON monitoring snapshots to this file.
         ts::DuckContext     duck {this};        // TSDuck context
         ts::AsyncReportArgs log_args {};        // Asynchronous logger arguments.
         ts::MuxerArgs       mux_args {};        // TS multiplexer arguments.
@@ -52,12 +53,19 @@ TSMuxOptions::TSMuxOptions(int argc, char *argv[]) :
          u"Useful to verify the stability of the application. "
          u"The optional file is an XML monitoring configuration file.");
 
+    option(u"monitor-json", 0, FILENAME);
+    help(u"monitor-json", u"filename",
+         u"With --monitor, append a monitoring snapshot to the specified file at each monitoring interval. "
+         u"Each snapshot is one JSON object on one line (JSON Lines format). "
+         u"It includes the virtual memory breakdown and, on Linux, the per-thread CPU usage.");
+
     // Analyze the command.
     analyze(argc, argv);
 
     // Load option values.
     monitor = present(u"monitor");
     getValue(monitor_config, u"monitor");
+    getPathValue(monitor_json, u"monitor-json");
     log_args.loadArgs(*this);
     mux_args.loadArgs(duck, *this);
 
@@ -95,6 +103,9 @@ int MainCode(int argc, char *argv[])
 
     // Start the monitoring thread if required.
     if (opt.monitor) {
+        if (!opt.monitor_json.empty()) {
+            monitor.setJsonFile(opt.monitor_json);
+        }
         monitor.start();
     }
 
@@ -201,7 +201,7 @@ PluginExecutor::~PluginExecutor()
 void PluginExecutor::updateBitrateFromPrevious()
 {
     if (!_own_bitrate && _previous != nullptr) {
-        _tsp_bitrate = _previous->_tsp_bitrate;
+        setTSPBitrate(_previous->bitrate(), _previous->bitrateConfidence());
     }
 }
 
@@ -210,8 +210,7 @@ void PluginExecutor::updateBitrateFromCurrent()
 {
     const ts::BitRate bitrate = _shlib->getBitrate();
     if (bitrate != 0) {
-        _tsp_bitrate = bitrate;
-        _tsp_bitrate_confidence = _shlib->getBitrateConfidence();
+        setTSPBitrate(bitrate, _shlib->getBitrateConfidence());
         _own_bitrate = true;
     }
 }
@@ -267,7 +266,7 @@ size_t InputPluginExecutor::receive(ts::TSPacket* packets, ts::TSPacketMetadata*
             addPluginPackets(1);
             if (_pcr_analyzer.feedPacket(packets[n]) && _tsp_bitrate == 0 && !_own_bitrate) {
                 // First valid bitrate from PCR.
-                _tsp_bitrate = _pcr_analyzer.bitrate188();
+                setTSPBitrate(_pcr_analyzer.bitrate188(), bitrateConfidence());
             }
         }
         else {
@@ -281,12 +280,11 @@ size_t InputPluginExecutor::receive(ts::TSPacket* packets, ts::TSPacketMetadata*
     if (_opt.fixed_bitrate == 0 && pluginPackets() >= _next_get_bitrate) {
         ts::BitRate bitrate = plugin()->getBitrate();
         if (bitrate > 0) {
-            _tsp_bitrate = bitrate;
-            _tsp_bitrate_confidence = plugin()->getBitrateConfidence();
+            setTSPBitrate(bitrate, plugin()->getBitrateConfidence());
             _own_bitrate = true;
         }
         else if (!_own_bitrate && _pcr_analyzer.bitrateIsValid()) {
-            _tsp_bitrate = _pcr_analyzer.bitrate188();
+            setTSPBitrate(_pcr_analyzer.bitrate188(), bitrateConfidence());
         }
         _next_get_bitrate = pluginPackets() + 1000; // arbitrary...
     }